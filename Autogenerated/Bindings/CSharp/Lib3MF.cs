@@ -324,6 +324,23 @@ namespace Lib3MF {
 		public Double Radius;
 	}
 
+	public struct sSliceLayerReport
+	{
+		public UInt32 LayerIndex;
+		public UInt32 OpenPolygons;
+		public UInt32 DegeneratePolygons;
+		public UInt32 SelfIntersections;
+		public UInt32 OrientationErrors;
+		public UInt32 MaxNestingDepth;
+	}
+
+	public struct sMeshInstance
+	{
+		public UInt32 MeshIndex;
+		public UInt32 BuildItemIndex;
+		public Single[][] Transform;
+	}
+
 	public struct sVector
 	{
 		public Double[] Coordinates;
@@ -420,6 +437,25 @@ namespace Lib3MF {
 			[FieldOffset(4)] public Double Radius;
 		}
 
+		[StructLayout(LayoutKind.Explicit, Size=24)]
+		public unsafe struct InternalSliceLayerReport
+		{
+			[FieldOffset(0)] public UInt32 LayerIndex;
+			[FieldOffset(4)] public UInt32 OpenPolygons;
+			[FieldOffset(8)] public UInt32 DegeneratePolygons;
+			[FieldOffset(12)] public UInt32 SelfIntersections;
+			[FieldOffset(16)] public UInt32 OrientationErrors;
+			[FieldOffset(20)] public UInt32 MaxNestingDepth;
+		}
+
+		[StructLayout(LayoutKind.Explicit, Size=56)]
+		public unsafe struct InternalMeshInstance
+		{
+			[FieldOffset(0)] public UInt32 MeshIndex;
+			[FieldOffset(4)] public UInt32 BuildItemIndex;
+			[FieldOffset(8)] public fixed Single Transform[12];
+		}
+
 		[StructLayout(LayoutKind.Explicit, Size=24)]
 		public unsafe struct InternalVector
 		{
@@ -465,6 +501,12 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getstrictmodeactive", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_GetStrictModeActive (IntPtr Handle, out Byte AStrictModeActive);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setincrementalmodeactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetIncrementalModeActive (IntPtr Handle, Byte AIncrementalModeActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getincrementalmodeactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetIncrementalModeActive (IntPtr Handle, out Byte AIncrementalModeActive);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getwarning", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_GetWarning (IntPtr Handle, UInt32 AIndex, out UInt32 AErrorCode, UInt32 sizeWarning, out UInt32 neededWarning, IntPtr dataWarning);
 
@@ -477,6 +519,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setcontentencryptioncallback", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_SetContentEncryptionCallback (IntPtr Handle, IntPtr ATheCallback, UInt64 AUserData);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getstatistics", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetStatistics (IntPtr Handle, UInt32 sizeStatistics, out UInt32 neededStatistics, IntPtr dataStatistics);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_readfromfile", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_ReadFromFile (IntPtr Handle, byte[] AFilename);
 
@@ -513,6 +558,15 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setcontentencryptioncallback", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_SetContentEncryptionCallback (IntPtr Handle, IntPtr ATheCallback, UInt64 AUserData);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setinplacedecryptionactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetInPlaceDecryptionActive (IntPtr Handle, Byte AInPlaceDecryptionActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getinplacedecryptionactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetInPlaceDecryptionActive (IntPtr Handle, out Byte AInPlaceDecryptionActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getstatistics", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetStatistics (IntPtr Handle, UInt32 sizeStatistics, out UInt32 neededStatistics, IntPtr dataStatistics);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_packagepart_getpath", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 PackagePart_GetPath (IntPtr Handle, UInt32 sizePath, out UInt32 neededPath, IntPtr dataPath);
 
@@ -1134,6 +1188,12 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_colorgroup_getcolor", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 ColorGroup_GetColor (IntPtr Handle, UInt32 APropertyID, out InternalColor ATheColor);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_colorgroup_getallcolors", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ColorGroup_GetAllColors (IntPtr Handle, UInt64 sizeColors, out UInt64 neededColors, IntPtr dataColors);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_colorgroup_setallcolors", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ColorGroup_SetAllColors (IntPtr Handle, UInt64 sizeColors, IntPtr dataColors);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_texture2dgroup_getcount", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Texture2DGroup_GetCount (IntPtr Handle, out UInt32 ACount);
 
@@ -1152,6 +1212,12 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_texture2dgroup_gettexture2d", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Texture2DGroup_GetTexture2D (IntPtr Handle, out IntPtr ATexture2DInstance);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_texture2dgroup_getalltex2coords", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Texture2DGroup_GetAllTex2Coords (IntPtr Handle, UInt64 sizeUVCoordinates, out UInt64 neededUVCoordinates, IntPtr dataUVCoordinates);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_texture2dgroup_setalltex2coords", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Texture2DGroup_SetAllTex2Coords (IntPtr Handle, UInt64 sizeUVCoordinates, IntPtr dataUVCoordinates);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_compositematerials_getcount", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 CompositeMaterials_GetCount (IntPtr Handle, out UInt32 ACount);
 
@@ -1845,6 +1911,27 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_builditemiterator_count", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 BuildItemIterator_Count (IntPtr Handle, out UInt64 ACount);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_getmeshcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetMeshCount (IntPtr Handle, out UInt32 ACount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_getmeshobject", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetMeshObject (IntPtr Handle, UInt32 AMeshIndex, out IntPtr AMeshObject);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_getmeshrange", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetMeshRange (IntPtr Handle, UInt32 AMeshIndex, out UInt32 AVertexOffset, out UInt32 AVertexCount, out UInt32 ATriangleOffset, out UInt32 ATriangleCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_getvertices", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetVertices (IntPtr Handle, UInt64 sizeVertices, out UInt64 neededVertices, IntPtr dataVertices);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_gettriangles", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetTriangles (IntPtr Handle, UInt64 sizeTriangles, out UInt64 neededTriangles, IntPtr dataTriangles);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_getinstancecount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetInstanceCount (IntPtr Handle, out UInt32 ACount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_instancetable_getinstances", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 InstanceTable_GetInstances (IntPtr Handle, UInt64 sizeInstances, out UInt64 neededInstances, IntPtr dataInstances);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slice_setvertices", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Slice_SetVertices (IntPtr Handle, UInt64 sizeVertices, IntPtr dataVertices);
 
@@ -1902,6 +1989,21 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slicestack_getownpath", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 SliceStack_GetOwnPath (IntPtr Handle, UInt32 sizePath, out UInt32 neededPath, IntPtr dataPath);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slicestack_gettotalslicecount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 SliceStack_GetTotalSliceCount (IntPtr Handle, out UInt64 ACount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slicestack_gettotalslice", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 SliceStack_GetTotalSlice (IntPtr Handle, UInt64 ATotalSliceIndex, out IntPtr ATheSlice);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slicestack_findsliceatz", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 SliceStack_FindSliceAtZ (IntPtr Handle, Double AZValue, out UInt64 ATotalSliceIndex, out Byte AFound);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slicestack_getslicerange", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 SliceStack_GetSliceRange (IntPtr Handle, Double AZMin, Double AZMax, out UInt64 AFirstIndex, out UInt64 ACount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_slicestack_validatepolygons", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 SliceStack_ValidatePolygons (IntPtr Handle, UInt64 sizeLayerReports, out UInt64 neededLayerReports, IntPtr dataLayerReports);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_consumer_getconsumerid", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Consumer_GetConsumerID (IntPtr Handle, UInt32 sizeConsumerID, out UInt32 neededConsumerID, IntPtr dataConsumerID);
 
@@ -2094,6 +2196,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_getoutbox", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Model_GetOutbox (IntPtr Handle, out InternalBox AOutbox);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_getinstancetable", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Model_GetInstanceTable (IntPtr Handle, out IntPtr AInstanceTable);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_getresources", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Model_GetResources (IntPtr Handle, out IntPtr AResourceIterator);
 
@@ -2238,6 +2343,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_removeresource", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Model_RemoveResource (IntPtr Handle, IntPtr AResource);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_model_deduplicateproperties", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Model_DeduplicateProperties (IntPtr Handle, Byte ARemoveUnreferenced, out UInt32 ARemovedCount);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_getlibraryversion", CharSet = CharSet.Ansi, CallingConvention=CallingConvention.Cdecl)]
 			public extern static Int32 GetLibraryVersion (out UInt32 AMajor, out UInt32 AMinor, out UInt32 AMicro);
 
@@ -2560,6 +2668,60 @@ namespace Lib3MF {
 				return intBall;
 			}
 
+			public unsafe static sSliceLayerReport convertInternalToStruct_SliceLayerReport (InternalSliceLayerReport intSliceLayerReport)
+			{
+				sSliceLayerReport SliceLayerReport;
+				SliceLayerReport.LayerIndex = intSliceLayerReport.LayerIndex;
+				SliceLayerReport.OpenPolygons = intSliceLayerReport.OpenPolygons;
+				SliceLayerReport.DegeneratePolygons = intSliceLayerReport.DegeneratePolygons;
+				SliceLayerReport.SelfIntersections = intSliceLayerReport.SelfIntersections;
+				SliceLayerReport.OrientationErrors = intSliceLayerReport.OrientationErrors;
+				SliceLayerReport.MaxNestingDepth = intSliceLayerReport.MaxNestingDepth;
+				return SliceLayerReport;
+			}
+
+			public unsafe static InternalSliceLayerReport convertStructToInternal_SliceLayerReport (sSliceLayerReport SliceLayerReport)
+			{
+				InternalSliceLayerReport intSliceLayerReport;
+				intSliceLayerReport.LayerIndex = SliceLayerReport.LayerIndex;
+				intSliceLayerReport.OpenPolygons = SliceLayerReport.OpenPolygons;
+				intSliceLayerReport.DegeneratePolygons = SliceLayerReport.DegeneratePolygons;
+				intSliceLayerReport.SelfIntersections = SliceLayerReport.SelfIntersections;
+				intSliceLayerReport.OrientationErrors = SliceLayerReport.OrientationErrors;
+				intSliceLayerReport.MaxNestingDepth = SliceLayerReport.MaxNestingDepth;
+				return intSliceLayerReport;
+			}
+
+			public unsafe static sMeshInstance convertInternalToStruct_MeshInstance (InternalMeshInstance intMeshInstance)
+			{
+				sMeshInstance MeshInstance;
+				MeshInstance.MeshIndex = intMeshInstance.MeshIndex;
+				MeshInstance.BuildItemIndex = intMeshInstance.BuildItemIndex;
+				MeshInstance.Transform = new Single[4][];
+				for (int colIndex = 0; colIndex < 4; colIndex++) {
+					MeshInstance.Transform[colIndex] = new Single[3];
+					for (int rowIndex = 0; rowIndex < 3; rowIndex++) {
+						MeshInstance.Transform[colIndex][rowIndex] = intMeshInstance.Transform[colIndex * 3 + rowIndex];
+					}
+				}
+
+				return MeshInstance;
+			}
+
+			public unsafe static InternalMeshInstance convertStructToInternal_MeshInstance (sMeshInstance MeshInstance)
+			{
+				InternalMeshInstance intMeshInstance;
+				intMeshInstance.MeshIndex = MeshInstance.MeshIndex;
+				intMeshInstance.BuildItemIndex = MeshInstance.BuildItemIndex;
+				for (int colIndex = 0; colIndex < 4; colIndex++) {
+					for (int rowIndex = 0; rowIndex < 3; rowIndex++) {
+						intMeshInstance.Transform[colIndex * 3 + rowIndex] = MeshInstance.Transform[colIndex][rowIndex];
+					}
+				}
+
+				return intMeshInstance;
+			}
+
 			public unsafe static sVector convertInternalToStruct_Vector (InternalVector intVector)
 			{
 				sVector Vector;
@@ -2757,6 +2919,7 @@ namespace Lib3MF {
 					case 0x9BD7D3C2026B8CE8: Object = new CFunctionFromImage3D(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
 					case 0x68FB2D5FFC4BA12A: Object = new CBuildItem(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 					case 0xA7D21BD364910860: Object = new CBuildItemIterator(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
+					case 0xCDB5C649E208089D: Object = new CInstanceTable(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::InstanceTable"
 					case 0x2198BCF4D8DF9C40: Object = new CSlice(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
 					case 0x6594B031B6096238: Object = new CSliceStack(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::SliceStack"
 					case 0xD9E46D5E6D8118EE: Object = new CConsumer(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Consumer"
@@ -2902,6 +3065,20 @@ namespace Lib3MF {
 			return (resultStrictModeActive != 0);
 		}
 
+		public void SetIncrementalModeActive (bool AIncrementalModeActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetIncrementalModeActive (Handle, (Byte)( AIncrementalModeActive ? 1 : 0 )));
+		}
+
+		public bool GetIncrementalModeActive ()
+		{
+			Byte resultIncrementalModeActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetIncrementalModeActive (Handle, out resultIncrementalModeActive));
+			return (resultIncrementalModeActive != 0);
+		}
+
 		public String GetWarning (UInt32 AIndex, out UInt32 AErrorCode)
 		{
 			UInt32 sizeWarning = 0;
@@ -2937,6 +3114,20 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.Writer_SetContentEncryptionCallback (Handle, ATheCallback, AUserData));
 		}
 
+		public String GetStatistics ()
+		{
+			UInt32 sizeStatistics = 0;
+			UInt32 neededStatistics = 0;
+			CheckError(Internal.Lib3MFWrapper.Writer_GetStatistics (Handle, sizeStatistics, out neededStatistics, IntPtr.Zero));
+			sizeStatistics = neededStatistics;
+			byte[] bytesStatistics = new byte[sizeStatistics];
+			GCHandle dataStatistics = GCHandle.Alloc(bytesStatistics, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetStatistics (Handle, sizeStatistics, out neededStatistics, dataStatistics.AddrOfPinnedObject()));
+			dataStatistics.Free();
+			return Encoding.UTF8.GetString(bytesStatistics).TrimEnd(char.MinValue);
+		}
+
 	}
 
 	public class CReader : CBase
@@ -3035,6 +3226,34 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.Reader_SetContentEncryptionCallback (Handle, ATheCallback, AUserData));
 		}
 
+		public void SetInPlaceDecryptionActive (bool AInPlaceDecryptionActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetInPlaceDecryptionActive (Handle, (Byte)( AInPlaceDecryptionActive ? 1 : 0 )));
+		}
+
+		public bool GetInPlaceDecryptionActive ()
+		{
+			Byte resultInPlaceDecryptionActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetInPlaceDecryptionActive (Handle, out resultInPlaceDecryptionActive));
+			return (resultInPlaceDecryptionActive != 0);
+		}
+
+		public String GetStatistics ()
+		{
+			UInt32 sizeStatistics = 0;
+			UInt32 neededStatistics = 0;
+			CheckError(Internal.Lib3MFWrapper.Reader_GetStatistics (Handle, sizeStatistics, out neededStatistics, IntPtr.Zero));
+			sizeStatistics = neededStatistics;
+			byte[] bytesStatistics = new byte[sizeStatistics];
+			GCHandle dataStatistics = GCHandle.Alloc(bytesStatistics, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetStatistics (Handle, sizeStatistics, out neededStatistics, dataStatistics.AddrOfPinnedObject()));
+			dataStatistics.Free();
+			return Encoding.UTF8.GetString(bytesStatistics).TrimEnd(char.MinValue);
+		}
+
 	}
 
 	public class CPackagePart : CBase
@@ -5117,6 +5336,33 @@ namespace Lib3MF {
 			return Internal.Lib3MFWrapper.convertInternalToStruct_Color (intresultTheColor);
 		}
 
+		public void GetAllColors (out sColor[] AColors)
+		{
+			UInt64 sizeColors = 0;
+			UInt64 neededColors = 0;
+			CheckError(Internal.Lib3MFWrapper.ColorGroup_GetAllColors (Handle, sizeColors, out neededColors, IntPtr.Zero));
+			sizeColors = neededColors;
+			var arrayColors = new Internal.InternalColor[sizeColors];
+			GCHandle dataColors = GCHandle.Alloc(arrayColors, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.ColorGroup_GetAllColors (Handle, sizeColors, out neededColors, dataColors.AddrOfPinnedObject()));
+			dataColors.Free();
+			AColors = new sColor[sizeColors];
+			for (int index = 0; index < AColors.Length; index++)
+				AColors[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Color(arrayColors[index]);
+		}
+
+		public void SetAllColors (sColor[] AColors)
+		{
+			Internal.InternalColor[] intdataColors = new Internal.InternalColor[AColors.Length];
+			for (int index = 0; index < AColors.Length; index++)
+				intdataColors[index] = Internal.Lib3MFWrapper.convertStructToInternal_Color(AColors[index]);
+			GCHandle dataColors = GCHandle.Alloc(intdataColors, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.ColorGroup_SetAllColors (Handle, (UInt64) AColors.Length, dataColors.AddrOfPinnedObject()));
+			dataColors.Free ();
+		}
+
 	}
 
 	public class CTexture2DGroup : CResource
@@ -5177,6 +5423,33 @@ namespace Lib3MF {
 			return Internal.Lib3MFWrapper.PolymorphicFactory<CTexture2D>(newTexture2DInstance);
 		}
 
+		public void GetAllTex2Coords (out sTex2Coord[] AUVCoordinates)
+		{
+			UInt64 sizeUVCoordinates = 0;
+			UInt64 neededUVCoordinates = 0;
+			CheckError(Internal.Lib3MFWrapper.Texture2DGroup_GetAllTex2Coords (Handle, sizeUVCoordinates, out neededUVCoordinates, IntPtr.Zero));
+			sizeUVCoordinates = neededUVCoordinates;
+			var arrayUVCoordinates = new Internal.InternalTex2Coord[sizeUVCoordinates];
+			GCHandle dataUVCoordinates = GCHandle.Alloc(arrayUVCoordinates, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Texture2DGroup_GetAllTex2Coords (Handle, sizeUVCoordinates, out neededUVCoordinates, dataUVCoordinates.AddrOfPinnedObject()));
+			dataUVCoordinates.Free();
+			AUVCoordinates = new sTex2Coord[sizeUVCoordinates];
+			for (int index = 0; index < AUVCoordinates.Length; index++)
+				AUVCoordinates[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Tex2Coord(arrayUVCoordinates[index]);
+		}
+
+		public void SetAllTex2Coords (sTex2Coord[] AUVCoordinates)
+		{
+			Internal.InternalTex2Coord[] intdataUVCoordinates = new Internal.InternalTex2Coord[AUVCoordinates.Length];
+			for (int index = 0; index < AUVCoordinates.Length; index++)
+				intdataUVCoordinates[index] = Internal.Lib3MFWrapper.convertStructToInternal_Tex2Coord(AUVCoordinates[index]);
+			GCHandle dataUVCoordinates = GCHandle.Alloc(intdataUVCoordinates, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Texture2DGroup_SetAllTex2Coords (Handle, (UInt64) AUVCoordinates.Length, dataUVCoordinates.AddrOfPinnedObject()));
+			dataUVCoordinates.Free ();
+		}
+
 	}
 
 	public class CCompositeMaterials : CResource
@@ -7872,6 +8145,92 @@ namespace Lib3MF {
 
 	}
 
+	public class CInstanceTable : CBase
+	{
+		public CInstanceTable (IntPtr NewHandle) : base (NewHandle)
+		{
+		}
+
+		public UInt32 GetMeshCount ()
+		{
+			UInt32 resultCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetMeshCount (Handle, out resultCount));
+			return resultCount;
+		}
+
+		public CMeshObject GetMeshObject (UInt32 AMeshIndex)
+		{
+			IntPtr newMeshObject = IntPtr.Zero;
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetMeshObject (Handle, AMeshIndex, out newMeshObject));
+			return Internal.Lib3MFWrapper.PolymorphicFactory<CMeshObject>(newMeshObject);
+		}
+
+		public void GetMeshRange (UInt32 AMeshIndex, out UInt32 AVertexOffset, out UInt32 AVertexCount, out UInt32 ATriangleOffset, out UInt32 ATriangleCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetMeshRange (Handle, AMeshIndex, out AVertexOffset, out AVertexCount, out ATriangleOffset, out ATriangleCount));
+		}
+
+		public void GetVertices (out sPosition[] AVertices)
+		{
+			UInt64 sizeVertices = 0;
+			UInt64 neededVertices = 0;
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetVertices (Handle, sizeVertices, out neededVertices, IntPtr.Zero));
+			sizeVertices = neededVertices;
+			var arrayVertices = new Internal.InternalPosition[sizeVertices];
+			GCHandle dataVertices = GCHandle.Alloc(arrayVertices, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetVertices (Handle, sizeVertices, out neededVertices, dataVertices.AddrOfPinnedObject()));
+			dataVertices.Free();
+			AVertices = new sPosition[sizeVertices];
+			for (int index = 0; index < AVertices.Length; index++)
+				AVertices[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Position(arrayVertices[index]);
+		}
+
+		public void GetTriangles (out sTriangle[] ATriangles)
+		{
+			UInt64 sizeTriangles = 0;
+			UInt64 neededTriangles = 0;
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetTriangles (Handle, sizeTriangles, out neededTriangles, IntPtr.Zero));
+			sizeTriangles = neededTriangles;
+			var arrayTriangles = new Internal.InternalTriangle[sizeTriangles];
+			GCHandle dataTriangles = GCHandle.Alloc(arrayTriangles, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetTriangles (Handle, sizeTriangles, out neededTriangles, dataTriangles.AddrOfPinnedObject()));
+			dataTriangles.Free();
+			ATriangles = new sTriangle[sizeTriangles];
+			for (int index = 0; index < ATriangles.Length; index++)
+				ATriangles[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Triangle(arrayTriangles[index]);
+		}
+
+		public UInt32 GetInstanceCount ()
+		{
+			UInt32 resultCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetInstanceCount (Handle, out resultCount));
+			return resultCount;
+		}
+
+		public void GetInstances (out sMeshInstance[] AInstances)
+		{
+			UInt64 sizeInstances = 0;
+			UInt64 neededInstances = 0;
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetInstances (Handle, sizeInstances, out neededInstances, IntPtr.Zero));
+			sizeInstances = neededInstances;
+			var arrayInstances = new Internal.InternalMeshInstance[sizeInstances];
+			GCHandle dataInstances = GCHandle.Alloc(arrayInstances, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.InstanceTable_GetInstances (Handle, sizeInstances, out neededInstances, dataInstances.AddrOfPinnedObject()));
+			dataInstances.Free();
+			AInstances = new sMeshInstance[sizeInstances];
+			for (int index = 0; index < AInstances.Length; index++)
+				AInstances[index] = Internal.Lib3MFWrapper.convertInternalToStruct_MeshInstance(arrayInstances[index]);
+		}
+
+	}
+
 	public class CSlice : CBase
 	{
 		public CSlice (IntPtr NewHandle) : base (NewHandle)
@@ -8060,6 +8419,52 @@ namespace Lib3MF {
 			return Encoding.UTF8.GetString(bytesPath).TrimEnd(char.MinValue);
 		}
 
+		public UInt64 GetTotalSliceCount ()
+		{
+			UInt64 resultCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.SliceStack_GetTotalSliceCount (Handle, out resultCount));
+			return resultCount;
+		}
+
+		public CSlice GetTotalSlice (UInt64 ATotalSliceIndex)
+		{
+			IntPtr newTheSlice = IntPtr.Zero;
+
+			CheckError(Internal.Lib3MFWrapper.SliceStack_GetTotalSlice (Handle, ATotalSliceIndex, out newTheSlice));
+			return Internal.Lib3MFWrapper.PolymorphicFactory<CSlice>(newTheSlice);
+		}
+
+		public bool FindSliceAtZ (Double AZValue, out UInt64 ATotalSliceIndex)
+		{
+			Byte resultFound = 0;
+
+			CheckError(Internal.Lib3MFWrapper.SliceStack_FindSliceAtZ (Handle, AZValue, out ATotalSliceIndex, out resultFound));
+			return (resultFound != 0);
+		}
+
+		public void GetSliceRange (Double AZMin, Double AZMax, out UInt64 AFirstIndex, out UInt64 ACount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.SliceStack_GetSliceRange (Handle, AZMin, AZMax, out AFirstIndex, out ACount));
+		}
+
+		public void ValidatePolygons (out sSliceLayerReport[] ALayerReports)
+		{
+			UInt64 sizeLayerReports = 0;
+			UInt64 neededLayerReports = 0;
+			CheckError(Internal.Lib3MFWrapper.SliceStack_ValidatePolygons (Handle, sizeLayerReports, out neededLayerReports, IntPtr.Zero));
+			sizeLayerReports = neededLayerReports;
+			var arrayLayerReports = new Internal.InternalSliceLayerReport[sizeLayerReports];
+			GCHandle dataLayerReports = GCHandle.Alloc(arrayLayerReports, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.SliceStack_ValidatePolygons (Handle, sizeLayerReports, out neededLayerReports, dataLayerReports.AddrOfPinnedObject()));
+			dataLayerReports.Free();
+			ALayerReports = new sSliceLayerReport[sizeLayerReports];
+			for (int index = 0; index < ALayerReports.Length; index++)
+				ALayerReports[index] = Internal.Lib3MFWrapper.convertInternalToStruct_SliceLayerReport(arrayLayerReports[index]);
+		}
+
 	}
 
 	public class CConsumer : CBase
@@ -8737,6 +9142,14 @@ namespace Lib3MF {
 			return Internal.Lib3MFWrapper.convertInternalToStruct_Box (intresultOutbox);
 		}
 
+		public CInstanceTable GetInstanceTable ()
+		{
+			IntPtr newInstanceTable = IntPtr.Zero;
+
+			CheckError(Internal.Lib3MFWrapper.Model_GetInstanceTable (Handle, out newInstanceTable));
+			return Internal.Lib3MFWrapper.PolymorphicFactory<CInstanceTable>(newInstanceTable);
+		}
+
 		public CResourceIterator GetResources ()
 		{
 			IntPtr newResourceIterator = IntPtr.Zero;
@@ -9139,6 +9552,14 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.Model_RemoveResource (Handle, AResourceHandle));
 		}
 
+		public UInt32 DeduplicateProperties (bool ARemoveUnreferenced)
+		{
+			UInt32 resultRemovedCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Model_DeduplicateProperties (Handle, (Byte)( ARemoveUnreferenced ? 1 : 0 ), out resultRemovedCount));
+			return resultRemovedCount;
+		}
+
 	}
 
 	class Wrapper
@@ -164,6 +164,7 @@ class CImplicitFunction;
 class CFunctionFromImage3D;
 class CBuildItem;
 class CBuildItemIterator;
+class CInstanceTable;
 class CSlice;
 class CSliceStack;
 class CConsumer;
@@ -285,6 +286,7 @@ typedef CImplicitFunction CLib3MFImplicitFunction;
 typedef CFunctionFromImage3D CLib3MFFunctionFromImage3D;
 typedef CBuildItem CLib3MFBuildItem;
 typedef CBuildItemIterator CLib3MFBuildItemIterator;
+typedef CInstanceTable CLib3MFInstanceTable;
 typedef CSlice CLib3MFSlice;
 typedef CSliceStack CLib3MFSliceStack;
 typedef CConsumer CLib3MFConsumer;
@@ -406,6 +408,7 @@ typedef std::shared_ptr<CImplicitFunction> PImplicitFunction;
 typedef std::shared_ptr<CFunctionFromImage3D> PFunctionFromImage3D;
 typedef std::shared_ptr<CBuildItem> PBuildItem;
 typedef std::shared_ptr<CBuildItemIterator> PBuildItemIterator;
+typedef std::shared_ptr<CInstanceTable> PInstanceTable;
 typedef std::shared_ptr<CSlice> PSlice;
 typedef std::shared_ptr<CSliceStack> PSliceStack;
 typedef std::shared_ptr<CConsumer> PConsumer;
@@ -527,6 +530,7 @@ typedef PImplicitFunction PLib3MFImplicitFunction;
 typedef PFunctionFromImage3D PLib3MFFunctionFromImage3D;
 typedef PBuildItem PLib3MFBuildItem;
 typedef PBuildItemIterator PLib3MFBuildItemIterator;
+typedef PInstanceTable PLib3MFInstanceTable;
 typedef PSlice PLib3MFSlice;
 typedef PSliceStack PLib3MFSliceStack;
 typedef PConsumer PLib3MFConsumer;
@@ -940,6 +944,7 @@ private:
 	friend class CFunctionFromImage3D;
 	friend class CBuildItem;
 	friend class CBuildItemIterator;
+	friend class CInstanceTable;
 	friend class CSlice;
 	friend class CSliceStack;
 	friend class CConsumer;
@@ -1033,10 +1038,13 @@ public:
 	inline void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetIncrementalModeActive(const bool bIncrementalModeActive);
+	inline bool GetIncrementalModeActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
 	inline void SetContentEncryptionCallback(const ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
+	inline std::string GetStatistics();
 };
 	
 /*************************************************************************************************************************
@@ -1065,6 +1073,9 @@ public:
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
 	inline void SetContentEncryptionCallback(const ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
+	inline void SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive);
+	inline bool GetInPlaceDecryptionActive();
+	inline std::string GetStatistics();
 };
 	
 /*************************************************************************************************************************
@@ -1816,6 +1827,8 @@ public:
 	inline void RemoveColor(const Lib3MF_uint32 nPropertyID);
 	inline void SetColor(const Lib3MF_uint32 nPropertyID, const sColor & TheColor);
 	inline sColor GetColor(const Lib3MF_uint32 nPropertyID);
+	inline void GetAllColors(std::vector<sColor> & ColorsBuffer);
+	inline void SetAllColors(const CInputVector<sColor> & ColorsBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -1838,6 +1851,8 @@ public:
 	inline sTex2Coord GetTex2Coord(const Lib3MF_uint32 nPropertyID);
 	inline void RemoveTex2Coord(const Lib3MF_uint32 nPropertyID);
 	inline PTexture2D GetTexture2D();
+	inline void GetAllTex2Coords(std::vector<sTex2Coord> & UVCoordinatesBuffer);
+	inline void SetAllTex2Coords(const CInputVector<sTex2Coord> & UVCoordinatesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3175,6 +3190,29 @@ public:
 	inline Lib3MF_uint64 Count();
 };
 	
+/*************************************************************************************************************************
+ Class CInstanceTable 
+**************************************************************************************************************************/
+class CInstanceTable : public CBase {
+public:
+	
+	/**
+	* CInstanceTable::CInstanceTable - Constructor for InstanceTable class.
+	*/
+	CInstanceTable(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline Lib3MF_uint32 GetMeshCount();
+	inline PMeshObject GetMeshObject(const Lib3MF_uint32 nMeshIndex);
+	inline void GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount);
+	inline void GetVertices(std::vector<sPosition> & VerticesBuffer);
+	inline void GetTriangles(std::vector<sTriangle> & TrianglesBuffer);
+	inline Lib3MF_uint32 GetInstanceCount();
+	inline void GetInstances(std::vector<sMeshInstance> & InstancesBuffer);
+};
+	
 /*************************************************************************************************************************
  Class CSlice 
 **************************************************************************************************************************/
@@ -3224,6 +3262,11 @@ public:
 	inline void CollapseSliceReferences();
 	inline void SetOwnPath(const std::string & sPath);
 	inline std::string GetOwnPath();
+	inline Lib3MF_uint64 GetTotalSliceCount();
+	inline PSlice GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex);
+	inline bool FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex);
+	inline void GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount);
+	inline void ValidatePolygons(std::vector<sSliceLayerReport> & LayerReportsBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3400,6 +3443,7 @@ public:
 	inline void SetBuildUUID(const std::string & sUUID);
 	inline PBuildItemIterator GetBuildItems();
 	inline sBox GetOutbox();
+	inline PInstanceTable GetInstanceTable();
 	inline PResourceIterator GetResources();
 	inline PObjectIterator GetObjects();
 	inline PMeshObjectIterator GetMeshObjects();
@@ -3448,6 +3492,7 @@ public:
 	inline PLevelSet AddLevelSet();
 	inline PLevelSetIterator GetLevelSets();
 	inline void RemoveResource(classParam<CResource> pResource);
+	inline Lib3MF_uint32 DeduplicateProperties(const bool bRemoveUnreferenced);
 };
 
 /*************************************************************************************************************************
@@ -3573,6 +3618,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		case 0x9BD7D3C2026B8CE8UL: return new CFunctionFromImage3D(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
 		case 0x68FB2D5FFC4BA12AUL: return new CBuildItem(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 		case 0xA7D21BD364910860UL: return new CBuildItemIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
+		case 0xCDB5C649E208089DUL: return new CInstanceTable(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::InstanceTable"
 		case 0x2198BCF4D8DF9C40UL: return new CSlice(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
 		case 0x6594B031B6096238UL: return new CSliceStack(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::SliceStack"
 		case 0xD9E46D5E6D8118EEUL: return new CConsumer(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Consumer"
@@ -3980,6 +4026,27 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CWriter::SetIncrementalModeActive - Activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+	* @param[in] bIncrementalModeActive - flag whether incremental mode is active or not.
+	*/
+	void CWriter::SetIncrementalModeActive(const bool bIncrementalModeActive)
+	{
+		CheckError(lib3mf_writer_setincrementalmodeactive(m_pHandle, bIncrementalModeActive));
+	}
+	
+	/**
+	* CWriter::GetIncrementalModeActive - Queries whether the incremental mode of the writer is active or not
+	* @return returns flag whether incremental mode is active or not.
+	*/
+	bool CWriter::GetIncrementalModeActive()
+	{
+		bool resultIncrementalModeActive = 0;
+		CheckError(lib3mf_writer_getincrementalmodeactive(m_pHandle, &resultIncrementalModeActive));
+		
+		return resultIncrementalModeActive;
+	}
+	
 	/**
 	* CWriter::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -4030,6 +4097,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_writer_setcontentencryptioncallback(m_pHandle, pTheCallback, pUserData));
 	}
 	
+	/**
+	* CWriter::GetStatistics - Returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	* @return JSON document with the collected statistics
+	*/
+	std::string CWriter::GetStatistics()
+	{
+		Lib3MF_uint32 bytesNeededStatistics = 0;
+		Lib3MF_uint32 bytesWrittenStatistics = 0;
+		CheckError(lib3mf_writer_getstatistics(m_pHandle, 0, &bytesNeededStatistics, nullptr));
+		std::vector<char> bufferStatistics(bytesNeededStatistics);
+		CheckError(lib3mf_writer_getstatistics(m_pHandle, bytesNeededStatistics, &bytesWrittenStatistics, &bufferStatistics[0]));
+		
+		return std::string(&bufferStatistics[0]);
+	}
+	
 	/**
 	 * Method definitions for class CReader
 	 */
@@ -4164,6 +4246,42 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_reader_setcontentencryptioncallback(m_pHandle, pTheCallback, pUserData));
 	}
 	
+	/**
+	* CReader::SetInPlaceDecryptionActive - Activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+	* @param[in] bInPlaceDecryptionActive - flag whether in-place decryption is active or not.
+	*/
+	void CReader::SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive)
+	{
+		CheckError(lib3mf_reader_setinplacedecryptionactive(m_pHandle, bInPlaceDecryptionActive));
+	}
+	
+	/**
+	* CReader::GetInPlaceDecryptionActive - Queries whether in-place decryption of the reader is active or not
+	* @return returns flag whether in-place decryption is active or not.
+	*/
+	bool CReader::GetInPlaceDecryptionActive()
+	{
+		bool resultInPlaceDecryptionActive = 0;
+		CheckError(lib3mf_reader_getinplacedecryptionactive(m_pHandle, &resultInPlaceDecryptionActive));
+		
+		return resultInPlaceDecryptionActive;
+	}
+	
+	/**
+	* CReader::GetStatistics - Returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	* @return JSON document with the collected statistics
+	*/
+	std::string CReader::GetStatistics()
+	{
+		Lib3MF_uint32 bytesNeededStatistics = 0;
+		Lib3MF_uint32 bytesWrittenStatistics = 0;
+		CheckError(lib3mf_reader_getstatistics(m_pHandle, 0, &bytesNeededStatistics, nullptr));
+		std::vector<char> bufferStatistics(bytesNeededStatistics);
+		CheckError(lib3mf_reader_getstatistics(m_pHandle, bytesNeededStatistics, &bytesWrittenStatistics, &bufferStatistics[0]));
+		
+		return std::string(&bufferStatistics[0]);
+	}
+	
 	/**
 	 * Method definitions for class CPackagePart
 	 */
@@ -6837,6 +6955,29 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultTheColor;
 	}
 	
+	/**
+	* CColorGroup::GetAllColors - Returns all colors of this group in the order of GetAllPropertyIDs.
+	* @param[out] ColorsBuffer - contains the colors of the group.
+	*/
+	void CColorGroup::GetAllColors(std::vector<sColor> & ColorsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededColors = 0;
+		Lib3MF_uint64 elementsWrittenColors = 0;
+		CheckError(lib3mf_colorgroup_getallcolors(m_pHandle, 0, &elementsNeededColors, nullptr));
+		ColorsBuffer.resize((size_t) elementsNeededColors);
+		CheckError(lib3mf_colorgroup_getallcolors(m_pHandle, elementsNeededColors, &elementsWrittenColors, ColorsBuffer.data()));
+	}
+	
+	/**
+	* CColorGroup::SetAllColors - Sets all colors of this group in the order of GetAllPropertyIDs.
+	* @param[in] ColorsBuffer - contains the new colors. Must have GetCount elements.
+	*/
+	void CColorGroup::SetAllColors(const CInputVector<sColor> & ColorsBuffer)
+	{
+		Lib3MF_uint64 nColorsSize = ColorsBuffer.size();
+		CheckError(lib3mf_colorgroup_setallcolors(m_pHandle, nColorsSize, ColorsBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CTexture2DGroup
 	 */
@@ -6916,6 +7057,29 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::shared_ptr<CTexture2D>(dynamic_cast<CTexture2D*>(m_pWrapper->polymorphicFactory(hTexture2DInstance)));
 	}
 	
+	/**
+	* CTexture2DGroup::GetAllTex2Coords - Returns all tex2coords of this group in the order of GetAllPropertyIDs.
+	* @param[out] UVCoordinatesBuffer - contains the u/v-coordinates of the group.
+	*/
+	void CTexture2DGroup::GetAllTex2Coords(std::vector<sTex2Coord> & UVCoordinatesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededUVCoordinates = 0;
+		Lib3MF_uint64 elementsWrittenUVCoordinates = 0;
+		CheckError(lib3mf_texture2dgroup_getalltex2coords(m_pHandle, 0, &elementsNeededUVCoordinates, nullptr));
+		UVCoordinatesBuffer.resize((size_t) elementsNeededUVCoordinates);
+		CheckError(lib3mf_texture2dgroup_getalltex2coords(m_pHandle, elementsNeededUVCoordinates, &elementsWrittenUVCoordinates, UVCoordinatesBuffer.data()));
+	}
+	
+	/**
+	* CTexture2DGroup::SetAllTex2Coords - Sets all tex2coords of this group in the order of GetAllPropertyIDs.
+	* @param[in] UVCoordinatesBuffer - contains the new u/v-coordinates. Must have GetCount elements.
+	*/
+	void CTexture2DGroup::SetAllTex2Coords(const CInputVector<sTex2Coord> & UVCoordinatesBuffer)
+	{
+		Lib3MF_uint64 nUVCoordinatesSize = UVCoordinatesBuffer.size();
+		CheckError(lib3mf_texture2dgroup_setalltex2coords(m_pHandle, nUVCoordinatesSize, UVCoordinatesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CCompositeMaterials
 	 */
@@ -10500,6 +10664,102 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultCount;
 	}
 	
+	/**
+	 * Method definitions for class CInstanceTable
+	 */
+	
+	/**
+	* CInstanceTable::GetMeshCount - Returns the number of unique mesh objects referenced by the build items.
+	* @return the number of unique mesh objects
+	*/
+	Lib3MF_uint32 CInstanceTable::GetMeshCount()
+	{
+		Lib3MF_uint32 resultCount = 0;
+		CheckError(lib3mf_instancetable_getmeshcount(m_pHandle, &resultCount));
+		
+		return resultCount;
+	}
+	
+	/**
+	* CInstanceTable::GetMeshObject - Returns a unique mesh object of the table.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @return the mesh object
+	*/
+	PMeshObject CInstanceTable::GetMeshObject(const Lib3MF_uint32 nMeshIndex)
+	{
+		Lib3MFHandle hMeshObject = (Lib3MFHandle)nullptr;
+		CheckError(lib3mf_instancetable_getmeshobject(m_pHandle, nMeshIndex, &hMeshObject));
+		
+		if (!hMeshObject) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CMeshObject>(dynamic_cast<CMeshObject*>(m_pWrapper->polymorphicFactory(hMeshObject)));
+	}
+	
+	/**
+	* CInstanceTable::GetMeshRange - Returns the location of a unique mesh object within the packed vertex and triangle buffers.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @param[out] nVertexOffset - index of the first vertex of the mesh object in the vertex buffer
+	* @param[out] nVertexCount - number of vertices of the mesh object
+	* @param[out] nTriangleOffset - index of the first triangle of the mesh object in the triangle buffer
+	* @param[out] nTriangleCount - number of triangles of the mesh object
+	*/
+	void CInstanceTable::GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount)
+	{
+		CheckError(lib3mf_instancetable_getmeshrange(m_pHandle, nMeshIndex, &nVertexOffset, &nVertexCount, &nTriangleOffset, &nTriangleCount));
+	}
+	
+	/**
+	* CInstanceTable::GetVertices - Returns the vertices of all unique mesh objects, packed in mesh order.
+	* @param[out] VerticesBuffer - the packed vertex positions
+	*/
+	void CInstanceTable::GetVertices(std::vector<sPosition> & VerticesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededVertices = 0;
+		Lib3MF_uint64 elementsWrittenVertices = 0;
+		CheckError(lib3mf_instancetable_getvertices(m_pHandle, 0, &elementsNeededVertices, nullptr));
+		VerticesBuffer.resize((size_t) elementsNeededVertices);
+		CheckError(lib3mf_instancetable_getvertices(m_pHandle, elementsNeededVertices, &elementsWrittenVertices, VerticesBuffer.data()));
+	}
+	
+	/**
+	* CInstanceTable::GetTriangles - Returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+	* @param[out] TrianglesBuffer - the packed triangles
+	*/
+	void CInstanceTable::GetTriangles(std::vector<sTriangle> & TrianglesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededTriangles = 0;
+		Lib3MF_uint64 elementsWrittenTriangles = 0;
+		CheckError(lib3mf_instancetable_gettriangles(m_pHandle, 0, &elementsNeededTriangles, nullptr));
+		TrianglesBuffer.resize((size_t) elementsNeededTriangles);
+		CheckError(lib3mf_instancetable_gettriangles(m_pHandle, elementsNeededTriangles, &elementsWrittenTriangles, TrianglesBuffer.data()));
+	}
+	
+	/**
+	* CInstanceTable::GetInstanceCount - Returns the number of mesh instances placed by the build items.
+	* @return the number of mesh instances
+	*/
+	Lib3MF_uint32 CInstanceTable::GetInstanceCount()
+	{
+		Lib3MF_uint32 resultCount = 0;
+		CheckError(lib3mf_instancetable_getinstancecount(m_pHandle, &resultCount));
+		
+		return resultCount;
+	}
+	
+	/**
+	* CInstanceTable::GetInstances - Returns all mesh instances placed by the build items, in build item order.
+	* @param[out] InstancesBuffer - the mesh instances with their accumulated transforms
+	*/
+	void CInstanceTable::GetInstances(std::vector<sMeshInstance> & InstancesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededInstances = 0;
+		Lib3MF_uint64 elementsWrittenInstances = 0;
+		CheckError(lib3mf_instancetable_getinstances(m_pHandle, 0, &elementsNeededInstances, nullptr));
+		InstancesBuffer.resize((size_t) elementsNeededInstances);
+		CheckError(lib3mf_instancetable_getinstances(m_pHandle, elementsNeededInstances, &elementsWrittenInstances, InstancesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CSlice
 	 */
@@ -10745,6 +11005,73 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::string(&bufferPath[0]);
 	}
 	
+	/**
+	* CSliceStack::GetTotalSliceCount - Returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+	* @return the number of slices in the slice view
+	*/
+	Lib3MF_uint64 CSliceStack::GetTotalSliceCount()
+	{
+		Lib3MF_uint64 resultCount = 0;
+		CheckError(lib3mf_slicestack_gettotalslicecount(m_pHandle, &resultCount));
+		
+		return resultCount;
+	}
+	
+	/**
+	* CSliceStack::GetTotalSlice - Queries a slice from the slice view of this slice stack without collapsing its slice refs.
+	* @param[in] nTotalSliceIndex - the index of the slice in the slice view
+	* @return the Slice instance
+	*/
+	PSlice CSliceStack::GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex)
+	{
+		Lib3MFHandle hTheSlice = (Lib3MFHandle)nullptr;
+		CheckError(lib3mf_slicestack_gettotalslice(m_pHandle, nTotalSliceIndex, &hTheSlice));
+		
+		if (!hTheSlice) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CSlice>(dynamic_cast<CSlice*>(m_pWrapper->polymorphicFactory(hTheSlice)));
+	}
+	
+	/**
+	* CSliceStack::FindSliceAtZ - Finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+	* @param[in] dZValue - the Z-coordinate to look up
+	* @param[out] nTotalSliceIndex - the index of the slice in the slice view, if one was found
+	* @return true, if a slice contains the Z-coordinate
+	*/
+	bool CSliceStack::FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex)
+	{
+		bool resultFound = 0;
+		CheckError(lib3mf_slicestack_findsliceatz(m_pHandle, dZValue, &nTotalSliceIndex, &resultFound));
+		
+		return resultFound;
+	}
+	
+	/**
+	* CSliceStack::GetSliceRange - Returns the range of slices of the slice view that intersect a Z-interval.
+	* @param[in] dZMin - the lower Z-coordinate of the interval
+	* @param[in] dZMax - the upper Z-coordinate of the interval
+	* @param[out] nFirstIndex - the index of the first slice in the slice view that intersects the interval
+	* @param[out] nCount - the number of slices that intersect the interval
+	*/
+	void CSliceStack::GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount)
+	{
+		CheckError(lib3mf_slicestack_getslicerange(m_pHandle, dZMin, dZMax, &nFirstIndex, &nCount));
+	}
+	
+	/**
+	* CSliceStack::ValidatePolygons - Validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+	* @param[out] LayerReportsBuffer - the reports of the layers with issues, in ascending layer order
+	*/
+	void CSliceStack::ValidatePolygons(std::vector<sSliceLayerReport> & LayerReportsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededLayerReports = 0;
+		Lib3MF_uint64 elementsWrittenLayerReports = 0;
+		CheckError(lib3mf_slicestack_validatepolygons(m_pHandle, 0, &elementsNeededLayerReports, nullptr));
+		LayerReportsBuffer.resize((size_t) elementsNeededLayerReports);
+		CheckError(lib3mf_slicestack_validatepolygons(m_pHandle, elementsNeededLayerReports, &elementsWrittenLayerReports, LayerReportsBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CConsumer
 	 */
@@ -11682,6 +12009,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultOutbox;
 	}
 	
+	/**
+	* CModel::GetInstanceTable - Flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+	* @return the instance table of the current build
+	*/
+	PInstanceTable CModel::GetInstanceTable()
+	{
+		Lib3MFHandle hInstanceTable = (Lib3MFHandle)nullptr;
+		CheckError(lib3mf_model_getinstancetable(m_pHandle, &hInstanceTable));
+		
+		if (!hInstanceTable) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CInstanceTable>(dynamic_cast<CInstanceTable*>(m_pWrapper->polymorphicFactory(hInstanceTable)));
+	}
+	
 	/**
 	* CModel::GetResources - creates a resource iterator instance with all resources.
 	* @return returns the iterator instance.
@@ -12373,6 +12715,19 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		Lib3MFHandle hResource = pResource.GetHandle();
 		CheckError(lib3mf_model_removeresource(m_pHandle, hResource));
 	}
+	
+	/**
+	* CModel::DeduplicateProperties - Merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+	* @param[in] bRemoveUnreferenced - If true, entries that are not referenced by any triangle or multiproperty are removed as well. Groups that are not referenced at all are left untouched.
+	* @return Number of removed entries.
+	*/
+	Lib3MF_uint32 CModel::DeduplicateProperties(const bool bRemoveUnreferenced)
+	{
+		Lib3MF_uint32 resultRemovedCount = 0;
+		CheckError(lib3mf_model_deduplicateproperties(m_pHandle, bRemoveUnreferenced, &resultRemovedCount));
+		
+		return resultRemovedCount;
+	}
 
 } // namespace Lib3MF
 
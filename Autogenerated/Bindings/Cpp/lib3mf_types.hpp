@@ -316,6 +316,7 @@ typedef Lib3MFHandle Lib3MF_ImplicitFunction;
 typedef Lib3MFHandle Lib3MF_FunctionFromImage3D;
 typedef Lib3MFHandle Lib3MF_BuildItem;
 typedef Lib3MFHandle Lib3MF_BuildItemIterator;
+typedef Lib3MFHandle Lib3MF_InstanceTable;
 typedef Lib3MFHandle Lib3MF_Slice;
 typedef Lib3MFHandle Lib3MF_SliceStack;
 typedef Lib3MFHandle Lib3MF_Consumer;
@@ -620,6 +621,21 @@ namespace Lib3MF {
       Lib3MF_double m_Radius;
   } sBall;
   
+  typedef struct sSliceLayerReport {
+      Lib3MF_uint32 m_LayerIndex;
+      Lib3MF_uint32 m_OpenPolygons;
+      Lib3MF_uint32 m_DegeneratePolygons;
+      Lib3MF_uint32 m_SelfIntersections;
+      Lib3MF_uint32 m_OrientationErrors;
+      Lib3MF_uint32 m_MaxNestingDepth;
+  } sSliceLayerReport;
+  
+  typedef struct sMeshInstance {
+      Lib3MF_uint32 m_MeshIndex;
+      Lib3MF_uint32 m_BuildItemIndex;
+      Lib3MF_single m_Transform[4][3];
+  } sMeshInstance;
+  
   typedef struct sVector {
       Lib3MF_double m_Coordinates[3];
   } sVector;
@@ -746,6 +762,8 @@ typedef Lib3MF::sBox sLib3MFBox;
 typedef Lib3MF::sColor sLib3MFColor;
 typedef Lib3MF::sBeam sLib3MFBeam;
 typedef Lib3MF::sBall sLib3MFBall;
+typedef Lib3MF::sSliceLayerReport sLib3MFSliceLayerReport;
+typedef Lib3MF::sMeshInstance sLib3MFMeshInstance;
 typedef Lib3MF::sVector sLib3MFVector;
 typedef Lib3MF::sMatrix4x4 sLib3MFMatrix4x4;
 typedef Lib3MF::ProgressCallback Lib3MFProgressCallback;
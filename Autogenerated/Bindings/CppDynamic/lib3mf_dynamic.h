@@ -143,6 +143,24 @@ typedef Lib3MFResult (*PLib3MFWriter_SetStrictModeActivePtr) (Lib3MF_Writer pWri
 */
 typedef Lib3MFResult (*PLib3MFWriter_GetStrictModeActivePtr) (Lib3MF_Writer pWriter, bool * pStrictModeActive);
 
+/**
+* Activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] bIncrementalModeActive - flag whether incremental mode is active or not.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetIncrementalModeActivePtr) (Lib3MF_Writer pWriter, bool bIncrementalModeActive);
+
+/**
+* Queries whether the incremental mode of the writer is active or not
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pIncrementalModeActive - returns flag whether incremental mode is active or not.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetIncrementalModeActivePtr) (Lib3MF_Writer pWriter, bool * pIncrementalModeActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -186,6 +204,17 @@ typedef Lib3MFResult (*PLib3MFWriter_AddKeyWrappingCallbackPtr) (Lib3MF_Writer p
 */
 typedef Lib3MFResult (*PLib3MFWriter_SetContentEncryptionCallbackPtr) (Lib3MF_Writer pWriter, Lib3MF::ContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nStatisticsBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStatisticsNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStatisticsBuffer -  buffer of JSON document with the collected statistics, may be NULL
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetStatisticsPtr) (Lib3MF_Writer pWriter, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer);
+
 /*************************************************************************************************************************
  Class definition for Reader
 **************************************************************************************************************************/
@@ -310,6 +339,35 @@ typedef Lib3MFResult (*PLib3MFReader_AddKeyWrappingCallbackPtr) (Lib3MF_Reader p
 */
 typedef Lib3MFResult (*PLib3MFReader_SetContentEncryptionCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::ContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bInPlaceDecryptionActive - flag whether in-place decryption is active or not.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetInPlaceDecryptionActivePtr) (Lib3MF_Reader pReader, bool bInPlaceDecryptionActive);
+
+/**
+* Queries whether in-place decryption of the reader is active or not
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pInPlaceDecryptionActive - returns flag whether in-place decryption is active or not.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetInPlaceDecryptionActivePtr) (Lib3MF_Reader pReader, bool * pInPlaceDecryptionActive);
+
+/**
+* Returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nStatisticsBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStatisticsNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStatisticsBuffer -  buffer of JSON document with the collected statistics, may be NULL
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetStatisticsPtr) (Lib3MF_Reader pReader, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer);
+
 /*************************************************************************************************************************
  Class definition for PackagePart
 **************************************************************************************************************************/
@@ -2427,6 +2485,27 @@ typedef Lib3MFResult (*PLib3MFColorGroup_SetColorPtr) (Lib3MF_ColorGroup pColorG
 */
 typedef Lib3MFResult (*PLib3MFColorGroup_GetColorPtr) (Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID, Lib3MF::sColor * pTheColor);
 
+/**
+* Returns all colors of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pColorGroup - ColorGroup instance.
+* @param[in] nColorsBufferSize - Number of elements in buffer
+* @param[out] pColorsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pColorsBuffer - Color  buffer of contains the colors of the group.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFColorGroup_GetAllColorsPtr) (Lib3MF_ColorGroup pColorGroup, const Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, Lib3MF::sColor * pColorsBuffer);
+
+/**
+* Sets all colors of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pColorGroup - ColorGroup instance.
+* @param[in] nColorsBufferSize - Number of elements in buffer
+* @param[in] pColorsBuffer - Color buffer of contains the new colors. Must have GetCount elements.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFColorGroup_SetAllColorsPtr) (Lib3MF_ColorGroup pColorGroup, Lib3MF_uint64 nColorsBufferSize, const Lib3MF::sColor * pColorsBuffer);
+
 /*************************************************************************************************************************
  Class definition for Texture2DGroup
 **************************************************************************************************************************/
@@ -2489,6 +2568,27 @@ typedef Lib3MFResult (*PLib3MFTexture2DGroup_RemoveTex2CoordPtr) (Lib3MF_Texture
 */
 typedef Lib3MFResult (*PLib3MFTexture2DGroup_GetTexture2DPtr) (Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_Texture2D * pTexture2DInstance);
 
+/**
+* Returns all tex2coords of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pTexture2DGroup - Texture2DGroup instance.
+* @param[in] nUVCoordinatesBufferSize - Number of elements in buffer
+* @param[out] pUVCoordinatesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pUVCoordinatesBuffer - Tex2Coord  buffer of contains the u/v-coordinates of the group.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFTexture2DGroup_GetAllTex2CoordsPtr) (Lib3MF_Texture2DGroup pTexture2DGroup, const Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, Lib3MF::sTex2Coord * pUVCoordinatesBuffer);
+
+/**
+* Sets all tex2coords of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pTexture2DGroup - Texture2DGroup instance.
+* @param[in] nUVCoordinatesBufferSize - Number of elements in buffer
+* @param[in] pUVCoordinatesBuffer - Tex2Coord buffer of contains the new u/v-coordinates. Must have GetCount elements.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFTexture2DGroup_SetAllTex2CoordsPtr) (Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint64 nUVCoordinatesBufferSize, const Lib3MF::sTex2Coord * pUVCoordinatesBuffer);
+
 /*************************************************************************************************************************
  Class definition for CompositeMaterials
 **************************************************************************************************************************/
@@ -5109,6 +5209,84 @@ typedef Lib3MFResult (*PLib3MFBuildItemIterator_ClonePtr) (Lib3MF_BuildItemItera
 */
 typedef Lib3MFResult (*PLib3MFBuildItemIterator_CountPtr) (Lib3MF_BuildItemIterator pBuildItemIterator, Lib3MF_uint64 * pCount);
 
+/*************************************************************************************************************************
+ Class definition for InstanceTable
+**************************************************************************************************************************/
+
+/**
+* Returns the number of unique mesh objects referenced by the build items.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[out] pCount - the number of unique mesh objects
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetMeshCountPtr) (Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount);
+
+/**
+* Returns a unique mesh object of the table.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nMeshIndex - index of the mesh object (0-based)
+* @param[out] pMeshObject - the mesh object
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetMeshObjectPtr) (Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_MeshObject * pMeshObject);
+
+/**
+* Returns the location of a unique mesh object within the packed vertex and triangle buffers.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nMeshIndex - index of the mesh object (0-based)
+* @param[out] pVertexOffset - index of the first vertex of the mesh object in the vertex buffer
+* @param[out] pVertexCount - number of vertices of the mesh object
+* @param[out] pTriangleOffset - index of the first triangle of the mesh object in the triangle buffer
+* @param[out] pTriangleCount - number of triangles of the mesh object
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetMeshRangePtr) (Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 * pVertexOffset, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pTriangleOffset, Lib3MF_uint32 * pTriangleCount);
+
+/**
+* Returns the vertices of all unique mesh objects, packed in mesh order.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nVerticesBufferSize - Number of elements in buffer
+* @param[out] pVerticesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pVerticesBuffer - Position  buffer of the packed vertex positions
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetVerticesPtr) (Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer);
+
+/**
+* Returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nTrianglesBufferSize - Number of elements in buffer
+* @param[out] pTrianglesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTrianglesBuffer - Triangle  buffer of the packed triangles
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetTrianglesPtr) (Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, Lib3MF::sTriangle * pTrianglesBuffer);
+
+/**
+* Returns the number of mesh instances placed by the build items.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[out] pCount - the number of mesh instances
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetInstanceCountPtr) (Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount);
+
+/**
+* Returns all mesh instances placed by the build items, in build item order.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nInstancesBufferSize - Number of elements in buffer
+* @param[out] pInstancesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pInstancesBuffer - MeshInstance  buffer of the mesh instances with their accumulated transforms
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFInstanceTable_GetInstancesPtr) (Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, Lib3MF::sMeshInstance * pInstancesBuffer);
+
 /*************************************************************************************************************************
  Class definition for Slice
 **************************************************************************************************************************/
@@ -5303,6 +5481,59 @@ typedef Lib3MFResult (*PLib3MFSliceStack_SetOwnPathPtr) (Lib3MF_SliceStack pSlic
 */
 typedef Lib3MFResult (*PLib3MFSliceStack_GetOwnPathPtr) (Lib3MF_SliceStack pSliceStack, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer);
 
+/**
+* Returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[out] pCount - the number of slices in the slice view
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFSliceStack_GetTotalSliceCountPtr) (Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 * pCount);
+
+/**
+* Queries a slice from the slice view of this slice stack without collapsing its slice refs.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] nTotalSliceIndex - the index of the slice in the slice view
+* @param[out] pTheSlice - the Slice instance
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFSliceStack_GetTotalSlicePtr) (Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 nTotalSliceIndex, Lib3MF_Slice * pTheSlice);
+
+/**
+* Finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] dZValue - the Z-coordinate to look up
+* @param[out] pTotalSliceIndex - the index of the slice in the slice view, if one was found
+* @param[out] pFound - true, if a slice contains the Z-coordinate
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFSliceStack_FindSliceAtZPtr) (Lib3MF_SliceStack pSliceStack, Lib3MF_double dZValue, Lib3MF_uint64 * pTotalSliceIndex, bool * pFound);
+
+/**
+* Returns the range of slices of the slice view that intersect a Z-interval.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] dZMin - the lower Z-coordinate of the interval
+* @param[in] dZMax - the upper Z-coordinate of the interval
+* @param[out] pFirstIndex - the index of the first slice in the slice view that intersects the interval
+* @param[out] pCount - the number of slices that intersect the interval
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFSliceStack_GetSliceRangePtr) (Lib3MF_SliceStack pSliceStack, Lib3MF_double dZMin, Lib3MF_double dZMax, Lib3MF_uint64 * pFirstIndex, Lib3MF_uint64 * pCount);
+
+/**
+* Validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] nLayerReportsBufferSize - Number of elements in buffer
+* @param[out] pLayerReportsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pLayerReportsBuffer - SliceLayerReport  buffer of the reports of the layers with issues, in ascending layer order
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFSliceStack_ValidatePolygonsPtr) (Lib3MF_SliceStack pSliceStack, const Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, sLib3MFSliceLayerReport * pLayerReportsBuffer);
+
 /*************************************************************************************************************************
  Class definition for Consumer
 **************************************************************************************************************************/
@@ -5971,6 +6202,15 @@ typedef Lib3MFResult (*PLib3MFModel_GetBuildItemsPtr) (Lib3MF_Model pModel, Lib3
 */
 typedef Lib3MFResult (*PLib3MFModel_GetOutboxPtr) (Lib3MF_Model pModel, Lib3MF::sBox * pOutbox);
 
+/**
+* Flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+*
+* @param[in] pModel - Model instance.
+* @param[out] pInstanceTable - the instance table of the current build
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFModel_GetInstanceTablePtr) (Lib3MF_Model pModel, Lib3MF_InstanceTable * pInstanceTable);
+
 /**
 * creates a resource iterator instance with all resources.
 *
@@ -6419,6 +6659,16 @@ typedef Lib3MFResult (*PLib3MFModel_GetLevelSetsPtr) (Lib3MF_Model pModel, Lib3M
 */
 typedef Lib3MFResult (*PLib3MFModel_RemoveResourcePtr) (Lib3MF_Model pModel, Lib3MF_Resource pResource);
 
+/**
+* Merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+*
+* @param[in] pModel - Model instance.
+* @param[in] bRemoveUnreferenced - If true, entries that are not referenced by any triangle or multiproperty are removed as well. Groups that are not referenced at all are left untouched.
+* @param[out] pRemovedCount - Number of removed entries.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFModel_DeduplicatePropertiesPtr) (Lib3MF_Model pModel, bool bRemoveUnreferenced, Lib3MF_uint32 * pRemovedCount);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -6633,10 +6883,13 @@ typedef struct {
 	PLib3MFWriter_SetDecimalPrecisionPtr m_Writer_SetDecimalPrecision;
 	PLib3MFWriter_SetStrictModeActivePtr m_Writer_SetStrictModeActive;
 	PLib3MFWriter_GetStrictModeActivePtr m_Writer_GetStrictModeActive;
+	PLib3MFWriter_SetIncrementalModeActivePtr m_Writer_SetIncrementalModeActive;
+	PLib3MFWriter_GetIncrementalModeActivePtr m_Writer_GetIncrementalModeActive;
 	PLib3MFWriter_GetWarningPtr m_Writer_GetWarning;
 	PLib3MFWriter_GetWarningCountPtr m_Writer_GetWarningCount;
 	PLib3MFWriter_AddKeyWrappingCallbackPtr m_Writer_AddKeyWrappingCallback;
 	PLib3MFWriter_SetContentEncryptionCallbackPtr m_Writer_SetContentEncryptionCallback;
+	PLib3MFWriter_GetStatisticsPtr m_Writer_GetStatistics;
 	PLib3MFReader_ReadFromFilePtr m_Reader_ReadFromFile;
 	PLib3MFReader_ReadFromBufferPtr m_Reader_ReadFromBuffer;
 	PLib3MFReader_ReadFromCallbackPtr m_Reader_ReadFromCallback;
@@ -6649,6 +6902,9 @@ typedef struct {
 	PLib3MFReader_GetWarningCountPtr m_Reader_GetWarningCount;
 	PLib3MFReader_AddKeyWrappingCallbackPtr m_Reader_AddKeyWrappingCallback;
 	PLib3MFReader_SetContentEncryptionCallbackPtr m_Reader_SetContentEncryptionCallback;
+	PLib3MFReader_SetInPlaceDecryptionActivePtr m_Reader_SetInPlaceDecryptionActive;
+	PLib3MFReader_GetInPlaceDecryptionActivePtr m_Reader_GetInPlaceDecryptionActive;
+	PLib3MFReader_GetStatisticsPtr m_Reader_GetStatistics;
 	PLib3MFPackagePart_GetPathPtr m_PackagePart_GetPath;
 	PLib3MFPackagePart_SetPathPtr m_PackagePart_SetPath;
 	PLib3MFResource_GetResourceIDPtr m_Resource_GetResourceID;
@@ -6856,12 +7112,16 @@ typedef struct {
 	PLib3MFColorGroup_RemoveColorPtr m_ColorGroup_RemoveColor;
 	PLib3MFColorGroup_SetColorPtr m_ColorGroup_SetColor;
 	PLib3MFColorGroup_GetColorPtr m_ColorGroup_GetColor;
+	PLib3MFColorGroup_GetAllColorsPtr m_ColorGroup_GetAllColors;
+	PLib3MFColorGroup_SetAllColorsPtr m_ColorGroup_SetAllColors;
 	PLib3MFTexture2DGroup_GetCountPtr m_Texture2DGroup_GetCount;
 	PLib3MFTexture2DGroup_GetAllPropertyIDsPtr m_Texture2DGroup_GetAllPropertyIDs;
 	PLib3MFTexture2DGroup_AddTex2CoordPtr m_Texture2DGroup_AddTex2Coord;
 	PLib3MFTexture2DGroup_GetTex2CoordPtr m_Texture2DGroup_GetTex2Coord;
 	PLib3MFTexture2DGroup_RemoveTex2CoordPtr m_Texture2DGroup_RemoveTex2Coord;
 	PLib3MFTexture2DGroup_GetTexture2DPtr m_Texture2DGroup_GetTexture2D;
+	PLib3MFTexture2DGroup_GetAllTex2CoordsPtr m_Texture2DGroup_GetAllTex2Coords;
+	PLib3MFTexture2DGroup_SetAllTex2CoordsPtr m_Texture2DGroup_SetAllTex2Coords;
 	PLib3MFCompositeMaterials_GetCountPtr m_CompositeMaterials_GetCount;
 	PLib3MFCompositeMaterials_GetAllPropertyIDsPtr m_CompositeMaterials_GetAllPropertyIDs;
 	PLib3MFCompositeMaterials_GetBaseMaterialGroupPtr m_CompositeMaterials_GetBaseMaterialGroup;
@@ -7093,6 +7353,13 @@ typedef struct {
 	PLib3MFBuildItemIterator_GetCurrentPtr m_BuildItemIterator_GetCurrent;
 	PLib3MFBuildItemIterator_ClonePtr m_BuildItemIterator_Clone;
 	PLib3MFBuildItemIterator_CountPtr m_BuildItemIterator_Count;
+	PLib3MFInstanceTable_GetMeshCountPtr m_InstanceTable_GetMeshCount;
+	PLib3MFInstanceTable_GetMeshObjectPtr m_InstanceTable_GetMeshObject;
+	PLib3MFInstanceTable_GetMeshRangePtr m_InstanceTable_GetMeshRange;
+	PLib3MFInstanceTable_GetVerticesPtr m_InstanceTable_GetVertices;
+	PLib3MFInstanceTable_GetTrianglesPtr m_InstanceTable_GetTriangles;
+	PLib3MFInstanceTable_GetInstanceCountPtr m_InstanceTable_GetInstanceCount;
+	PLib3MFInstanceTable_GetInstancesPtr m_InstanceTable_GetInstances;
 	PLib3MFSlice_SetVerticesPtr m_Slice_SetVertices;
 	PLib3MFSlice_GetVerticesPtr m_Slice_GetVertices;
 	PLib3MFSlice_GetVertexCountPtr m_Slice_GetVertexCount;
@@ -7112,6 +7379,11 @@ typedef struct {
 	PLib3MFSliceStack_CollapseSliceReferencesPtr m_SliceStack_CollapseSliceReferences;
 	PLib3MFSliceStack_SetOwnPathPtr m_SliceStack_SetOwnPath;
 	PLib3MFSliceStack_GetOwnPathPtr m_SliceStack_GetOwnPath;
+	PLib3MFSliceStack_GetTotalSliceCountPtr m_SliceStack_GetTotalSliceCount;
+	PLib3MFSliceStack_GetTotalSlicePtr m_SliceStack_GetTotalSlice;
+	PLib3MFSliceStack_FindSliceAtZPtr m_SliceStack_FindSliceAtZ;
+	PLib3MFSliceStack_GetSliceRangePtr m_SliceStack_GetSliceRange;
+	PLib3MFSliceStack_ValidatePolygonsPtr m_SliceStack_ValidatePolygons;
 	PLib3MFConsumer_GetConsumerIDPtr m_Consumer_GetConsumerID;
 	PLib3MFConsumer_GetKeyIDPtr m_Consumer_GetKeyID;
 	PLib3MFConsumer_GetKeyValuePtr m_Consumer_GetKeyValue;
@@ -7176,6 +7448,7 @@ typedef struct {
 	PLib3MFModel_SetBuildUUIDPtr m_Model_SetBuildUUID;
 	PLib3MFModel_GetBuildItemsPtr m_Model_GetBuildItems;
 	PLib3MFModel_GetOutboxPtr m_Model_GetOutbox;
+	PLib3MFModel_GetInstanceTablePtr m_Model_GetInstanceTable;
 	PLib3MFModel_GetResourcesPtr m_Model_GetResources;
 	PLib3MFModel_GetObjectsPtr m_Model_GetObjects;
 	PLib3MFModel_GetMeshObjectsPtr m_Model_GetMeshObjects;
@@ -7224,6 +7497,7 @@ typedef struct {
 	PLib3MFModel_AddLevelSetPtr m_Model_AddLevelSet;
 	PLib3MFModel_GetLevelSetsPtr m_Model_GetLevelSets;
 	PLib3MFModel_RemoveResourcePtr m_Model_RemoveResource;
+	PLib3MFModel_DeduplicatePropertiesPtr m_Model_DeduplicateProperties;
 	PLib3MFGetLibraryVersionPtr m_GetLibraryVersion;
 	PLib3MFGetPrereleaseInformationPtr m_GetPrereleaseInformation;
 	PLib3MFGetBuildInformationPtr m_GetBuildInformation;
@@ -164,6 +164,7 @@ class CImplicitFunction;
 class CFunctionFromImage3D;
 class CBuildItem;
 class CBuildItemIterator;
+class CInstanceTable;
 class CSlice;
 class CSliceStack;
 class CConsumer;
@@ -285,6 +286,7 @@ typedef CImplicitFunction CLib3MFImplicitFunction;
 typedef CFunctionFromImage3D CLib3MFFunctionFromImage3D;
 typedef CBuildItem CLib3MFBuildItem;
 typedef CBuildItemIterator CLib3MFBuildItemIterator;
+typedef CInstanceTable CLib3MFInstanceTable;
 typedef CSlice CLib3MFSlice;
 typedef CSliceStack CLib3MFSliceStack;
 typedef CConsumer CLib3MFConsumer;
@@ -406,6 +408,7 @@ typedef std::shared_ptr<CImplicitFunction> PImplicitFunction;
 typedef std::shared_ptr<CFunctionFromImage3D> PFunctionFromImage3D;
 typedef std::shared_ptr<CBuildItem> PBuildItem;
 typedef std::shared_ptr<CBuildItemIterator> PBuildItemIterator;
+typedef std::shared_ptr<CInstanceTable> PInstanceTable;
 typedef std::shared_ptr<CSlice> PSlice;
 typedef std::shared_ptr<CSliceStack> PSliceStack;
 typedef std::shared_ptr<CConsumer> PConsumer;
@@ -527,6 +530,7 @@ typedef PImplicitFunction PLib3MFImplicitFunction;
 typedef PFunctionFromImage3D PLib3MFFunctionFromImage3D;
 typedef PBuildItem PLib3MFBuildItem;
 typedef PBuildItemIterator PLib3MFBuildItemIterator;
+typedef PInstanceTable PLib3MFInstanceTable;
 typedef PSlice PLib3MFSlice;
 typedef PSliceStack PLib3MFSliceStack;
 typedef PConsumer PLib3MFConsumer;
@@ -964,6 +968,7 @@ private:
 	friend class CFunctionFromImage3D;
 	friend class CBuildItem;
 	friend class CBuildItemIterator;
+	friend class CInstanceTable;
 	friend class CSlice;
 	friend class CSliceStack;
 	friend class CConsumer;
@@ -1057,10 +1062,13 @@ public:
 	inline void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetIncrementalModeActive(const bool bIncrementalModeActive);
+	inline bool GetIncrementalModeActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
 	inline void SetContentEncryptionCallback(const ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
+	inline std::string GetStatistics();
 };
 	
 /*************************************************************************************************************************
@@ -1089,6 +1097,9 @@ public:
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
 	inline void SetContentEncryptionCallback(const ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
+	inline void SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive);
+	inline bool GetInPlaceDecryptionActive();
+	inline std::string GetStatistics();
 };
 	
 /*************************************************************************************************************************
@@ -1840,6 +1851,8 @@ public:
 	inline void RemoveColor(const Lib3MF_uint32 nPropertyID);
 	inline void SetColor(const Lib3MF_uint32 nPropertyID, const sColor & TheColor);
 	inline sColor GetColor(const Lib3MF_uint32 nPropertyID);
+	inline void GetAllColors(std::vector<sColor> & ColorsBuffer);
+	inline void SetAllColors(const CInputVector<sColor> & ColorsBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -1862,6 +1875,8 @@ public:
 	inline sTex2Coord GetTex2Coord(const Lib3MF_uint32 nPropertyID);
 	inline void RemoveTex2Coord(const Lib3MF_uint32 nPropertyID);
 	inline PTexture2D GetTexture2D();
+	inline void GetAllTex2Coords(std::vector<sTex2Coord> & UVCoordinatesBuffer);
+	inline void SetAllTex2Coords(const CInputVector<sTex2Coord> & UVCoordinatesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3199,6 +3214,29 @@ public:
 	inline Lib3MF_uint64 Count();
 };
 	
+/*************************************************************************************************************************
+ Class CInstanceTable 
+**************************************************************************************************************************/
+class CInstanceTable : public CBase {
+public:
+	
+	/**
+	* CInstanceTable::CInstanceTable - Constructor for InstanceTable class.
+	*/
+	CInstanceTable(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline Lib3MF_uint32 GetMeshCount();
+	inline PMeshObject GetMeshObject(const Lib3MF_uint32 nMeshIndex);
+	inline void GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount);
+	inline void GetVertices(std::vector<sPosition> & VerticesBuffer);
+	inline void GetTriangles(std::vector<sTriangle> & TrianglesBuffer);
+	inline Lib3MF_uint32 GetInstanceCount();
+	inline void GetInstances(std::vector<sMeshInstance> & InstancesBuffer);
+};
+	
 /*************************************************************************************************************************
  Class CSlice 
 **************************************************************************************************************************/
@@ -3248,6 +3286,11 @@ public:
 	inline void CollapseSliceReferences();
 	inline void SetOwnPath(const std::string & sPath);
 	inline std::string GetOwnPath();
+	inline Lib3MF_uint64 GetTotalSliceCount();
+	inline PSlice GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex);
+	inline bool FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex);
+	inline void GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount);
+	inline void ValidatePolygons(std::vector<sSliceLayerReport> & LayerReportsBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3424,6 +3467,7 @@ public:
 	inline void SetBuildUUID(const std::string & sUUID);
 	inline PBuildItemIterator GetBuildItems();
 	inline sBox GetOutbox();
+	inline PInstanceTable GetInstanceTable();
 	inline PResourceIterator GetResources();
 	inline PObjectIterator GetObjects();
 	inline PMeshObjectIterator GetMeshObjects();
@@ -3472,6 +3516,7 @@ public:
 	inline PLevelSet AddLevelSet();
 	inline PLevelSetIterator GetLevelSets();
 	inline void RemoveResource(classParam<CResource> pResource);
+	inline Lib3MF_uint32 DeduplicateProperties(const bool bRemoveUnreferenced);
 };
 
 /*************************************************************************************************************************
@@ -3597,6 +3642,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		case 0x9BD7D3C2026B8CE8UL: return new CFunctionFromImage3D(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
 		case 0x68FB2D5FFC4BA12AUL: return new CBuildItem(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 		case 0xA7D21BD364910860UL: return new CBuildItemIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
+		case 0xCDB5C649E208089DUL: return new CInstanceTable(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::InstanceTable"
 		case 0x2198BCF4D8DF9C40UL: return new CSlice(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
 		case 0x6594B031B6096238UL: return new CSliceStack(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::SliceStack"
 		case 0xD9E46D5E6D8118EEUL: return new CConsumer(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Consumer"
@@ -3902,10 +3948,13 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Writer_SetDecimalPrecision = nullptr;
 		pWrapperTable->m_Writer_SetStrictModeActive = nullptr;
 		pWrapperTable->m_Writer_GetStrictModeActive = nullptr;
+		pWrapperTable->m_Writer_SetIncrementalModeActive = nullptr;
+		pWrapperTable->m_Writer_GetIncrementalModeActive = nullptr;
 		pWrapperTable->m_Writer_GetWarning = nullptr;
 		pWrapperTable->m_Writer_GetWarningCount = nullptr;
 		pWrapperTable->m_Writer_AddKeyWrappingCallback = nullptr;
 		pWrapperTable->m_Writer_SetContentEncryptionCallback = nullptr;
+		pWrapperTable->m_Writer_GetStatistics = nullptr;
 		pWrapperTable->m_Reader_ReadFromFile = nullptr;
 		pWrapperTable->m_Reader_ReadFromBuffer = nullptr;
 		pWrapperTable->m_Reader_ReadFromCallback = nullptr;
@@ -3918,6 +3967,9 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Reader_GetWarningCount = nullptr;
 		pWrapperTable->m_Reader_AddKeyWrappingCallback = nullptr;
 		pWrapperTable->m_Reader_SetContentEncryptionCallback = nullptr;
+		pWrapperTable->m_Reader_SetInPlaceDecryptionActive = nullptr;
+		pWrapperTable->m_Reader_GetInPlaceDecryptionActive = nullptr;
+		pWrapperTable->m_Reader_GetStatistics = nullptr;
 		pWrapperTable->m_PackagePart_GetPath = nullptr;
 		pWrapperTable->m_PackagePart_SetPath = nullptr;
 		pWrapperTable->m_Resource_GetResourceID = nullptr;
@@ -4125,12 +4177,16 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_ColorGroup_RemoveColor = nullptr;
 		pWrapperTable->m_ColorGroup_SetColor = nullptr;
 		pWrapperTable->m_ColorGroup_GetColor = nullptr;
+		pWrapperTable->m_ColorGroup_GetAllColors = nullptr;
+		pWrapperTable->m_ColorGroup_SetAllColors = nullptr;
 		pWrapperTable->m_Texture2DGroup_GetCount = nullptr;
 		pWrapperTable->m_Texture2DGroup_GetAllPropertyIDs = nullptr;
 		pWrapperTable->m_Texture2DGroup_AddTex2Coord = nullptr;
 		pWrapperTable->m_Texture2DGroup_GetTex2Coord = nullptr;
 		pWrapperTable->m_Texture2DGroup_RemoveTex2Coord = nullptr;
 		pWrapperTable->m_Texture2DGroup_GetTexture2D = nullptr;
+		pWrapperTable->m_Texture2DGroup_GetAllTex2Coords = nullptr;
+		pWrapperTable->m_Texture2DGroup_SetAllTex2Coords = nullptr;
 		pWrapperTable->m_CompositeMaterials_GetCount = nullptr;
 		pWrapperTable->m_CompositeMaterials_GetAllPropertyIDs = nullptr;
 		pWrapperTable->m_CompositeMaterials_GetBaseMaterialGroup = nullptr;
@@ -4362,6 +4418,13 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_BuildItemIterator_GetCurrent = nullptr;
 		pWrapperTable->m_BuildItemIterator_Clone = nullptr;
 		pWrapperTable->m_BuildItemIterator_Count = nullptr;
+		pWrapperTable->m_InstanceTable_GetMeshCount = nullptr;
+		pWrapperTable->m_InstanceTable_GetMeshObject = nullptr;
+		pWrapperTable->m_InstanceTable_GetMeshRange = nullptr;
+		pWrapperTable->m_InstanceTable_GetVertices = nullptr;
+		pWrapperTable->m_InstanceTable_GetTriangles = nullptr;
+		pWrapperTable->m_InstanceTable_GetInstanceCount = nullptr;
+		pWrapperTable->m_InstanceTable_GetInstances = nullptr;
 		pWrapperTable->m_Slice_SetVertices = nullptr;
 		pWrapperTable->m_Slice_GetVertices = nullptr;
 		pWrapperTable->m_Slice_GetVertexCount = nullptr;
@@ -4381,6 +4444,11 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_SliceStack_CollapseSliceReferences = nullptr;
 		pWrapperTable->m_SliceStack_SetOwnPath = nullptr;
 		pWrapperTable->m_SliceStack_GetOwnPath = nullptr;
+		pWrapperTable->m_SliceStack_GetTotalSliceCount = nullptr;
+		pWrapperTable->m_SliceStack_GetTotalSlice = nullptr;
+		pWrapperTable->m_SliceStack_FindSliceAtZ = nullptr;
+		pWrapperTable->m_SliceStack_GetSliceRange = nullptr;
+		pWrapperTable->m_SliceStack_ValidatePolygons = nullptr;
 		pWrapperTable->m_Consumer_GetConsumerID = nullptr;
 		pWrapperTable->m_Consumer_GetKeyID = nullptr;
 		pWrapperTable->m_Consumer_GetKeyValue = nullptr;
@@ -4445,6 +4513,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Model_SetBuildUUID = nullptr;
 		pWrapperTable->m_Model_GetBuildItems = nullptr;
 		pWrapperTable->m_Model_GetOutbox = nullptr;
+		pWrapperTable->m_Model_GetInstanceTable = nullptr;
 		pWrapperTable->m_Model_GetResources = nullptr;
 		pWrapperTable->m_Model_GetObjects = nullptr;
 		pWrapperTable->m_Model_GetMeshObjects = nullptr;
@@ -4493,6 +4562,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Model_AddLevelSet = nullptr;
 		pWrapperTable->m_Model_GetLevelSets = nullptr;
 		pWrapperTable->m_Model_RemoveResource = nullptr;
+		pWrapperTable->m_Model_DeduplicateProperties = nullptr;
 		pWrapperTable->m_GetLibraryVersion = nullptr;
 		pWrapperTable->m_GetPrereleaseInformation = nullptr;
 		pWrapperTable->m_GetBuildInformation = nullptr;
@@ -4652,6 +4722,24 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Writer_GetStrictModeActive == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetIncrementalModeActive = (PLib3MFWriter_SetIncrementalModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setincrementalmodeactive");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetIncrementalModeActive = (PLib3MFWriter_SetIncrementalModeActivePtr) dlsym(hLibrary, "lib3mf_writer_setincrementalmodeactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetIncrementalModeActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetIncrementalModeActive = (PLib3MFWriter_GetIncrementalModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_getincrementalmodeactive");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetIncrementalModeActive = (PLib3MFWriter_GetIncrementalModeActivePtr) dlsym(hLibrary, "lib3mf_writer_getincrementalmodeactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetIncrementalModeActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Writer_GetWarning = (PLib3MFWriter_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_writer_getwarning");
 		#else // _WIN32
@@ -4688,6 +4776,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Writer_SetContentEncryptionCallback == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetStatistics = (PLib3MFWriter_GetStatisticsPtr) GetProcAddress(hLibrary, "lib3mf_writer_getstatistics");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetStatistics = (PLib3MFWriter_GetStatisticsPtr) dlsym(hLibrary, "lib3mf_writer_getstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetStatistics == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Reader_ReadFromFile = (PLib3MFReader_ReadFromFilePtr) GetProcAddress(hLibrary, "lib3mf_reader_readfromfile");
 		#else // _WIN32
@@ -4796,6 +4893,33 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Reader_SetContentEncryptionCallback == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetInPlaceDecryptionActive = (PLib3MFReader_SetInPlaceDecryptionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setinplacedecryptionactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetInPlaceDecryptionActive = (PLib3MFReader_SetInPlaceDecryptionActivePtr) dlsym(hLibrary, "lib3mf_reader_setinplacedecryptionactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetInPlaceDecryptionActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetInPlaceDecryptionActive = (PLib3MFReader_GetInPlaceDecryptionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getinplacedecryptionactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetInPlaceDecryptionActive = (PLib3MFReader_GetInPlaceDecryptionActivePtr) dlsym(hLibrary, "lib3mf_reader_getinplacedecryptionactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetInPlaceDecryptionActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetStatistics = (PLib3MFReader_GetStatisticsPtr) GetProcAddress(hLibrary, "lib3mf_reader_getstatistics");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetStatistics = (PLib3MFReader_GetStatisticsPtr) dlsym(hLibrary, "lib3mf_reader_getstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetStatistics == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_PackagePart_GetPath = (PLib3MFPackagePart_GetPathPtr) GetProcAddress(hLibrary, "lib3mf_packagepart_getpath");
 		#else // _WIN32
@@ -6659,6 +6783,24 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_ColorGroup_GetColor == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_ColorGroup_GetAllColors = (PLib3MFColorGroup_GetAllColorsPtr) GetProcAddress(hLibrary, "lib3mf_colorgroup_getallcolors");
+		#else // _WIN32
+		pWrapperTable->m_ColorGroup_GetAllColors = (PLib3MFColorGroup_GetAllColorsPtr) dlsym(hLibrary, "lib3mf_colorgroup_getallcolors");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ColorGroup_GetAllColors == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ColorGroup_SetAllColors = (PLib3MFColorGroup_SetAllColorsPtr) GetProcAddress(hLibrary, "lib3mf_colorgroup_setallcolors");
+		#else // _WIN32
+		pWrapperTable->m_ColorGroup_SetAllColors = (PLib3MFColorGroup_SetAllColorsPtr) dlsym(hLibrary, "lib3mf_colorgroup_setallcolors");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ColorGroup_SetAllColors == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Texture2DGroup_GetCount = (PLib3MFTexture2DGroup_GetCountPtr) GetProcAddress(hLibrary, "lib3mf_texture2dgroup_getcount");
 		#else // _WIN32
@@ -6713,6 +6855,24 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Texture2DGroup_GetTexture2D == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Texture2DGroup_GetAllTex2Coords = (PLib3MFTexture2DGroup_GetAllTex2CoordsPtr) GetProcAddress(hLibrary, "lib3mf_texture2dgroup_getalltex2coords");
+		#else // _WIN32
+		pWrapperTable->m_Texture2DGroup_GetAllTex2Coords = (PLib3MFTexture2DGroup_GetAllTex2CoordsPtr) dlsym(hLibrary, "lib3mf_texture2dgroup_getalltex2coords");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Texture2DGroup_GetAllTex2Coords == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Texture2DGroup_SetAllTex2Coords = (PLib3MFTexture2DGroup_SetAllTex2CoordsPtr) GetProcAddress(hLibrary, "lib3mf_texture2dgroup_setalltex2coords");
+		#else // _WIN32
+		pWrapperTable->m_Texture2DGroup_SetAllTex2Coords = (PLib3MFTexture2DGroup_SetAllTex2CoordsPtr) dlsym(hLibrary, "lib3mf_texture2dgroup_setalltex2coords");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Texture2DGroup_SetAllTex2Coords == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_CompositeMaterials_GetCount = (PLib3MFCompositeMaterials_GetCountPtr) GetProcAddress(hLibrary, "lib3mf_compositematerials_getcount");
 		#else // _WIN32
@@ -8792,6 +8952,69 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_BuildItemIterator_Count == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetMeshCount = (PLib3MFInstanceTable_GetMeshCountPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getmeshcount");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetMeshCount = (PLib3MFInstanceTable_GetMeshCountPtr) dlsym(hLibrary, "lib3mf_instancetable_getmeshcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetMeshCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetMeshObject = (PLib3MFInstanceTable_GetMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getmeshobject");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetMeshObject = (PLib3MFInstanceTable_GetMeshObjectPtr) dlsym(hLibrary, "lib3mf_instancetable_getmeshobject");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetMeshObject == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetMeshRange = (PLib3MFInstanceTable_GetMeshRangePtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getmeshrange");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetMeshRange = (PLib3MFInstanceTable_GetMeshRangePtr) dlsym(hLibrary, "lib3mf_instancetable_getmeshrange");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetMeshRange == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetVertices = (PLib3MFInstanceTable_GetVerticesPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getvertices");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetVertices = (PLib3MFInstanceTable_GetVerticesPtr) dlsym(hLibrary, "lib3mf_instancetable_getvertices");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetVertices == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetTriangles = (PLib3MFInstanceTable_GetTrianglesPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_gettriangles");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetTriangles = (PLib3MFInstanceTable_GetTrianglesPtr) dlsym(hLibrary, "lib3mf_instancetable_gettriangles");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetTriangles == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetInstanceCount = (PLib3MFInstanceTable_GetInstanceCountPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getinstancecount");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetInstanceCount = (PLib3MFInstanceTable_GetInstanceCountPtr) dlsym(hLibrary, "lib3mf_instancetable_getinstancecount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetInstanceCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_InstanceTable_GetInstances = (PLib3MFInstanceTable_GetInstancesPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getinstances");
+		#else // _WIN32
+		pWrapperTable->m_InstanceTable_GetInstances = (PLib3MFInstanceTable_GetInstancesPtr) dlsym(hLibrary, "lib3mf_instancetable_getinstances");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_InstanceTable_GetInstances == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Slice_SetVertices = (PLib3MFSlice_SetVerticesPtr) GetProcAddress(hLibrary, "lib3mf_slice_setvertices");
 		#else // _WIN32
@@ -8963,6 +9186,51 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_SliceStack_GetOwnPath == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_SliceStack_GetTotalSliceCount = (PLib3MFSliceStack_GetTotalSliceCountPtr) GetProcAddress(hLibrary, "lib3mf_slicestack_gettotalslicecount");
+		#else // _WIN32
+		pWrapperTable->m_SliceStack_GetTotalSliceCount = (PLib3MFSliceStack_GetTotalSliceCountPtr) dlsym(hLibrary, "lib3mf_slicestack_gettotalslicecount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SliceStack_GetTotalSliceCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SliceStack_GetTotalSlice = (PLib3MFSliceStack_GetTotalSlicePtr) GetProcAddress(hLibrary, "lib3mf_slicestack_gettotalslice");
+		#else // _WIN32
+		pWrapperTable->m_SliceStack_GetTotalSlice = (PLib3MFSliceStack_GetTotalSlicePtr) dlsym(hLibrary, "lib3mf_slicestack_gettotalslice");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SliceStack_GetTotalSlice == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SliceStack_FindSliceAtZ = (PLib3MFSliceStack_FindSliceAtZPtr) GetProcAddress(hLibrary, "lib3mf_slicestack_findsliceatz");
+		#else // _WIN32
+		pWrapperTable->m_SliceStack_FindSliceAtZ = (PLib3MFSliceStack_FindSliceAtZPtr) dlsym(hLibrary, "lib3mf_slicestack_findsliceatz");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SliceStack_FindSliceAtZ == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SliceStack_GetSliceRange = (PLib3MFSliceStack_GetSliceRangePtr) GetProcAddress(hLibrary, "lib3mf_slicestack_getslicerange");
+		#else // _WIN32
+		pWrapperTable->m_SliceStack_GetSliceRange = (PLib3MFSliceStack_GetSliceRangePtr) dlsym(hLibrary, "lib3mf_slicestack_getslicerange");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SliceStack_GetSliceRange == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SliceStack_ValidatePolygons = (PLib3MFSliceStack_ValidatePolygonsPtr) GetProcAddress(hLibrary, "lib3mf_slicestack_validatepolygons");
+		#else // _WIN32
+		pWrapperTable->m_SliceStack_ValidatePolygons = (PLib3MFSliceStack_ValidatePolygonsPtr) dlsym(hLibrary, "lib3mf_slicestack_validatepolygons");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SliceStack_ValidatePolygons == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Consumer_GetConsumerID = (PLib3MFConsumer_GetConsumerIDPtr) GetProcAddress(hLibrary, "lib3mf_consumer_getconsumerid");
 		#else // _WIN32
@@ -9539,6 +9807,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Model_GetOutbox == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Model_GetInstanceTable = (PLib3MFModel_GetInstanceTablePtr) GetProcAddress(hLibrary, "lib3mf_model_getinstancetable");
+		#else // _WIN32
+		pWrapperTable->m_Model_GetInstanceTable = (PLib3MFModel_GetInstanceTablePtr) dlsym(hLibrary, "lib3mf_model_getinstancetable");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Model_GetInstanceTable == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Model_GetResources = (PLib3MFModel_GetResourcesPtr) GetProcAddress(hLibrary, "lib3mf_model_getresources");
 		#else // _WIN32
@@ -9971,6 +10248,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Model_RemoveResource == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Model_DeduplicateProperties = (PLib3MFModel_DeduplicatePropertiesPtr) GetProcAddress(hLibrary, "lib3mf_model_deduplicateproperties");
+		#else // _WIN32
+		pWrapperTable->m_Model_DeduplicateProperties = (PLib3MFModel_DeduplicatePropertiesPtr) dlsym(hLibrary, "lib3mf_model_deduplicateproperties");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Model_DeduplicateProperties == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetLibraryVersion = (PLib3MFGetLibraryVersionPtr) GetProcAddress(hLibrary, "lib3mf_getlibraryversion");
 		#else // _WIN32
@@ -10198,6 +10484,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetStrictModeActive == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_writer_setincrementalmodeactive", (void**)&(pWrapperTable->m_Writer_SetIncrementalModeActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetIncrementalModeActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getincrementalmodeactive", (void**)&(pWrapperTable->m_Writer_GetIncrementalModeActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetIncrementalModeActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_writer_getwarning", (void**)&(pWrapperTable->m_Writer_GetWarning));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetWarning == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10214,6 +10508,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetContentEncryptionCallback == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_writer_getstatistics", (void**)&(pWrapperTable->m_Writer_GetStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetStatistics == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_reader_readfromfile", (void**)&(pWrapperTable->m_Reader_ReadFromFile));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_ReadFromFile == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10262,6 +10560,18 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetContentEncryptionCallback == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_reader_setinplacedecryptionactive", (void**)&(pWrapperTable->m_Reader_SetInPlaceDecryptionActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetInPlaceDecryptionActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getinplacedecryptionactive", (void**)&(pWrapperTable->m_Reader_GetInPlaceDecryptionActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetInPlaceDecryptionActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getstatistics", (void**)&(pWrapperTable->m_Reader_GetStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetStatistics == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_packagepart_getpath", (void**)&(pWrapperTable->m_PackagePart_GetPath));
 		if ( (eLookupError != 0) || (pWrapperTable->m_PackagePart_GetPath == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -11090,6 +11400,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_ColorGroup_GetColor == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_colorgroup_getallcolors", (void**)&(pWrapperTable->m_ColorGroup_GetAllColors));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ColorGroup_GetAllColors == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_colorgroup_setallcolors", (void**)&(pWrapperTable->m_ColorGroup_SetAllColors));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ColorGroup_SetAllColors == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_texture2dgroup_getcount", (void**)&(pWrapperTable->m_Texture2DGroup_GetCount));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Texture2DGroup_GetCount == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -11114,6 +11432,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Texture2DGroup_GetTexture2D == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_texture2dgroup_getalltex2coords", (void**)&(pWrapperTable->m_Texture2DGroup_GetAllTex2Coords));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Texture2DGroup_GetAllTex2Coords == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_texture2dgroup_setalltex2coords", (void**)&(pWrapperTable->m_Texture2DGroup_SetAllTex2Coords));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Texture2DGroup_SetAllTex2Coords == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_compositematerials_getcount", (void**)&(pWrapperTable->m_CompositeMaterials_GetCount));
 		if ( (eLookupError != 0) || (pWrapperTable->m_CompositeMaterials_GetCount == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12038,6 +12364,34 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_BuildItemIterator_Count == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_instancetable_getmeshcount", (void**)&(pWrapperTable->m_InstanceTable_GetMeshCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetMeshCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_instancetable_getmeshobject", (void**)&(pWrapperTable->m_InstanceTable_GetMeshObject));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetMeshObject == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_instancetable_getmeshrange", (void**)&(pWrapperTable->m_InstanceTable_GetMeshRange));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetMeshRange == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_instancetable_getvertices", (void**)&(pWrapperTable->m_InstanceTable_GetVertices));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetVertices == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_instancetable_gettriangles", (void**)&(pWrapperTable->m_InstanceTable_GetTriangles));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetTriangles == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_instancetable_getinstancecount", (void**)&(pWrapperTable->m_InstanceTable_GetInstanceCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetInstanceCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_instancetable_getinstances", (void**)&(pWrapperTable->m_InstanceTable_GetInstances));
+		if ( (eLookupError != 0) || (pWrapperTable->m_InstanceTable_GetInstances == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_slice_setvertices", (void**)&(pWrapperTable->m_Slice_SetVertices));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Slice_SetVertices == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12114,6 +12468,26 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_SliceStack_GetOwnPath == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_slicestack_gettotalslicecount", (void**)&(pWrapperTable->m_SliceStack_GetTotalSliceCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SliceStack_GetTotalSliceCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_slicestack_gettotalslice", (void**)&(pWrapperTable->m_SliceStack_GetTotalSlice));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SliceStack_GetTotalSlice == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_slicestack_findsliceatz", (void**)&(pWrapperTable->m_SliceStack_FindSliceAtZ));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SliceStack_FindSliceAtZ == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_slicestack_getslicerange", (void**)&(pWrapperTable->m_SliceStack_GetSliceRange));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SliceStack_GetSliceRange == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_slicestack_validatepolygons", (void**)&(pWrapperTable->m_SliceStack_ValidatePolygons));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SliceStack_ValidatePolygons == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_consumer_getconsumerid", (void**)&(pWrapperTable->m_Consumer_GetConsumerID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Consumer_GetConsumerID == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12370,6 +12744,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Model_GetOutbox == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_model_getinstancetable", (void**)&(pWrapperTable->m_Model_GetInstanceTable));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Model_GetInstanceTable == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_model_getresources", (void**)&(pWrapperTable->m_Model_GetResources));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Model_GetResources == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12562,6 +12940,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Model_RemoveResource == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_model_deduplicateproperties", (void**)&(pWrapperTable->m_Model_DeduplicateProperties));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Model_DeduplicateProperties == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_getlibraryversion", (void**)&(pWrapperTable->m_GetLibraryVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetLibraryVersion == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12759,6 +13141,27 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CWriter::SetIncrementalModeActive - Activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+	* @param[in] bIncrementalModeActive - flag whether incremental mode is active or not.
+	*/
+	void CWriter::SetIncrementalModeActive(const bool bIncrementalModeActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetIncrementalModeActive(m_pHandle, bIncrementalModeActive));
+	}
+	
+	/**
+	* CWriter::GetIncrementalModeActive - Queries whether the incremental mode of the writer is active or not
+	* @return returns flag whether incremental mode is active or not.
+	*/
+	bool CWriter::GetIncrementalModeActive()
+	{
+		bool resultIncrementalModeActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetIncrementalModeActive(m_pHandle, &resultIncrementalModeActive));
+		
+		return resultIncrementalModeActive;
+	}
+	
 	/**
 	* CWriter::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -12809,6 +13212,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetContentEncryptionCallback(m_pHandle, pTheCallback, pUserData));
 	}
 	
+	/**
+	* CWriter::GetStatistics - Returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	* @return JSON document with the collected statistics
+	*/
+	std::string CWriter::GetStatistics()
+	{
+		Lib3MF_uint32 bytesNeededStatistics = 0;
+		Lib3MF_uint32 bytesWrittenStatistics = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetStatistics(m_pHandle, 0, &bytesNeededStatistics, nullptr));
+		std::vector<char> bufferStatistics(bytesNeededStatistics);
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetStatistics(m_pHandle, bytesNeededStatistics, &bytesWrittenStatistics, &bufferStatistics[0]));
+		
+		return std::string(&bufferStatistics[0]);
+	}
+	
 	/**
 	 * Method definitions for class CReader
 	 */
@@ -12943,6 +13361,42 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetContentEncryptionCallback(m_pHandle, pTheCallback, pUserData));
 	}
 	
+	/**
+	* CReader::SetInPlaceDecryptionActive - Activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+	* @param[in] bInPlaceDecryptionActive - flag whether in-place decryption is active or not.
+	*/
+	void CReader::SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetInPlaceDecryptionActive(m_pHandle, bInPlaceDecryptionActive));
+	}
+	
+	/**
+	* CReader::GetInPlaceDecryptionActive - Queries whether in-place decryption of the reader is active or not
+	* @return returns flag whether in-place decryption is active or not.
+	*/
+	bool CReader::GetInPlaceDecryptionActive()
+	{
+		bool resultInPlaceDecryptionActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetInPlaceDecryptionActive(m_pHandle, &resultInPlaceDecryptionActive));
+		
+		return resultInPlaceDecryptionActive;
+	}
+	
+	/**
+	* CReader::GetStatistics - Returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	* @return JSON document with the collected statistics
+	*/
+	std::string CReader::GetStatistics()
+	{
+		Lib3MF_uint32 bytesNeededStatistics = 0;
+		Lib3MF_uint32 bytesWrittenStatistics = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetStatistics(m_pHandle, 0, &bytesNeededStatistics, nullptr));
+		std::vector<char> bufferStatistics(bytesNeededStatistics);
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetStatistics(m_pHandle, bytesNeededStatistics, &bytesWrittenStatistics, &bufferStatistics[0]));
+		
+		return std::string(&bufferStatistics[0]);
+	}
+	
 	/**
 	 * Method definitions for class CPackagePart
 	 */
@@ -15616,6 +16070,29 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultTheColor;
 	}
 	
+	/**
+	* CColorGroup::GetAllColors - Returns all colors of this group in the order of GetAllPropertyIDs.
+	* @param[out] ColorsBuffer - contains the colors of the group.
+	*/
+	void CColorGroup::GetAllColors(std::vector<sColor> & ColorsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededColors = 0;
+		Lib3MF_uint64 elementsWrittenColors = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ColorGroup_GetAllColors(m_pHandle, 0, &elementsNeededColors, nullptr));
+		ColorsBuffer.resize((size_t) elementsNeededColors);
+		CheckError(m_pWrapper->m_WrapperTable.m_ColorGroup_GetAllColors(m_pHandle, elementsNeededColors, &elementsWrittenColors, ColorsBuffer.data()));
+	}
+	
+	/**
+	* CColorGroup::SetAllColors - Sets all colors of this group in the order of GetAllPropertyIDs.
+	* @param[in] ColorsBuffer - contains the new colors. Must have GetCount elements.
+	*/
+	void CColorGroup::SetAllColors(const CInputVector<sColor> & ColorsBuffer)
+	{
+		Lib3MF_uint64 nColorsSize = ColorsBuffer.size();
+		CheckError(m_pWrapper->m_WrapperTable.m_ColorGroup_SetAllColors(m_pHandle, nColorsSize, ColorsBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CTexture2DGroup
 	 */
@@ -15695,6 +16172,29 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::shared_ptr<CTexture2D>(dynamic_cast<CTexture2D*>(m_pWrapper->polymorphicFactory(hTexture2DInstance)));
 	}
 	
+	/**
+	* CTexture2DGroup::GetAllTex2Coords - Returns all tex2coords of this group in the order of GetAllPropertyIDs.
+	* @param[out] UVCoordinatesBuffer - contains the u/v-coordinates of the group.
+	*/
+	void CTexture2DGroup::GetAllTex2Coords(std::vector<sTex2Coord> & UVCoordinatesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededUVCoordinates = 0;
+		Lib3MF_uint64 elementsWrittenUVCoordinates = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Texture2DGroup_GetAllTex2Coords(m_pHandle, 0, &elementsNeededUVCoordinates, nullptr));
+		UVCoordinatesBuffer.resize((size_t) elementsNeededUVCoordinates);
+		CheckError(m_pWrapper->m_WrapperTable.m_Texture2DGroup_GetAllTex2Coords(m_pHandle, elementsNeededUVCoordinates, &elementsWrittenUVCoordinates, UVCoordinatesBuffer.data()));
+	}
+	
+	/**
+	* CTexture2DGroup::SetAllTex2Coords - Sets all tex2coords of this group in the order of GetAllPropertyIDs.
+	* @param[in] UVCoordinatesBuffer - contains the new u/v-coordinates. Must have GetCount elements.
+	*/
+	void CTexture2DGroup::SetAllTex2Coords(const CInputVector<sTex2Coord> & UVCoordinatesBuffer)
+	{
+		Lib3MF_uint64 nUVCoordinatesSize = UVCoordinatesBuffer.size();
+		CheckError(m_pWrapper->m_WrapperTable.m_Texture2DGroup_SetAllTex2Coords(m_pHandle, nUVCoordinatesSize, UVCoordinatesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CCompositeMaterials
 	 */
@@ -19279,6 +19779,102 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultCount;
 	}
 	
+	/**
+	 * Method definitions for class CInstanceTable
+	 */
+	
+	/**
+	* CInstanceTable::GetMeshCount - Returns the number of unique mesh objects referenced by the build items.
+	* @return the number of unique mesh objects
+	*/
+	Lib3MF_uint32 CInstanceTable::GetMeshCount()
+	{
+		Lib3MF_uint32 resultCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetMeshCount(m_pHandle, &resultCount));
+		
+		return resultCount;
+	}
+	
+	/**
+	* CInstanceTable::GetMeshObject - Returns a unique mesh object of the table.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @return the mesh object
+	*/
+	PMeshObject CInstanceTable::GetMeshObject(const Lib3MF_uint32 nMeshIndex)
+	{
+		Lib3MFHandle hMeshObject = (Lib3MFHandle)nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetMeshObject(m_pHandle, nMeshIndex, &hMeshObject));
+		
+		if (!hMeshObject) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CMeshObject>(dynamic_cast<CMeshObject*>(m_pWrapper->polymorphicFactory(hMeshObject)));
+	}
+	
+	/**
+	* CInstanceTable::GetMeshRange - Returns the location of a unique mesh object within the packed vertex and triangle buffers.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @param[out] nVertexOffset - index of the first vertex of the mesh object in the vertex buffer
+	* @param[out] nVertexCount - number of vertices of the mesh object
+	* @param[out] nTriangleOffset - index of the first triangle of the mesh object in the triangle buffer
+	* @param[out] nTriangleCount - number of triangles of the mesh object
+	*/
+	void CInstanceTable::GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetMeshRange(m_pHandle, nMeshIndex, &nVertexOffset, &nVertexCount, &nTriangleOffset, &nTriangleCount));
+	}
+	
+	/**
+	* CInstanceTable::GetVertices - Returns the vertices of all unique mesh objects, packed in mesh order.
+	* @param[out] VerticesBuffer - the packed vertex positions
+	*/
+	void CInstanceTable::GetVertices(std::vector<sPosition> & VerticesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededVertices = 0;
+		Lib3MF_uint64 elementsWrittenVertices = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetVertices(m_pHandle, 0, &elementsNeededVertices, nullptr));
+		VerticesBuffer.resize((size_t) elementsNeededVertices);
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetVertices(m_pHandle, elementsNeededVertices, &elementsWrittenVertices, VerticesBuffer.data()));
+	}
+	
+	/**
+	* CInstanceTable::GetTriangles - Returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+	* @param[out] TrianglesBuffer - the packed triangles
+	*/
+	void CInstanceTable::GetTriangles(std::vector<sTriangle> & TrianglesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededTriangles = 0;
+		Lib3MF_uint64 elementsWrittenTriangles = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetTriangles(m_pHandle, 0, &elementsNeededTriangles, nullptr));
+		TrianglesBuffer.resize((size_t) elementsNeededTriangles);
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetTriangles(m_pHandle, elementsNeededTriangles, &elementsWrittenTriangles, TrianglesBuffer.data()));
+	}
+	
+	/**
+	* CInstanceTable::GetInstanceCount - Returns the number of mesh instances placed by the build items.
+	* @return the number of mesh instances
+	*/
+	Lib3MF_uint32 CInstanceTable::GetInstanceCount()
+	{
+		Lib3MF_uint32 resultCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetInstanceCount(m_pHandle, &resultCount));
+		
+		return resultCount;
+	}
+	
+	/**
+	* CInstanceTable::GetInstances - Returns all mesh instances placed by the build items, in build item order.
+	* @param[out] InstancesBuffer - the mesh instances with their accumulated transforms
+	*/
+	void CInstanceTable::GetInstances(std::vector<sMeshInstance> & InstancesBuffer)
+	{
+		Lib3MF_uint64 elementsNeededInstances = 0;
+		Lib3MF_uint64 elementsWrittenInstances = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetInstances(m_pHandle, 0, &elementsNeededInstances, nullptr));
+		InstancesBuffer.resize((size_t) elementsNeededInstances);
+		CheckError(m_pWrapper->m_WrapperTable.m_InstanceTable_GetInstances(m_pHandle, elementsNeededInstances, &elementsWrittenInstances, InstancesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CSlice
 	 */
@@ -19524,6 +20120,73 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::string(&bufferPath[0]);
 	}
 	
+	/**
+	* CSliceStack::GetTotalSliceCount - Returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+	* @return the number of slices in the slice view
+	*/
+	Lib3MF_uint64 CSliceStack::GetTotalSliceCount()
+	{
+		Lib3MF_uint64 resultCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_SliceStack_GetTotalSliceCount(m_pHandle, &resultCount));
+		
+		return resultCount;
+	}
+	
+	/**
+	* CSliceStack::GetTotalSlice - Queries a slice from the slice view of this slice stack without collapsing its slice refs.
+	* @param[in] nTotalSliceIndex - the index of the slice in the slice view
+	* @return the Slice instance
+	*/
+	PSlice CSliceStack::GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex)
+	{
+		Lib3MFHandle hTheSlice = (Lib3MFHandle)nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_SliceStack_GetTotalSlice(m_pHandle, nTotalSliceIndex, &hTheSlice));
+		
+		if (!hTheSlice) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CSlice>(dynamic_cast<CSlice*>(m_pWrapper->polymorphicFactory(hTheSlice)));
+	}
+	
+	/**
+	* CSliceStack::FindSliceAtZ - Finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+	* @param[in] dZValue - the Z-coordinate to look up
+	* @param[out] nTotalSliceIndex - the index of the slice in the slice view, if one was found
+	* @return true, if a slice contains the Z-coordinate
+	*/
+	bool CSliceStack::FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex)
+	{
+		bool resultFound = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_SliceStack_FindSliceAtZ(m_pHandle, dZValue, &nTotalSliceIndex, &resultFound));
+		
+		return resultFound;
+	}
+	
+	/**
+	* CSliceStack::GetSliceRange - Returns the range of slices of the slice view that intersect a Z-interval.
+	* @param[in] dZMin - the lower Z-coordinate of the interval
+	* @param[in] dZMax - the upper Z-coordinate of the interval
+	* @param[out] nFirstIndex - the index of the first slice in the slice view that intersects the interval
+	* @param[out] nCount - the number of slices that intersect the interval
+	*/
+	void CSliceStack::GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_SliceStack_GetSliceRange(m_pHandle, dZMin, dZMax, &nFirstIndex, &nCount));
+	}
+	
+	/**
+	* CSliceStack::ValidatePolygons - Validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+	* @param[out] LayerReportsBuffer - the reports of the layers with issues, in ascending layer order
+	*/
+	void CSliceStack::ValidatePolygons(std::vector<sSliceLayerReport> & LayerReportsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededLayerReports = 0;
+		Lib3MF_uint64 elementsWrittenLayerReports = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_SliceStack_ValidatePolygons(m_pHandle, 0, &elementsNeededLayerReports, nullptr));
+		LayerReportsBuffer.resize((size_t) elementsNeededLayerReports);
+		CheckError(m_pWrapper->m_WrapperTable.m_SliceStack_ValidatePolygons(m_pHandle, elementsNeededLayerReports, &elementsWrittenLayerReports, LayerReportsBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CConsumer
 	 */
@@ -20461,6 +21124,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultOutbox;
 	}
 	
+	/**
+	* CModel::GetInstanceTable - Flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+	* @return the instance table of the current build
+	*/
+	PInstanceTable CModel::GetInstanceTable()
+	{
+		Lib3MFHandle hInstanceTable = (Lib3MFHandle)nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_Model_GetInstanceTable(m_pHandle, &hInstanceTable));
+		
+		if (!hInstanceTable) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CInstanceTable>(dynamic_cast<CInstanceTable*>(m_pWrapper->polymorphicFactory(hInstanceTable)));
+	}
+	
 	/**
 	* CModel::GetResources - creates a resource iterator instance with all resources.
 	* @return returns the iterator instance.
@@ -21152,6 +21830,19 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		Lib3MFHandle hResource = pResource.GetHandle();
 		CheckError(m_pWrapper->m_WrapperTable.m_Model_RemoveResource(m_pHandle, hResource));
 	}
+	
+	/**
+	* CModel::DeduplicateProperties - Merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+	* @param[in] bRemoveUnreferenced - If true, entries that are not referenced by any triangle or multiproperty are removed as well. Groups that are not referenced at all are left untouched.
+	* @return Number of removed entries.
+	*/
+	Lib3MF_uint32 CModel::DeduplicateProperties(const bool bRemoveUnreferenced)
+	{
+		Lib3MF_uint32 resultRemovedCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Model_DeduplicateProperties(m_pHandle, bRemoveUnreferenced, &resultRemovedCount));
+		
+		return resultRemovedCount;
+	}
 
 } // namespace Lib3MF
 
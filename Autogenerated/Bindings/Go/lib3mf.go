@@ -407,6 +407,23 @@ type Ball struct {
 	Radius float64
 }
 
+// SliceLayerReport represents a Lib3MF struct.
+type SliceLayerReport struct {
+	LayerIndex uint32
+	OpenPolygons uint32
+	DegeneratePolygons uint32
+	SelfIntersections uint32
+	OrientationErrors uint32
+	MaxNestingDepth uint32
+}
+
+// MeshInstance represents a Lib3MF struct.
+type MeshInstance struct {
+	MeshIndex uint32
+	BuildItemIndex uint32
+	Transform[4][3] float32
+}
+
 // Vector represents a Lib3MF struct.
 type Vector struct {
 	Coordinates[3] float64
@@ -831,6 +848,25 @@ func (inst Writer) GetStrictModeActive() (bool, error) {
 	return bool(strictModeActive), nil
 }
 
+// SetIncrementalModeActive activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+func (inst Writer) SetIncrementalModeActive(incrementalModeActive bool) error {
+	ret := C.CCall_lib3mf_writer_setincrementalmodeactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(incrementalModeActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetIncrementalModeActive queries whether the incremental mode of the writer is active or not.
+func (inst Writer) GetIncrementalModeActive() (bool, error) {
+	var incrementalModeActive C.bool
+	ret := C.CCall_lib3mf_writer_getincrementalmodeactive(inst.wrapperRef.LibraryHandle, inst.Ref, &incrementalModeActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(incrementalModeActive), nil
+}
+
 // GetWarning returns Warning and Error Information of the read process.
 func (inst Writer) GetWarning(index uint32) (uint32, string, error) {
 	var errorCode C.uint32_t
@@ -879,6 +915,23 @@ func (inst Writer) SetContentEncryptionCallback(theCallback ContentEncryptionCal
 	return nil
 }
 
+// GetStatistics returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+func (inst Writer) GetStatistics() (string, error) {
+	var neededforstatistics C.uint32_t
+	var filledinstatistics C.uint32_t
+	ret := C.CCall_lib3mf_writer_getstatistics(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforstatistics, nil)
+	if ret != 0 {
+		return "", makeError(uint32(ret))
+	}
+	bufferSizestatistics := neededforstatistics
+	bufferstatistics := make([]byte, bufferSizestatistics)
+	ret = C.CCall_lib3mf_writer_getstatistics(inst.wrapperRef.LibraryHandle, inst.Ref, bufferSizestatistics, &filledinstatistics, (*C.char)(unsafe.Pointer(&bufferstatistics[0])))
+	if ret != 0 {
+		return "", makeError(uint32(ret))
+	}
+	return string(bufferstatistics[:(filledinstatistics-1)]), nil
+}
+
 
 // Reader represents a Lib3MF class.
 type Reader struct {
@@ -1013,6 +1066,42 @@ func (inst Reader) SetContentEncryptionCallback(theCallback ContentEncryptionCal
 	return nil
 }
 
+// SetInPlaceDecryptionActive activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+func (inst Reader) SetInPlaceDecryptionActive(inPlaceDecryptionActive bool) error {
+	ret := C.CCall_lib3mf_reader_setinplacedecryptionactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(inPlaceDecryptionActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetInPlaceDecryptionActive queries whether in-place decryption of the reader is active or not.
+func (inst Reader) GetInPlaceDecryptionActive() (bool, error) {
+	var inPlaceDecryptionActive C.bool
+	ret := C.CCall_lib3mf_reader_getinplacedecryptionactive(inst.wrapperRef.LibraryHandle, inst.Ref, &inPlaceDecryptionActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(inPlaceDecryptionActive), nil
+}
+
+// GetStatistics returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+func (inst Reader) GetStatistics() (string, error) {
+	var neededforstatistics C.uint32_t
+	var filledinstatistics C.uint32_t
+	ret := C.CCall_lib3mf_reader_getstatistics(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforstatistics, nil)
+	if ret != 0 {
+		return "", makeError(uint32(ret))
+	}
+	bufferSizestatistics := neededforstatistics
+	bufferstatistics := make([]byte, bufferSizestatistics)
+	ret = C.CCall_lib3mf_reader_getstatistics(inst.wrapperRef.LibraryHandle, inst.Ref, bufferSizestatistics, &filledinstatistics, (*C.char)(unsafe.Pointer(&bufferstatistics[0])))
+	if ret != 0 {
+		return "", makeError(uint32(ret))
+	}
+	return string(bufferstatistics[:(filledinstatistics-1)]), nil
+}
+
 
 // PackagePart represents a Lib3MF class.
 type PackagePart struct {
@@ -3588,6 +3677,32 @@ func (inst ColorGroup) GetColor(propertyID uint32) (Color, error) {
 	return *(*Color)(unsafe.Pointer(&theColor)), nil
 }
 
+// GetAllColors returns all colors of this group in the order of GetAllPropertyIDs.
+func (inst ColorGroup) GetAllColors(colors []Color) ([]Color, error) {
+	var neededforcolors C.uint64_t
+	ret := C.CCall_lib3mf_colorgroup_getallcolors(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforcolors, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(colors) < int(neededforcolors) {
+	 colors = append(colors, make([]Color, int(neededforcolors)-len(colors))...)
+	}
+	ret = C.CCall_lib3mf_colorgroup_getallcolors(inst.wrapperRef.LibraryHandle, inst.Ref, neededforcolors, nil, (*C.sLib3MFColor)(unsafe.Pointer(&colors[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return colors[:int(neededforcolors)], nil
+}
+
+// SetAllColors sets all colors of this group in the order of GetAllPropertyIDs.
+func (inst ColorGroup) SetAllColors(colors []Color) error {
+	ret := C.CCall_lib3mf_colorgroup_setallcolors(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(colors)), (*C.sLib3MFColor)(unsafe.Pointer(&colors[0])))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
 
 // Texture2DGroup represents a Lib3MF class.
 type Texture2DGroup struct {
@@ -3664,6 +3779,32 @@ func (inst Texture2DGroup) GetTexture2D() (Texture2D, error) {
 	return inst.wrapperRef.NewTexture2D(texture2DInstance), nil
 }
 
+// GetAllTex2Coords returns all tex2coords of this group in the order of GetAllPropertyIDs.
+func (inst Texture2DGroup) GetAllTex2Coords(uVCoordinates []Tex2Coord) ([]Tex2Coord, error) {
+	var neededforuVCoordinates C.uint64_t
+	ret := C.CCall_lib3mf_texture2dgroup_getalltex2coords(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforuVCoordinates, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(uVCoordinates) < int(neededforuVCoordinates) {
+	 uVCoordinates = append(uVCoordinates, make([]Tex2Coord, int(neededforuVCoordinates)-len(uVCoordinates))...)
+	}
+	ret = C.CCall_lib3mf_texture2dgroup_getalltex2coords(inst.wrapperRef.LibraryHandle, inst.Ref, neededforuVCoordinates, nil, (*C.sLib3MFTex2Coord)(unsafe.Pointer(&uVCoordinates[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return uVCoordinates[:int(neededforuVCoordinates)], nil
+}
+
+// SetAllTex2Coords sets all tex2coords of this group in the order of GetAllPropertyIDs.
+func (inst Texture2DGroup) SetAllTex2Coords(uVCoordinates []Tex2Coord) error {
+	ret := C.CCall_lib3mf_texture2dgroup_setalltex2coords(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(uVCoordinates)), (*C.sLib3MFTex2Coord)(unsafe.Pointer(&uVCoordinates[0])))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
 
 // CompositeMaterials represents a Lib3MF class.
 type CompositeMaterials struct {
@@ -6761,6 +6902,110 @@ func (inst BuildItemIterator) Count() (uint64, error) {
 }
 
 
+// InstanceTable represents a Lib3MF class.
+type InstanceTable struct {
+	Base
+}
+
+func (wrapper Wrapper) NewInstanceTable(r ref) InstanceTable {
+	return InstanceTable{wrapper.NewBase(r)}
+}
+
+// GetMeshCount returns the number of unique mesh objects referenced by the build items.
+func (inst InstanceTable) GetMeshCount() (uint32, error) {
+	var count C.uint32_t
+	ret := C.CCall_lib3mf_instancetable_getmeshcount(inst.wrapperRef.LibraryHandle, inst.Ref, &count)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(count), nil
+}
+
+// GetMeshObject returns a unique mesh object of the table.
+func (inst InstanceTable) GetMeshObject(meshIndex uint32) (MeshObject, error) {
+	var meshObject ref
+	ret := C.CCall_lib3mf_instancetable_getmeshobject(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(meshIndex), &meshObject)
+	if ret != 0 {
+		return MeshObject{}, makeError(uint32(ret))
+	}
+	return inst.wrapperRef.NewMeshObject(meshObject), nil
+}
+
+// GetMeshRange returns the location of a unique mesh object within the packed vertex and triangle buffers.
+func (inst InstanceTable) GetMeshRange(meshIndex uint32) (uint32, uint32, uint32, uint32, error) {
+	var vertexOffset C.uint32_t
+	var vertexCount C.uint32_t
+	var triangleOffset C.uint32_t
+	var triangleCount C.uint32_t
+	ret := C.CCall_lib3mf_instancetable_getmeshrange(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(meshIndex), &vertexOffset, &vertexCount, &triangleOffset, &triangleCount)
+	if ret != 0 {
+		return 0, 0, 0, 0, makeError(uint32(ret))
+	}
+	return uint32(vertexOffset), uint32(vertexCount), uint32(triangleOffset), uint32(triangleCount), nil
+}
+
+// GetVertices returns the vertices of all unique mesh objects, packed in mesh order.
+func (inst InstanceTable) GetVertices(vertices []Position) ([]Position, error) {
+	var neededforvertices C.uint64_t
+	ret := C.CCall_lib3mf_instancetable_getvertices(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforvertices, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(vertices) < int(neededforvertices) {
+	 vertices = append(vertices, make([]Position, int(neededforvertices)-len(vertices))...)
+	}
+	ret = C.CCall_lib3mf_instancetable_getvertices(inst.wrapperRef.LibraryHandle, inst.Ref, neededforvertices, nil, (*C.sLib3MFPosition)(unsafe.Pointer(&vertices[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return vertices[:int(neededforvertices)], nil
+}
+
+// GetTriangles returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+func (inst InstanceTable) GetTriangles(triangles []Triangle) ([]Triangle, error) {
+	var neededfortriangles C.uint64_t
+	ret := C.CCall_lib3mf_instancetable_gettriangles(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededfortriangles, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(triangles) < int(neededfortriangles) {
+	 triangles = append(triangles, make([]Triangle, int(neededfortriangles)-len(triangles))...)
+	}
+	ret = C.CCall_lib3mf_instancetable_gettriangles(inst.wrapperRef.LibraryHandle, inst.Ref, neededfortriangles, nil, (*C.sLib3MFTriangle)(unsafe.Pointer(&triangles[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return triangles[:int(neededfortriangles)], nil
+}
+
+// GetInstanceCount returns the number of mesh instances placed by the build items.
+func (inst InstanceTable) GetInstanceCount() (uint32, error) {
+	var count C.uint32_t
+	ret := C.CCall_lib3mf_instancetable_getinstancecount(inst.wrapperRef.LibraryHandle, inst.Ref, &count)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(count), nil
+}
+
+// GetInstances returns all mesh instances placed by the build items, in build item order.
+func (inst InstanceTable) GetInstances(instances []MeshInstance) ([]MeshInstance, error) {
+	var neededforinstances C.uint64_t
+	ret := C.CCall_lib3mf_instancetable_getinstances(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforinstances, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(instances) < int(neededforinstances) {
+	 instances = append(instances, make([]MeshInstance, int(neededforinstances)-len(instances))...)
+	}
+	ret = C.CCall_lib3mf_instancetable_getinstances(inst.wrapperRef.LibraryHandle, inst.Ref, neededforinstances, nil, (*C.sLib3MFMeshInstance)(unsafe.Pointer(&instances[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return instances[:int(neededforinstances)], nil
+}
+
+
 // Slice represents a Lib3MF class.
 type Slice struct {
 	Base
@@ -6986,6 +7231,65 @@ func (inst SliceStack) GetOwnPath() (string, error) {
 	return string(bufferpath[:(filledinpath-1)]), nil
 }
 
+// GetTotalSliceCount returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+func (inst SliceStack) GetTotalSliceCount() (uint64, error) {
+	var count C.uint64_t
+	ret := C.CCall_lib3mf_slicestack_gettotalslicecount(inst.wrapperRef.LibraryHandle, inst.Ref, &count)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint64(count), nil
+}
+
+// GetTotalSlice queries a slice from the slice view of this slice stack without collapsing its slice refs.
+func (inst SliceStack) GetTotalSlice(totalSliceIndex uint64) (Slice, error) {
+	var theSlice ref
+	ret := C.CCall_lib3mf_slicestack_gettotalslice(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(totalSliceIndex), &theSlice)
+	if ret != 0 {
+		return Slice{}, makeError(uint32(ret))
+	}
+	return inst.wrapperRef.NewSlice(theSlice), nil
+}
+
+// FindSliceAtZ finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+func (inst SliceStack) FindSliceAtZ(zValue float64) (uint64, bool, error) {
+	var totalSliceIndex C.uint64_t
+	var found C.bool
+	ret := C.CCall_lib3mf_slicestack_findsliceatz(inst.wrapperRef.LibraryHandle, inst.Ref, C.double(zValue), &totalSliceIndex, &found)
+	if ret != 0 {
+		return 0, false, makeError(uint32(ret))
+	}
+	return uint64(totalSliceIndex), bool(found), nil
+}
+
+// GetSliceRange returns the range of slices of the slice view that intersect a Z-interval.
+func (inst SliceStack) GetSliceRange(zMin float64, zMax float64) (uint64, uint64, error) {
+	var firstIndex C.uint64_t
+	var count C.uint64_t
+	ret := C.CCall_lib3mf_slicestack_getslicerange(inst.wrapperRef.LibraryHandle, inst.Ref, C.double(zMin), C.double(zMax), &firstIndex, &count)
+	if ret != 0 {
+		return 0, 0, makeError(uint32(ret))
+	}
+	return uint64(firstIndex), uint64(count), nil
+}
+
+// ValidatePolygons validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+func (inst SliceStack) ValidatePolygons(layerReports []SliceLayerReport) ([]SliceLayerReport, error) {
+	var neededforlayerReports C.uint64_t
+	ret := C.CCall_lib3mf_slicestack_validatepolygons(inst.wrapperRef.LibraryHandle, inst.Ref, 0, &neededforlayerReports, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(layerReports) < int(neededforlayerReports) {
+	 layerReports = append(layerReports, make([]SliceLayerReport, int(neededforlayerReports)-len(layerReports))...)
+	}
+	ret = C.CCall_lib3mf_slicestack_validatepolygons(inst.wrapperRef.LibraryHandle, inst.Ref, neededforlayerReports, nil, (*C.sLib3MFSliceLayerReport)(unsafe.Pointer(&layerReports[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return layerReports[:int(neededforlayerReports)], nil
+}
+
 
 // Consumer represents a Lib3MF class.
 type Consumer struct {
@@ -7800,6 +8104,16 @@ func (inst Model) GetOutbox() (Box, error) {
 	return *(*Box)(unsafe.Pointer(&outbox)), nil
 }
 
+// GetInstanceTable flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+func (inst Model) GetInstanceTable() (InstanceTable, error) {
+	var instanceTable ref
+	ret := C.CCall_lib3mf_model_getinstancetable(inst.wrapperRef.LibraryHandle, inst.Ref, &instanceTable)
+	if ret != 0 {
+		return InstanceTable{}, makeError(uint32(ret))
+	}
+	return inst.wrapperRef.NewInstanceTable(instanceTable), nil
+}
+
 // GetResources creates a resource iterator instance with all resources.
 func (inst Model) GetResources() (ResourceIterator, error) {
 	var resourceIterator ref
@@ -8278,6 +8592,16 @@ func (inst Model) RemoveResource(resource Resource) error {
 	return nil
 }
 
+// DeduplicateProperties merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+func (inst Model) DeduplicateProperties(removeUnreferenced bool) (uint32, error) {
+	var removedCount C.uint32_t
+	ret := C.CCall_lib3mf_model_deduplicateproperties(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(removeUnreferenced), &removedCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(removedCount), nil
+}
+
 
 // GetLibraryVersion retrieves the binary version of this library.
 func (wrapper Wrapper) GetLibraryVersion() (uint32, uint32, uint32, error) {
@@ -58,10 +58,13 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Writer_SetDecimalPrecision = NULL;
 	pWrapperTable->m_Writer_SetStrictModeActive = NULL;
 	pWrapperTable->m_Writer_GetStrictModeActive = NULL;
+	pWrapperTable->m_Writer_SetIncrementalModeActive = NULL;
+	pWrapperTable->m_Writer_GetIncrementalModeActive = NULL;
 	pWrapperTable->m_Writer_GetWarning = NULL;
 	pWrapperTable->m_Writer_GetWarningCount = NULL;
 	pWrapperTable->m_Writer_AddKeyWrappingCallback = NULL;
 	pWrapperTable->m_Writer_SetContentEncryptionCallback = NULL;
+	pWrapperTable->m_Writer_GetStatistics = NULL;
 	pWrapperTable->m_Reader_ReadFromFile = NULL;
 	pWrapperTable->m_Reader_ReadFromBuffer = NULL;
 	pWrapperTable->m_Reader_ReadFromCallback = NULL;
@@ -74,6 +77,9 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Reader_GetWarningCount = NULL;
 	pWrapperTable->m_Reader_AddKeyWrappingCallback = NULL;
 	pWrapperTable->m_Reader_SetContentEncryptionCallback = NULL;
+	pWrapperTable->m_Reader_SetInPlaceDecryptionActive = NULL;
+	pWrapperTable->m_Reader_GetInPlaceDecryptionActive = NULL;
+	pWrapperTable->m_Reader_GetStatistics = NULL;
 	pWrapperTable->m_PackagePart_GetPath = NULL;
 	pWrapperTable->m_PackagePart_SetPath = NULL;
 	pWrapperTable->m_Resource_GetResourceID = NULL;
@@ -281,12 +287,16 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_ColorGroup_RemoveColor = NULL;
 	pWrapperTable->m_ColorGroup_SetColor = NULL;
 	pWrapperTable->m_ColorGroup_GetColor = NULL;
+	pWrapperTable->m_ColorGroup_GetAllColors = NULL;
+	pWrapperTable->m_ColorGroup_SetAllColors = NULL;
 	pWrapperTable->m_Texture2DGroup_GetCount = NULL;
 	pWrapperTable->m_Texture2DGroup_GetAllPropertyIDs = NULL;
 	pWrapperTable->m_Texture2DGroup_AddTex2Coord = NULL;
 	pWrapperTable->m_Texture2DGroup_GetTex2Coord = NULL;
 	pWrapperTable->m_Texture2DGroup_RemoveTex2Coord = NULL;
 	pWrapperTable->m_Texture2DGroup_GetTexture2D = NULL;
+	pWrapperTable->m_Texture2DGroup_GetAllTex2Coords = NULL;
+	pWrapperTable->m_Texture2DGroup_SetAllTex2Coords = NULL;
 	pWrapperTable->m_CompositeMaterials_GetCount = NULL;
 	pWrapperTable->m_CompositeMaterials_GetAllPropertyIDs = NULL;
 	pWrapperTable->m_CompositeMaterials_GetBaseMaterialGroup = NULL;
@@ -518,6 +528,13 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_BuildItemIterator_GetCurrent = NULL;
 	pWrapperTable->m_BuildItemIterator_Clone = NULL;
 	pWrapperTable->m_BuildItemIterator_Count = NULL;
+	pWrapperTable->m_InstanceTable_GetMeshCount = NULL;
+	pWrapperTable->m_InstanceTable_GetMeshObject = NULL;
+	pWrapperTable->m_InstanceTable_GetMeshRange = NULL;
+	pWrapperTable->m_InstanceTable_GetVertices = NULL;
+	pWrapperTable->m_InstanceTable_GetTriangles = NULL;
+	pWrapperTable->m_InstanceTable_GetInstanceCount = NULL;
+	pWrapperTable->m_InstanceTable_GetInstances = NULL;
 	pWrapperTable->m_Slice_SetVertices = NULL;
 	pWrapperTable->m_Slice_GetVertices = NULL;
 	pWrapperTable->m_Slice_GetVertexCount = NULL;
@@ -537,6 +554,11 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_SliceStack_CollapseSliceReferences = NULL;
 	pWrapperTable->m_SliceStack_SetOwnPath = NULL;
 	pWrapperTable->m_SliceStack_GetOwnPath = NULL;
+	pWrapperTable->m_SliceStack_GetTotalSliceCount = NULL;
+	pWrapperTable->m_SliceStack_GetTotalSlice = NULL;
+	pWrapperTable->m_SliceStack_FindSliceAtZ = NULL;
+	pWrapperTable->m_SliceStack_GetSliceRange = NULL;
+	pWrapperTable->m_SliceStack_ValidatePolygons = NULL;
 	pWrapperTable->m_Consumer_GetConsumerID = NULL;
 	pWrapperTable->m_Consumer_GetKeyID = NULL;
 	pWrapperTable->m_Consumer_GetKeyValue = NULL;
@@ -601,6 +623,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Model_SetBuildUUID = NULL;
 	pWrapperTable->m_Model_GetBuildItems = NULL;
 	pWrapperTable->m_Model_GetOutbox = NULL;
+	pWrapperTable->m_Model_GetInstanceTable = NULL;
 	pWrapperTable->m_Model_GetResources = NULL;
 	pWrapperTable->m_Model_GetObjects = NULL;
 	pWrapperTable->m_Model_GetMeshObjects = NULL;
@@ -649,6 +672,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Model_AddLevelSet = NULL;
 	pWrapperTable->m_Model_GetLevelSets = NULL;
 	pWrapperTable->m_Model_RemoveResource = NULL;
+	pWrapperTable->m_Model_DeduplicateProperties = NULL;
 	pWrapperTable->m_GetLibraryVersion = NULL;
 	pWrapperTable->m_GetPrereleaseInformation = NULL;
 	pWrapperTable->m_GetBuildInformation = NULL;
@@ -812,6 +836,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Writer_GetStrictModeActive == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetIncrementalModeActive = (PLib3MFWriter_SetIncrementalModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setincrementalmodeactive");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetIncrementalModeActive = (PLib3MFWriter_SetIncrementalModeActivePtr) dlsym(hLibrary, "lib3mf_writer_setincrementalmodeactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetIncrementalModeActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetIncrementalModeActive = (PLib3MFWriter_GetIncrementalModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_getincrementalmodeactive");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetIncrementalModeActive = (PLib3MFWriter_GetIncrementalModeActivePtr) dlsym(hLibrary, "lib3mf_writer_getincrementalmodeactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetIncrementalModeActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Writer_GetWarning = (PLib3MFWriter_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_writer_getwarning");
 	#else // _WIN32
@@ -848,6 +890,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Writer_SetContentEncryptionCallback == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetStatistics = (PLib3MFWriter_GetStatisticsPtr) GetProcAddress(hLibrary, "lib3mf_writer_getstatistics");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetStatistics = (PLib3MFWriter_GetStatisticsPtr) dlsym(hLibrary, "lib3mf_writer_getstatistics");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetStatistics == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Reader_ReadFromFile = (PLib3MFReader_ReadFromFilePtr) GetProcAddress(hLibrary, "lib3mf_reader_readfromfile");
 	#else // _WIN32
@@ -956,6 +1007,33 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_SetContentEncryptionCallback == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetInPlaceDecryptionActive = (PLib3MFReader_SetInPlaceDecryptionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setinplacedecryptionactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetInPlaceDecryptionActive = (PLib3MFReader_SetInPlaceDecryptionActivePtr) dlsym(hLibrary, "lib3mf_reader_setinplacedecryptionactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetInPlaceDecryptionActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetInPlaceDecryptionActive = (PLib3MFReader_GetInPlaceDecryptionActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getinplacedecryptionactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetInPlaceDecryptionActive = (PLib3MFReader_GetInPlaceDecryptionActivePtr) dlsym(hLibrary, "lib3mf_reader_getinplacedecryptionactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetInPlaceDecryptionActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetStatistics = (PLib3MFReader_GetStatisticsPtr) GetProcAddress(hLibrary, "lib3mf_reader_getstatistics");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetStatistics = (PLib3MFReader_GetStatisticsPtr) dlsym(hLibrary, "lib3mf_reader_getstatistics");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetStatistics == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_PackagePart_GetPath = (PLib3MFPackagePart_GetPathPtr) GetProcAddress(hLibrary, "lib3mf_packagepart_getpath");
 	#else // _WIN32
@@ -2819,6 +2897,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_ColorGroup_GetColor == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_ColorGroup_GetAllColors = (PLib3MFColorGroup_GetAllColorsPtr) GetProcAddress(hLibrary, "lib3mf_colorgroup_getallcolors");
+	#else // _WIN32
+	pWrapperTable->m_ColorGroup_GetAllColors = (PLib3MFColorGroup_GetAllColorsPtr) dlsym(hLibrary, "lib3mf_colorgroup_getallcolors");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ColorGroup_GetAllColors == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ColorGroup_SetAllColors = (PLib3MFColorGroup_SetAllColorsPtr) GetProcAddress(hLibrary, "lib3mf_colorgroup_setallcolors");
+	#else // _WIN32
+	pWrapperTable->m_ColorGroup_SetAllColors = (PLib3MFColorGroup_SetAllColorsPtr) dlsym(hLibrary, "lib3mf_colorgroup_setallcolors");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ColorGroup_SetAllColors == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Texture2DGroup_GetCount = (PLib3MFTexture2DGroup_GetCountPtr) GetProcAddress(hLibrary, "lib3mf_texture2dgroup_getcount");
 	#else // _WIN32
@@ -2873,6 +2969,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Texture2DGroup_GetTexture2D == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Texture2DGroup_GetAllTex2Coords = (PLib3MFTexture2DGroup_GetAllTex2CoordsPtr) GetProcAddress(hLibrary, "lib3mf_texture2dgroup_getalltex2coords");
+	#else // _WIN32
+	pWrapperTable->m_Texture2DGroup_GetAllTex2Coords = (PLib3MFTexture2DGroup_GetAllTex2CoordsPtr) dlsym(hLibrary, "lib3mf_texture2dgroup_getalltex2coords");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Texture2DGroup_GetAllTex2Coords == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Texture2DGroup_SetAllTex2Coords = (PLib3MFTexture2DGroup_SetAllTex2CoordsPtr) GetProcAddress(hLibrary, "lib3mf_texture2dgroup_setalltex2coords");
+	#else // _WIN32
+	pWrapperTable->m_Texture2DGroup_SetAllTex2Coords = (PLib3MFTexture2DGroup_SetAllTex2CoordsPtr) dlsym(hLibrary, "lib3mf_texture2dgroup_setalltex2coords");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Texture2DGroup_SetAllTex2Coords == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_CompositeMaterials_GetCount = (PLib3MFCompositeMaterials_GetCountPtr) GetProcAddress(hLibrary, "lib3mf_compositematerials_getcount");
 	#else // _WIN32
@@ -4952,6 +5066,69 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_BuildItemIterator_Count == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetMeshCount = (PLib3MFInstanceTable_GetMeshCountPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getmeshcount");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetMeshCount = (PLib3MFInstanceTable_GetMeshCountPtr) dlsym(hLibrary, "lib3mf_instancetable_getmeshcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetMeshCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetMeshObject = (PLib3MFInstanceTable_GetMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getmeshobject");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetMeshObject = (PLib3MFInstanceTable_GetMeshObjectPtr) dlsym(hLibrary, "lib3mf_instancetable_getmeshobject");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetMeshObject == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetMeshRange = (PLib3MFInstanceTable_GetMeshRangePtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getmeshrange");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetMeshRange = (PLib3MFInstanceTable_GetMeshRangePtr) dlsym(hLibrary, "lib3mf_instancetable_getmeshrange");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetMeshRange == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetVertices = (PLib3MFInstanceTable_GetVerticesPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getvertices");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetVertices = (PLib3MFInstanceTable_GetVerticesPtr) dlsym(hLibrary, "lib3mf_instancetable_getvertices");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetVertices == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetTriangles = (PLib3MFInstanceTable_GetTrianglesPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_gettriangles");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetTriangles = (PLib3MFInstanceTable_GetTrianglesPtr) dlsym(hLibrary, "lib3mf_instancetable_gettriangles");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetTriangles == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetInstanceCount = (PLib3MFInstanceTable_GetInstanceCountPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getinstancecount");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetInstanceCount = (PLib3MFInstanceTable_GetInstanceCountPtr) dlsym(hLibrary, "lib3mf_instancetable_getinstancecount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetInstanceCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_InstanceTable_GetInstances = (PLib3MFInstanceTable_GetInstancesPtr) GetProcAddress(hLibrary, "lib3mf_instancetable_getinstances");
+	#else // _WIN32
+	pWrapperTable->m_InstanceTable_GetInstances = (PLib3MFInstanceTable_GetInstancesPtr) dlsym(hLibrary, "lib3mf_instancetable_getinstances");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_InstanceTable_GetInstances == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Slice_SetVertices = (PLib3MFSlice_SetVerticesPtr) GetProcAddress(hLibrary, "lib3mf_slice_setvertices");
 	#else // _WIN32
@@ -5123,6 +5300,51 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_SliceStack_GetOwnPath == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_SliceStack_GetTotalSliceCount = (PLib3MFSliceStack_GetTotalSliceCountPtr) GetProcAddress(hLibrary, "lib3mf_slicestack_gettotalslicecount");
+	#else // _WIN32
+	pWrapperTable->m_SliceStack_GetTotalSliceCount = (PLib3MFSliceStack_GetTotalSliceCountPtr) dlsym(hLibrary, "lib3mf_slicestack_gettotalslicecount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_SliceStack_GetTotalSliceCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_SliceStack_GetTotalSlice = (PLib3MFSliceStack_GetTotalSlicePtr) GetProcAddress(hLibrary, "lib3mf_slicestack_gettotalslice");
+	#else // _WIN32
+	pWrapperTable->m_SliceStack_GetTotalSlice = (PLib3MFSliceStack_GetTotalSlicePtr) dlsym(hLibrary, "lib3mf_slicestack_gettotalslice");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_SliceStack_GetTotalSlice == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_SliceStack_FindSliceAtZ = (PLib3MFSliceStack_FindSliceAtZPtr) GetProcAddress(hLibrary, "lib3mf_slicestack_findsliceatz");
+	#else // _WIN32
+	pWrapperTable->m_SliceStack_FindSliceAtZ = (PLib3MFSliceStack_FindSliceAtZPtr) dlsym(hLibrary, "lib3mf_slicestack_findsliceatz");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_SliceStack_FindSliceAtZ == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_SliceStack_GetSliceRange = (PLib3MFSliceStack_GetSliceRangePtr) GetProcAddress(hLibrary, "lib3mf_slicestack_getslicerange");
+	#else // _WIN32
+	pWrapperTable->m_SliceStack_GetSliceRange = (PLib3MFSliceStack_GetSliceRangePtr) dlsym(hLibrary, "lib3mf_slicestack_getslicerange");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_SliceStack_GetSliceRange == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_SliceStack_ValidatePolygons = (PLib3MFSliceStack_ValidatePolygonsPtr) GetProcAddress(hLibrary, "lib3mf_slicestack_validatepolygons");
+	#else // _WIN32
+	pWrapperTable->m_SliceStack_ValidatePolygons = (PLib3MFSliceStack_ValidatePolygonsPtr) dlsym(hLibrary, "lib3mf_slicestack_validatepolygons");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_SliceStack_ValidatePolygons == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Consumer_GetConsumerID = (PLib3MFConsumer_GetConsumerIDPtr) GetProcAddress(hLibrary, "lib3mf_consumer_getconsumerid");
 	#else // _WIN32
@@ -5699,6 +5921,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Model_GetOutbox == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Model_GetInstanceTable = (PLib3MFModel_GetInstanceTablePtr) GetProcAddress(hLibrary, "lib3mf_model_getinstancetable");
+	#else // _WIN32
+	pWrapperTable->m_Model_GetInstanceTable = (PLib3MFModel_GetInstanceTablePtr) dlsym(hLibrary, "lib3mf_model_getinstancetable");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Model_GetInstanceTable == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Model_GetResources = (PLib3MFModel_GetResourcesPtr) GetProcAddress(hLibrary, "lib3mf_model_getresources");
 	#else // _WIN32
@@ -6131,6 +6362,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Model_RemoveResource == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Model_DeduplicateProperties = (PLib3MFModel_DeduplicatePropertiesPtr) GetProcAddress(hLibrary, "lib3mf_model_deduplicateproperties");
+	#else // _WIN32
+	pWrapperTable->m_Model_DeduplicateProperties = (PLib3MFModel_DeduplicatePropertiesPtr) dlsym(hLibrary, "lib3mf_model_deduplicateproperties");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Model_DeduplicateProperties == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_GetLibraryVersion = (PLib3MFGetLibraryVersionPtr) GetProcAddress(hLibrary, "lib3mf_getlibraryversion");
 	#else // _WIN32
@@ -6427,6 +6667,24 @@ Lib3MFResult CCall_lib3mf_writer_getstrictmodeactive(Lib3MFHandle libraryHandle,
 }
 
 
+Lib3MFResult CCall_lib3mf_writer_setincrementalmodeactive(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, bool bIncrementalModeActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetIncrementalModeActive (pWriter, bIncrementalModeActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getincrementalmodeactive(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, bool * pIncrementalModeActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetIncrementalModeActive (pWriter, pIncrementalModeActive);
+}
+
+
 Lib3MFResult CCall_lib3mf_writer_getwarning(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
 {
 	if (libraryHandle == 0) 
@@ -6463,6 +6721,15 @@ Lib3MFResult CCall_lib3mf_writer_setcontentencryptioncallback(Lib3MFHandle libra
 }
 
 
+Lib3MFResult CCall_lib3mf_writer_getstatistics(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetStatistics (pWriter, nStatisticsBufferSize, pStatisticsNeededChars, pStatisticsBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_reader_readfromfile(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, const char * pFilename)
 {
 	if (libraryHandle == 0) 
@@ -6571,6 +6838,33 @@ Lib3MFResult CCall_lib3mf_reader_setcontentencryptioncallback(Lib3MFHandle libra
 }
 
 
+Lib3MFResult CCall_lib3mf_reader_setinplacedecryptionactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool bInPlaceDecryptionActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetInPlaceDecryptionActive (pReader, bInPlaceDecryptionActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getinplacedecryptionactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool * pInPlaceDecryptionActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetInPlaceDecryptionActive (pReader, pInPlaceDecryptionActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getstatistics(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetStatistics (pReader, nStatisticsBufferSize, pStatisticsNeededChars, pStatisticsBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_packagepart_getpath(Lib3MFHandle libraryHandle, Lib3MF_PackagePart pPackagePart, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
 {
 	if (libraryHandle == 0) 
@@ -8434,6 +8728,24 @@ Lib3MFResult CCall_lib3mf_colorgroup_getcolor(Lib3MFHandle libraryHandle, Lib3MF
 }
 
 
+Lib3MFResult CCall_lib3mf_colorgroup_getallcolors(Lib3MFHandle libraryHandle, Lib3MF_ColorGroup pColorGroup, const Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, sLib3MFColor * pColorsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ColorGroup_GetAllColors (pColorGroup, nColorsBufferSize, pColorsNeededCount, pColorsBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_colorgroup_setallcolors(Lib3MFHandle libraryHandle, Lib3MF_ColorGroup pColorGroup, Lib3MF_uint64 nColorsBufferSize, const sLib3MFColor * pColorsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ColorGroup_SetAllColors (pColorGroup, nColorsBufferSize, pColorsBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_texture2dgroup_getcount(Lib3MFHandle libraryHandle, Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 * pCount)
 {
 	if (libraryHandle == 0) 
@@ -8488,6 +8800,24 @@ Lib3MFResult CCall_lib3mf_texture2dgroup_gettexture2d(Lib3MFHandle libraryHandle
 }
 
 
+Lib3MFResult CCall_lib3mf_texture2dgroup_getalltex2coords(Lib3MFHandle libraryHandle, Lib3MF_Texture2DGroup pTexture2DGroup, const Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, sLib3MFTex2Coord * pUVCoordinatesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Texture2DGroup_GetAllTex2Coords (pTexture2DGroup, nUVCoordinatesBufferSize, pUVCoordinatesNeededCount, pUVCoordinatesBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_texture2dgroup_setalltex2coords(Lib3MFHandle libraryHandle, Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint64 nUVCoordinatesBufferSize, const sLib3MFTex2Coord * pUVCoordinatesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Texture2DGroup_SetAllTex2Coords (pTexture2DGroup, nUVCoordinatesBufferSize, pUVCoordinatesBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_compositematerials_getcount(Lib3MFHandle libraryHandle, Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 * pCount)
 {
 	if (libraryHandle == 0) 
@@ -10567,6 +10897,69 @@ Lib3MFResult CCall_lib3mf_builditemiterator_count(Lib3MFHandle libraryHandle, Li
 }
 
 
+Lib3MFResult CCall_lib3mf_instancetable_getmeshcount(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetMeshCount (pInstanceTable, pCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_instancetable_getmeshobject(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_MeshObject * pMeshObject)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetMeshObject (pInstanceTable, nMeshIndex, pMeshObject);
+}
+
+
+Lib3MFResult CCall_lib3mf_instancetable_getmeshrange(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 * pVertexOffset, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pTriangleOffset, Lib3MF_uint32 * pTriangleCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetMeshRange (pInstanceTable, nMeshIndex, pVertexOffset, pVertexCount, pTriangleOffset, pTriangleCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_instancetable_getvertices(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetVertices (pInstanceTable, nVerticesBufferSize, pVerticesNeededCount, pVerticesBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_instancetable_gettriangles(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, sLib3MFTriangle * pTrianglesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetTriangles (pInstanceTable, nTrianglesBufferSize, pTrianglesNeededCount, pTrianglesBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_instancetable_getinstancecount(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetInstanceCount (pInstanceTable, pCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_instancetable_getinstances(Lib3MFHandle libraryHandle, Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, sLib3MFMeshInstance * pInstancesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_InstanceTable_GetInstances (pInstanceTable, nInstancesBufferSize, pInstancesNeededCount, pInstancesBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_slice_setvertices(Lib3MFHandle libraryHandle, Lib3MF_Slice pSlice, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition2D * pVerticesBuffer)
 {
 	if (libraryHandle == 0) 
@@ -10738,6 +11131,51 @@ Lib3MFResult CCall_lib3mf_slicestack_getownpath(Lib3MFHandle libraryHandle, Lib3
 }
 
 
+Lib3MFResult CCall_lib3mf_slicestack_gettotalslicecount(Lib3MFHandle libraryHandle, Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 * pCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_SliceStack_GetTotalSliceCount (pSliceStack, pCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_slicestack_gettotalslice(Lib3MFHandle libraryHandle, Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 nTotalSliceIndex, Lib3MF_Slice * pTheSlice)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_SliceStack_GetTotalSlice (pSliceStack, nTotalSliceIndex, pTheSlice);
+}
+
+
+Lib3MFResult CCall_lib3mf_slicestack_findsliceatz(Lib3MFHandle libraryHandle, Lib3MF_SliceStack pSliceStack, Lib3MF_double dZValue, Lib3MF_uint64 * pTotalSliceIndex, bool * pFound)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_SliceStack_FindSliceAtZ (pSliceStack, dZValue, pTotalSliceIndex, pFound);
+}
+
+
+Lib3MFResult CCall_lib3mf_slicestack_getslicerange(Lib3MFHandle libraryHandle, Lib3MF_SliceStack pSliceStack, Lib3MF_double dZMin, Lib3MF_double dZMax, Lib3MF_uint64 * pFirstIndex, Lib3MF_uint64 * pCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_SliceStack_GetSliceRange (pSliceStack, dZMin, dZMax, pFirstIndex, pCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_slicestack_validatepolygons(Lib3MFHandle libraryHandle, Lib3MF_SliceStack pSliceStack, const Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, sLib3MFSliceLayerReport * pLayerReportsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_SliceStack_ValidatePolygons (pSliceStack, nLayerReportsBufferSize, pLayerReportsNeededCount, pLayerReportsBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_consumer_getconsumerid(Lib3MFHandle libraryHandle, Lib3MF_Consumer pConsumer, const Lib3MF_uint32 nConsumerIDBufferSize, Lib3MF_uint32* pConsumerIDNeededChars, char * pConsumerIDBuffer)
 {
 	if (libraryHandle == 0) 
@@ -11314,6 +11752,15 @@ Lib3MFResult CCall_lib3mf_model_getoutbox(Lib3MFHandle libraryHandle, Lib3MF_Mod
 }
 
 
+Lib3MFResult CCall_lib3mf_model_getinstancetable(Lib3MFHandle libraryHandle, Lib3MF_Model pModel, Lib3MF_InstanceTable * pInstanceTable)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Model_GetInstanceTable (pModel, pInstanceTable);
+}
+
+
 Lib3MFResult CCall_lib3mf_model_getresources(Lib3MFHandle libraryHandle, Lib3MF_Model pModel, Lib3MF_ResourceIterator * pResourceIterator)
 {
 	if (libraryHandle == 0) 
@@ -11746,6 +12193,15 @@ Lib3MFResult CCall_lib3mf_model_removeresource(Lib3MFHandle libraryHandle, Lib3M
 }
 
 
+Lib3MFResult CCall_lib3mf_model_deduplicateproperties(Lib3MFHandle libraryHandle, Lib3MF_Model pModel, bool bRemoveUnreferenced, Lib3MF_uint32 * pRemovedCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Model_DeduplicateProperties (pModel, bRemoveUnreferenced, pRemovedCount);
+}
+
+
 Lib3MFResult CCall_lib3mf_getlibraryversion(Lib3MFHandle libraryHandle, Lib3MF_uint32 * pMajor, Lib3MF_uint32 * pMinor, Lib3MF_uint32 * pMicro)
 {
 	if (libraryHandle == 0) 
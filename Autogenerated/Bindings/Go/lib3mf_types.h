@@ -317,6 +317,7 @@ typedef Lib3MFHandle Lib3MF_ImplicitFunction;
 typedef Lib3MFHandle Lib3MF_FunctionFromImage3D;
 typedef Lib3MFHandle Lib3MF_BuildItem;
 typedef Lib3MFHandle Lib3MF_BuildItemIterator;
+typedef Lib3MFHandle Lib3MF_InstanceTable;
 typedef Lib3MFHandle Lib3MF_Slice;
 typedef Lib3MFHandle Lib3MF_SliceStack;
 typedef Lib3MFHandle Lib3MF_Consumer;
@@ -738,6 +739,21 @@ typedef struct sLib3MFBall {
     Lib3MF_double m_Radius;
 } sLib3MFBall;
 
+typedef struct sLib3MFSliceLayerReport {
+    Lib3MF_uint32 m_LayerIndex;
+    Lib3MF_uint32 m_OpenPolygons;
+    Lib3MF_uint32 m_DegeneratePolygons;
+    Lib3MF_uint32 m_SelfIntersections;
+    Lib3MF_uint32 m_OrientationErrors;
+    Lib3MF_uint32 m_MaxNestingDepth;
+} sLib3MFSliceLayerReport;
+
+typedef struct sLib3MFMeshInstance {
+    Lib3MF_uint32 m_MeshIndex;
+    Lib3MF_uint32 m_BuildItemIndex;
+    Lib3MF_single m_Transform[4][3];
+} sLib3MFMeshInstance;
+
 typedef struct sLib3MFVector {
     Lib3MF_double m_Coordinates[3];
 } sLib3MFVector;
@@ -155,6 +155,7 @@ void InitAll(v8::Local<Object> exports, v8::Local<Object> module)
 	CLib3MFFunctionFromImage3D::Init();
 	CLib3MFBuildItem::Init();
 	CLib3MFBuildItemIterator::Init();
+	CLib3MFInstanceTable::Init();
 	CLib3MFSlice::Init();
 	CLib3MFSliceStack::Init();
 	CLib3MFConsumer::Init();
@@ -148,6 +148,7 @@ Persistent<Function> CLib3MFImplicitFunction::constructor;
 Persistent<Function> CLib3MFFunctionFromImage3D::constructor;
 Persistent<Function> CLib3MFBuildItem::constructor;
 Persistent<Function> CLib3MFBuildItemIterator::constructor;
+Persistent<Function> CLib3MFInstanceTable::constructor;
 Persistent<Function> CLib3MFSlice::constructor;
 Persistent<Function> CLib3MFSliceStack::constructor;
 Persistent<Function> CLib3MFConsumer::constructor;
@@ -1493,10 +1494,13 @@ void CLib3MFWriter::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetDecimalPrecision", SetDecimalPrecision);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetStrictModeActive", SetStrictModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStrictModeActive", GetStrictModeActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetIncrementalModeActive", SetIncrementalModeActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetIncrementalModeActive", GetIncrementalModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarning", GetWarning);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarningCount", GetWarningCount);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddKeyWrappingCallback", AddKeyWrappingCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetContentEncryptionCallback", SetContentEncryptionCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStatistics", GetStatistics);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -1741,6 +1745,52 @@ void CLib3MFWriter::GetStrictModeActive(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFWriter::SetIncrementalModeActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (IncrementalModeActive)");
+        }
+        bool bIncrementalModeActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetIncrementalModeActive.");
+        if (wrapperTable->m_Writer_SetIncrementalModeActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetIncrementalModeActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetIncrementalModeActive(instanceHandle, bIncrementalModeActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetIncrementalModeActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnIncrementalModeActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetIncrementalModeActive.");
+        if (wrapperTable->m_Writer_GetIncrementalModeActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetIncrementalModeActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetIncrementalModeActive(instanceHandle, &bReturnIncrementalModeActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnIncrementalModeActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFWriter::GetWarning(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -1854,6 +1904,33 @@ void CLib3MFWriter::SetContentEncryptionCallback(const FunctionCallbackInfo<Valu
 		}
 }
 
+
+void CLib3MFWriter::GetStatistics(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int bytesNeededStatistics = 0;
+        unsigned int bytesWrittenStatistics = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetStatistics.");
+        if (wrapperTable->m_Writer_GetStatistics == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetStatistics.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult initErrorCode = wrapperTable->m_Writer_GetStatistics(instanceHandle, 0, &bytesNeededStatistics, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, initErrorCode);
+        std::vector<char> bufferStatistics;
+        bufferStatistics.resize(bytesNeededStatistics);
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetStatistics(instanceHandle, bytesNeededStatistics, &bytesWrittenStatistics, &bufferStatistics[0]);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(String::NewFromUtf8(isolate, &bufferStatistics[0]));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFReader Implementation
 **************************************************************************************************************************/
@@ -1889,6 +1966,9 @@ void CLib3MFReader::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarningCount", GetWarningCount);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddKeyWrappingCallback", AddKeyWrappingCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetContentEncryptionCallback", SetContentEncryptionCallback);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetInPlaceDecryptionActive", SetInPlaceDecryptionActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetInPlaceDecryptionActive", GetInPlaceDecryptionActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStatistics", GetStatistics);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -2234,6 +2314,79 @@ void CLib3MFReader::SetContentEncryptionCallback(const FunctionCallbackInfo<Valu
 		}
 }
 
+
+void CLib3MFReader::SetInPlaceDecryptionActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (InPlaceDecryptionActive)");
+        }
+        bool bInPlaceDecryptionActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetInPlaceDecryptionActive.");
+        if (wrapperTable->m_Reader_SetInPlaceDecryptionActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetInPlaceDecryptionActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetInPlaceDecryptionActive(instanceHandle, bInPlaceDecryptionActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetInPlaceDecryptionActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnInPlaceDecryptionActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetInPlaceDecryptionActive.");
+        if (wrapperTable->m_Reader_GetInPlaceDecryptionActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetInPlaceDecryptionActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetInPlaceDecryptionActive(instanceHandle, &bReturnInPlaceDecryptionActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnInPlaceDecryptionActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetStatistics(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int bytesNeededStatistics = 0;
+        unsigned int bytesWrittenStatistics = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetStatistics.");
+        if (wrapperTable->m_Reader_GetStatistics == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetStatistics.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult initErrorCode = wrapperTable->m_Reader_GetStatistics(instanceHandle, 0, &bytesNeededStatistics, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, initErrorCode);
+        std::vector<char> bufferStatistics;
+        bufferStatistics.resize(bytesNeededStatistics);
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetStatistics(instanceHandle, bytesNeededStatistics, &bytesWrittenStatistics, &bufferStatistics[0]);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(String::NewFromUtf8(isolate, &bufferStatistics[0]));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFPackagePart Implementation
 **************************************************************************************************************************/
@@ -9203,6 +9356,8 @@ void CLib3MFColorGroup::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "RemoveColor", RemoveColor);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetColor", SetColor);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetColor", GetColor);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetAllColors", GetAllColors);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetAllColors", SetAllColors);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -9381,6 +9536,46 @@ void CLib3MFColorGroup::GetColor(const FunctionCallbackInfo<Value>& args)
 		}
 }
 
+
+void CLib3MFColorGroup::GetAllColors(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetAllColors.");
+        if (wrapperTable->m_ColorGroup_GetAllColors == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ColorGroup::GetAllColors.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ColorGroup_GetAllColors(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFColorGroup::SetAllColors(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetAllColors.");
+        if (wrapperTable->m_ColorGroup_SetAllColors == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ColorGroup::SetAllColors.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ColorGroup_SetAllColors(instanceHandle, 0, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFTexture2DGroup Implementation
 **************************************************************************************************************************/
@@ -9410,6 +9605,8 @@ void CLib3MFTexture2DGroup::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTex2Coord", GetTex2Coord);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "RemoveTex2Coord", RemoveTex2Coord);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTexture2D", GetTexture2D);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetAllTex2Coords", GetAllTex2Coords);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetAllTex2Coords", SetAllTex2Coords);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -9583,6 +9780,46 @@ void CLib3MFTexture2DGroup::GetTexture2D(const FunctionCallbackInfo<Value>& args
 		}
 }
 
+
+void CLib3MFTexture2DGroup::GetAllTex2Coords(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetAllTex2Coords.");
+        if (wrapperTable->m_Texture2DGroup_GetAllTex2Coords == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Texture2DGroup::GetAllTex2Coords.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Texture2DGroup_GetAllTex2Coords(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFTexture2DGroup::SetAllTex2Coords(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetAllTex2Coords.");
+        if (wrapperTable->m_Texture2DGroup_SetAllTex2Coords == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Texture2DGroup::SetAllTex2Coords.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Texture2DGroup_SetAllTex2Coords(instanceHandle, 0, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFCompositeMaterials Implementation
 **************************************************************************************************************************/
@@ -20059,6 +20296,233 @@ void CLib3MFBuildItemIterator::Count(const FunctionCallbackInfo<Value>& args)
 		}
 }
 
+/*************************************************************************************************************************
+ Class CLib3MFInstanceTable Implementation
+**************************************************************************************************************************/
+
+CLib3MFInstanceTable::CLib3MFInstanceTable()
+		: CLib3MFBaseClass()
+{
+}
+
+CLib3MFInstanceTable::~CLib3MFInstanceTable()
+{
+}
+
+void CLib3MFInstanceTable::Init()
+{
+		Isolate* isolate = Isolate::GetCurrent();
+
+		// Prepare constructor template
+		Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, New);
+		tpl->SetClassName(String::NewFromUtf8(isolate, "Lib3MFInstanceTable"));
+		tpl->InstanceTemplate()->SetInternalFieldCount(NODEWRAPPER_FIELDCOUNT);
+
+		// Prototype
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetMeshCount", GetMeshCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetMeshObject", GetMeshObject);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetMeshRange", GetMeshRange);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetVertices", GetVertices);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTriangles", GetTriangles);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetInstanceCount", GetInstanceCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetInstances", GetInstances);
+		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
+
+}
+
+void CLib3MFInstanceTable::New(const FunctionCallbackInfo<Value>& args)
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+
+		if (args.IsConstructCall()) {
+				CLib3MFBaseClass * holderObj = ObjectWrap::Unwrap<CLib3MFBaseClass>(args.Holder());
+				CLib3MFInstanceTable * instancetableInstance = new CLib3MFInstanceTable();
+				instancetableInstance->Wrap(args.This());
+				args.GetReturnValue().Set(args.This());
+		} else {
+				RaiseError(isolate, "Lib3MFInstanceTable: Invalid call to Constructor");
+		}
+}
+
+Local<Object> CLib3MFInstanceTable::NewInstance(Local<Object> pParent, Lib3MFHandle pHandle)
+{
+		Isolate* isolate = Isolate::GetCurrent();
+		HandleScope scope(isolate);
+		Local<Function> cons = Local<Function>::New(isolate, constructor);
+		Local<Object> instance;
+		if (cons->NewInstance(isolate->GetCurrentContext()).ToLocal(&instance)) {
+			instance->SetInternalField(NODEWRAPPER_TABLEINDEX, External::New(isolate, CLib3MFBaseClass::getDynamicWrapperTable(pParent)));
+			instance->SetInternalField(NODEWRAPPER_HANDLEINDEX, External::New(isolate, pHandle));
+		}
+		return instance;
+}
+
+
+void CLib3MFInstanceTable::GetMeshCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetMeshCount.");
+        if (wrapperTable->m_InstanceTable_GetMeshCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetMeshCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetMeshCount(instanceHandle, &nReturnCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFInstanceTable::GetMeshObject(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (MeshIndex)");
+        }
+        unsigned int nMeshIndex = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        Lib3MFHandle hReturnMeshObject = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetMeshObject.");
+        if (wrapperTable->m_InstanceTable_GetMeshObject == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetMeshObject.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetMeshObject(instanceHandle, nMeshIndex, &hReturnMeshObject);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjMeshObject = CLib3MFMeshObject::NewInstance(args.Holder(), hReturnMeshObject);
+        args.GetReturnValue().Set(instanceObjMeshObject);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFInstanceTable::GetMeshRange(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (MeshIndex)");
+        }
+        Local<Object> outObject = Object::New(isolate);
+        unsigned int nMeshIndex = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nReturnVertexOffset = 0;
+        unsigned int nReturnVertexCount = 0;
+        unsigned int nReturnTriangleOffset = 0;
+        unsigned int nReturnTriangleCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetMeshRange.");
+        if (wrapperTable->m_InstanceTable_GetMeshRange == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetMeshRange.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetMeshRange(instanceHandle, nMeshIndex, &nReturnVertexOffset, &nReturnVertexCount, &nReturnTriangleOffset, &nReturnTriangleCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "VertexOffset"), Integer::NewFromUnsigned(isolate, nReturnVertexOffset));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "VertexCount"), Integer::NewFromUnsigned(isolate, nReturnVertexCount));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "TriangleOffset"), Integer::NewFromUnsigned(isolate, nReturnTriangleOffset));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "TriangleCount"), Integer::NewFromUnsigned(isolate, nReturnTriangleCount));
+        args.GetReturnValue().Set(outObject);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFInstanceTable::GetVertices(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetVertices.");
+        if (wrapperTable->m_InstanceTable_GetVertices == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetVertices.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetVertices(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFInstanceTable::GetTriangles(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetTriangles.");
+        if (wrapperTable->m_InstanceTable_GetTriangles == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetTriangles.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetTriangles(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFInstanceTable::GetInstanceCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetInstanceCount.");
+        if (wrapperTable->m_InstanceTable_GetInstanceCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetInstanceCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetInstanceCount(instanceHandle, &nReturnCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFInstanceTable::GetInstances(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetInstances.");
+        if (wrapperTable->m_InstanceTable_GetInstances == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method InstanceTable::GetInstances.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_InstanceTable_GetInstances(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFSlice Implementation
 **************************************************************************************************************************/
@@ -20364,6 +20828,11 @@ void CLib3MFSliceStack::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "CollapseSliceReferences", CollapseSliceReferences);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetOwnPath", SetOwnPath);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetOwnPath", GetOwnPath);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTotalSliceCount", GetTotalSliceCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTotalSlice", GetTotalSlice);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "FindSliceAtZ", FindSliceAtZ);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetSliceRange", GetSliceRange);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "ValidatePolygons", ValidatePolygons);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -20647,6 +21116,141 @@ void CLib3MFSliceStack::GetOwnPath(const FunctionCallbackInfo<Value>& args)
 		}
 }
 
+
+void CLib3MFSliceStack::GetTotalSliceCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        uint64_t nReturnCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetTotalSliceCount.");
+        if (wrapperTable->m_SliceStack_GetTotalSliceCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method SliceStack::GetTotalSliceCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_SliceStack_GetTotalSliceCount(instanceHandle, &nReturnCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(String::NewFromUtf8(isolate, std::to_string(nReturnCount).c_str()));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFSliceStack::GetTotalSlice(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected uint64 parameter 0 (TotalSliceIndex)");
+        }
+        v8::String::Utf8Value sutf8TotalSliceIndex(isolate, args[0]);
+        std::string sTotalSliceIndex = *sutf8TotalSliceIndex;
+        uint64_t nTotalSliceIndex = stoull(sTotalSliceIndex);
+        Lib3MFHandle hReturnTheSlice = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetTotalSlice.");
+        if (wrapperTable->m_SliceStack_GetTotalSlice == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method SliceStack::GetTotalSlice.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_SliceStack_GetTotalSlice(instanceHandle, nTotalSliceIndex, &hReturnTheSlice);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjTheSlice = CLib3MFSlice::NewInstance(args.Holder(), hReturnTheSlice);
+        args.GetReturnValue().Set(instanceObjTheSlice);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFSliceStack::FindSliceAtZ(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsNumber()) {
+            throw std::runtime_error("Expected double parameter 0 (ZValue)");
+        }
+        Local<Object> outObject = Object::New(isolate);
+        double dZValue = (double) args[0]->NumberValue(isolate->GetCurrentContext()).ToChecked();
+        uint64_t nReturnTotalSliceIndex = 0;
+        bool bReturnFound = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method FindSliceAtZ.");
+        if (wrapperTable->m_SliceStack_FindSliceAtZ == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method SliceStack::FindSliceAtZ.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_SliceStack_FindSliceAtZ(instanceHandle, dZValue, &nReturnTotalSliceIndex, &bReturnFound);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "TotalSliceIndex"), String::NewFromUtf8(isolate, std::to_string(nReturnTotalSliceIndex).c_str()));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "Found"), Boolean::New(isolate, bReturnFound));
+        args.GetReturnValue().Set(outObject);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFSliceStack::GetSliceRange(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsNumber()) {
+            throw std::runtime_error("Expected double parameter 0 (ZMin)");
+        }
+        if (!args[1]->IsNumber()) {
+            throw std::runtime_error("Expected double parameter 1 (ZMax)");
+        }
+        Local<Object> outObject = Object::New(isolate);
+        double dZMin = (double) args[0]->NumberValue(isolate->GetCurrentContext()).ToChecked();
+        double dZMax = (double) args[1]->NumberValue(isolate->GetCurrentContext()).ToChecked();
+        uint64_t nReturnFirstIndex = 0;
+        uint64_t nReturnCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetSliceRange.");
+        if (wrapperTable->m_SliceStack_GetSliceRange == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method SliceStack::GetSliceRange.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_SliceStack_GetSliceRange(instanceHandle, dZMin, dZMax, &nReturnFirstIndex, &nReturnCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "FirstIndex"), String::NewFromUtf8(isolate, std::to_string(nReturnFirstIndex).c_str()));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "Count"), String::NewFromUtf8(isolate, std::to_string(nReturnCount).c_str()));
+        args.GetReturnValue().Set(outObject);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFSliceStack::ValidatePolygons(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method ValidatePolygons.");
+        if (wrapperTable->m_SliceStack_ValidatePolygons == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method SliceStack::ValidatePolygons.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_SliceStack_ValidatePolygons(instanceHandle, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFConsumer Implementation
 **************************************************************************************************************************/
@@ -22112,6 +22716,7 @@ void CLib3MFModel::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetBuildUUID", SetBuildUUID);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetBuildItems", GetBuildItems);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetOutbox", GetOutbox);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetInstanceTable", GetInstanceTable);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetResources", GetResources);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetObjects", GetObjects);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetMeshObjects", GetMeshObjects);
@@ -22160,6 +22765,7 @@ void CLib3MFModel::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddLevelSet", AddLevelSet);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetLevelSets", GetLevelSets);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "RemoveResource", RemoveResource);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "DeduplicateProperties", DeduplicateProperties);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -22822,6 +23428,29 @@ void CLib3MFModel::GetOutbox(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFModel::GetInstanceTable(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        Lib3MFHandle hReturnInstanceTable = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetInstanceTable.");
+        if (wrapperTable->m_Model_GetInstanceTable == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Model::GetInstanceTable.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Model_GetInstanceTable(instanceHandle, &hReturnInstanceTable);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjInstanceTable = CLib3MFInstanceTable::NewInstance(args.Holder(), hReturnInstanceTable);
+        args.GetReturnValue().Set(instanceObjInstanceTable);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFModel::GetResources(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -24035,6 +24664,32 @@ void CLib3MFModel::RemoveResource(const FunctionCallbackInfo<Value>& args)
 		}
 }
 
+
+void CLib3MFModel::DeduplicateProperties(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (RemoveUnreferenced)");
+        }
+        bool bRemoveUnreferenced = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nReturnRemovedCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method DeduplicateProperties.");
+        if (wrapperTable->m_Model_DeduplicateProperties == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Model::DeduplicateProperties.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Model_DeduplicateProperties(instanceHandle, bRemoveUnreferenced, &nReturnRemovedCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnRemovedCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFWrapper Implementation
 **************************************************************************************************************************/
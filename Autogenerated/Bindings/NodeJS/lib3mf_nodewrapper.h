@@ -103,10 +103,13 @@ private:
 	static void SetDecimalPrecision(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetIncrementalModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetIncrementalModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarning(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarningCount(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddKeyWrappingCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetContentEncryptionCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetStatistics(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFWriter();
@@ -136,6 +139,9 @@ private:
 	static void GetWarningCount(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddKeyWrappingCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetContentEncryptionCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetInPlaceDecryptionActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetInPlaceDecryptionActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetStatistics(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFReader();
@@ -921,6 +927,8 @@ private:
 	static void RemoveColor(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetColor(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetColor(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetAllColors(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetAllColors(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFColorGroup();
@@ -944,6 +952,8 @@ private:
 	static void GetTex2Coord(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void RemoveTex2Coord(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetTexture2D(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetAllTex2Coords(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetAllTex2Coords(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFTexture2DGroup();
@@ -2358,6 +2368,30 @@ public:
 	
 };
 
+/*************************************************************************************************************************
+ Class CLib3MFInstanceTable 
+**************************************************************************************************************************/
+class CLib3MFInstanceTable : public CLib3MFBaseClass {
+private:
+	static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static v8::Persistent<v8::Function> constructor;
+	static void GetMeshCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetMeshObject(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetMeshRange(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetVertices(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetTriangles(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetInstanceCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetInstances(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+public:
+	CLib3MFInstanceTable();
+	~CLib3MFInstanceTable();
+	
+	static void Init();
+	static v8::Local<v8::Object> NewInstance(v8::Local<v8::Object>, Lib3MFHandle pHandle);
+	
+};
+
 /*************************************************************************************************************************
  Class CLib3MFSlice 
 **************************************************************************************************************************/
@@ -2401,6 +2435,11 @@ private:
 	static void CollapseSliceReferences(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetOwnPath(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetOwnPath(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetTotalSliceCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetTotalSlice(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void FindSliceAtZ(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetSliceRange(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void ValidatePolygons(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFSliceStack();
@@ -2584,6 +2623,7 @@ private:
 	static void SetBuildUUID(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetBuildItems(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetOutbox(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetInstanceTable(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetResources(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetObjects(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetMeshObjects(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -2632,6 +2672,7 @@ private:
 	static void AddLevelSet(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetLevelSets(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void RemoveResource(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void DeduplicateProperties(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFModel();
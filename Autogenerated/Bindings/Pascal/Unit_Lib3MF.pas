@@ -425,6 +425,23 @@ type
 		FRadius: Double;
 	end;
 
+	PLib3MFSliceLayerReport = ^TLib3MFSliceLayerReport;
+	TLib3MFSliceLayerReport = packed record
+		FLayerIndex: Cardinal;
+		FOpenPolygons: Cardinal;
+		FDegeneratePolygons: Cardinal;
+		FSelfIntersections: Cardinal;
+		FOrientationErrors: Cardinal;
+		FMaxNestingDepth: Cardinal;
+	end;
+
+	PLib3MFMeshInstance = ^TLib3MFMeshInstance;
+	TLib3MFMeshInstance = packed record
+		FMeshIndex: Cardinal;
+		FBuildItemIndex: Cardinal;
+		FTransform: array [0..3, 0..2] of Single;
+	end;
+
 	PLib3MFVector = ^TLib3MFVector;
 	TLib3MFVector = packed record
 		FCoordinates: array [0..2] of Double;
@@ -452,6 +469,8 @@ type
 	ArrayOfLib3MFColor = array of TLib3MFColor;
 	ArrayOfLib3MFBeam = array of TLib3MFBeam;
 	ArrayOfLib3MFBall = array of TLib3MFBall;
+	ArrayOfLib3MFSliceLayerReport = array of TLib3MFSliceLayerReport;
+	ArrayOfLib3MFMeshInstance = array of TLib3MFMeshInstance;
 	ArrayOfLib3MFVector = array of TLib3MFVector;
 	ArrayOfLib3MFMatrix4x4 = array of TLib3MFMatrix4x4;
 
@@ -582,6 +601,7 @@ type
 	TLib3MFFunctionFromImage3D = class;
 	TLib3MFBuildItem = class;
 	TLib3MFBuildItemIterator = class;
+	TLib3MFInstanceTable = class;
 	TLib3MFSlice = class;
 	TLib3MFSliceStack = class;
 	TLib3MFConsumer = class;
@@ -697,6 +717,24 @@ type
 	*)
 	TLib3MFWriter_GetStrictModeActiveFunc = function(pWriter: TLib3MFHandle; out pStrictModeActive: Byte): TLib3MFResult; cdecl;
 	
+	(**
+	* Activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] bIncrementalModeActive - flag whether incremental mode is active or not.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetIncrementalModeActiveFunc = function(pWriter: TLib3MFHandle; const bIncrementalModeActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries whether the incremental mode of the writer is active or not
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pIncrementalModeActive - returns flag whether incremental mode is active or not.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetIncrementalModeActiveFunc = function(pWriter: TLib3MFHandle; out pIncrementalModeActive: Byte): TLib3MFResult; cdecl;
+	
 	(**
 	* Returns Warning and Error Information of the read process
 	*
@@ -740,6 +778,17 @@ type
 	*)
 	TLib3MFWriter_SetContentEncryptionCallbackFunc = function(pWriter: TLib3MFHandle; const pTheCallback: PLib3MF_ContentEncryptionCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nStatisticsBufferSize - size of the buffer (including trailing 0)
+	* @param[out] pStatisticsNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+	* @param[out] pStatisticsBuffer -  buffer of JSON document with the collected statistics, may be NULL
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetStatisticsFunc = function(pWriter: TLib3MFHandle; const nStatisticsBufferSize: Cardinal; out pStatisticsNeededChars: Cardinal; pStatisticsBuffer: PAnsiChar): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for Reader
@@ -865,6 +914,35 @@ type
 	*)
 	TLib3MFReader_SetContentEncryptionCallbackFunc = function(pReader: TLib3MFHandle; const pTheCallback: PLib3MF_ContentEncryptionCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
 	
+	(**
+	* Activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] bInPlaceDecryptionActive - flag whether in-place decryption is active or not.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetInPlaceDecryptionActiveFunc = function(pReader: TLib3MFHandle; const bInPlaceDecryptionActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries whether in-place decryption of the reader is active or not
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pInPlaceDecryptionActive - returns flag whether in-place decryption is active or not.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetInPlaceDecryptionActiveFunc = function(pReader: TLib3MFHandle; out pInPlaceDecryptionActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] nStatisticsBufferSize - size of the buffer (including trailing 0)
+	* @param[out] pStatisticsNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+	* @param[out] pStatisticsBuffer -  buffer of JSON document with the collected statistics, may be NULL
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetStatisticsFunc = function(pReader: TLib3MFHandle; const nStatisticsBufferSize: Cardinal; out pStatisticsNeededChars: Cardinal; pStatisticsBuffer: PAnsiChar): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for PackagePart
@@ -3016,6 +3094,27 @@ type
 	*)
 	TLib3MFColorGroup_GetColorFunc = function(pColorGroup: TLib3MFHandle; const nPropertyID: Cardinal; pTheColor: PLib3MFColor): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns all colors of this group in the order of GetAllPropertyIDs.
+	*
+	* @param[in] pColorGroup - ColorGroup instance.
+	* @param[in] nColorsCount - Number of elements in buffer
+	* @param[out] pColorsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pColorsBuffer - Color buffer of contains the colors of the group.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFColorGroup_GetAllColorsFunc = function(pColorGroup: TLib3MFHandle; const nColorsCount: QWord; out pColorsNeededCount: QWord; pColorsBuffer: PLib3MFColor): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets all colors of this group in the order of GetAllPropertyIDs.
+	*
+	* @param[in] pColorGroup - ColorGroup instance.
+	* @param[in] nColorsCount - Number of elements in buffer
+	* @param[in] pColorsBuffer - Color buffer of contains the new colors. Must have GetCount elements.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFColorGroup_SetAllColorsFunc = function(pColorGroup: TLib3MFHandle; const nColorsCount: QWord; const pColorsBuffer: PLib3MFColor): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for Texture2DGroup
@@ -3079,6 +3178,27 @@ type
 	*)
 	TLib3MFTexture2DGroup_GetTexture2DFunc = function(pTexture2DGroup: TLib3MFHandle; out pTexture2DInstance: TLib3MFHandle): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns all tex2coords of this group in the order of GetAllPropertyIDs.
+	*
+	* @param[in] pTexture2DGroup - Texture2DGroup instance.
+	* @param[in] nUVCoordinatesCount - Number of elements in buffer
+	* @param[out] pUVCoordinatesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pUVCoordinatesBuffer - Tex2Coord buffer of contains the u/v-coordinates of the group.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFTexture2DGroup_GetAllTex2CoordsFunc = function(pTexture2DGroup: TLib3MFHandle; const nUVCoordinatesCount: QWord; out pUVCoordinatesNeededCount: QWord; pUVCoordinatesBuffer: PLib3MFTex2Coord): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets all tex2coords of this group in the order of GetAllPropertyIDs.
+	*
+	* @param[in] pTexture2DGroup - Texture2DGroup instance.
+	* @param[in] nUVCoordinatesCount - Number of elements in buffer
+	* @param[in] pUVCoordinatesBuffer - Tex2Coord buffer of contains the new u/v-coordinates. Must have GetCount elements.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFTexture2DGroup_SetAllTex2CoordsFunc = function(pTexture2DGroup: TLib3MFHandle; const nUVCoordinatesCount: QWord; const pUVCoordinatesBuffer: PLib3MFTex2Coord): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for CompositeMaterials
@@ -5769,6 +5889,85 @@ type
 	TLib3MFBuildItemIterator_CountFunc = function(pBuildItemIterator: TLib3MFHandle; out pCount: QWord): TLib3MFResult; cdecl;
 	
 
+(*************************************************************************************************************************
+ Function type definitions for InstanceTable
+**************************************************************************************************************************)
+
+	(**
+	* Returns the number of unique mesh objects referenced by the build items.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[out] pCount - the number of unique mesh objects
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetMeshCountFunc = function(pInstanceTable: TLib3MFHandle; out pCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns a unique mesh object of the table.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @param[out] pMeshObject - the mesh object
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetMeshObjectFunc = function(pInstanceTable: TLib3MFHandle; const nMeshIndex: Cardinal; out pMeshObject: TLib3MFHandle): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the location of a unique mesh object within the packed vertex and triangle buffers.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @param[out] pVertexOffset - index of the first vertex of the mesh object in the vertex buffer
+	* @param[out] pVertexCount - number of vertices of the mesh object
+	* @param[out] pTriangleOffset - index of the first triangle of the mesh object in the triangle buffer
+	* @param[out] pTriangleCount - number of triangles of the mesh object
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetMeshRangeFunc = function(pInstanceTable: TLib3MFHandle; const nMeshIndex: Cardinal; out pVertexOffset: Cardinal; out pVertexCount: Cardinal; out pTriangleOffset: Cardinal; out pTriangleCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the vertices of all unique mesh objects, packed in mesh order.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[in] nVerticesCount - Number of elements in buffer
+	* @param[out] pVerticesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pVerticesBuffer - Position buffer of the packed vertex positions
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetVerticesFunc = function(pInstanceTable: TLib3MFHandle; const nVerticesCount: QWord; out pVerticesNeededCount: QWord; pVerticesBuffer: PLib3MFPosition): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[in] nTrianglesCount - Number of elements in buffer
+	* @param[out] pTrianglesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pTrianglesBuffer - Triangle buffer of the packed triangles
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetTrianglesFunc = function(pInstanceTable: TLib3MFHandle; const nTrianglesCount: QWord; out pTrianglesNeededCount: QWord; pTrianglesBuffer: PLib3MFTriangle): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of mesh instances placed by the build items.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[out] pCount - the number of mesh instances
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetInstanceCountFunc = function(pInstanceTable: TLib3MFHandle; out pCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns all mesh instances placed by the build items, in build item order.
+	*
+	* @param[in] pInstanceTable - InstanceTable instance.
+	* @param[in] nInstancesCount - Number of elements in buffer
+	* @param[out] pInstancesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pInstancesBuffer - MeshInstance buffer of the mesh instances with their accumulated transforms
+	* @return error code or 0 (success)
+	*)
+	TLib3MFInstanceTable_GetInstancesFunc = function(pInstanceTable: TLib3MFHandle; const nInstancesCount: QWord; out pInstancesNeededCount: QWord; pInstancesBuffer: PLib3MFMeshInstance): TLib3MFResult; cdecl;
+	
+
 (*************************************************************************************************************************
  Function type definitions for Slice
 **************************************************************************************************************************)
@@ -5964,6 +6163,59 @@ type
 	*)
 	TLib3MFSliceStack_GetOwnPathFunc = function(pSliceStack: TLib3MFHandle; const nPathBufferSize: Cardinal; out pPathNeededChars: Cardinal; pPathBuffer: PAnsiChar): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+	*
+	* @param[in] pSliceStack - SliceStack instance.
+	* @param[out] pCount - the number of slices in the slice view
+	* @return error code or 0 (success)
+	*)
+	TLib3MFSliceStack_GetTotalSliceCountFunc = function(pSliceStack: TLib3MFHandle; out pCount: QWord): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries a slice from the slice view of this slice stack without collapsing its slice refs.
+	*
+	* @param[in] pSliceStack - SliceStack instance.
+	* @param[in] nTotalSliceIndex - the index of the slice in the slice view
+	* @param[out] pTheSlice - the Slice instance
+	* @return error code or 0 (success)
+	*)
+	TLib3MFSliceStack_GetTotalSliceFunc = function(pSliceStack: TLib3MFHandle; const nTotalSliceIndex: QWord; out pTheSlice: TLib3MFHandle): TLib3MFResult; cdecl;
+	
+	(**
+	* Finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+	*
+	* @param[in] pSliceStack - SliceStack instance.
+	* @param[in] dZValue - the Z-coordinate to look up
+	* @param[out] pTotalSliceIndex - the index of the slice in the slice view, if one was found
+	* @param[out] pFound - true, if a slice contains the Z-coordinate
+	* @return error code or 0 (success)
+	*)
+	TLib3MFSliceStack_FindSliceAtZFunc = function(pSliceStack: TLib3MFHandle; const dZValue: Double; out pTotalSliceIndex: QWord; out pFound: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the range of slices of the slice view that intersect a Z-interval.
+	*
+	* @param[in] pSliceStack - SliceStack instance.
+	* @param[in] dZMin - the lower Z-coordinate of the interval
+	* @param[in] dZMax - the upper Z-coordinate of the interval
+	* @param[out] pFirstIndex - the index of the first slice in the slice view that intersects the interval
+	* @param[out] pCount - the number of slices that intersect the interval
+	* @return error code or 0 (success)
+	*)
+	TLib3MFSliceStack_GetSliceRangeFunc = function(pSliceStack: TLib3MFHandle; const dZMin: Double; const dZMax: Double; out pFirstIndex: QWord; out pCount: QWord): TLib3MFResult; cdecl;
+	
+	(**
+	* Validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+	*
+	* @param[in] pSliceStack - SliceStack instance.
+	* @param[in] nLayerReportsCount - Number of elements in buffer
+	* @param[out] pLayerReportsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pLayerReportsBuffer - SliceLayerReport buffer of the reports of the layers with issues, in ascending layer order
+	* @return error code or 0 (success)
+	*)
+	TLib3MFSliceStack_ValidatePolygonsFunc = function(pSliceStack: TLib3MFHandle; const nLayerReportsCount: QWord; out pLayerReportsNeededCount: QWord; pLayerReportsBuffer: PLib3MFSliceLayerReport): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for Consumer
@@ -6639,6 +6891,15 @@ type
 	*)
 	TLib3MFModel_GetOutboxFunc = function(pModel: TLib3MFHandle; pOutbox: PLib3MFBox): TLib3MFResult; cdecl;
 	
+	(**
+	* Flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+	*
+	* @param[in] pModel - Model instance.
+	* @param[out] pInstanceTable - the instance table of the current build
+	* @return error code or 0 (success)
+	*)
+	TLib3MFModel_GetInstanceTableFunc = function(pModel: TLib3MFHandle; out pInstanceTable: TLib3MFHandle): TLib3MFResult; cdecl;
+	
 	(**
 	* creates a resource iterator instance with all resources.
 	*
@@ -7087,6 +7348,16 @@ type
 	*)
 	TLib3MFModel_RemoveResourceFunc = function(pModel: TLib3MFHandle; const pResource: TLib3MFHandle): TLib3MFResult; cdecl;
 	
+	(**
+	* Merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+	*
+	* @param[in] pModel - Model instance.
+	* @param[in] bRemoveUnreferenced - If true, entries that are not referenced by any triangle or multiproperty are removed as well. Groups that are not referenced at all are left untouched.
+	* @param[out] pRemovedCount - Number of removed entries.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFModel_DeduplicatePropertiesFunc = function(pModel: TLib3MFHandle; const bRemoveUnreferenced: Byte; out pRemovedCount: Cardinal): TLib3MFResult; cdecl;
+	
 (*************************************************************************************************************************
  Global function definitions 
 **************************************************************************************************************************)
@@ -7340,10 +7611,13 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure SetDecimalPrecision(const ADecimalPrecision: Cardinal);
 		procedure SetStrictModeActive(const AStrictModeActive: Boolean);
 		function GetStrictModeActive(): Boolean;
+		procedure SetIncrementalModeActive(const AIncrementalModeActive: Boolean);
+		function GetIncrementalModeActive(): Boolean;
 		function GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 		function GetWarningCount(): Cardinal;
 		procedure AddKeyWrappingCallback(const AConsumerID: String; const ATheCallback: PLib3MF_KeyWrappingCallback; const AUserData: Pointer);
 		procedure SetContentEncryptionCallback(const ATheCallback: PLib3MF_ContentEncryptionCallback; const AUserData: Pointer);
+		function GetStatistics(): String;
 	end;
 
 
@@ -7367,6 +7641,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		function GetWarningCount(): Cardinal;
 		procedure AddKeyWrappingCallback(const AConsumerID: String; const ATheCallback: PLib3MF_KeyWrappingCallback; const AUserData: Pointer);
 		procedure SetContentEncryptionCallback(const ATheCallback: PLib3MF_ContentEncryptionCallback; const AUserData: Pointer);
+		procedure SetInPlaceDecryptionActive(const AInPlaceDecryptionActive: Boolean);
+		function GetInPlaceDecryptionActive(): Boolean;
+		function GetStatistics(): String;
 	end;
 
 
@@ -7948,6 +8225,8 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure RemoveColor(const APropertyID: Cardinal);
 		procedure SetColor(const APropertyID: Cardinal; const ATheColor: TLib3MFColor);
 		function GetColor(const APropertyID: Cardinal): TLib3MFColor;
+		procedure GetAllColors(out AColors: ArrayOfLib3MFColor);
+		procedure SetAllColors(const AColors: ArrayOfLib3MFColor);
 	end;
 
 
@@ -7965,6 +8244,8 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		function GetTex2Coord(const APropertyID: Cardinal): TLib3MFTex2Coord;
 		procedure RemoveTex2Coord(const APropertyID: Cardinal);
 		function GetTexture2D(): TLib3MFTexture2D;
+		procedure GetAllTex2Coords(out AUVCoordinates: ArrayOfLib3MFTex2Coord);
+		procedure SetAllTex2Coords(const AUVCoordinates: ArrayOfLib3MFTex2Coord);
 	end;
 
 
@@ -8958,6 +9239,24 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 	end;
 
 
+(*************************************************************************************************************************
+ Class definition for InstanceTable
+**************************************************************************************************************************)
+
+	TLib3MFInstanceTable = class(TLib3MFBase)
+	public
+		constructor Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+		destructor Destroy; override;
+		function GetMeshCount(): Cardinal;
+		function GetMeshObject(const AMeshIndex: Cardinal): TLib3MFMeshObject;
+		procedure GetMeshRange(const AMeshIndex: Cardinal; out AVertexOffset: Cardinal; out AVertexCount: Cardinal; out ATriangleOffset: Cardinal; out ATriangleCount: Cardinal);
+		procedure GetVertices(out AVertices: ArrayOfLib3MFPosition);
+		procedure GetTriangles(out ATriangles: ArrayOfLib3MFTriangle);
+		function GetInstanceCount(): Cardinal;
+		procedure GetInstances(out AInstances: ArrayOfLib3MFMeshInstance);
+	end;
+
+
 (*************************************************************************************************************************
  Class definition for Slice
 **************************************************************************************************************************)
@@ -8996,6 +9295,11 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure CollapseSliceReferences();
 		procedure SetOwnPath(const APath: String);
 		function GetOwnPath(): String;
+		function GetTotalSliceCount(): QWord;
+		function GetTotalSlice(const ATotalSliceIndex: QWord): TLib3MFSlice;
+		function FindSliceAtZ(const AZValue: Double; out ATotalSliceIndex: QWord): Boolean;
+		procedure GetSliceRange(const AZMin: Double; const AZMax: Double; out AFirstIndex: QWord; out ACount: QWord);
+		procedure ValidatePolygons(out ALayerReports: ArrayOfLib3MFSliceLayerReport);
 	end;
 
 
@@ -9137,6 +9441,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure SetBuildUUID(const AUUID: String);
 		function GetBuildItems(): TLib3MFBuildItemIterator;
 		function GetOutbox(): TLib3MFBox;
+		function GetInstanceTable(): TLib3MFInstanceTable;
 		function GetResources(): TLib3MFResourceIterator;
 		function GetObjects(): TLib3MFObjectIterator;
 		function GetMeshObjects(): TLib3MFMeshObjectIterator;
@@ -9185,6 +9490,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		function AddLevelSet(): TLib3MFLevelSet;
 		function GetLevelSets(): TLib3MFLevelSetIterator;
 		procedure RemoveResource(const AResource: TLib3MFResource);
+		function DeduplicateProperties(const ARemoveUnreferenced: Boolean): Cardinal;
 	end;
 
 (*************************************************************************************************************************
@@ -9204,10 +9510,13 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFWriter_SetDecimalPrecisionFunc: TLib3MFWriter_SetDecimalPrecisionFunc;
 		FLib3MFWriter_SetStrictModeActiveFunc: TLib3MFWriter_SetStrictModeActiveFunc;
 		FLib3MFWriter_GetStrictModeActiveFunc: TLib3MFWriter_GetStrictModeActiveFunc;
+		FLib3MFWriter_SetIncrementalModeActiveFunc: TLib3MFWriter_SetIncrementalModeActiveFunc;
+		FLib3MFWriter_GetIncrementalModeActiveFunc: TLib3MFWriter_GetIncrementalModeActiveFunc;
 		FLib3MFWriter_GetWarningFunc: TLib3MFWriter_GetWarningFunc;
 		FLib3MFWriter_GetWarningCountFunc: TLib3MFWriter_GetWarningCountFunc;
 		FLib3MFWriter_AddKeyWrappingCallbackFunc: TLib3MFWriter_AddKeyWrappingCallbackFunc;
 		FLib3MFWriter_SetContentEncryptionCallbackFunc: TLib3MFWriter_SetContentEncryptionCallbackFunc;
+		FLib3MFWriter_GetStatisticsFunc: TLib3MFWriter_GetStatisticsFunc;
 		FLib3MFReader_ReadFromFileFunc: TLib3MFReader_ReadFromFileFunc;
 		FLib3MFReader_ReadFromBufferFunc: TLib3MFReader_ReadFromBufferFunc;
 		FLib3MFReader_ReadFromCallbackFunc: TLib3MFReader_ReadFromCallbackFunc;
@@ -9220,6 +9529,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFReader_GetWarningCountFunc: TLib3MFReader_GetWarningCountFunc;
 		FLib3MFReader_AddKeyWrappingCallbackFunc: TLib3MFReader_AddKeyWrappingCallbackFunc;
 		FLib3MFReader_SetContentEncryptionCallbackFunc: TLib3MFReader_SetContentEncryptionCallbackFunc;
+		FLib3MFReader_SetInPlaceDecryptionActiveFunc: TLib3MFReader_SetInPlaceDecryptionActiveFunc;
+		FLib3MFReader_GetInPlaceDecryptionActiveFunc: TLib3MFReader_GetInPlaceDecryptionActiveFunc;
+		FLib3MFReader_GetStatisticsFunc: TLib3MFReader_GetStatisticsFunc;
 		FLib3MFPackagePart_GetPathFunc: TLib3MFPackagePart_GetPathFunc;
 		FLib3MFPackagePart_SetPathFunc: TLib3MFPackagePart_SetPathFunc;
 		FLib3MFResource_GetResourceIDFunc: TLib3MFResource_GetResourceIDFunc;
@@ -9427,12 +9739,16 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFColorGroup_RemoveColorFunc: TLib3MFColorGroup_RemoveColorFunc;
 		FLib3MFColorGroup_SetColorFunc: TLib3MFColorGroup_SetColorFunc;
 		FLib3MFColorGroup_GetColorFunc: TLib3MFColorGroup_GetColorFunc;
+		FLib3MFColorGroup_GetAllColorsFunc: TLib3MFColorGroup_GetAllColorsFunc;
+		FLib3MFColorGroup_SetAllColorsFunc: TLib3MFColorGroup_SetAllColorsFunc;
 		FLib3MFTexture2DGroup_GetCountFunc: TLib3MFTexture2DGroup_GetCountFunc;
 		FLib3MFTexture2DGroup_GetAllPropertyIDsFunc: TLib3MFTexture2DGroup_GetAllPropertyIDsFunc;
 		FLib3MFTexture2DGroup_AddTex2CoordFunc: TLib3MFTexture2DGroup_AddTex2CoordFunc;
 		FLib3MFTexture2DGroup_GetTex2CoordFunc: TLib3MFTexture2DGroup_GetTex2CoordFunc;
 		FLib3MFTexture2DGroup_RemoveTex2CoordFunc: TLib3MFTexture2DGroup_RemoveTex2CoordFunc;
 		FLib3MFTexture2DGroup_GetTexture2DFunc: TLib3MFTexture2DGroup_GetTexture2DFunc;
+		FLib3MFTexture2DGroup_GetAllTex2CoordsFunc: TLib3MFTexture2DGroup_GetAllTex2CoordsFunc;
+		FLib3MFTexture2DGroup_SetAllTex2CoordsFunc: TLib3MFTexture2DGroup_SetAllTex2CoordsFunc;
 		FLib3MFCompositeMaterials_GetCountFunc: TLib3MFCompositeMaterials_GetCountFunc;
 		FLib3MFCompositeMaterials_GetAllPropertyIDsFunc: TLib3MFCompositeMaterials_GetAllPropertyIDsFunc;
 		FLib3MFCompositeMaterials_GetBaseMaterialGroupFunc: TLib3MFCompositeMaterials_GetBaseMaterialGroupFunc;
@@ -9664,6 +9980,13 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFBuildItemIterator_GetCurrentFunc: TLib3MFBuildItemIterator_GetCurrentFunc;
 		FLib3MFBuildItemIterator_CloneFunc: TLib3MFBuildItemIterator_CloneFunc;
 		FLib3MFBuildItemIterator_CountFunc: TLib3MFBuildItemIterator_CountFunc;
+		FLib3MFInstanceTable_GetMeshCountFunc: TLib3MFInstanceTable_GetMeshCountFunc;
+		FLib3MFInstanceTable_GetMeshObjectFunc: TLib3MFInstanceTable_GetMeshObjectFunc;
+		FLib3MFInstanceTable_GetMeshRangeFunc: TLib3MFInstanceTable_GetMeshRangeFunc;
+		FLib3MFInstanceTable_GetVerticesFunc: TLib3MFInstanceTable_GetVerticesFunc;
+		FLib3MFInstanceTable_GetTrianglesFunc: TLib3MFInstanceTable_GetTrianglesFunc;
+		FLib3MFInstanceTable_GetInstanceCountFunc: TLib3MFInstanceTable_GetInstanceCountFunc;
+		FLib3MFInstanceTable_GetInstancesFunc: TLib3MFInstanceTable_GetInstancesFunc;
 		FLib3MFSlice_SetVerticesFunc: TLib3MFSlice_SetVerticesFunc;
 		FLib3MFSlice_GetVerticesFunc: TLib3MFSlice_GetVerticesFunc;
 		FLib3MFSlice_GetVertexCountFunc: TLib3MFSlice_GetVertexCountFunc;
@@ -9683,6 +10006,11 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFSliceStack_CollapseSliceReferencesFunc: TLib3MFSliceStack_CollapseSliceReferencesFunc;
 		FLib3MFSliceStack_SetOwnPathFunc: TLib3MFSliceStack_SetOwnPathFunc;
 		FLib3MFSliceStack_GetOwnPathFunc: TLib3MFSliceStack_GetOwnPathFunc;
+		FLib3MFSliceStack_GetTotalSliceCountFunc: TLib3MFSliceStack_GetTotalSliceCountFunc;
+		FLib3MFSliceStack_GetTotalSliceFunc: TLib3MFSliceStack_GetTotalSliceFunc;
+		FLib3MFSliceStack_FindSliceAtZFunc: TLib3MFSliceStack_FindSliceAtZFunc;
+		FLib3MFSliceStack_GetSliceRangeFunc: TLib3MFSliceStack_GetSliceRangeFunc;
+		FLib3MFSliceStack_ValidatePolygonsFunc: TLib3MFSliceStack_ValidatePolygonsFunc;
 		FLib3MFConsumer_GetConsumerIDFunc: TLib3MFConsumer_GetConsumerIDFunc;
 		FLib3MFConsumer_GetKeyIDFunc: TLib3MFConsumer_GetKeyIDFunc;
 		FLib3MFConsumer_GetKeyValueFunc: TLib3MFConsumer_GetKeyValueFunc;
@@ -9747,6 +10075,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFModel_SetBuildUUIDFunc: TLib3MFModel_SetBuildUUIDFunc;
 		FLib3MFModel_GetBuildItemsFunc: TLib3MFModel_GetBuildItemsFunc;
 		FLib3MFModel_GetOutboxFunc: TLib3MFModel_GetOutboxFunc;
+		FLib3MFModel_GetInstanceTableFunc: TLib3MFModel_GetInstanceTableFunc;
 		FLib3MFModel_GetResourcesFunc: TLib3MFModel_GetResourcesFunc;
 		FLib3MFModel_GetObjectsFunc: TLib3MFModel_GetObjectsFunc;
 		FLib3MFModel_GetMeshObjectsFunc: TLib3MFModel_GetMeshObjectsFunc;
@@ -9795,6 +10124,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFModel_AddLevelSetFunc: TLib3MFModel_AddLevelSetFunc;
 		FLib3MFModel_GetLevelSetsFunc: TLib3MFModel_GetLevelSetsFunc;
 		FLib3MFModel_RemoveResourceFunc: TLib3MFModel_RemoveResourceFunc;
+		FLib3MFModel_DeduplicatePropertiesFunc: TLib3MFModel_DeduplicatePropertiesFunc;
 		FLib3MFGetLibraryVersionFunc: TLib3MFGetLibraryVersionFunc;
 		FLib3MFGetPrereleaseInformationFunc: TLib3MFGetPrereleaseInformationFunc;
 		FLib3MFGetBuildInformationFunc: TLib3MFGetBuildInformationFunc;
@@ -9834,10 +10164,13 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFWriter_SetDecimalPrecisionFunc: TLib3MFWriter_SetDecimalPrecisionFunc read FLib3MFWriter_SetDecimalPrecisionFunc;
 		property Lib3MFWriter_SetStrictModeActiveFunc: TLib3MFWriter_SetStrictModeActiveFunc read FLib3MFWriter_SetStrictModeActiveFunc;
 		property Lib3MFWriter_GetStrictModeActiveFunc: TLib3MFWriter_GetStrictModeActiveFunc read FLib3MFWriter_GetStrictModeActiveFunc;
+		property Lib3MFWriter_SetIncrementalModeActiveFunc: TLib3MFWriter_SetIncrementalModeActiveFunc read FLib3MFWriter_SetIncrementalModeActiveFunc;
+		property Lib3MFWriter_GetIncrementalModeActiveFunc: TLib3MFWriter_GetIncrementalModeActiveFunc read FLib3MFWriter_GetIncrementalModeActiveFunc;
 		property Lib3MFWriter_GetWarningFunc: TLib3MFWriter_GetWarningFunc read FLib3MFWriter_GetWarningFunc;
 		property Lib3MFWriter_GetWarningCountFunc: TLib3MFWriter_GetWarningCountFunc read FLib3MFWriter_GetWarningCountFunc;
 		property Lib3MFWriter_AddKeyWrappingCallbackFunc: TLib3MFWriter_AddKeyWrappingCallbackFunc read FLib3MFWriter_AddKeyWrappingCallbackFunc;
 		property Lib3MFWriter_SetContentEncryptionCallbackFunc: TLib3MFWriter_SetContentEncryptionCallbackFunc read FLib3MFWriter_SetContentEncryptionCallbackFunc;
+		property Lib3MFWriter_GetStatisticsFunc: TLib3MFWriter_GetStatisticsFunc read FLib3MFWriter_GetStatisticsFunc;
 		property Lib3MFReader_ReadFromFileFunc: TLib3MFReader_ReadFromFileFunc read FLib3MFReader_ReadFromFileFunc;
 		property Lib3MFReader_ReadFromBufferFunc: TLib3MFReader_ReadFromBufferFunc read FLib3MFReader_ReadFromBufferFunc;
 		property Lib3MFReader_ReadFromCallbackFunc: TLib3MFReader_ReadFromCallbackFunc read FLib3MFReader_ReadFromCallbackFunc;
@@ -9850,6 +10183,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFReader_GetWarningCountFunc: TLib3MFReader_GetWarningCountFunc read FLib3MFReader_GetWarningCountFunc;
 		property Lib3MFReader_AddKeyWrappingCallbackFunc: TLib3MFReader_AddKeyWrappingCallbackFunc read FLib3MFReader_AddKeyWrappingCallbackFunc;
 		property Lib3MFReader_SetContentEncryptionCallbackFunc: TLib3MFReader_SetContentEncryptionCallbackFunc read FLib3MFReader_SetContentEncryptionCallbackFunc;
+		property Lib3MFReader_SetInPlaceDecryptionActiveFunc: TLib3MFReader_SetInPlaceDecryptionActiveFunc read FLib3MFReader_SetInPlaceDecryptionActiveFunc;
+		property Lib3MFReader_GetInPlaceDecryptionActiveFunc: TLib3MFReader_GetInPlaceDecryptionActiveFunc read FLib3MFReader_GetInPlaceDecryptionActiveFunc;
+		property Lib3MFReader_GetStatisticsFunc: TLib3MFReader_GetStatisticsFunc read FLib3MFReader_GetStatisticsFunc;
 		property Lib3MFPackagePart_GetPathFunc: TLib3MFPackagePart_GetPathFunc read FLib3MFPackagePart_GetPathFunc;
 		property Lib3MFPackagePart_SetPathFunc: TLib3MFPackagePart_SetPathFunc read FLib3MFPackagePart_SetPathFunc;
 		property Lib3MFResource_GetResourceIDFunc: TLib3MFResource_GetResourceIDFunc read FLib3MFResource_GetResourceIDFunc;
@@ -10057,12 +10393,16 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFColorGroup_RemoveColorFunc: TLib3MFColorGroup_RemoveColorFunc read FLib3MFColorGroup_RemoveColorFunc;
 		property Lib3MFColorGroup_SetColorFunc: TLib3MFColorGroup_SetColorFunc read FLib3MFColorGroup_SetColorFunc;
 		property Lib3MFColorGroup_GetColorFunc: TLib3MFColorGroup_GetColorFunc read FLib3MFColorGroup_GetColorFunc;
+		property Lib3MFColorGroup_GetAllColorsFunc: TLib3MFColorGroup_GetAllColorsFunc read FLib3MFColorGroup_GetAllColorsFunc;
+		property Lib3MFColorGroup_SetAllColorsFunc: TLib3MFColorGroup_SetAllColorsFunc read FLib3MFColorGroup_SetAllColorsFunc;
 		property Lib3MFTexture2DGroup_GetCountFunc: TLib3MFTexture2DGroup_GetCountFunc read FLib3MFTexture2DGroup_GetCountFunc;
 		property Lib3MFTexture2DGroup_GetAllPropertyIDsFunc: TLib3MFTexture2DGroup_GetAllPropertyIDsFunc read FLib3MFTexture2DGroup_GetAllPropertyIDsFunc;
 		property Lib3MFTexture2DGroup_AddTex2CoordFunc: TLib3MFTexture2DGroup_AddTex2CoordFunc read FLib3MFTexture2DGroup_AddTex2CoordFunc;
 		property Lib3MFTexture2DGroup_GetTex2CoordFunc: TLib3MFTexture2DGroup_GetTex2CoordFunc read FLib3MFTexture2DGroup_GetTex2CoordFunc;
 		property Lib3MFTexture2DGroup_RemoveTex2CoordFunc: TLib3MFTexture2DGroup_RemoveTex2CoordFunc read FLib3MFTexture2DGroup_RemoveTex2CoordFunc;
 		property Lib3MFTexture2DGroup_GetTexture2DFunc: TLib3MFTexture2DGroup_GetTexture2DFunc read FLib3MFTexture2DGroup_GetTexture2DFunc;
+		property Lib3MFTexture2DGroup_GetAllTex2CoordsFunc: TLib3MFTexture2DGroup_GetAllTex2CoordsFunc read FLib3MFTexture2DGroup_GetAllTex2CoordsFunc;
+		property Lib3MFTexture2DGroup_SetAllTex2CoordsFunc: TLib3MFTexture2DGroup_SetAllTex2CoordsFunc read FLib3MFTexture2DGroup_SetAllTex2CoordsFunc;
 		property Lib3MFCompositeMaterials_GetCountFunc: TLib3MFCompositeMaterials_GetCountFunc read FLib3MFCompositeMaterials_GetCountFunc;
 		property Lib3MFCompositeMaterials_GetAllPropertyIDsFunc: TLib3MFCompositeMaterials_GetAllPropertyIDsFunc read FLib3MFCompositeMaterials_GetAllPropertyIDsFunc;
 		property Lib3MFCompositeMaterials_GetBaseMaterialGroupFunc: TLib3MFCompositeMaterials_GetBaseMaterialGroupFunc read FLib3MFCompositeMaterials_GetBaseMaterialGroupFunc;
@@ -10294,6 +10634,13 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFBuildItemIterator_GetCurrentFunc: TLib3MFBuildItemIterator_GetCurrentFunc read FLib3MFBuildItemIterator_GetCurrentFunc;
 		property Lib3MFBuildItemIterator_CloneFunc: TLib3MFBuildItemIterator_CloneFunc read FLib3MFBuildItemIterator_CloneFunc;
 		property Lib3MFBuildItemIterator_CountFunc: TLib3MFBuildItemIterator_CountFunc read FLib3MFBuildItemIterator_CountFunc;
+		property Lib3MFInstanceTable_GetMeshCountFunc: TLib3MFInstanceTable_GetMeshCountFunc read FLib3MFInstanceTable_GetMeshCountFunc;
+		property Lib3MFInstanceTable_GetMeshObjectFunc: TLib3MFInstanceTable_GetMeshObjectFunc read FLib3MFInstanceTable_GetMeshObjectFunc;
+		property Lib3MFInstanceTable_GetMeshRangeFunc: TLib3MFInstanceTable_GetMeshRangeFunc read FLib3MFInstanceTable_GetMeshRangeFunc;
+		property Lib3MFInstanceTable_GetVerticesFunc: TLib3MFInstanceTable_GetVerticesFunc read FLib3MFInstanceTable_GetVerticesFunc;
+		property Lib3MFInstanceTable_GetTrianglesFunc: TLib3MFInstanceTable_GetTrianglesFunc read FLib3MFInstanceTable_GetTrianglesFunc;
+		property Lib3MFInstanceTable_GetInstanceCountFunc: TLib3MFInstanceTable_GetInstanceCountFunc read FLib3MFInstanceTable_GetInstanceCountFunc;
+		property Lib3MFInstanceTable_GetInstancesFunc: TLib3MFInstanceTable_GetInstancesFunc read FLib3MFInstanceTable_GetInstancesFunc;
 		property Lib3MFSlice_SetVerticesFunc: TLib3MFSlice_SetVerticesFunc read FLib3MFSlice_SetVerticesFunc;
 		property Lib3MFSlice_GetVerticesFunc: TLib3MFSlice_GetVerticesFunc read FLib3MFSlice_GetVerticesFunc;
 		property Lib3MFSlice_GetVertexCountFunc: TLib3MFSlice_GetVertexCountFunc read FLib3MFSlice_GetVertexCountFunc;
@@ -10313,6 +10660,11 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFSliceStack_CollapseSliceReferencesFunc: TLib3MFSliceStack_CollapseSliceReferencesFunc read FLib3MFSliceStack_CollapseSliceReferencesFunc;
 		property Lib3MFSliceStack_SetOwnPathFunc: TLib3MFSliceStack_SetOwnPathFunc read FLib3MFSliceStack_SetOwnPathFunc;
 		property Lib3MFSliceStack_GetOwnPathFunc: TLib3MFSliceStack_GetOwnPathFunc read FLib3MFSliceStack_GetOwnPathFunc;
+		property Lib3MFSliceStack_GetTotalSliceCountFunc: TLib3MFSliceStack_GetTotalSliceCountFunc read FLib3MFSliceStack_GetTotalSliceCountFunc;
+		property Lib3MFSliceStack_GetTotalSliceFunc: TLib3MFSliceStack_GetTotalSliceFunc read FLib3MFSliceStack_GetTotalSliceFunc;
+		property Lib3MFSliceStack_FindSliceAtZFunc: TLib3MFSliceStack_FindSliceAtZFunc read FLib3MFSliceStack_FindSliceAtZFunc;
+		property Lib3MFSliceStack_GetSliceRangeFunc: TLib3MFSliceStack_GetSliceRangeFunc read FLib3MFSliceStack_GetSliceRangeFunc;
+		property Lib3MFSliceStack_ValidatePolygonsFunc: TLib3MFSliceStack_ValidatePolygonsFunc read FLib3MFSliceStack_ValidatePolygonsFunc;
 		property Lib3MFConsumer_GetConsumerIDFunc: TLib3MFConsumer_GetConsumerIDFunc read FLib3MFConsumer_GetConsumerIDFunc;
 		property Lib3MFConsumer_GetKeyIDFunc: TLib3MFConsumer_GetKeyIDFunc read FLib3MFConsumer_GetKeyIDFunc;
 		property Lib3MFConsumer_GetKeyValueFunc: TLib3MFConsumer_GetKeyValueFunc read FLib3MFConsumer_GetKeyValueFunc;
@@ -10377,6 +10729,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFModel_SetBuildUUIDFunc: TLib3MFModel_SetBuildUUIDFunc read FLib3MFModel_SetBuildUUIDFunc;
 		property Lib3MFModel_GetBuildItemsFunc: TLib3MFModel_GetBuildItemsFunc read FLib3MFModel_GetBuildItemsFunc;
 		property Lib3MFModel_GetOutboxFunc: TLib3MFModel_GetOutboxFunc read FLib3MFModel_GetOutboxFunc;
+		property Lib3MFModel_GetInstanceTableFunc: TLib3MFModel_GetInstanceTableFunc read FLib3MFModel_GetInstanceTableFunc;
 		property Lib3MFModel_GetResourcesFunc: TLib3MFModel_GetResourcesFunc read FLib3MFModel_GetResourcesFunc;
 		property Lib3MFModel_GetObjectsFunc: TLib3MFModel_GetObjectsFunc read FLib3MFModel_GetObjectsFunc;
 		property Lib3MFModel_GetMeshObjectsFunc: TLib3MFModel_GetMeshObjectsFunc read FLib3MFModel_GetMeshObjectsFunc;
@@ -10425,6 +10778,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFModel_AddLevelSetFunc: TLib3MFModel_AddLevelSetFunc read FLib3MFModel_AddLevelSetFunc;
 		property Lib3MFModel_GetLevelSetsFunc: TLib3MFModel_GetLevelSetsFunc read FLib3MFModel_GetLevelSetsFunc;
 		property Lib3MFModel_RemoveResourceFunc: TLib3MFModel_RemoveResourceFunc read FLib3MFModel_RemoveResourceFunc;
+		property Lib3MFModel_DeduplicatePropertiesFunc: TLib3MFModel_DeduplicatePropertiesFunc read FLib3MFModel_DeduplicatePropertiesFunc;
 		property Lib3MFGetLibraryVersionFunc: TLib3MFGetLibraryVersionFunc read FLib3MFGetLibraryVersionFunc;
 		property Lib3MFGetPrereleaseInformationFunc: TLib3MFGetPrereleaseInformationFunc read FLib3MFGetPrereleaseInformationFunc;
 		property Lib3MFGetBuildInformationFunc: TLib3MFGetBuildInformationFunc read FLib3MFGetBuildInformationFunc;
@@ -11456,6 +11810,7 @@ implementation
 			QWord($9BD7D3C2026B8CE8): begin Obj := TLIB3MFFunctionFromImage3D.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
 			QWord($68FB2D5FFC4BA12A): begin Obj := TLIB3MFBuildItem.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 			QWord($A7D21BD364910860): begin Obj := TLIB3MFBuildItemIterator.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
+			QWord($CDB5C649E208089D): begin Obj := TLIB3MFInstanceTable.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::InstanceTable"
 			QWord($2198BCF4D8DF9C40): begin Obj := TLIB3MFSlice.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
 			QWord($6594B031B6096238): begin Obj := TLIB3MFSliceStack.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::SliceStack"
 			QWord($D9E46D5E6D8118EE): begin Obj := TLIB3MFConsumer.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Consumer"
@@ -12110,6 +12465,20 @@ implementation
 		Result := (ResultStrictModeActive <> 0);
 	end;
 
+	procedure TLib3MFWriter.SetIncrementalModeActive(const AIncrementalModeActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetIncrementalModeActiveFunc(FHandle, Ord(AIncrementalModeActive)));
+	end;
+
+	function TLib3MFWriter.GetIncrementalModeActive(): Boolean;
+	var
+		ResultIncrementalModeActive: Byte;
+	begin
+		ResultIncrementalModeActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetIncrementalModeActiveFunc(FHandle, ResultIncrementalModeActive));
+		Result := (ResultIncrementalModeActive <> 0);
+	end;
+
 	function TLib3MFWriter.GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 	var
 		bytesNeededWarning: Cardinal;
@@ -12143,6 +12512,20 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetContentEncryptionCallbackFunc(FHandle, ATheCallback, AUserData));
 	end;
 
+	function TLib3MFWriter.GetStatistics(): String;
+	var
+		bytesNeededStatistics: Cardinal;
+		bytesWrittenStatistics: Cardinal;
+		bufferStatistics: array of Char;
+	begin
+		bytesNeededStatistics:= 0;
+		bytesWrittenStatistics:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetStatisticsFunc(FHandle, 0, bytesNeededStatistics, nil));
+		SetLength(bufferStatistics, bytesNeededStatistics);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetStatisticsFunc(FHandle, bytesNeededStatistics, bytesWrittenStatistics, @bufferStatistics[0]));
+		Result := StrPas(@bufferStatistics[0]);
+	end;
+
 (*************************************************************************************************************************
  Class implementation for Reader
 **************************************************************************************************************************)
@@ -12251,6 +12634,34 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetContentEncryptionCallbackFunc(FHandle, ATheCallback, AUserData));
 	end;
 
+	procedure TLib3MFReader.SetInPlaceDecryptionActive(const AInPlaceDecryptionActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetInPlaceDecryptionActiveFunc(FHandle, Ord(AInPlaceDecryptionActive)));
+	end;
+
+	function TLib3MFReader.GetInPlaceDecryptionActive(): Boolean;
+	var
+		ResultInPlaceDecryptionActive: Byte;
+	begin
+		ResultInPlaceDecryptionActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetInPlaceDecryptionActiveFunc(FHandle, ResultInPlaceDecryptionActive));
+		Result := (ResultInPlaceDecryptionActive <> 0);
+	end;
+
+	function TLib3MFReader.GetStatistics(): String;
+	var
+		bytesNeededStatistics: Cardinal;
+		bytesWrittenStatistics: Cardinal;
+		bufferStatistics: array of Char;
+	begin
+		bytesNeededStatistics:= 0;
+		bytesWrittenStatistics:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetStatisticsFunc(FHandle, 0, bytesNeededStatistics, nil));
+		SetLength(bufferStatistics, bytesNeededStatistics);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetStatisticsFunc(FHandle, bytesNeededStatistics, bytesWrittenStatistics, @bufferStatistics[0]));
+		Result := StrPas(@bufferStatistics[0]);
+	end;
+
 (*************************************************************************************************************************
  Class implementation for PackagePart
 **************************************************************************************************************************)
@@ -14519,6 +14930,34 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFColorGroup_GetColorFunc(FHandle, APropertyID, @Result));
 	end;
 
+	procedure TLib3MFColorGroup.GetAllColors(out AColors: ArrayOfLib3MFColor);
+	var
+		countNeededColors: QWord;
+		countWrittenColors: QWord;
+	begin
+		countNeededColors:= 0;
+		countWrittenColors:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFColorGroup_GetAllColorsFunc(FHandle, 0, countNeededColors, nil));
+		SetLength(AColors, countNeededColors);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFColorGroup_GetAllColorsFunc(FHandle, countNeededColors, countWrittenColors, @AColors[0]));
+	end;
+
+	procedure TLib3MFColorGroup.SetAllColors(const AColors: ArrayOfLib3MFColor);
+	var
+		PtrColors: PLib3MFColor;
+		LenColors: QWord;
+	begin
+		LenColors := Length(AColors);
+		if LenColors > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenColors > 0 then
+			PtrColors := @AColors[0]
+		else
+			PtrColors := nil;
+		
+		FWrapper.CheckError(Self, FWrapper.Lib3MFColorGroup_SetAllColorsFunc(FHandle, QWord(LenColors), PtrColors));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for Texture2DGroup
 **************************************************************************************************************************)
@@ -14576,6 +15015,34 @@ implementation
 			Result := TLib3MFPolymorphicFactory<TLib3MFTexture2D, TLib3MFTexture2D>.Make(FWrapper, HTexture2DInstance);
 	end;
 
+	procedure TLib3MFTexture2DGroup.GetAllTex2Coords(out AUVCoordinates: ArrayOfLib3MFTex2Coord);
+	var
+		countNeededUVCoordinates: QWord;
+		countWrittenUVCoordinates: QWord;
+	begin
+		countNeededUVCoordinates:= 0;
+		countWrittenUVCoordinates:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFTexture2DGroup_GetAllTex2CoordsFunc(FHandle, 0, countNeededUVCoordinates, nil));
+		SetLength(AUVCoordinates, countNeededUVCoordinates);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFTexture2DGroup_GetAllTex2CoordsFunc(FHandle, countNeededUVCoordinates, countWrittenUVCoordinates, @AUVCoordinates[0]));
+	end;
+
+	procedure TLib3MFTexture2DGroup.SetAllTex2Coords(const AUVCoordinates: ArrayOfLib3MFTex2Coord);
+	var
+		PtrUVCoordinates: PLib3MFTex2Coord;
+		LenUVCoordinates: QWord;
+	begin
+		LenUVCoordinates := Length(AUVCoordinates);
+		if LenUVCoordinates > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenUVCoordinates > 0 then
+			PtrUVCoordinates := @AUVCoordinates[0]
+		else
+			PtrUVCoordinates := nil;
+		
+		FWrapper.CheckError(Self, FWrapper.Lib3MFTexture2DGroup_SetAllTex2CoordsFunc(FHandle, QWord(LenUVCoordinates), PtrUVCoordinates));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for CompositeMaterials
 **************************************************************************************************************************)
@@ -17820,6 +18287,82 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFBuildItemIterator_CountFunc(FHandle, Result));
 	end;
 
+(*************************************************************************************************************************
+ Class implementation for InstanceTable
+**************************************************************************************************************************)
+
+	constructor TLib3MFInstanceTable.Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+	begin
+		inherited Create(AWrapper, AHandle);
+	end;
+
+	destructor TLib3MFInstanceTable.Destroy;
+	begin
+		inherited;
+	end;
+
+	function TLib3MFInstanceTable.GetMeshCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetMeshCountFunc(FHandle, Result));
+	end;
+
+	function TLib3MFInstanceTable.GetMeshObject(const AMeshIndex: Cardinal): TLib3MFMeshObject;
+	var
+		HMeshObject: TLib3MFHandle;
+	begin
+		Result := nil;
+		HMeshObject := nil;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetMeshObjectFunc(FHandle, AMeshIndex, HMeshObject));
+		if Assigned(HMeshObject) then
+			Result := TLib3MFPolymorphicFactory<TLib3MFMeshObject, TLib3MFMeshObject>.Make(FWrapper, HMeshObject);
+	end;
+
+	procedure TLib3MFInstanceTable.GetMeshRange(const AMeshIndex: Cardinal; out AVertexOffset: Cardinal; out AVertexCount: Cardinal; out ATriangleOffset: Cardinal; out ATriangleCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetMeshRangeFunc(FHandle, AMeshIndex, AVertexOffset, AVertexCount, ATriangleOffset, ATriangleCount));
+	end;
+
+	procedure TLib3MFInstanceTable.GetVertices(out AVertices: ArrayOfLib3MFPosition);
+	var
+		countNeededVertices: QWord;
+		countWrittenVertices: QWord;
+	begin
+		countNeededVertices:= 0;
+		countWrittenVertices:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetVerticesFunc(FHandle, 0, countNeededVertices, nil));
+		SetLength(AVertices, countNeededVertices);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetVerticesFunc(FHandle, countNeededVertices, countWrittenVertices, @AVertices[0]));
+	end;
+
+	procedure TLib3MFInstanceTable.GetTriangles(out ATriangles: ArrayOfLib3MFTriangle);
+	var
+		countNeededTriangles: QWord;
+		countWrittenTriangles: QWord;
+	begin
+		countNeededTriangles:= 0;
+		countWrittenTriangles:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetTrianglesFunc(FHandle, 0, countNeededTriangles, nil));
+		SetLength(ATriangles, countNeededTriangles);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetTrianglesFunc(FHandle, countNeededTriangles, countWrittenTriangles, @ATriangles[0]));
+	end;
+
+	function TLib3MFInstanceTable.GetInstanceCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetInstanceCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFInstanceTable.GetInstances(out AInstances: ArrayOfLib3MFMeshInstance);
+	var
+		countNeededInstances: QWord;
+		countWrittenInstances: QWord;
+	begin
+		countNeededInstances:= 0;
+		countWrittenInstances:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetInstancesFunc(FHandle, 0, countNeededInstances, nil));
+		SetLength(AInstances, countNeededInstances);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFInstanceTable_GetInstancesFunc(FHandle, countNeededInstances, countWrittenInstances, @AInstances[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for Slice
 **************************************************************************************************************************)
@@ -18023,6 +18566,48 @@ implementation
 		Result := StrPas(@bufferPath[0]);
 	end;
 
+	function TLib3MFSliceStack.GetTotalSliceCount(): QWord;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFSliceStack_GetTotalSliceCountFunc(FHandle, Result));
+	end;
+
+	function TLib3MFSliceStack.GetTotalSlice(const ATotalSliceIndex: QWord): TLib3MFSlice;
+	var
+		HTheSlice: TLib3MFHandle;
+	begin
+		Result := nil;
+		HTheSlice := nil;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFSliceStack_GetTotalSliceFunc(FHandle, ATotalSliceIndex, HTheSlice));
+		if Assigned(HTheSlice) then
+			Result := TLib3MFPolymorphicFactory<TLib3MFSlice, TLib3MFSlice>.Make(FWrapper, HTheSlice);
+	end;
+
+	function TLib3MFSliceStack.FindSliceAtZ(const AZValue: Double; out ATotalSliceIndex: QWord): Boolean;
+	var
+		ResultFound: Byte;
+	begin
+		ResultFound := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFSliceStack_FindSliceAtZFunc(FHandle, AZValue, ATotalSliceIndex, ResultFound));
+		Result := (ResultFound <> 0);
+	end;
+
+	procedure TLib3MFSliceStack.GetSliceRange(const AZMin: Double; const AZMax: Double; out AFirstIndex: QWord; out ACount: QWord);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFSliceStack_GetSliceRangeFunc(FHandle, AZMin, AZMax, AFirstIndex, ACount));
+	end;
+
+	procedure TLib3MFSliceStack.ValidatePolygons(out ALayerReports: ArrayOfLib3MFSliceLayerReport);
+	var
+		countNeededLayerReports: QWord;
+		countWrittenLayerReports: QWord;
+	begin
+		countNeededLayerReports:= 0;
+		countWrittenLayerReports:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFSliceStack_ValidatePolygonsFunc(FHandle, 0, countNeededLayerReports, nil));
+		SetLength(ALayerReports, countNeededLayerReports);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFSliceStack_ValidatePolygonsFunc(FHandle, countNeededLayerReports, countWrittenLayerReports, @ALayerReports[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for Consumer
 **************************************************************************************************************************)
@@ -18835,6 +19420,17 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_GetOutboxFunc(FHandle, @Result));
 	end;
 
+	function TLib3MFModel.GetInstanceTable(): TLib3MFInstanceTable;
+	var
+		HInstanceTable: TLib3MFHandle;
+	begin
+		Result := nil;
+		HInstanceTable := nil;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_GetInstanceTableFunc(FHandle, HInstanceTable));
+		if Assigned(HInstanceTable) then
+			Result := TLib3MFPolymorphicFactory<TLib3MFInstanceTable, TLib3MFInstanceTable>.Make(FWrapper, HInstanceTable);
+	end;
+
 	function TLib3MFModel.GetResources(): TLib3MFResourceIterator;
 	var
 		HResourceIterator: TLib3MFHandle;
@@ -19358,6 +19954,11 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_RemoveResourceFunc(FHandle, AResourceHandle));
 	end;
 
+	function TLib3MFModel.DeduplicateProperties(const ARemoveUnreferenced: Boolean): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFModel_DeduplicatePropertiesFunc(FHandle, Ord(ARemoveUnreferenced), Result));
+	end;
+
 (*************************************************************************************************************************
  Wrapper class implementation
 **************************************************************************************************************************)
@@ -19390,10 +19991,13 @@ implementation
 		FLib3MFWriter_SetDecimalPrecisionFunc := LoadFunction('lib3mf_writer_setdecimalprecision');
 		FLib3MFWriter_SetStrictModeActiveFunc := LoadFunction('lib3mf_writer_setstrictmodeactive');
 		FLib3MFWriter_GetStrictModeActiveFunc := LoadFunction('lib3mf_writer_getstrictmodeactive');
+		FLib3MFWriter_SetIncrementalModeActiveFunc := LoadFunction('lib3mf_writer_setincrementalmodeactive');
+		FLib3MFWriter_GetIncrementalModeActiveFunc := LoadFunction('lib3mf_writer_getincrementalmodeactive');
 		FLib3MFWriter_GetWarningFunc := LoadFunction('lib3mf_writer_getwarning');
 		FLib3MFWriter_GetWarningCountFunc := LoadFunction('lib3mf_writer_getwarningcount');
 		FLib3MFWriter_AddKeyWrappingCallbackFunc := LoadFunction('lib3mf_writer_addkeywrappingcallback');
 		FLib3MFWriter_SetContentEncryptionCallbackFunc := LoadFunction('lib3mf_writer_setcontentencryptioncallback');
+		FLib3MFWriter_GetStatisticsFunc := LoadFunction('lib3mf_writer_getstatistics');
 		FLib3MFReader_ReadFromFileFunc := LoadFunction('lib3mf_reader_readfromfile');
 		FLib3MFReader_ReadFromBufferFunc := LoadFunction('lib3mf_reader_readfrombuffer');
 		FLib3MFReader_ReadFromCallbackFunc := LoadFunction('lib3mf_reader_readfromcallback');
@@ -19406,6 +20010,9 @@ implementation
 		FLib3MFReader_GetWarningCountFunc := LoadFunction('lib3mf_reader_getwarningcount');
 		FLib3MFReader_AddKeyWrappingCallbackFunc := LoadFunction('lib3mf_reader_addkeywrappingcallback');
 		FLib3MFReader_SetContentEncryptionCallbackFunc := LoadFunction('lib3mf_reader_setcontentencryptioncallback');
+		FLib3MFReader_SetInPlaceDecryptionActiveFunc := LoadFunction('lib3mf_reader_setinplacedecryptionactive');
+		FLib3MFReader_GetInPlaceDecryptionActiveFunc := LoadFunction('lib3mf_reader_getinplacedecryptionactive');
+		FLib3MFReader_GetStatisticsFunc := LoadFunction('lib3mf_reader_getstatistics');
 		FLib3MFPackagePart_GetPathFunc := LoadFunction('lib3mf_packagepart_getpath');
 		FLib3MFPackagePart_SetPathFunc := LoadFunction('lib3mf_packagepart_setpath');
 		FLib3MFResource_GetResourceIDFunc := LoadFunction('lib3mf_resource_getresourceid');
@@ -19613,12 +20220,16 @@ implementation
 		FLib3MFColorGroup_RemoveColorFunc := LoadFunction('lib3mf_colorgroup_removecolor');
 		FLib3MFColorGroup_SetColorFunc := LoadFunction('lib3mf_colorgroup_setcolor');
 		FLib3MFColorGroup_GetColorFunc := LoadFunction('lib3mf_colorgroup_getcolor');
+		FLib3MFColorGroup_GetAllColorsFunc := LoadFunction('lib3mf_colorgroup_getallcolors');
+		FLib3MFColorGroup_SetAllColorsFunc := LoadFunction('lib3mf_colorgroup_setallcolors');
 		FLib3MFTexture2DGroup_GetCountFunc := LoadFunction('lib3mf_texture2dgroup_getcount');
 		FLib3MFTexture2DGroup_GetAllPropertyIDsFunc := LoadFunction('lib3mf_texture2dgroup_getallpropertyids');
 		FLib3MFTexture2DGroup_AddTex2CoordFunc := LoadFunction('lib3mf_texture2dgroup_addtex2coord');
 		FLib3MFTexture2DGroup_GetTex2CoordFunc := LoadFunction('lib3mf_texture2dgroup_gettex2coord');
 		FLib3MFTexture2DGroup_RemoveTex2CoordFunc := LoadFunction('lib3mf_texture2dgroup_removetex2coord');
 		FLib3MFTexture2DGroup_GetTexture2DFunc := LoadFunction('lib3mf_texture2dgroup_gettexture2d');
+		FLib3MFTexture2DGroup_GetAllTex2CoordsFunc := LoadFunction('lib3mf_texture2dgroup_getalltex2coords');
+		FLib3MFTexture2DGroup_SetAllTex2CoordsFunc := LoadFunction('lib3mf_texture2dgroup_setalltex2coords');
 		FLib3MFCompositeMaterials_GetCountFunc := LoadFunction('lib3mf_compositematerials_getcount');
 		FLib3MFCompositeMaterials_GetAllPropertyIDsFunc := LoadFunction('lib3mf_compositematerials_getallpropertyids');
 		FLib3MFCompositeMaterials_GetBaseMaterialGroupFunc := LoadFunction('lib3mf_compositematerials_getbasematerialgroup');
@@ -19850,6 +20461,13 @@ implementation
 		FLib3MFBuildItemIterator_GetCurrentFunc := LoadFunction('lib3mf_builditemiterator_getcurrent');
 		FLib3MFBuildItemIterator_CloneFunc := LoadFunction('lib3mf_builditemiterator_clone');
 		FLib3MFBuildItemIterator_CountFunc := LoadFunction('lib3mf_builditemiterator_count');
+		FLib3MFInstanceTable_GetMeshCountFunc := LoadFunction('lib3mf_instancetable_getmeshcount');
+		FLib3MFInstanceTable_GetMeshObjectFunc := LoadFunction('lib3mf_instancetable_getmeshobject');
+		FLib3MFInstanceTable_GetMeshRangeFunc := LoadFunction('lib3mf_instancetable_getmeshrange');
+		FLib3MFInstanceTable_GetVerticesFunc := LoadFunction('lib3mf_instancetable_getvertices');
+		FLib3MFInstanceTable_GetTrianglesFunc := LoadFunction('lib3mf_instancetable_gettriangles');
+		FLib3MFInstanceTable_GetInstanceCountFunc := LoadFunction('lib3mf_instancetable_getinstancecount');
+		FLib3MFInstanceTable_GetInstancesFunc := LoadFunction('lib3mf_instancetable_getinstances');
 		FLib3MFSlice_SetVerticesFunc := LoadFunction('lib3mf_slice_setvertices');
 		FLib3MFSlice_GetVerticesFunc := LoadFunction('lib3mf_slice_getvertices');
 		FLib3MFSlice_GetVertexCountFunc := LoadFunction('lib3mf_slice_getvertexcount');
@@ -19869,6 +20487,11 @@ implementation
 		FLib3MFSliceStack_CollapseSliceReferencesFunc := LoadFunction('lib3mf_slicestack_collapseslicereferences');
 		FLib3MFSliceStack_SetOwnPathFunc := LoadFunction('lib3mf_slicestack_setownpath');
 		FLib3MFSliceStack_GetOwnPathFunc := LoadFunction('lib3mf_slicestack_getownpath');
+		FLib3MFSliceStack_GetTotalSliceCountFunc := LoadFunction('lib3mf_slicestack_gettotalslicecount');
+		FLib3MFSliceStack_GetTotalSliceFunc := LoadFunction('lib3mf_slicestack_gettotalslice');
+		FLib3MFSliceStack_FindSliceAtZFunc := LoadFunction('lib3mf_slicestack_findsliceatz');
+		FLib3MFSliceStack_GetSliceRangeFunc := LoadFunction('lib3mf_slicestack_getslicerange');
+		FLib3MFSliceStack_ValidatePolygonsFunc := LoadFunction('lib3mf_slicestack_validatepolygons');
 		FLib3MFConsumer_GetConsumerIDFunc := LoadFunction('lib3mf_consumer_getconsumerid');
 		FLib3MFConsumer_GetKeyIDFunc := LoadFunction('lib3mf_consumer_getkeyid');
 		FLib3MFConsumer_GetKeyValueFunc := LoadFunction('lib3mf_consumer_getkeyvalue');
@@ -19933,6 +20556,7 @@ implementation
 		FLib3MFModel_SetBuildUUIDFunc := LoadFunction('lib3mf_model_setbuilduuid');
 		FLib3MFModel_GetBuildItemsFunc := LoadFunction('lib3mf_model_getbuilditems');
 		FLib3MFModel_GetOutboxFunc := LoadFunction('lib3mf_model_getoutbox');
+		FLib3MFModel_GetInstanceTableFunc := LoadFunction('lib3mf_model_getinstancetable');
 		FLib3MFModel_GetResourcesFunc := LoadFunction('lib3mf_model_getresources');
 		FLib3MFModel_GetObjectsFunc := LoadFunction('lib3mf_model_getobjects');
 		FLib3MFModel_GetMeshObjectsFunc := LoadFunction('lib3mf_model_getmeshobjects');
@@ -19981,6 +20605,7 @@ implementation
 		FLib3MFModel_AddLevelSetFunc := LoadFunction('lib3mf_model_addlevelset');
 		FLib3MFModel_GetLevelSetsFunc := LoadFunction('lib3mf_model_getlevelsets');
 		FLib3MFModel_RemoveResourceFunc := LoadFunction('lib3mf_model_removeresource');
+		FLib3MFModel_DeduplicatePropertiesFunc := LoadFunction('lib3mf_model_deduplicateproperties');
 		FLib3MFGetLibraryVersionFunc := LoadFunction('lib3mf_getlibraryversion');
 		FLib3MFGetPrereleaseInformationFunc := LoadFunction('lib3mf_getprereleaseinformation');
 		FLib3MFGetBuildInformationFunc := LoadFunction('lib3mf_getbuildinformation');
@@ -20039,6 +20664,12 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getstrictmodeactive'), @FLib3MFWriter_GetStrictModeActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setincrementalmodeactive'), @FLib3MFWriter_SetIncrementalModeActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getincrementalmodeactive'), @FLib3MFWriter_GetIncrementalModeActiveFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getwarning'), @FLib3MFWriter_GetWarningFunc);
@@ -20051,6 +20682,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setcontentencryptioncallback'), @FLib3MFWriter_SetContentEncryptionCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getstatistics'), @FLib3MFWriter_GetStatisticsFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_readfromfile'), @FLib3MFReader_ReadFromFileFunc);
@@ -20087,6 +20721,15 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setcontentencryptioncallback'), @FLib3MFReader_SetContentEncryptionCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setinplacedecryptionactive'), @FLib3MFReader_SetInPlaceDecryptionActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getinplacedecryptionactive'), @FLib3MFReader_GetInPlaceDecryptionActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getstatistics'), @FLib3MFReader_GetStatisticsFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_packagepart_getpath'), @FLib3MFPackagePart_GetPathFunc);
@@ -20708,6 +21351,12 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_colorgroup_getcolor'), @FLib3MFColorGroup_GetColorFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_colorgroup_getallcolors'), @FLib3MFColorGroup_GetAllColorsFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_colorgroup_setallcolors'), @FLib3MFColorGroup_SetAllColorsFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_texture2dgroup_getcount'), @FLib3MFTexture2DGroup_GetCountFunc);
@@ -20726,6 +21375,12 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_texture2dgroup_gettexture2d'), @FLib3MFTexture2DGroup_GetTexture2DFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_texture2dgroup_getalltex2coords'), @FLib3MFTexture2DGroup_GetAllTex2CoordsFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_texture2dgroup_setalltex2coords'), @FLib3MFTexture2DGroup_SetAllTex2CoordsFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_compositematerials_getcount'), @FLib3MFCompositeMaterials_GetCountFunc);
@@ -21419,6 +22074,27 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_builditemiterator_count'), @FLib3MFBuildItemIterator_CountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_getmeshcount'), @FLib3MFInstanceTable_GetMeshCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_getmeshobject'), @FLib3MFInstanceTable_GetMeshObjectFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_getmeshrange'), @FLib3MFInstanceTable_GetMeshRangeFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_getvertices'), @FLib3MFInstanceTable_GetVerticesFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_gettriangles'), @FLib3MFInstanceTable_GetTrianglesFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_getinstancecount'), @FLib3MFInstanceTable_GetInstanceCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_instancetable_getinstances'), @FLib3MFInstanceTable_GetInstancesFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_slice_setvertices'), @FLib3MFSlice_SetVerticesFunc);
@@ -21476,6 +22152,21 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_slicestack_getownpath'), @FLib3MFSliceStack_GetOwnPathFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_slicestack_gettotalslicecount'), @FLib3MFSliceStack_GetTotalSliceCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_slicestack_gettotalslice'), @FLib3MFSliceStack_GetTotalSliceFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_slicestack_findsliceatz'), @FLib3MFSliceStack_FindSliceAtZFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_slicestack_getslicerange'), @FLib3MFSliceStack_GetSliceRangeFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_slicestack_validatepolygons'), @FLib3MFSliceStack_ValidatePolygonsFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_consumer_getconsumerid'), @FLib3MFConsumer_GetConsumerIDFunc);
@@ -21668,6 +22359,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_model_getoutbox'), @FLib3MFModel_GetOutboxFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_model_getinstancetable'), @FLib3MFModel_GetInstanceTableFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_model_getresources'), @FLib3MFModel_GetResourcesFunc);
@@ -21812,6 +22506,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_model_removeresource'), @FLib3MFModel_RemoveResourceFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_model_deduplicateproperties'), @FLib3MFModel_DeduplicatePropertiesFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_getlibraryversion'), @FLib3MFGetLibraryVersionFunc);
@@ -147,10 +147,13 @@ class FunctionTable:
 	lib3mf_writer_setdecimalprecision = None
 	lib3mf_writer_setstrictmodeactive = None
 	lib3mf_writer_getstrictmodeactive = None
+	lib3mf_writer_setincrementalmodeactive = None
+	lib3mf_writer_getincrementalmodeactive = None
 	lib3mf_writer_getwarning = None
 	lib3mf_writer_getwarningcount = None
 	lib3mf_writer_addkeywrappingcallback = None
 	lib3mf_writer_setcontentencryptioncallback = None
+	lib3mf_writer_getstatistics = None
 	lib3mf_reader_readfromfile = None
 	lib3mf_reader_readfrombuffer = None
 	lib3mf_reader_readfromcallback = None
@@ -163,6 +166,9 @@ class FunctionTable:
 	lib3mf_reader_getwarningcount = None
 	lib3mf_reader_addkeywrappingcallback = None
 	lib3mf_reader_setcontentencryptioncallback = None
+	lib3mf_reader_setinplacedecryptionactive = None
+	lib3mf_reader_getinplacedecryptionactive = None
+	lib3mf_reader_getstatistics = None
 	lib3mf_packagepart_getpath = None
 	lib3mf_packagepart_setpath = None
 	lib3mf_resource_getresourceid = None
@@ -370,12 +376,16 @@ class FunctionTable:
 	lib3mf_colorgroup_removecolor = None
 	lib3mf_colorgroup_setcolor = None
 	lib3mf_colorgroup_getcolor = None
+	lib3mf_colorgroup_getallcolors = None
+	lib3mf_colorgroup_setallcolors = None
 	lib3mf_texture2dgroup_getcount = None
 	lib3mf_texture2dgroup_getallpropertyids = None
 	lib3mf_texture2dgroup_addtex2coord = None
 	lib3mf_texture2dgroup_gettex2coord = None
 	lib3mf_texture2dgroup_removetex2coord = None
 	lib3mf_texture2dgroup_gettexture2d = None
+	lib3mf_texture2dgroup_getalltex2coords = None
+	lib3mf_texture2dgroup_setalltex2coords = None
 	lib3mf_compositematerials_getcount = None
 	lib3mf_compositematerials_getallpropertyids = None
 	lib3mf_compositematerials_getbasematerialgroup = None
@@ -607,6 +617,13 @@ class FunctionTable:
 	lib3mf_builditemiterator_getcurrent = None
 	lib3mf_builditemiterator_clone = None
 	lib3mf_builditemiterator_count = None
+	lib3mf_instancetable_getmeshcount = None
+	lib3mf_instancetable_getmeshobject = None
+	lib3mf_instancetable_getmeshrange = None
+	lib3mf_instancetable_getvertices = None
+	lib3mf_instancetable_gettriangles = None
+	lib3mf_instancetable_getinstancecount = None
+	lib3mf_instancetable_getinstances = None
 	lib3mf_slice_setvertices = None
 	lib3mf_slice_getvertices = None
 	lib3mf_slice_getvertexcount = None
@@ -626,6 +643,11 @@ class FunctionTable:
 	lib3mf_slicestack_collapseslicereferences = None
 	lib3mf_slicestack_setownpath = None
 	lib3mf_slicestack_getownpath = None
+	lib3mf_slicestack_gettotalslicecount = None
+	lib3mf_slicestack_gettotalslice = None
+	lib3mf_slicestack_findsliceatz = None
+	lib3mf_slicestack_getslicerange = None
+	lib3mf_slicestack_validatepolygons = None
 	lib3mf_consumer_getconsumerid = None
 	lib3mf_consumer_getkeyid = None
 	lib3mf_consumer_getkeyvalue = None
@@ -690,6 +712,7 @@ class FunctionTable:
 	lib3mf_model_setbuilduuid = None
 	lib3mf_model_getbuilditems = None
 	lib3mf_model_getoutbox = None
+	lib3mf_model_getinstancetable = None
 	lib3mf_model_getresources = None
 	lib3mf_model_getobjects = None
 	lib3mf_model_getmeshobjects = None
@@ -738,6 +761,7 @@ class FunctionTable:
 	lib3mf_model_addlevelset = None
 	lib3mf_model_getlevelsets = None
 	lib3mf_model_removeresource = None
+	lib3mf_model_deduplicateproperties = None
 
 '''Definition of Enumerations
 '''
@@ -1060,6 +1084,27 @@ class Ball(ctypes.Structure):
 		("Index", ctypes.c_uint32), 
 		("Radius", ctypes.c_double)
 	]
+'''Definition of SliceLayerReport
+'''
+class SliceLayerReport(ctypes.Structure):
+	_pack_ = 1
+	_fields_ = [
+		("LayerIndex", ctypes.c_uint32), 
+		("OpenPolygons", ctypes.c_uint32), 
+		("DegeneratePolygons", ctypes.c_uint32), 
+		("SelfIntersections", ctypes.c_uint32), 
+		("OrientationErrors", ctypes.c_uint32), 
+		("MaxNestingDepth", ctypes.c_uint32)
+	]
+'''Definition of MeshInstance
+'''
+class MeshInstance(ctypes.Structure):
+	_pack_ = 1
+	_fields_ = [
+		("MeshIndex", ctypes.c_uint32), 
+		("BuildItemIndex", ctypes.c_uint32), 
+		("Transform", (ctypes.c_float * 3) * 4)
+	]
 '''Definition of Vector
 '''
 class Vector(ctypes.Structure):
@@ -1322,6 +1367,18 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
 			self.lib.lib3mf_writer_getstrictmodeactive = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setincrementalmodeactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_writer_setincrementalmodeactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getincrementalmodeactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_writer_getincrementalmodeactive = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getwarning")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1346,6 +1403,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ContentEncryptionCallback, ctypes.c_void_p)
 			self.lib.lib3mf_writer_setcontentencryptioncallback = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getstatistics")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p)
+			self.lib.lib3mf_writer_getstatistics = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_readfromfile")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1418,6 +1481,24 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ContentEncryptionCallback, ctypes.c_void_p)
 			self.lib.lib3mf_reader_setcontentencryptioncallback = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setinplacedecryptionactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_reader_setinplacedecryptionactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getinplacedecryptionactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_reader_getinplacedecryptionactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getstatistics")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p)
+			self.lib.lib3mf_reader_getstatistics = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_packagepart_getpath")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -2660,6 +2741,18 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Color))
 			self.lib.lib3mf_colorgroup_getcolor = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_colorgroup_getallcolors")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Color))
+			self.lib.lib3mf_colorgroup_getallcolors = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_colorgroup_setallcolors")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Color))
+			self.lib.lib3mf_colorgroup_setallcolors = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_texture2dgroup_getcount")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -2696,6 +2789,18 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p))
 			self.lib.lib3mf_texture2dgroup_gettexture2d = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_texture2dgroup_getalltex2coords")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Tex2Coord))
+			self.lib.lib3mf_texture2dgroup_getalltex2coords = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_texture2dgroup_setalltex2coords")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Tex2Coord))
+			self.lib.lib3mf_texture2dgroup_setalltex2coords = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_compositematerials_getcount")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4082,6 +4187,48 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
 			self.lib.lib3mf_builditemiterator_count = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_getmeshcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_instancetable_getmeshcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_getmeshobject")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_instancetable_getmeshobject = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_getmeshrange")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_instancetable_getmeshrange = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_getvertices")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Position))
+			self.lib.lib3mf_instancetable_getvertices = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_gettriangles")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Triangle))
+			self.lib.lib3mf_instancetable_gettriangles = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_getinstancecount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_instancetable_getinstancecount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_instancetable_getinstances")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(MeshInstance))
+			self.lib.lib3mf_instancetable_getinstances = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_slice_setvertices")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4196,6 +4343,36 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p)
 			self.lib.lib3mf_slicestack_getownpath = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_slicestack_gettotalslicecount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
+			self.lib.lib3mf_slicestack_gettotalslicecount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_slicestack_gettotalslice")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_slicestack_gettotalslice = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_slicestack_findsliceatz")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_double, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_slicestack_findsliceatz = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_slicestack_getslicerange")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_double, ctypes.c_double, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64))
+			self.lib.lib3mf_slicestack_getslicerange = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_slicestack_validatepolygons")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(SliceLayerReport))
+			self.lib.lib3mf_slicestack_validatepolygons = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_consumer_getconsumerid")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4580,6 +4757,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(Box))
 			self.lib.lib3mf_model_getoutbox = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_model_getinstancetable")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_model_getinstancetable = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_model_getresources")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4868,6 +5051,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_void_p)
 			self.lib.lib3mf_model_removeresource = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_model_deduplicateproperties")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_model_deduplicateproperties = methodType(int(methodAddress.value))
+			
 		except AttributeError as ae:
 			raise ELib3MFException(ErrorCodes.COULDNOTFINDLIBRARYEXPORT, ae.args[0])
 		
@@ -4960,6 +5149,12 @@ class Wrapper:
 			self.lib.lib3mf_writer_getstrictmodeactive.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_getstrictmodeactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
 			
+			self.lib.lib3mf_writer_setincrementalmodeactive.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setincrementalmodeactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_writer_getincrementalmodeactive.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getincrementalmodeactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
 			self.lib.lib3mf_writer_getwarning.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_getwarning.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -4972,6 +5167,9 @@ class Wrapper:
 			self.lib.lib3mf_writer_setcontentencryptioncallback.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_setcontentencryptioncallback.argtypes = [ctypes.c_void_p, ContentEncryptionCallback, ctypes.c_void_p]
 			
+			self.lib.lib3mf_writer_getstatistics.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getstatistics.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
+			
 			self.lib.lib3mf_reader_readfromfile.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_readfromfile.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
 			
@@ -5008,6 +5206,15 @@ class Wrapper:
 			self.lib.lib3mf_reader_setcontentencryptioncallback.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_setcontentencryptioncallback.argtypes = [ctypes.c_void_p, ContentEncryptionCallback, ctypes.c_void_p]
 			
+			self.lib.lib3mf_reader_setinplacedecryptionactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setinplacedecryptionactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_reader_getinplacedecryptionactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getinplacedecryptionactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
+			self.lib.lib3mf_reader_getstatistics.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getstatistics.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
+			
 			self.lib.lib3mf_packagepart_getpath.restype = ctypes.c_int32
 			self.lib.lib3mf_packagepart_getpath.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -5629,6 +5836,12 @@ class Wrapper:
 			self.lib.lib3mf_colorgroup_getcolor.restype = ctypes.c_int32
 			self.lib.lib3mf_colorgroup_getcolor.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Color)]
 			
+			self.lib.lib3mf_colorgroup_getallcolors.restype = ctypes.c_int32
+			self.lib.lib3mf_colorgroup_getallcolors.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Color)]
+			
+			self.lib.lib3mf_colorgroup_setallcolors.restype = ctypes.c_int32
+			self.lib.lib3mf_colorgroup_setallcolors.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Color)]
+			
 			self.lib.lib3mf_texture2dgroup_getcount.restype = ctypes.c_int32
 			self.lib.lib3mf_texture2dgroup_getcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
 			
@@ -5647,6 +5860,12 @@ class Wrapper:
 			self.lib.lib3mf_texture2dgroup_gettexture2d.restype = ctypes.c_int32
 			self.lib.lib3mf_texture2dgroup_gettexture2d.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
+			self.lib.lib3mf_texture2dgroup_getalltex2coords.restype = ctypes.c_int32
+			self.lib.lib3mf_texture2dgroup_getalltex2coords.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Tex2Coord)]
+			
+			self.lib.lib3mf_texture2dgroup_setalltex2coords.restype = ctypes.c_int32
+			self.lib.lib3mf_texture2dgroup_setalltex2coords.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Tex2Coord)]
+			
 			self.lib.lib3mf_compositematerials_getcount.restype = ctypes.c_int32
 			self.lib.lib3mf_compositematerials_getcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
 			
@@ -6340,6 +6559,27 @@ class Wrapper:
 			self.lib.lib3mf_builditemiterator_count.restype = ctypes.c_int32
 			self.lib.lib3mf_builditemiterator_count.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64)]
 			
+			self.lib.lib3mf_instancetable_getmeshcount.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_getmeshcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_instancetable_getmeshobject.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_getmeshobject.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_void_p)]
+			
+			self.lib.lib3mf_instancetable_getmeshrange.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_getmeshrange.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_instancetable_getvertices.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_getvertices.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Position)]
+			
+			self.lib.lib3mf_instancetable_gettriangles.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_gettriangles.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Triangle)]
+			
+			self.lib.lib3mf_instancetable_getinstancecount.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_getinstancecount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_instancetable_getinstances.restype = ctypes.c_int32
+			self.lib.lib3mf_instancetable_getinstances.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(MeshInstance)]
+			
 			self.lib.lib3mf_slice_setvertices.restype = ctypes.c_int32
 			self.lib.lib3mf_slice_setvertices.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Position2D)]
 			
@@ -6397,6 +6637,21 @@ class Wrapper:
 			self.lib.lib3mf_slicestack_getownpath.restype = ctypes.c_int32
 			self.lib.lib3mf_slicestack_getownpath.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
+			self.lib.lib3mf_slicestack_gettotalslicecount.restype = ctypes.c_int32
+			self.lib.lib3mf_slicestack_gettotalslicecount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64)]
+			
+			self.lib.lib3mf_slicestack_gettotalslice.restype = ctypes.c_int32
+			self.lib.lib3mf_slicestack_gettotalslice.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_void_p)]
+			
+			self.lib.lib3mf_slicestack_findsliceatz.restype = ctypes.c_int32
+			self.lib.lib3mf_slicestack_findsliceatz.argtypes = [ctypes.c_void_p, ctypes.c_double, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_bool)]
+			
+			self.lib.lib3mf_slicestack_getslicerange.restype = ctypes.c_int32
+			self.lib.lib3mf_slicestack_getslicerange.argtypes = [ctypes.c_void_p, ctypes.c_double, ctypes.c_double, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
+			
+			self.lib.lib3mf_slicestack_validatepolygons.restype = ctypes.c_int32
+			self.lib.lib3mf_slicestack_validatepolygons.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(SliceLayerReport)]
+			
 			self.lib.lib3mf_consumer_getconsumerid.restype = ctypes.c_int32
 			self.lib.lib3mf_consumer_getconsumerid.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -6589,6 +6844,9 @@ class Wrapper:
 			self.lib.lib3mf_model_getoutbox.restype = ctypes.c_int32
 			self.lib.lib3mf_model_getoutbox.argtypes = [ctypes.c_void_p, ctypes.POINTER(Box)]
 			
+			self.lib.lib3mf_model_getinstancetable.restype = ctypes.c_int32
+			self.lib.lib3mf_model_getinstancetable.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
+			
 			self.lib.lib3mf_model_getresources.restype = ctypes.c_int32
 			self.lib.lib3mf_model_getresources.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
@@ -6733,6 +6991,9 @@ class Wrapper:
 			self.lib.lib3mf_model_removeresource.restype = ctypes.c_int32
 			self.lib.lib3mf_model_removeresource.argtypes = [ctypes.c_void_p, ctypes.c_void_p]
 			
+			self.lib.lib3mf_model_deduplicateproperties.restype = ctypes.c_int32
+			self.lib.lib3mf_model_deduplicateproperties.argtypes = [ctypes.c_void_p, ctypes.c_bool, ctypes.POINTER(ctypes.c_uint32)]
+			
 		except AttributeError as ae:
 			raise ELib3MFException(ErrorCodes.COULDNOTFINDLIBRARYEXPORT, ae.args[0])
 	
@@ -7153,6 +7414,8 @@ class Wrapper:
 				return BuildItem(handle, wrapper)
 			def getObjectById_A7D21BD364910860(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
 				return BuildItemIterator(handle, wrapper)
+			def getObjectById_CDB5C649E208089D(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::InstanceTable"
+				return InstanceTable(handle, wrapper)
 			def getObjectById_2198BCF4D8DF9C40(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::Slice"
 				return Slice(handle, wrapper)
 			def getObjectById_6594B031B6096238(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::SliceStack"
@@ -7259,6 +7522,17 @@ class Writer(Base):
 		
 		return pStrictModeActive.value
 	
+	def SetIncrementalModeActive(self, IncrementalModeActive):
+		bIncrementalModeActive = ctypes.c_bool(IncrementalModeActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setincrementalmodeactive(self._handle, bIncrementalModeActive))
+		
+	
+	def GetIncrementalModeActive(self):
+		pIncrementalModeActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getincrementalmodeactive(self._handle, pIncrementalModeActive))
+		
+		return pIncrementalModeActive.value
+	
 	def GetWarning(self, Index):
 		nIndex = ctypes.c_uint32(Index)
 		pErrorCode = ctypes.c_uint32()
@@ -7289,6 +7563,17 @@ class Writer(Base):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setcontentencryptioncallback(self._handle, TheCallbackFunc, pUserData))
 		
 	
+	def GetStatistics(self):
+		nStatisticsBufferSize = ctypes.c_uint64(0)
+		nStatisticsNeededChars = ctypes.c_uint64(0)
+		pStatisticsBuffer = ctypes.c_char_p(None)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getstatistics(self._handle, nStatisticsBufferSize, nStatisticsNeededChars, pStatisticsBuffer))
+		nStatisticsBufferSize = ctypes.c_uint64(nStatisticsNeededChars.value)
+		pStatisticsBuffer = (ctypes.c_char * (nStatisticsNeededChars.value))()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getstatistics(self._handle, nStatisticsBufferSize, nStatisticsNeededChars, pStatisticsBuffer))
+		
+		return pStatisticsBuffer.value.decode()
+	
 
 
 ''' Class Implementation for Reader
@@ -7369,6 +7654,28 @@ class Reader(Base):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setcontentencryptioncallback(self._handle, TheCallbackFunc, pUserData))
 		
 	
+	def SetInPlaceDecryptionActive(self, InPlaceDecryptionActive):
+		bInPlaceDecryptionActive = ctypes.c_bool(InPlaceDecryptionActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setinplacedecryptionactive(self._handle, bInPlaceDecryptionActive))
+		
+	
+	def GetInPlaceDecryptionActive(self):
+		pInPlaceDecryptionActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getinplacedecryptionactive(self._handle, pInPlaceDecryptionActive))
+		
+		return pInPlaceDecryptionActive.value
+	
+	def GetStatistics(self):
+		nStatisticsBufferSize = ctypes.c_uint64(0)
+		nStatisticsNeededChars = ctypes.c_uint64(0)
+		pStatisticsBuffer = ctypes.c_char_p(None)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getstatistics(self._handle, nStatisticsBufferSize, nStatisticsNeededChars, pStatisticsBuffer))
+		nStatisticsBufferSize = ctypes.c_uint64(nStatisticsNeededChars.value)
+		pStatisticsBuffer = (ctypes.c_char * (nStatisticsNeededChars.value))()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getstatistics(self._handle, nStatisticsBufferSize, nStatisticsNeededChars, pStatisticsBuffer))
+		
+		return pStatisticsBuffer.value.decode()
+	
 
 
 ''' Class Implementation for PackagePart
@@ -9188,6 +9495,23 @@ class ColorGroup(Resource):
 		
 		return pTheColor
 	
+	def GetAllColors(self):
+		nColorsCount = ctypes.c_uint64(0)
+		nColorsNeededCount = ctypes.c_uint64(0)
+		pColorsBuffer = (Color*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_colorgroup_getallcolors(self._handle, nColorsCount, nColorsNeededCount, pColorsBuffer))
+		nColorsCount = ctypes.c_uint64(nColorsNeededCount.value)
+		pColorsBuffer = (Color * nColorsNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_colorgroup_getallcolors(self._handle, nColorsCount, nColorsNeededCount, pColorsBuffer))
+		
+		return [pColorsBuffer[i] for i in range(nColorsNeededCount.value)]
+	
+	def SetAllColors(self, Colors):
+		nColorsCount = ctypes.c_uint64(len(Colors))
+		pColorsBuffer = (Color*len(Colors))(*Colors)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_colorgroup_setallcolors(self._handle, nColorsCount, pColorsBuffer))
+		
+	
 
 
 ''' Class Implementation for Texture2DGroup
@@ -9240,6 +9564,23 @@ class Texture2DGroup(Resource):
 		
 		return Texture2DInstanceObject
 	
+	def GetAllTex2Coords(self):
+		nUVCoordinatesCount = ctypes.c_uint64(0)
+		nUVCoordinatesNeededCount = ctypes.c_uint64(0)
+		pUVCoordinatesBuffer = (Tex2Coord*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_texture2dgroup_getalltex2coords(self._handle, nUVCoordinatesCount, nUVCoordinatesNeededCount, pUVCoordinatesBuffer))
+		nUVCoordinatesCount = ctypes.c_uint64(nUVCoordinatesNeededCount.value)
+		pUVCoordinatesBuffer = (Tex2Coord * nUVCoordinatesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_texture2dgroup_getalltex2coords(self._handle, nUVCoordinatesCount, nUVCoordinatesNeededCount, pUVCoordinatesBuffer))
+		
+		return [pUVCoordinatesBuffer[i] for i in range(nUVCoordinatesNeededCount.value)]
+	
+	def SetAllTex2Coords(self, UVCoordinates):
+		nUVCoordinatesCount = ctypes.c_uint64(len(UVCoordinates))
+		pUVCoordinatesBuffer = (Tex2Coord*len(UVCoordinates))(*UVCoordinates)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_texture2dgroup_setalltex2coords(self._handle, nUVCoordinatesCount, pUVCoordinatesBuffer))
+		
+	
 
 
 ''' Class Implementation for CompositeMaterials
@@ -11898,6 +12239,79 @@ class BuildItemIterator(Base):
 	
 
 
+''' Class Implementation for InstanceTable
+'''
+class InstanceTable(Base):
+	def __init__(self, handle, wrapper):
+		Base.__init__(self, handle, wrapper)
+	def GetMeshCount(self):
+		pCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getmeshcount(self._handle, pCount))
+		
+		return pCount.value
+	
+	def GetMeshObject(self, MeshIndex):
+		nMeshIndex = ctypes.c_uint32(MeshIndex)
+		MeshObjectHandle = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getmeshobject(self._handle, nMeshIndex, MeshObjectHandle))
+		if MeshObjectHandle:
+			MeshObjectObject = self._wrapper._polymorphicFactory(MeshObjectHandle)
+		else:
+			raise ELib3MFException(ErrorCodes.INVALIDCAST, 'Invalid return/output value')
+		
+		return MeshObjectObject
+	
+	def GetMeshRange(self, MeshIndex):
+		nMeshIndex = ctypes.c_uint32(MeshIndex)
+		pVertexOffset = ctypes.c_uint32()
+		pVertexCount = ctypes.c_uint32()
+		pTriangleOffset = ctypes.c_uint32()
+		pTriangleCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getmeshrange(self._handle, nMeshIndex, pVertexOffset, pVertexCount, pTriangleOffset, pTriangleCount))
+		
+		return pVertexOffset.value, pVertexCount.value, pTriangleOffset.value, pTriangleCount.value
+	
+	def GetVertices(self):
+		nVerticesCount = ctypes.c_uint64(0)
+		nVerticesNeededCount = ctypes.c_uint64(0)
+		pVerticesBuffer = (Position*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getvertices(self._handle, nVerticesCount, nVerticesNeededCount, pVerticesBuffer))
+		nVerticesCount = ctypes.c_uint64(nVerticesNeededCount.value)
+		pVerticesBuffer = (Position * nVerticesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getvertices(self._handle, nVerticesCount, nVerticesNeededCount, pVerticesBuffer))
+		
+		return [pVerticesBuffer[i] for i in range(nVerticesNeededCount.value)]
+	
+	def GetTriangles(self):
+		nTrianglesCount = ctypes.c_uint64(0)
+		nTrianglesNeededCount = ctypes.c_uint64(0)
+		pTrianglesBuffer = (Triangle*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_gettriangles(self._handle, nTrianglesCount, nTrianglesNeededCount, pTrianglesBuffer))
+		nTrianglesCount = ctypes.c_uint64(nTrianglesNeededCount.value)
+		pTrianglesBuffer = (Triangle * nTrianglesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_gettriangles(self._handle, nTrianglesCount, nTrianglesNeededCount, pTrianglesBuffer))
+		
+		return [pTrianglesBuffer[i] for i in range(nTrianglesNeededCount.value)]
+	
+	def GetInstanceCount(self):
+		pCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getinstancecount(self._handle, pCount))
+		
+		return pCount.value
+	
+	def GetInstances(self):
+		nInstancesCount = ctypes.c_uint64(0)
+		nInstancesNeededCount = ctypes.c_uint64(0)
+		pInstancesBuffer = (MeshInstance*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getinstances(self._handle, nInstancesCount, nInstancesNeededCount, pInstancesBuffer))
+		nInstancesCount = ctypes.c_uint64(nInstancesNeededCount.value)
+		pInstancesBuffer = (MeshInstance * nInstancesNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_instancetable_getinstances(self._handle, nInstancesCount, nInstancesNeededCount, pInstancesBuffer))
+		
+		return [pInstancesBuffer[i] for i in range(nInstancesNeededCount.value)]
+	
+
+
 ''' Class Implementation for Slice
 '''
 class Slice(Base):
@@ -12059,6 +12473,51 @@ class SliceStack(Resource):
 		
 		return pPathBuffer.value.decode()
 	
+	def GetTotalSliceCount(self):
+		pCount = ctypes.c_uint64()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_slicestack_gettotalslicecount(self._handle, pCount))
+		
+		return pCount.value
+	
+	def GetTotalSlice(self, TotalSliceIndex):
+		nTotalSliceIndex = ctypes.c_uint64(TotalSliceIndex)
+		TheSliceHandle = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_slicestack_gettotalslice(self._handle, nTotalSliceIndex, TheSliceHandle))
+		if TheSliceHandle:
+			TheSliceObject = self._wrapper._polymorphicFactory(TheSliceHandle)
+		else:
+			raise ELib3MFException(ErrorCodes.INVALIDCAST, 'Invalid return/output value')
+		
+		return TheSliceObject
+	
+	def FindSliceAtZ(self, ZValue):
+		dZValue = ctypes.c_double(ZValue)
+		pTotalSliceIndex = ctypes.c_uint64()
+		pFound = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_slicestack_findsliceatz(self._handle, dZValue, pTotalSliceIndex, pFound))
+		
+		return pTotalSliceIndex.value, pFound.value
+	
+	def GetSliceRange(self, ZMin, ZMax):
+		dZMin = ctypes.c_double(ZMin)
+		dZMax = ctypes.c_double(ZMax)
+		pFirstIndex = ctypes.c_uint64()
+		pCount = ctypes.c_uint64()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_slicestack_getslicerange(self._handle, dZMin, dZMax, pFirstIndex, pCount))
+		
+		return pFirstIndex.value, pCount.value
+	
+	def ValidatePolygons(self):
+		nLayerReportsCount = ctypes.c_uint64(0)
+		nLayerReportsNeededCount = ctypes.c_uint64(0)
+		pLayerReportsBuffer = (SliceLayerReport*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_slicestack_validatepolygons(self._handle, nLayerReportsCount, nLayerReportsNeededCount, pLayerReportsBuffer))
+		nLayerReportsCount = ctypes.c_uint64(nLayerReportsNeededCount.value)
+		pLayerReportsBuffer = (SliceLayerReport * nLayerReportsNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_slicestack_validatepolygons(self._handle, nLayerReportsCount, nLayerReportsNeededCount, pLayerReportsBuffer))
+		
+		return [pLayerReportsBuffer[i] for i in range(nLayerReportsNeededCount.value)]
+	
 
 
 ''' Class Implementation for Consumer
@@ -12736,6 +13195,16 @@ class Model(Base):
 		
 		return pOutbox
 	
+	def GetInstanceTable(self):
+		InstanceTableHandle = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_getinstancetable(self._handle, InstanceTableHandle))
+		if InstanceTableHandle:
+			InstanceTableObject = self._wrapper._polymorphicFactory(InstanceTableHandle)
+		else:
+			raise ELib3MFException(ErrorCodes.INVALIDCAST, 'Invalid return/output value')
+		
+		return InstanceTableObject
+	
 	def GetResources(self):
 		ResourceIteratorHandle = ctypes.c_void_p()
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_getresources(self._handle, ResourceIteratorHandle))
@@ -13218,4 +13687,11 @@ class Model(Base):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_removeresource(self._handle, ResourceHandle))
 		
 	
+	def DeduplicateProperties(self, RemoveUnreferenced):
+		bRemoveUnreferenced = ctypes.c_bool(RemoveUnreferenced)
+		pRemovedCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_model_deduplicateproperties(self._handle, bRemoveUnreferenced, pRemovedCount))
+		
+		return pRemovedCount.value
+	
 		
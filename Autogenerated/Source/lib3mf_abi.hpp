@@ -156,6 +156,24 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setstrictmodeactive(Lib3MF_Writer pWr
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getstrictmodeactive(Lib3MF_Writer pWriter, bool * pStrictModeActive);
 
+/**
+* Activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] bIncrementalModeActive - flag whether incremental mode is active or not.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setincrementalmodeactive(Lib3MF_Writer pWriter, bool bIncrementalModeActive);
+
+/**
+* Queries whether the incremental mode of the writer is active or not
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pIncrementalModeActive - returns flag whether incremental mode is active or not.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getincrementalmodeactive(Lib3MF_Writer pWriter, bool * pIncrementalModeActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -199,6 +217,17 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_addkeywrappingcallback(Lib3MF_Writer
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setcontentencryptioncallback(Lib3MF_Writer pWriter, Lib3MF::ContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nStatisticsBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStatisticsNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStatisticsBuffer -  buffer of JSON document with the collected statistics, may be NULL
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getstatistics(Lib3MF_Writer pWriter, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer);
+
 /*************************************************************************************************************************
  Class definition for Reader
 **************************************************************************************************************************/
@@ -323,6 +352,35 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_addkeywrappingcallback(Lib3MF_Reader
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setcontentencryptioncallback(Lib3MF_Reader pReader, Lib3MF::ContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData);
 
+/**
+* Activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bInPlaceDecryptionActive - flag whether in-place decryption is active or not.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setinplacedecryptionactive(Lib3MF_Reader pReader, bool bInPlaceDecryptionActive);
+
+/**
+* Queries whether in-place decryption of the reader is active or not
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pInPlaceDecryptionActive - returns flag whether in-place decryption is active or not.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getinplacedecryptionactive(Lib3MF_Reader pReader, bool * pInPlaceDecryptionActive);
+
+/**
+* Returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nStatisticsBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStatisticsNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStatisticsBuffer -  buffer of JSON document with the collected statistics, may be NULL
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getstatistics(Lib3MF_Reader pReader, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer);
+
 /*************************************************************************************************************************
  Class definition for PackagePart
 **************************************************************************************************************************/
@@ -2440,6 +2498,27 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_colorgroup_setcolor(Lib3MF_ColorGroup pColor
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_colorgroup_getcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID, Lib3MF::sColor * pTheColor);
 
+/**
+* Returns all colors of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pColorGroup - ColorGroup instance.
+* @param[in] nColorsBufferSize - Number of elements in buffer
+* @param[out] pColorsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pColorsBuffer - Color  buffer of contains the colors of the group.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_colorgroup_getallcolors(Lib3MF_ColorGroup pColorGroup, const Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, Lib3MF::sColor * pColorsBuffer);
+
+/**
+* Sets all colors of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pColorGroup - ColorGroup instance.
+* @param[in] nColorsBufferSize - Number of elements in buffer
+* @param[in] pColorsBuffer - Color buffer of contains the new colors. Must have GetCount elements.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_colorgroup_setallcolors(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint64 nColorsBufferSize, const Lib3MF::sColor * pColorsBuffer);
+
 /*************************************************************************************************************************
  Class definition for Texture2DGroup
 **************************************************************************************************************************/
@@ -2502,6 +2581,27 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_texture2dgroup_removetex2coord(Lib3MF_Textur
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_texture2dgroup_gettexture2d(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_Texture2D * pTexture2DInstance);
 
+/**
+* Returns all tex2coords of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pTexture2DGroup - Texture2DGroup instance.
+* @param[in] nUVCoordinatesBufferSize - Number of elements in buffer
+* @param[out] pUVCoordinatesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pUVCoordinatesBuffer - Tex2Coord  buffer of contains the u/v-coordinates of the group.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_texture2dgroup_getalltex2coords(Lib3MF_Texture2DGroup pTexture2DGroup, const Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, Lib3MF::sTex2Coord * pUVCoordinatesBuffer);
+
+/**
+* Sets all tex2coords of this group in the order of GetAllPropertyIDs.
+*
+* @param[in] pTexture2DGroup - Texture2DGroup instance.
+* @param[in] nUVCoordinatesBufferSize - Number of elements in buffer
+* @param[in] pUVCoordinatesBuffer - Tex2Coord buffer of contains the new u/v-coordinates. Must have GetCount elements.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_texture2dgroup_setalltex2coords(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint64 nUVCoordinatesBufferSize, const Lib3MF::sTex2Coord * pUVCoordinatesBuffer);
+
 /*************************************************************************************************************************
  Class definition for CompositeMaterials
 **************************************************************************************************************************/
@@ -5122,6 +5222,84 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_builditemiterator_clone(Lib3MF_BuildItemIter
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_builditemiterator_count(Lib3MF_BuildItemIterator pBuildItemIterator, Lib3MF_uint64 * pCount);
 
+/*************************************************************************************************************************
+ Class definition for InstanceTable
+**************************************************************************************************************************/
+
+/**
+* Returns the number of unique mesh objects referenced by the build items.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[out] pCount - the number of unique mesh objects
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_getmeshcount(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount);
+
+/**
+* Returns a unique mesh object of the table.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nMeshIndex - index of the mesh object (0-based)
+* @param[out] pMeshObject - the mesh object
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_getmeshobject(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_MeshObject * pMeshObject);
+
+/**
+* Returns the location of a unique mesh object within the packed vertex and triangle buffers.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nMeshIndex - index of the mesh object (0-based)
+* @param[out] pVertexOffset - index of the first vertex of the mesh object in the vertex buffer
+* @param[out] pVertexCount - number of vertices of the mesh object
+* @param[out] pTriangleOffset - index of the first triangle of the mesh object in the triangle buffer
+* @param[out] pTriangleCount - number of triangles of the mesh object
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_getmeshrange(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 * pVertexOffset, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pTriangleOffset, Lib3MF_uint32 * pTriangleCount);
+
+/**
+* Returns the vertices of all unique mesh objects, packed in mesh order.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nVerticesBufferSize - Number of elements in buffer
+* @param[out] pVerticesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pVerticesBuffer - Position  buffer of the packed vertex positions
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_getvertices(Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer);
+
+/**
+* Returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nTrianglesBufferSize - Number of elements in buffer
+* @param[out] pTrianglesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTrianglesBuffer - Triangle  buffer of the packed triangles
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_gettriangles(Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, Lib3MF::sTriangle * pTrianglesBuffer);
+
+/**
+* Returns the number of mesh instances placed by the build items.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[out] pCount - the number of mesh instances
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_getinstancecount(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount);
+
+/**
+* Returns all mesh instances placed by the build items, in build item order.
+*
+* @param[in] pInstanceTable - InstanceTable instance.
+* @param[in] nInstancesBufferSize - Number of elements in buffer
+* @param[out] pInstancesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pInstancesBuffer - MeshInstance  buffer of the mesh instances with their accumulated transforms
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_instancetable_getinstances(Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, Lib3MF::sMeshInstance * pInstancesBuffer);
+
 /*************************************************************************************************************************
  Class definition for Slice
 **************************************************************************************************************************/
@@ -5316,6 +5494,59 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_setownpath(Lib3MF_SliceStack pSli
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_getownpath(Lib3MF_SliceStack pSliceStack, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer);
 
+/**
+* Returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[out] pCount - the number of slices in the slice view
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_gettotalslicecount(Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 * pCount);
+
+/**
+* Queries a slice from the slice view of this slice stack without collapsing its slice refs.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] nTotalSliceIndex - the index of the slice in the slice view
+* @param[out] pTheSlice - the Slice instance
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_gettotalslice(Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 nTotalSliceIndex, Lib3MF_Slice * pTheSlice);
+
+/**
+* Finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] dZValue - the Z-coordinate to look up
+* @param[out] pTotalSliceIndex - the index of the slice in the slice view, if one was found
+* @param[out] pFound - true, if a slice contains the Z-coordinate
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_findsliceatz(Lib3MF_SliceStack pSliceStack, Lib3MF_double dZValue, Lib3MF_uint64 * pTotalSliceIndex, bool * pFound);
+
+/**
+* Returns the range of slices of the slice view that intersect a Z-interval.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] dZMin - the lower Z-coordinate of the interval
+* @param[in] dZMax - the upper Z-coordinate of the interval
+* @param[out] pFirstIndex - the index of the first slice in the slice view that intersects the interval
+* @param[out] pCount - the number of slices that intersect the interval
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_getslicerange(Lib3MF_SliceStack pSliceStack, Lib3MF_double dZMin, Lib3MF_double dZMax, Lib3MF_uint64 * pFirstIndex, Lib3MF_uint64 * pCount);
+
+/**
+* Validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+*
+* @param[in] pSliceStack - SliceStack instance.
+* @param[in] nLayerReportsBufferSize - Number of elements in buffer
+* @param[out] pLayerReportsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pLayerReportsBuffer - SliceLayerReport  buffer of the reports of the layers with issues, in ascending layer order
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_slicestack_validatepolygons(Lib3MF_SliceStack pSliceStack, const Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, sLib3MFSliceLayerReport * pLayerReportsBuffer);
+
 /*************************************************************************************************************************
  Class definition for Consumer
 **************************************************************************************************************************/
@@ -5984,6 +6215,15 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getbuilditems(Lib3MF_Model pModel, Lib
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getoutbox(Lib3MF_Model pModel, Lib3MF::sBox * pOutbox);
 
+/**
+* Flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+*
+* @param[in] pModel - Model instance.
+* @param[out] pInstanceTable - the instance table of the current build
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getinstancetable(Lib3MF_Model pModel, Lib3MF_InstanceTable * pInstanceTable);
+
 /**
 * creates a resource iterator instance with all resources.
 *
@@ -6432,6 +6672,16 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_getlevelsets(Lib3MF_Model pModel, Lib3
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_removeresource(Lib3MF_Model pModel, Lib3MF_Resource pResource);
 
+/**
+* Merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+*
+* @param[in] pModel - Model instance.
+* @param[in] bRemoveUnreferenced - If true, entries that are not referenced by any triangle or multiproperty are removed as well. Groups that are not referenced at all are left untouched.
+* @param[out] pRemovedCount - Number of removed entries.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_model_deduplicateproperties(Lib3MF_Model pModel, bool bRemoveUnreferenced, Lib3MF_uint32 * pRemovedCount);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
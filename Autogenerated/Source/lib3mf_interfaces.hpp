@@ -158,6 +158,7 @@ class IImplicitFunction;
 class IFunctionFromImage3D;
 class IBuildItem;
 class IBuildItemIterator;
+class IInstanceTable;
 class ISlice;
 class ISliceStack;
 class IConsumer;
@@ -447,6 +448,18 @@ public:
 	*/
 	virtual bool GetStrictModeActive() = 0;
 
+	/**
+	* IWriter::SetIncrementalModeActive - Activates (deactivates) the incremental mode of the writer. In incremental mode, parts of a model read from a file are copied as compressed ZIP entries from that file, if they have not been modified.
+	* @param[in] bIncrementalModeActive - flag whether incremental mode is active or not.
+	*/
+	virtual void SetIncrementalModeActive(const bool bIncrementalModeActive) = 0;
+
+	/**
+	* IWriter::GetIncrementalModeActive - Queries whether the incremental mode of the writer is active or not
+	* @return returns flag whether incremental mode is active or not.
+	*/
+	virtual bool GetIncrementalModeActive() = 0;
+
 	/**
 	* IWriter::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -476,6 +489,12 @@ public:
 	*/
 	virtual void SetContentEncryptionCallback(const Lib3MF::ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData) = 0;
 
+	/**
+	* IWriter::GetStatistics - Returns the statistics of the last write as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	* @return JSON document with the collected statistics
+	*/
+	virtual std::string GetStatistics() = 0;
+
 };
 
 typedef IBaseSharedPtr<IWriter> PIWriter;
@@ -578,6 +597,24 @@ public:
 	*/
 	virtual void SetContentEncryptionCallback(const Lib3MF::ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData) = 0;
 
+	/**
+	* IReader::SetInPlaceDecryptionActive - Activates (deactivates) in-place decryption of the reader. If active, the content encryption callback receives the same buffer as cipher and plain text and has to decrypt in place.
+	* @param[in] bInPlaceDecryptionActive - flag whether in-place decryption is active or not.
+	*/
+	virtual void SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive) = 0;
+
+	/**
+	* IReader::GetInPlaceDecryptionActive - Queries whether in-place decryption of the reader is active or not
+	* @return returns flag whether in-place decryption is active or not.
+	*/
+	virtual bool GetInPlaceDecryptionActive() = 0;
+
+	/**
+	* IReader::GetStatistics - Returns the statistics of the last read as JSON document. Lists wall time, bytes, elements, allocations and ZIP, XML and number parsing time per package part and progress phase.
+	* @return JSON document with the collected statistics
+	*/
+	virtual std::string GetStatistics() = 0;
+
 };
 
 typedef IBaseSharedPtr<IReader> PIReader;
@@ -2582,6 +2619,21 @@ public:
 	*/
 	virtual Lib3MF::sColor GetColor(const Lib3MF_uint32 nPropertyID) = 0;
 
+	/**
+	* IColorGroup::GetAllColors - Returns all colors of this group in the order of GetAllPropertyIDs.
+	* @param[in] nColorsBufferSize - Number of elements in buffer
+	* @param[out] pColorsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pColorsBuffer - Color buffer of contains the colors of the group.
+	*/
+	virtual void GetAllColors(Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, Lib3MF::sColor * pColorsBuffer) = 0;
+
+	/**
+	* IColorGroup::SetAllColors - Sets all colors of this group in the order of GetAllPropertyIDs.
+	* @param[in] nColorsBufferSize - Number of elements in buffer
+	* @param[in] pColorsBuffer - Color buffer of contains the new colors. Must have GetCount elements.
+	*/
+	virtual void SetAllColors(const Lib3MF_uint64 nColorsBufferSize, const Lib3MF::sColor * pColorsBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IColorGroup> PIColorGroup;
@@ -2642,6 +2694,21 @@ public:
 	*/
 	virtual ITexture2D * GetTexture2D() = 0;
 
+	/**
+	* ITexture2DGroup::GetAllTex2Coords - Returns all tex2coords of this group in the order of GetAllPropertyIDs.
+	* @param[in] nUVCoordinatesBufferSize - Number of elements in buffer
+	* @param[out] pUVCoordinatesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pUVCoordinatesBuffer - Tex2Coord buffer of contains the u/v-coordinates of the group.
+	*/
+	virtual void GetAllTex2Coords(Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, Lib3MF::sTex2Coord * pUVCoordinatesBuffer) = 0;
+
+	/**
+	* ITexture2DGroup::SetAllTex2Coords - Sets all tex2coords of this group in the order of GetAllPropertyIDs.
+	* @param[in] nUVCoordinatesBufferSize - Number of elements in buffer
+	* @param[in] pUVCoordinatesBuffer - Tex2Coord buffer of contains the new u/v-coordinates. Must have GetCount elements.
+	*/
+	virtual void SetAllTex2Coords(const Lib3MF_uint64 nUVCoordinatesBufferSize, const Lib3MF::sTex2Coord * pUVCoordinatesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<ITexture2DGroup> PITexture2DGroup;
@@ -5652,6 +5719,79 @@ public:
 typedef IBaseSharedPtr<IBuildItemIterator> PIBuildItemIterator;
 
 
+/*************************************************************************************************************************
+ Class interface for InstanceTable 
+**************************************************************************************************************************/
+
+class IInstanceTable : public virtual IBase {
+public:
+	/**
+	* IInstanceTable::ClassTypeId - Get Class Type Id
+	* @return Class type as a 64 bits integer
+	*/
+	Lib3MF_uint64 ClassTypeId() override
+	{
+		return 0xCDB5C649E208089DUL; // First 64 bits of SHA1 of a string: "Lib3MF::InstanceTable"
+	}
+
+	/**
+	* IInstanceTable::GetMeshCount - Returns the number of unique mesh objects referenced by the build items.
+	* @return the number of unique mesh objects
+	*/
+	virtual Lib3MF_uint32 GetMeshCount() = 0;
+
+	/**
+	* IInstanceTable::GetMeshObject - Returns a unique mesh object of the table.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @return the mesh object
+	*/
+	virtual IMeshObject * GetMeshObject(const Lib3MF_uint32 nMeshIndex) = 0;
+
+	/**
+	* IInstanceTable::GetMeshRange - Returns the location of a unique mesh object within the packed vertex and triangle buffers.
+	* @param[in] nMeshIndex - index of the mesh object (0-based)
+	* @param[out] nVertexOffset - index of the first vertex of the mesh object in the vertex buffer
+	* @param[out] nVertexCount - number of vertices of the mesh object
+	* @param[out] nTriangleOffset - index of the first triangle of the mesh object in the triangle buffer
+	* @param[out] nTriangleCount - number of triangles of the mesh object
+	*/
+	virtual void GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount) = 0;
+
+	/**
+	* IInstanceTable::GetVertices - Returns the vertices of all unique mesh objects, packed in mesh order.
+	* @param[in] nVerticesBufferSize - Number of elements in buffer
+	* @param[out] pVerticesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pVerticesBuffer - Position buffer of the packed vertex positions
+	*/
+	virtual void GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer) = 0;
+
+	/**
+	* IInstanceTable::GetTriangles - Returns the triangles of all unique mesh objects, packed in mesh order. The vertex indices of a triangle are relative to the vertex offset of its mesh object.
+	* @param[in] nTrianglesBufferSize - Number of elements in buffer
+	* @param[out] pTrianglesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pTrianglesBuffer - Triangle buffer of the packed triangles
+	*/
+	virtual void GetTriangles(Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, Lib3MF::sTriangle * pTrianglesBuffer) = 0;
+
+	/**
+	* IInstanceTable::GetInstanceCount - Returns the number of mesh instances placed by the build items.
+	* @return the number of mesh instances
+	*/
+	virtual Lib3MF_uint32 GetInstanceCount() = 0;
+
+	/**
+	* IInstanceTable::GetInstances - Returns all mesh instances placed by the build items, in build item order.
+	* @param[in] nInstancesBufferSize - Number of elements in buffer
+	* @param[out] pInstancesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pInstancesBuffer - MeshInstance buffer of the mesh instances with their accumulated transforms
+	*/
+	virtual void GetInstances(Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, Lib3MF::sMeshInstance * pInstancesBuffer) = 0;
+
+};
+
+typedef IBaseSharedPtr<IInstanceTable> PIInstanceTable;
+
+
 /*************************************************************************************************************************
  Class interface for Slice 
 **************************************************************************************************************************/
@@ -5814,6 +5954,44 @@ public:
 	*/
 	virtual std::string GetOwnPath() = 0;
 
+	/**
+	* ISliceStack::GetTotalSliceCount - Returns the number of slices in the slice view of this slice stack, i.e. its own slices or, if it has slice refs, the slices of all referenced slice stacks.
+	* @return the number of slices in the slice view
+	*/
+	virtual Lib3MF_uint64 GetTotalSliceCount() = 0;
+
+	/**
+	* ISliceStack::GetTotalSlice - Queries a slice from the slice view of this slice stack without collapsing its slice refs.
+	* @param[in] nTotalSliceIndex - the index of the slice in the slice view
+	* @return the Slice instance
+	*/
+	virtual ISlice * GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex) = 0;
+
+	/**
+	* ISliceStack::FindSliceAtZ - Finds the slice of the slice view that contains a Z-coordinate, i.e. the slice whose lower Z-coordinate lies below and whose upper Z-coordinate lies at or above the given value.
+	* @param[in] dZValue - the Z-coordinate to look up
+	* @param[out] nTotalSliceIndex - the index of the slice in the slice view, if one was found
+	* @return true, if a slice contains the Z-coordinate
+	*/
+	virtual bool FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex) = 0;
+
+	/**
+	* ISliceStack::GetSliceRange - Returns the range of slices of the slice view that intersect a Z-interval.
+	* @param[in] dZMin - the lower Z-coordinate of the interval
+	* @param[in] dZMax - the upper Z-coordinate of the interval
+	* @param[out] nFirstIndex - the index of the first slice in the slice view that intersects the interval
+	* @param[out] nCount - the number of slices that intersect the interval
+	*/
+	virtual void GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount) = 0;
+
+	/**
+	* ISliceStack::ValidatePolygons - Validates the polygons of all slices in the slice view of this slice stack in parallel. Checks that polygons are closed and not degenerate, that closed contours do not intersect, and that every contour is oriented opposite to the contour it is nested in. Only layers with issues are reported.
+	* @param[in] nLayerReportsBufferSize - Number of elements in buffer
+	* @param[out] pLayerReportsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pLayerReportsBuffer - SliceLayerReport buffer of the reports of the layers with issues, in ascending layer order
+	*/
+	virtual void ValidatePolygons(Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, Lib3MF::sSliceLayerReport * pLayerReportsBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<ISliceStack> PISliceStack;
@@ -6386,6 +6564,12 @@ public:
 	*/
 	virtual Lib3MF::sBox GetOutbox() = 0;
 
+	/**
+	* IModel::GetInstanceTable - Flattens the build items into unique mesh objects with packed geometry buffers and their instances with accumulated transforms. Components objects are resolved; geometry of meshes referenced several times is stored once.
+	* @return the instance table of the current build
+	*/
+	virtual IInstanceTable * GetInstanceTable() = 0;
+
 	/**
 	* IModel::GetResources - creates a resource iterator instance with all resources.
 	* @return returns the iterator instance.
@@ -6690,6 +6874,13 @@ public:
 	*/
 	virtual void RemoveResource(IResource* pResource) = 0;
 
+	/**
+	* IModel::DeduplicateProperties - Merges equal entries of color and texture coordinate groups, remaps all references to them and removes the duplicate entries.
+	* @param[in] bRemoveUnreferenced - If true, entries that are not referenced by any triangle or multiproperty are removed as well. Groups that are not referenced at all are left untouched.
+	* @return Number of removed entries.
+	*/
+	virtual Lib3MF_uint32 DeduplicateProperties(const bool bRemoveUnreferenced) = 0;
+
 };
 
 typedef IBaseSharedPtr<IModel> PIModel;
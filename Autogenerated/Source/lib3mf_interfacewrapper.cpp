@@ -424,6 +424,72 @@ Lib3MFResult lib3mf_writer_getstrictmodeactive(Lib3MF_Writer pWriter, bool * pSt
 	}
 }
 
+Lib3MFResult lib3mf_writer_setincrementalmodeactive(Lib3MF_Writer pWriter, bool bIncrementalModeActive)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetIncrementalModeActive");
+			pJournalEntry->addBooleanParameter("IncrementalModeActive", bIncrementalModeActive);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetIncrementalModeActive(bIncrementalModeActive);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getincrementalmodeactive(Lib3MF_Writer pWriter, bool * pIncrementalModeActive)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetIncrementalModeActive");
+		}
+		if (pIncrementalModeActive == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pIncrementalModeActive = pIWriter->GetIncrementalModeActive();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("IncrementalModeActive", *pIncrementalModeActive);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 Lib3MFResult lib3mf_writer_getwarning(Lib3MF_Writer pWriter, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pWriter;
@@ -586,6 +652,62 @@ Lib3MFResult lib3mf_writer_setcontentencryptioncallback(Lib3MF_Writer pWriter, L
 	}
 }
 
+Lib3MFResult lib3mf_writer_getstatistics(Lib3MF_Writer pWriter, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetStatistics");
+		}
+		if ( (!pStatisticsBuffer) && !(pStatisticsNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sStatistics("");
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pStatisticsBuffer == nullptr);
+		if (isCacheCall) {
+			sStatistics = pIWriter->GetStatistics();
+
+			pIWriter->_setCache (new ParameterCache_1<std::string> (sStatistics));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIWriter->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sStatistics);
+			pIWriter->_setCache (nullptr);
+		}
+		
+		if (pStatisticsNeededChars)
+			*pStatisticsNeededChars = (Lib3MF_uint32) (sStatistics.size()+1);
+		if (pStatisticsBuffer) {
+			if (sStatistics.size() >= nStatisticsBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iStatistics = 0; iStatistics < sStatistics.size(); iStatistics++)
+				pStatisticsBuffer[iStatistics] = sStatistics[iStatistics];
+			pStatisticsBuffer[sStatistics.size()] = 0;
+		}
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Statistics", sStatistics.c_str());
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for Reader
@@ -1021,6 +1143,128 @@ Lib3MFResult lib3mf_reader_setcontentencryptioncallback(Lib3MF_Reader pReader, L
 	}
 }
 
+Lib3MFResult lib3mf_reader_setinplacedecryptionactive(Lib3MF_Reader pReader, bool bInPlaceDecryptionActive)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetInPlaceDecryptionActive");
+			pJournalEntry->addBooleanParameter("InPlaceDecryptionActive", bInPlaceDecryptionActive);
+		}
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIReader->SetInPlaceDecryptionActive(bInPlaceDecryptionActive);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_getinplacedecryptionactive(Lib3MF_Reader pReader, bool * pInPlaceDecryptionActive)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetInPlaceDecryptionActive");
+		}
+		if (pInPlaceDecryptionActive == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pInPlaceDecryptionActive = pIReader->GetInPlaceDecryptionActive();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("InPlaceDecryptionActive", *pInPlaceDecryptionActive);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_reader_getstatistics(Lib3MF_Reader pReader, const Lib3MF_uint32 nStatisticsBufferSize, Lib3MF_uint32* pStatisticsNeededChars, char * pStatisticsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pReader;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetStatistics");
+		}
+		if ( (!pStatisticsBuffer) && !(pStatisticsNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sStatistics("");
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pStatisticsBuffer == nullptr);
+		if (isCacheCall) {
+			sStatistics = pIReader->GetStatistics();
+
+			pIReader->_setCache (new ParameterCache_1<std::string> (sStatistics));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIReader->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sStatistics);
+			pIReader->_setCache (nullptr);
+		}
+		
+		if (pStatisticsNeededChars)
+			*pStatisticsNeededChars = (Lib3MF_uint32) (sStatistics.size()+1);
+		if (pStatisticsBuffer) {
+			if (sStatistics.size() >= nStatisticsBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iStatistics = 0; iStatistics < sStatistics.size(); iStatistics++)
+				pStatisticsBuffer[iStatistics] = sStatistics[iStatistics];
+			pStatisticsBuffer[sStatistics.size()] = 0;
+		}
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Statistics", sStatistics.c_str());
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for PackagePart
@@ -8724,6 +8968,72 @@ Lib3MFResult lib3mf_colorgroup_getcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_ui
 	}
 }
 
+Lib3MFResult lib3mf_colorgroup_getallcolors(Lib3MF_ColorGroup pColorGroup, const Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, sLib3MFColor * pColorsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pColorGroup;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetAllColors");
+		}
+		if ((!pColorsBuffer) && !(pColorsNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIColorGroup->GetAllColors(nColorsBufferSize, pColorsNeededCount, pColorsBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_colorgroup_setallcolors(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint64 nColorsBufferSize, const sLib3MFColor * pColorsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pColorGroup;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "SetAllColors");
+		}
+		if ( (!pColorsBuffer) && (nColorsBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIColorGroup->SetAllColors(nColorsBufferSize, pColorsBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for Texture2DGroup
@@ -8931,13 +9241,79 @@ Lib3MFResult lib3mf_texture2dgroup_gettexture2d(Lib3MF_Texture2DGroup pTexture2D
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for CompositeMaterials
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_compositematerials_getcount(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_texture2dgroup_getalltex2coords(Lib3MF_Texture2DGroup pTexture2DGroup, const Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, sLib3MFTex2Coord * pUVCoordinatesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetAllTex2Coords");
+		}
+		if ((!pUVCoordinatesBuffer) && !(pUVCoordinatesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pITexture2DGroup->GetAllTex2Coords(nUVCoordinatesBufferSize, pUVCoordinatesNeededCount, pUVCoordinatesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_texture2dgroup_setalltex2coords(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint64 nUVCoordinatesBufferSize, const sLib3MFTex2Coord * pUVCoordinatesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "SetAllTex2Coords");
+		}
+		if ( (!pUVCoordinatesBuffer) && (nUVCoordinatesBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pITexture2DGroup->SetAllTex2Coords(nUVCoordinatesBufferSize, pUVCoordinatesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for CompositeMaterials
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_compositematerials_getcount(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 * pCount)
+{
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
@@ -18335,6 +18711,258 @@ Lib3MFResult lib3mf_builditemiterator_count(Lib3MF_BuildItemIterator pBuildItemI
 }
 
 
+
+/*************************************************************************************************************************
+ Class implementation for InstanceTable
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_instancetable_getmeshcount(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetMeshCount");
+		}
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCount = pIInstanceTable->GetMeshCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_instancetable_getmeshobject(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_MeshObject * pMeshObject)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetMeshObject");
+			pJournalEntry->addUInt32Parameter("MeshIndex", nMeshIndex);
+		}
+		if (pMeshObject == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseMeshObject(nullptr);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseMeshObject = pIInstanceTable->GetMeshObject(nMeshIndex);
+
+		*pMeshObject = (IBase*)(pBaseMeshObject);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("MeshObject", *pMeshObject);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_instancetable_getmeshrange(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 * pVertexOffset, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pTriangleOffset, Lib3MF_uint32 * pTriangleCount)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetMeshRange");
+			pJournalEntry->addUInt32Parameter("MeshIndex", nMeshIndex);
+		}
+		if (!pVertexOffset)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pVertexCount)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pTriangleOffset)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pTriangleCount)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIInstanceTable->GetMeshRange(nMeshIndex, *pVertexOffset, *pVertexCount, *pTriangleOffset, *pTriangleCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("VertexOffset", *pVertexOffset);
+			pJournalEntry->addUInt32Result("VertexCount", *pVertexCount);
+			pJournalEntry->addUInt32Result("TriangleOffset", *pTriangleOffset);
+			pJournalEntry->addUInt32Result("TriangleCount", *pTriangleCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_instancetable_getvertices(Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetVertices");
+		}
+		if ((!pVerticesBuffer) && !(pVerticesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIInstanceTable->GetVertices(nVerticesBufferSize, pVerticesNeededCount, pVerticesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_instancetable_gettriangles(Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, sLib3MFTriangle * pTrianglesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetTriangles");
+		}
+		if ((!pTrianglesBuffer) && !(pTrianglesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIInstanceTable->GetTriangles(nTrianglesBufferSize, pTrianglesNeededCount, pTrianglesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_instancetable_getinstancecount(Lib3MF_InstanceTable pInstanceTable, Lib3MF_uint32 * pCount)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetInstanceCount");
+		}
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCount = pIInstanceTable->GetInstanceCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_instancetable_getinstances(Lib3MF_InstanceTable pInstanceTable, const Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, sLib3MFMeshInstance * pInstancesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pInstanceTable;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pInstanceTable, "InstanceTable", "GetInstances");
+		}
+		if ((!pInstancesBuffer) && !(pInstancesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IInstanceTable* pIInstanceTable = dynamic_cast<IInstanceTable*>(pIBaseClass);
+		if (!pIInstanceTable)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIInstanceTable->GetInstances(nInstancesBufferSize, pInstancesNeededCount, pInstancesBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 /*************************************************************************************************************************
  Class implementation for Slice
 **************************************************************************************************************************/
@@ -19021,6 +19649,187 @@ Lib3MFResult lib3mf_slicestack_getownpath(Lib3MF_SliceStack pSliceStack, const L
 	}
 }
 
+Lib3MFResult lib3mf_slicestack_gettotalslicecount(Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 * pCount)
+{
+	IBase* pIBaseClass = (IBase *)pSliceStack;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStack, "SliceStack", "GetTotalSliceCount");
+		}
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ISliceStack* pISliceStack = dynamic_cast<ISliceStack*>(pIBaseClass);
+		if (!pISliceStack)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCount = pISliceStack->GetTotalSliceCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt64Result("Count", *pCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_slicestack_gettotalslice(Lib3MF_SliceStack pSliceStack, Lib3MF_uint64 nTotalSliceIndex, Lib3MF_Slice * pTheSlice)
+{
+	IBase* pIBaseClass = (IBase *)pSliceStack;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStack, "SliceStack", "GetTotalSlice");
+			pJournalEntry->addUInt64Parameter("TotalSliceIndex", nTotalSliceIndex);
+		}
+		if (pTheSlice == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseTheSlice(nullptr);
+		ISliceStack* pISliceStack = dynamic_cast<ISliceStack*>(pIBaseClass);
+		if (!pISliceStack)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseTheSlice = pISliceStack->GetTotalSlice(nTotalSliceIndex);
+
+		*pTheSlice = (IBase*)(pBaseTheSlice);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("TheSlice", *pTheSlice);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_slicestack_findsliceatz(Lib3MF_SliceStack pSliceStack, Lib3MF_double dZValue, Lib3MF_uint64 * pTotalSliceIndex, bool * pFound)
+{
+	IBase* pIBaseClass = (IBase *)pSliceStack;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStack, "SliceStack", "FindSliceAtZ");
+			pJournalEntry->addDoubleParameter("ZValue", dZValue);
+		}
+		if (!pTotalSliceIndex)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pFound == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ISliceStack* pISliceStack = dynamic_cast<ISliceStack*>(pIBaseClass);
+		if (!pISliceStack)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pFound = pISliceStack->FindSliceAtZ(dZValue, *pTotalSliceIndex);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt64Result("TotalSliceIndex", *pTotalSliceIndex);
+			pJournalEntry->addBooleanResult("Found", *pFound);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_slicestack_getslicerange(Lib3MF_SliceStack pSliceStack, Lib3MF_double dZMin, Lib3MF_double dZMax, Lib3MF_uint64 * pFirstIndex, Lib3MF_uint64 * pCount)
+{
+	IBase* pIBaseClass = (IBase *)pSliceStack;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStack, "SliceStack", "GetSliceRange");
+			pJournalEntry->addDoubleParameter("ZMin", dZMin);
+			pJournalEntry->addDoubleParameter("ZMax", dZMax);
+		}
+		if (!pFirstIndex)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pCount)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ISliceStack* pISliceStack = dynamic_cast<ISliceStack*>(pIBaseClass);
+		if (!pISliceStack)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pISliceStack->GetSliceRange(dZMin, dZMax, *pFirstIndex, *pCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt64Result("FirstIndex", *pFirstIndex);
+			pJournalEntry->addUInt64Result("Count", *pCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_slicestack_validatepolygons(Lib3MF_SliceStack pSliceStack, const Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, sLib3MFSliceLayerReport * pLayerReportsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pSliceStack;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStack, "SliceStack", "ValidatePolygons");
+		}
+		if ((!pLayerReportsBuffer) && !(pLayerReportsNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ISliceStack* pISliceStack = dynamic_cast<ISliceStack*>(pIBaseClass);
+		if (!pISliceStack)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pISliceStack->ValidatePolygons(nLayerReportsBufferSize, pLayerReportsNeededCount, pLayerReportsBuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for Consumer
@@ -21557,6 +22366,42 @@ Lib3MFResult lib3mf_model_getoutbox(Lib3MF_Model pModel, sLib3MFBox * pOutbox)
 	}
 }
 
+Lib3MFResult lib3mf_model_getinstancetable(Lib3MF_Model pModel, Lib3MF_InstanceTable * pInstanceTable)
+{
+	IBase* pIBaseClass = (IBase *)pModel;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pModel, "Model", "GetInstanceTable");
+		}
+		if (pInstanceTable == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseInstanceTable(nullptr);
+		IModel* pIModel = dynamic_cast<IModel*>(pIBaseClass);
+		if (!pIModel)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseInstanceTable = pIModel->GetInstanceTable();
+
+		*pInstanceTable = (IBase*)(pBaseInstanceTable);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("InstanceTable", *pInstanceTable);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 Lib3MFResult lib3mf_model_getresources(Lib3MF_Model pModel, Lib3MF_ResourceIterator * pResourceIterator)
 {
 	IBase* pIBaseClass = (IBase *)pModel;
@@ -23326,6 +24171,41 @@ Lib3MFResult lib3mf_model_removeresource(Lib3MF_Model pModel, Lib3MF_Resource pR
 	}
 }
 
+Lib3MFResult lib3mf_model_deduplicateproperties(Lib3MF_Model pModel, bool bRemoveUnreferenced, Lib3MF_uint32 * pRemovedCount)
+{
+	IBase* pIBaseClass = (IBase *)pModel;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pModel, "Model", "DeduplicateProperties");
+			pJournalEntry->addBooleanParameter("RemoveUnreferenced", bRemoveUnreferenced);
+		}
+		if (pRemovedCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IModel* pIModel = dynamic_cast<IModel*>(pIBaseClass);
+		if (!pIModel)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pRemovedCount = pIModel->DeduplicateProperties(bRemoveUnreferenced);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("RemovedCount", *pRemovedCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -23361,6 +24241,10 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_writer_setstrictmodeactive;
 	if (sProcName == "lib3mf_writer_getstrictmodeactive") 
 		*ppProcAddress = (void*) &lib3mf_writer_getstrictmodeactive;
+	if (sProcName == "lib3mf_writer_setincrementalmodeactive") 
+		*ppProcAddress = (void*) &lib3mf_writer_setincrementalmodeactive;
+	if (sProcName == "lib3mf_writer_getincrementalmodeactive") 
+		*ppProcAddress = (void*) &lib3mf_writer_getincrementalmodeactive;
 	if (sProcName == "lib3mf_writer_getwarning") 
 		*ppProcAddress = (void*) &lib3mf_writer_getwarning;
 	if (sProcName == "lib3mf_writer_getwarningcount") 
@@ -23369,6 +24253,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_writer_addkeywrappingcallback;
 	if (sProcName == "lib3mf_writer_setcontentencryptioncallback") 
 		*ppProcAddress = (void*) &lib3mf_writer_setcontentencryptioncallback;
+	if (sProcName == "lib3mf_writer_getstatistics") 
+		*ppProcAddress = (void*) &lib3mf_writer_getstatistics;
 	if (sProcName == "lib3mf_reader_readfromfile") 
 		*ppProcAddress = (void*) &lib3mf_reader_readfromfile;
 	if (sProcName == "lib3mf_reader_readfrombuffer") 
@@ -23393,6 +24279,12 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_reader_addkeywrappingcallback;
 	if (sProcName == "lib3mf_reader_setcontentencryptioncallback") 
 		*ppProcAddress = (void*) &lib3mf_reader_setcontentencryptioncallback;
+	if (sProcName == "lib3mf_reader_setinplacedecryptionactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_setinplacedecryptionactive;
+	if (sProcName == "lib3mf_reader_getinplacedecryptionactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_getinplacedecryptionactive;
+	if (sProcName == "lib3mf_reader_getstatistics") 
+		*ppProcAddress = (void*) &lib3mf_reader_getstatistics;
 	if (sProcName == "lib3mf_packagepart_getpath") 
 		*ppProcAddress = (void*) &lib3mf_packagepart_getpath;
 	if (sProcName == "lib3mf_packagepart_setpath") 
@@ -23807,6 +24699,10 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_colorgroup_setcolor;
 	if (sProcName == "lib3mf_colorgroup_getcolor") 
 		*ppProcAddress = (void*) &lib3mf_colorgroup_getcolor;
+	if (sProcName == "lib3mf_colorgroup_getallcolors") 
+		*ppProcAddress = (void*) &lib3mf_colorgroup_getallcolors;
+	if (sProcName == "lib3mf_colorgroup_setallcolors") 
+		*ppProcAddress = (void*) &lib3mf_colorgroup_setallcolors;
 	if (sProcName == "lib3mf_texture2dgroup_getcount") 
 		*ppProcAddress = (void*) &lib3mf_texture2dgroup_getcount;
 	if (sProcName == "lib3mf_texture2dgroup_getallpropertyids") 
@@ -23819,6 +24715,10 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_texture2dgroup_removetex2coord;
 	if (sProcName == "lib3mf_texture2dgroup_gettexture2d") 
 		*ppProcAddress = (void*) &lib3mf_texture2dgroup_gettexture2d;
+	if (sProcName == "lib3mf_texture2dgroup_getalltex2coords") 
+		*ppProcAddress = (void*) &lib3mf_texture2dgroup_getalltex2coords;
+	if (sProcName == "lib3mf_texture2dgroup_setalltex2coords") 
+		*ppProcAddress = (void*) &lib3mf_texture2dgroup_setalltex2coords;
 	if (sProcName == "lib3mf_compositematerials_getcount") 
 		*ppProcAddress = (void*) &lib3mf_compositematerials_getcount;
 	if (sProcName == "lib3mf_compositematerials_getallpropertyids") 
@@ -24281,6 +25181,20 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_builditemiterator_clone;
 	if (sProcName == "lib3mf_builditemiterator_count") 
 		*ppProcAddress = (void*) &lib3mf_builditemiterator_count;
+	if (sProcName == "lib3mf_instancetable_getmeshcount") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_getmeshcount;
+	if (sProcName == "lib3mf_instancetable_getmeshobject") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_getmeshobject;
+	if (sProcName == "lib3mf_instancetable_getmeshrange") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_getmeshrange;
+	if (sProcName == "lib3mf_instancetable_getvertices") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_getvertices;
+	if (sProcName == "lib3mf_instancetable_gettriangles") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_gettriangles;
+	if (sProcName == "lib3mf_instancetable_getinstancecount") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_getinstancecount;
+	if (sProcName == "lib3mf_instancetable_getinstances") 
+		*ppProcAddress = (void*) &lib3mf_instancetable_getinstances;
 	if (sProcName == "lib3mf_slice_setvertices") 
 		*ppProcAddress = (void*) &lib3mf_slice_setvertices;
 	if (sProcName == "lib3mf_slice_getvertices") 
@@ -24319,6 +25233,16 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_slicestack_setownpath;
 	if (sProcName == "lib3mf_slicestack_getownpath") 
 		*ppProcAddress = (void*) &lib3mf_slicestack_getownpath;
+	if (sProcName == "lib3mf_slicestack_gettotalslicecount") 
+		*ppProcAddress = (void*) &lib3mf_slicestack_gettotalslicecount;
+	if (sProcName == "lib3mf_slicestack_gettotalslice") 
+		*ppProcAddress = (void*) &lib3mf_slicestack_gettotalslice;
+	if (sProcName == "lib3mf_slicestack_findsliceatz") 
+		*ppProcAddress = (void*) &lib3mf_slicestack_findsliceatz;
+	if (sProcName == "lib3mf_slicestack_getslicerange") 
+		*ppProcAddress = (void*) &lib3mf_slicestack_getslicerange;
+	if (sProcName == "lib3mf_slicestack_validatepolygons") 
+		*ppProcAddress = (void*) &lib3mf_slicestack_validatepolygons;
 	if (sProcName == "lib3mf_consumer_getconsumerid") 
 		*ppProcAddress = (void*) &lib3mf_consumer_getconsumerid;
 	if (sProcName == "lib3mf_consumer_getkeyid") 
@@ -24447,6 +25371,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_model_getbuilditems;
 	if (sProcName == "lib3mf_model_getoutbox") 
 		*ppProcAddress = (void*) &lib3mf_model_getoutbox;
+	if (sProcName == "lib3mf_model_getinstancetable") 
+		*ppProcAddress = (void*) &lib3mf_model_getinstancetable;
 	if (sProcName == "lib3mf_model_getresources") 
 		*ppProcAddress = (void*) &lib3mf_model_getresources;
 	if (sProcName == "lib3mf_model_getobjects") 
@@ -24543,6 +25469,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_model_getlevelsets;
 	if (sProcName == "lib3mf_model_removeresource") 
 		*ppProcAddress = (void*) &lib3mf_model_removeresource;
+	if (sProcName == "lib3mf_model_deduplicateproperties") 
+		*ppProcAddress = (void*) &lib3mf_model_deduplicateproperties;
 	if (sProcName == "lib3mf_getlibraryversion") 
 		*ppProcAddress = (void*) &lib3mf_getlibraryversion;
 	if (sProcName == "lib3mf_getprereleaseinformation") 
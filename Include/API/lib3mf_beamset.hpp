@@ -62,6 +62,7 @@ private:
 	*/
 	NMR::PBEAMSET m_pBeamSet;
 	NMR::CMesh& m_mesh;
+	NMR::CModel * m_pModel;
 
 protected:
 
@@ -90,6 +90,10 @@ public:
 
 	void RemoveColor(const Lib3MF_uint32 nPropertyID);
 
+	void GetAllColors(Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, sLib3MFColor * pColorsBuffer);
+
+	void SetAllColors(const Lib3MF_uint64 nColorsBufferSize, const sLib3MFColor * pColorsBuffer);
+
 };
 
 } // namespace Impl
@@ -43,6 +43,7 @@ Abstract: This is the class declaration of CFunctionReference
 
 // Include custom headers here.
 #include "Common/NMR_FunctionReference.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF {
 namespace Impl {
@@ -65,12 +66,13 @@ protected:
 	* Put protected members here.
 	*/
 	NMR::PFunctionReference m_pFunctionReference;
+	NMR::CModel * m_pModel;
 public:
 
 	/**
 	* Put additional public members here. They will not be visible in the external API.
 	*/
-	CFunctionReference(NMR::PFunctionReference pFunctionReference);
+	CFunctionReference(NMR::PFunctionReference pFunctionReference, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
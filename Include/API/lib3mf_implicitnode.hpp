@@ -65,6 +65,12 @@ namespace Lib3MF
 
             IImplicitPort * FindInputOrThrow(const std::string & sIdentifier);
             IImplicitPort * FindOutputOrThrow(const std::string & sIdentifier);
+
+            // Returns the model of the function that owns the node, or nullptr if the node has been removed
+            NMR::CModel * model();
+
+            // Increases the model revision, if the node belongs to a function
+            void increaseRevision();
           public:
             
             CImplicitNode() = default;
@@ -42,6 +42,7 @@ Abstract: This is the class declaration of CImplicitPort
 
 // Include custom headers here.
 #include "Model/Classes/NMR_ModelImplicitPort.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF
 {
@@ -59,6 +60,7 @@ namespace Lib3MF
              * Put private members here.
              */
             NMR::PModelImplicitPort m_pImplicitPort;
+            NMR::CModel * m_pModel;
 
           protected:
             /**
@@ -66,7 +68,7 @@ namespace Lib3MF
              */
 
           public:
-            CImplicitPort(NMR::PModelImplicitPort pImplicitPort);
+            CImplicitPort(NMR::PModelImplicitPort pImplicitPort, NMR::CModel * pModel);
             /**
              * Put additional public members here. They will not be visible in the external API.
              */
@@ -43,6 +43,7 @@ Abstract: This is the class declaration of CImplicitPortIterator
 
 // Include custom headers here.
 #include "Model/Classes/NMR_ModelImplicitNode.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF {
 namespace Impl {
@@ -59,6 +60,7 @@ private:
 	* Put private members here.
 	*/
 	NMR::PPorts m_pPorts;
+	NMR::CModel * m_pModel;
 protected:
 
 	/**
@@ -66,7 +68,7 @@ protected:
 	*/
 
 public:
-	CImplicitPortIterator(NMR::PPorts pPorts);
+	CImplicitPortIterator(NMR::PPorts pPorts, NMR::CModel * pModel);
 	/**
 	* Put additional public members here. They will not be visible in the external API.
 	*/
@@ -0,0 +1,103 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class declaration of CInstanceTable
+
+*/
+
+
+#ifndef __LIB3MF_INSTANCETABLE
+#define __LIB3MF_INSTANCETABLE
+
+#include "lib3mf_interfaces.hpp"
+#include "lib3mf_base.hpp"
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4250)
+#endif
+
+
+// Include custom headers here.
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelInstanceTable.h"
+
+namespace Lib3MF {
+namespace Impl {
+
+
+/*************************************************************************************************************************
+ Class declaration of CInstanceTable 
+**************************************************************************************************************************/
+
+class CInstanceTable : public virtual IInstanceTable, public virtual CBase {
+private:
+
+	/**
+	* Put private members here.
+	*/
+	NMR::PModel m_pModel;
+	NMR::PModelInstanceTable m_pInstanceTable;
+
+protected:
+
+	/**
+	* Put protected members here.
+	*/
+
+public:
+
+	/**
+	* Put additional public members here. They will not be visible in the external API.
+	*/
+	CInstanceTable(NMR::PModel pModel);
+
+	/**
+	* Public member functions to implement.
+	*/
+
+	Lib3MF_uint32 GetMeshCount() override;
+
+	IMeshObject * GetMeshObject(const Lib3MF_uint32 nMeshIndex) override;
+
+	void GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount) override;
+
+	void GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer) override;
+
+	void GetTriangles(Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, Lib3MF::sTriangle * pTrianglesBuffer) override;
+
+	Lib3MF_uint32 GetInstanceCount() override;
+
+	void GetInstances(Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, Lib3MF::sMeshInstance * pInstancesBuffer) override;
+
+};
+
+}
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif // __LIB3MF_INSTANCETABLE
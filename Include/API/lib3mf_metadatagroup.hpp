@@ -40,6 +40,7 @@ Abstract: This is the class declaration of CMetaDataGroup
 #endif
 
 #include "Model/Classes/NMR_ModelMetaDataGroup.h"
+#include "Model/Classes/NMR_Model.h"
 
 // Include custom headers here.
 
@@ -59,6 +60,7 @@ private:
 	* Put private members here.
 	*/
 	NMR::PModelMetaDataGroup m_pModelMetaDataGroup;
+	NMR::CModel * m_pModel;
 
 protected:
 
@@ -71,7 +73,7 @@ public:
 	/**
 	* Put additional public members here. They will not be visible in the external API.
 	*/
-	CMetaDataGroup(NMR::PModelMetaDataGroup pMetaDataGroup);
+	CMetaDataGroup(NMR::PModelMetaDataGroup pMetaDataGroup, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
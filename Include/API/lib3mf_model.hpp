@@ -201,6 +201,8 @@ public:
 
 	Lib3MF::sBox GetOutbox() override;
 
+	IInstanceTable * GetInstanceTable() override;
+
 	IKeyStore * GetKeyStore() override;
 
 	void SetRandomNumberCallback(const Lib3MF::RandomNumberCallback pTheCallback, const Lib3MF_pvoid pUserData) override;
@@ -224,6 +226,8 @@ public:
 	ILevelSetIterator * GetLevelSets() override;
 
 	void RemoveResource(IResource* pResource) override;
+
+	Lib3MF_uint32 DeduplicateProperties(const bool bRemoveUnreferenced) override;
 };
 
 }
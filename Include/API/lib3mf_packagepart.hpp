@@ -43,6 +43,7 @@ Abstract: This is the class declaration of CPackagePart
 
 // Include custom headers here.
 #include "Model/Classes/NMR_PackageResourceID.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF {
 namespace Impl {
@@ -59,6 +60,7 @@ private:
 	* Put private members here.
 	*/
 	NMR::PPackageModelPath m_pPath;
+	NMR::CModel * m_pModel;
 
 protected:
 
@@ -71,7 +73,7 @@ public:
 	/**
 	* Put additional public members here. They will not be visible in the external API.
 	*/
-	CPackagePart(NMR::PPackageModelPath pPath);
+	CPackagePart(NMR::PPackageModelPath pPath, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
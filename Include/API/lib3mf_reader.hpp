@@ -104,6 +104,12 @@ public:
 
 	void SetContentEncryptionCallback(const Lib3MF::ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
 
+	void SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive);
+
+	bool GetInPlaceDecryptionActive();
+
+	std::string GetStatistics();
+
 };
 
 }
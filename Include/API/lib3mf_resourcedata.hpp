@@ -40,6 +40,7 @@ Abstract: This is the class declaration of CResourceData
 #endif
 
 #include "Model/Classes/NMR_KeyStoreResourceData.h"
+#include "Model/Classes/NMR_Model.h"
 // Include custom headers here.
 namespace Lib3MF {
 	namespace Impl {
@@ -52,8 +53,9 @@ namespace Lib3MF {
 		class CResourceData : public virtual IResourceData, public virtual CBase {
 		private:
 			NMR::PKeyStoreResourceData m_pResourceData;
+			NMR::CModel * m_pModel;
 		public:
-			CResourceData(NMR::PKeyStoreResourceData resourceData);
+			CResourceData(NMR::PKeyStoreResourceData resourceData, NMR::CModel * pModel);
 
 
 			// Inherited via IResourceData
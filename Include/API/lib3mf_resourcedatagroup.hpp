@@ -42,6 +42,7 @@ Abstract: This is the class declaration of CResourceDataGroup
 
 #include "Model/Classes/NMR_KeyStoreResourceDataGroup.h"
 #include "Model/Classes/NMR_KeyStore.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF {
 	namespace Impl {
@@ -52,8 +53,9 @@ namespace Lib3MF {
 
 		class CResourceDataGroup : public virtual IResourceDataGroup, public virtual CBase {
 			NMR::PKeyStoreResourceDataGroup m_pDataGroup;
+			NMR::CModel * m_pModel;
 		public:
-			CResourceDataGroup(NMR::PKeyStoreResourceDataGroup const & dg);
+			CResourceDataGroup(NMR::PKeyStoreResourceDataGroup const & dg, NMR::CModel * pModel);
 
 			// Inherited via IResourceDataGroup
 			virtual IAccessRight * AddAccessRight(IConsumer * pConsumer, const Lib3MF::eWrappingAlgorithm eWrappingAlgorithm, const Lib3MF::eMgfAlgorithm eMgfAlgorithm, const Lib3MF::eDigestMethod eDigestMethod) override;
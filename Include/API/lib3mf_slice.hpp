@@ -42,6 +42,7 @@ Abstract: This is the class declaration of CSlice
 
 // Include custom headers here.
 #include "Model/Classes/NMR_ModelSlice.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF {
 namespace Impl {
@@ -58,6 +59,7 @@ private:
 	* Put private members here.
 	*/
 	NMR::PSlice m_pSlice;
+	NMR::CModel * m_pModel;
 
 protected:
 
@@ -70,7 +72,7 @@ public:
 	/**
 	* Put additional public members here. They will not be visible in the external API.
 	*/
-	CSlice(NMR::PSlice);
+	CSlice(NMR::PSlice pSlice, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
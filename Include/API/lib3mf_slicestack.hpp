@@ -43,6 +43,7 @@ Abstract: This is the class declaration of CSliceStack
 
 // Include custom headers here.
 #include "Model/Classes/NMR_ModelSliceStack.h"
+#include "Model/Classes/NMR_ModelSliceValidator.h"
 
 namespace Lib3MF {
 namespace Impl {
@@ -58,6 +59,10 @@ private:
 	/**
 	* Put private members here.
 	*/
+	std::vector<NMR::MODELSLICELAYERREPORT> m_LayerReports;
+	bool m_bHasLayerReports;
+	// Model revision at which m_LayerReports have been computed
+	NMR::nfUint64 m_nLayerReportsRevision;
 
 protected:
 
@@ -97,6 +102,16 @@ public:
 	virtual void SetOwnPath(const std::string & sPath);
 
 	virtual std::string GetOwnPath();
+
+	virtual Lib3MF_uint64 GetTotalSliceCount() override;
+
+	virtual ISlice * GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex) override;
+
+	virtual bool FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex) override;
+
+	virtual void GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount) override;
+
+	virtual void ValidatePolygons(Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, Lib3MF::sSliceLayerReport * pLayerReportsBuffer) override;
 };
 
 } // namespace Impl
@@ -90,6 +90,10 @@ public:
 
 	void RemoveTex2Coord(const Lib3MF_uint32 nPropertyID);
 
+	void GetAllTex2Coords(Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, sLib3MFTex2Coord * pUVCoordinatesBuffer);
+
+	void SetAllTex2Coords(const Lib3MF_uint64 nUVCoordinatesBufferSize, const sLib3MFTex2Coord * pUVCoordinatesBuffer);
+
 };
 
 } // namespace Impl
@@ -72,7 +72,7 @@ public:
 	* Put additional public members here. They will not be visible in the external API.
 	*/
 	CVolumeDataColor() = delete;
-	CVolumeDataColor(NMR::PVolumeDataColor pColor);
+	CVolumeDataColor(NMR::PVolumeDataColor pColor, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
@@ -43,6 +43,7 @@ Abstract: This is the class declaration of CVolumeDataComposite
 
 // Include custom headers here.
 #include "Common/Mesh/NMR_VolumeDataComposite.h"
+#include "Model/Classes/NMR_Model.h"
 
 namespace Lib3MF {
 namespace Impl {
@@ -59,6 +60,7 @@ private:
 	* Put private members here.
 	*/
 	NMR::PVolumeDataComposite m_pVolumeDataComposite;
+	NMR::CModel * m_pModel;
 
 protected:
 
@@ -74,7 +76,7 @@ public:
 	* Put additional public members here. They will not be visible in the external API.
 	*/
 	CVolumeDataComposite() = delete;
-	CVolumeDataComposite(NMR::PVolumeDataComposite pComposite);
+	CVolumeDataComposite(NMR::PVolumeDataComposite pComposite, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
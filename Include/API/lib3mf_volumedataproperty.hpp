@@ -72,7 +72,7 @@ public:
 	* Put additional public members here. They will not be visible in the external API.
 	*/
 	CVolumeDataProperty() = delete;
-	CVolumeDataProperty(NMR::PVolumeDataProperty pProperty);
+	CVolumeDataProperty(NMR::PVolumeDataProperty pProperty, NMR::CModel * pModel);
 
 	/**
 	* Public member functions to implement.
@@ -46,8 +46,8 @@ Abstract: This is the class declaration of CWriter
 #include "Model/Writer/NMR_ModelWriter_STL.h"
 
 namespace NMR {
-	class CExportStreamMemory;
-	using PExportStreamMemory = std::shared_ptr<CExportStreamMemory>;
+	class CExportStreamCache;
+	using PExportStreamCache = std::shared_ptr<CExportStreamCache>;
 }
 
 namespace Lib3MF {
@@ -67,7 +67,23 @@ private:
 	*/
 	NMR::PModelWriter m_pWriter;
 
-	NMR::PExportStreamMemory momentBuffer;
+	// Package produced by the last export that was not written out, and the model revision it belongs to
+	NMR::PExportStreamCache m_pCachedExport;
+	NMR::nfUint64 m_nCachedRevision;
+	// Warnings of the export that produced the cached package, reported again when it is written
+	std::vector<NMR::PModelReaderWarning> m_CachedWarnings;
+	// Exports with a progress callback are not cached, so that every write reports its progress
+	bool m_bHasProgressCallback;
+
+	void exportToStream(NMR::PExportStream pStream);
+	// Exports and keeps the warnings of the export for a later replay of the package
+	void exportForCache(NMR::PExportStream pStream);
+	NMR::PExportStreamCache exportToCache();
+	NMR::PExportStreamCache fetchCachedExport();
+	void storeCachedExport(NMR::PExportStreamCache pStream);
+	// The copy of a cached package is added to the statistics of the export that created it
+	void writeCachedExport(NMR::PExportStreamCache pCachedExport, NMR::CExportStream * pStream);
+	void writeCachedExport(NMR::PExportStreamCache pCachedExport, Lib3MF_uint8 * pBuffer);
 protected:
 
 	/**
@@ -108,10 +124,16 @@ public:
 
 	bool GetStrictModeActive() override;
 
+	void SetIncrementalModeActive(const bool bIncrementalModeActive) override;
+
+	bool GetIncrementalModeActive() override;
+
 	std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode) override;
 
 	Lib3MF_uint32 GetWarningCount() override;
 
+	std::string GetStatistics() override;
+
 };
 
 }
@@ -33,10 +33,11 @@ Abstract: Progress Monitor
 
 #include "Common/3MF_ProgressTypes.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <mutex>
-#include <stack>
 #include <string>
+#include <thread>
 
 namespace NMR
 {
@@ -47,6 +48,11 @@ namespace NMR
 #define PROGRESS_READSLICESUPDATE 100
 #define PROGRESS_READBUFFERUPDATE 100
 
+// Progress increments are spread over this many cache line sized accumulators
+#define PROGRESS_SHARDCOUNT 16
+// Reports invoke the callback at most once per interval, except for the first report of each phase
+#define PROGRESS_CALLBACKINTERVAL_MS 50
+
 	class CProgressMonitor
 	{
 	public:
@@ -55,6 +61,11 @@ namespace NMR
 		void ClearProgressCallback();
 		// Returns true if the last callback call returned false
 		bool WasAborted();
+		// Returns true if a callback has requested cancellation. Does not invoke the callback.
+		bool IsCancelled();
+		// Clears a cancellation request when a new read or write starts. The calling thread
+		// becomes the only one that invokes the callback, other threads just read the flag.
+		void ResetCancelled();
 		bool QueryCancelled(bool throwIfCancelled);
 		bool ReportProgressAndQueryCancelled(bool throwIfCancelled);
 
@@ -66,13 +77,25 @@ namespace NMR
 		static void GetProgressMessage(ProgressIdentifier progressIdentifier, std::string& progressString);
 
 	private:
-		ProgressIdentifier m_eProgressIdentifier;
-		double m_dProgress;
-		double m_dProgressMax;
+		typedef struct alignas(64) sPROGRESSSHARD {
+			std::atomic<double> m_dValue;
+		} PROGRESSSHARD;
+
+		PROGRESSSHARD m_Shards[PROGRESS_SHARDCOUNT];
+		std::atomic<double> m_dProgressMax;
+		std::atomic<ProgressIdentifier> m_eProgressIdentifier;
+		// One bit per progress identifier that has been reported in the current read or write
+		std::uint32_t m_nReportedPhases;
+		long long m_nNextCallbackTime;
+		// The thread that started the current read or write
+		std::atomic<std::thread::id> m_CallbackThread;
+		std::atomic<bool> m_bCancelled;
 		Lib3MFProgressCallback m_progressCallback;
 		void* m_userData;
 		bool m_lastCallbackResult;
-		std::mutex m_callbackMutex;
+
+		double getProgress();
+		bool invokeCallback(ProgressIdentifier identifier, bool throwIfCancelled);
 	};
 
 	typedef std::shared_ptr <CProgressMonitor> PProgressMonitor;
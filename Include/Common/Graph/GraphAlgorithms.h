@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include "IDirectedGraph.h"
+#include "SparseDirectedGraph.h"
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -38,4 +39,10 @@ namespace NMR::common::graph
 {
     VertexList topologicalSort(const IDirectedGraph & graph);
     bool isCyclic(const IDirectedGraph & graph);
+
+    // Kahn's algorithm in O(V+E). Dependencies are ordered before their
+    // dependents, vertices without dependencies come first in ascending order.
+    // Returns an empty list for cyclic graphs.
+    VertexList topologicalSort(const SparseDirectedGraph & graph);
+    bool isCyclic(const SparseDirectedGraph & graph);
 } 
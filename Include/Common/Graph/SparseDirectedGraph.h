@@ -0,0 +1,81 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+SparseDirectedGraph.h defines a directed graph for large, sparse dependency
+structures. Edges are collected in a list and compressed into a CSR layout
+(compressed sparse rows of dependents per vertex) on first use, so memory is
+O(V+E) instead of the O(V^2) adjacency matrix of DirectedGraph.
+
+--*/
+
+#pragma once
+
+#include "IDirectedGraph.h"
+#include <vector>
+
+namespace NMR::common::graph
+{
+    class SparseDirectedGraph
+    {
+       public:
+        explicit SparseDirectedGraph(std::size_t size);
+
+        // Self dependencies are ignored, duplicate dependencies are allowed
+        void addDependency(Identifier id, Identifier idOfDependency);
+
+        [[nodiscard]] auto isDirectlyDependingOn(
+            Identifier id,
+            Identifier dependencyInQuestion) const -> bool;
+
+        [[nodiscard]] auto getSize() const -> std::size_t;
+
+        [[nodiscard]] auto getEdgeCount() const -> std::size_t;
+
+        // Number of (not necessarily distinct) dependencies of a vertex
+        [[nodiscard]] auto getDependencyCount(Identifier id) const -> std::size_t;
+
+        // The vertices that depend on id are stored in
+        // [getDependentsBegin(id), getDependentsEnd(id))
+        [[nodiscard]] auto getDependentsBegin(Identifier id) const -> const Identifier *;
+        [[nodiscard]] auto getDependentsEnd(Identifier id) const -> const Identifier *;
+
+       private:
+        void compress() const;
+
+        std::size_t m_size;
+
+        // Pairs of (dependency, dependent)
+        std::vector<std::pair<Identifier, Identifier>> m_edges;
+
+        // CSR layout, rebuilt lazily after the edges have changed
+        mutable bool m_bIsCompressed;
+        mutable std::vector<std::size_t> m_dependentOffsets;
+        mutable std::vector<Identifier> m_dependents;
+        mutable std::vector<std::size_t> m_dependencyCounts;
+    };
+}  // namespace NMR::common::graph
@@ -38,7 +38,7 @@ NMR_MeshBeamLattice.h defines the class CMeshBeamLattice.
 #include "Common/NMR_Types.h"
 #include "Model/Classes/NMR_ModelTypes.h"
 
-#include <unordered_set>
+#include <vector>
 
 namespace NMR {
 
@@ -47,7 +47,8 @@ namespace NMR {
 		friend class CMesh;
 
 		MESHNODES &m_Nodes;	// reference to the nodes of the parent mesh
-		std::unordered_set<nfInt32> m_OccupiedNodes;    // datastructure used to ensure that balls are only placed at nodes with beams
+		std::vector<nfUint64> m_OccupiedNodes;    // bitmap over the node indices, used to ensure that balls are only placed at nodes with beams
+		nfUint32 m_nOccupiedNodeCount;
 		MESHBEAMS m_Beams;
 		std::vector<PBEAMSET> m_pBeamSets;
 		MESHBALLS m_Balls;
@@ -61,6 +62,14 @@ namespace NMR {
 		void clearBeams();
 		void clearBalls();
 		void clear();
+
+		void markNodeOccupied(_In_ nfUint32 nNodeIndex);
+		nfBool isNodeOccupied(_In_ nfUint32 nNodeIndex);
+		nfUint32 getOccupiedNodeCount();
+		nfUint32 getOccupiedNodeIndex(_In_ nfUint32 nIdx);
+		void getOccupiedNodeIndices(_Out_ std::vector<nfUint32> & nodeIndices);
+
+		nfUint32 countBeamsBelowMinLength(_In_ nfUint32 nFirstBeam);
 	};
 
 	typedef std::shared_ptr <CBeamLattice> PBeamLattice;
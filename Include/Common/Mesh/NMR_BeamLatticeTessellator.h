@@ -0,0 +1,91 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_BeamLatticeTessellator.h defines the class CBeamLatticeTessellator, which turns the
+beams and balls of a mesh into triangles. Every beam is emitted as a closed tapered
+cylinder with its caps, every ball as a closed sphere. Overlapping shells are not united.
+
+--*/
+
+#ifndef __NMR_BEAMLATTICETESSELLATOR
+#define __NMR_BEAMLATTICETESSELLATOR
+
+#include "Common/Mesh/NMR_Mesh.h"
+#include "Common/NMR_Types.h"
+
+#include <vector>
+
+// Segment count bounds of a tessellated circle. Segment counts are multiples of 4,
+// so that hemispheres and spheres can reuse the latitudes of the unit circle tables.
+#define NMR_BEAMLATTICETESSELLATOR_MINSEGMENTS 8
+#define NMR_BEAMLATTICETESSELLATOR_MAXSEGMENTS 128
+// Segment count if neither the tessellator nor the beam lattice specify an accuracy
+#define NMR_BEAMLATTICETESSELLATOR_DEFAULTSEGMENTS 16
+// Minimal number of beams and balls per thread
+#define NMR_BEAMLATTICETESSELLATOR_MINITEMSPERTHREAD 1024
+
+namespace NMR {
+
+	typedef struct {
+		std::vector<nfDouble> m_Cos;
+		std::vector<nfDouble> m_Sin;
+	} BEAMLATTICEUNITCIRCLE;
+
+	class CBeamLatticeTessellator {
+	private:
+		CMesh * m_pMesh;
+		nfDouble m_dAccuracy;
+		nfUint32 m_nThreadCount;
+
+		// Unit circle tables, indexed by segment count / 4
+		std::vector<BEAMLATTICEUNITCIRCLE> m_UnitCircles;
+
+		nfUint32 segmentsForRadius(_In_ nfDouble dRadius, _In_ nfDouble dAccuracy);
+		void buildUnitCircles();
+	public:
+		CBeamLatticeTessellator() = delete;
+		CBeamLatticeTessellator(_In_ CMesh * pMesh);
+
+		// Maximal deviation of the tessellation from the exact surface. Values <= 0 select the
+		// accuracy of the beam lattice, or a fixed segment count if the lattice has none.
+		void setAccuracy(_In_ nfDouble dAccuracy);
+		nfDouble getAccuracy();
+
+		// 0 selects the number of hardware threads
+		void setThreadCount(_In_ nfUint32 nThreadCount);
+		nfUint32 getThreadCount();
+
+		// Appends the tessellated beams and balls to pTargetMesh, which must not be the source mesh
+		void tessellate(_In_ CMesh * pTargetMesh);
+	};
+
+	typedef std::shared_ptr <CBeamLatticeTessellator> PBeamLatticeTessellator;
+
+}
+
+#endif // __NMR_BEAMLATTICETESSELLATOR
@@ -69,13 +69,16 @@ namespace NMR {
 		void mergeMesh(_In_opt_ CMesh * pMesh, _In_ NMATRIX3 mMatrix);
 		void addToMesh(_In_opt_ CMesh * pMesh, _In_ NMATRIX3 mMatrix);
 
-		_Ret_notnull_ MESHNODE * addNode(_In_ const NVEC3 vPosition);
-		_Ret_notnull_ MESHNODE * addNode(_In_ const nfFloat posX, _In_ const nfFloat posY, _In_ const nfFloat posZ);
-		_Ret_notnull_ MESHFACE * addFace(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2, _In_ MESHNODE * pNode3);
-		_Ret_notnull_ MESHFACE * addFace(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2, _In_ nfInt32 nNodeIndex3);
-		_Ret_notnull_ MESHBEAM * addBeam(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2, _In_ nfDouble dRadius1, _In_ nfDouble dRadius2,
+		nfUint32 addNode(_In_ const NVEC3 vPosition);
+		nfUint32 addNode(_In_ const nfFloat posX, _In_ const nfFloat posY, _In_ const nfFloat posZ);
+		nfUint32 addFace(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2, _In_ nfInt32 nNodeIndex3);
+		nfUint32 addBeam(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2, _In_ nfDouble dRadius1, _In_ nfDouble dRadius2,
 			_In_ nfInt32 eCapMode1, _In_ nfInt32 eCapMode2);
-		_Ret_notnull_ MESHBALL * addBall(_In_ MESHNODE * pNode, _In_ nfDouble dRadius);
+		nfUint32 addBall(_In_ nfInt32 nNodeIndex, _In_ nfDouble dRadius);
+		// Appends nCount zeroed nodes or faces and returns the index of the first one.
+		// The records are meant to be filled afterwards, e.g. concurrently via getNode / getFace.
+		nfUint32 allocateNodes(_In_ nfUint32 nCount);
+		nfUint32 allocateFaces(_In_ nfUint32 nCount);
 		_Ret_notnull_ PBEAMSET addBeamSet();
 		
 		nfUint32 getNodeCount();
@@ -91,7 +94,13 @@ namespace NMR {
 		_Ret_notnull_ MESHBEAM * getBeam(_In_ nfUint32 nIdx);
 		_Ret_notnull_ MESHBALL * getBall(_In_ nfUint32 nIdx);
 		_Ret_notnull_ PBEAMSET getBeamSet(_In_ nfUint32 nIdx);
-		_Ret_notnull_ MESHNODE * getOccupiedNode(_In_ nfUint32 nIdx);
+		nfUint32 getOccupiedNodeIndex(_In_ nfUint32 nIdx);
+		void getOccupiedNodeIndices(_Out_ std::vector<nfUint32> & nodeIndices);
+
+		// Direct access to the containers, for sequential walks in hot loops
+		MESHNODES & getNodes();
+		MESHFACES & getFaces();
+		MESHBEAMS & getBeams();
 
 		void setBeamLatticeMinLength(nfDouble dMinLength);
 		nfDouble getBeamLatticeMinLength();
@@ -115,6 +124,7 @@ namespace NMR {
 		void clearBeamLatticeBeams();
 		void clearBeamLatticeBalls();
 		void scanOccupiedNodes();
+		nfUint32 countBeamsBelowMinLength(_In_ nfUint32 nFirstBeam);
 		void validateBeamLatticeBalls();
 
 		_Ret_maybenull_ CMeshInformationHandler * getMeshInformationHandler();
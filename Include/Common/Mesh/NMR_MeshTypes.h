@@ -59,14 +59,14 @@ In addition, some constants are defined here.
 
 namespace NMR {
 
+	// Nodes, faces, beams and balls do not store their own index, it always equals
+	// the position of the entry within its container.
 	typedef struct {
-		nfInt32 m_index;
 		NVEC3 m_position;
 	} MESHNODE;
 	typedef CPagedVector<MESHNODE, NMR_MESH_NODEBLOCKCOUNT> MESHNODES;
 
 	typedef struct {
-		nfInt32 m_index;
 		nfInt32 m_nodeindices[3];
 	} MESHFACE;
 	typedef CPagedVector<MESHFACE, NMR_MESH_FACEBLOCKCOUNT> MESHFACES;
@@ -84,15 +84,24 @@ namespace NMR {
 	typedef std::shared_ptr<BEAMSET> PBEAMSET;
 
 	typedef struct MESHBEAM {
-		nfInt32 m_index = 1;
 		nfInt32 m_nodeindices[2] = { 0, 0 };
 		nfDouble m_radius[2] = { 1., 1. };
-		nfInt32 m_capMode[2] = { 0,0 };
+		nfByte m_capModes = 0;	// cap modes of both ends, packed into one nibble each
+
+		nfInt32 getCapMode(_In_ nfUint32 nEnd) const
+		{
+			return (m_capModes >> (nEnd * 4)) & 0x0f;
+		}
+
+		void setCapMode(_In_ nfUint32 nEnd, _In_ nfInt32 eCapMode)
+		{
+			nfUint32 nShift = nEnd * 4;
+			m_capModes = (nfByte)((m_capModes & ~(0x0f << nShift)) | ((eCapMode & 0x0f) << nShift));
+		}
 	} MESHBEAM;
 	typedef CPagedVector<MESHBEAM, NMR_MESH_BEAMBLOCKCOUNT> MESHBEAMS;
 
 	typedef struct MESHBALL {
-		nfInt32 m_index;
 		nfInt32 m_nodeindex;
 		nfDouble m_radius;
 	} MESHBALL;
@@ -37,12 +37,20 @@ NMR_MeshInformation_Properties.h defines the Property Information Class.
 #include "Model/Classes/NMR_ModelTypes.h"
 #include <list>
 #include <map>
+#include <vector>
+
+// Marks property IDs without a registered index in the dense tables
+#define NMR_PROPERTYINDEXMAPPING_UNMAPPED 0xFFFFFFFF
+// IDs may exceed the size of a dense table by this much before they are stored in the sparse map
+#define NMR_PROPERTYINDEXMAPPING_MAXDENSEGAP 1024
 
 namespace NMR {
 
 	class CMeshInformation_PropertyIndexMapping {
 	private:
-		std::map<std::pair<UniqueResourceID, ModelPropertyID>, nfUint32> m_IDMap;
+		// Indices by unique resource ID and property ID, for the usual densely numbered IDs
+		std::vector<std::vector<nfUint32>> m_DenseIDMap;
+		std::map<std::pair<UniqueResourceID, ModelPropertyID>, nfUint32> m_SparseIDMap;
 	public:
 		CMeshInformation_PropertyIndexMapping();
 
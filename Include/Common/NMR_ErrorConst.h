@@ -1477,6 +1477,9 @@ Model error codes (0x8XXX)
 // Duplicate attribute mesh id in levelset element
 #define NMR_ERROR_DUPLICATE_BOUNDARY_SHAPE_MESH_ID 0x884A
 
+// Components of an object reference the object itself
+#define NMR_ERROR_CYCLICCOMPONENTREFERENCE 0x884B
+
 
 /*-------------------------------------------------------------------
 XML Parser Error Constants (0x9XXX)
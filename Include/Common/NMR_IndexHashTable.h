@@ -0,0 +1,149 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_IndexHashTable.h defines an open-addressing hash table that maps hash values to indices
+into an array owned by the caller. Keys are compared through the caller's array, so the
+table itself only stores the hash and the index of each entry.
+
+--*/
+
+#ifndef __NMR_INDEXHASHTABLE
+#define __NMR_INDEXHASHTABLE
+
+#include "Common/NMR_Local.h"
+#include "Common/NMR_Types.h"
+
+#include <vector>
+
+#define NMR_INDEXHASHTABLE_MINCAPACITY 16
+
+namespace NMR {
+
+	// Mixes the bits of a 64 bit value into a 32 bit hash
+	inline nfUint32 fnHashUint64(_In_ nfUint64 nValue)
+	{
+		nValue ^= nValue >> 33;
+		nValue *= 0xff51afd7ed558ccdULL;
+		nValue ^= nValue >> 33;
+		nValue *= 0xc4ceb9fe1a85ec53ULL;
+		nValue ^= nValue >> 33;
+		return (nfUint32)nValue;
+	}
+
+	class CIndexHashTable {
+	private:
+		typedef struct {
+			nfUint32 m_nHash;
+			// 0 marks an empty slot
+			nfUint32 m_nIndexPlusOne;
+		} INDEXHASHTABLESLOT;
+
+		std::vector<INDEXHASHTABLESLOT> m_Slots;
+		nfUint32 m_nCount;
+
+		void rehash(_In_ size_t nCapacity)
+		{
+			std::vector<INDEXHASHTABLESLOT> OldSlots(nCapacity, INDEXHASHTABLESLOT{ 0, 0 });
+			OldSlots.swap(m_Slots);
+
+			size_t nMask = m_Slots.size() - 1;
+			for (auto & slot : OldSlots) {
+				if (slot.m_nIndexPlusOne != 0) {
+					size_t nSlot = slot.m_nHash & nMask;
+					while (m_Slots[nSlot].m_nIndexPlusOne != 0)
+						nSlot = (nSlot + 1) & nMask;
+					m_Slots[nSlot] = slot;
+				}
+			}
+		}
+
+	public:
+		CIndexHashTable()
+			: m_nCount(0)
+		{
+		}
+
+		void clear()
+		{
+			m_Slots.clear();
+			m_nCount = 0;
+		}
+
+		// Sizes the table for nCount entries, keeping the load factor at most one half
+		void reserve(_In_ nfUint32 nCount)
+		{
+			size_t nCapacity = NMR_INDEXHASHTABLE_MINCAPACITY;
+			while (nCapacity < (size_t)nCount * 2)
+				nCapacity *= 2;
+			if (nCapacity > m_Slots.size())
+				rehash(nCapacity);
+		}
+
+		// Looks up the entry with the given hash for which fnIsEqual(nIndex) holds
+		template <typename F> nfBool find(_In_ nfUint32 nHash, _In_ F fnIsEqual, _Out_ nfUint32 & nIndex) const
+		{
+			if (m_Slots.empty())
+				return false;
+
+			size_t nMask = m_Slots.size() - 1;
+			size_t nSlot = nHash & nMask;
+			while (m_Slots[nSlot].m_nIndexPlusOne != 0) {
+				const INDEXHASHTABLESLOT & slot = m_Slots[nSlot];
+				if ((slot.m_nHash == nHash) && fnIsEqual(slot.m_nIndexPlusOne - 1)) {
+					nIndex = slot.m_nIndexPlusOne - 1;
+					return true;
+				}
+				nSlot = (nSlot + 1) & nMask;
+			}
+			return false;
+		}
+
+		// Adds an entry; the caller makes sure that no equal entry exists yet
+		void insert(_In_ nfUint32 nHash, _In_ nfUint32 nIndex)
+		{
+			if ((size_t)(m_nCount + 1) * 2 > m_Slots.size())
+				reserve(m_nCount + 1);
+
+			size_t nMask = m_Slots.size() - 1;
+			size_t nSlot = nHash & nMask;
+			while (m_Slots[nSlot].m_nIndexPlusOne != 0)
+				nSlot = (nSlot + 1) & nMask;
+			m_Slots[nSlot].m_nHash = nHash;
+			m_Slots[nSlot].m_nIndexPlusOne = nIndex + 1;
+			m_nCount++;
+		}
+
+		nfUint32 getCount() const
+		{
+			return m_nCount;
+		}
+	};
+
+}
+
+#endif // __NMR_INDEXHASHTABLE
@@ -80,6 +80,8 @@ namespace NMR {
 
 		void addWarning(_In_ nfError nErrorCode, _In_ eModelWarningLevel WarningLevel);
 		void addException(const _In_ CNMRException & Exception, _In_ eModelWarningLevel WarningLevel);
+		// Adds a warning that has already passed the critical level check, e.g. when replaying a cached operation
+		void addWarning(_In_ PModelReaderWarning pWarning);
 
 		nfUint32 getWarningCount();
 		PModelReaderWarning getWarning(_In_ nfUint32 nIndex);
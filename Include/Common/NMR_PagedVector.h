@@ -37,6 +37,7 @@ significant performance improvements against a standard template library vector.
 #include "Common/NMR_Local.h"
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_Statistics.h"
 #include <vector>
 
 #include <array>
@@ -82,6 +83,7 @@ namespace NMR {
 			if (nIdx == 0) {
 				m_pHeadBlock = new T[m_nBlockSize];
 				m_pBlocks.push_back(m_pHeadBlock);
+				NMR_STATISTICS_ADD(escAllocations, 1);
 			}
 
 			T * pResult = &m_pHeadBlock[nIdx];
@@ -102,6 +104,7 @@ namespace NMR {
 			if (nIdx == 0) {
 				m_pHeadBlock = new T[m_nBlockSize];
 				m_pBlocks.push_back(m_pHeadBlock);
+				NMR_STATISTICS_ADD(escAllocations, 1);
 			}
 
 			nNewIndex = m_nCount;
@@ -126,6 +129,21 @@ namespace NMR {
 			return block[nIdx % m_nBlockSize];
 		}
 
+		nfUint32 getBlockCount() {
+			return (nfUint32)m_pBlocks.size();
+		}
+
+		// Returns the storage of a block and the number of used entries in it. Allows
+		// sequential walks over all entries without a division per access.
+		_Ret_notnull_ T * getBlock(_In_ nfUint32 nBlockIndex, _Out_ nfUint32 & nEntryCount) {
+			if (nBlockIndex >= m_pBlocks.size())
+				throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+			nfUint32 nRemaining = m_nCount - nBlockIndex * m_nBlockSize;
+			nEntryCount = (nRemaining < m_nBlockSize) ? nRemaining : m_nBlockSize;
+			return m_pBlocks[nBlockIndex];
+		}
+
 		void clearAllData() {
 			for (auto iIterator = m_pBlocks.begin(); iIterator != m_pBlocks.end(); iIterator++)
 			{
@@ -0,0 +1,108 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_Parallel.h defines fnParallelFor, which distributes the indices of a loop over
+worker threads.
+
+--*/
+
+#ifndef __NMR_PARALLEL
+#define __NMR_PARALLEL
+
+#include "Common/NMR_Local.h"
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Statistics.h"
+
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace NMR {
+
+	// Returns the number of hardware threads, at least 1
+	inline nfUint32 fnGetHardwareThreadCount()
+	{
+		nfUint32 nThreadCount = std::thread::hardware_concurrency();
+		return (nThreadCount > 0) ? nThreadCount : 1;
+	}
+
+	// Calls fnRange(nBegin, nEnd) on disjoint ranges covering [0, nCount), using at most
+	// nThreadCount threads (0 for all hardware threads) with at least nMinItemsPerThread items each.
+	// The calling thread does the work itself if one thread suffices. The first exception
+	// thrown by a worker is rethrown after all workers have finished. Workers collect
+	// statistics on behalf of the calling thread.
+	template <typename F>
+	void fnParallelFor(_In_ nfUint32 nCount, _In_ nfUint32 nThreadCount, _In_ nfUint32 nMinItemsPerThread, _In_ F fnRange)
+	{
+		if (nThreadCount == 0)
+			nThreadCount = fnGetHardwareThreadCount();
+		if (nMinItemsPerThread == 0)
+			nMinItemsPerThread = 1;
+
+		nfUint32 nMaxThreads = nCount / nMinItemsPerThread + ((nCount % nMinItemsPerThread) ? 1 : 0);
+		if (nThreadCount > nMaxThreads)
+			nThreadCount = nMaxThreads;
+
+		if (nThreadCount <= 1) {
+			if (nCount > 0)
+				fnRange(0, nCount);
+			return;
+		}
+
+		nfUint32 nChunkSize = nCount / nThreadCount + ((nCount % nThreadCount) ? 1 : 0);
+		std::vector<std::thread> threads;
+		std::vector<std::exception_ptr> exceptions(nThreadCount);
+		NMR_STATISTICS_CAPTURE(statisticsContext);
+
+		for (nfUint32 nThread = 0; nThread < nThreadCount; nThread++) {
+			nfUint32 nBegin = nThread * nChunkSize;
+			if (nBegin >= nCount)
+				break;
+			nfUint32 nEnd = (nCount - nBegin < nChunkSize) ? nCount : nBegin + nChunkSize;
+			threads.push_back(std::thread([&, nThread, nBegin, nEnd]() {
+				NMR_STATISTICS_WORKER(statisticsContext);
+				try {
+					fnRange(nBegin, nEnd);
+				}
+				catch (...) {
+					exceptions[nThread] = std::current_exception();
+				}
+			}));
+		}
+
+		for (auto iIterator = threads.begin(); iIterator != threads.end(); iIterator++)
+			iIterator->join();
+
+		for (auto iIterator = exceptions.begin(); iIterator != exceptions.end(); iIterator++)
+			if (*iIterator)
+				std::rethrow_exception(*iIterator);
+	}
+
+}
+
+#endif // __NMR_PARALLEL
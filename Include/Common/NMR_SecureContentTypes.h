@@ -35,6 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define KEYSTORE_TYPES_EXPONENTBUFFERSIZE 5
 #define KEYSTORE_TYPES_IVSIZE 12
 #define KEYSTORE_TYPES_TAGSIZE 16
+// Encrypted streams process data in chunks of at most this size, reusing one buffer per stream
+#define KEYSTORE_TYPES_CRYPTBUFFERSIZE 1048576
 
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
@@ -78,6 +80,9 @@ namespace NMR {
 	struct ContentEncryptionDescriptor {
 		ContentEncryptionCbType m_fnCrypt;
 		ContentEncryptionContext m_sDekDecryptData;
+		// Set, if m_fnCrypt accepts the same buffer as input and output. Decryption then
+		// works directly in the buffer of the reader, without an intermediate copy.
+		nfBool m_bInPlace = false;
 	};
 
 	class CKeyStoreAccessRight;
@@ -20,6 +20,8 @@ namespace NMR {
 		bool hasDekCtx() const;
 		ContentEncryptionDescriptor getDekCtx() const;
 		void setDekCtx(ContentEncryptionDescriptor const & descriptor);
+		bool getDekInPlace() const;
+		void setDekInPlace(bool bInPlace);
 
 		ClientConsumerMap::const_iterator kekCtxBegin() const;
 		ClientConsumerMap::const_iterator kekCtxEnd() const;
@@ -0,0 +1,200 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_Statistics.h defines the instrumentation of the reader and writer. A
+CStatistics object collects wall time, byte and element counts and the time
+spent in ZIP, XML and number parsing, broken down per OPC part and per progress
+phase. Collection is bound to the thread that runs a read or write. Worker
+threads of fnParallelFor collect into the statistics of the thread that started
+them, so their times add up over all threads. The NMR_STATISTICS_* macros
+compile to nothing unless NMR_STATISTICS is defined.
+
+--*/
+
+#ifndef __NMR_STATISTICS
+#define __NMR_STATISTICS
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/3MF_ProgressTypes.h"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Fine grained timers only measure every n-th call and extrapolate. Must be a power of 2.
+#define NMR_STATISTICS_SAMPLEINTERVAL 16
+
+namespace NMR {
+
+	enum eStatisticsCounter {
+		escBytesIn = 0,
+		escBytesOut,
+		escElements,
+		escAllocations,
+		escZIPTime,
+		escXMLTime,
+		escNumberParsingTime,
+		escCount
+	};
+
+	typedef struct sSTATISTICSENTRY {
+		std::string m_sPart;
+		ProgressIdentifier m_ePhase;
+		nfUint64 m_nWallTime;
+		nfUint64 m_nCounters[escCount];
+	} STATISTICSENTRY;
+
+	class CStatistics;
+
+	// The values a thread has collected since it last booked them into its statistics
+	typedef struct sSTATISTICSTHREADSTATE {
+		CStatistics * m_pStatistics;
+		nfBool m_bIsWorker;
+		std::string m_sPart;
+		std::chrono::steady_clock::time_point m_SwitchTime;
+		nfUint64 m_nCounters[escCount];
+	} STATISTICSTHREADSTATE;
+
+	// What a worker thread needs to collect on behalf of the thread that started it
+	typedef struct sSTATISTICSCONTEXT {
+		CStatistics * m_pStatistics;
+		std::string m_sPart;
+	} STATISTICSCONTEXT;
+
+	class CStatistics {
+	private:
+		std::mutex m_Mutex;
+		// Entries in the order of their first use
+		std::list<STATISTICSENTRY> m_Entries;
+		std::map<std::pair<std::string, nfInt32>, STATISTICSENTRY *> m_EntryMap;
+
+		// The phase is set by the thread that runs the read or write, and read by its workers
+		std::atomic<nfInt32> m_nPhase;
+		nfBool m_bIsRunning;
+		std::chrono::steady_clock::time_point m_StartTime;
+		nfUint64 m_nTotalWallTime;
+
+	public:
+		CStatistics();
+
+		void start();
+		// Continues collecting on top of the values of the last read or write
+		void resume();
+		void stop();
+
+		// Books the wall time and the counters of a thread on the entry of its part and the current phase
+		void flush(_Inout_ STATISTICSTHREADSTATE & State);
+
+		// Phases are only switched by the thread that runs the read or write
+		void setPhase(_In_ ProgressIdentifier ePhase);
+		void setPart(_In_ const std::string & sPart);
+		std::string getPart();
+
+		void add(_In_ eStatisticsCounter eCounter, _In_ nfUint64 nValue);
+
+		// Returns the statistics of the last read or write as JSON document
+		std::string toJSON();
+
+		// Statistics that collect for the calling thread, or nullptr
+		static CStatistics * getActive();
+		static STATISTICSCONTEXT getContext();
+	};
+
+	typedef std::shared_ptr<CStatistics> PStatistics;
+
+	// Collects into pStatistics on the current thread for the lifetime of the object
+	class CStatisticsActivation {
+	private:
+		CStatistics * m_pStatistics;
+		STATISTICSTHREADSTATE m_PreviousState;
+	public:
+		CStatisticsActivation(_In_ CStatistics * pStatistics, _In_ nfBool bResume);
+		~CStatisticsActivation();
+	};
+
+	// Collects into the statistics of another thread on a worker thread for the lifetime of the object
+	class CStatisticsWorkerActivation {
+	private:
+		STATISTICSTHREADSTATE m_PreviousState;
+	public:
+		CStatisticsWorkerActivation(_In_ const STATISTICSCONTEXT & Context);
+		~CStatisticsWorkerActivation();
+	};
+
+	// Books all collected values on the given OPC part for the lifetime of the object
+	class CStatisticsPartScope {
+	private:
+		CStatistics * m_pStatistics;
+		std::string m_sPreviousPart;
+	public:
+		CStatisticsPartScope(_In_ const std::string & sPart);
+		~CStatisticsPartScope();
+	};
+
+	class CStatisticsTimer {
+	private:
+		CStatistics * m_pStatistics;
+		eStatisticsCounter m_eCounter;
+		nfUint64 m_nFactor;
+		std::chrono::steady_clock::time_point m_StartTime;
+	public:
+		// Sampled timers only measure every NMR_STATISTICS_SAMPLEINTERVAL-th call per counter and thread
+		CStatisticsTimer(_In_ eStatisticsCounter eCounter, _In_ nfBool bSampled);
+		~CStatisticsTimer();
+	};
+
+}
+
+#ifdef NMR_STATISTICS
+#define NMR_STATISTICS_ACTIVATE(pStatistics) NMR::CStatisticsActivation nmrStatisticsActivation(pStatistics, false)
+#define NMR_STATISTICS_RESUME(pStatistics) NMR::CStatisticsActivation nmrStatisticsActivation(pStatistics, true)
+#define NMR_STATISTICS_CAPTURE(Context) NMR::STATISTICSCONTEXT Context = NMR::CStatistics::getContext()
+#define NMR_STATISTICS_WORKER(Context) NMR::CStatisticsWorkerActivation nmrStatisticsWorkerActivation(Context)
+#define NMR_STATISTICS_PART(sPart) NMR::CStatisticsPartScope nmrStatisticsPartScope(sPart)
+#define NMR_STATISTICS_PHASE(ePhase) { NMR::CStatistics * pActiveStatistics = NMR::CStatistics::getActive(); if (pActiveStatistics != nullptr) pActiveStatistics->setPhase(ePhase); }
+#define NMR_STATISTICS_ADD(eCounter, nValue) { NMR::CStatistics * pActiveStatistics = NMR::CStatistics::getActive(); if (pActiveStatistics != nullptr) pActiveStatistics->add(eCounter, nValue); }
+#define NMR_STATISTICS_TIMER(eCounter) NMR::CStatisticsTimer nmrStatisticsTimer(eCounter, false)
+#define NMR_STATISTICS_SAMPLEDTIMER(eCounter) NMR::CStatisticsTimer nmrStatisticsTimer(eCounter, true)
+#else
+#define NMR_STATISTICS_ACTIVATE(pStatistics)
+#define NMR_STATISTICS_RESUME(pStatistics)
+#define NMR_STATISTICS_CAPTURE(Context)
+#define NMR_STATISTICS_WORKER(Context)
+#define NMR_STATISTICS_PART(sPart)
+#define NMR_STATISTICS_PHASE(ePhase)
+#define NMR_STATISTICS_ADD(eCounter, nValue)
+#define NMR_STATISTICS_TIMER(eCounter)
+#define NMR_STATISTICS_SAMPLEDTIMER(eCounter)
+#endif
+
+#endif // __NMR_STATISTICS
@@ -71,6 +71,55 @@ namespace NMR {
 	std::string fnDoubleToString(_In_ nfFloat dValue, _In_ nfUint32 precision);
 	std::string fnColorToString(_In_ nfColor cColor);
 
+	// Writes a value with "%.Nf" formatting, where N = nPosAfterDecPoint and nFactor = 10^N. The digits
+	// beyond N are cut off. No terminating zero is written. Returns the number of characters written.
+	template<typename T>
+	nfUint32 fnPutFixedPoint(_In_ const T fValue, _In_ const nfInt64 nFactor, _In_ const int nPosAfterDecPoint, _Out_ nfChar * pTarget)
+	{
+		nfInt64 nAbsValue = (nfInt64)(fValue * nFactor);
+		if (nAbsValue < 0)
+			nAbsValue = -nAbsValue;
+		nfBool bIsNegative = fValue < 0;
+
+		nfUint32 nPos = 0;
+		int nCount = 0;
+
+		if (!nAbsValue) {
+			pTarget[nPos++] = '0';
+		}
+		else {
+			// Write the string in reverse order
+			while (nAbsValue || nCount < nPosAfterDecPoint) {
+				pTarget[nPos++] = '0' + (nAbsValue % 10);
+				nAbsValue /= 10;
+				nCount++;
+				if (nCount == nPosAfterDecPoint) {
+					pTarget[nPos++] = '.';
+					if (!nAbsValue) {
+						pTarget[nPos++] = '0';
+					}
+					nCount++;
+				}
+			}
+			if (bIsNegative) {
+				pTarget[nPos++] = '-';
+			}
+		}
+
+		// Reverse the string
+		nfUint32 nStart = 0;
+		nfUint32 nEnd = nPos - 1;
+		while (nStart < nEnd) {
+			nfChar temp = pTarget[nStart];
+			pTarget[nStart] = pTarget[nEnd];
+			pTarget[nEnd] = temp;
+			nStart++;
+			nEnd--;
+		}
+
+		return nPos;
+	}
+
 	void fnStringToCommaSeparatedIntegerTriplet(_In_z_ const nfChar * pszValue, _Out_ nfInt32 & nValue1, _Out_ nfInt32 & nValue2, _Out_ nfInt32 & nValue3);
 	
 	template<typename T>
@@ -36,12 +36,8 @@ NMR_UUID.h defines a datatype and functions to handle UUIDs
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
 #include <string>
-
-#ifdef GUID_CUSTOM
-#include <mutex>
-#include <random>
+#include <vector>
 #include <memory>
-#endif
 
 
 namespace NMR
@@ -50,8 +46,8 @@ namespace NMR
 	private:
 		std::string m_sUUID;
 #ifdef GUID_CUSTOM
-		static std::mutex S_uuid_gen_mutex;
-		static std::unique_ptr<std::mt19937> S_mtwister;
+		// Formats 128 random bits as a version 4 UUID
+		void setRandom(_In_ nfUint64 nHigh, _In_ nfUint64 nLow);
 #endif
 	public:
 		CUUID();
@@ -63,6 +59,9 @@ namespace NMR
 
 		CUUID& operator=(const CUUID& uuid);
 		bool operator==(const CUUID& uuid);
+
+		// Creates nCount new UUIDs at once
+		static void generate(_In_ nfUint32 nCount, _Out_ std::vector<CUUID> & UUIDs);
 	};
 
 	typedef std::shared_ptr<CUUID> PUUID;
@@ -5,6 +5,8 @@
 #include <string>
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 namespace NMR {
 	class COpcPackageRelationship;
@@ -16,6 +18,10 @@ namespace NMR {
 		virtual _Ret_maybenull_ COpcPackageRelationship * findRootRelation(_In_ std::string sRelationType, _In_ nfBool bMustBeUnique) = 0;
 		virtual POpcPackagePart createPart(_In_ std::string sPath) = 0;
 		virtual nfUint64 getPartSize(_In_ std::string sPath) = 0;
+		// Returns false, if the compressed data of the part cannot be copied verbatim into another package
+		virtual nfBool getRawPartInfo(_In_ std::string sPath, _Out_ ZIPRAWENTRYINFO & RawEntryInfo) = 0;
+		// Opens the compressed data of a part, as described by getRawPartInfo
+		virtual PImportStream openRawPart(_In_ std::string sPath) = 0;
 		virtual void close() {}
 	};
 
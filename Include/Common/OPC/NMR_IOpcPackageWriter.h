@@ -6,6 +6,8 @@
 #include <list>
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 namespace NMR {
 	class COpcPackageRelationship;
@@ -16,6 +18,7 @@ namespace NMR {
 	class IOpcPackageWriter {
 	public:
 		virtual POpcPackagePart addPart(_In_ std::string sPath) = 0;
+		virtual POpcPackagePart addRawPart(_In_ std::string sPath, _In_ const ZIPRAWENTRYINFO & RawEntryInfo, _In_ CImportStream * pCompressedStream) = 0;
 		virtual void addContentType(_In_ std::string sExtension, _In_ std::string sContentType) = 0;
 		virtual void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) = 0;
 		virtual POpcPackageRelationship addRootRelationship(_In_ std::string sType, _In_ COpcPackagePart * pTargetPart) = 0;
@@ -54,6 +54,7 @@ namespace NMR {
 
 		std::multimap<std::string, POpcPackageRelationship> m_Relationships;
 	public:
+		COpcPackagePart(_In_ std::string sURI);
 		COpcPackagePart(_In_ std::string sURI, _In_ PExportStream pExportStream);
 		COpcPackagePart(_In_ std::string sURI, _In_ PImportStream pImportStream);
 		COpcPackagePart(_In_ COpcPackagePart const & cp, _In_ PExportStream pExportStream);
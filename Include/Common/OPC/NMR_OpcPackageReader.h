@@ -54,6 +54,7 @@ namespace NMR {
 		PProgressMonitor m_pProgressMonitor;
 
 		// ZIP Handling Variables
+		PImportStream m_pImportStream;
 		std::vector<nfByte> m_Buffer;
 		zip_error_t m_ZIPError;
 		zip_t * m_ZIParchive;
@@ -80,6 +81,8 @@ namespace NMR {
 		_Ret_maybenull_ COpcPackageRelationship * findRootRelation(_In_ std::string sRelationType, _In_ nfBool bMustBeUnique) override;
 		POpcPackagePart createPart(_In_ std::string sPath) override;
 		nfUint64 getPartSize(_In_ std::string sPath) override;
+		nfBool getRawPartInfo(_In_ std::string sPath, _Out_ ZIPRAWENTRYINFO & RawEntryInfo) override;
+		PImportStream openRawPart(_In_ std::string sPath) override;
 	};
 
 	typedef std::shared_ptr<COpcPackageReader> POpcPackageReader;
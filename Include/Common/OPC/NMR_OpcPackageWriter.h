@@ -67,6 +67,7 @@ namespace NMR {
 		~COpcPackageWriter();
 
 		POpcPackagePart addPart(_In_ std::string sPath) override;
+		POpcPackagePart addRawPart(_In_ std::string sPath, _In_ const ZIPRAWENTRYINFO & RawEntryInfo, _In_ CImportStream * pCompressedStream) override;
 
 		void addContentType(_In_ std::string sExtension, _In_ std::string sContentType) override;
 		void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) override;
@@ -0,0 +1,93 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ExportStream_Cache.h defines an export stream that keeps the written data in memory
+and moves it to a temporary file once it exceeds a size threshold.
+
+--*/
+
+#ifndef __NMR_EXPORTSTREAM_CACHE
+#define __NMR_EXPORTSTREAM_CACHE
+
+#include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_ExportStream_Memory.h"
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+#include <string>
+
+#define NMR_EXPORTSTREAMCACHE_SPILLTHRESHOLD (256ULL * 1024ULL * 1024ULL)
+#define NMR_EXPORTSTREAMCACHE_COPYBUFFERSIZE (1024 * 1024)
+
+namespace NMR {
+
+	class CExportStreamCache : public CExportStream {
+	private:
+		PExportStreamMemory m_pMemoryStream;
+		// Spill file in the temporary directory. It is written through m_pSpillStream until the
+		// first replay closes it, and deleted with the cache.
+		std::string m_sSpillFileName;
+		PExportStream m_pSpillStream;
+		nfUint64 m_nSpillThreshold;
+		nfUint64 m_nSpillFileSize;
+		// Set, if the spill file could not be written. Only the size of the data is tracked then,
+		// so that the export itself does not depend on the temporary directory.
+		nfBool m_bDiscarded;
+
+		void spillToFile();
+		void discardData(_In_ nfUint64 nPosition);
+		CExportStream * spillStream();
+		PImportStream openSpillFile();
+
+	public:
+		CExportStreamCache(_In_ nfUint64 nSpillThreshold = NMR_EXPORTSTREAMCACHE_SPILLTHRESHOLD);
+		// Keeps data that has been written to a memory stream; it is never spilled
+		CExportStreamCache(_In_ PExportStreamMemory pMemoryStream);
+		~CExportStreamCache();
+
+		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfUint64 getPosition();
+		virtual nfUint64 writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite);
+
+		nfUint64 getDataSize();
+		nfBool isSpilled();
+		nfBool isReplayable();
+
+		// Replay the cached data; no data can be written afterwards. Fails, if the data was discarded.
+		void copyToBuffer(_Out_ nfByte * pBuffer, _In_ nfUint64 cbBufferSize);
+		void copyToStream(_In_ CExportStream * pStream);
+	};
+
+	typedef std::shared_ptr <CExportStreamCache> PExportStreamCache;
+
+}
+
+#endif // __NMR_EXPORTSTREAM_CACHE
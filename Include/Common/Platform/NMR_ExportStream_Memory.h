@@ -40,12 +40,25 @@ NMR_ExportStream_Memory.h defines the ExportStream to Memory Class.
 #include "Common/Platform/NMR_ImportStream.h"
 #include <vector>
 
+// Chunks start small and double in size until they reach the maximum chunk size
+#define NMR_EXPORTSTREAMMEMORY_INITIALCHUNKSIZE 4096
+#define NMR_EXPORTSTREAMMEMORY_MAXCHUNKSIZE (16 * 1024 * 1024)
+
 namespace NMR {
 
+	// Memory stream that keeps its data in a list of chunks, so that growing never moves written data
 	class CExportStreamMemory : public CExportStream {
 	private:
-		std::vector<nfByte> m_Buffer;
+		std::vector<std::vector<nfByte>> m_Chunks;
+		std::vector<nfUint64> m_ChunkOffsets;
+		nfUint64 m_nCapacity;
+		nfUint64 m_nDataSize;
 		nfUint64 m_Position;
+		nfUint32 m_nCurrentChunk;
+
+		void appendChunk(_In_ nfUint64 cbMinimumSize);
+		nfUint32 findChunk(_In_ nfUint64 nPosition);
+		void flatten();
 
 	public:
 		CExportStreamMemory();
@@ -57,7 +70,18 @@ namespace NMR {
 		virtual nfUint64 writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite);
 
 		nfUint64 getDataSize();
+
+		// Contiguous view of the data; joins all chunks into one
 		const nfByte *getData();
+
+		// Access to the chunks without joining them
+		nfUint32 getChunkCount();
+		const nfByte * getChunk(_In_ nfUint32 nIndex, _Out_ nfUint64 & cbChunkSize);
+		void copyToBuffer(_Out_ nfByte * pBuffer, _In_ nfUint64 cbBufferSize);
+		void copyToStream(_In_ CExportStream * pStream);
+
+		// Hands the data over to the caller and leaves the stream empty
+		std::vector<nfByte> releaseData();
 	};
 
 	typedef std::shared_ptr <CExportStreamMemory> PExportStreamMemory;
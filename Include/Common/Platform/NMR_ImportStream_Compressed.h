@@ -47,9 +47,10 @@ namespace NMR {
 		PImportStream m_pCompressedStream;
 		z_stream m_strm;
 		std::vector<nfByte> m_decompressedBuffer;
-		nfByte in[IMPORTSTREAM_COMPRESSED_CHUNKSIZE];
+		std::vector<nfByte> m_compressedBuffer;
 	public:
-		CImportStream_Compressed(PImportStream pCompressedStream);
+		// nChunkSize is the number of compressed bytes read from pCompressedStream per inflate call
+		CImportStream_Compressed(PImportStream pCompressedStream, nfUint32 nChunkSize = IMPORTSTREAM_COMPRESSED_CHUNKSIZE);
 		~CImportStream_Compressed();
 
 		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
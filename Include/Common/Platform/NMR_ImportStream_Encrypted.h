@@ -41,6 +41,7 @@ to the proper callbacks that will decrypt the content before returning back to t
 #include "Common/Platform/NMR_EncryptionHeader.h"
 
 #include <functional>
+#include <vector>
 
 namespace NMR {
 
@@ -48,6 +49,7 @@ namespace NMR {
 		PImportStream m_pEncryptedStream;
 		ContentEncryptionDescriptor m_pDecryptContext;
 		CEncryptionHeader m_header;
+		std::vector<nfByte> m_Buffer;
 	public:
 		CImportStream_Encrypted(PImportStream pEncryptedStream, ContentEncryptionDescriptor context);
 
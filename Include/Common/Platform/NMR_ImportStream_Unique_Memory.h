@@ -51,6 +51,7 @@ namespace NMR {
 			CImportStream_Unique_Memory();
 			CImportStream_Unique_Memory(_In_ CImportStream * pStream, _In_ nfUint64 cbBytesToCopy, _In_ nfBool bNeedsToCopyAllBytes);
 			CImportStream_Unique_Memory(_In_ const nfByte * pBuffer, _In_ nfUint64 cbBytes);
+			CImportStream_Unique_Memory(_In_ std::vector<nfByte> && Buffer);
 		
 			virtual PImportStream copyToMemory();
 	};
@@ -40,6 +40,8 @@ classes.
 #include "Common/Platform/NMR_XmlWriter.h"
 #include "Common/3MF_ProgressMonitor.h"
 
+#include <string>
+
 namespace NMR {
 
 	PImportStream fnCreateImportStreamInstance(_In_ const nfChar * pszFileName);
@@ -47,6 +49,17 @@ namespace NMR {
 	PXmlReader fnCreateXMLReaderInstance(_In_ PImportStream pImportStream, PProgressMonitor  pProgressMonitor);
 	PXmlWriter fnCreateXMLWriterInstance(_In_ PExportStream pExportStream, PProgressMonitor pProgressMonitor);
 
+	// Moves a file onto another one, replacing the target if it exists
+	void fnReplaceFile(_In_ const nfChar * pszSourceFileName, _In_ const nfChar * pszTargetFileName);
+	nfBool fnDeleteFile(_In_ const nfChar * pszFileName);
+
+	// Returns the directory for temporary files, ending with a path separator
+	std::string fnGetTempDirectory();
+	// Creates a new empty file named sPrefix followed by a random suffix and returns its name.
+	// The file is created exclusively, so existing files are never reused or overwritten.
+	// Private files can only be accessed by the current user.
+	std::string fnCreateUniqueFile(_In_ const std::string & sPrefix, _In_ nfBool bPrivate);
+
 }
 
 #endif // __NMR_PLATFORM
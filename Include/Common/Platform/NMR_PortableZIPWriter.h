@@ -34,6 +34,7 @@ NMR_PortableZIPWriter.h defines a portable and fast writer of ZIP files
 #define __NMR_PORTABLEZIPWRITER
 
 #include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_ImportStream.h"
 #include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 #include "Common/Platform/NMR_PortableZIPWriterEntry.h"
 #include "Common/NMR_Types.h"
@@ -41,6 +42,8 @@ NMR_PortableZIPWriter.h defines a portable and fast writer of ZIP files
 #include <string>
 #include <list>
 
+#define ZIPRAWENTRY_BUFFERSIZE 65536
+
 namespace NMR {
 
 	class CPortableZIPWriter {
@@ -57,6 +60,8 @@ namespace NMR {
 
 		std::list<PPortableZIPWriterEntry> m_Entries;
 		PExportStream m_pCurrentStream;
+
+		PPortableZIPWriterEntry writeLocalFileHeader(_In_ const std::string sName, _In_opt_ const ZIPRAWENTRYINFO * pRawEntryInfo);
 	public:
 		CPortableZIPWriter() = delete;
 		CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64);
@@ -65,6 +70,9 @@ namespace NMR {
 		PExportStream createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp);
 		void closeEntry();
 
+		// Writes an entry whose data is already compressed, e.g. when copying an unmodified entry from another archive
+		void writeRawEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ const ZIPRAWENTRYINFO & RawEntryInfo, _In_ CImportStream * pCompressedStream);
+
 		void writeDeflatedBuffer(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbCompressedBytes);
 		void calculateChecksum(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbUncompressedBytes);
 		nfUint64 getCurrentSize(_In_ nfUint32 nEntryKey);
@@ -37,12 +37,14 @@ NMR_PortableZIPWriterEntry.h defines a portable and fast writer of ZIP files
 #include <list>
 #include "Common/NMR_Types.h"
 #include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 namespace NMR {
 
 	class CPortableZIPWriterEntry {
 	private:
 		std::string m_sUTF8Name;
+		nfUint16 m_nCompressionMethod;
 		nfUint32 m_nCRC32;
 		nfUint64 m_nCompressedSize;
 		nfUint64 m_nUncompressedSize;
@@ -53,7 +55,9 @@ namespace NMR {
 		nfUint64 m_nDataPosition;
 	public:
 		CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition);
+		CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition, _In_ const ZIPRAWENTRYINFO & RawEntryInfo);
 		std::string getUTF8Name();
+		nfUint16 getCompressionMethod();
 		nfUint32 getCRC32();
 		nfUint64 getCompressedSize();
 		nfUint64 getUncompressedSize();
@@ -212,6 +212,20 @@ namespace NMR {
 
 #pragma pack()
 
+	// Describes the compressed data of an entry that is copied verbatim from another ZIP archive
+	typedef struct {
+		nfUint16 m_nCompressionMethod;
+		nfUint32 m_nCRC32;
+		nfUint64 m_nCompressedSize;
+		nfUint64 m_nUncompressedSize;
+	} ZIPRAWENTRYINFO;
+
+	inline nfBool fnZIPRawEntryInfoIsEqual(_In_ const ZIPRAWENTRYINFO & Info1, _In_ const ZIPRAWENTRYINFO & Info2)
+	{
+		return (Info1.m_nCompressionMethod == Info2.m_nCompressionMethod) && (Info1.m_nCRC32 == Info2.m_nCRC32) &&
+			(Info1.m_nCompressedSize == Info2.m_nCompressedSize) && (Info1.m_nUncompressedSize == Info2.m_nUncompressedSize);
+	}
+
 }
 
 #endif //__NMR_PORTABLEZIPWRITERTYPES
@@ -36,18 +36,18 @@ NMR_XmlWriter_Native.h implements an XML Writer Class without dependencies.
 #include "Common/Platform/NMR_XmlWriter.h"
 #include <array>
 #include <map>
-#include <list>
+#include <vector>
 #include <string>
 
 #define NATIVEXMLSPACINGBUFFERSIZE 256
 #define NATIVEXMLSPACING 9
 
 #define NATIVEXMLWRITEBUFFERSIZE 65536
+#define NATIVEXMLMINWRITEBUFFERSIZE 256
+#define NATIVEXMLMAXWRITEBUFFERSIZE (64 * 1024 * 1024)
 #define NATIVEXMLMAXSTRINGLENGTH 1048576
 
 #define NATIVEXMLENCODING "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
-#define NATIVEXMLFIXEDENCODINGLENGTH 2048
-#define NATIVEXMLENCODINGBUFFERSIZE ((NATIVEXMLFIXEDENCODINGLENGTH * 6) + 1)
 
 
 namespace NMR {
@@ -55,9 +55,14 @@ namespace NMR {
 	class CXmlWriter_Native : public CXmlWriter {
 	private:
 		std::array<nfByte, NATIVEXMLSPACINGBUFFERSIZE> m_SpacingBuffer;
-		std::list<std::string> m_NodeStack;
 
-		std::array<nfChar, NATIVEXMLENCODINGBUFFERSIZE> m_FixedEncodingBuffer;
+		// Output is combined here and handed to the export stream once the buffer is full
+		std::vector<nfByte> m_WriteBuffer;
+		nfUint32 m_nWriteBufferPosition;
+
+		// Qualified names of the open elements, stored back to back
+		std::vector<nfChar> m_NodeNames;
+		std::vector<nfUint32> m_NodeNameOffsets;
 
 		std::map<std::string, std::string> m_sNameSpaces;
 
@@ -69,18 +74,27 @@ namespace NMR {
 		nfUint32 m_nSpacesPerLayer;
 		nfUint32 m_nLayer;
 
+		void flushWriteBuffer();
 		void writeSpaces(_In_ nfUint32 cbCount);
 		void writeData(_In_ const void * pData, _In_ nfUint32 cbLength);
 		void writeUTF8(_In_ const nfChar * pszString, _In_ nfBool bNewLine);
+		void writeUTF8(_In_ const nfChar * pszString, _In_ nfUint32 cbLength, _In_ nfBool bNewLine);
 		void writeUTF16(_In_ const nfWChar * pszString, _In_ nfBool bNewLine);
+		void writeLineEnding();
+
+		template <nfUint32 N> void writeLiteral(_In_ const nfChar (&szLiteral)[N])
+		{
+			writeData(szLiteral, N - 1);
+			m_bIsFreshLine = false;
+		}
 
 		void closeCurrentElement(_In_ nfBool bNewLine);
 
-		// Buffer needs to be at least 6 times the length of pszwpszString
-		void escapeXMLString(_In_z_ const nfChar * pszString, _Out_ nfChar * pszBuffer);
+		// Writes pszString with XML entities replaced
+		void writeEscapedString(_In_z_ const nfChar * pszString);
 
 	public:
-		CXmlWriter_Native(_In_ PExportStream pExportStream);
+		CXmlWriter_Native(_In_ PExportStream pExportStream, _In_ nfUint32 cbWriteBufferSize = NATIVEXMLWRITEBUFFERSIZE);
 
 		virtual void WriteStartDocument();
 		virtual void WriteEndDocument();
@@ -117,6 +117,9 @@ namespace NMR {
 	class LevelSetObject;
 	typedef std::shared_ptr <LevelSetObject> PLevelSetObject;
 
+	class CModelInstanceCache;
+	typedef std::shared_ptr <CModelInstanceCache> PModelInstanceCache;
+
 	// The Model class implements the unification of all model-file in a 3MF package
 	// It should be understood as a "MultiModel"
 	class CModel {
@@ -141,6 +144,8 @@ namespace NMR {
 
 		// Model Properties
 		nfUint32 m_nHandleCounter;
+		nfUint64 m_nRevision;
+		nfUint64 m_nResourceRevision;
 		eModelUnit m_Unit;
 		std::string m_sLanguage;
 		// Package Thumbnail as attachment
@@ -177,6 +182,9 @@ namespace NMR {
 		// The KeyStore reference
 		PKeyStore m_pKeyStore;
 
+		// Flattened build item instances, rebuilt after each revision change
+		PModelInstanceCache m_pInstanceCache;
+
 		CryptoRandGenDescriptor m_sRandDescriptor;
 
 		// Add Resource to resource lookup tables
@@ -200,6 +208,20 @@ namespace NMR {
 		// Merge all build items into one mesh
 		void mergeToMesh(_In_ CMesh * pMesh);
 
+		// Extends the outbox by all build items
+		void extendOutbox(_Out_ NOUTBOX3& vOutBox);
+
+		// Leaf object instances of all build items with accumulated transforms
+		CModelInstanceCache * getInstanceCache();
+
+		// Revision counter, increased by every tracked modification of the model
+		nfUint64 getRevision();
+		void increaseRevision();
+
+		// Modifications of the build only touch the root model part, and leave the resource revision unchanged
+		nfUint64 getResourceRevision();
+		void increaseBuildRevision();
+
 		// Units setter/getter
 		void setUnit(_In_ eModelUnit Unit);
 		void setUnitString(_In_ std::string sUnitString);
@@ -365,7 +387,7 @@ namespace NMR {
 		PModelResource getSliceStackResource(_In_ nfUint32 nIndex);
 
 		// Sorts objects by correct dependency
-		std::list<CModelObject *> getSortedObjectList ();
+		std::vector<CModelObject *> getSortedObjectList ();
 
 
 		// Gets the KeyStore
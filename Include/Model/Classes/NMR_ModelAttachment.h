@@ -37,6 +37,8 @@ NMR_ModelAttachment.h defines the Model Attachment Class.
 #include "Model/Classes/NMR_ModelMetaData.h" 
 #include "Common/NMR_Types.h" 
 #include "Model/Classes/NMR_ModelTypes.h" 
+#include "Model/Classes/NMR_ModelSourcePackage.h" 
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h" 
 
 #include <string>
 
@@ -51,6 +53,13 @@ namespace NMR {
 		std::string m_sPathURI;
 		std::string m_sRelationShipType;
 
+		// ZIP entry of the package this attachment was read from
+		PModelSourcePackage m_pSourcePackage;
+		std::string m_sSourcePath;
+		ZIPRAWENTRYINFO m_SourceEntryInfo;
+		// Compressed data of the source entry, to be written without recompression
+		PImportStream m_pCompressedStream;
+
 	public:
 		CModelAttachment() = delete;
 		CModelAttachment(_In_ CModel * pModel, _In_ const std::string sPathURI, _In_ const std::string sRelationShipType, _In_ PImportStream pStream);
@@ -64,6 +73,16 @@ namespace NMR {
 		void setStream(_In_ PImportStream pStream);
 		void setRelationShipType(_In_ const std::string sRelationShipType);
 
+		// The source entry is dropped, as soon as the stream is replaced
+		void setSourceEntry(_In_ PModelSourcePackage pSourcePackage, _In_ const std::string & sSourcePath, _In_ const ZIPRAWENTRYINFO & SourceEntryInfo);
+		PModelSourcePackage getSourcePackage();
+		std::string getSourcePath();
+		ZIPRAWENTRYINFO getSourceEntryInfo();
+
+		// The compressed stream is dropped, as soon as the stream is replaced
+		void setCompressedStream(_In_ PImportStream pCompressedStream, _In_ const ZIPRAWENTRYINFO & SourceEntryInfo);
+		PImportStream getCompressedStream();
+
 		PModelAttachment cloneIntoNewModel (_In_ CModel * pModel, _In_ nfBool bCloneMemory);
 	};
 
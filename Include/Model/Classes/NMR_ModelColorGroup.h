@@ -38,6 +38,7 @@ color group resource object.
 #include "Model/Classes/NMR_ModelResource.h"
 #include "Model/Classes/NMR_ModelTypes.h"
 #include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelPropertyStore.h"
 #include <vector>
 
 namespace NMR {
@@ -47,8 +48,7 @@ namespace NMR {
 
 	class CModelColorGroupResource : public CModelResource {
 	private:
-		std::map<ModelPropertyID, nfColor> m_pColors;
-		ModelPropertyID m_nNextPropertyID;
+		CModelPropertyStore<nfColor> m_Colors;
 
 	public:
 		CModelColorGroupResource() = delete;
@@ -60,6 +60,10 @@ namespace NMR {
 		nfColor getColor(_In_ ModelPropertyID nPropertyID);
 		void setColor(_In_ ModelPropertyID nPropertyID, _In_ nfColor cColor);
 
+		// Bulk access in ascending PropertyID order, with getCount() entries
+		void getAllColors(_Out_ nfColor * pColors);
+		void setAllColors(_In_ const nfColor * pColors, _In_ nfUint32 nCount);
+
 		void removeColor(_In_ ModelPropertyID nPropertyID);
 		void mergeFrom(_In_ CModelColorGroupResource * pSourceMaterial);
 		void buildResourceIndexMap();
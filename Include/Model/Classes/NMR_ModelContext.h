@@ -43,12 +43,14 @@ namespace NMR {
 	class CSecureContext;
 	class CProgressMonitor;
 	class CModelWarnings;
+	class CStatistics;
 
 	using PModel = std::shared_ptr<CModel>;
 	using PKeyStore = std::shared_ptr<CKeyStore>;
 	using PSecureContext = std::shared_ptr<CSecureContext>;
 	using PProgressMonitor = std::shared_ptr<CProgressMonitor>;
 	using PModelWarnings = std::shared_ptr<CModelWarnings>;
+	using PStatistics = std::shared_ptr<CStatistics>;
 
 	class CModelContext {
 	private:
@@ -57,6 +59,7 @@ namespace NMR {
 		PProgressMonitor m_pProgressMonitor;
 		PModelWarnings m_pWarnings;
 		PKeyStore m_pKeystore;
+		PStatistics m_pStatistics;
 
 	protected:
 
@@ -85,6 +88,10 @@ namespace NMR {
 			return m_pSecureContext;
 		}
 
+		inline PStatistics const & statistics() const{
+			return m_pStatistics;
+		}
+
 		nfBool isComplete() const;
 
 		void SetProgressCallback(Lib3MFProgressCallback callback, void* userData);
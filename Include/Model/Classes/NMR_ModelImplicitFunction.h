@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Model/Classes/NMR_ModelFunction.h"
@@ -65,9 +66,26 @@ namespace NMR
         PImplicitNodes m_nodes;
         static const implicit::NodeTypes m_nodeTypes;
 
+        // Hash index of the nodes by identifier. Identifiers are supposed to be
+        // unique. If they are not, the index refers to the first of the nodes in
+        // m_nodes, as a linear search would, and nCount holds the number of nodes
+        // sharing the identifier.
+        struct sNodeIndexEntry
+        {
+            PModelImplicitNode pNode;
+            size_t nCount;
+        };
+        std::unordered_map<ImplicitIdentifier, sNodeIndexEntry> m_nodeIndex;
+
+        void rebuildNodeIndex();
+
         CModelImplicitNode* findNode(
             const ImplicitIdentifier& sIdentifier) const;
 
+        PModelImplicitPort findLinkSource(const ImplicitIdentifier& sSourceIdentifier) const;
+        PModelImplicitPort findLinkTarget(const ImplicitIdentifier& sTargetIdentifier) const;
+        static void checkLinkPortTypes(CModelImplicitPort const& sourcePort, CModelImplicitPort const& targetPort);
+
        public:
         CModelImplicitFunction(_In_ const ModelResourceID sID,
                                _In_ CModel* pModel);
@@ -97,7 +115,11 @@ namespace NMR
 
         void addLink(PModelImplicitPort pSourcePort, PModelImplicitPort pTargetPort);
 
-        implicit::NodeTypes const& getNodeTypes() const;
+        // Keep the identifier index consistent, called by the nodes of this function
+        void indexNode(PModelImplicitNode const& pNode);
+        void unindexNode(CModelImplicitNode const& node);
+
+        static implicit::NodeTypes const& getNodeTypes();
 
         void removeNode(const ImplicitIdentifier& sIdentifier);
 
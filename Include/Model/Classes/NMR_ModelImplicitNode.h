@@ -45,7 +45,7 @@ namespace NMR
 
     using GraphID = unsigned int;
     using TopologicalOrderIndex = unsigned int;
-    class CModelImplicitNode
+    class CModelImplicitNode : public std::enable_shared_from_this<CModelImplicitNode>
     {
       private:
         Lib3MF::eImplicitNodeType m_type;
@@ -0,0 +1,89 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelInstanceCache.h defines a cache that flattens the build items of a
+model into instances of leaf objects (mesh objects and level sets) with their
+accumulated transforms, and the writer order of all objects. The cache is keyed
+on the model revision and rebuilt on the first query after a modification.
+
+--*/
+
+#ifndef __NMR_MODELINSTANCECACHE
+#define __NMR_MODELINSTANCECACHE
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Math/NMR_Matrix.h"
+#include <vector>
+#include <unordered_map>
+
+namespace NMR {
+
+	class CModel;
+	class CModelObject;
+	class CModelBuildItem;
+
+	typedef struct {
+		CModelObject * m_pObject;
+		NMATRIX3 m_mTransform;
+		nfUint32 m_nBuildItemIndex;
+	} MODELINSTANCE;
+
+	class CModelInstanceCache {
+	private:
+		CModel * m_pModel;
+		nfUint64 m_nRevision;
+		nfBool m_bIsValid;
+
+		// Instances of all build items, in build item order. Build item i owns [m_BuildItemOffsets[i], m_BuildItemOffsets[i + 1])
+		std::vector<MODELINSTANCE> m_Instances;
+		std::vector<nfUint32> m_BuildItemOffsets;
+		std::unordered_map<CModelBuildItem *, nfUint32> m_BuildItemIndices;
+
+		// All objects, sorted by (component depth level descending, UniqueResourceID ascending)
+		std::vector<CModelObject *> m_SortedObjects;
+
+		void update();
+		void flattenObject(_In_ CModelObject * pObject, _In_ const NMATRIX3 & mMatrix, _In_ nfUint32 nBuildItemIndex);
+		void sortObjects();
+
+	public:
+		CModelInstanceCache() = delete;
+		CModelInstanceCache(_In_ CModel * pModel);
+
+		void invalidate();
+
+		const std::vector<MODELINSTANCE> & getInstances();
+		void getBuildItemInstances(_In_ CModelBuildItem * pBuildItem, _Out_ nfUint32 & nFirst, _Out_ nfUint32 & nCount);
+
+		const std::vector<CModelObject *> & getSortedObjects();
+	};
+
+}
+
+#endif // __NMR_MODELINSTANCECACHE
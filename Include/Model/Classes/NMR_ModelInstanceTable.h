@@ -0,0 +1,95 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelInstanceTable.h defines an instanced view of the build of a model: every
+mesh object that is placed by the build items is listed once, with its geometry
+packed into contiguous vertex and index buffers, together with a flat array of
+its instances and their accumulated transforms. Mesh geometry is packed in
+parallel.
+
+--*/
+
+#ifndef __NMR_MODELINSTANCETABLE
+#define __NMR_MODELINSTANCETABLE
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Math/NMR_Geometry.h"
+#include "Common/Math/NMR_Matrix.h"
+#include <memory>
+#include <vector>
+
+// Meshes and instances are processed in parallel in chunks of at least this size
+#define NMR_MODELINSTANCETABLE_MINMESHESPERTHREAD 4
+#define NMR_MODELINSTANCETABLE_MININSTANCESPERTHREAD 1024
+
+namespace NMR {
+
+	class CModel;
+	class CModelMeshObject;
+	typedef std::shared_ptr <CModelMeshObject> PModelMeshObject;
+
+	typedef struct {
+		PModelMeshObject m_pMeshObject;
+		nfUint32 m_nVertexOffset;
+		nfUint32 m_nVertexCount;
+		nfUint32 m_nTriangleOffset;
+		nfUint32 m_nTriangleCount;
+	} MODELINSTANCETABLEMESH;
+
+	typedef struct {
+		nfUint32 m_nMeshIndex;
+		nfUint32 m_nBuildItemIndex;
+		NMATRIX3 m_mTransform;
+	} MODELINSTANCETABLEENTRY;
+
+	class CModelInstanceTable {
+	private:
+		std::vector<MODELINSTANCETABLEMESH> m_Meshes;
+		std::vector<NVEC3> m_Vertices;
+		// Three vertex indices per triangle, relative to the vertex offset of the mesh
+		std::vector<nfUint32> m_Indices;
+		std::vector<MODELINSTANCETABLEENTRY> m_Entries;
+
+	public:
+		CModelInstanceTable() = delete;
+		CModelInstanceTable(_In_ CModel * pModel, _In_ nfUint32 nThreadCount = 0);
+
+		nfUint32 getMeshCount() const;
+		const MODELINSTANCETABLEMESH & getMesh(_In_ nfUint32 nMeshIndex) const;
+
+		const std::vector<NVEC3> & getVertices() const;
+		const std::vector<nfUint32> & getIndices() const;
+		const std::vector<MODELINSTANCETABLEENTRY> & getEntries() const;
+	};
+
+	typedef std::shared_ptr <CModelInstanceTable> PModelInstanceTable;
+
+}
+
+#endif // __NMR_MODELINSTANCETABLE
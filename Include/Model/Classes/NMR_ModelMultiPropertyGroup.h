@@ -38,8 +38,12 @@ color group resource object.
 #include "Model/Classes/NMR_ModelResource.h"
 #include "Model/Classes/NMR_ModelTypes.h"
 #include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelPropertyStore.h"
 #include <vector>
 
+// The PropertyID pool is compacted once more than half of it (and at least this many entries) is unused
+#define NMR_MODELMULTIPROPERTYGROUP_MINCOMPACTSIZE 1024
+
 namespace NMR {
 
 	class CModel;
@@ -48,12 +52,22 @@ namespace NMR {
 	typedef std::vector<ModelPropertyID> CModelMultiProperty;
 	typedef std::shared_ptr<CModelMultiProperty> PModelMultiProperty;
 
+	// Location of the PropertyIDs of one multiproperty within the shared PropertyID pool
+	typedef struct {
+		nfUint32 m_nOffset;
+		nfUint32 m_nCount;
+	} MODELMULTIPROPERTYENTRY;
+
 	class CModelMultiPropertyGroupResource : public CModelResource {
 	private:
-		std::map<ModelPropertyID, PModelMultiProperty> m_vctMultiProperties;
+		CModelPropertyStore<MODELMULTIPROPERTYENTRY> m_MultiProperties;
+		std::vector<ModelPropertyID> m_PropertyIDPool;
+		nfUint32 m_nUnusedPoolEntries;
 		std::vector<MODELMULTIPROPERTYLAYER> m_vctLayers;
 
-		ModelPropertyID m_nNextPropertyID;
+		MODELMULTIPROPERTYENTRY appendToPool(_In_ const ModelPropertyID * pPropertyIDs, _In_ nfUint32 nCount);
+		void releaseFromPool(_In_ const MODELMULTIPROPERTYENTRY & Entry);
+		void compactPool();
 	public:
 		CModelMultiPropertyGroupResource() = delete;
 		CModelMultiPropertyGroupResource(_In_ const ModelResourceID sID, _In_ CModel * pModel);
@@ -64,6 +78,11 @@ namespace NMR {
 		void setMultiProperty(_In_ ModelPropertyID nPropertyID, _In_ PModelMultiProperty pMultiProperty);
 		void removeMultiProperty(_In_ ModelPropertyID nPropertyID);
 
+		// Access without intermediate allocations. The returned pointer is valid until the group is modified.
+		nfUint32 addMultiProperty(_In_ const ModelPropertyID * pPropertyIDs, _In_ nfUint32 nCount);
+		const ModelPropertyID * getMultiPropertyIDs(_In_ ModelPropertyID nPropertyID, _Out_ nfUint32 & nCount);
+		void setMultiProperty(_In_ ModelPropertyID nPropertyID, _In_ const ModelPropertyID * pPropertyIDs, _In_ nfUint32 nCount);
+
 		nfUint32 getLayerCount();
 		nfUint32 addLayer(_In_ MODELMULTIPROPERTYLAYER sLayer);
 		MODELMULTIPROPERTYLAYER getLayer(_In_ nfUint32 nIndex);
@@ -58,8 +58,6 @@ namespace NMR {
 		eModelSlicesMeshResolution m_eSlicesMeshResolution;
 		PModelMetaDataGroup m_MetaDataGroup;
 
-		nfUint32 m_nComponentDepthLevel;
-
 	private:
 		PUUID m_UUID;
 		PModelAttachment m_pThumbnailAttachment;
@@ -112,11 +110,6 @@ namespace NMR {
 		void setThumbnailAttachment(_In_ PModelAttachment pThumbnailAttachment, bool bThrowIfIncorrect);
 		PModelAttachment getThumbnailAttachment();
 
-		// Calculates the component Depths
-		nfUint32 getComponentDepthLevel ();
-		void clearComponentDepthLevel();
-		virtual void calculateComponentDepthLevel (nfUint32 nLevel);
-
 		virtual void extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix) = 0;
 	};
 
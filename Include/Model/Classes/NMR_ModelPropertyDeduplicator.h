@@ -0,0 +1,88 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelPropertyDeduplicator.h defines an optimization pass that merges equal
+entries of the color and texture coordinate groups of a model. References of
+triangles, mesh objects and multiproperties are remapped to the remaining
+entries, and entries that are no longer referenced can be dropped.
+
+--*/
+
+#ifndef __NMR_MODELPROPERTYDEDUPLICATOR
+#define __NMR_MODELPROPERTYDEDUPLICATOR
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Model/Classes/NMR_ModelTypes.h"
+#include <vector>
+#include <map>
+#include <atomic>
+
+// Faces of a mesh are remapped in parallel in chunks of at least this size
+#define NMR_MODELPROPERTYDEDUPLICATOR_MINFACESPERTHREAD 16384
+
+namespace NMR {
+
+	class CModel;
+	class CModelResource;
+	class CMesh;
+
+	class CModelPropertyDeduplicator {
+	private:
+		// Per group state: PropertyID -> canonical PropertyID (0 if the ID does not exist), and reference flags
+		typedef struct sMODELPROPERTYDEDUPLICATORGROUP {
+			CModelResource * m_pResource;
+			std::vector<ModelPropertyID> m_CanonicalIDs;
+			std::vector<std::atomic<nfBool>> m_Referenced;
+		} MODELPROPERTYDEDUPLICATORGROUP;
+
+		CModel * m_pModel;
+		nfUint32 m_nThreadCount;
+
+		std::vector<MODELPROPERTYDEDUPLICATORGROUP> m_Groups;
+		std::map<UniqueResourceID, nfUint32> m_GroupIndices;
+
+		void collectGroups();
+		void findDuplicates(_In_ MODELPROPERTYDEDUPLICATORGROUP & Group);
+		void remapMesh(_In_ CMesh * pMesh);
+		void remapMultiProperties();
+		nfUint32 removeEntries(_In_ MODELPROPERTYDEDUPLICATORGROUP & Group, _In_ nfBool bRemoveUnreferenced);
+
+		MODELPROPERTYDEDUPLICATORGROUP * findGroup(_In_ UniqueResourceID nUniqueResourceID);
+	public:
+		CModelPropertyDeduplicator() = delete;
+		CModelPropertyDeduplicator(_In_ CModel * pModel, _In_ nfUint32 nThreadCount = 0);
+
+		// Returns the number of removed entries. Unreferenced entries are only dropped from
+		// groups that are referenced at all, so that no group ends up empty.
+		nfUint32 deduplicate(_In_ nfBool bRemoveUnreferenced);
+	};
+
+}
+
+#endif // __NMR_MODELPROPERTYDEDUPLICATOR
@@ -0,0 +1,245 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelPropertyStore.h defines a storage template for the entries of property
+group resources (colors, texture coordinates, materials, multiproperties).
+
+Property IDs are handed out as an increasing, 1-based counter, so entries are
+kept in a contiguous array indexed by PropertyID - 1. Removed entries leave a
+hole that is tracked in an occupancy array. Once most of the array consists of
+holes, the store falls back to a sparse map. Both layouts iterate in ascending
+PropertyID order.
+
+--*/
+
+#ifndef __NMR_MODELPROPERTYSTORE
+#define __NMR_MODELPROPERTYSTORE
+
+#include "Model/Classes/NMR_ModelTypes.h"
+#include "Common/NMR_Exception.h"
+#include <vector>
+#include <map>
+#include <algorithm>
+
+// Dense arrays of at least this size switch to the sparse layout, if less than a quarter of their entries are in use
+#define NMR_MODELPROPERTYSTORE_MINSPARSESIZE 1024
+#define NMR_MODELPROPERTYSTORE_SPARSEFRACTION 4
+
+namespace NMR {
+
+	template <typename T>
+	class CModelPropertyStore {
+	private:
+		std::vector<T> m_DenseValues;
+		std::vector<nfByte> m_DenseOccupied;
+		nfUint32 m_nDenseCount;
+
+		std::map<ModelPropertyID, T> m_SparseValues;
+		nfBool m_bIsSparse;
+
+		ModelPropertyID m_nNextPropertyID;
+
+		void switchToSparse()
+		{
+			nfUint32 nSize = (nfUint32)m_DenseValues.size();
+			for (nfUint32 nIndex = 0; nIndex < nSize; nIndex++) {
+				if (m_DenseOccupied[nIndex])
+					m_SparseValues.insert(std::make_pair(nIndex + 1, m_DenseValues[nIndex]));
+			}
+
+			std::vector<T>().swap(m_DenseValues);
+			std::vector<nfByte>().swap(m_DenseOccupied);
+			m_nDenseCount = 0;
+			m_bIsSparse = true;
+		}
+
+	public:
+		CModelPropertyStore()
+			: m_nDenseCount(0), m_bIsSparse(false), m_nNextPropertyID(1)
+		{
+		}
+
+		nfUint32 getCount() const
+		{
+			if (m_bIsSparse)
+				return (nfUint32)m_SparseValues.size();
+			return m_nDenseCount;
+		}
+
+		// Returns true, if the property IDs of the store are exactly 1 ... getCount()
+		nfBool isContiguous() const
+		{
+			return (!m_bIsSparse) && (m_nDenseCount == m_DenseValues.size());
+		}
+
+		// Returns the property ID that the next call of add will assign
+		ModelPropertyID getNextPropertyID() const
+		{
+			return m_nNextPropertyID;
+		}
+
+		nfBool isSparse() const
+		{
+			return m_bIsSparse;
+		}
+
+		void reserve(_In_ nfUint32 nCount)
+		{
+			if (!m_bIsSparse) {
+				m_DenseValues.reserve(nCount);
+				m_DenseOccupied.reserve(nCount);
+			}
+		}
+
+		ModelPropertyID add(_In_ const T & value)
+		{
+			ModelPropertyID nPropertyID = m_nNextPropertyID;
+
+			if (m_bIsSparse) {
+				m_SparseValues.insert(std::make_pair(nPropertyID, value));
+			}
+			else {
+				m_DenseValues.push_back(value);
+				m_DenseOccupied.push_back(1);
+				m_nDenseCount++;
+			}
+
+			m_nNextPropertyID++;
+			return nPropertyID;
+		}
+
+		// Returns nullptr, if the property ID does not exist
+		T * find(_In_ ModelPropertyID nPropertyID)
+		{
+			if (m_bIsSparse) {
+				auto iIterator = m_SparseValues.find(nPropertyID);
+				if (iIterator != m_SparseValues.end())
+					return &iIterator->second;
+				return nullptr;
+			}
+
+			if ((nPropertyID == 0) || (nPropertyID > m_DenseValues.size()))
+				return nullptr;
+			if (!m_DenseOccupied[nPropertyID - 1])
+				return nullptr;
+			return &m_DenseValues[nPropertyID - 1];
+		}
+
+		void remove(_In_ ModelPropertyID nPropertyID)
+		{
+			if (m_bIsSparse) {
+				m_SparseValues.erase(nPropertyID);
+				return;
+			}
+
+			if ((nPropertyID == 0) || (nPropertyID > m_DenseValues.size()))
+				return;
+			if (!m_DenseOccupied[nPropertyID - 1])
+				return;
+
+			m_DenseOccupied[nPropertyID - 1] = 0;
+			m_DenseValues[nPropertyID - 1] = T();
+			m_nDenseCount--;
+
+			nfUint32 nSize = (nfUint32)m_DenseValues.size();
+			if ((nSize >= NMR_MODELPROPERTYSTORE_MINSPARSESIZE) && (m_nDenseCount < nSize / NMR_MODELPROPERTYSTORE_SPARSEFRACTION))
+				switchToSparse();
+		}
+
+		// Calls fnCallback(nPropertyID, value) for all entries in ascending PropertyID order
+		template <typename F>
+		void forEach(_In_ F fnCallback)
+		{
+			if (m_bIsSparse) {
+				for (auto & iIterator : m_SparseValues)
+					fnCallback(iIterator.first, iIterator.second);
+				return;
+			}
+
+			nfUint32 nSize = (nfUint32)m_DenseValues.size();
+			for (nfUint32 nIndex = 0; nIndex < nSize; nIndex++) {
+				if (m_DenseOccupied[nIndex])
+					fnCallback(nIndex + 1, m_DenseValues[nIndex]);
+			}
+		}
+
+		void getPropertyIDs(_Out_ std::vector<ModelPropertyID> & PropertyIDs)
+		{
+			PropertyIDs.clear();
+			PropertyIDs.reserve(getCount());
+			if (isContiguous()) {
+				for (nfUint32 nIndex = 0; nIndex < m_nDenseCount; nIndex++)
+					PropertyIDs.push_back(nIndex + 1);
+			}
+			else {
+				forEach([&PropertyIDs](ModelPropertyID nPropertyID, T &) {
+					PropertyIDs.push_back(nPropertyID);
+				});
+			}
+		}
+
+		// Copies all values in ascending PropertyID order. pValues must hold getCount() entries.
+		void getAll(_Out_ T * pValues)
+		{
+			if ((pValues == nullptr) && (getCount() > 0))
+				throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+			if (isContiguous()) {
+				std::copy(m_DenseValues.begin(), m_DenseValues.end(), pValues);
+			}
+			else {
+				forEach([&pValues](ModelPropertyID, T & value) {
+					*pValues = value;
+					pValues++;
+				});
+			}
+		}
+
+		// Overwrites all values in ascending PropertyID order. nCount must equal getCount().
+		void setAll(_In_ const T * pValues, _In_ nfUint32 nCount)
+		{
+			if (nCount != getCount())
+				throw CNMRException(NMR_ERROR_INVALIDPARAM);
+			if ((pValues == nullptr) && (nCount > 0))
+				throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+			if (isContiguous()) {
+				std::copy(pValues, pValues + nCount, m_DenseValues.begin());
+			}
+			else {
+				forEach([&pValues](ModelPropertyID, T & value) {
+					value = *pValues;
+					pValues++;
+				});
+			}
+		}
+	};
+
+}
+
+#endif // __NMR_MODELPROPERTYSTORE
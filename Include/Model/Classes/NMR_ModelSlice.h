@@ -56,6 +56,9 @@ namespace NMR {
 
 		void Clear();
 
+		// Pre-grows the vertex and polygon arrays
+		void reserve(nfUint32 nVertexCount, nfUint32 nPolygonCount);
+
 		nfUint32 addVertex(nfFloat x, nfFloat y);
 
 		void getVertex(nfUint32 nIndex, nfFloat *x, nfFloat *y);
@@ -78,6 +81,8 @@ namespace NMR {
 
 		nfUint32 getPolygonIndexCount(nfUint32 nPolygonIndex);
 
+		const std::vector<nfUint32> & getPolygon(nfUint32 nPolygonIndex);
+
 		nfUint32 getVertexCount();
 
 		bool allPolygonsAreClosed();
@@ -52,6 +52,10 @@ namespace NMR {
 
 		std::vector<PModelSliceStack> m_pSliceRefs;
 		std::vector<PSlice> m_pSlices;
+
+		nfUint32 countSlicesBelow(nfDouble dZ) const;
+		nfUint64 countTotalSlicesBelow(nfDouble dZ) const;
+		nfDouble getTotalSliceLowerZ(nfUint64 nIndex) const;
 	public:
 		bool AllowsGeometry() const;
 		bool AllowsReferences() const;
@@ -63,6 +67,7 @@ namespace NMR {
 		~CModelSliceStack();
 
 		PSlice AddSlice(const nfDouble dZTop);
+		void AddSlice(PSlice pSlice);
 		void AddSliceRef(PModelSliceStack pOtherStack, bool bPedantic = true);
 
 		nfUint32 getSliceCount();
@@ -76,6 +81,12 @@ namespace NMR {
 
 		nfDouble getHighestZ() const;
 
+		// The slice view of a stack are its own slices or the slices of all its slice refs, in order
+		nfUint64 getTotalSliceCount() const;
+		PSlice getTotalSlice(nfUint64 nIndex) const;
+		nfBool findTotalSliceAtZ(nfDouble dZ, nfUint64 & nIndex) const;
+		void getTotalSliceRange(nfDouble dZMin, nfDouble dZMax, nfUint64 & nFirstIndex, nfUint64 & nCount) const;
+
 		void CollapseSliceReferences();
 
 		std::string OwnPath();
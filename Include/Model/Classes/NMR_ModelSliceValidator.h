@@ -0,0 +1,108 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelSliceValidator.h defines a validation pass for the polygons of a slice
+stack. Layers are validated in parallel chunks. Per layer, it checks that polygons
+are closed and not degenerate, that closed contours do not intersect (sweep over
+the segments in X), and that the orientation of every contour is opposite to the
+contour it is nested in.
+
+--*/
+
+#ifndef __NMR_MODELSLICEVALIDATOR
+#define __NMR_MODELSLICEVALIDATOR
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Model/Classes/NMR_ModelSlice.h"
+#include <vector>
+
+// Checks performed by the validator
+#define NMR_MODELSLICEVALIDATOR_CHECKCLOSURE 0x0001
+#define NMR_MODELSLICEVALIDATOR_CHECKINTERSECTIONS 0x0002
+#define NMR_MODELSLICEVALIDATOR_CHECKORIENTATION 0x0004
+#define NMR_MODELSLICEVALIDATOR_CHECKALL 0x0007
+
+// Layers are validated in parallel in chunks of at least this size
+#define NMR_MODELSLICEVALIDATOR_MINLAYERSPERTHREAD 16
+
+namespace NMR {
+
+	class CModelSliceStack;
+
+	typedef struct {
+		nfUint32 m_nLayerIndex;
+		nfUint32 m_nOpenPolygons;
+		nfUint32 m_nDegeneratePolygons;
+		nfUint32 m_nSelfIntersections;
+		nfUint32 m_nOrientationErrors;
+		nfUint32 m_nMaxNestingDepth;
+	} MODELSLICELAYERREPORT;
+
+	class CModelSliceValidator {
+	private:
+		nfUint32 m_nChecks;
+		nfUint32 m_nThreadCount;
+
+		typedef struct {
+			nfUint32 m_nPolygon;
+			nfUint32 m_nSegment;
+			nfUint32 m_nSegmentCount;
+			NVEC2 m_vStart;
+			NVEC2 m_vEnd;
+			nfFloat m_fMaxX;
+			nfFloat m_fMinY;
+			nfFloat m_fMaxY;
+		} SLICESEGMENT;
+
+		typedef struct {
+			nfUint32 m_nPolygon;
+			nfDouble m_dArea;
+			nfFloat m_fMinX;
+			nfFloat m_fMaxX;
+			nfFloat m_fMinY;
+			nfFloat m_fMaxY;
+		} SLICECONTOUR;
+
+		nfUint32 countIntersections(_In_ CSlice * pSlice, _In_ const std::vector<SLICECONTOUR> & Contours);
+		void checkNesting(_In_ CSlice * pSlice, _In_ const std::vector<SLICECONTOUR> & Contours, _Out_ MODELSLICELAYERREPORT & Report);
+	public:
+		CModelSliceValidator() = delete;
+		CModelSliceValidator(_In_ nfUint32 nChecks, _In_ nfUint32 nThreadCount = 0);
+
+		// Returns true, if the slice has no issues
+		nfBool validateSlice(_In_ CSlice * pSlice, _Out_ MODELSLICELAYERREPORT & Report);
+
+		// Validates the slice view of a stack (see CModelSliceStack::getTotalSlice). Only layers with
+		// issues are reported, in ascending order. Returns true, if there are none.
+		nfBool validateStack(_In_ CModelSliceStack * pSliceStack, _Out_ std::vector<MODELSLICELAYERREPORT> & Reports);
+	};
+
+}
+
+#endif // __NMR_MODELSLICEVALIDATOR
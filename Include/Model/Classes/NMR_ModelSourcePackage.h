@@ -26,39 +26,42 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 Abstract:
 
-NMR_ModelReaderNode_slice1507_Segment.h covers the segments of the private 3MF slice extension.
+NMR_ModelSourcePackage.h defines a reference to the package file a model was read from.
+Attachments that were read from this package remember the compressed ZIP entry they came
+from, so that the writer can copy unmodified parts without decompressing and recompressing them.
 
 --*/
 
-#ifndef __NMR_MODELREADERNODE_SLICE1507_VERTEX
-#define __NMR_MODELREADERNODE_SLICE1507_VERTEX
+#ifndef __NMR_MODELSOURCEPACKAGE
+#define __NMR_MODELSOURCEPACKAGE
 
-#include "Model/Reader/NMR_ModelReaderNode.h"
-#include "Model/Classes/NMR_ModelComponent.h"
-#include "Model/Classes/NMR_ModelComponentsObject.h"
-#include "Model/Classes/NMR_ModelObject.h"
-#include "Model/Classes/NMR_ModelConstants_Slices.h"
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
 
-namespace NMR {
-	class CModelReaderNode_Slices1507_Vertex : public CModelReaderNode {
-	private:
-		nfFloat m_x;
-		nfFloat m_y;
+#include <string>
+#include <memory>
 
-		CSlice *m_pSlice;
+namespace NMR {
 
-	protected:
-		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
-		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
+	class CModelSourcePackage {
+	private:
+		std::string m_sFileName;
+		nfUint64 m_nResourceRevision;
 
 	public:
-		CModelReaderNode_Slices1507_Vertex() = delete;
-		CModelReaderNode_Slices1507_Vertex(_In_ CSlice *pSlice, _In_ PModelWarnings pWarnings);
+		CModelSourcePackage() = delete;
+		CModelSourcePackage(_In_ const std::string & sFileName);
+
+		std::string getFileName();
 
-		virtual void parseXML(_In_ CXmlReader * pXMLReader);
+		// Resource revision of the model right after reading. Non-root model parts of the
+		// package are unmodified, as long as the resource revision of the model did not change.
+		nfUint64 getResourceRevision();
+		void setResourceRevision(_In_ nfUint64 nResourceRevision);
 	};
 
-	typedef std::shared_ptr<CModelReaderNode_Slices1507_Vertex> PModelReaderNode_Slices1507_Vertex;
+	typedef std::shared_ptr <CModelSourcePackage> PModelSourcePackage;
+
 }
 
-#endif
\ No newline at end of file
+#endif // __NMR_MODELSOURCEPACKAGE
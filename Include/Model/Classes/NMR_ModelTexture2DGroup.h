@@ -38,6 +38,7 @@ texture2d group resource object.
 #include "Model/Classes/NMR_ModelResource.h"
 #include "Model/Classes/NMR_ModelTypes.h"
 #include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelPropertyStore.h"
 #include <vector>
 
 namespace NMR {
@@ -48,8 +49,7 @@ namespace NMR {
 	class CModelTexture2DGroupResource : public CModelResource {
 	private:
 		PModelTexture2DResource m_pTexture2D;
-		std::map<ModelPropertyID, MODELTEXTURE2DCOORDINATE> m_pUVCoordinates;
-		ModelPropertyID m_nNextPropertyID;
+		CModelPropertyStore<MODELTEXTURE2DCOORDINATE> m_UVCoordinates;
 
 	public:
 		CModelTexture2DGroupResource() = delete;
@@ -63,6 +63,10 @@ namespace NMR {
 
 		MODELTEXTURE2DCOORDINATE getUVCoordinate(_In_ ModelPropertyID nPropertyID);
 
+		// Bulk access in ascending PropertyID order, with getCount() entries
+		void getAllUVCoordinates(_Out_ MODELTEXTURE2DCOORDINATE * pCoordinates);
+		void setAllUVCoordinates(_In_ const MODELTEXTURE2DCOORDINATE * pCoordinates, _In_ nfUint32 nCount);
+
 		void mergeFrom(_In_ CModelTexture2DGroupResource * pSourceMaterial);
 		void buildResourceIndexMap();
 
@@ -41,20 +41,29 @@ NMR_ModelReaderNode_BeamLattice1702_Beam.h covers the official 3MF beamlattice e
 namespace NMR {
 	eModelBeamLatticeCapMode stringToCapMode(const nfChar * capModeStr);
 
-	class CModelReaderNode_BeamLattice1702_Beam : public CModelReaderNode {
-	private:
+	// Attribute values of a single beam element
+	typedef struct {
 		nfInt32 m_nIndex1;
 		nfInt32 m_nIndex2;
 		nfBool m_bHasRadius1;
 		nfBool m_bHasRadius2;
 		nfDouble m_dRadius1;
 		nfDouble m_dRadius2;
-		nfBool m_bHasTag;
-		nfInt32 m_nTag;
 		nfBool m_bHasCap1;
 		nfBool m_bHasCap2;
 		eModelBeamLatticeCapMode m_eCapMode1;
 		eModelBeamLatticeCapMode m_eCapMode2;
+	} BEAMLATTICE1702_BEAMATTRIBUTES;
+
+	void resetBeamAttributes(_Out_ BEAMLATTICE1702_BEAMATTRIBUTES & attributes);
+	// Returns false, if the attribute is not known for beams
+	nfBool parseBeamAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _Inout_ BEAMLATTICE1702_BEAMATTRIBUTES & attributes);
+
+	class CModelReaderNode_BeamLattice1702_Beam : public CModelReaderNode {
+	private:
+		BEAMLATTICE1702_BEAMATTRIBUTES m_Attributes;
+		nfBool m_bHasTag;
+		nfInt32 m_nTag;
 	protected:
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_z_ const nfChar * pNameSpace);
@@ -68,6 +77,7 @@ namespace NMR {
 		void retrieveRadii(_Out_ nfBool & bHasRadius1, _Out_ nfDouble & dRadius1, _Out_ nfBool & bHasRadius2, _Out_ nfDouble & dRadius2);
 		void retrieveCapModes(_Out_ nfBool & bHasCapMode1, _Out_ eModelBeamLatticeCapMode & eCapMode1, _Out_ nfBool & bHasCapMode2, _Out_ eModelBeamLatticeCapMode & eCapMode2);
 		void retrieveTag(_Out_ nfBool & bHasTag, _Out_ nfInt32 & nTag);
+		const BEAMLATTICE1702_BEAMATTRIBUTES & getAttributes() const;
 	};
 
 	typedef std::shared_ptr <CModelReaderNode_BeamLattice1702_Beam> PModelReaderNode_BeamLattice1702_Beam;
@@ -38,6 +38,7 @@ NMR_ModelReaderNode_BeamLattice1702_Beams.h covers the official 3MF beamlattice
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
+#include "Model/Reader/BeamLattice1702/NMR_ModelReaderNode_BeamLattice1702_Beam.h"
 
 namespace NMR {
 
@@ -49,6 +50,13 @@ namespace NMR {
 		nfDouble m_dDefaultRadius;
 		eModelBeamLatticeCapMode m_eDefaultCapMode;
 
+		// Index of the first beam added by this node, used for the deferred length check
+		nfUint32 m_nFirstBeam;
+
+		// Reads an empty beam element directly into the mesh, without creating a child node
+		void readBeam(_In_ CXmlReader * pXMLReader);
+		void addBeam(_In_ const BEAMLATTICE1702_BEAMATTRIBUTES & attributes);
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
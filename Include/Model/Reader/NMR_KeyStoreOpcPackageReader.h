@@ -33,9 +33,11 @@ NMR_KeyStoreOpcPackageReader.h defines an OPC Package reader in a portable way.
 #ifndef NMR_KEYSTOREOPCPACKAGEREADER
 #define NMR_KEYSTOREOPCPACKAGEREADER
 
+#include <exception>
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Common/NMR_SecureContentTypes.h"
 #include "Common/OPC/NMR_IOpcPackageReader.h"
@@ -43,6 +45,12 @@ NMR_KeyStoreOpcPackageReader.h defines an OPC Package reader in a portable way.
 #include "Common/3MF_ProgressMonitor.h"
 #include "Common/NMR_ModelWarnings.h"
 
+// Compressed bytes per inflate call when decompressing prefetched parts
+#define KEYSTOREOPCPACKAGEREADER_INFLATECHUNKSIZE 65536
+// Maximum total size of the encrypted parts that are decrypted before parsing, and of the
+// inflated data that is held in memory for them
+#define KEYSTOREOPCPACKAGEREADER_PREFETCHLIMIT 67108864
+
 namespace NMR {
 
 	class CModelContext;
@@ -53,10 +61,13 @@ namespace NMR {
 		CModelContext const & m_pContext;
 		PIOpcPackageReader m_pPackageReader;
 		std::map<std::string, POpcPackagePart> m_encryptedParts;
+		// Errors of prefetched parts, rethrown when the part is accessed
+		std::map<std::string, std::exception_ptr> m_failedParts;
 	protected:
 		NMR::PImportStream findKeyStoreStream();
 		void parseKeyStore(NMR::PImportStream keyStoreStream);
 		void openAllResourceDataGroups();
+		void decryptAllResourceData();
 		void checkAuthenticatedTags();
 	public:
 		CKeyStoreOpcPackageReader(_In_ PImportStream pImportStream, _In_ CModelContext const & context);
@@ -65,6 +76,8 @@ namespace NMR {
 		virtual COpcPackageRelationship * findRootRelation(std::string sRelationType, nfBool bMustBeUnique) override;
 		virtual POpcPackagePart createPart(std::string sPath) override;
 		virtual nfUint64 getPartSize(std::string sPath) override;
+		virtual nfBool getRawPartInfo(std::string sPath, ZIPRAWENTRYINFO & RawEntryInfo) override;
+		virtual PImportStream openRawPart(std::string sPath) override;
 
 		void close() override;
 	};
@@ -48,6 +48,7 @@ namespace NMR {
 		PImportStream m_pPrintTicketStream;
 		std::string m_sPrintTicketContentType;
 		std::set<std::string> m_RelationsToRead;
+		std::string m_sSourceFileName;
 
 
 		void readFromMeshImporter(_In_ CMeshImporter * pImporter);
@@ -61,6 +62,9 @@ namespace NMR {
 
 		void addRelationToRead(_In_ std::string sRelationShipType);
 		void removeRelationToRead(_In_ std::string sRelationShipType);
+
+		// Name of the file the next stream is read from, if any. Attachments remember their location in this file.
+		void setSourceFileName(_In_ const std::string & sFileName);
 	};
 
 	typedef std::shared_ptr <CModelReader> PModelReader;
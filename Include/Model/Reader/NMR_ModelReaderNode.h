@@ -36,6 +36,7 @@ A model reader node is an abstract base class for all XML nodes of a 3MF Model S
 
 #include "Model/Classes/NMR_Model.h"
 #include "Common/NMR_ModelWarnings.h"
+#include "Common/NMR_Exception.h"
 #include "Common/Platform/NMR_XmlReader.h"
 #include "Common/3MF_ProgressMonitor.h"
 
@@ -56,6 +57,12 @@ namespace NMR {
 		void parseAttributes(_In_ CXmlReader * pXMLReader);
 		void parseContent(_In_ CXmlReader * pXMLReader);
 
+		// Parses a child element without creating a reader node for it. fnOnAttribute(pAttributeName, pAttributeValue)
+		// is called for all attributes without namespace, namespaced attributes and the element content are skipped.
+		template <typename F>
+		void parseLeafElement(_In_ CXmlReader * pXMLReader, _In_ F fnOnAttribute);
+		static void skipLeafContent(_In_ CXmlReader * pXMLReader, _In_ const std::string & sName, _In_ nfBool bIsEmptyElement);
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnText(_In_z_ const nfChar * pText, _In_ CXmlReader * pXMLReader);
 		virtual void OnEndElement(_In_ CXmlReader * pXMLReader);
@@ -73,6 +80,53 @@ namespace NMR {
 		virtual void parseXML(_In_ CXmlReader * pXMLReader) = 0;
 	};
 
+	template <typename F>
+	void CModelReaderNode::parseLeafElement(_In_ CXmlReader * pXMLReader, _In_ F fnOnAttribute)
+	{
+		__NMRASSERT(pXMLReader);
+
+		LPCSTR pszName = nullptr;
+		pXMLReader->GetLocalName(&pszName, nullptr);
+		if (!pszName)
+			throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+		std::string sName(pszName);
+		if (sName.empty())
+			throw CNMRException(NMR_ERROR_NODENAMEISEMPTY);
+
+		nfBool bIsEmptyElement = pXMLReader->IsEmptyElement() != 0;
+
+		nfBool bContinue = pXMLReader->MoveToFirstAttribute();
+		while (bContinue) {
+			if (!pXMLReader->IsDefault()) {
+				LPCSTR pszLocalName = nullptr;
+				LPCSTR pszNameSpaceURI = nullptr;
+				LPCSTR pszValue = nullptr;
+				UINT nNameCount = 0;
+				UINT nValueCount = 0;
+				UINT nNameSpaceCount = 0;
+
+				pXMLReader->GetNamespaceURI(&pszNameSpaceURI, &nNameSpaceCount);
+				if (!pszNameSpaceURI)
+					throw CNMRException(NMR_ERROR_COULDNOTGETNAMESPACE);
+
+				pXMLReader->GetLocalName(&pszLocalName, &nNameCount);
+				if (!pszLocalName)
+					throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+				pXMLReader->GetValue(&pszValue, &nValueCount);
+				if (!pszValue)
+					throw CNMRException(NMR_ERROR_COULDNOTGETXMLVALUE);
+
+				if ((nNameCount > 0) && (nNameSpaceCount == 0))
+					fnOnAttribute(pszLocalName, pszValue);
+			}
+
+			bContinue = pXMLReader->MoveToNextAttribute();
+		}
+
+		skipLeafContent(pXMLReader, sName, bIsEmptyElement);
+	}
+
 	typedef std::shared_ptr <CModelReaderNode> PModelReaderNode;
 
 }
@@ -36,6 +36,7 @@ NMR_ModelReader_3MF.h defines the Model Reader Class for
 
 #include "Model/Reader/NMR_ModelReader.h" 
 #include "Common/NMR_SecureContentTypes.h"
+#include "Model/Classes/NMR_ModelSourcePackage.h"
 #include <string>
 #include <map>
 
@@ -43,6 +44,9 @@ namespace NMR {
 
 	class CModelReader_3MF : public CModelReader {
 	protected:
+		// Package that is currently read, if it was read from a file
+		PModelSourcePackage m_pSourcePackage;
+
 		virtual PImportStream extract3MFOPCPackage(_In_ PImportStream pPackageStream) = 0;
 		virtual void release3MFOPCPackage() = 0;
 
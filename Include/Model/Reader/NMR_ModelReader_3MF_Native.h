@@ -54,6 +54,8 @@ namespace NMR {
 		void extractTexturesFromRelationships(_In_ std::string& sTargetPartURIDir, _In_ COpcPackagePart * pModelPart);
 		void extractModelDataFromRelationships(_In_ std::string& sTargetPartURIDir, _In_ COpcPackagePart * pModelPart);
 		void checkContentTypes();
+		// Remembers the ZIP entry of an attachment, and optionally keeps its compressed data for writing it back
+		void setAttachmentSource(_In_ PModelAttachment pAttachment, _In_ const std::string & sURI, _In_ nfBool bKeepCompressedData);
 	
 		virtual PImportStream extract3MFOPCPackage(_In_ PImportStream pPackageStream);
 		virtual void release3MFOPCPackage();
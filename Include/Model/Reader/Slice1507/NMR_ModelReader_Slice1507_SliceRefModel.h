@@ -41,18 +41,27 @@ NMR_ModelReaderNode_slice1507.h covers the private 3MF slice extension.
 
 namespace NMR {
 
+	// Parses a model part that holds nothing but slice stacks. Any other resource raises an exception,
+	// so that the part can be read by the regular model reader instead.
 	class CModelReader_Slice1507_SliceRefModel : public CModelReaderNode_ModelBase {
 	private:
 		std::string m_sSliceRefPath;
+		std::string m_sUnit;
+		nfBool m_bHasUnit;
 
 	protected:
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
+		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 
 	public:
 		CModelReader_Slice1507_SliceRefModel() = delete;
 		CModelReader_Slice1507_SliceRefModel(_In_ CModel *pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sSliceRefPath);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
+
+		// The unit attribute of the part, which the regular reader applies to the model
+		nfBool getHasUnit();
+		std::string getUnit();
 	};
 
 	typedef std::shared_ptr<CModelReader_Slice1507_SliceRefModel> PModelReader_Slice1507_SliceRefModel;
@@ -45,6 +45,7 @@ namespace NMR {
 		std::shared_ptr<std::vector<ModelResourceID>> m_pPIDs;
 		std::shared_ptr<std::vector<eModelBlendMethod>> m_pBlendMethods;
 		PModelMultiPropertyGroupResource m_pMultiPropertyGroup;
+		std::vector<ModelPropertyID> m_MultiPropertyIDs;
 
 	protected:
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
@@ -45,6 +45,7 @@ namespace NMR {
 	class CModelWriter : public CModelContext{
 	private:
 		nfUint32 m_nDecimalPrecision;
+		nfBool m_bIncrementalModeActive;
 	public:
 		CModelWriter() = delete;
 		CModelWriter(_In_ PModel pModel);
@@ -54,6 +55,10 @@ namespace NMR {
 
 		void SetDecimalPrecision(nfUint32);
 		nfUint32 GetDecimalPrecision();
+
+		// In incremental mode, unmodified parts of the package the model was read from are copied without recompression
+		void SetIncrementalModeActive(nfBool bIncrementalModeActive);
+		nfBool GetIncrementalModeActive();
 	};
 
 	typedef std::shared_ptr <CModelWriter> PModelWriter;
@@ -38,6 +38,9 @@ using LibZ and a native XML writer implementation.
 #include "Common/OPC/NMR_OpcPackageWriter.h" 
 #include "Model/Writer/NMR_ModelWriter_3MF.h" 
 #include "Model/Writer/NMR_KeyStoreOpcPackageWriter.h"
+#include "Model/Classes/NMR_ModelSourcePackage.h"
+#include "Common/OPC/NMR_OpcPackageReader.h"
+#include <map>
 
 #define MODELWRITER_NATIVE_BUFFERSIZE 65536
 
@@ -48,6 +51,9 @@ namespace NMR {
 		std::shared_ptr<IOpcPackageWriter> m_pPackageWriter;
 		CModel * m_pOtherModel;
 
+		// Packages the model was read from, opened on demand in incremental mode
+		std::map<PModelSourcePackage, POpcPackageReader> m_SourcePackageReaders;
+
 		// These are OPC dependent functions
 		virtual void createPackage(_In_ CModel * pModel);
 		virtual void writePackageToStream(_In_ PExportStream pStream);
@@ -57,6 +63,10 @@ namespace NMR {
 
 		void addNonRootModels();
 
+		POpcPackageReader openSourcePackage(_In_ PModelSourcePackage pSourcePackage);
+		// Copies the compressed source data of an attachment. Returns nullptr, if the part has to be written from the attachment stream.
+		POpcPackagePart addSourcePart(_In_ CModelAttachment * pAttachment, _In_ const std::string & sPath);
+
 	public:
 		CModelWriter_3MF_Native() = delete;
 		CModelWriter_3MF_Native(_In_ PModel pModel);
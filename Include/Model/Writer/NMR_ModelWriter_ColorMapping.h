@@ -37,8 +37,9 @@ A model writer exports the in memory represenation into the 3MF file.
 #include "Model/Classes/NMR_ModelTypes.h" 
 #include "Common/NMR_Types.h" 
 #include "Common/NMR_PagedVector.h" 
+#include "Common/NMR_IndexHashTable.h" 
 
-#include <map>
+#include <vector>
 #include <memory>
 
 namespace NMR {
@@ -47,7 +48,7 @@ namespace NMR {
 	private:
 	protected:
 		ModelResourceIndex m_nCurrentIndex;
-		std::map<nfColor, ModelResourceIndex> m_IndexMap;
+		CIndexHashTable m_IndexMap;
 		std::vector<nfColor> m_ColorVector;
 		ModelResourceID m_ResourceID;
 
@@ -35,11 +35,19 @@ A model writer exports the in memory represenation into a binary STL file.
 #define __NMR_MODELWRITER_STL
 
 #include "Model/Writer/NMR_ModelWriter.h" 
+#include "Model/Classes/NMR_ModelObject.h"
+#include "Common/Mesh/NMR_Mesh.h"
+
+#include <map>
 
 namespace NMR {
 
 	class CModelWriter_STL : public CModelWriter {
 	protected:
+		// Tessellated beam lattices, per mesh. Meshes referenced several times are tessellated once.
+		std::map<CMesh *, PMesh> m_TessellatedLattices;
+
+		void mergeObject(_In_ CMesh * pMesh, _In_ CModelObject * pObject, _In_ const NMATRIX3 mMatrix);
 	public:
 		CModelWriter_STL() = delete;
 		CModelWriter_STL(_In_ PModel pModel);
@@ -37,8 +37,8 @@ A model writer exports the in memory represenation into the 3MF file.
 #include "Model/Classes/NMR_ModelTypes.h"
 #include "Common/NMR_Types.h"
 #include "Common/NMR_Local.h"
+#include "Common/NMR_IndexHashTable.h"
 
-#include <map>
 #include <vector>
 #include <memory>
 
@@ -54,7 +54,7 @@ namespace NMR {
 	class CModelWriter_TexCoordMapping {
 	private:
 		ModelResourceIndex m_nCurrentIndex;
-		std::map<WRITERTEXCOORDMAPPINGTREEENTRY, ModelResourceIndex> m_IndexMap;
+		CIndexHashTable m_IndexMap;
 		std::vector<WRITERTEXCOORDMAPPINGTREEENTRY> m_TexCoordVector;
 		ModelResourceID m_ResourceID;
 		ModelResourceID m_TextureID;
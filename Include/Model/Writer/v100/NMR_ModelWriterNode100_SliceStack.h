@@ -0,0 +1,87 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelWriterNode100_SliceStack.h defines the Model Writer Slice Stack Node Class.
+This is the class for exporting the 3mf slice stack node. Vertices and segments
+are formatted into per-slice line buffers, which may be rendered in parallel,
+and are emitted as raw lines in slice order.
+
+--*/
+
+#ifndef __NMR_MODELWRITERNODE100_SLICESTACK
+#define __NMR_MODELWRITERNODE100_SLICESTACK
+
+#include "Model/Writer/NMR_ModelWriterNode_ModelBase.h"
+#include "Model/Classes/NMR_ModelSliceStack.h"
+
+#include "Common/Platform/NMR_XmlWriter.h"
+#include <vector>
+
+#define MODELWRITERSLICESTACK100_LINEBUFFERSIZE 256
+#define MODELWRITERSLICESTACK100_VERTEXLINESTART "<s:vertex x=\""
+#define MODELWRITERSLICESTACK100_VERTEXLINESTARTLENGTH 13
+#define MODELWRITERSLICESTACK100_SEGMENTLINESTART "<s:segment v2=\""
+#define MODELWRITERSLICESTACK100_SEGMENTLINESTARTLENGTH 15
+
+// Slices are rendered in batches of at most this many lines
+#define MODELWRITERSLICESTACK100_MAXBATCHLINES 1048576
+// Batches with fewer lines are rendered on the calling thread
+#define MODELWRITERSLICESTACK100_MINPARALLELLINES 65536
+#define MODELWRITERSLICESTACK100_MINSLICESPERTHREAD 4
+
+namespace NMR {
+
+	class CModelWriterNode100_SliceStack : public CModelWriterNode_ModelBase {
+	private:
+		// Raw vertex lines, followed by the segment lines of all written polygons
+		typedef struct {
+			std::vector<nfChar> m_Data;
+			std::vector<nfUint32> m_LineEnds;
+		} SLICELINEBUFFER;
+
+		CModelSliceStack * m_pSliceStack;
+
+		const int m_nPosAfterDecPoint;
+		const nfInt64 m_nPutDoubleFactor;
+
+		nfUint32 putUInt32(_In_ const nfUint32 nValue, _Out_ nfChar * pTarget);
+		void putLine(_In_ const nfChar * pLine, _In_ nfUint32 nLength, _Inout_ SLICELINEBUFFER & buffer);
+
+		void renderSlice(_In_ CSlice * pSlice, _Out_ SLICELINEBUFFER & buffer);
+		void writeSlice(_In_ CSlice * pSlice, _In_ const SLICELINEBUFFER & buffer);
+		void writeSlices();
+		void writeSliceRefs();
+	public:
+		CModelWriterNode100_SliceStack() = delete;
+		CModelWriterNode100_SliceStack(_In_ CModelSliceStack * pSliceStack, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ int nPosAfterDecPoint);
+		virtual void writeToXML();
+	};
+
+}
+
+#endif // __NMR_MODELWRITERNODE100_SLICESTACK
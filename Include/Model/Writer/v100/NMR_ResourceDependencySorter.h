@@ -33,8 +33,9 @@ sorting them topologically.
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
-#include "Common/Graph/DirectedGraph.h"
+#include "Common/Graph/SparseDirectedGraph.h"
 #include "Common/Graph/GraphAlgorithms.h"
 #include "Model/Classes/NMR_Model.h"
 
@@ -45,7 +46,7 @@ namespace NMR
     class CResourceDependencySorter
     {
        private:
-        common::graph::DirectedGraph buildGraph();
+        common::graph::SparseDirectedGraph buildGraph();
         void buildIndexMaps();
         
        [[nodiscard]] PPackageResourceID indexToModelResourceID(size_t index) const;
@@ -53,7 +54,7 @@ namespace NMR
 
         CModel * m_pModel;
 
-        std::unordered_map<size_t, PPackageResourceID> m_indexToResourceID;
+        std::vector<PPackageResourceID> m_indexToResourceID;
         std::unordered_map<PPackageResourceID, size_t> m_resourceIDToIndex;
 
        public:
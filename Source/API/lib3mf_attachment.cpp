@@ -57,6 +57,7 @@ std::string CAttachment::GetPath ()
 
 void CAttachment::SetPath (const std::string & sPath)
 {
+	m_pModelAttachment->getModel()->increaseRevision();
 	NMR::CModel * pModel = m_pModelAttachment->getModel();
 	NMR::PImportStream pStream = m_pModelAttachment->getStream();
 	if (pModel->getPackageThumbnail() == m_pModelAttachment) {
@@ -83,6 +84,7 @@ std::string CAttachment::GetRelationShipType ()
 
 void CAttachment::SetRelationShipType (const std::string & sPath)
 {
+	m_pModelAttachment->getModel()->increaseRevision();
 	m_pModelAttachment->setRelationShipType(sPath);
 }
 
@@ -99,6 +101,7 @@ void CAttachment::WriteToFile (const std::string & sFileName)
 
 void CAttachment::ReadFromFile (const std::string & sFileName)
 {
+	m_pModelAttachment->getModel()->increaseRevision();
 	NMR::PImportStream pImportStream = NMR::fnCreateImportStreamInstance(sFileName.c_str());
 
 	m_pModelAttachment->setStream(pImportStream);
@@ -106,6 +109,7 @@ void CAttachment::ReadFromFile (const std::string & sFileName)
 
 void CAttachment::ReadFromCallback(const Lib3MF::ReadCallback pTheReadCallback, const Lib3MF_uint64 nStreamSize, const Lib3MF::SeekCallback pTheSeekCallback, const Lib3MF_pvoid pUserData)
 {
+	m_pModelAttachment->getModel()->increaseRevision();
 	NMR::ImportStream_ReadCallbackType lambdaReadCallback =
 		[pTheReadCallback](NMR::nfByte* pData, NMR::nfUint64 cbBytes, void* pUserData)
 	{
@@ -157,6 +161,7 @@ void CAttachment::WriteToBuffer (Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64*
 
 void CAttachment::ReadFromBuffer(const Lib3MF_uint64 nBufferBufferSize, const Lib3MF_uint8 * pBufferBuffer)
 {
+	m_pModelAttachment->getModel()->increaseRevision();
 	NMR::PImportStream pImportStream = std::make_shared<NMR::CImportStream_Unique_Memory>(pBufferBuffer, nBufferBufferSize);
 	m_pModelAttachment->setStream(pImportStream);
 }
@@ -60,6 +60,7 @@ Lib3MF_uint32 CBaseMaterialGroup::GetCount ()
 
 Lib3MF_uint32 CBaseMaterialGroup::AddMaterial(const std::string & sName, const sLib3MFColor DisplayColor)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::nfColor cColor = DisplayColor.m_Red | (DisplayColor.m_Green << 8) | (DisplayColor.m_Blue << 16) | (DisplayColor.m_Alpha << 24);
 
 	return baseMaterialGroup().addBaseMaterial(sName, cColor);
@@ -67,6 +68,7 @@ Lib3MF_uint32 CBaseMaterialGroup::AddMaterial(const std::string & sName, const s
 
 void CBaseMaterialGroup::RemoveMaterial (const Lib3MF_uint32 nPropertyID)
 {
+	resource()->getModel()->increaseRevision();
 	baseMaterialGroup().removeMaterial(nPropertyID);
 }
 
@@ -77,11 +79,13 @@ std::string CBaseMaterialGroup::GetName (const Lib3MF_uint32 nPropertyID)
 
 void CBaseMaterialGroup::SetName (const Lib3MF_uint32 nPropertyID, const std::string & sName)
 {
+	resource()->getModel()->increaseRevision();
 	baseMaterialGroup().getBaseMaterial(nPropertyID)->setName(sName);
 }
 
 void CBaseMaterialGroup::SetDisplayColor(const Lib3MF_uint32 nPropertyID, const sLib3MFColor TheColor)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::nfColor cColor = TheColor.m_Red | (TheColor.m_Green << 8) | (TheColor.m_Blue << 16) | (TheColor.m_Alpha << 24);
 	baseMaterialGroup().getBaseMaterial(nPropertyID)->setColor(cColor);
 }
@@ -54,6 +54,7 @@ Lib3MF_double CBeamLattice::GetMinLength ()
 
 void CBeamLattice::SetMinLength (const Lib3MF_double dMinLength)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	return m_mesh.setBeamLatticeMinLength(dMinLength);
 }
 
@@ -71,6 +72,7 @@ void CBeamLattice::GetClipping(eLib3MFBeamLatticeClipMode & eClipMode, Lib3MF_ui
 
 void CBeamLattice::SetClipping(const eLib3MFBeamLatticeClipMode eClipMode, const Lib3MF_uint32 nUniqueResourceID)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if ( ((int)eClipMode == (NMR::eModelBeamLatticeClipMode::MODELBEAMLATTICECLIPMODE_NONE)) || (nUniqueResourceID == 0) ){
 		m_pAttributes->m_eClipMode = NMR::eModelBeamLatticeClipMode(eClipMode);
 		m_pAttributes->m_bHasClippingMeshID = false;
@@ -109,6 +111,7 @@ bool CBeamLattice::GetRepresentation (Lib3MF_uint32 & nUniqueResourceID)
 
 void CBeamLattice::SetRepresentation (const Lib3MF_uint32 nUniqueResourceID)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (nUniqueResourceID == 0) {
 		m_pAttributes->m_bHasRepresentationMeshID = false;
 		m_pAttributes->m_pRepresentationUniqueID = nullptr;
@@ -139,6 +142,7 @@ void CBeamLattice::GetBallOptions (eLib3MFBeamLatticeBallMode & eBallMode, Lib3M
 
 void CBeamLattice::SetBallOptions (const eLib3MFBeamLatticeBallMode eBallMode, const Lib3MF_double dBallRadius)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (eBallMode == eLib3MFBeamLatticeBallMode::BeamLatticeBallModeNone || dBallRadius > 0.0) {
 		m_mesh.setBeamLatticeBallMode((NMR::eModelBeamLatticeBallMode)eBallMode);
 		m_mesh.setDefaultBallRadius(dBallRadius);
@@ -157,8 +161,8 @@ sLib3MFBeam CBeamLattice::GetBeam (const Lib3MF_uint32 nIndex)
 {
 	sLib3MFBeam beam;
 	NMR::MESHBEAM* meshBeam = m_mesh.getBeam(nIndex);
-	beam.m_CapModes[0] = (eLib3MFBeamLatticeCapMode)(meshBeam->m_capMode[0]);
-	beam.m_CapModes[1] = (eLib3MFBeamLatticeCapMode)meshBeam->m_capMode[1];
+	beam.m_CapModes[0] = (eLib3MFBeamLatticeCapMode)(meshBeam->getCapMode(0));
+	beam.m_CapModes[1] = (eLib3MFBeamLatticeCapMode)meshBeam->getCapMode(1);
 
 	beam.m_Indices[0] = meshBeam->m_nodeindices[0];
 	beam.m_Indices[1] = meshBeam->m_nodeindices[1];
@@ -183,6 +187,7 @@ bool isBeamValid(const Lib3MF_uint32 nNodeCount, const sLib3MFBeam& BeamInfo)
 
 Lib3MF_uint32 CBeamLattice::AddBeam (const sLib3MFBeam BeamInfo)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (!m_pMeshObject->isValidForBeamLattices())
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE);
 
@@ -190,23 +195,18 @@ Lib3MF_uint32 CBeamLattice::AddBeam (const sLib3MFBeam BeamInfo)
 	if (!isBeamValid(m_mesh.getNodeCount(), BeamInfo))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
-	// retrieve nodes and add beam
-	NMR::MESHNODE * pNodes[2];
-	for (int j = 0; j < 2; j++)
-		pNodes[j] = m_mesh.getNode(BeamInfo.m_Indices[j]);
-
-	NMR::MESHBEAM * pMeshBeam = m_mesh.addBeam(pNodes[0], pNodes[1], BeamInfo.m_Radii[0], BeamInfo.m_Radii[1], (int)BeamInfo.m_CapModes[0], (int)BeamInfo.m_CapModes[1]);
-	return pMeshBeam->m_index;
+	return m_mesh.addBeam(BeamInfo.m_Indices[0], BeamInfo.m_Indices[1], BeamInfo.m_Radii[0], BeamInfo.m_Radii[1], (int)BeamInfo.m_CapModes[0], (int)BeamInfo.m_CapModes[1]);
 }
 
 void CBeamLattice::SetBeam (const Lib3MF_uint32 nIndex, const sLib3MFBeam BeamInfo)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (!isBeamValid(m_mesh.getNodeCount(), BeamInfo))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
 	NMR::MESHBEAM* meshBeam = m_mesh.getBeam(nIndex);
-	meshBeam->m_capMode[0] = (int)BeamInfo.m_CapModes[0];
-	meshBeam->m_capMode[1] = (int)BeamInfo.m_CapModes[1];
+	meshBeam->setCapMode(0, (int)BeamInfo.m_CapModes[0]);
+	meshBeam->setCapMode(1, (int)BeamInfo.m_CapModes[1]);
 
 	meshBeam->m_nodeindices[0] = BeamInfo.m_Indices[0];
 	meshBeam->m_nodeindices[1] = BeamInfo.m_Indices[1];
@@ -221,6 +221,7 @@ void CBeamLattice::SetBeam (const Lib3MF_uint32 nIndex, const sLib3MFBeam BeamIn
 
 void CBeamLattice::SetBeams(const Lib3MF_uint64 nBeamInfoBufferSize, const sLib3MFBeam * pBeamInfoBuffer)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if ((nBeamInfoBufferSize>0) && (!m_pMeshObject->isValidForBeamLattices()))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE);
 
@@ -232,11 +233,7 @@ void CBeamLattice::SetBeams(const Lib3MF_uint64 nBeamInfoBufferSize, const sLib3
 		if (!isBeamValid(m_mesh.getNodeCount(), *pBeamInfoCurrent))
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
-		NMR::MESHNODE * pNodes[2];
-		for (int j = 0; j < 2; j++)
-			pNodes[j] = m_mesh.getNode(pBeamInfoCurrent->m_Indices[j]);
-		
-		m_mesh.addBeam(pNodes[0], pNodes[1], pBeamInfoCurrent->m_Radii[0], pBeamInfoCurrent->m_Radii[1], (int)pBeamInfoCurrent->m_CapModes[0], (int)pBeamInfoCurrent->m_CapModes[1]);
+		m_mesh.addBeam(pBeamInfoCurrent->m_Indices[0], pBeamInfoCurrent->m_Indices[1], pBeamInfoCurrent->m_Radii[0], pBeamInfoCurrent->m_Radii[1], (int)pBeamInfoCurrent->m_CapModes[0], (int)pBeamInfoCurrent->m_CapModes[1]);
 		pBeamInfoCurrent++;
 	}
 
@@ -256,8 +253,8 @@ void CBeamLattice::GetBeams(Lib3MF_uint64 nBeamInfoBufferSize, Lib3MF_uint64* pB
 		for (Lib3MF_uint32 i = 0; i < beamCount; i++)
 		{
 			const NMR::MESHBEAM* meshBeam = m_mesh.getBeam(i);
-			beam->m_CapModes[0] = (eLib3MFBeamLatticeCapMode)meshBeam->m_capMode[0];
-			beam->m_CapModes[1] = (eLib3MFBeamLatticeCapMode)meshBeam->m_capMode[1];
+			beam->m_CapModes[0] = (eLib3MFBeamLatticeCapMode)meshBeam->getCapMode(0);
+			beam->m_CapModes[1] = (eLib3MFBeamLatticeCapMode)meshBeam->getCapMode(1);
 
 			beam->m_Indices[0] = meshBeam->m_nodeindices[0];
 			beam->m_Indices[1] = meshBeam->m_nodeindices[1];
@@ -307,7 +304,7 @@ sLib3MFBall CBeamLattice::GetBall (const Lib3MF_uint32 nIndex)
 		return ball;
 	}
 	else if (ballMode == eBeamLatticeBallMode::All) {
-		Lib3MF_int32 ballNodeIndex = m_mesh.getOccupiedNode(nIndex)->m_index;
+		Lib3MF_int32 ballNodeIndex = m_mesh.getOccupiedNodeIndex(nIndex);
 
 		Lib3MF_uint32 meshBallCount = m_mesh.getBallCount();
 		for (Lib3MF_uint32 iBall = 0; iBall < meshBallCount; iBall++) {
@@ -344,6 +341,7 @@ bool isBallValid(const Lib3MF_uint32 nNodeCount, const sLib3MFBall& BallInfo)
 
 Lib3MF_uint32 CBeamLattice::AddBall (const sLib3MFBall BallInfo)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (!m_pMeshObject->isValidForBeamLattices())
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE);
 
@@ -351,15 +349,12 @@ Lib3MF_uint32 CBeamLattice::AddBall (const sLib3MFBall BallInfo)
 	if (!isBallValid(m_mesh.getNodeCount(), BallInfo))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
-	// retrieve node and add ball
-	NMR::MESHNODE * pNode = m_mesh.getNode(BallInfo.m_Index);
-
-	NMR::MESHBALL * pMeshBall = m_mesh.addBall(pNode, BallInfo.m_Radius);
-	return pMeshBall->m_index;
+	return m_mesh.addBall(BallInfo.m_Index, BallInfo.m_Radius);
 }
 
 void CBeamLattice::SetBall (const Lib3MF_uint32 nIndex, const sLib3MFBall BallInfo)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (!isBallValid(m_mesh.getNodeCount(), BallInfo))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
@@ -377,7 +372,7 @@ void CBeamLattice::SetBall (const Lib3MF_uint32 nIndex, const sLib3MFBall BallIn
 		meshBall->m_radius = BallInfo.m_Radius;
 	}
 	else if (ballMode == eBeamLatticeBallMode::All) {
-		Lib3MF_int32 ballNodeIndex = m_mesh.getOccupiedNode(nIndex)->m_index;
+		Lib3MF_int32 ballNodeIndex = m_mesh.getOccupiedNodeIndex(nIndex);
 		Lib3MF_uint32 meshBallCount = m_mesh.getBallCount();
 		for (Lib3MF_uint32 iBall = 0; iBall < meshBallCount; iBall++) {
 			NMR::MESHBALL * meshBall = m_mesh.getBall(iBall);
@@ -390,9 +385,7 @@ void CBeamLattice::SetBall (const Lib3MF_uint32 nIndex, const sLib3MFBall BallIn
 		}
 
 		// Not in mesh, add the ball
-		NMR::MESHNODE * pNode = m_mesh.getNode(BallInfo.m_Index);
-
-		m_mesh.addBall(pNode, BallInfo.m_Radius);
+		m_mesh.addBall(BallInfo.m_Index, BallInfo.m_Radius);
 	}
 	else {
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -401,6 +394,7 @@ void CBeamLattice::SetBall (const Lib3MF_uint32 nIndex, const sLib3MFBall BallIn
 
 void CBeamLattice::SetBalls (const Lib3MF_uint64 nBallInfoBufferSize, const sLib3MFBall * pBallInfoBuffer)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if ((nBallInfoBufferSize > 0) && (!m_pMeshObject->isValidForBeamLattices()))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE);
 
@@ -412,9 +406,7 @@ void CBeamLattice::SetBalls (const Lib3MF_uint64 nBallInfoBufferSize, const sLib
 		if (!isBallValid(m_mesh.getNodeCount(), *pBallInfoCurrent))
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
-		NMR::MESHNODE * pNode = m_mesh.getNode(pBallInfoCurrent->m_Index);
-
-		m_mesh.addBall(pNode, pBallInfoCurrent->m_Radius);
+		m_mesh.addBall(pBallInfoCurrent->m_Index, pBallInfoCurrent->m_Radius);
 		pBallInfoCurrent++;
 	}
 }
@@ -453,9 +445,12 @@ void CBeamLattice::GetBalls(Lib3MF_uint64 nBallInfoBufferSize, Lib3MF_uint64 * p
 			}
 
 			// Fill balls from default or mesh balls
+			std::vector<NMR::nfUint32> occupiedNodeIndices;
+			m_mesh.getOccupiedNodeIndices(occupiedNodeIndices);
+
 			sLib3MFBall * ball = pBallInfoBuffer;
 			for (Lib3MF_uint32 i = 0; i < ballCount; i++) {
-				Lib3MF_uint32 currNodeIndex = m_mesh.getOccupiedNode(i)->m_index;
+				Lib3MF_uint32 currNodeIndex = occupiedNodeIndices[i];
 
 				ball->m_Index = currNodeIndex;
 				ball->m_Radius = meshBallMap[currNodeIndex] > 0.0 ? meshBallMap[currNodeIndex] : defaultBallRadius;
@@ -476,6 +471,7 @@ Lib3MF_uint32 CBeamLattice::GetBeamSetCount ()
 
 IBeamSet * CBeamLattice::AddBeamSet ()
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	return new CBeamSet(m_mesh.addBeamSet(), m_pMeshObject);
 }
 
@@ -41,13 +41,14 @@ using namespace Lib3MF::Impl;
 **************************************************************************************************************************/
 
 CBeamSet::CBeamSet(NMR::PBEAMSET pBeamSet, NMR::PModelMeshObject pMeshObject):
-	m_pBeamSet(pBeamSet), m_mesh(*pMeshObject->getMesh())
+	m_pBeamSet(pBeamSet), m_mesh(*pMeshObject->getMesh()), m_pModel(pMeshObject->getModel())
 {
 
 }
 
 void CBeamSet::SetName(const std::string & sName)
 {
+	m_pModel->increaseRevision();
 	m_pBeamSet->m_sName = sName;
 }
 
@@ -58,6 +59,7 @@ std::string CBeamSet::GetName()
 
 void CBeamSet::SetIdentifier(const std::string & sIdentifier)
 {
+	m_pModel->increaseRevision();
 	// Ensure identifier is unique
 	if (sIdentifier.compare("") != 0) {
 		Lib3MF_uint32 nBeamSets = m_mesh.getBeamSetCount();
@@ -81,6 +83,7 @@ Lib3MF_uint32 CBeamSet::GetReferenceCount()
 
 void CBeamSet::SetReferences(const Lib3MF_uint64 nReferencesBufferSize, const Lib3MF_uint32 * pReferencesBuffer)
 {
+	m_pModel->increaseRevision();
 	if (nReferencesBufferSize > LIB3MF_MAXBEAMCOUNT)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_ELEMENTCOUNTEXCEEDSLIMIT);
 
@@ -118,6 +121,7 @@ Lib3MF_uint32 CBeamSet::GetBallReferenceCount()
 
 void CBeamSet::SetBallReferences(const Lib3MF_uint64 nBallReferencesBufferSize, const Lib3MF_uint32* pBallReferencesBuffer)
 {
+	m_pModel->increaseRevision();
 	if (nBallReferencesBufferSize > LIB3MF_MAXBEAMCOUNT)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_ELEMENTCOUNTEXCEEDSLIMIT);
 
@@ -34,6 +34,8 @@ Abstract: This is a stub class definition of CBuildItem
 #include "lib3mf_utils.hpp"
 #include "lib3mf_object.hpp"
 #include "lib3mf_metadatagroup.hpp"
+
+#include "Model/Classes/NMR_ModelInstanceCache.h"
 // Include custom headers here.
 
 using namespace Lib3MF::Impl;
@@ -80,6 +82,7 @@ std::string CBuildItem::GetUUID (bool & bHasUUID)
 
 void CBuildItem::SetUUID (const std::string & sUUID)
 {
+	m_pBuildItem->getModel()->increaseBuildRevision();
 	NMR::PUUID pUUID = std::make_shared<NMR::CUUID>(sUUID);
 	buildItem().setUUID(pUUID);
 }
@@ -102,6 +105,7 @@ sLib3MFTransform CBuildItem::GetObjectTransform ()
 
 void CBuildItem::SetObjectTransform (const sLib3MFTransform Transform)
 {
+	m_pBuildItem->getModel()->increaseBuildRevision();
 	buildItem().setTransform(TransformToMatrix(Transform));
 }
 
@@ -112,12 +116,13 @@ std::string CBuildItem::GetPartNumber ()
 
 void CBuildItem::SetPartNumber (const std::string & sSetPartnumber)
 {
+	m_pBuildItem->getModel()->increaseBuildRevision();
 	buildItem().setPartNumber(sSetPartnumber);
 }
 
 IMetaDataGroup * CBuildItem::GetMetaDataGroup ()
 {
-	return new CMetaDataGroup(buildItem().metaDataGroup());
+	return new CMetaDataGroup(buildItem().metaDataGroup(), buildItem().getModel());
 }
 
 Lib3MF::sBox CBuildItem::GetOutbox()
@@ -125,7 +130,13 @@ Lib3MF::sBox CBuildItem::GetOutbox()
 	NMR::NOUTBOX3 sOutbox;
 	NMR::fnOutboxInitialize(sOutbox);
 
-	buildItem().getObject()->extendOutbox(sOutbox, buildItem().getTransform());
+	NMR::CModelInstanceCache * pInstanceCache = buildItem().getModel()->getInstanceCache();
+	NMR::nfUint32 nFirst, nCount;
+	pInstanceCache->getBuildItemInstances(&buildItem(), nFirst, nCount);
+
+	const std::vector<NMR::MODELINSTANCE> & Instances = pInstanceCache->getInstances();
+	for (NMR::nfUint32 nIndex = nFirst; nIndex < nFirst + nCount; nIndex++)
+		Instances[nIndex].m_pObject->extendOutbox(sOutbox, Instances[nIndex].m_mTransform);
 
 	sBox s;
 	s.m_MinCoordinate[0] = sOutbox.m_min.m_fields[0];
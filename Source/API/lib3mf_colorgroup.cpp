@@ -87,6 +87,7 @@ void CColorGroup::GetAllPropertyIDs (Lib3MF_uint64 nPropertyIDsBufferSize, Lib3M
 
 Lib3MF_uint32 CColorGroup::AddColor (const sLib3MFColor TheColor)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::nfColor cColor = TheColor.m_Red | (TheColor.m_Green << 8) | (TheColor.m_Blue << 16) | (TheColor.m_Alpha << 24);
 
 	return colorGroup().addColor(cColor);
@@ -94,6 +95,7 @@ Lib3MF_uint32 CColorGroup::AddColor (const sLib3MFColor TheColor)
 
 void CColorGroup::SetColor (const Lib3MF_uint32 nPropertyID, const sLib3MFColor TheColor)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::nfColor cColor = TheColor.m_Red | (TheColor.m_Green << 8) | (TheColor.m_Blue << 16) | (TheColor.m_Alpha << 24);
 	colorGroup().setColor(nPropertyID, cColor);
 }
@@ -111,5 +113,46 @@ sLib3MFColor CColorGroup::GetColor (const Lib3MF_uint32 nPropertyID)
 
 void CColorGroup::RemoveColor(const Lib3MF_uint32 nPropertyID)
 {
+	resource()->getModel()->increaseRevision();
 	colorGroup().removeColor(nPropertyID);
 }
+
+void CColorGroup::GetAllColors(Lib3MF_uint64 nColorsBufferSize, Lib3MF_uint64* pColorsNeededCount, sLib3MFColor * pColorsBuffer)
+{
+	Lib3MF_uint32 nCount = colorGroup().getCount();
+
+	if (pColorsNeededCount)
+		*pColorsNeededCount = nCount;
+
+	if (nColorsBufferSize >= nCount && pColorsBuffer) {
+		std::vector<NMR::nfColor> Colors(nCount);
+		colorGroup().getAllColors(Colors.data());
+
+		for (NMR::nfColor cColor : Colors) {
+			pColorsBuffer->m_Red = (cColor) & 0xff;
+			pColorsBuffer->m_Green = (cColor >> 8) & 0xff;
+			pColorsBuffer->m_Blue = (cColor >> 16) & 0xff;
+			pColorsBuffer->m_Alpha = (cColor >> 24) & 0xff;
+			pColorsBuffer++;
+		}
+	}
+}
+
+void CColorGroup::SetAllColors(const Lib3MF_uint64 nColorsBufferSize, const sLib3MFColor * pColorsBuffer)
+{
+	resource()->getModel()->increaseRevision();
+	Lib3MF_uint32 nCount = colorGroup().getCount();
+
+	if (nColorsBufferSize != nCount)
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPROPERTYCOUNT);
+	if ((pColorsBuffer == nullptr) && (nCount > 0))
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+
+	std::vector<NMR::nfColor> Colors(nCount);
+	for (Lib3MF_uint32 nIndex = 0; nIndex < nCount; nIndex++) {
+		const sLib3MFColor & TheColor = pColorsBuffer[nIndex];
+		Colors[nIndex] = TheColor.m_Red | (TheColor.m_Green << 8) | (TheColor.m_Blue << 16) | (TheColor.m_Alpha << 24);
+	}
+
+	colorGroup().setAllColors(Colors.data(), nCount);
+}
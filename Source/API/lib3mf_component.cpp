@@ -79,6 +79,7 @@ std::string CComponent::GetUUID(bool & bHasUUID)
 
 void CComponent::SetUUID(const std::string & sUUID)
 {
+	m_pComponent->getModel()->increaseRevision();
 	NMR::PUUID pUUID = std::make_shared<NMR::CUUID>(sUUID);
 	m_pComponent->setUUID(pUUID);
 }
@@ -90,6 +91,7 @@ bool CComponent::HasTransform()
 
 void CComponent::SetTransform (const sLib3MFTransform Transform)
 {
+	m_pComponent->getModel()->increaseRevision();
 	m_pComponent->setTransform(TransformToMatrix(Transform));
 }
 
@@ -80,6 +80,7 @@ IComponent * CComponentsObject::AddComponent(IObject* pObjectResource, const sLi
 	NMR::CModel * pModel = pComponentsObject->getModel();
 	if (pModel == nullptr)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDMODEL);
+	pModel->increaseRevision();
 	
 	// Get Resource ID
 	NMR::UniqueResourceID nObjectID = pObjectResource->GetResourceID();
@@ -92,6 +92,7 @@ IBaseMaterialGroup * CCompositeMaterials::GetBaseMaterialGroup ()
 
 Lib3MF_uint32 CCompositeMaterials::AddComposite(const Lib3MF_uint64 nCompositeBufferSize, const sLib3MFCompositeConstituent * pCompositeBuffer)
 {
+	resource()->getModel()->increaseRevision();
 	if (nCompositeBufferSize > LIB3MF_MAXCOMPOSITEMATERIALS)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_ELEMENTCOUNTEXCEEDSLIMIT);
 
@@ -106,6 +107,7 @@ Lib3MF_uint32 CCompositeMaterials::AddComposite(const Lib3MF_uint64 nCompositeBu
 
 void CCompositeMaterials::RemoveComposite (const Lib3MF_uint32 nPropertyID)
 {
+	resource()->getModel()->increaseRevision();
 	compositeMaterials().removeComposite(nPropertyID);
 }
 
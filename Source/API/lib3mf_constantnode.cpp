@@ -49,6 +49,7 @@ Lib3MF::Impl::CConstantNode::CConstantNode(
 
 void CConstantNode::SetConstant(const Lib3MF_double dValue)
 {
+	increaseRevision();
 	m_pImplicitNode->setConstant(dValue);
 }
 
@@ -49,6 +49,7 @@ CConstMatNode::CConstMatNode(
 
 void CConstMatNode::SetMatrix(const Lib3MF::sMatrix4x4 Value)
 {
+	increaseRevision();
 	m_pImplicitNode->setMatrix(Value);
 }
 
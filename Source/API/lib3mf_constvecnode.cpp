@@ -49,6 +49,7 @@ Lib3MF::Impl::CConstVecNode::CConstVecNode(
 
 void CConstVecNode::SetVector(const Lib3MF::sVector Value)
 {
+	increaseRevision();
 	m_pImplicitNode->setVector(Value);
 }
 
@@ -63,6 +63,7 @@ std::string CFunction::GetDisplayName()
 
 void CFunction::SetDisplayName(const std::string& sDisplayName)
 {
+	resource()->getModel()->increaseRevision();
 	function()->setDisplayName(sDisplayName);
 }
 
@@ -70,17 +71,19 @@ IImplicitPort* CFunction::AddInput(const std::string& sIdentifier,
 	const std::string& sDisplayName,
 	const Lib3MF::eImplicitPortType eType)
 {
+	resource()->getModel()->increaseRevision();
 
-	return new CImplicitPort(function()->addInput(sIdentifier, sDisplayName, eType));
+	return new CImplicitPort(function()->addInput(sIdentifier, sDisplayName, eType), resource()->getModel());
 }
 
 IImplicitPortIterator* CFunction::GetInputs()
 {
-	return new CImplicitPortIterator(function()->getInputs());
+	return new CImplicitPortIterator(function()->getInputs(), resource()->getModel());
 }
 
 void CFunction::RemoveInput(IImplicitPort* pInput)
 {
+	resource()->getModel()->increaseRevision();
 	auto inputs = function()->getInputs();
 	auto it = std::find_if(inputs->begin(), inputs->end(), [pInput](const NMR::PModelImplicitPort& port) {
 		return port->getIdentifier() == pInput->GetIdentifier();
@@ -95,16 +98,18 @@ IImplicitPort* CFunction::AddOutput(const std::string& sIdentifier,
 	const std::string& sDisplayName,
 	const Lib3MF::eImplicitPortType eType)
 {
-	return new CImplicitPort(function()->addOutput(sIdentifier, sDisplayName, eType));
+	resource()->getModel()->increaseRevision();
+	return new CImplicitPort(function()->addOutput(sIdentifier, sDisplayName, eType), resource()->getModel());
 }
 
 IImplicitPortIterator* CFunction::GetOutputs()
 {
-	return new CImplicitPortIterator(function()->getOutputs());
+	return new CImplicitPortIterator(function()->getOutputs(), resource()->getModel());
 }
 
 void CFunction::RemoveOutput(IImplicitPort* pOutput)
 {
+	resource()->getModel()->increaseRevision();
 	auto outputs = function()->getOutputs();
 	auto it = std::find_if(outputs->begin(), outputs->end(), [pOutput](const NMR::PModelImplicitPort& port) {
 		return port->getIdentifier() == pOutput->GetIdentifier();
@@ -117,10 +122,10 @@ void CFunction::RemoveOutput(IImplicitPort* pOutput)
 
 IImplicitPort* CFunction::FindInput(const std::string& sIdentifier)
 {
-	return new CImplicitPort(function()->findInput(sIdentifier));
+	return new CImplicitPort(function()->findInput(sIdentifier), resource()->getModel());
 }
 
 IImplicitPort* CFunction::FindOutput(const std::string& sIdentifier)
 {
-	return new CImplicitPort(function()->findOutput(sIdentifier));
+	return new CImplicitPort(function()->findOutput(sIdentifier), resource()->getModel());
 }
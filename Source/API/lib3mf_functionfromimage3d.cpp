@@ -72,6 +72,7 @@ Lib3MF::Impl::CFunctionFromImage3D::CFunctionFromImage3D(NMR::PModelResource pRe
 
 void CFunctionFromImage3D::SetImage3D(IImage3D * pImage3D)
 {
+    resource()->getModel()->increaseRevision();
     if (pImage3D == nullptr)
     {
         throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -81,6 +82,7 @@ void CFunctionFromImage3D::SetImage3D(IImage3D * pImage3D)
 
 void CFunctionFromImage3D::SetFilter(const Lib3MF::eTextureFilter eFilter)
 {
+	resource()->getModel()->increaseRevision();
 	functionfromimage3d()->setFilter((NMR::eModelTextureFilter) eFilter);
 }
 
@@ -93,6 +95,7 @@ void CFunctionFromImage3D::SetTileStyles(const Lib3MF::eTextureTileStyle eTileSt
                                          const Lib3MF::eTextureTileStyle eTileStyleV,
                                          const Lib3MF::eTextureTileStyle eTileStyleW)
 {
+    resource()->getModel()->increaseRevision();
     functionfromimage3d()->setTileStyleU((NMR::eModelTextureTileStyle) eTileStyleU);
 	functionfromimage3d()->setTileStyleV((NMR::eModelTextureTileStyle) eTileStyleV);
 	functionfromimage3d()->setTileStyleW((NMR::eModelTextureTileStyle) eTileStyleW);
@@ -114,6 +117,7 @@ Lib3MF_double CFunctionFromImage3D::GetOffset()
 
 void CFunctionFromImage3D::SetOffset(const Lib3MF_double dOffset)
 {
+    resource()->getModel()->increaseRevision();
     functionfromimage3d()->setOffset(dOffset);
 }
 
@@ -124,5 +128,6 @@ Lib3MF_double CFunctionFromImage3D::GetScale()
 
 void CFunctionFromImage3D::SetScale(const Lib3MF_double dScale)
 {
+    resource()->getModel()->increaseRevision();
     functionfromimage3d()->setScale(dScale);
 }
@@ -49,18 +49,20 @@ Lib3MF_uint32 CFunctionReference::GetFunctionResourceID()
 void CFunctionReference::SetFunctionResourceID(
     const Lib3MF_uint32 nUniqueResourceID)
 {
+    m_pModel->increaseRevision();
     m_pFunctionReference->setFunctionResourceID(nUniqueResourceID);
 }
 
 CFunctionReference::CFunctionReference(
-    NMR::PFunctionReference pFunctionReference)
-    : m_pFunctionReference(pFunctionReference)
+    NMR::PFunctionReference pFunctionReference, NMR::CModel * pModel)
+    : m_pFunctionReference(pFunctionReference), m_pModel(pModel)
 {
 }
 
 void CFunctionReference::SetTransform(
     const Lib3MF::sTransform Transform)
 {
+     m_pModel->increaseRevision();
      m_pFunctionReference->setTransform(TransformToMatrix(Transform));
 }
 
@@ -80,12 +82,14 @@ std::string CFunctionReference::GetChannelName()
 void CFunctionReference::SetChannelName(
     const std::string & sChannelName)
 {
+    m_pModel->increaseRevision();
     m_pFunctionReference->setChannelName(sChannelName);
 }
 
 void CFunctionReference::SetMinFeatureSize(
     const Lib3MF_double dMinFeatureSize)
 {
+    m_pModel->increaseRevision();
     m_pFunctionReference->setMinFeatureSize(dMinFeatureSize);
 }
 
@@ -97,6 +101,7 @@ Lib3MF_double CFunctionReference::GetMinFeatureSize()
 void CFunctionReference::SetFallBackValue(
     const Lib3MF_double dFallBackValue)
 {
+    m_pModel->increaseRevision();
     m_pFunctionReference->setFallBackValue(dFallBackValue);
 }
 
@@ -60,6 +60,7 @@ std::string CImage3D::GetName()
 
 void CImage3D::SetName(const std::string & sName)
 {
+	resource()->getModel()->increaseRevision();
 	image3D()->setName(sName);
 }
 
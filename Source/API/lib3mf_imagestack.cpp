@@ -57,6 +57,7 @@ Lib3MF_uint32 CImageStack::GetRowCount()
 
 void CImageStack::SetRowCount(const Lib3MF_uint32 nRowCount)
 {
+	resource()->getModel()->increaseRevision();
 	m_pModelImageStack->setRowCount(nRowCount);
 }
 
@@ -67,6 +68,7 @@ Lib3MF_uint32 CImageStack::GetColumnCount()
 
 void CImageStack::SetColumnCount(const Lib3MF_uint32 nColumnCount)
 {
+	resource()->getModel()->increaseRevision();
 	m_pModelImageStack->setColumnCount(nColumnCount);
 }
 
@@ -83,6 +85,7 @@ IAttachment * CImageStack::GetSheet(const Lib3MF_uint32 nIndex)
 
 void CImageStack::SetSheet(const Lib3MF_uint32 nIndex, IAttachment* pSheet)
 {
+	resource()->getModel()->increaseRevision();
 	if (pSheet == nullptr)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
@@ -95,6 +98,7 @@ void CImageStack::SetSheet(const Lib3MF_uint32 nIndex, IAttachment* pSheet)
 
 IAttachment * CImageStack::CreateEmptySheet(const Lib3MF_uint32 nIndex, const std::string & sPath)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::PImportStream pStream = std::make_shared<NMR::CImportStream_Unique_Memory>();
 	auto pAttachment = m_pModelImageStack->createSheet(nIndex, sPath, pStream);
 	return new CAttachment(pAttachment);
@@ -102,6 +106,7 @@ IAttachment * CImageStack::CreateEmptySheet(const Lib3MF_uint32 nIndex, const st
 
 IAttachment * CImageStack::CreateSheetFromBuffer(const Lib3MF_uint32 nIndex, const std::string & sPath, const Lib3MF_uint64 nDataBufferSize, const Lib3MF_uint8 * pDataBuffer)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::PImportStream pStream = std::make_shared<NMR::CImportStream_Unique_Memory>(pDataBuffer, nDataBufferSize);
 	auto pAttachment = m_pModelImageStack->createSheet(nIndex, sPath, pStream);
 	return new CAttachment(pAttachment);
@@ -109,6 +114,7 @@ IAttachment * CImageStack::CreateSheetFromBuffer(const Lib3MF_uint32 nIndex, con
 
 IAttachment * CImageStack::CreateSheetFromFile(const Lib3MF_uint32 nIndex, const std::string & sPath, const std::string & sFileName)
 {
+	resource()->getModel()->increaseRevision();
 	std::wstring sUTF16FileName = NMR::fnUTF8toUTF16(sFileName);
 	NMR::PImportStream pFileStream = std::make_shared<NMR::CImportStream_Native>(sUTF16FileName.c_str());
 	auto pAttachment = m_pModelImageStack->createSheet(nIndex, sPath, pFileStream->copyToMemory());
@@ -115,6 +115,7 @@ std::string CImplicitFunction::GetIdentifier()
 
 void CImplicitFunction::SetIdentifier(const std::string& sIdentifier)
 {
+    resource()->getModel()->increaseRevision();
     function()->setIdentifier(sIdentifier);
 }
 
@@ -123,6 +124,7 @@ IImplicitNode* CImplicitFunction::AddNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode = function()->addNode(eNodeType, eConfiguration, sIdentifier,
                                        sDisplayName, sTag);
     return new CImplicitNode(newNode);
@@ -133,6 +135,7 @@ ISinNode* CImplicitFunction::AddSinNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Sinus, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -144,6 +147,7 @@ ICosNode* CImplicitFunction::AddCosNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Cosinus, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -155,6 +159,7 @@ ITanNode* CImplicitFunction::AddTanNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Tan, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -166,6 +171,7 @@ IArcSinNode* CImplicitFunction::AddArcSinNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ArcSin, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -177,6 +183,7 @@ IArcCosNode* CImplicitFunction::AddArcCosNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ArcCos, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -188,6 +195,7 @@ IArcTan2Node* CImplicitFunction::AddArcTan2Node(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ArcTan2, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -199,6 +207,7 @@ ISinhNode* CImplicitFunction::AddSinhNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Sinh, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -210,6 +219,7 @@ ICoshNode* CImplicitFunction::AddCoshNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Cosh, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -221,6 +231,7 @@ ITanhNode* CImplicitFunction::AddTanhNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Tanh, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -232,6 +243,7 @@ IRoundNode* CImplicitFunction::AddRoundNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Round, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -243,6 +255,7 @@ ICeilNode* CImplicitFunction::AddCeilNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Ceil, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -254,6 +267,7 @@ IFloorNode* CImplicitFunction::AddFloorNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Floor, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -265,6 +279,7 @@ ISignNode* CImplicitFunction::AddSignNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Sign, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -276,6 +291,7 @@ IFractNode* CImplicitFunction::AddFractNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Fract, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -287,6 +303,7 @@ IAbsNode* CImplicitFunction::AddAbsNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Abs, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -298,6 +315,7 @@ IExpNode* CImplicitFunction::AddExpNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Exp, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -309,6 +327,7 @@ ILogNode* CImplicitFunction::AddLogNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Log, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -320,6 +339,7 @@ ILog2Node* CImplicitFunction::AddLog2Node(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Log2, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -331,6 +351,7 @@ ILog10Node* CImplicitFunction::AddLog10Node(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Log10, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -341,6 +362,7 @@ ILengthNode* CImplicitFunction::AddLengthNode(const std::string& sIdentifier,
                                               const std::string& sDisplayName,
                                               const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Length,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -353,6 +375,7 @@ ITransposeNode* CImplicitFunction::AddTransposeNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Transpose,
                             eConfiguration, sIdentifier, sDisplayName, sTag);
@@ -363,6 +386,7 @@ IInverseNode* CImplicitFunction::AddInverseNode(const std::string& sIdentifier,
                                              const std::string& sDisplayName,
                                              const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Inverse,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -375,6 +399,7 @@ ISqrtNode* CImplicitFunction::AddSqrtNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Sqrt, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -385,6 +410,7 @@ IResourceIdNode* CImplicitFunction::AddResourceIdNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ConstResourceID,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -397,6 +423,7 @@ IAdditionNode* CImplicitFunction::AddAdditionNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Addition, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -409,6 +436,7 @@ ISubtractionNode* CImplicitFunction::AddSubtractionNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Subtraction,
                             eConfiguration, sIdentifier, sDisplayName, sTag);
@@ -420,6 +448,7 @@ IMultiplicationNode* CImplicitFunction::AddMultiplicationNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Multiplication,
                             eConfiguration, sIdentifier, sDisplayName, sTag);
@@ -431,6 +460,7 @@ IDivisionNode* CImplicitFunction::AddDivisionNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Division, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -441,6 +471,7 @@ IDotNode* CImplicitFunction::AddDotNode(const std::string& sIdentifier,
                                         const std::string& sDisplayName,
                                         const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Dot,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -452,6 +483,7 @@ ICrossNode* CImplicitFunction::AddCrossNode(const std::string& sIdentifier,
                                             const std::string& sDisplayName,
                                             const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Cross,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -463,6 +495,7 @@ IMatVecMultiplicationNode* CImplicitFunction::AddMatVecMultiplicationNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::MatVecMultiplication,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -475,6 +508,7 @@ IMinNode* CImplicitFunction::AddMinNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Min, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -486,6 +520,7 @@ IMaxNode* CImplicitFunction::AddMaxNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Max, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -497,6 +532,7 @@ IFmodNode* CImplicitFunction::AddFmodNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Fmod, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -508,6 +544,7 @@ IPowNode* CImplicitFunction::AddPowNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Pow, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -519,6 +556,7 @@ ISelectNode* CImplicitFunction::AddSelectNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Select, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -530,6 +568,7 @@ IClampNode* CImplicitFunction::AddClampNode(
     const Lib3MF::eImplicitNodeConfiguration eConfiguration,
     const std::string& sDisplayName, const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Clamp, eConfiguration,
                             sIdentifier, sDisplayName, sTag);
@@ -540,6 +579,7 @@ IComposeVectorNode* CImplicitFunction::AddComposeVectorNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ComposeVector,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -551,6 +591,7 @@ IVectorFromScalarNode * CImplicitFunction::AddVectorFromScalarNode(const std::st
                                                                    const std::string & sDisplayName,
                                                                    const std::string & sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode = function()->addNode(Lib3MF::eImplicitNodeType::VectorFromScalar,
                                        Lib3MF::eImplicitNodeConfiguration::Default,
                                        sIdentifier,
@@ -563,6 +604,7 @@ IDecomposeVectorNode* CImplicitFunction::AddDecomposeVectorNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::DecomposeVector,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -574,6 +616,7 @@ IComposeMatrixNode* CImplicitFunction::AddComposeMatrixNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ComposeMatrix,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -585,6 +628,7 @@ IMatrixFromRowsNode * CImplicitFunction::AddMatrixFromRowsNode(const std::string
                                                         const std::string & sDisplayName,
                                                         const std::string & sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode = function()->addNode(Lib3MF::eImplicitNodeType::MatrixFromRows,
                                        Lib3MF::eImplicitNodeConfiguration::Default,
                                        sIdentifier,
@@ -597,6 +641,7 @@ IMatrixFromColumnsNode * CImplicitFunction::AddMatrixFromColumnsNode(const std::
                                                                       const std::string & sDisplayName,
                                                                       const std::string & sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode = function()->addNode(Lib3MF::eImplicitNodeType::MatrixFromColumns,
                                        Lib3MF::eImplicitNodeConfiguration::Default,
                                        sIdentifier,
@@ -609,6 +654,7 @@ IConstantNode* CImplicitFunction::AddConstantNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Constant,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -620,6 +666,7 @@ IConstVecNode* CImplicitFunction::AddConstVecNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ConstVec,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -631,6 +678,7 @@ IConstMatNode* CImplicitFunction::AddConstMatNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::ConstMat,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -642,6 +690,7 @@ IMeshNode* CImplicitFunction::AddMeshNode(const std::string& sIdentifier,
                                           const std::string& sDisplayName,
                                           const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::Mesh,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -653,6 +702,7 @@ IUnsignedMeshNode * CImplicitFunction::AddUnsignedMeshNode(const std::string & s
                                                     const std::string & sDisplayName,
                                                     const std::string & sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode = function()->addNode(Lib3MF::eImplicitNodeType::UnsignedMesh,
                                        Lib3MF::eImplicitNodeConfiguration::Default,
                                        sIdentifier,
@@ -665,6 +715,7 @@ IFunctionCallNode* CImplicitFunction::AddFunctionCallNode(
     const std::string& sIdentifier, const std::string& sDisplayName,
     const std::string& sTag)
 {
+    resource()->getModel()->increaseRevision();
     auto newNode =
         function()->addNode(Lib3MF::eImplicitNodeType::FunctionCall,
                             Lib3MF::eImplicitNodeConfiguration::Default,
@@ -679,6 +730,7 @@ INodeIterator* CImplicitFunction::GetNodes()
 
 void CImplicitFunction::RemoveNode(IImplicitNode* pNode)
 {
+    resource()->getModel()->increaseRevision();
     if(pNode == nullptr)
         throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
     function()->removeNode(pNode->GetIdentifier());
@@ -686,6 +738,7 @@ void CImplicitFunction::RemoveNode(IImplicitNode* pNode)
 
 void CImplicitFunction::AddLink(IImplicitPort* pSource, IImplicitPort* pTarget)
 {
+    resource()->getModel()->increaseRevision();
     if (pSource == nullptr || pTarget == nullptr)
     {
         throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -704,16 +757,19 @@ void CImplicitFunction::AddLink(IImplicitPort* pSource, IImplicitPort* pTarget)
 void CImplicitFunction::AddLinkByNames(const std::string& sSource,
                                        const std::string& sTarget)
 {
+    resource()->getModel()->increaseRevision();
     function()->addLink(sSource, sTarget);
 }
 
 void CImplicitFunction::Clear()
 {
+    resource()->getModel()->increaseRevision();
     function()->clear();
 }
 
 void CImplicitFunction::SortNodesTopologically()
 {
+    resource()->getModel()->increaseRevision();
     function()->sortNodesTopologically();
 }
 
@@ -34,6 +34,7 @@ Abstract: This is a stub class definition of CImplicitNode
 #include "lib3mf_interfaceexception.hpp"
 #include "lib3mf_meshobject.hpp"
 #include <Model/Classes/NMR_ModelMeshObject.h>
+#include <Model/Classes/NMR_ModelImplicitFunction.h>
 
 // Include custom headers here.
 
@@ -54,6 +55,7 @@ std::string CImplicitNode::GetIdentifier()
 
 void CImplicitNode::SetIdentifier(const std::string & sIdentifier)
 {
+    increaseRevision();
     m_pImplicitNode->setIdentifier(sIdentifier);
 }
 
@@ -64,6 +66,7 @@ std::string CImplicitNode::GetDisplayName()
 
 void CImplicitNode::SetDisplayName(const std::string& sDisplayName)
 {
+    increaseRevision();
     m_pImplicitNode->setDisplayName(sDisplayName);
 }
 
@@ -74,6 +77,7 @@ std::string CImplicitNode::GetTag()
 
 void CImplicitNode::SetTag(const std::string& sTag)
 {
+    increaseRevision();
     m_pImplicitNode->setTag(sTag);
 }
 
@@ -104,6 +108,25 @@ CImplicitNode::CImplicitNode(NMR::PModelImplicitNode pImplicitNode)
 {
 }
 
+NMR::CModel * CImplicitNode::model()
+{
+    NMR::CModelImplicitFunction * pFunction = m_pImplicitNode->getParent();
+    if (pFunction == nullptr)
+    {
+        return nullptr;
+    }
+    return pFunction->getModel();
+}
+
+void CImplicitNode::increaseRevision()
+{
+    NMR::CModel * pModel = model();
+    if (pModel != nullptr)
+    {
+        pModel->increaseRevision();
+    }
+}
+
 Lib3MF::eImplicitNodeType CImplicitNode::GetNodeType()
 {
     return m_pImplicitNode->getNodeType();
@@ -112,23 +135,25 @@ Lib3MF::eImplicitNodeType CImplicitNode::GetNodeType()
 IImplicitPort * CImplicitNode::AddInput(const std::string & sIdentifier,
                                         const std::string & sDisplayName)
 {
-    return new CImplicitPort(m_pImplicitNode->addInput(sIdentifier, sDisplayName));
+    increaseRevision();
+    return new CImplicitPort(m_pImplicitNode->addInput(sIdentifier, sDisplayName), model());
 }
 
 IImplicitPort * CImplicitNode::AddOutput(const std::string & sIdentifier,
                                          const std::string & sDisplayName)
 {
-    return new CImplicitPort(m_pImplicitNode->addOutput(sIdentifier, sDisplayName));
+    increaseRevision();
+    return new CImplicitPort(m_pImplicitNode->addOutput(sIdentifier, sDisplayName), model());
 }
 
 IImplicitPortIterator * CImplicitNode::GetOutputs()
 {
-    return new CImplicitPortIterator(m_pImplicitNode->getOutputs());
+    return new CImplicitPortIterator(m_pImplicitNode->getOutputs(), model());
 }
 
 IImplicitPortIterator * CImplicitNode::GetInputs()
 {
-    return new CImplicitPortIterator(m_pImplicitNode->getInputs());
+    return new CImplicitPortIterator(m_pImplicitNode->getInputs(), model());
 }
 
 IImplicitPort * CImplicitNode::FindInput(const std::string & sIdentifier)
@@ -138,7 +163,7 @@ IImplicitPort * CImplicitNode::FindInput(const std::string & sIdentifier)
     {
         return nullptr;
     }
-    return new CImplicitPort(pPort);
+    return new CImplicitPort(pPort, model());
 }
 
 IImplicitPort * CImplicitNode::FindOutput(const std::string & sIdentifier)
@@ -148,7 +173,7 @@ IImplicitPort * CImplicitNode::FindOutput(const std::string & sIdentifier)
     {
         return nullptr;
     }
-    return new CImplicitPort(pPort);
+    return new CImplicitPort(pPort, model());
 }
 
 bool Lib3MF::Impl::CImplicitNode::AreTypesValid()
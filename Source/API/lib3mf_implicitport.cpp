@@ -40,8 +40,8 @@ using namespace Lib3MF::Impl;
  Class definition of CImplicitPort
 **************************************************************************************************************************/
 
-Lib3MF::Impl::CImplicitPort::CImplicitPort(NMR::PModelImplicitPort pImplicitPort)
-    : m_pImplicitPort(pImplicitPort)
+Lib3MF::Impl::CImplicitPort::CImplicitPort(NMR::PModelImplicitPort pImplicitPort, NMR::CModel * pModel)
+    : m_pImplicitPort(pImplicitPort), m_pModel(pModel)
 {
 }
 
@@ -52,6 +52,10 @@ std::string CImplicitPort::GetIdentifier()
 
 void CImplicitPort::SetIdentifier(const std::string & sIdentifier)
 {
+    if (m_pModel != nullptr)
+    {
+        m_pModel->increaseRevision();
+    }
     m_pImplicitPort->setIdentifier(sIdentifier);
 }
 
@@ -62,11 +66,19 @@ std::string CImplicitPort::GetDisplayName()
 
 void CImplicitPort::SetDisplayName(const std::string & sDisplayName)
 {
+    if (m_pModel != nullptr)
+    {
+        m_pModel->increaseRevision();
+    }
     m_pImplicitPort->setDisplayName(sDisplayName);
 }
 
 void CImplicitPort::SetType(const Lib3MF::eImplicitPortType eType)
 {
+    if (m_pModel != nullptr)
+    {
+        m_pModel->increaseRevision();
+    }
     m_pImplicitPort->setType(eType);
 }
 
@@ -82,6 +94,10 @@ std::string CImplicitPort::GetReference()
 
 void CImplicitPort::SetReference(const std::string & sReference)
 {
+    if (m_pModel != nullptr)
+    {
+        m_pModel->increaseRevision();
+    }
     m_pImplicitPort->setReference(sReference);
 }
 
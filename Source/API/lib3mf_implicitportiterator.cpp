@@ -40,7 +40,7 @@ using namespace Lib3MF::Impl;
  Class definition of CImplicitPortIterator 
 **************************************************************************************************************************/
 
-Lib3MF::Impl::CImplicitPortIterator::CImplicitPortIterator(NMR::PPorts pPorts) : m_pPorts(pPorts)
+Lib3MF::Impl::CImplicitPortIterator::CImplicitPortIterator(NMR::PPorts pPorts, NMR::CModel * pModel) : m_pPorts(pPorts), m_pModel(pModel)
 {
 }
 
@@ -52,6 +52,6 @@ Lib3MF_uint64 Lib3MF::Impl::CImplicitPortIterator::Count()
 IImplicitPort * CImplicitPortIterator::GetCurrent()
 {
 	throwIfInvalidIndex();
-	return new CImplicitPort(m_pPorts->at(static_cast<size_t>(getCurrentIndex())));
+	return new CImplicitPort(m_pPorts->at(static_cast<size_t>(getCurrentIndex())), m_pModel);
 }
 
@@ -0,0 +1,129 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is a stub class definition of CInstanceTable
+
+*/
+
+#include "lib3mf_instancetable.hpp"
+#include "lib3mf_interfaceexception.hpp"
+
+// Include custom headers here.
+#include "lib3mf_meshobject.hpp"
+#include "lib3mf_utils.hpp"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include <algorithm>
+
+using namespace Lib3MF::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CInstanceTable 
+**************************************************************************************************************************/
+
+CInstanceTable::CInstanceTable(NMR::PModel pModel)
+	: m_pModel(pModel)
+{
+	if (!pModel.get())
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+	m_pInstanceTable = std::make_shared<NMR::CModelInstanceTable>(pModel.get());
+}
+
+Lib3MF_uint32 CInstanceTable::GetMeshCount()
+{
+	return m_pInstanceTable->getMeshCount();
+}
+
+IMeshObject * CInstanceTable::GetMeshObject(const Lib3MF_uint32 nMeshIndex)
+{
+	return new CMeshObject(m_pInstanceTable->getMesh(nMeshIndex).m_pMeshObject);
+}
+
+void CInstanceTable::GetMeshRange(const Lib3MF_uint32 nMeshIndex, Lib3MF_uint32 & nVertexOffset, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nTriangleOffset, Lib3MF_uint32 & nTriangleCount)
+{
+	const NMR::MODELINSTANCETABLEMESH & Mesh = m_pInstanceTable->getMesh(nMeshIndex);
+	nVertexOffset = Mesh.m_nVertexOffset;
+	nVertexCount = Mesh.m_nVertexCount;
+	nTriangleOffset = Mesh.m_nTriangleOffset;
+	nTriangleCount = Mesh.m_nTriangleCount;
+}
+
+void CInstanceTable::GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer)
+{
+	const std::vector<NMR::NVEC3> & Vertices = m_pInstanceTable->getVertices();
+	Lib3MF_uint64 nVertexCount = Vertices.size();
+	if (pVerticesNeededCount)
+		*pVerticesNeededCount = nVertexCount;
+
+	if (nVerticesBufferSize >= nVertexCount && pVerticesBuffer)
+	{
+		for (size_t nIndex = 0; nIndex < Vertices.size(); nIndex++) {
+			pVerticesBuffer[nIndex].m_Coordinates[0] = Vertices[nIndex].m_fields[0];
+			pVerticesBuffer[nIndex].m_Coordinates[1] = Vertices[nIndex].m_fields[1];
+			pVerticesBuffer[nIndex].m_Coordinates[2] = Vertices[nIndex].m_fields[2];
+		}
+	}
+}
+
+void CInstanceTable::GetTriangles(Lib3MF_uint64 nTrianglesBufferSize, Lib3MF_uint64* pTrianglesNeededCount, Lib3MF::sTriangle * pTrianglesBuffer)
+{
+	const std::vector<NMR::nfUint32> & Indices = m_pInstanceTable->getIndices();
+	Lib3MF_uint64 nTriangleCount = Indices.size() / 3;
+	if (pTrianglesNeededCount)
+		*pTrianglesNeededCount = nTriangleCount;
+
+	if (nTrianglesBufferSize >= nTriangleCount && pTrianglesBuffer)
+	{
+		for (size_t nIndex = 0; nIndex < nTriangleCount; nIndex++) {
+			pTrianglesBuffer[nIndex].m_Indices[0] = Indices[nIndex * 3];
+			pTrianglesBuffer[nIndex].m_Indices[1] = Indices[nIndex * 3 + 1];
+			pTrianglesBuffer[nIndex].m_Indices[2] = Indices[nIndex * 3 + 2];
+		}
+	}
+}
+
+Lib3MF_uint32 CInstanceTable::GetInstanceCount()
+{
+	return (Lib3MF_uint32)m_pInstanceTable->getEntries().size();
+}
+
+void CInstanceTable::GetInstances(Lib3MF_uint64 nInstancesBufferSize, Lib3MF_uint64* pInstancesNeededCount, Lib3MF::sMeshInstance * pInstancesBuffer)
+{
+	const std::vector<NMR::MODELINSTANCETABLEENTRY> & Entries = m_pInstanceTable->getEntries();
+	Lib3MF_uint64 nInstanceCount = Entries.size();
+	if (pInstancesNeededCount)
+		*pInstancesNeededCount = nInstanceCount;
+
+	if (nInstancesBufferSize >= nInstanceCount && pInstancesBuffer)
+	{
+		for (size_t nIndex = 0; nIndex < Entries.size(); nIndex++) {
+			const NMR::MODELINSTANCETABLEENTRY & Entry = Entries[nIndex];
+			pInstancesBuffer[nIndex].m_MeshIndex = Entry.m_nMeshIndex;
+			pInstancesBuffer[nIndex].m_BuildItemIndex = Entry.m_nBuildItemIndex;
+			sLib3MFTransform Transform = MatrixToTransform(Entry.m_mTransform);
+			std::copy(&Transform.m_Fields[0][0], &Transform.m_Fields[0][0] + 12, &pInstancesBuffer[nIndex].m_Transform[0][0]);
+		}
+	}
+}
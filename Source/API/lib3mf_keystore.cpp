@@ -27,6 +27,7 @@ Lib3MF::Impl::CKeyStore::CKeyStore(NMR::PModel const & pModel)
 
 IConsumer * Lib3MF::Impl::CKeyStore::AddConsumer(const std::string & sConsumerID, const std::string & sKeyID, const std::string & sKeyValue)
 {
+	m_pModel->increaseRevision();
 	NMR::PKeyStoreConsumer consumer = NMR::CKeyStoreFactory::makeConsumer(sConsumerID);
 	consumer->setKeyID(sKeyID);
 	consumer->setKeyValue(sKeyValue);
@@ -55,6 +56,7 @@ IConsumer * Lib3MF::Impl::CKeyStore::FindConsumer(const std::string & sConsumerI
 
 void Lib3MF::Impl::CKeyStore::RemoveConsumer(IConsumer * pConsumerInstance) 
 {
+	m_pModel->increaseRevision();
 	CConsumer * pConsumer = dynamic_cast<CConsumer *>(pConsumerInstance);
 	if (!pConsumer) {
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDKEYSTORECONSUMER);
@@ -71,6 +73,7 @@ std::string Lib3MF::Impl::CKeyStore::GetUUID(bool & bHasUUID) {
 
 void Lib3MF::Impl::CKeyStore::SetUUID(const std::string & sUUID)
 {
+	m_pModel->increaseRevision();
 	NMR::PUUID pUUID = std::make_shared<NMR::CUUID>(sUUID);
 	m_pKeyStore->setUUID(pUUID);
 }
@@ -83,10 +86,11 @@ Lib3MF_uint64 Lib3MF::Impl::CKeyStore::GetResourceDataGroupCount()
 IResourceDataGroup * Lib3MF::Impl::CKeyStore::GetResourceDataGroup(const Lib3MF_uint64 nResourceDataIndex)
 {
 	NMR::PKeyStoreResourceDataGroup dg = m_pKeyStore->getResourceDataGroup(nResourceDataIndex);
-	return new CResourceDataGroup(dg);
+	return new CResourceDataGroup(dg, m_pModel.get());
 }
 
 IResourceDataGroup * Lib3MF::Impl::CKeyStore::AddResourceDataGroup() {
+	m_pModel->increaseRevision();
 	//this is not ideal, as key size is determined by the encryptionalgorithm inside resourcedata.
 	//in any case, the spec does not state what happens if different resource datas have different algorithms,
 	//but resourcedatagroups are supposed to group the same key for a group of resources...
@@ -95,10 +99,11 @@ IResourceDataGroup * Lib3MF::Impl::CKeyStore::AddResourceDataGroup() {
 	m_pModel->generateRandomBytes(key.data(), key.size());
 	NMR::PKeyStoreResourceDataGroup dg = NMR::CKeyStoreFactory::makeResourceDataGroup(std::make_shared<NMR::CUUID>(), key);
 	m_pKeyStore->addResourceDataGroup(dg);
-	return new CResourceDataGroup(dg);
+	return new CResourceDataGroup(dg, m_pModel.get());
 }
 
 void Lib3MF::Impl::CKeyStore::RemoveResourceDataGroup(IResourceDataGroup * pTheResourceDataGroup) {
+	m_pModel->increaseRevision();
 	CResourceDataGroup * dg = dynamic_cast<CResourceDataGroup *>(pTheResourceDataGroup);
 	if (!dg)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -113,10 +118,11 @@ Lib3MF::Impl::IResourceDataGroup * Lib3MF::Impl::CKeyStore::FindResourceDataGrou
 	NMR::PKeyStoreResourceDataGroup dg = m_pKeyStore->findResourceDataGroupByResourceDataPath(pPath);
 	if (!dg)
 		return nullptr;
-	return new CResourceDataGroup(dg);
+	return new CResourceDataGroup(dg, m_pModel.get());
 }
 
 Lib3MF::Impl::IResourceData * Lib3MF::Impl::CKeyStore::AddResourceData(Lib3MF::Impl::IResourceDataGroup *pResourceDataGroup, Lib3MF::Impl::IPackagePart *pPartPath, Lib3MF::eEncryptionAlgorithm eAlgorithm, Lib3MF::eCompression eCompression, Lib3MF_uint64 nAdditionalAuthenticationDataBufferSize, const Lib3MF_uint8 *pAdditionalAuthenticationDataBuffer) {
+	m_pModel->increaseRevision();
 	bool compression = translateCompression(eCompression);
 	NMR::eKeyStoreEncryptAlgorithm algorithm = translateEncryptionAlgorithm(eAlgorithm);
 	CResourceDataGroup * dg = dynamic_cast<CResourceDataGroup *>(pResourceDataGroup);
@@ -131,10 +137,11 @@ Lib3MF::Impl::IResourceData * Lib3MF::Impl::CKeyStore::AddResourceData(Lib3MF::I
 	NMR::PKeyStoreCEKParams params = NMR::CKeyStoreFactory::makeCEKParams(compression, algorithm, aad);
 	NMR::PKeyStoreResourceData rd = NMR::CKeyStoreFactory::makeResourceData(dg->resourceDataGroup(), pPath, params);
 	m_pKeyStore->addResourceData(rd);
-	return new CResourceData(rd);
+	return new CResourceData(rd, m_pModel.get());
 }
 
 void Lib3MF::Impl::CKeyStore::RemoveResourceData(Lib3MF::Impl::IResourceData *pResourceData) {
+	m_pModel->increaseRevision();
 	CResourceData * rd = dynamic_cast<CResourceData *>(pResourceData);
 	if (!rd)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -147,7 +154,7 @@ Lib3MF_uint64 Lib3MF::Impl::CKeyStore::GetResourceDataCount() {
 
 Lib3MF::Impl::IResourceData * Lib3MF::Impl::CKeyStore::GetResourceData(Lib3MF_uint64 nResourceDataIndex) {
 	NMR::PKeyStoreResourceData rd = m_pKeyStore->getResourceData(nResourceDataIndex);
-	return new CResourceData(rd);
+	return new CResourceData(rd, m_pModel.get());
 }
 
 IResourceData * Lib3MF::Impl::CKeyStore::FindResourceData(IPackagePart * pResourcePath) {
@@ -157,5 +164,5 @@ IResourceData * Lib3MF::Impl::CKeyStore::FindResourceData(IPackagePart * pResour
 	NMR::PKeyStoreResourceData rd = m_pKeyStore->findResourceData(pPath);
 	if (!rd)
 		return nullptr;
-	return new CResourceData(rd);
+	return new CResourceData(rd, m_pModel.get());
 }
@@ -93,6 +93,7 @@ CLevelSet::CLevelSet(NMR::PModelResource pResource)
 
 void CLevelSet::SetFunction(IFunction* pTheFunction)
 {
+    resource()->getModel()->increaseRevision();
     if(pTheFunction == nullptr)
 	{
         throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -122,6 +123,7 @@ Lib3MF::sTransform CLevelSet::GetTransform()
 
 void CLevelSet::SetTransform(const Lib3MF::sTransform Transform)
 {
+	resource()->getModel()->increaseRevision();
 	levelSetObject()->setTransform(TransformToMatrix(Transform));
 }
 
@@ -132,11 +134,13 @@ std::string CLevelSet::GetChannelName()
 
 void CLevelSet::SetChannelName(const std::string & sChannelName)
 {
+	resource()->getModel()->increaseRevision();
 	levelSetObject()->setChannelName(sChannelName);
 }
 
 void CLevelSet::SetMinFeatureSize(const Lib3MF_double dMinFeatureSize)
 {
+	resource()->getModel()->increaseRevision();
 	levelSetObject()->setMinFeatureSize(dMinFeatureSize);
 }
 
@@ -147,6 +151,7 @@ Lib3MF_double CLevelSet::GetMinFeatureSize()
 
 void CLevelSet::SetFallBackValue(const Lib3MF_double dFallBackValue)
 {
+	resource()->getModel()->increaseRevision();
 	levelSetObject()->setFallBackValue(dFallBackValue);
 }
 
@@ -157,6 +162,7 @@ Lib3MF_double CLevelSet::GetFallBackValue()
 
 void CLevelSet::SetMeshBBoxOnly(const bool bMeshBBoxOnly)
 {
+	resource()->getModel()->increaseRevision();
 	levelSetObject()->setMeshBBoxOnly(bMeshBBoxOnly);
 }
 
@@ -167,6 +173,7 @@ bool CLevelSet::GetMeshBBoxOnly()
 
 void CLevelSet::SetMesh(IMeshObject* pTheMesh)
 {
+	resource()->getModel()->increaseRevision();
 	if(pTheMesh == nullptr)
 	{
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -218,6 +225,7 @@ IMeshObject * CLevelSet::GetMesh()
 
 void CLevelSet::SetVolumeData(IVolumeData* pTheVolumeData)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::CModel * pModel = levelSetObject()->getModel();
 	if (pModel == nullptr)
             throw ELib3MFInterfaceException(
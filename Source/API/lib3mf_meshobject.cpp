@@ -108,6 +108,7 @@ Lib3MF_uint32 CMeshObject::GetTriangleCount ()
 
 void CMeshObject::SetVertex (const Lib3MF_uint32 nIndex, const sLib3MFPosition Coordinates)
 {
+	meshObject()->getModel()->increaseRevision();
 	NMR::MESHNODE* node = mesh()->getNode(nIndex);
 	node->m_position.m_fields[0] = Coordinates.m_Coordinates[0];
 	node->m_position.m_fields[1] = Coordinates.m_Coordinates[1];
@@ -126,7 +127,8 @@ sLib3MFPosition CMeshObject::GetVertex(const Lib3MF_uint32 nIndex)
 
 Lib3MF_uint32 CMeshObject::AddVertex (const sLib3MFPosition Coordinates)
 {
-	return mesh()->addNode(Coordinates.m_Coordinates[0], Coordinates.m_Coordinates[1], Coordinates.m_Coordinates[2])->m_index;
+	meshObject()->getModel()->increaseRevision();
+	return mesh()->addNode(Coordinates.m_Coordinates[0], Coordinates.m_Coordinates[1], Coordinates.m_Coordinates[2]);
 }
 
 void CMeshObject::GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer)
@@ -161,6 +163,7 @@ sLib3MFTriangle CMeshObject::GetTriangle (const Lib3MF_uint32 nIndex)
 
 void CMeshObject::SetTriangle (const Lib3MF_uint32 nIndex, const sLib3MFTriangle Indices)
 {
+	meshObject()->getModel()->increaseRevision();
 	NMR::MESHFACE* mf = mesh()->getFace(nIndex);
 
 	mf->m_nodeindices[0] = Indices.m_Indices[0];
@@ -170,7 +173,8 @@ void CMeshObject::SetTriangle (const Lib3MF_uint32 nIndex, const sLib3MFTriangle
 
 Lib3MF_uint32 CMeshObject::AddTriangle(const sLib3MFTriangle Indices)
 {
-	return mesh()->addFace(Indices.m_Indices[0], Indices.m_Indices[1], Indices.m_Indices[2])->m_index;
+	meshObject()->getModel()->increaseRevision();
+	return mesh()->addFace(Indices.m_Indices[0], Indices.m_Indices[1], Indices.m_Indices[2]);
 }
 
 void CMeshObject::GetTriangleIndices (Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, sLib3MFTriangle * pIndicesBuffer)
@@ -193,6 +197,7 @@ void CMeshObject::GetTriangleIndices (Lib3MF_uint64 nIndicesBufferSize, Lib3MF_u
 
 void CMeshObject::SetObjectLevelProperty(const Lib3MF_uint32 nUniqueResourceID, const Lib3MF_uint32 nPropertyID)
 {
+	meshObject()->getModel()->increaseRevision();
 	NMR::CMeshInformation_Properties * pInformation = getMeshInformationProperties();
 
 	NMR::MESHINFORMATION_PROPERTIES * pDefaultData = new NMR::MESHINFORMATION_PROPERTIES;
@@ -219,6 +224,7 @@ bool CMeshObject::GetObjectLevelProperty(Lib3MF_uint32 & nUniqueResourceID, Lib3
 
 void CMeshObject::SetTriangleProperties(const Lib3MF_uint32 nIndex, const sLib3MFTriangleProperties Properties)
 {
+	meshObject()->getModel()->increaseRevision();
 	NMR::CMeshInformation_Properties * pInformation = getMeshInformationProperties();
 
 	NMR::MESHINFORMATION_PROPERTIES * pFaceData = (NMR::MESHINFORMATION_PROPERTIES*)pInformation->getFaceData(nIndex);
@@ -254,6 +260,7 @@ void CMeshObject::GetTriangleProperties(const Lib3MF_uint32 nIndex, sLib3MFTrian
 
 void CMeshObject::SetAllTriangleProperties(const Lib3MF_uint64 nPropertiesArrayBufferSize, const sLib3MFTriangleProperties * pPropertiesArrayBuffer)
 {
+	meshObject()->getModel()->increaseRevision();
 	auto pMesh = mesh();
 	uint32_t nFaceCount = pMesh->getFaceCount();
 
@@ -321,11 +328,13 @@ void CMeshObject::GetAllTriangleProperties(Lib3MF_uint64 nPropertiesArrayBufferS
 
 void CMeshObject::ClearAllProperties()
 {
+	meshObject()->getModel()->increaseRevision();
 	mesh()->clearMeshInformationHandler();
 }
 
 void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer, const Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer)
 {
+	meshObject()->getModel()->increaseRevision();
 	if ( ((!pVerticesBuffer) && (nVerticesBufferSize>0)) || ((!pIndicesBuffer) && (nIndicesBufferSize>0)))
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
@@ -349,12 +358,9 @@ void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLi
 	// Rebuild Mesh Faces
 	const sLib3MFTriangle * pTriangle = pIndicesBuffer;
 	for (Lib3MF_uint64 nIndex = 0; nIndex < nIndicesBufferSize; nIndex++) {
-		NMR::MESHNODE * pNodes[3];
-
 		for (int j = 0; j < 3; j++) {
 			if (pTriangle->m_Indices[j] >= nVerticesBufferSize)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
-			pNodes[j] = pMesh->getNode(pTriangle->m_Indices[j]);
 		}
 
 		if ((pTriangle->m_Indices[0] == pTriangle->m_Indices[1]) ||
@@ -362,7 +368,7 @@ void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLi
 			(pTriangle->m_Indices[1] == pTriangle->m_Indices[2]))
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
-		pMesh->addFace(pNodes[0], pNodes[1], pNodes[2]);
+		pMesh->addFace(pTriangle->m_Indices[0], pTriangle->m_Indices[1], pTriangle->m_Indices[2]);
 
 		pTriangle++;
 	}
@@ -410,6 +416,7 @@ IVolumeData * CMeshObject::GetVolumeData()
 
 void CMeshObject::SetVolumeData(IVolumeData* pTheVolumeData)
 {
+	meshObject()->getModel()->increaseRevision();
 	NMR::CModel * pModel = meshObject()->getModel();
 	if (pModel == nullptr)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDOBJECT);
@@ -429,6 +436,7 @@ void CMeshObject::SetVolumeData(IVolumeData* pTheVolumeData)
 
 ITriangleSet* CMeshObject::AddTriangleSet(const std::string& sIdentifier, const std::string& sName)
 {	
+	meshObject()->getModel()->increaseRevision();
 	return new CTriangleSet(meshObject()->addTriangleSet(sIdentifier, sName), meshObject());
 }
 
@@ -40,8 +40,8 @@ using namespace Lib3MF::Impl;
  Class definition of CMetaData 
 **************************************************************************************************************************/
 
-CMetaData::CMetaData(NMR::PModelMetaData pMetaData)
-	:m_pMetaData(pMetaData)
+CMetaData::CMetaData(NMR::PModelMetaData pMetaData, NMR::CModel * pModel)
+	:m_pMetaData(pMetaData), m_pModel(pModel)
 {
 }
 
@@ -53,6 +53,7 @@ std::string CMetaData::GetNameSpace ()
 
 void CMetaData::SetNameSpace (const std::string & sNameSpace)
 {
+	m_pModel->increaseRevision();
 	m_pMetaData->setNameSpace(sNameSpace);
 }
 
@@ -68,6 +69,7 @@ std::string CMetaData::GetKey()
 
 void CMetaData::SetName (const std::string & sName)
 {
+	m_pModel->increaseRevision();
 	m_pMetaData->setName(sName);
 }
 
@@ -78,6 +80,7 @@ bool CMetaData::GetMustPreserve ()
 
 void CMetaData::SetMustPreserve (const bool bMustPreserve)
 {
+	m_pModel->increaseRevision();
 	m_pMetaData->setPreserve(bMustPreserve);
 }
 
@@ -88,6 +91,7 @@ std::string CMetaData::GetType ()
 
 void CMetaData::SetType (const std::string & sType)
 {
+	m_pModel->increaseRevision();
 	m_pMetaData->setType(sType);
 }
 
@@ -98,6 +102,7 @@ std::string CMetaData::GetValue ()
 
 void CMetaData::SetValue (const std::string & sValue)
 {
+	m_pModel->increaseRevision();
 	m_pMetaData->setValue(sValue);
 }
 
@@ -41,8 +41,8 @@ using namespace Lib3MF::Impl;
  Class definition of CMetaDataGroup 
 **************************************************************************************************************************/
 
-CMetaDataGroup::CMetaDataGroup(NMR::PModelMetaDataGroup pMetaDataGroup)
-	: m_pModelMetaDataGroup(pMetaDataGroup)
+CMetaDataGroup::CMetaDataGroup(NMR::PModelMetaDataGroup pMetaDataGroup, NMR::CModel * pModel)
+	: m_pModelMetaDataGroup(pMetaDataGroup), m_pModel(pModel)
 {
 
 }
@@ -54,7 +54,7 @@ Lib3MF_uint32 CMetaDataGroup::GetMetaDataCount ()
 
 IMetaData * CMetaDataGroup::GetMetaData (const Lib3MF_uint32 nIndex)
 {
-	return new CMetaData(m_pModelMetaDataGroup->getMetaData(nIndex));
+	return new CMetaData(m_pModelMetaDataGroup->getMetaData(nIndex), m_pModel);
 }
 
 IMetaData * CMetaDataGroup::GetMetaDataByKey (const std::string & sNameSpace, const std::string & sName)
@@ -63,12 +63,12 @@ IMetaData * CMetaDataGroup::GetMetaDataByKey (const std::string & sNameSpace, co
 		NMR::PModelMetaData pMetaData = m_pModelMetaDataGroup->getMetaData(i);
 		if (sNameSpace.empty()) {
 			if (pMetaData->getName() == sName) {
-				return new CMetaData(pMetaData);
+				return new CMetaData(pMetaData, m_pModel);
 			}
 		}
 		else {
 			if (pMetaData->getKey() == sNameSpace + ":" + sName) {
-				return new CMetaData(pMetaData);
+				return new CMetaData(pMetaData, m_pModel);
 			}
 		}
 	}
@@ -77,11 +77,13 @@ IMetaData * CMetaDataGroup::GetMetaDataByKey (const std::string & sNameSpace, co
 
 void CMetaDataGroup::RemoveMetaDataByIndex (const Lib3MF_uint32 nIndex)
 {
+	m_pModel->increaseRevision();
 	m_pModelMetaDataGroup->removeMetaData(nIndex); 
 }
 
 void CMetaDataGroup::RemoveMetaData(IMetaData* pTheMetaData)
 {
+	m_pModel->increaseRevision();
 	for (NMR::nfUint32 i = 0; i < m_pModelMetaDataGroup->getMetaDataCount(); i++) {
 		NMR::PModelMetaData pMetaData = m_pModelMetaDataGroup->getMetaData(i);
 		if (pTheMetaData->GetName() == pMetaData->getName()) {
@@ -94,7 +96,8 @@ void CMetaDataGroup::RemoveMetaData(IMetaData* pTheMetaData)
 
 IMetaData * CMetaDataGroup::AddMetaData(const std::string & sNameSpace, const std::string & sName, const std::string & sValue, const std::string & sType, const bool bMustPreserve)
 {
+	m_pModel->increaseRevision();
 	NMR::PModelMetaData pModelMetaData = m_pModelMetaDataGroup->addMetaData(sNameSpace, sName, sValue, sType, bMustPreserve);
-	return new CMetaData(pModelMetaData);
+	return new CMetaData(pModelMetaData, m_pModel);
 }
 
@@ -36,6 +36,7 @@ Abstract: This is a stub class definition of CModel
 
 #include "lib3mf_builditem.hpp"
 #include "lib3mf_builditemiterator.hpp"
+#include "lib3mf_instancetable.hpp"
 #include "lib3mf_meshobject.hpp"
 #include "lib3mf_objectiterator.hpp"
 #include "lib3mf_meshobjectiterator.hpp"
@@ -82,6 +83,7 @@ Abstract: This is a stub class definition of CModel
 #include "Model/Classes/NMR_ModelFunctionFromImage3D.h"
 #include "Model/Classes/NMR_ModelVolumeData.h"
 #include "Model/Classes/NMR_ModelLevelSetObject.h"
+#include "Model/Classes/NMR_ModelPropertyDeduplicator.h"
 #include "Common/NMR_SecureContentTypes.h"
 #include "lib3mf_utils.hpp"
 
@@ -193,12 +195,12 @@ IResource* CModel::createIResourceFromModelResource(NMR::PModelResource pResourc
 
 IPackagePart* CModel::RootModelPart()
 {
-	return new CPackagePart(model().rootModelPath());
+	return new CPackagePart(model().rootModelPath(), &model());
 }
 
 IPackagePart * CModel::FindOrCreatePackagePart(const std::string & sAbsolutePath)
 {
-	return new CPackagePart(model().findOrCreateModelPath(sAbsolutePath));
+	return new CPackagePart(model().findOrCreateModelPath(sAbsolutePath), &model());
 }
 
 void CModel::SetUnit (const eLib3MFModelUnit eUnit)
@@ -713,7 +715,7 @@ void CModel::RemoveBuildItem (IBuildItem* pBuildItemInstance)
 
 IMetaDataGroup * CModel::GetMetaDataGroup ()
 {
-	return new CMetaDataGroup(model().getMetaDataGroup());
+	return new CMetaDataGroup(model().getMetaDataGroup(), &model());
 }
 
 IAttachment * CModel::AddAttachment (const std::string & sURI, const std::string & sRelationShipType)
@@ -805,10 +807,7 @@ Lib3MF::sBox CModel::GetOutbox()
 	NMR::NOUTBOX3 sOutbox;
 	NMR::fnOutboxInitialize(sOutbox);
 
-	for (NMR::nfUint32 iBuildItem = 0; iBuildItem < model().getBuildItemCount(); iBuildItem++) {
-		auto pBuildItem = model().getBuildItem(iBuildItem);
-		pBuildItem->getObject()->extendOutbox(sOutbox, pBuildItem->getTransform());
-	}
+	model().extendOutbox(sOutbox);
 
 	sBox s;
 	s.m_MinCoordinate[0] = sOutbox.m_min.m_fields[0];
@@ -821,6 +820,11 @@ Lib3MF::sBox CModel::GetOutbox()
 	return s;
 }
 
+IInstanceTable * CModel::GetInstanceTable()
+{
+	return new CInstanceTable(m_model);
+}
+
 IImageStack * CModel::AddImageStack(const Lib3MF_uint32 nSizeX, const Lib3MF_uint32 nSizeY, const Lib3MF_uint32 nSheetCount)
 {
 	NMR::PModelImageStack pResource = NMR::CModelImageStack::make(model().generateResourceID(), &model(), nSizeX, nSizeY, nSheetCount);
@@ -946,3 +950,9 @@ void CModel::RemoveResource(IResource* pResource)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDRESOURCE);
 	model().removeResource(pLib3MFResource->resource());
 }
+
+Lib3MF_uint32 CModel::DeduplicateProperties(const bool bRemoveUnreferenced)
+{
+	NMR::CModelPropertyDeduplicator Deduplicator(&model());
+	return Deduplicator.deduplicate(bRemoveUnreferenced);
+}
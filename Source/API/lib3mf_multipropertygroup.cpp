@@ -32,6 +32,7 @@ Abstract: This is a stub class definition of CMultiPropertyGroup
 #include "lib3mf_interfaceexception.hpp"
 
 // Include custom headers here.
+#include <algorithm>
 
 
 using namespace Lib3MF::Impl;
@@ -86,54 +87,46 @@ void CMultiPropertyGroup::GetAllPropertyIDs (Lib3MF_uint64 nPropertyIDsBufferSiz
 
 Lib3MF_uint32 CMultiPropertyGroup::AddMultiProperty (const Lib3MF_uint64 nPropertyIDsBufferSize, const Lib3MF_uint32 * pPropertyIDsBuffer)
 {
+	resource()->getModel()->increaseRevision();
 	if (nPropertyIDsBufferSize > LIB3MF_MAXMULTIPROPERTIES)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_ELEMENTCOUNTEXCEEDSLIMIT);
 
-	NMR::PModelMultiProperty multiProperty = std::make_shared<NMR::CModelMultiProperty>();
-	multiProperty->resize((size_t)nPropertyIDsBufferSize);
-	for (size_t i = 0; i < (size_t) nPropertyIDsBufferSize; i++) {
-		(*multiProperty)[i] = pPropertyIDsBuffer[i];
-	}
-	return multiPropertyGroup().addMultiProperty(multiProperty);
+	return multiPropertyGroup().addMultiProperty(pPropertyIDsBuffer, (Lib3MF_uint32)nPropertyIDsBufferSize);
 }
 
 void CMultiPropertyGroup::SetMultiProperty (const Lib3MF_uint32 nPropertyID, const Lib3MF_uint64 nPropertyIDsBufferSize, const Lib3MF_uint32 * pPropertyIDsBuffer)
 {
+	resource()->getModel()->increaseRevision();
 	if (nPropertyIDsBufferSize > LIB3MF_MAXMULTIPROPERTIES)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_ELEMENTCOUNTEXCEEDSLIMIT);
 
-	NMR::PModelMultiProperty multiProperty = std::make_shared<NMR::CModelMultiProperty>();
-	multiProperty->resize((size_t)nPropertyIDsBufferSize);
-	for (size_t i = 0; i < (size_t)nPropertyIDsBufferSize; i++) {
-		(*multiProperty)[i] = pPropertyIDsBuffer[i];
-	}
-	multiPropertyGroup().setMultiProperty(nPropertyID, multiProperty);
+	multiPropertyGroup().setMultiProperty(nPropertyID, pPropertyIDsBuffer, (Lib3MF_uint32)nPropertyIDsBufferSize);
 }
 
 void CMultiPropertyGroup::GetMultiProperty (const Lib3MF_uint32 nPropertyID, Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	NMR::PModelMultiProperty multiProperty = multiPropertyGroup().getMultiProperty(nPropertyID);
+	Lib3MF_uint32 nCount;
+	const NMR::ModelPropertyID * pPropertyIDs = multiPropertyGroup().getMultiPropertyIDs(nPropertyID, nCount);
 
 	if (pPropertyIDsNeededCount) {
-		*pPropertyIDsNeededCount = multiProperty->size();
+		*pPropertyIDsNeededCount = nCount;
 	}
 
 	if (pPropertyIDsBuffer) {
 
-		if (nPropertyIDsBufferSize < multiProperty->size())
+		if (nPropertyIDsBufferSize < nCount)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_BUFFERTOOSMALL);
 
 		if (nPropertyIDsBufferSize > LIB3MF_MAXMULTIPROPERTIES)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_ELEMENTCOUNTEXCEEDSLIMIT);
 
-		for (size_t i = 0; i < (size_t)nPropertyIDsBufferSize; i++) {
-			pPropertyIDsBuffer[i] = (*multiProperty)[i];
-		}
+		std::copy(pPropertyIDs, pPropertyIDs + nCount, pPropertyIDsBuffer);
 	}
 }
 
 void CMultiPropertyGroup::RemoveMultiProperty (const Lib3MF_uint32 nPropertyID)
 {
+	resource()->getModel()->increaseRevision();
 	multiPropertyGroup().removeMultiProperty(nPropertyID);
 }
 
@@ -144,6 +137,7 @@ Lib3MF_uint32 CMultiPropertyGroup::GetLayerCount ()
 
 Lib3MF_uint32 CMultiPropertyGroup::AddLayer (const sLib3MFMultiPropertyLayer TheLayer)
 {
+	resource()->getModel()->increaseRevision();
 	return multiPropertyGroup().addLayer(NMR::MODELMULTIPROPERTYLAYER{ TheLayer.m_ResourceID, NMR::eModelBlendMethod(TheLayer.m_TheBlendMethod)});
 }
 
@@ -158,6 +152,7 @@ sLib3MFMultiPropertyLayer CMultiPropertyGroup::GetLayer (const Lib3MF_uint32 nLa
 
 void CMultiPropertyGroup::RemoveLayer (const Lib3MF_uint32 nLayerIndex)
 {
+	resource()->getModel()->increaseRevision();
 	multiPropertyGroup().removeLayer(nLayerIndex);
 }
 
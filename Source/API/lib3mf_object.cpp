@@ -96,6 +96,7 @@ eLib3MFObjectType CObject::GetType ()
 
 void CObject::SetType (const eLib3MFObjectType eObjectType)
 {
+	object()->getModel()->increaseRevision();
 	object()->setObjectType(NMR::eModelObjectType(eObjectType));
 }
 
@@ -106,6 +107,7 @@ std::string CObject::GetName ()
 
 void CObject::SetName (const std::string & sName)
 {
+	object()->getModel()->increaseRevision();
 	object()->setName(sName);
 }
 
@@ -116,6 +118,7 @@ std::string CObject::GetPartNumber ()
 
 void CObject::SetPartNumber (const std::string & sPartNumber)
 {
+	object()->getModel()->increaseRevision();
 	object()->setPartNumber(sPartNumber);
 }
 
@@ -164,6 +167,7 @@ bool CObject::IsValid ()
 
 void CObject::SetAttachmentAsThumbnail(IAttachment* pAttachment)
 {
+	object()->getModel()->increaseRevision();
 	auto pModelAttachment = object()->getModel()->findModelAttachment(pAttachment->GetPath());
 	if (!pModelAttachment) {
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_ATTACHMENTNOTFOUND);
@@ -181,13 +185,14 @@ IAttachment * CObject::GetThumbnailAttachment()
 
 void CObject::ClearThumbnailAttachment()
 {
+	object()->getModel()->increaseRevision();
 	object()->clearThumbnailAttachment();
 }
 
 
 IMetaDataGroup * CObject::GetMetaDataGroup ()
 {
-	return new CMetaDataGroup(object()->metaDataGroup());
+	return new CMetaDataGroup(object()->metaDataGroup(), object()->getModel());
 }
 
 std::string CObject::GetUUID(bool & bHasUUID)
@@ -202,12 +207,14 @@ std::string CObject::GetUUID(bool & bHasUUID)
 
 void CObject::SetUUID(const std::string & sUUID)
 {
+	object()->getModel()->increaseRevision();
 	NMR::PUUID pUUID = std::make_shared<NMR::CUUID>(sUUID);
 	object()->setUUID(pUUID);
 }
 
 void CObject::SetSlicesMeshResolution(const eLib3MFSlicesMeshResolution eMeshResolution)
 {
+	object()->getModel()->increaseRevision();
 	object()->setSlicesMeshResolution(NMR::eModelSlicesMeshResolution(eMeshResolution));
 }
 
@@ -223,6 +230,7 @@ bool CObject::HasSlices(const bool bRecursive)
 
 void CObject::ClearSliceStack()
 {
+	object()->getModel()->increaseRevision();
 	object()->assignSliceStack(nullptr);
 }
 
@@ -237,6 +245,7 @@ ISliceStack * CObject::GetSliceStack()
 
 void CObject::AssignSliceStack(ISliceStack* pSliceStackInstance)
 {
+	object()->getModel()->increaseRevision();
 	NMR::ModelResourceID nID = pSliceStackInstance->GetResourceID();
 	std::shared_ptr<IPackagePart> pPackagePart(pSliceStackInstance->PackagePart());
 	std::string sPath = pPackagePart->GetPath();
@@ -43,8 +43,8 @@ using namespace Lib3MF::Impl;
  Class definition of CPackagePart 
 **************************************************************************************************************************/
 
-CPackagePart::CPackagePart(NMR::PPackageModelPath pPath)
-  : m_pPath(pPath)
+CPackagePart::CPackagePart(NMR::PPackageModelPath pPath, NMR::CModel * pModel)
+  : m_pPath(pPath), m_pModel(pModel)
 {
 	if (!pPath.get())
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -57,5 +57,6 @@ std::string CPackagePart::GetPath()
 
 void CPackagePart::SetPath(const std::string & sPath)
 {
+	m_pModel->increaseRevision();
 	m_pPath->setPath(sPath);
 }
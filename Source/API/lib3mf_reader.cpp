@@ -40,6 +40,7 @@ Abstract: This is a stub class definition of CReader
 #include "Common/NMR_SecureContentTypes.h"
 #include "Common/NMR_SecureContext.h"
 #include "Model/Classes/NMR_KeyStore.h"
+#include "Common/NMR_Statistics.h"
 
 
 using namespace Lib3MF::Impl;
@@ -74,6 +75,8 @@ void CReader::ReadFromFile (const std::string & sFilename)
 {
 	NMR::PImportStream pImportStream = NMR::fnCreateImportStreamInstance(sFilename.c_str());
 
+	// Unmodified parts of the file can be copied verbatim when writing incrementally
+	reader().setSourceFileName(sFilename);
 	try {
 		reader().readStream(pImportStream);
 	}
@@ -228,6 +231,20 @@ void Lib3MF::Impl::CReader::SetContentEncryptionCallback(const Lib3MF::ContentEn
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_CALCULATIONABORTED);
 		return (NMR::nfUint64)result;
 	};
+	descriptor.m_bInPlace = reader().secureContext()->getDekInPlace();
 	reader().secureContext()->setDekCtx(descriptor);
 }
 
+void CReader::SetInPlaceDecryptionActive(const bool bInPlaceDecryptionActive)
+{
+	reader().secureContext()->setDekInPlace(bInPlaceDecryptionActive);
+}
+
+bool CReader::GetInPlaceDecryptionActive()
+{
+	return reader().secureContext()->getDekInPlace();
+}
+
+std::string CReader::GetStatistics() {
+	return reader().statistics()->toJSON();
+}
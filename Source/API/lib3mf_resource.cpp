@@ -97,11 +97,12 @@ IObject * CResource::AsObject()
 
 IPackagePart * CResource::PackagePart()
 {
-	return new CPackagePart(m_pResource->getPackageResourceID()->getPackageModelPath());
+	return new CPackagePart(m_pResource->getPackageResourceID()->getPackageModelPath(), m_pResource->getModel());
 }
 
 void CResource::SetPackagePart(IPackagePart* pPackagePart)
 {
+	m_pResource->getModel()->increaseRevision();
 	std::string sPath = pPackagePart->GetPath();
 	NMR::ModelResourceID nID = m_pResource->getPackageResourceID()->getModelResourceID();
 	NMR::PPackageResourceID pTargetPackageResourceID = m_pResource->getModel()->findPackageResourceID(sPath, nID);
@@ -6,8 +6,8 @@
 
 namespace Lib3MF {
 	namespace Impl {
-		Lib3MF::Impl::CResourceData::CResourceData(NMR::PKeyStoreResourceData resourceData) 
-			:m_pResourceData(resourceData)
+		Lib3MF::Impl::CResourceData::CResourceData(NMR::PKeyStoreResourceData resourceData, NMR::CModel * pModel) 
+			:m_pResourceData(resourceData), m_pModel(pModel)
 		{
 			if (!resourceData)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -23,7 +23,7 @@ namespace Lib3MF {
 		}
 
 		IPackagePart * CResourceData::GetPath() {
-			return new CPackagePart(m_pResourceData->packagePath());
+			return new CPackagePart(m_pResourceData->packagePath(), m_pModel);
 		}
 
 		void CResourceData::GetAdditionalAuthenticationData(Lib3MF_uint64 nByteDataBufferSize, Lib3MF_uint64 * pByteDataNeededCount, Lib3MF_uint8 * pByteDataBuffer) {
@@ -9,14 +9,15 @@
 #include "Model/Classes/NMR_KeyStoreFactory.h"
 namespace Lib3MF {
 	namespace Impl {
-		CResourceDataGroup::CResourceDataGroup(NMR::PKeyStoreResourceDataGroup const & dg) 
-		: m_pDataGroup(dg)
+		CResourceDataGroup::CResourceDataGroup(NMR::PKeyStoreResourceDataGroup const & dg, NMR::CModel * pModel) 
+		: m_pDataGroup(dg), m_pModel(pModel)
 		{
 			if (!dg)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 		}
 
 		IAccessRight * CResourceDataGroup::AddAccessRight(IConsumer * pConsumer, const Lib3MF::eWrappingAlgorithm eWrappingAlgorithm, const Lib3MF::eMgfAlgorithm eMgfAlgorithm, const Lib3MF::eDigestMethod eDigestMethod) {
+			m_pModel->increaseRevision();
 			CConsumer * c = dynamic_cast<CConsumer *>(pConsumer);
 			if (nullptr == c)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -37,6 +38,7 @@ namespace Lib3MF {
 		}
 
 		void CResourceDataGroup::RemoveAccessRight(IConsumer * pConsumerInstance) {
+			m_pModel->increaseRevision();
 			m_pDataGroup->removeAccessRight(pConsumerInstance->GetConsumerID());
 		}
 
@@ -48,6 +48,7 @@ Lib3MF::Impl::CResourceIdNode::CResourceIdNode(
 
 void CResourceIdNode::SetResource(IResource* pResource)
 {
+	increaseRevision();
 	m_pImplicitNode->setModelResourceID(pResource->GetModelResourceID());
 }
 
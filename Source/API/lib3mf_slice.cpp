@@ -40,14 +40,15 @@ using namespace Lib3MF::Impl;
  Class definition of CSlice 
 **************************************************************************************************************************/
 
-CSlice::CSlice(NMR::PSlice pSlice)
-	:m_pSlice(pSlice)
+CSlice::CSlice(NMR::PSlice pSlice, NMR::CModel * pModel)
+	:m_pSlice(pSlice), m_pModel(pModel)
 {
 	
 }
 
 void CSlice::SetVertices (const Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition2D * pVerticesBuffer)
 {
+	m_pModel->increaseRevision();
 	m_pSlice->Clear();
 	for (Lib3MF_uint64 index = 0; index < nVerticesBufferSize; index++) {
 		m_pSlice->addVertex(pVerticesBuffer->m_Coordinates[0], pVerticesBuffer->m_Coordinates[1]);
@@ -79,6 +80,7 @@ Lib3MF_uint64 CSlice::GetVertexCount ()
 
 Lib3MF_uint64 CSlice::AddPolygon(const Lib3MF_uint64 nIndicesBufferSize, const Lib3MF_uint32 * pIndicesBuffer)
 {
+	m_pModel->increaseRevision();
 	Lib3MF_uint32 index = m_pSlice->beginPolygon();
 	SetPolygonIndices(index, nIndicesBufferSize, pIndicesBuffer);
 	return index;
@@ -91,6 +93,7 @@ Lib3MF_uint64 CSlice::GetPolygonCount ()
 
 void CSlice::SetPolygonIndices (const Lib3MF_uint64 nIndex, const Lib3MF_uint64 nIndicesBufferSize, const Lib3MF_uint32 * pIndicesBuffer)
 {
+	m_pModel->increaseRevision();
 	m_pSlice->clearPolygon(NMR::nfUint32(nIndex));
 
 	for (Lib3MF_uint64 i=0; i< nIndicesBufferSize; i++)
@@ -42,7 +42,7 @@ using namespace Lib3MF::Impl;
 **************************************************************************************************************************/
 
 CSliceStack::CSliceStack(NMR::PModelSliceStack pSliceStack):
-	CResource(pSliceStack)
+	CResource(pSliceStack), m_bHasLayerReports(false), m_nLayerReportsRevision(0)
 {
 }
 
@@ -64,13 +64,14 @@ Lib3MF_uint64 CSliceStack::GetSliceCount ()
 ISlice * CSliceStack::GetSlice (const Lib3MF_uint64 nSliceIndex)
 {
 	NMR::PSlice pSlice = sliceStack()->getSlice(Lib3MF_uint32(nSliceIndex));
-	return new CSlice(pSlice);
+	return new CSlice(pSlice, resource()->getModel());
 }
 
 ISlice * CSliceStack::AddSlice (const double fZTop)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::PSlice pSlice = sliceStack()->AddSlice(fZTop);
-	return new CSlice(pSlice);
+	return new CSlice(pSlice, resource()->getModel());
 }
 
 Lib3MF_uint64 CSliceStack::GetSliceRefCount()
@@ -80,6 +81,7 @@ Lib3MF_uint64 CSliceStack::GetSliceRefCount()
 
 void CSliceStack::AddSliceStackReference(ISliceStack* pTheSliceStack)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::ModelResourceID nID = pTheSliceStack->GetResourceID();
 	
 	std::shared_ptr<IPackagePart> pPackagePart(pTheSliceStack->PackagePart());
@@ -101,11 +103,13 @@ ISliceStack * CSliceStack::GetSliceStackReference(const Lib3MF_uint64 nSliceRefI
 
 void CSliceStack::CollapseSliceReferences()
 {
+	resource()->getModel()->increaseRevision();
 	sliceStack()->CollapseSliceReferences();
 }
 
 void CSliceStack::SetOwnPath(const std::string & sPath)
 {
+	resource()->getModel()->increaseRevision();
 	sliceStack()->SetOwnPath(sPath);
 }
 
@@ -114,3 +118,65 @@ std::string CSliceStack::GetOwnPath()
 	return sliceStack()->OwnPath();
 }
 
+Lib3MF_uint64 CSliceStack::GetTotalSliceCount()
+{
+	return sliceStack()->getTotalSliceCount();
+}
+
+ISlice * CSliceStack::GetTotalSlice(const Lib3MF_uint64 nTotalSliceIndex)
+{
+	NMR::PSlice pSlice = sliceStack()->getTotalSlice(nTotalSliceIndex);
+	return new CSlice(pSlice, resource()->getModel());
+}
+
+bool CSliceStack::FindSliceAtZ(const Lib3MF_double dZValue, Lib3MF_uint64 & nTotalSliceIndex)
+{
+	NMR::nfUint64 nIndex = 0;
+	if (!sliceStack()->findTotalSliceAtZ(dZValue, nIndex))
+		return false;
+
+	nTotalSliceIndex = nIndex;
+	return true;
+}
+
+void CSliceStack::GetSliceRange(const Lib3MF_double dZMin, const Lib3MF_double dZMax, Lib3MF_uint64 & nFirstIndex, Lib3MF_uint64 & nCount)
+{
+	NMR::nfUint64 nFirst = 0;
+	NMR::nfUint64 nSliceCount = 0;
+	sliceStack()->getTotalSliceRange(dZMin, dZMax, nFirst, nSliceCount);
+
+	nFirstIndex = nFirst;
+	nCount = nSliceCount;
+}
+
+void CSliceStack::ValidatePolygons(Lib3MF_uint64 nLayerReportsBufferSize, Lib3MF_uint64* pLayerReportsNeededCount, Lib3MF::sSliceLayerReport * pLayerReportsBuffer)
+{
+	// Callers query the report count first and fill their buffer in a second call, which reuses the reports
+	// of the first one, unless the model has been modified in between
+	NMR::nfUint64 nRevision = sliceStack()->getModel()->getRevision();
+	if (!m_bHasLayerReports || (m_nLayerReportsRevision != nRevision)) {
+		NMR::CModelSliceValidator Validator(NMR_MODELSLICEVALIDATOR_CHECKALL);
+		Validator.validateStack(sliceStack().get(), m_LayerReports);
+		m_bHasLayerReports = true;
+		m_nLayerReportsRevision = nRevision;
+	}
+
+	Lib3MF_uint64 nReportCount = m_LayerReports.size();
+	if (pLayerReportsNeededCount)
+		*pLayerReportsNeededCount = nReportCount;
+
+	if (nLayerReportsBufferSize >= nReportCount && pLayerReportsBuffer)
+	{
+		for (size_t nIndex = 0; nIndex < m_LayerReports.size(); nIndex++) {
+			const NMR::MODELSLICELAYERREPORT & Report = m_LayerReports[nIndex];
+			pLayerReportsBuffer[nIndex].m_LayerIndex = Report.m_nLayerIndex;
+			pLayerReportsBuffer[nIndex].m_OpenPolygons = Report.m_nOpenPolygons;
+			pLayerReportsBuffer[nIndex].m_DegeneratePolygons = Report.m_nDegeneratePolygons;
+			pLayerReportsBuffer[nIndex].m_SelfIntersections = Report.m_nSelfIntersections;
+			pLayerReportsBuffer[nIndex].m_OrientationErrors = Report.m_nOrientationErrors;
+			pLayerReportsBuffer[nIndex].m_MaxNestingDepth = Report.m_nMaxNestingDepth;
+		}
+		m_LayerReports.clear();
+		m_bHasLayerReports = false;
+	}
+}
@@ -63,6 +63,7 @@ IAttachment * CTexture2D::GetAttachment ()
 
 void CTexture2D::SetAttachment (IAttachment* pAttachment)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::PModelAttachment attachment = texture()->getModel()->findModelAttachment(pAttachment->GetPath());
 	texture()->setAttachment(attachment);
 }
@@ -74,6 +75,7 @@ eLib3MFTextureType CTexture2D::GetContentType ()
 
 void CTexture2D::SetContentType (const eLib3MFTextureType eContentType)
 {
+	resource()->getModel()->increaseRevision();
 	texture()->setContentType(NMR::eModelTexture2DType(eContentType));
 }
 
@@ -85,6 +87,7 @@ void CTexture2D::GetTileStyleUV (eLib3MFTextureTileStyle & eTileStyleU, eLib3MFT
 
 void CTexture2D::SetTileStyleUV (const eLib3MFTextureTileStyle eTileStyleU, const eLib3MFTextureTileStyle eTileStyleV)
 {
+	resource()->getModel()->increaseRevision();
 	texture()->setTileStyleU(NMR::eModelTextureTileStyle(eTileStyleU));
 	texture()->setTileStyleV(NMR::eModelTextureTileStyle(eTileStyleV));
 }
@@ -96,6 +99,7 @@ eLib3MFTextureFilter CTexture2D::GetFilter ()
 
 void CTexture2D::SetFilter (const eLib3MFTextureFilter eFilter)
 {
+	resource()->getModel()->increaseRevision();
 	texture()->setFilter(NMR::eModelTextureFilter(eFilter));
 }
 
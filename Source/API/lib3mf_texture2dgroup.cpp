@@ -90,6 +90,7 @@ void CTexture2DGroup::GetAllPropertyIDs (Lib3MF_uint64 nPropertyIDsBufferSize, L
 
 Lib3MF_uint32 CTexture2DGroup::AddTex2Coord (const sLib3MFTex2Coord UVCoordinate)
 {
+	resource()->getModel()->increaseRevision();
 	return texture2DGroup().addUVCoordinate(NMR::MODELTEXTURE2DCOORDINATE({ UVCoordinate.m_U, UVCoordinate.m_V }));
 }
 
@@ -101,6 +102,44 @@ sLib3MFTex2Coord CTexture2DGroup::GetTex2Coord (const Lib3MF_uint32 nPropertyID)
 
 void CTexture2DGroup::RemoveTex2Coord(const Lib3MF_uint32 nPropertyID)
 {
+	resource()->getModel()->increaseRevision();
 	texture2DGroup().removePropertyID(nPropertyID);
 }
 
+void CTexture2DGroup::GetAllTex2Coords(Lib3MF_uint64 nUVCoordinatesBufferSize, Lib3MF_uint64* pUVCoordinatesNeededCount, sLib3MFTex2Coord * pUVCoordinatesBuffer)
+{
+	Lib3MF_uint32 nCount = texture2DGroup().getCount();
+
+	if (pUVCoordinatesNeededCount)
+		*pUVCoordinatesNeededCount = nCount;
+
+	if (nUVCoordinatesBufferSize >= nCount && pUVCoordinatesBuffer) {
+		std::vector<NMR::MODELTEXTURE2DCOORDINATE> UVCoordinates(nCount);
+		texture2DGroup().getAllUVCoordinates(UVCoordinates.data());
+
+		for (const NMR::MODELTEXTURE2DCOORDINATE & coord : UVCoordinates) {
+			pUVCoordinatesBuffer->m_U = coord.m_dU;
+			pUVCoordinatesBuffer->m_V = coord.m_dV;
+			pUVCoordinatesBuffer++;
+		}
+	}
+}
+
+void CTexture2DGroup::SetAllTex2Coords(const Lib3MF_uint64 nUVCoordinatesBufferSize, const sLib3MFTex2Coord * pUVCoordinatesBuffer)
+{
+	resource()->getModel()->increaseRevision();
+	Lib3MF_uint32 nCount = texture2DGroup().getCount();
+
+	if (nUVCoordinatesBufferSize != nCount)
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPROPERTYCOUNT);
+	if ((pUVCoordinatesBuffer == nullptr) && (nCount > 0))
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+
+	std::vector<NMR::MODELTEXTURE2DCOORDINATE> UVCoordinates(nCount);
+	for (Lib3MF_uint32 nIndex = 0; nIndex < nCount; nIndex++) {
+		UVCoordinates[nIndex].m_dU = pUVCoordinatesBuffer[nIndex].m_U;
+		UVCoordinates[nIndex].m_dV = pUVCoordinatesBuffer[nIndex].m_V;
+	}
+
+	texture2DGroup().setAllUVCoordinates(UVCoordinates.data(), nCount);
+}
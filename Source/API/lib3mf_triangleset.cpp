@@ -55,6 +55,7 @@ CTriangleSet::~CTriangleSet()
 
 void CTriangleSet::SetName(const std::string& sName)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	m_pTriangleSet->setName(sName);
 }
 
@@ -65,6 +66,7 @@ std::string CTriangleSet::GetName()
 
 void CTriangleSet::SetIdentifier(const std::string& sIdentifier)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	m_pTriangleSet->setIdentifier(sIdentifier);
 }
 
@@ -75,21 +77,25 @@ std::string CTriangleSet::GetIdentifier()
 
 void CTriangleSet::AddTriangle(const Lib3MF_uint32 nTriangleIndex)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	m_pTriangleSet->addTriangle(nTriangleIndex);
 }
 
 void CTriangleSet::RemoveTriangle(const Lib3MF_uint32 nTriangleIndex)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	m_pTriangleSet->removeTriangle(nTriangleIndex);
 }
 
 void CTriangleSet::Clear()
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	m_pTriangleSet->clear();
 }
 
 void CTriangleSet::SetTriangleList(const Lib3MF_uint64 nTriangleIndicesBufferSize, const Lib3MF_uint32* pTriangleIndicesBuffer)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (pTriangleIndicesBuffer) {
 		m_pTriangleSet->clear();
 		const uint32_t* pPtr = pTriangleIndicesBuffer;
@@ -120,6 +126,7 @@ void CTriangleSet::GetTriangleList(Lib3MF_uint64 nTriangleIndicesBufferSize, Lib
 
 void CTriangleSet::AddTriangleList(const Lib3MF_uint64 nTriangleIndicesBufferSize, const Lib3MF_uint32* pTriangleIndicesBuffer)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (pTriangleIndicesBuffer) {
 		const uint32_t* pPtr = pTriangleIndicesBuffer;
 		for (uint64_t nIndex = 0; nIndex < nTriangleIndicesBufferSize; nIndex++) {
@@ -132,6 +139,7 @@ void CTriangleSet::AddTriangleList(const Lib3MF_uint64 nTriangleIndicesBufferSiz
 
 void CTriangleSet::Merge(ITriangleSet* pOtherTriangleSet, const bool bDeleteOther)
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	if (pOtherTriangleSet == nullptr)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
@@ -147,6 +155,7 @@ void CTriangleSet::Merge(ITriangleSet* pOtherTriangleSet, const bool bDeleteOthe
 
 void CTriangleSet::DeleteSet()
 {
+	m_pMeshObject->getModel()->increaseRevision();
 	m_pMeshObject->deleteTriangleSet (m_pTriangleSet.get ());
 }
 
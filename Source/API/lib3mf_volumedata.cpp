@@ -65,20 +65,22 @@ IVolumeDataComposite * CVolumeData::GetComposite()
 	if (!pComposite) {
 		return nullptr;
 	}
-	return new CVolumeDataComposite(pComposite);
+	return new CVolumeDataComposite(pComposite, resource()->getModel());
 }
 
 IVolumeDataComposite * CVolumeData::CreateNewComposite()
 {
+	resource()->getModel()->increaseRevision();
 	auto pComposite = m_pVolumeData->createComposite();
 	if (!pComposite) {
 		return nullptr;
 	}
-	return new CVolumeDataComposite(pComposite);
+	return new CVolumeDataComposite(pComposite, resource()->getModel());
 }
 
 void CVolumeData::RemoveComposite()
 {
+	resource()->getModel()->increaseRevision();
 	m_pVolumeData->removeComposite();
 }
 
@@ -88,11 +90,12 @@ IVolumeDataColor * CVolumeData::GetColor()
 	if (!pColor) {
 		return nullptr;
 	}
-	return new CVolumeDataColor(pColor);
+	return new CVolumeDataColor(pColor, resource()->getModel());
 }
 
 void CVolumeData::RemoveColor()
 {
+	resource()->getModel()->increaseRevision();
 	m_pVolumeData->removeColor();
 }
 
@@ -107,11 +110,12 @@ IVolumeDataProperty * CVolumeData::GetProperty(const Lib3MF_uint32 nIndex)
 	if (!pProperty) {
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 	}
-	return new CVolumeDataProperty(pProperty);
+	return new CVolumeDataProperty(pProperty, resource()->getModel());
 }
 
 void CVolumeData::RemoveProperty(const Lib3MF_uint32 nIndex)
 {
+	resource()->getModel()->increaseRevision();
 	auto pProperty = m_pVolumeData->getProperty(nIndex);
 	if (!pProperty)
 		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
@@ -122,6 +126,7 @@ void CVolumeData::RemoveProperty(const Lib3MF_uint32 nIndex)
 IVolumeDataColor* Lib3MF::Impl::CVolumeData::CreateNewColor(
     IFunction* pTheFunction)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::CModel* pModel = m_pVolumeData->getModel();
 
 	NMR::PModelResource pResource = pModel->findResource(pTheFunction->GetUniqueResourceID());
@@ -137,11 +142,12 @@ IVolumeDataColor* Lib3MF::Impl::CVolumeData::CreateNewColor(
 	{
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 	}
-	return new CVolumeDataColor(pColor);
+	return new CVolumeDataColor(pColor, resource()->getModel());
 }
 
 IVolumeDataProperty * Lib3MF::Impl::CVolumeData::AddPropertyFromFunction(const std::string & sName, IFunction * pTheFunction)
 {
+	resource()->getModel()->increaseRevision();
 	NMR::CModel* pModel = m_pVolumeData->getModel();
 
 	NMR::PModelResource pResource = pModel->findResource(pTheFunction->GetUniqueResourceID());
@@ -157,5 +163,5 @@ IVolumeDataProperty * Lib3MF::Impl::CVolumeData::AddPropertyFromFunction(const s
 	{
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 	}
-	return new CVolumeDataProperty(pProperty);
+	return new CVolumeDataProperty(pProperty, resource()->getModel());
 }
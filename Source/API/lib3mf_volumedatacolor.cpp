@@ -40,8 +40,8 @@ using namespace Lib3MF::Impl;
  Class definition of CVolumeDataColor 
 **************************************************************************************************************************/
 
-CVolumeDataColor::CVolumeDataColor(NMR::PVolumeDataColor pColor)
-	: CFunctionReference(pColor)
+CVolumeDataColor::CVolumeDataColor(NMR::PVolumeDataColor pColor, NMR::CModel * pModel)
+	: CFunctionReference(pColor, pModel)
 {
 
 }
@@ -39,8 +39,8 @@ using namespace Lib3MF::Impl;
  Class definition of CVolumeDataComposite 
 **************************************************************************************************************************/
 
-CVolumeDataComposite::CVolumeDataComposite(NMR::PVolumeDataComposite pComposite):
-	m_pVolumeDataComposite(pComposite)
+CVolumeDataComposite::CVolumeDataComposite(NMR::PVolumeDataComposite pComposite, NMR::CModel * pModel):
+	m_pVolumeDataComposite(pComposite), m_pModel(pModel)
 {
 	
 }
@@ -59,6 +59,7 @@ IBaseMaterialGroup * CVolumeDataComposite::GetBaseMaterialGroup()
 
 void CVolumeDataComposite::SetBaseMaterialGroup(IBaseMaterialGroup* pBaseMaterialGroupInstance)
 {
+	m_pModel->increaseRevision();
 	throw ELib3MFInterfaceException(LIB3MF_ERROR_NOTIMPLEMENTED);
 }
 
@@ -74,11 +75,13 @@ IMaterialMapping * CVolumeDataComposite::GetMaterialMapping(const Lib3MF_uint32
 
 IMaterialMapping * CVolumeDataComposite::AddMaterialMapping(const Lib3MF::sTransform Transform)
 {
+	m_pModel->increaseRevision();
 	throw ELib3MFInterfaceException(LIB3MF_ERROR_NOTIMPLEMENTED);
 }
 
 void CVolumeDataComposite::RemoveMaterialMapping(const Lib3MF_uint32 nIndex)
 {
+	m_pModel->increaseRevision();
 	throw ELib3MFInterfaceException(LIB3MF_ERROR_NOTIMPLEMENTED);
 }
 
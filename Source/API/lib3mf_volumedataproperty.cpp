@@ -40,8 +40,8 @@ using namespace Lib3MF::Impl;
  Class definition of CVolumeDataProperty 
 **************************************************************************************************************************/
 
-CVolumeDataProperty::CVolumeDataProperty(NMR::PVolumeDataProperty pProperty)
-	: CFunctionReference(pProperty)
+CVolumeDataProperty::CVolumeDataProperty(NMR::PVolumeDataProperty pProperty, NMR::CModel * pModel)
+	: CFunctionReference(pProperty, pModel)
 {
 }
 
@@ -60,6 +60,7 @@ std::string CVolumeDataProperty::GetName()
 
 void CVolumeDataProperty::SetIsRequired(const bool bIsRequired)
 {
+	m_pModel->increaseRevision();
 	asVolumeDataProperty()->setIsRequired(bIsRequired);
 }
 
@@ -36,12 +36,12 @@ Abstract: This is a stub class definition of CWriter
 #include "lib3mf_contentencryptionparams.hpp"
 #include "Common/Platform/NMR_Platform.h"
 #include "Common/Platform/NMR_ExportStream_Callback.h"
-#include "Common/Platform/NMR_ExportStream_Memory.h"
-#include "Common/Platform/NMR_ExportStream_Dummy.h"
+#include "Common/Platform/NMR_ExportStream_Cache.h"
 #include "Common/NMR_SecureContentTypes.h"
 #include "Common/NMR_SecureContext.h"
 #include "Model/Classes/NMR_KeyStore.h"
 #include "Common/NMR_ModelWarnings.h"
+#include "Common/NMR_Statistics.h"
 
 
 
@@ -54,6 +54,8 @@ using namespace Lib3MF::Impl;
 CWriter::CWriter(std::string sWriterClass, NMR::PModel model)
 {
 	m_pWriter = nullptr;
+	m_nCachedRevision = 0;
+	m_bHasProgressCallback = false;
 
 	// Create specified writer instance
 	if (sWriterClass.compare("3mf") == 0) {
@@ -72,10 +74,8 @@ NMR::CModelWriter& CWriter::writer()
 	return *m_pWriter;
 }
 
-void CWriter::WriteToFile (const std::string & sFilename)
+void CWriter::exportToStream(NMR::PExportStream pStream)
 {
-	setlocale(LC_ALL, "C");
-	NMR::PExportStream pStream = NMR::fnCreateExportStreamInstance(sFilename.c_str());
 	try {
 		writer().exportToStream(pStream);
 	}
@@ -89,56 +89,132 @@ void CWriter::WriteToFile (const std::string & sFilename)
 	}
 }
 
-Lib3MF_uint64 CWriter::GetStreamSize ()
+void CWriter::exportForCache(NMR::PExportStream pStream)
 {
-	// Write to a special dummy stream just to calculate the size
-	NMR::PExportStreamDummy pStream = std::make_shared<NMR::CExportStreamDummy>();
-	try {
-		writer().exportToStream(pStream);
-	}
-	catch (NMR::CNMRException&e) {
-		if (e.getErrorCode() == NMR_USERABORTED) {
-			throw ELib3MFInterfaceException(LIB3MF_ERROR_CALCULATIONABORTED);
-		} else if (e.getErrorCode() == NMR_ERROR_DEKDESCRIPTORNOTFOUND
-			|| e.getErrorCode() == NMR_ERROR_KEKDESCRIPTORNOTFOUND) {
-			throw ELib3MFInterfaceException(LIB3MF_ERROR_SECURECONTEXTNOTREGISTERED);
-		} else throw e;
+	NMR::PModelWarnings pWarnings = writer().warnings();
+	NMR::nfUint32 nWarningCount = pWarnings->getWarningCount();
+
+	exportToStream(pStream);
+
+	m_CachedWarnings.clear();
+	for (NMR::nfUint32 nIndex = nWarningCount; nIndex < pWarnings->getWarningCount(); nIndex++)
+		m_CachedWarnings.push_back(pWarnings->getWarning(nIndex));
+}
+
+NMR::PExportStreamCache CWriter::exportToCache()
+{
+	// Large packages move to the temporary directory, as they are kept until the next write
+	NMR::PExportStreamCache pStream = std::make_shared<NMR::CExportStreamCache>();
+	exportForCache(pStream);
+	return pStream;
+}
+
+NMR::PExportStreamCache CWriter::fetchCachedExport()
+{
+	// A cached package is handed out once, and only if the model has not been modified since
+	NMR::PExportStreamCache pStream = m_pCachedExport;
+	m_pCachedExport = nullptr;
+	if (!pStream || !pStream->isReplayable() || (m_nCachedRevision != writer().model()->getRevision()))
+		return nullptr;
+
+	// Writing the cached package counts as an export of its own, so its warnings are reported again
+	for (auto pWarning : m_CachedWarnings)
+		writer().warnings()->addWarning(pWarning);
+	return pStream;
+}
+
+void CWriter::storeCachedExport(NMR::PExportStreamCache pStream)
+{
+	if (m_bHasProgressCallback) {
+		m_pCachedExport = nullptr;
+		return;
 	}
+	m_pCachedExport = pStream;
+	m_nCachedRevision = writer().model()->getRevision();
+}
 
-	return pStream->getDataSize();
+void CWriter::writeCachedExport(NMR::PExportStreamCache pCachedExport, NMR::CExportStream * pStream)
+{
+	NMR_STATISTICS_RESUME(writer().statistics().get());
+	NMR_STATISTICS_PHASE(NMR::PROGRESS_WRITEMODELSTOSTREAM);
+	NMR_STATISTICS_ADD(NMR::escBytesOut, pCachedExport->getDataSize());
+	pCachedExport->copyToStream(pStream);
 }
 
-#include <cstring>
+void CWriter::writeCachedExport(NMR::PExportStreamCache pCachedExport, Lib3MF_uint8 * pBuffer)
+{
+	NMR_STATISTICS_RESUME(writer().statistics().get());
+	NMR_STATISTICS_PHASE(NMR::PROGRESS_WRITEMODELSTOSTREAM);
+	NMR_STATISTICS_ADD(NMR::escBytesOut, pCachedExport->getDataSize());
+	if (pCachedExport->getDataSize() > 0)
+		pCachedExport->copyToBuffer(pBuffer, pCachedExport->getDataSize());
+}
 
-void CWriter::WriteToBuffer(Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer)
+void CWriter::WriteToFile (const std::string & sFilename)
 {
-	NMR::PExportStreamMemory pStream;
-	if (!momentBuffer || momentBuffer->getDataSize() > nBufferBufferSize) {
-		pStream = std::make_shared<NMR::CExportStreamMemory>();
+	setlocale(LC_ALL, "C");
+	NMR::PExportStreamCache pCachedExport = fetchCachedExport();
+	if (!pCachedExport && writer().GetIncrementalModeActive()) {
+		// Parts are copied from the file the model was read from, which might be the target file.
+		// The temporary file is created next to the target, so that it can be moved onto it.
+		std::string sTempFilename = NMR::fnCreateUniqueFile(sFilename + ".", false);
 		try {
-			writer().exportToStream(pStream);
-		} catch (NMR::CNMRException&e) {
-			if (e.getErrorCode() == NMR_USERABORTED) {
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_CALCULATIONABORTED);
-			} else if (e.getErrorCode() == NMR_ERROR_DEKDESCRIPTORNOTFOUND
-				|| e.getErrorCode() == NMR_ERROR_KEKDESCRIPTORNOTFOUND) {
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_SECURECONTEXTNOTREGISTERED);
-			} else throw e;
+			NMR::PExportStream pStream = NMR::fnCreateExportStreamInstance(sTempFilename.c_str());
+			exportToStream(pStream);
 		}
-	} else {
-		pStream = momentBuffer;
+		catch (...) {
+			NMR::fnDeleteFile(sTempFilename.c_str());
+			throw;
+		}
+		NMR::fnReplaceFile(sTempFilename.c_str(), sFilename.c_str());
+		return;
 	}
 
+	NMR::PExportStream pStream = NMR::fnCreateExportStreamInstance(sFilename.c_str());
+	if (pCachedExport)
+		writeCachedExport(pCachedExport, pStream.get());
+	else
+		exportToStream(pStream);
+}
+
+Lib3MF_uint64 CWriter::GetStreamSize ()
+{
+	// Keep the package, as it is usually written right after its size was queried
+	NMR::PExportStreamCache pStream = fetchCachedExport();
+	if (!pStream)
+		pStream = exportToCache();
+	storeCachedExport(pStream);
+
+	return pStream->getDataSize();
+}
+
+void CWriter::WriteToBuffer(Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer)
+{
+	NMR::PExportStreamCache pCachedExport = fetchCachedExport();
+	if (pCachedExport) {
+		Lib3MF_uint64 cbCachedSize = pCachedExport->getDataSize();
+		if (pBufferNeededCount)
+			*pBufferNeededCount = cbCachedSize;
+		if (nBufferBufferSize >= cbCachedSize)
+			writeCachedExport(pCachedExport, pBufferBuffer);
+		else
+			storeCachedExport(pCachedExport);
+		return;
+	}
+
+	// The package is returned in memory anyway, so it is never moved to the temporary directory
+	NMR::PExportStreamMemory pStream = std::make_shared<NMR::CExportStreamMemory>();
+	exportForCache(pStream);
+
 	Lib3MF_uint64 cbStreamSize = pStream->getDataSize();
 	if (pBufferNeededCount)
 		*pBufferNeededCount = cbStreamSize;
 
 	if (nBufferBufferSize >= cbStreamSize) {
-		// TODO eliminate this copy, perhaps by allowing CExportStreamMemory to use existing buffers
-		memcpy(pBufferBuffer, pStream->getData(), static_cast<size_t>(cbStreamSize));
-		momentBuffer.reset();
+		if (cbStreamSize > 0)
+			pStream->copyToBuffer(pBufferBuffer, cbStreamSize);
 	} else {
-		momentBuffer = pStream;
+		storeCachedExport(std::make_shared<NMR::CExportStreamCache>(pStream));
 	}
 }
 
@@ -159,6 +235,12 @@ void CWriter::WriteToCallback(const Lib3MFWriteCallback pTheWriteCallback, const
 	};
 
 	NMR::PExportStream pStream = std::make_shared<NMR::CExportStream_Callback>(lambdaWriteCallback, lambdaSeekCallback, pUserData);
+	NMR::PExportStreamCache pCachedExport = fetchCachedExport();
+	if (pCachedExport) {
+		writeCachedExport(pCachedExport, pStream.get());
+		return;
+	}
+
 	try {
 		writer().exportToStream(pStream);
 	}
@@ -172,6 +254,8 @@ void CWriter::WriteToCallback(const Lib3MFWriteCallback pTheWriteCallback, const
 
 void CWriter::SetProgressCallback(const Lib3MFProgressCallback callback, const Lib3MF_pvoid pUserData)
 {
+	m_pCachedExport = nullptr;
+	m_bHasProgressCallback = (callback != nullptr);
 	NMR::Lib3MFProgressCallback lambdaCallback = 
 		[callback](int progressStep, NMR::ProgressIdentifier identifier, void* pUserData)
 		{
@@ -189,10 +273,12 @@ Lib3MF_uint32 CWriter::GetDecimalPrecision()
 
 void CWriter::SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision)
 {
+	m_pCachedExport = nullptr;
 	m_pWriter->SetDecimalPrecision(nDecimalPrecision);
 }
 
 void Lib3MF::Impl::CWriter::AddKeyWrappingCallback(const std::string & sConsumerID, const Lib3MF::KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData){
+	m_pCachedExport = nullptr;
 	NMR::KeyWrappingDescriptor descriptor;
 	descriptor.m_sKekDecryptData.m_pUserData = pUserData;
 	descriptor.m_fnWrap =
@@ -229,6 +315,7 @@ void Lib3MF::Impl::CWriter::AddKeyWrappingCallback(const std::string & sConsumer
 
 void Lib3MF::Impl::CWriter::SetContentEncryptionCallback(const Lib3MF::ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData)
 {
+	m_pCachedExport = nullptr;
 	NMR::ContentEncryptionDescriptor descriptor;
 	descriptor.m_sDekDecryptData.m_pUserData = pUserData;
 	descriptor.m_fnCrypt = [this, pTheCallback](
@@ -250,6 +337,7 @@ void Lib3MF::Impl::CWriter::SetContentEncryptionCallback(const Lib3MF::ContentEn
 }
 
 void CWriter::SetStrictModeActive(const bool bStrictModeActive) {
+	m_pCachedExport = nullptr;
 	if (bStrictModeActive)
 		writer().warnings()->setCriticalWarningLevel(NMR::mrwInvalidOptionalValue);
 	else
@@ -260,6 +348,15 @@ bool CWriter::GetStrictModeActive() {
 	return writer().warnings()->getCriticalWarningLevel() == NMR::mrwInvalidOptionalValue;
 }
 
+void CWriter::SetIncrementalModeActive(const bool bIncrementalModeActive) {
+	m_pCachedExport = nullptr;
+	writer().SetIncrementalModeActive(bIncrementalModeActive);
+}
+
+bool CWriter::GetIncrementalModeActive() {
+	return writer().GetIncrementalModeActive();
+}
+
 std::string CWriter::GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode) {
 	auto warning = writer().warnings()->getWarning(nIndex);
 	nErrorCode = warning->getErrorCode();
@@ -268,4 +365,8 @@ std::string CWriter::GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErr
 
 Lib3MF_uint32 CWriter::GetWarningCount() {
 	return writer().warnings()->getWarningCount();
+}
+
+std::string CWriter::GetStatistics() {
+	return writer().statistics()->toJSON();
 }
\ No newline at end of file
@@ -30,57 +30,114 @@ Abstract: Progress Monitor
 
 #include "Common/3MF_ProgressMonitor.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_Statistics.h"
 
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <chrono>
+
+namespace NMR {
+
+	// Threads are assigned to shards round robin, when they first increment progress
+	static unsigned int fnGetProgressShardIndex()
+	{
+		static std::atomic<unsigned int> s_nNextShardIndex(0);
+		static thread_local unsigned int s_nShardIndex = s_nNextShardIndex.fetch_add(1, std::memory_order_relaxed) % PROGRESS_SHARDCOUNT;
+		return s_nShardIndex;
+	}
+
+	static long long fnGetProgressTimeInMilliseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static void fnAtomicAddDouble(std::atomic<double> & dTarget, double dIncrement)
+	{
+		double dValue = dTarget.load(std::memory_order_relaxed);
+		while (!dTarget.compare_exchange_weak(dValue, dValue + dIncrement, std::memory_order_relaxed))
+			;
+	}
+
+}
 
 NMR::CProgressMonitor::CProgressMonitor()
 {
 	m_progressCallback = nullptr;
 	m_userData = nullptr;
 	m_lastCallbackResult = true;
-	m_dProgress = 0;
+	for (auto & shard : m_Shards)
+		shard.m_dValue.store(0.0);
 	m_dProgressMax = 1;
 	m_eProgressIdentifier = ProgressIdentifier::PROGRESS_QUERYCANCELED;
+	m_nReportedPhases = 0;
+	m_nNextCallbackTime = 0;
+	m_CallbackThread = std::this_thread::get_id();
+	m_bCancelled = false;
 }
 
-bool NMR::CProgressMonitor::QueryCancelled(bool throwIfCancelled)
+double NMR::CProgressMonitor::getProgress()
 {
-	if (m_progressCallback)
+	double dProgress = 0.0;
+	for (auto & shard : m_Shards)
+		dProgress += shard.m_dValue.load(std::memory_order_relaxed);
+	return std::min(dProgress, m_dProgressMax.load(std::memory_order_relaxed));
+}
+
+bool NMR::CProgressMonitor::invokeCallback(ProgressIdentifier identifier, bool throwIfCancelled)
+{
+	// Worker threads never invoke the callback, they only observe a cancellation
+	if (!m_bCancelled.load(std::memory_order_acquire) && m_progressCallback && (std::this_thread::get_id() == m_CallbackThread.load(std::memory_order_relaxed)))
 	{
-		std::unique_lock<std::mutex> lock(m_callbackMutex, std::try_to_lock);
-		if (lock) // If another progress callback is happening right _now_, just drop this one
+		// Writers switch between the object, node and triangle phases for every object, so only the
+		// first report of a phase bypasses the throttling. Cancellation queries never do.
+		std::uint32_t nPhaseBit = 0;
+		if ((identifier != ProgressIdentifier::PROGRESS_QUERYCANCELED) && ((unsigned int)identifier < 32))
+			nPhaseBit = 1u << (unsigned int)identifier;
+		bool bIsNewPhase = (nPhaseBit != 0) && ((m_nReportedPhases & nPhaseBit) == 0);
+
+		long long nNow = fnGetProgressTimeInMilliseconds();
+		if (bIsNewPhase || (nNow >= m_nNextCallbackTime))
 		{
-			int nProgress = (int)(100 * m_dProgress / m_dProgressMax);
-			m_lastCallbackResult = m_progressCallback(nProgress, ProgressIdentifier::PROGRESS_QUERYCANCELED, m_userData);
-
-			if (throwIfCancelled && m_lastCallbackResult)
-				throw CNMRException(NMR_USERABORTED);
+			m_nReportedPhases |= nPhaseBit;
+			m_nNextCallbackTime = nNow + PROGRESS_CALLBACKINTERVAL_MS;
 
-			return m_lastCallbackResult;
+			int nProgress = (int)(100 * getProgress() / m_dProgressMax.load(std::memory_order_relaxed));
+			m_lastCallbackResult = m_progressCallback(nProgress, identifier, m_userData);
+			if (m_lastCallbackResult)
+				m_bCancelled.store(true, std::memory_order_release);
 		}
 	}
-	return false;
+
+	bool bCancelled = m_bCancelled.load(std::memory_order_acquire);
+	if (throwIfCancelled && bCancelled)
+		throw CNMRException(NMR_USERABORTED);
+
+	return bCancelled;
 }
 
-bool NMR::CProgressMonitor::ReportProgressAndQueryCancelled(bool throwIfCancelled)
+bool NMR::CProgressMonitor::IsCancelled()
 {
-	if (m_progressCallback)
-	{
-		std::unique_lock<std::mutex> lock(m_callbackMutex, std::try_to_lock);
-		if (lock) // If another progress callback is happening right _now_, just drop this one
-		{
-			int nProgress = (int)(100 * m_dProgress / m_dProgressMax);
-			m_lastCallbackResult = m_progressCallback(nProgress, m_eProgressIdentifier, m_userData);
+	return m_bCancelled.load(std::memory_order_acquire);
+}
 
-			if (throwIfCancelled && m_lastCallbackResult)
-				throw CNMRException(NMR_USERABORTED);
+void NMR::CProgressMonitor::ResetCancelled()
+{
+	m_CallbackThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+	m_nReportedPhases = 0;
+	m_nNextCallbackTime = 0;
+	m_lastCallbackResult = true;
+	m_bCancelled.store(false, std::memory_order_release);
+}
 
-			return m_lastCallbackResult;
-		}
-	}
-	return false;
+bool NMR::CProgressMonitor::QueryCancelled(bool throwIfCancelled)
+{
+	return invokeCallback(ProgressIdentifier::PROGRESS_QUERYCANCELED, throwIfCancelled);
+}
+
+bool NMR::CProgressMonitor::ReportProgressAndQueryCancelled(bool throwIfCancelled)
+{
+	return invokeCallback(m_eProgressIdentifier.load(std::memory_order_relaxed), throwIfCancelled);
 }
 
 bool NMR::CProgressMonitor::WasAborted()
@@ -90,29 +147,27 @@ bool NMR::CProgressMonitor::WasAborted()
 
 void NMR::CProgressMonitor::SetProgressIdentifier(ProgressIdentifier identifier)
 {
-	m_eProgressIdentifier = identifier;
+	m_eProgressIdentifier.store(identifier, std::memory_order_relaxed);
+	NMR_STATISTICS_PHASE(identifier);
 }
 
 void NMR::CProgressMonitor::SetMaxProgress(double dProgressMax)
 {
-	m_dProgressMax = dProgressMax;
+	m_dProgressMax.store(dProgressMax, std::memory_order_relaxed);
 }
 
 void NMR::CProgressMonitor::DecreaseMaxProgress(double dMaxProgressDecrement)
 {
-	m_dProgressMax = std::max(m_dProgressMax - dMaxProgressDecrement, 1.0);
-	m_dProgress = std::min(m_dProgressMax, m_dProgress);
+	// Progress beyond the maximum is clamped when it is read
+	double dProgressMax = m_dProgressMax.load(std::memory_order_relaxed);
+	while (!m_dProgressMax.compare_exchange_weak(dProgressMax, std::max(dProgressMax - dMaxProgressDecrement, 1.0), std::memory_order_relaxed))
+		;
 }
 
 void NMR::CProgressMonitor::IncrementProgress(double dProgressIncrement)
 {
 	if (m_progressCallback)
-	{
-		{
-			std::unique_lock<std::mutex> lock(m_callbackMutex, std::try_to_lock);
-			m_dProgress = std::min(m_dProgressMax, m_dProgress + dProgressIncrement);
-		}
-	}
+		fnAtomicAddDouble(m_Shards[fnGetProgressShardIndex()].m_dValue, dProgressIncrement);
 }
 
 void NMR::CProgressMonitor::SetProgressCallback(Lib3MFProgressCallback callback, void * userData)
@@ -120,6 +175,10 @@ void NMR::CProgressMonitor::SetProgressCallback(Lib3MFProgressCallback callback,
 	m_progressCallback = callback;
 	m_userData = userData;
 	m_lastCallbackResult = true;
+	m_nReportedPhases = 0;
+	m_nNextCallbackTime = 0;
+	m_CallbackThread = std::this_thread::get_id();
+	m_bCancelled = false;
 }
 
 void NMR::CProgressMonitor::ClearProgressCallback()
@@ -130,4 +130,46 @@ namespace NMR::common::graph
         }
         return topologicalOrder;
     }
+
+    VertexList topologicalSort(const SparseDirectedGraph & graph)
+    {
+        auto const size = graph.getSize();
+
+        std::vector<std::size_t> remainingDependencies(size);
+        VertexList topologicalOrder;
+        topologicalOrder.reserve(size);
+        for (Identifier id = 0u; id < static_cast<Identifier>(size); ++id)
+        {
+            remainingDependencies[id] = graph.getDependencyCount(id);
+            if (remainingDependencies[id] == 0)
+            {
+                topologicalOrder.push_back(id);
+            }
+        }
+
+        // topologicalOrder doubles as the queue of vertices whose dependencies are resolved
+        for (std::size_t head = 0; head < topologicalOrder.size(); ++head)
+        {
+            auto const id = topologicalOrder[head];
+            for (auto pDependent = graph.getDependentsBegin(id); pDependent != graph.getDependentsEnd(id); ++pDependent)
+            {
+                if (--remainingDependencies[*pDependent] == 0)
+                {
+                    topologicalOrder.push_back(*pDependent);
+                }
+            }
+        }
+
+        // Vertices on a cycle never lose all their dependencies
+        if (topologicalOrder.size() != size)
+        {
+            return {};
+        }
+        return topologicalOrder;
+    }
+
+    bool isCyclic(const SparseDirectedGraph & graph)
+    {
+        return (graph.getSize() > 0) && topologicalSort(graph).empty();
+    }
 } // namespace gladius::nodes::graph
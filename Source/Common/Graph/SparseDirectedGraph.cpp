@@ -0,0 +1,137 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+SparseDirectedGraph.cpp implements a directed graph in CSR layout.
+
+--*/
+
+#include "Common/Graph/SparseDirectedGraph.h"
+#include "Common/NMR_Exception.h"
+
+namespace NMR::common::graph
+{
+    SparseDirectedGraph::SparseDirectedGraph(std::size_t const size)
+        : m_size(size), m_bIsCompressed(false)
+    {
+    }
+
+    void SparseDirectedGraph::addDependency(Identifier id,
+                                            Identifier idOfDependency)
+    {
+        if((id >= m_size) || (idOfDependency >= m_size))
+        {
+            throw CNMRException(NMR_ERROR_INVALIDPARAM);
+        }
+        if(id == idOfDependency)
+        {
+            return;
+        }
+        m_edges.push_back(std::make_pair(idOfDependency, id));
+        m_bIsCompressed = false;
+    }
+
+    void SparseDirectedGraph::compress() const
+    {
+        if(m_bIsCompressed)
+        {
+            return;
+        }
+
+        // Counting sort of the edges by dependency, which keeps the insertion
+        // order of the dependents of each vertex
+        m_dependentOffsets.assign(m_size + 1, 0);
+        m_dependencyCounts.assign(m_size, 0);
+        for(auto const & edge : m_edges)
+        {
+            m_dependentOffsets[edge.first + 1]++;
+            m_dependencyCounts[edge.second]++;
+        }
+        for(std::size_t index = 0; index < m_size; ++index)
+        {
+            m_dependentOffsets[index + 1] += m_dependentOffsets[index];
+        }
+
+        m_dependents.resize(m_edges.size());
+        std::vector<std::size_t> position(m_dependentOffsets.begin(),
+                                          m_dependentOffsets.end() - 1);
+        for(auto const & edge : m_edges)
+        {
+            m_dependents[position[edge.first]++] = edge.second;
+        }
+
+        m_bIsCompressed = true;
+    }
+
+    bool SparseDirectedGraph::isDirectlyDependingOn(
+        Identifier id, Identifier dependencyInQuestion) const
+    {
+        if((id >= m_size) || (dependencyInQuestion >= m_size))
+        {
+            return false;
+        }
+        for(auto pDependent = getDependentsBegin(dependencyInQuestion);
+            pDependent != getDependentsEnd(dependencyInQuestion); ++pDependent)
+        {
+            if(*pDependent == id)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t SparseDirectedGraph::getSize() const
+    {
+        return m_size;
+    }
+
+    std::size_t SparseDirectedGraph::getEdgeCount() const
+    {
+        return m_edges.size();
+    }
+
+    std::size_t SparseDirectedGraph::getDependencyCount(Identifier id) const
+    {
+        compress();
+        return m_dependencyCounts.at(id);
+    }
+
+    const Identifier * SparseDirectedGraph::getDependentsBegin(
+        Identifier id) const
+    {
+        compress();
+        return m_dependents.data() + m_dependentOffsets.at(id);
+    }
+
+    const Identifier * SparseDirectedGraph::getDependentsEnd(
+        Identifier id) const
+    {
+        compress();
+        return m_dependents.data() + m_dependentOffsets.at(id + 1);
+    }
+}  // namespace NMR::common::graph
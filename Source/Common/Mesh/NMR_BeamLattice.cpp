@@ -31,6 +31,9 @@ NMR_MeshBeamLattice.cpp implements the class CMeshBeamLattice.
 --*/
 
 #include "Common/Mesh/NMR_BeamLattice.h" 
+#include "Common/NMR_Exception.h"
+
+#define NMR_BEAMLATTICE_LENGTHBATCHSIZE 256
 
 namespace NMR {
 
@@ -39,12 +42,22 @@ namespace NMR {
 		m_dMinLength = 0.0001;
 		m_eBallMode = eModelBeamLatticeBallMode::MODELBEAMLATTICEBALLMODE_NONE;
 		m_dDefaultBallRadius = 0.0;
+		m_nOccupiedNodeCount = 0;
+	}
+
+	static nfUint32 fnCountBits(_In_ nfUint64 nValue)
+	{
+		nValue = nValue - ((nValue >> 1) & 0x5555555555555555ULL);
+		nValue = (nValue & 0x3333333333333333ULL) + ((nValue >> 2) & 0x3333333333333333ULL);
+		nValue = (nValue + (nValue >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (nfUint32)((nValue * 0x0101010101010101ULL) >> 56);
 	}
 
 	void CBeamLattice::clearBeams() {
 		m_Beams.clearAllData();
 		m_pBeamSets.clear();
 		m_OccupiedNodes.clear();
+		m_nOccupiedNodeCount = 0;
 	}
 
 	void CBeamLattice::clearBalls() {
@@ -56,4 +69,110 @@ namespace NMR {
 		clearBalls();
 	}
 
+	void CBeamLattice::markNodeOccupied(_In_ nfUint32 nNodeIndex)
+	{
+		size_t nWord = nNodeIndex / 64;
+		nfUint64 nMask = 1ULL << (nNodeIndex % 64);
+
+		if (nWord >= m_OccupiedNodes.size())
+			m_OccupiedNodes.resize(nWord + 1, 0);
+
+		if ((m_OccupiedNodes[nWord] & nMask) == 0) {
+			m_OccupiedNodes[nWord] |= nMask;
+			m_nOccupiedNodeCount++;
+		}
+	}
+
+	nfBool CBeamLattice::isNodeOccupied(_In_ nfUint32 nNodeIndex)
+	{
+		size_t nWord = nNodeIndex / 64;
+		if (nWord >= m_OccupiedNodes.size())
+			return false;
+
+		return (m_OccupiedNodes[nWord] & (1ULL << (nNodeIndex % 64))) != 0;
+	}
+
+	nfUint32 CBeamLattice::getOccupiedNodeCount()
+	{
+		return m_nOccupiedNodeCount;
+	}
+
+	nfUint32 CBeamLattice::getOccupiedNodeIndex(_In_ nfUint32 nIdx)
+	{
+		if (nIdx >= m_nOccupiedNodeCount)
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+		// Skip whole words until the word containing the requested bit is reached
+		nfUint32 nRemaining = nIdx;
+		for (size_t nWord = 0; nWord < m_OccupiedNodes.size(); nWord++) {
+			nfUint64 nBits = m_OccupiedNodes[nWord];
+			nfUint32 nWordCount = fnCountBits(nBits);
+			if (nRemaining < nWordCount) {
+				for (nfUint32 nBit = 0; nBit < 64; nBit++) {
+					if (nBits & (1ULL << nBit)) {
+						if (nRemaining == 0)
+							return (nfUint32)(nWord * 64 + nBit);
+						nRemaining--;
+					}
+				}
+			}
+			nRemaining -= nWordCount;
+		}
+
+		throw CNMRException(NMR_ERROR_INVALIDINDEX);
+	}
+
+	void CBeamLattice::getOccupiedNodeIndices(_Out_ std::vector<nfUint32> & nodeIndices)
+	{
+		nodeIndices.clear();
+		nodeIndices.reserve(m_nOccupiedNodeCount);
+
+		for (size_t nWord = 0; nWord < m_OccupiedNodes.size(); nWord++) {
+			nfUint64 nBits = m_OccupiedNodes[nWord];
+			for (nfUint32 nBit = 0; nBits != 0; nBit++, nBits >>= 1) {
+				if (nBits & 1)
+					nodeIndices.push_back((nfUint32)(nWord * 64 + nBit));
+			}
+		}
+	}
+
+	nfUint32 CBeamLattice::countBeamsBelowMinLength(_In_ nfUint32 nFirstBeam)
+	{
+		nfUint32 nBeamCount = m_Beams.getCount();
+		nfUint32 nNodeCount = m_Nodes.getCount();
+		nfDouble dMinLengthSquared = m_dMinLength * m_dMinLength;
+		nfUint32 nTooShort = 0;
+
+		// Endpoints are gathered in batches, so that the length computation runs as a
+		// plain loop over contiguous arrays that the compiler can vectorize.
+		nfFloat aDeltaX[NMR_BEAMLATTICE_LENGTHBATCHSIZE];
+		nfFloat aDeltaY[NMR_BEAMLATTICE_LENGTHBATCHSIZE];
+		nfFloat aDeltaZ[NMR_BEAMLATTICE_LENGTHBATCHSIZE];
+
+		for (nfUint32 nBatchStart = nFirstBeam; nBatchStart < nBeamCount; nBatchStart += NMR_BEAMLATTICE_LENGTHBATCHSIZE) {
+			nfUint32 nBatchSize = nBeamCount - nBatchStart;
+			if (nBatchSize > NMR_BEAMLATTICE_LENGTHBATCHSIZE)
+				nBatchSize = NMR_BEAMLATTICE_LENGTHBATCHSIZE;
+
+			for (nfUint32 nIdx = 0; nIdx < nBatchSize; nIdx++) {
+				MESHBEAM & beam = m_Beams.getDataRef(nBatchStart + nIdx);
+				if (((nfUint32)beam.m_nodeindices[0] >= nNodeCount) || ((nfUint32)beam.m_nodeindices[1] >= nNodeCount))
+					throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
+
+				NVEC3 & vPosition1 = m_Nodes.getDataRef(beam.m_nodeindices[0]).m_position;
+				NVEC3 & vPosition2 = m_Nodes.getDataRef(beam.m_nodeindices[1]).m_position;
+				aDeltaX[nIdx] = vPosition1.m_values.x - vPosition2.m_values.x;
+				aDeltaY[nIdx] = vPosition1.m_values.y - vPosition2.m_values.y;
+				aDeltaZ[nIdx] = vPosition1.m_values.z - vPosition2.m_values.z;
+			}
+
+			for (nfUint32 nIdx = 0; nIdx < nBatchSize; nIdx++) {
+				nfDouble dLengthSquared = (nfDouble)aDeltaX[nIdx] * aDeltaX[nIdx] + (nfDouble)aDeltaY[nIdx] * aDeltaY[nIdx] + (nfDouble)aDeltaZ[nIdx] * aDeltaZ[nIdx];
+				nTooShort += (dLengthSquared < dMinLengthSquared) ? 1 : 0;
+			}
+		}
+
+		return nTooShort;
+	}
+
 }
@@ -0,0 +1,471 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_BeamLatticeTessellator.cpp implements the class CBeamLatticeTessellator.
+
+The tessellation runs in two parallel passes. The first pass computes the segment count
+and the number of vertices and triangles of every beam and ball. A prefix sum over these
+counts yields the output offsets, so that the second pass can write all items into the
+preallocated target mesh concurrently.
+
+--*/
+
+#include "Common/Mesh/NMR_BeamLatticeTessellator.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_Parallel.h"
+
+#include <cmath>
+
+#define NMR_BEAMLATTICETESSELLATOR_PI 3.14159265358979323846
+
+namespace NMR {
+
+	typedef struct {
+		nfDouble m_Center[3];
+		nfDouble m_dRadius;
+	} BEAMLATTICERING;
+
+	typedef struct {
+		nfInt32 m_nNodeIndex;
+		nfDouble m_dRadius;
+	} BEAMLATTICEBALL;
+
+	typedef struct {
+		nfUint32 m_nSegments;
+		nfUint32 m_nNodeCount;
+		nfUint32 m_nFaceCount;
+	} BEAMLATTICEITEMSIZE;
+
+	// Vertex and triangle counts of a stack of rings closed by two apex vertices
+	static nfUint32 fnStackNodeCount(_In_ nfUint32 nRingCount, _In_ nfUint32 nSegments)
+	{
+		return nRingCount * nSegments + 2;
+	}
+
+	static nfUint32 fnStackFaceCount(_In_ nfUint32 nRingCount, _In_ nfUint32 nSegments)
+	{
+		return 2 * nRingCount * nSegments;
+	}
+
+	static void fnSetNode(_In_ CMesh * pMesh, _In_ nfUint32 nNodeIndex, _In_ const nfDouble * pPosition)
+	{
+		MESHNODE * pNode = pMesh->getNode(nNodeIndex);
+		pNode->m_position.m_values.x = (nfFloat)pPosition[0];
+		pNode->m_position.m_values.y = (nfFloat)pPosition[1];
+		pNode->m_position.m_values.z = (nfFloat)pPosition[2];
+	}
+
+	static void fnSetFace(_In_ CMesh * pMesh, _In_ nfUint32 nFaceIndex, _In_ nfUint32 nNode1, _In_ nfUint32 nNode2, _In_ nfUint32 nNode3)
+	{
+		MESHFACE * pFace = pMesh->getFace(nFaceIndex);
+		pFace->m_nodeindices[0] = (nfInt32)nNode1;
+		pFace->m_nodeindices[1] = (nfInt32)nNode2;
+		pFace->m_nodeindices[2] = (nfInt32)nNode3;
+	}
+
+	// Emits a closed stack of rings. The rings are ordered along the axis U x V, the triangles
+	// are oriented counter-clockwise when seen from outside.
+	static void fnEmitStack(_In_ CMesh * pMesh, _In_ const BEAMLATTICEUNITCIRCLE & circle, _In_ nfUint32 nSegments,
+		_In_ const nfDouble * pU, _In_ const nfDouble * pV, _In_ const std::vector<BEAMLATTICERING> & rings,
+		_In_ const nfDouble * pBottom, _In_ const nfDouble * pTop, _Inout_ nfUint32 & nNodeIndex, _Inout_ nfUint32 & nFaceIndex)
+	{
+		nfUint32 nRingCount = (nfUint32)rings.size();
+		nfUint32 nBottom = nNodeIndex;
+		nfUint32 nFirstRing = nBottom + 1;
+		nfUint32 nTop = nFirstRing + nRingCount * nSegments;
+		nfUint32 nRing, nSegment, j;
+		nfDouble vPosition[3];
+
+		fnSetNode(pMesh, nBottom, pBottom);
+		for (nRing = 0; nRing < nRingCount; nRing++) {
+			const BEAMLATTICERING & ring = rings[nRing];
+			for (nSegment = 0; nSegment < nSegments; nSegment++) {
+				nfDouble dCos = circle.m_Cos[nSegment] * ring.m_dRadius;
+				nfDouble dSin = circle.m_Sin[nSegment] * ring.m_dRadius;
+				for (j = 0; j < 3; j++)
+					vPosition[j] = ring.m_Center[j] + dCos * pU[j] + dSin * pV[j];
+				fnSetNode(pMesh, nFirstRing + nRing * nSegments + nSegment, vPosition);
+			}
+		}
+		fnSetNode(pMesh, nTop, pTop);
+
+		for (nSegment = 0; nSegment < nSegments; nSegment++) {
+			nfUint32 nNext = (nSegment + 1) % nSegments;
+
+			fnSetFace(pMesh, nFaceIndex++, nBottom, nFirstRing + nNext, nFirstRing + nSegment);
+
+			for (nRing = 0; nRing + 1 < nRingCount; nRing++) {
+				nfUint32 nLower = nFirstRing + nRing * nSegments;
+				nfUint32 nUpper = nLower + nSegments;
+				fnSetFace(pMesh, nFaceIndex++, nLower + nSegment, nLower + nNext, nUpper + nNext);
+				fnSetFace(pMesh, nFaceIndex++, nLower + nSegment, nUpper + nNext, nUpper + nSegment);
+			}
+
+			nfUint32 nLast = nFirstRing + (nRingCount - 1) * nSegments;
+			fnSetFace(pMesh, nFaceIndex++, nLast + nSegment, nLast + nNext, nTop);
+		}
+
+		nNodeIndex = nTop + 1;
+	}
+
+	// Emits a closed sphere. Its latitudes are spaced like the segments of the unit circle.
+	static void fnEmitSphere(_In_ CMesh * pMesh, _In_ const BEAMLATTICEUNITCIRCLE & circle, _In_ nfUint32 nSegments,
+		_In_ const nfDouble * pU, _In_ const nfDouble * pV, _In_ const nfDouble * pAxis, _In_ const nfDouble * pCenter, _In_ nfDouble dRadius,
+		_Inout_ std::vector<BEAMLATTICERING> & rings, _Inout_ nfUint32 & nNodeIndex, _Inout_ nfUint32 & nFaceIndex)
+	{
+		nfUint32 nBands = nSegments / 2;
+		nfDouble vBottom[3], vTop[3];
+		nfUint32 j;
+
+		rings.clear();
+		for (nfUint32 nLatitude = 1; nLatitude < nBands; nLatitude++) {
+			// Latitude angle is nLatitude * 2pi / nSegments - pi / 2
+			nfDouble dSin = -circle.m_Cos[nLatitude];
+			BEAMLATTICERING ring;
+			for (j = 0; j < 3; j++)
+				ring.m_Center[j] = pCenter[j] + pAxis[j] * dRadius * dSin;
+			ring.m_dRadius = dRadius * circle.m_Sin[nLatitude];
+			rings.push_back(ring);
+		}
+
+		for (j = 0; j < 3; j++) {
+			vBottom[j] = pCenter[j] - pAxis[j] * dRadius;
+			vTop[j] = pCenter[j] + pAxis[j] * dRadius;
+		}
+
+		fnEmitStack(pMesh, circle, nSegments, pU, pV, rings, vBottom, vTop, nNodeIndex, nFaceIndex);
+	}
+
+	// Appends the rings of a hemisphere, which starts at the equator ring of pCenter and
+	// bulges along dDirection * pAxis. The equator ring itself is not added.
+	static void fnAddHemisphereRings(_In_ const BEAMLATTICEUNITCIRCLE & circle, _In_ nfUint32 nSegments,
+		_In_ const nfDouble * pAxis, _In_ const nfDouble * pCenter, _In_ nfDouble dRadius, _In_ nfDouble dDirection,
+		_Inout_ std::vector<BEAMLATTICERING> & rings)
+	{
+		nfUint32 nBands = nSegments / 4;
+		for (nfUint32 nBand = 1; nBand < nBands; nBand++) {
+			nfUint32 nLatitude = (dDirection > 0) ? nBand : nBands - nBand;
+			BEAMLATTICERING ring;
+			for (nfUint32 j = 0; j < 3; j++)
+				ring.m_Center[j] = pCenter[j] + pAxis[j] * dRadius * circle.m_Sin[nLatitude] * dDirection;
+			ring.m_dRadius = dRadius * circle.m_Cos[nLatitude];
+			rings.push_back(ring);
+		}
+	}
+
+	// Returns an orthonormal basis U, V of the plane orthogonal to pAxis, with U x V = pAxis
+	static void fnOrthonormalBasis(_In_ const nfDouble * pAxis, _Out_ nfDouble * pU, _Out_ nfDouble * pV)
+	{
+		// Cross the axis with the coordinate axis it is least aligned with
+		nfDouble vHelper[3] = { 0.0, 0.0, 0.0 };
+		nfUint32 nMin = 0;
+		for (nfUint32 j = 1; j < 3; j++)
+			if (fabs(pAxis[j]) < fabs(pAxis[nMin]))
+				nMin = j;
+		vHelper[nMin] = 1.0;
+
+		pU[0] = pAxis[1] * vHelper[2] - pAxis[2] * vHelper[1];
+		pU[1] = pAxis[2] * vHelper[0] - pAxis[0] * vHelper[2];
+		pU[2] = pAxis[0] * vHelper[1] - pAxis[1] * vHelper[0];
+		nfDouble dLength = sqrt(pU[0] * pU[0] + pU[1] * pU[1] + pU[2] * pU[2]);
+		pU[0] /= dLength;
+		pU[1] /= dLength;
+		pU[2] /= dLength;
+
+		pV[0] = pAxis[1] * pU[2] - pAxis[2] * pU[1];
+		pV[1] = pAxis[2] * pU[0] - pAxis[0] * pU[2];
+		pV[2] = pAxis[0] * pU[1] - pAxis[1] * pU[0];
+	}
+
+	static void fnGetPosition(_In_ CMesh * pMesh, _In_ nfInt32 nNodeIndex, _Out_ nfDouble * pPosition)
+	{
+		MESHNODE * pNode = pMesh->getNode(nNodeIndex);
+		pPosition[0] = pNode->m_position.m_values.x;
+		pPosition[1] = pNode->m_position.m_values.y;
+		pPosition[2] = pNode->m_position.m_values.z;
+	}
+
+	CBeamLatticeTessellator::CBeamLatticeTessellator(_In_ CMesh * pMesh)
+	{
+		if (!pMesh)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_pMesh = pMesh;
+		m_dAccuracy = 0.0;
+		m_nThreadCount = 0;
+	}
+
+	void CBeamLatticeTessellator::setAccuracy(_In_ nfDouble dAccuracy)
+	{
+		m_dAccuracy = dAccuracy;
+	}
+
+	nfDouble CBeamLatticeTessellator::getAccuracy()
+	{
+		return m_dAccuracy;
+	}
+
+	void CBeamLatticeTessellator::setThreadCount(_In_ nfUint32 nThreadCount)
+	{
+		m_nThreadCount = nThreadCount;
+	}
+
+	nfUint32 CBeamLatticeTessellator::getThreadCount()
+	{
+		return m_nThreadCount;
+	}
+
+	nfUint32 CBeamLatticeTessellator::segmentsForRadius(_In_ nfDouble dRadius, _In_ nfDouble dAccuracy)
+	{
+		if (dAccuracy <= 0.0)
+			return NMR_BEAMLATTICETESSELLATOR_DEFAULTSEGMENTS;
+		if (dRadius <= dAccuracy)
+			return NMR_BEAMLATTICETESSELLATOR_MINSEGMENTS;
+
+		// The chord of a segment with half angle a deviates by r * (1 - cos a) from the circle
+		nfDouble dHalfAngle = acos(1.0 - dAccuracy / dRadius);
+		nfDouble dSegments = ceil(NMR_BEAMLATTICETESSELLATOR_PI / dHalfAngle);
+		if (dSegments >= NMR_BEAMLATTICETESSELLATOR_MAXSEGMENTS)
+			return NMR_BEAMLATTICETESSELLATOR_MAXSEGMENTS;
+
+		nfUint32 nSegments = ((nfUint32)dSegments + 3) & ~3u;
+		if (nSegments < NMR_BEAMLATTICETESSELLATOR_MINSEGMENTS)
+			return NMR_BEAMLATTICETESSELLATOR_MINSEGMENTS;
+		return nSegments;
+	}
+
+	void CBeamLatticeTessellator::buildUnitCircles()
+	{
+		if (!m_UnitCircles.empty())
+			return;
+
+		m_UnitCircles.resize(NMR_BEAMLATTICETESSELLATOR_MAXSEGMENTS / 4 + 1);
+		for (nfUint32 nSegments = NMR_BEAMLATTICETESSELLATOR_MINSEGMENTS; nSegments <= NMR_BEAMLATTICETESSELLATOR_MAXSEGMENTS; nSegments += 4) {
+			BEAMLATTICEUNITCIRCLE & circle = m_UnitCircles[nSegments / 4];
+			circle.m_Cos.resize(nSegments);
+			circle.m_Sin.resize(nSegments);
+			for (nfUint32 nSegment = 0; nSegment < nSegments; nSegment++) {
+				nfDouble dAngle = 2.0 * NMR_BEAMLATTICETESSELLATOR_PI * nSegment / nSegments;
+				circle.m_Cos[nSegment] = cos(dAngle);
+				circle.m_Sin[nSegment] = sin(dAngle);
+			}
+		}
+	}
+
+	void CBeamLatticeTessellator::tessellate(_In_ CMesh * pTargetMesh)
+	{
+		if ((!pTargetMesh) || (pTargetMesh == m_pMesh))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		buildUnitCircles();
+
+		nfDouble dAccuracy = m_dAccuracy;
+		if (dAccuracy <= 0.0) {
+			if (!m_pMesh->getBeamLatticeAccuracy(dAccuracy))
+				dAccuracy = 0.0;
+		}
+
+		// Collect balls, depending on the ball mode
+		std::vector<BEAMLATTICEBALL> balls;
+		eModelBeamLatticeBallMode eBallMode = m_pMesh->getBeamLatticeBallMode();
+		nfUint32 nBallCount = m_pMesh->getBallCount();
+		if (eBallMode == MODELBEAMLATTICEBALLMODE_MIXED) {
+			balls.reserve(nBallCount);
+			for (nfUint32 nIndex = 0; nIndex < nBallCount; nIndex++) {
+				MESHBALL * pBall = m_pMesh->getBall(nIndex);
+				balls.push_back({ pBall->m_nodeindex, pBall->m_radius });
+			}
+		}
+		else if (eBallMode == MODELBEAMLATTICEBALLMODE_ALL) {
+			// Every occupied node carries a ball, explicit balls only override the radius
+			std::vector<nfDouble> radii(m_pMesh->getNodeCount(), m_pMesh->getDefaultBallRadius());
+			for (nfUint32 nIndex = 0; nIndex < nBallCount; nIndex++) {
+				MESHBALL * pBall = m_pMesh->getBall(nIndex);
+				radii[pBall->m_nodeindex] = pBall->m_radius;
+			}
+
+			std::vector<nfUint32> occupiedNodes;
+			m_pMesh->getOccupiedNodeIndices(occupiedNodes);
+			balls.reserve(occupiedNodes.size());
+			for (auto iIterator = occupiedNodes.begin(); iIterator != occupiedNodes.end(); iIterator++)
+				balls.push_back({ (nfInt32)*iIterator, radii[*iIterator] });
+		}
+
+		// Pass 1: sizes of all beams, followed by all balls
+		nfUint32 nBeamCount = m_pMesh->getBeamCount();
+		nfUint32 nItemCount = nBeamCount + (nfUint32)balls.size();
+		std::vector<BEAMLATTICEITEMSIZE> sizes(nItemCount);
+
+		fnParallelFor(nItemCount, m_nThreadCount, NMR_BEAMLATTICETESSELLATOR_MINITEMSPERTHREAD, [&](nfUint32 nBegin, nfUint32 nEnd) {
+			nfDouble vPosition1[3], vPosition2[3];
+			for (nfUint32 nItem = nBegin; nItem < nEnd; nItem++) {
+				BEAMLATTICEITEMSIZE & size = sizes[nItem];
+				if (nItem < nBeamCount) {
+					MESHBEAM * pBeam = m_pMesh->getBeam(nItem);
+					fnGetPosition(m_pMesh, pBeam->m_nodeindices[0], vPosition1);
+					fnGetPosition(m_pMesh, pBeam->m_nodeindices[1], vPosition2);
+					if ((vPosition1[0] == vPosition2[0]) && (vPosition1[1] == vPosition2[1]) && (vPosition1[2] == vPosition2[2])) {
+						// Degenerate beams have no axis and are skipped
+						size.m_nSegments = 0;
+						size.m_nNodeCount = 0;
+						size.m_nFaceCount = 0;
+						continue;
+					}
+
+					nfDouble dMaxRadius = (pBeam->m_radius[0] > pBeam->m_radius[1]) ? pBeam->m_radius[0] : pBeam->m_radius[1];
+					size.m_nSegments = segmentsForRadius(dMaxRadius, dAccuracy);
+
+					nfUint32 nRingCount = 2;
+					nfUint32 nSphereCount = 0;
+					for (nfUint32 nBeamEnd = 0; nBeamEnd < 2; nBeamEnd++) {
+						nfInt32 eCapMode = pBeam->getCapMode(nBeamEnd);
+						if (eCapMode == MODELBEAMLATTICECAPMODE_HEMISPHERE)
+							nRingCount += size.m_nSegments / 4 - 1;
+						else if (eCapMode == MODELBEAMLATTICECAPMODE_SPHERE)
+							nSphereCount++;
+					}
+
+					nfUint32 nSphereRingCount = size.m_nSegments / 2 - 1;
+					size.m_nNodeCount = fnStackNodeCount(nRingCount, size.m_nSegments) + nSphereCount * fnStackNodeCount(nSphereRingCount, size.m_nSegments);
+					size.m_nFaceCount = fnStackFaceCount(nRingCount, size.m_nSegments) + nSphereCount * fnStackFaceCount(nSphereRingCount, size.m_nSegments);
+				}
+				else {
+					size.m_nSegments = segmentsForRadius(balls[nItem - nBeamCount].m_dRadius, dAccuracy);
+					nfUint32 nSphereRingCount = size.m_nSegments / 2 - 1;
+					size.m_nNodeCount = fnStackNodeCount(nSphereRingCount, size.m_nSegments);
+					size.m_nFaceCount = fnStackFaceCount(nSphereRingCount, size.m_nSegments);
+				}
+			}
+		});
+
+		// Prefix sum of the output offsets
+		std::vector<nfUint32> nodeOffsets(nItemCount);
+		std::vector<nfUint32> faceOffsets(nItemCount);
+		nfUint64 nNodeTotal = pTargetMesh->getNodeCount();
+		nfUint64 nFaceTotal = pTargetMesh->getFaceCount();
+		for (nfUint32 nItem = 0; nItem < nItemCount; nItem++) {
+			nodeOffsets[nItem] = (nfUint32)nNodeTotal;
+			faceOffsets[nItem] = (nfUint32)nFaceTotal;
+			nNodeTotal += sizes[nItem].m_nNodeCount;
+			nFaceTotal += sizes[nItem].m_nFaceCount;
+			if (nNodeTotal > NMR_MESH_MAXNODECOUNT)
+				throw CNMRException(NMR_ERROR_TOOMANYNODES);
+			if (nFaceTotal > NMR_MESH_MAXFACECOUNT)
+				throw CNMRException(NMR_ERROR_TOOMANYFACES);
+		}
+
+		pTargetMesh->allocateNodes((nfUint32)nNodeTotal - pTargetMesh->getNodeCount());
+		pTargetMesh->allocateFaces((nfUint32)nFaceTotal - pTargetMesh->getFaceCount());
+
+		// Pass 2: every item writes into its own range of the target mesh
+		fnParallelFor(nItemCount, m_nThreadCount, NMR_BEAMLATTICETESSELLATOR_MINITEMSPERTHREAD, [&](nfUint32 nBegin, nfUint32 nEnd) {
+			std::vector<BEAMLATTICERING> rings;
+			std::vector<BEAMLATTICERING> sphereRings;
+			nfDouble vPosition1[3], vPosition2[3], vAxis[3], vU[3], vV[3];
+			nfUint32 j;
+
+			for (nfUint32 nItem = nBegin; nItem < nEnd; nItem++) {
+				const BEAMLATTICEITEMSIZE & size = sizes[nItem];
+				if (size.m_nSegments == 0)
+					continue;
+
+				const BEAMLATTICEUNITCIRCLE & circle = m_UnitCircles[size.m_nSegments / 4];
+				nfUint32 nNodeIndex = nodeOffsets[nItem];
+				nfUint32 nFaceIndex = faceOffsets[nItem];
+
+				if (nItem >= nBeamCount) {
+					const BEAMLATTICEBALL & ball = balls[nItem - nBeamCount];
+					const nfDouble vBallAxis[3] = { 0.0, 0.0, 1.0 };
+					const nfDouble vBallU[3] = { 1.0, 0.0, 0.0 };
+					const nfDouble vBallV[3] = { 0.0, 1.0, 0.0 };
+					fnGetPosition(m_pMesh, ball.m_nNodeIndex, vPosition1);
+					fnEmitSphere(pTargetMesh, circle, size.m_nSegments, vBallU, vBallV, vBallAxis, vPosition1, ball.m_dRadius, sphereRings, nNodeIndex, nFaceIndex);
+					continue;
+				}
+
+				MESHBEAM * pBeam = m_pMesh->getBeam(nItem);
+				fnGetPosition(m_pMesh, pBeam->m_nodeindices[0], vPosition1);
+				fnGetPosition(m_pMesh, pBeam->m_nodeindices[1], vPosition2);
+
+				for (j = 0; j < 3; j++)
+					vAxis[j] = vPosition2[j] - vPosition1[j];
+				nfDouble dLength = sqrt(vAxis[0] * vAxis[0] + vAxis[1] * vAxis[1] + vAxis[2] * vAxis[2]);
+				for (j = 0; j < 3; j++)
+					vAxis[j] /= dLength;
+				fnOrthonormalBasis(vAxis, vU, vV);
+
+				nfDouble dRadius1 = pBeam->m_radius[0];
+				nfDouble dRadius2 = pBeam->m_radius[1];
+				nfInt32 eCapMode1 = pBeam->getCapMode(0);
+				nfInt32 eCapMode2 = pBeam->getCapMode(1);
+
+				// Rings along the axis, from the first to the second end. Butt and sphere caps close
+				// the cylinder with a flat fan around the end node.
+				nfDouble vBottom[3], vTop[3];
+				rings.clear();
+				if (eCapMode1 == MODELBEAMLATTICECAPMODE_HEMISPHERE) {
+					fnAddHemisphereRings(circle, size.m_nSegments, vAxis, vPosition1, dRadius1, -1.0, rings);
+					for (j = 0; j < 3; j++)
+						vBottom[j] = vPosition1[j] - vAxis[j] * dRadius1;
+				}
+				else {
+					for (j = 0; j < 3; j++)
+						vBottom[j] = vPosition1[j];
+				}
+
+				BEAMLATTICERING ring;
+				for (j = 0; j < 3; j++)
+					ring.m_Center[j] = vPosition1[j];
+				ring.m_dRadius = dRadius1;
+				rings.push_back(ring);
+				for (j = 0; j < 3; j++)
+					ring.m_Center[j] = vPosition2[j];
+				ring.m_dRadius = dRadius2;
+				rings.push_back(ring);
+
+				if (eCapMode2 == MODELBEAMLATTICECAPMODE_HEMISPHERE) {
+					fnAddHemisphereRings(circle, size.m_nSegments, vAxis, vPosition2, dRadius2, 1.0, rings);
+					for (j = 0; j < 3; j++)
+						vTop[j] = vPosition2[j] + vAxis[j] * dRadius2;
+				}
+				else {
+					for (j = 0; j < 3; j++)
+						vTop[j] = vPosition2[j];
+				}
+
+				fnEmitStack(pTargetMesh, circle, size.m_nSegments, vU, vV, rings, vBottom, vTop, nNodeIndex, nFaceIndex);
+
+				if (eCapMode1 == MODELBEAMLATTICECAPMODE_SPHERE)
+					fnEmitSphere(pTargetMesh, circle, size.m_nSegments, vU, vV, vAxis, vPosition1, dRadius1, sphereRings, nNodeIndex, nFaceIndex);
+				if (eCapMode2 == MODELBEAMLATTICECAPMODE_SPHERE)
+					fnEmitSphere(pTargetMesh, circle, size.m_nSegments, vU, vV, vAxis, vPosition2, dRadius2, sphereRings, nNodeIndex, nFaceIndex);
+			}
+		});
+	}
+
+}
@@ -71,13 +71,9 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		nfInt32 nIdx, nNodeCount, nFaceCount, nBeamCount, nBallCount, j;
-		MESHNODE * pNode;
-		MESHFACE * pFace;
-		MESHBEAM * pBeam;
-		MESHBALL * pBall;
-		MESHNODE * pFaceNodes[3];
-		MESHNODE * pBeamNodes[2];
-		MESHNODE * pBallNode;
+		nfUint32 nBlockIdx, nBlockEntryCount, nBlockEntry;
+		nfInt32 nFaceNodes[3];
+		nfInt32 nBeamNodes[2];
 
 		// Copy Mesh Information
 		CMeshInformationHandler * pOtherMeshInformationHandler = pMesh->getMeshInformationHandler();
@@ -92,13 +88,20 @@ namespace NMR {
 		nBallCount = pMesh->getBallCount();
 
 		if (nNodeCount > 0) {
-			std::vector<MESHNODE *> aNewNodes;
-			aNewNodes.resize(nNodeCount);
-
-			for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
-				pNode = pMesh->getNode(nIdx);
-				NVEC3 vPosition = fnMATRIX3_apply(mMatrix, pNode->m_position);
-				aNewNodes[nIdx] = addNode(vPosition);
+			// Nodes are appended, so the new index of a node is its old index plus the offset
+			nfInt32 nNodeOffset = (nfInt32)getNodeCount();
+			nfBool bIsIdentity = fnMATRIX3_isIdentity(mMatrix);
+
+			nIdx = 0;
+			MESHNODES & sourceNodes = pMesh->getNodes();
+			for (nBlockIdx = 0; nIdx < nNodeCount; nBlockIdx++) {
+				MESHNODE * pBlock = sourceNodes.getBlock(nBlockIdx, nBlockEntryCount);
+				for (nBlockEntry = 0; (nBlockEntry < nBlockEntryCount) && (nIdx < nNodeCount); nBlockEntry++, nIdx++) {
+					if (bIsIdentity)
+						addNode(pBlock[nBlockEntry].m_position);
+					else
+						addNode(fnMATRIX3_apply(mMatrix, pBlock[nBlockEntry].m_position));
+				}
 			}
 
 			if (nFaceCount > 0) {
@@ -106,41 +109,50 @@ namespace NMR {
 					m_pMeshInformationHandler->cloneDefaultInfosFrom(pOtherMeshInformationHandler);
 				}
 
-				for (nIdx = 0; nIdx < nFaceCount; nIdx++) {
-					pFace = pMesh->getFace(nIdx);
-					for (j = 0; j < 3; j++) {
-						if ((pFace->m_nodeindices[j] < 0) || (pFace->m_nodeindices[j] >= nNodeCount))
-							throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
-
-						pFaceNodes[j] = aNewNodes[pFace->m_nodeindices[j]];
-					}
-
-					MESHFACE * pNewFace = addFace(pFaceNodes[0], pFaceNodes[1], pFaceNodes[2]);
-					if (m_pMeshInformationHandler && pOtherMeshInformationHandler) {
-						m_pMeshInformationHandler->cloneFaceInfosFrom(pNewFace->m_index, pOtherMeshInformationHandler, pFace->m_index);
+				nIdx = 0;
+				MESHFACES & sourceFaces = pMesh->getFaces();
+				for (nBlockIdx = 0; nIdx < nFaceCount; nBlockIdx++) {
+					MESHFACE * pBlock = sourceFaces.getBlock(nBlockIdx, nBlockEntryCount);
+					for (nBlockEntry = 0; (nBlockEntry < nBlockEntryCount) && (nIdx < nFaceCount); nBlockEntry++, nIdx++) {
+						MESHFACE * pFace = &pBlock[nBlockEntry];
+						for (j = 0; j < 3; j++) {
+							if ((pFace->m_nodeindices[j] < 0) || (pFace->m_nodeindices[j] >= nNodeCount))
+								throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
+
+							nFaceNodes[j] = pFace->m_nodeindices[j] + nNodeOffset;
+						}
+
+						nfUint32 nNewFaceIndex = addFace(nFaceNodes[0], nFaceNodes[1], nFaceNodes[2]);
+						if (m_pMeshInformationHandler && pOtherMeshInformationHandler) {
+							m_pMeshInformationHandler->cloneFaceInfosFrom(nNewFaceIndex, pOtherMeshInformationHandler, nIdx);
+						}
 					}
 				}
 			}
 			if (nBeamCount > 0) {
-				for (nIdx = 0; nIdx < nBeamCount; nIdx++) {
-					pBeam = pMesh->getBeam(nIdx);
-					for (j = 0; j < 2; j++) {
-						if ((pBeam->m_nodeindices[j] < 0) || (pBeam->m_nodeindices[j] >= nNodeCount))
-							throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
-
-						pBeamNodes[j] = aNewNodes[pBeam->m_nodeindices[j]];
+				nIdx = 0;
+				MESHBEAMS & sourceBeams = pMesh->getBeams();
+				for (nBlockIdx = 0; nIdx < nBeamCount; nBlockIdx++) {
+					MESHBEAM * pBlock = sourceBeams.getBlock(nBlockIdx, nBlockEntryCount);
+					for (nBlockEntry = 0; (nBlockEntry < nBlockEntryCount) && (nIdx < nBeamCount); nBlockEntry++, nIdx++) {
+						MESHBEAM * pBeam = &pBlock[nBlockEntry];
+						for (j = 0; j < 2; j++) {
+							if ((pBeam->m_nodeindices[j] < 0) || (pBeam->m_nodeindices[j] >= nNodeCount))
+								throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
+
+							nBeamNodes[j] = pBeam->m_nodeindices[j] + nNodeOffset;
+						}
+						addBeam(nBeamNodes[0], nBeamNodes[1], pBeam->m_radius[0], pBeam->m_radius[1], pBeam->getCapMode(0), pBeam->getCapMode(1));
 					}
-					addBeam(pBeamNodes[0], pBeamNodes[1], pBeam->m_radius[0], pBeam->m_radius[1], pBeam->m_capMode[0], pBeam->m_capMode[1]);
 				}
 			}
 			if (nBallCount > 0) {
 				for (nIdx = 0; nIdx < nBallCount; nIdx++) {
-					pBall = pMesh->getBall(nIdx);
+					MESHBALL * pBall = pMesh->getBall(nIdx);
 					if ((pBall->m_nodeindex < 0) || (pBall->m_nodeindex >= nNodeCount))
 						throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
 
-					pBallNode = aNewNodes[pBall->m_nodeindex];
-					addBall(pBallNode, pBall->m_radius);
+					addBall(pBall->m_nodeindex + nNodeOffset, pBall->m_radius);
 				}
 			}
 
@@ -163,9 +175,8 @@ namespace NMR {
 		pMesh->mergeMesh(this, mMatrix);
 	}
 
-	_Ret_notnull_ MESHNODE * CMesh::addNode(_In_ const NVEC3 vPosition)
+	nfUint32 CMesh::addNode(_In_ const NVEC3 vPosition)
 	{
-		MESHNODE * pNode;
 		nfUint32 j;
 
 		// Check Position Validity
@@ -180,16 +191,14 @@ namespace NMR {
 
 		// Allocate Data
 		nfUint32 nNewIndex;
-		pNode = m_Nodes.allocData(nNewIndex);
-		pNode->m_index = nNewIndex;
-		pNode->m_position = vPosition;
+		MESHNODE & node = m_Nodes.allocDataRef(nNewIndex);
+		node.m_position = vPosition;
 
-		return pNode;
+		return nNewIndex;
 	}
-	_Ret_notnull_ MESHNODE * CMesh::addNode(_In_ const nfFloat posX, _In_ const nfFloat posY, _In_ const nfFloat posZ)
-	{
-		MESHNODE * pNode;
 
+	nfUint32 CMesh::addNode(_In_ const nfFloat posX, _In_ const nfFloat posY, _In_ const nfFloat posZ)
+	{
 		// Check Position Validity
 		if (fabs(posX) > NMR_MESH_MAXCOORDINATE)
 			throw CNMRException(NMR_ERROR_INVALIDCOORDINATES);
@@ -205,79 +214,85 @@ namespace NMR {
 
 		// Allocate Data
 		nfUint32 nNewIndex;
-		pNode = m_Nodes.allocData(nNewIndex);
-		pNode->m_index = nNewIndex;
-		pNode->m_position.m_values.x = posX;
-		pNode->m_position.m_values.y = posY;
-		pNode->m_position.m_values.z = posZ;
+		MESHNODE & node = m_Nodes.allocDataRef(nNewIndex);
+		node.m_position.m_values.x = posX;
+		node.m_position.m_values.y = posY;
+		node.m_position.m_values.z = posZ;
 
-		return pNode;
+		return nNewIndex;
 	}
 
-	_Ret_notnull_ MESHFACE * CMesh::addFace(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2, _In_ MESHNODE * pNode3)
+	nfUint32 CMesh::addFace(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2, _In_ nfInt32 nNodeIndex3)
 	{
-		if ((!pNode1) || (!pNode2) || (!pNode3))
-			throw CNMRException(NMR_ERROR_INVALIDPARAM);
-
-		if ((pNode1 == pNode2) || (pNode1 == pNode3) || (pNode2 == pNode3))
+		if ((nNodeIndex1 == nNodeIndex2) || (nNodeIndex1 == nNodeIndex3) || (nNodeIndex2 == nNodeIndex3))
 			throw CNMRException(NMR_ERROR_DUPLICATENODE);
 
-		MESHFACE * pFace;
-		nfUint32 nFaceCount = getFaceCount ();
+		nfUint32 nFaceCount = getFaceCount();
 
 		if (nFaceCount >= NMR_MESH_MAXFACECOUNT)
 			throw CNMRException(NMR_ERROR_TOOMANYFACES);
 
-		nfUint32 nNewIndex = 0;
+		nfUint32 nNewIndex;
 
-		pFace = m_Faces.allocData (nNewIndex);
-		pFace->m_nodeindices[0] = pNode1->m_index;
-		pFace->m_nodeindices[1] = pNode2->m_index;
-		pFace->m_nodeindices[2] = pNode3->m_index;
-		pFace->m_index = nNewIndex;
+		MESHFACE & face = m_Faces.allocDataRef(nNewIndex);
+		face.m_nodeindices[0] = nNodeIndex1;
+		face.m_nodeindices[1] = nNodeIndex2;
+		face.m_nodeindices[2] = nNodeIndex3;
 
 		if (m_pMeshInformationHandler)
 			m_pMeshInformationHandler->addFace(getFaceCount());
 
-		return pFace;
+		return nNewIndex;
 	}
-	
-	_Ret_notnull_ MESHFACE * CMesh::addFace(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2, _In_ nfInt32 nNodeIndex3)
+
+	nfUint32 CMesh::allocateNodes(_In_ nfUint32 nCount)
 	{
-		if ((nNodeIndex1 == nNodeIndex2) || (nNodeIndex1 == nNodeIndex3) || (nNodeIndex2 == nNodeIndex3))
-			throw CNMRException(NMR_ERROR_DUPLICATENODE);
+		nfUint32 nFirstIndex = getNodeCount();
+		if ((nfUint64)nFirstIndex + nCount > NMR_MESH_MAXNODECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYNODES);
 
-		MESHFACE * pFace;
-		nfUint32 nFaceCount = getFaceCount();
+		nfUint32 nNewIndex;
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			MESHNODE & node = m_Nodes.allocDataRef(nNewIndex);
+			node.m_position.m_values.x = 0.0f;
+			node.m_position.m_values.y = 0.0f;
+			node.m_position.m_values.z = 0.0f;
+		}
 
-		if (nFaceCount >= NMR_MESH_MAXFACECOUNT)
+		return nFirstIndex;
+	}
+
+	nfUint32 CMesh::allocateFaces(_In_ nfUint32 nCount)
+	{
+		nfUint32 nFirstIndex = getFaceCount();
+		if ((nfUint64)nFirstIndex + nCount > NMR_MESH_MAXFACECOUNT)
 			throw CNMRException(NMR_ERROR_TOOMANYFACES);
 
 		nfUint32 nNewIndex;
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			MESHFACE & face = m_Faces.allocDataRef(nNewIndex);
+			face.m_nodeindices[0] = 0;
+			face.m_nodeindices[1] = 0;
+			face.m_nodeindices[2] = 0;
+
+			if (m_pMeshInformationHandler)
+				m_pMeshInformationHandler->addFace(getFaceCount());
+		}
 
-		pFace = m_Faces.allocData(nNewIndex);
-		pFace->m_nodeindices[0] = nNodeIndex1;
-		pFace->m_nodeindices[1] = nNodeIndex2;
-		pFace->m_nodeindices[2] = nNodeIndex3;
-		pFace->m_index = nNewIndex;
-
-		if (m_pMeshInformationHandler)
-			m_pMeshInformationHandler->addFace(getFaceCount());
-
-		return pFace;
+		return nFirstIndex;
 	}
 
-	_Ret_notnull_ MESHBEAM * CMesh::addBeam(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2,
+	nfUint32 CMesh::addBeam(_In_ nfInt32 nNodeIndex1, _In_ nfInt32 nNodeIndex2,
 		_In_ nfDouble dRadius1, _In_ nfDouble dRadius2,
 		_In_ nfInt32 eCapMode1, _In_ nfInt32 eCapMode2)
 	{
-		if ((!pNode1) || (!pNode2))
-			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		nfUint32 nNodeCount = getNodeCount();
+		if ((nNodeIndex1 < 0) || ((nfUint32)nNodeIndex1 >= nNodeCount) || (nNodeIndex2 < 0) || ((nfUint32)nNodeIndex2 >= nNodeCount))
+			throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
 
-		if (pNode1 == pNode2)
+		if (nNodeIndex1 == nNodeIndex2)
 			throw CNMRException(NMR_ERROR_DUPLICATENODE);
 
-		MESHBEAM * pBeam;
 		nfUint32 nBeamCount = getBeamCount();
 
 		if (nBeamCount >= NMR_MESH_MAXBEAMCOUNT)
@@ -285,19 +300,19 @@ namespace NMR {
 
 		nfUint32 nNewIndex;
 
-		pBeam = m_BeamLattice.m_Beams.allocData(nNewIndex);
-		pBeam->m_nodeindices[0] = pNode1->m_index;
-		pBeam->m_nodeindices[1] = pNode2->m_index;
-		pBeam->m_index = nNewIndex;
-		pBeam->m_radius[0] = dRadius1;
-		pBeam->m_radius[1] = dRadius2;
+		MESHBEAM & beam = m_BeamLattice.m_Beams.allocDataRef(nNewIndex);
+		beam.m_nodeindices[0] = nNodeIndex1;
+		beam.m_nodeindices[1] = nNodeIndex2;
+		beam.m_radius[0] = dRadius1;
+		beam.m_radius[1] = dRadius2;
+		beam.m_capModes = 0;
+		beam.setCapMode(0, eCapMode1);
+		beam.setCapMode(1, eCapMode2);
 
-		pBeam->m_capMode[0] = eCapMode1;
-		pBeam->m_capMode[1] = eCapMode2;
+		m_BeamLattice.markNodeOccupied(nNodeIndex1);
+		m_BeamLattice.markNodeOccupied(nNodeIndex2);
 
-		m_BeamLattice.m_OccupiedNodes.insert({ pNode1->m_index, pNode2->m_index });
-
-		return pBeam;
+		return nNewIndex;
 	}
 
 	PBEAMSET CMesh::addBeamSet()
@@ -306,30 +321,28 @@ namespace NMR {
 		return m_BeamLattice.m_pBeamSets.back();
 	}
 
-	_Ret_notnull_ MESHBALL * CMesh::addBall(_In_ MESHNODE * pNode, _In_ nfDouble dRadius)
+	nfUint32 CMesh::addBall(_In_ nfInt32 nNodeIndex, _In_ nfDouble dRadius)
 	{
-		if ((!pNode))
-			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if ((nNodeIndex < 0) || ((nfUint32)nNodeIndex >= getNodeCount()))
+			throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
 
-		MESHBALL * pBall;
 		nfUint32 nBallCount = getBallCount();
 
 		if (nBallCount >= NMR_MESH_MAXBALLCOUNT)
 			throw CNMRException(NMR_ERROR_TOOMANYBALLS);
 
 		// Ensure that at least one beam exists at this node
-		if (m_BeamLattice.m_OccupiedNodes.find(pNode->m_index) == m_BeamLattice.m_OccupiedNodes.end()) {
+		if (!m_BeamLattice.isNodeOccupied(nNodeIndex)) {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		}
 
 		nfUint32 nNewIndex;
 
-		pBall = m_BeamLattice.m_Balls.allocData(nNewIndex);
-		pBall->m_nodeindex = pNode->m_index;
-		pBall->m_index = nNewIndex;
-		pBall->m_radius = dRadius;
+		MESHBALL & ball = m_BeamLattice.m_Balls.allocDataRef(nNewIndex);
+		ball.m_nodeindex = nNodeIndex;
+		ball.m_radius = dRadius;
 
-		return pBall;
+		return nNewIndex;
 	}
 
 
@@ -359,12 +372,12 @@ namespace NMR {
 
 	nfUint32 CMesh::getOccupiedNodeCount()
 	{
-		return (nfUint32)m_BeamLattice.m_OccupiedNodes.size();
+		return m_BeamLattice.getOccupiedNodeCount();
 	}
 
 	nfBool CMesh::isNodeOccupied(_In_ nfUint32 nIdx)
 	{
-		return m_BeamLattice.m_OccupiedNodes.find(nIdx) != m_BeamLattice.m_OccupiedNodes.end();
+		return m_BeamLattice.isNodeOccupied(nIdx);
 	}
 
 	_Ret_notnull_ MESHNODE * CMesh::getNode(_In_ nfUint32 nIdx)
@@ -394,11 +407,29 @@ namespace NMR {
 		return m_BeamLattice.m_Balls.getData(nIdx);
 	}
 
-	_Ret_notnull_ MESHNODE * CMesh::getOccupiedNode(_In_ nfUint32 nIdx)
+	nfUint32 CMesh::getOccupiedNodeIndex(_In_ nfUint32 nIdx)
+	{
+		return m_BeamLattice.getOccupiedNodeIndex(nIdx);
+	}
+
+	void CMesh::getOccupiedNodeIndices(_Out_ std::vector<nfUint32> & nodeIndices)
 	{
-		std::unordered_set<nfInt32>::iterator iter = m_BeamLattice.m_OccupiedNodes.begin();
-		std::advance(iter, nIdx);
-		return getNode(*iter);
+		m_BeamLattice.getOccupiedNodeIndices(nodeIndices);
+	}
+
+	MESHNODES & CMesh::getNodes()
+	{
+		return m_Nodes;
+	}
+
+	MESHFACES & CMesh::getFaces()
+	{
+		return m_Faces;
+	}
+
+	MESHBEAMS & CMesh::getBeams()
+	{
+		return m_BeamLattice.m_Beams;
 	}
 
 	void CMesh::setBeamLatticeMinLength(nfDouble dMinLength)
@@ -468,8 +499,6 @@ namespace NMR {
 
 		for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
 			MESHNODE * node = getNode(nIdx);
-			if (node->m_index != (nfInt32) nIdx)
-				return false;
 			for (j = 0; j < 3; j++)
 				if (fabs(node->m_position.m_fields[j]) > NMR_MESH_MAXCOORDINATE)
 					return false;
@@ -527,14 +556,21 @@ namespace NMR {
 
 	void CMesh::scanOccupiedNodes() {
 		m_BeamLattice.m_OccupiedNodes.clear();
+		m_BeamLattice.m_nOccupiedNodeCount = 0;
 
 		nfUint32 beamCount = m_BeamLattice.m_Beams.getCount();
 		for (nfUint32 iBeam = 0; iBeam < beamCount; iBeam++) {
 			MESHBEAM * meshBeam = getBeam(iBeam);
-			m_BeamLattice.m_OccupiedNodes.insert({ meshBeam->m_nodeindices[0], meshBeam->m_nodeindices[1] });
+			m_BeamLattice.markNodeOccupied(meshBeam->m_nodeindices[0]);
+			m_BeamLattice.markNodeOccupied(meshBeam->m_nodeindices[1]);
 		}
 	}
 
+	nfUint32 CMesh::countBeamsBelowMinLength(_In_ nfUint32 nFirstBeam)
+	{
+		return m_BeamLattice.countBeamsBelowMinLength(nFirstBeam);
+	}
+
 	void CMesh::validateBeamLatticeBalls() {
 		nfUint32 ballCount = m_BeamLattice.m_Balls.getCount();
 		MESHBALL * ballData = new MESHBALL[ballCount];
@@ -545,7 +581,7 @@ namespace NMR {
 		clearBeamLatticeBalls();
 		for (nfUint32 iBall = 0; iBall < ballCount; iBall++) {
 			try {
-				addBall(getNode(ballData[iBall].m_nodeindex), ballData[iBall].m_radius);
+				addBall(ballData[iBall].m_nodeindex, ballData[iBall].m_radius);
 			}
 			catch (CNMRException &) {}
 		}
@@ -92,32 +92,32 @@ namespace NMR {
 		if (!pMesh)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
-		std::vector<MESHNODE *> pNodes;
-
 		nfUint32 nNodeCount = m_Nodes.getCount();
 		nfUint32 nFaceCount = m_Faces.getCount();
-		pNodes.resize(nNodeCount);
+
+		// Nodes are appended to the mesh, so their new indices are shifted by the current node count
+		nfInt32 nNodeOffset = (nfInt32)pMesh->getNodeCount();
 
 		for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
 			NVEC3 * pPosition = m_Nodes.getData(nIdx);
-			pNodes[nIdx] = pMesh->addNode(*pPosition);
+			pMesh->addNode(*pPosition);
 		}
 
 		for (nIdx = 0; nIdx < nFaceCount; nIdx++) {
 			NVEC3I * pFaceVec = m_Faces.getData(nIdx);		
-			MESHNODE * pNewNodes[3];
+			nfInt32 nNewNodes[3];
 
 			for (j = 0; j < 3; j++) {
-				pNewNodes[j] = pNodes[pFaceVec->m_fields[j]];
+				nNewNodes[j] = pFaceVec->m_fields[j] + nNodeOffset;
 			}
 
-			if ((pNewNodes[0] == pNewNodes[1]) || (pNewNodes[0] == pNewNodes[2]) || (pNewNodes[1] == pNewNodes[2])) {
+			if ((nNewNodes[0] == nNewNodes[1]) || (nNewNodes[0] == nNewNodes[2]) || (nNewNodes[1] == nNewNodes[2])) {
 				if (!bIgnoreInvalidFaces)
 					throw CNMRException(NMR_ERROR_DUPLICATENODE);
 
 			}
 			else {
-				pMesh->addFace(pNewNodes[0], pNewNodes[1], pNewNodes[2]);
+				pMesh->addFace(nNewNodes[0], nNewNodes[1], nNewNodes[2]);
 			}
 		}
 	}
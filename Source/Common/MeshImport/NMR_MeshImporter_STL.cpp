@@ -148,7 +148,7 @@ namespace NMR {
 		// }
 
 		nfUint32 nNodeIdx;
-		MESHNODE * pNodes[3];
+		nfUint32 nNodes[3];
 		MESHFORMAT_STL_FACET Facet;
 		CVectorTree VectorTree;
 		nfBool bIsValid;
@@ -176,16 +176,16 @@ namespace NMR {
 						vPosition = fnMATRIX3_apply(*pmMatrix, vPosition);
 
 					if (VectorTree.findVector3(vPosition, nNodeIdx)) {
-						pNodes[j] = pMesh->getNode(nNodeIdx);
+						nNodes[j] = nNodeIdx;
 					}
 					else {
-						pNodes[j] = pMesh->addNode(vPosition);
-						VectorTree.addVector3(pNodes[j]->m_position, (nfUint32)pNodes[j]->m_index);
+						nNodes[j] = pMesh->addNode(vPosition);
+						VectorTree.addVector3(vPosition, nNodes[j]);
 					}
 				}
 
 				// check, if Nodes are separate
-				bIsValid = (pNodes[0] != pNodes[1]) && (pNodes[0] != pNodes[2]) && (pNodes[1] != pNodes[2]);
+				bIsValid = (nNodes[0] != nNodes[1]) && (nNodes[0] != nNodes[2]) && (nNodes[1] != nNodes[2]);
 			}
 
 			// Throw "Invalid Exception"
@@ -193,14 +193,14 @@ namespace NMR {
 				throw CNMRException(NMR_ERROR_INVALIDCOORDINATES);
 
 			if (bIsValid) {
-				pMesh->addFace(pNodes[0], pNodes[1], pNodes[2]);
-				// MESHFACE * pFace = pMesh->addFace(pNodes[0], pNodes[1], pNodes[2]);
+				pMesh->addFace(nNodes[0], nNodes[1], nNodes[2]);
+				// nfUint32 nFaceIndex = pMesh->addFace(nNodes[0], nNodes[1], nNodes[2]);
 				//if (pProperties) {
 				//	nfUint32 nRed = (nfUint32) ((nfFloat) (Facet.m_attribute & 0x1f) / (255.0f / 31.0f));
 				//	nfUint32 nGreen = (nfUint32)((nfFloat)((Facet.m_attribute >> 5) & 0x1f) / (255.0f / 31.0f));
 				//	nfUint32 nBlue = (nfUint32)((nfFloat)((Facet.m_attribute >> 10) & 0x1f) / (255.0f / 31.0f));
 
-				//	// MESHINFORMATION_PROPERTIES * pFaceData = (NMR::MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(pFace->m_index);
+				//	// MESHINFORMATION_PROPERTIES * pFaceData = (NMR::MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(nFaceIndex);
 				//}
 			}
 		}
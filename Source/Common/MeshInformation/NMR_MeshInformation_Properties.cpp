@@ -47,7 +47,22 @@ namespace NMR {
 		if (nUniqueResourceID == 0)
 			throw CNMRException(NMR_ERROR_INVALIDPROPERTYRESOURCEID);
 
-		m_IDMap.insert(std::make_pair(std::make_pair(nUniqueResourceID, nPropertyID), nResourceIndex));
+		if ((nUniqueResourceID <= m_DenseIDMap.size() + NMR_PROPERTYINDEXMAPPING_MAXDENSEGAP) && (nResourceIndex != NMR_PROPERTYINDEXMAPPING_UNMAPPED)) {
+			if (nUniqueResourceID >= m_DenseIDMap.size())
+				m_DenseIDMap.resize((size_t)nUniqueResourceID + 1);
+
+			std::vector<nfUint32> & indices = m_DenseIDMap[nUniqueResourceID];
+			if (nPropertyID <= indices.size() + NMR_PROPERTYINDEXMAPPING_MAXDENSEGAP) {
+				if (nPropertyID >= indices.size())
+					indices.resize((size_t)nPropertyID + 1, NMR_PROPERTYINDEXMAPPING_UNMAPPED);
+				// The first registration of an ID wins
+				if (indices[nPropertyID] == NMR_PROPERTYINDEXMAPPING_UNMAPPED)
+					indices[nPropertyID] = nResourceIndex;
+				return nResourceIndex;
+			}
+		}
+
+		m_SparseIDMap.insert(std::make_pair(std::make_pair(nUniqueResourceID, nPropertyID), nResourceIndex));
 
 		return nResourceIndex;
 	}
@@ -58,8 +73,14 @@ namespace NMR {
 		if (nUniqueResourceID == 0)
 			throw CNMRException(NMR_ERROR_INVALIDPROPERTYRESOURCEID);
 
-		auto iIterator = m_IDMap.find(std::make_pair(nUniqueResourceID, nPropertyID));
-		if (iIterator == m_IDMap.end())
+		if (nUniqueResourceID < m_DenseIDMap.size()) {
+			const std::vector<nfUint32> & indices = m_DenseIDMap[nUniqueResourceID];
+			if ((nPropertyID < indices.size()) && (indices[nPropertyID] != NMR_PROPERTYINDEXMAPPING_UNMAPPED))
+				return indices[nPropertyID];
+		}
+
+		auto iIterator = m_SparseIDMap.find(std::make_pair(nUniqueResourceID, nPropertyID));
+		if (iIterator == m_SparseIDMap.end())
 			throw CNMRException(NMR_ERROR_PROPERTYIDNOTFOUND);
 
 		return iIterator->second;
@@ -79,6 +79,14 @@ namespace NMR {
 		addException(e, WarningLevel);
 	}
 
+	void CModelWarnings::addWarning(_In_ PModelReaderWarning pWarning)
+	{
+		if (pWarning.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (m_Warnings.size() < NMR_MAXWARNINGCOUNT)
+			m_Warnings.push_back(pWarning);
+	}
+
 	void CModelWarnings::addException(const _In_ CNMRException & Exception, _In_ eModelWarningLevel WarningLevel)
 	{
 		if (m_Warnings.size() < NMR_MAXWARNINGCOUNT) { // Failsafe check for Index overflows
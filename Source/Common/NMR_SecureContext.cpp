@@ -12,6 +12,12 @@ namespace NMR {
 		m_sDekDescriptor = descriptor;
 		m_bHasDek = true;
 	}
+	bool CSecureContext::getDekInPlace() const {
+		return m_sDekDescriptor.m_bInPlace;
+	}
+	void CSecureContext::setDekInPlace(bool bInPlace) {
+		m_sDekDescriptor.m_bInPlace = bInPlace;
+	}
 	ClientConsumerMap::const_iterator CSecureContext::kekCtxBegin() const {
 		return m_ConsumerMap.cbegin();
 	}
@@ -0,0 +1,324 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_Statistics.cpp implements the instrumentation of the reader and writer.
+
+--*/
+
+#include "Common/NMR_Statistics.h"
+
+#include <sstream>
+
+namespace NMR {
+
+	static thread_local STATISTICSTHREADSTATE s_ThreadState = {};
+
+	static const nfChar * fnStatisticsPhaseName(_In_ ProgressIdentifier ePhase)
+	{
+		switch (ePhase) {
+			case PROGRESS_QUERYCANCELED: return "QUERYCANCELED";
+			case PROGRESS_DONE: return "DONE";
+			case PROGRESS_CLEANUP: return "CLEANUP";
+			case PROGRESS_READSTREAM: return "READSTREAM";
+			case PROGRESS_EXTRACTOPCPACKAGE: return "EXTRACTOPCPACKAGE";
+			case PROGRESS_READNONROOTMODELS: return "READNONROOTMODELS";
+			case PROGRESS_READROOTMODEL: return "READROOTMODEL";
+			case PROGRESS_READRESOURCES: return "READRESOURCES";
+			case PROGRESS_READMESH: return "READMESH";
+			case PROGRESS_READSLICES: return "READSLICES";
+			case PROGRESS_READBUILD: return "READBUILD";
+			case PROGRESS_READCUSTOMATTACHMENTS: return "READCUSTOMATTACHMENTS";
+			case PROGRESS_READTEXTURETACHMENTS: return "READTEXTURETACHMENTS";
+			case PROGRESS_CREATEOPCPACKAGE: return "CREATEOPCPACKAGE";
+			case PROGRESS_WRITEMODELSTOSTREAM: return "WRITEMODELSTOSTREAM";
+			case PROGRESS_WRITEROOTMODEL: return "WRITEROOTMODEL";
+			case PROGRESS_WRITENONROOTMODELS: return "WRITENONROOTMODELS";
+			case PROGRESS_WRITEATTACHMENTS: return "WRITEATTACHMENTS";
+			case PROGRESS_WRITECONTENTTYPES: return "WRITECONTENTTYPES";
+			case PROGRESS_WRITEOBJECTS: return "WRITEOBJECTS";
+			case PROGRESS_WRITENODES: return "WRITENODES";
+			case PROGRESS_WRITETRIANGLES: return "WRITETRIANGLES";
+			case PROGRESS_WRITESLICES: return "WRITESLICES";
+			default: return "UNKNOWN";
+		}
+	}
+
+	static void fnWriteJSONString(_In_ std::ostringstream & Stream, _In_ const std::string & sValue)
+	{
+		const nfChar * hexaDec = "0123456789abcdef";
+		Stream << '"';
+		for (nfChar cChar : sValue) {
+			if ((cChar == '"') || (cChar == '\\'))
+				Stream << '\\' << cChar;
+			else if ((nfByte)cChar < 0x20)
+				Stream << "\\u00" << hexaDec[((nfByte)cChar) >> 4] << hexaDec[((nfByte)cChar) & 0xF];
+			else
+				Stream << cChar;
+		}
+		Stream << '"';
+	}
+
+	static nfUint64 fnStatisticsElapsed(_In_ std::chrono::steady_clock::time_point StartTime, _In_ std::chrono::steady_clock::time_point EndTime)
+	{
+		return (nfUint64)std::chrono::duration_cast<std::chrono::nanoseconds>(EndTime - StartTime).count();
+	}
+
+	static void fnStatisticsResetThreadState(_Out_ STATISTICSTHREADSTATE & State, _In_opt_ CStatistics * pStatistics, _In_ nfBool bIsWorker, _In_ const std::string & sPart)
+	{
+		State.m_pStatistics = pStatistics;
+		State.m_bIsWorker = bIsWorker;
+		State.m_sPart = sPart;
+		State.m_SwitchTime = std::chrono::steady_clock::now();
+		for (nfUint32 nIndex = 0; nIndex < escCount; nIndex++)
+			State.m_nCounters[nIndex] = 0;
+	}
+
+	CStatistics::CStatistics()
+		: m_nPhase(PROGRESS_QUERYCANCELED), m_bIsRunning(false), m_nTotalWallTime(0)
+	{
+	}
+
+	void CStatistics::start()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_Entries.clear();
+		m_EntryMap.clear();
+		m_nPhase = PROGRESS_QUERYCANCELED;
+		m_nTotalWallTime = 0;
+		m_StartTime = std::chrono::steady_clock::now();
+		m_bIsRunning = true;
+	}
+
+	void CStatistics::resume()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_nPhase = PROGRESS_QUERYCANCELED;
+		m_StartTime = std::chrono::steady_clock::now() - std::chrono::nanoseconds(m_nTotalWallTime);
+		m_bIsRunning = true;
+	}
+
+	void CStatistics::stop()
+	{
+		if (!m_bIsRunning)
+			return;
+
+		auto EndTime = std::chrono::steady_clock::now();
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_nTotalWallTime = fnStatisticsElapsed(m_StartTime, EndTime);
+		m_bIsRunning = false;
+	}
+
+	void CStatistics::flush(_Inout_ STATISTICSTHREADSTATE & State)
+	{
+		auto Now = std::chrono::steady_clock::now();
+		nfUint64 nWallTime = fnStatisticsElapsed(State.m_SwitchTime, Now);
+		State.m_SwitchTime = Now;
+
+		// Nothing is booked before the first phase
+		ProgressIdentifier ePhase = (ProgressIdentifier)m_nPhase.load();
+		if (m_bIsRunning && (ePhase != PROGRESS_QUERYCANCELED)) {
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			auto Key = std::make_pair(State.m_sPart, (nfInt32)ePhase);
+			auto iIterator = m_EntryMap.find(Key);
+			if (iIterator == m_EntryMap.end()) {
+				m_Entries.emplace_back();
+				STATISTICSENTRY & Entry = m_Entries.back();
+				Entry.m_sPart = State.m_sPart;
+				Entry.m_ePhase = ePhase;
+				Entry.m_nWallTime = 0;
+				for (nfUint32 nIndex = 0; nIndex < escCount; nIndex++)
+					Entry.m_nCounters[nIndex] = 0;
+				iIterator = m_EntryMap.insert(std::make_pair(Key, &Entry)).first;
+			}
+
+			STATISTICSENTRY * pEntry = iIterator->second;
+			pEntry->m_nWallTime += nWallTime;
+			for (nfUint32 nIndex = 0; nIndex < escCount; nIndex++)
+				pEntry->m_nCounters[nIndex] += State.m_nCounters[nIndex];
+		}
+
+		for (nfUint32 nIndex = 0; nIndex < escCount; nIndex++)
+			State.m_nCounters[nIndex] = 0;
+	}
+
+	void CStatistics::setPhase(_In_ ProgressIdentifier ePhase)
+	{
+		if ((ePhase == PROGRESS_QUERYCANCELED) || s_ThreadState.m_bIsWorker)
+			return;
+		if (ePhase == (ProgressIdentifier)m_nPhase.load())
+			return;
+		flush(s_ThreadState);
+		m_nPhase = ePhase;
+	}
+
+	void CStatistics::setPart(_In_ const std::string & sPart)
+	{
+		if (sPart == s_ThreadState.m_sPart)
+			return;
+		flush(s_ThreadState);
+		s_ThreadState.m_sPart = sPart;
+	}
+
+	std::string CStatistics::getPart()
+	{
+		return s_ThreadState.m_sPart;
+	}
+
+	void CStatistics::add(_In_ eStatisticsCounter eCounter, _In_ nfUint64 nValue)
+	{
+		s_ThreadState.m_nCounters[eCounter] += nValue;
+	}
+
+	std::string CStatistics::toJSON()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		std::ostringstream Stream;
+#ifdef NMR_STATISTICS
+		Stream << "{\"enabled\":true";
+#else
+		Stream << "{\"enabled\":false";
+#endif
+		Stream << ",\"walltime_ns\":" << m_nTotalWallTime << ",\"entries\":[";
+
+		nfBool bFirst = true;
+		for (auto & Entry : m_Entries) {
+			if (!bFirst)
+				Stream << ',';
+			bFirst = false;
+
+			// Model building is the part of the wall time that is not covered by the other timers
+			nfUint64 nMeasuredTime = Entry.m_nCounters[escZIPTime] + Entry.m_nCounters[escXMLTime] + Entry.m_nCounters[escNumberParsingTime];
+			nfUint64 nModelBuildingTime = (Entry.m_nWallTime > nMeasuredTime) ? (Entry.m_nWallTime - nMeasuredTime) : 0;
+
+			Stream << "{\"part\":";
+			fnWriteJSONString(Stream, Entry.m_sPart);
+			Stream << ",\"phase\":\"" << fnStatisticsPhaseName(Entry.m_ePhase) << '"';
+			Stream << ",\"walltime_ns\":" << Entry.m_nWallTime;
+			Stream << ",\"bytesin\":" << Entry.m_nCounters[escBytesIn];
+			Stream << ",\"bytesout\":" << Entry.m_nCounters[escBytesOut];
+			Stream << ",\"elements\":" << Entry.m_nCounters[escElements];
+			Stream << ",\"allocations\":" << Entry.m_nCounters[escAllocations];
+			Stream << ",\"ziptime_ns\":" << Entry.m_nCounters[escZIPTime];
+			Stream << ",\"xmltime_ns\":" << Entry.m_nCounters[escXMLTime];
+			Stream << ",\"numberparsingtime_ns\":" << Entry.m_nCounters[escNumberParsingTime];
+			Stream << ",\"modelbuildingtime_ns\":" << nModelBuildingTime;
+			Stream << '}';
+		}
+
+		Stream << "]}";
+		return Stream.str();
+	}
+
+	CStatistics * CStatistics::getActive()
+	{
+		return s_ThreadState.m_pStatistics;
+	}
+
+	STATISTICSCONTEXT CStatistics::getContext()
+	{
+		STATISTICSCONTEXT Context;
+		Context.m_pStatistics = s_ThreadState.m_pStatistics;
+		Context.m_sPart = s_ThreadState.m_sPart;
+		return Context;
+	}
+
+	CStatisticsActivation::CStatisticsActivation(_In_ CStatistics * pStatistics, _In_ nfBool bResume)
+		: m_pStatistics(pStatistics), m_PreviousState(s_ThreadState)
+	{
+		if (m_pStatistics != nullptr) {
+			if (bResume)
+				m_pStatistics->resume();
+			else
+				m_pStatistics->start();
+		}
+		fnStatisticsResetThreadState(s_ThreadState, m_pStatistics, false, "");
+	}
+
+	CStatisticsActivation::~CStatisticsActivation()
+	{
+		if (m_pStatistics != nullptr) {
+			m_pStatistics->flush(s_ThreadState);
+			m_pStatistics->stop();
+		}
+		s_ThreadState = m_PreviousState;
+	}
+
+	CStatisticsWorkerActivation::CStatisticsWorkerActivation(_In_ const STATISTICSCONTEXT & Context)
+		: m_PreviousState(s_ThreadState)
+	{
+		fnStatisticsResetThreadState(s_ThreadState, Context.m_pStatistics, true, Context.m_sPart);
+	}
+
+	CStatisticsWorkerActivation::~CStatisticsWorkerActivation()
+	{
+		if (s_ThreadState.m_pStatistics != nullptr)
+			s_ThreadState.m_pStatistics->flush(s_ThreadState);
+		s_ThreadState = m_PreviousState;
+	}
+
+	CStatisticsPartScope::CStatisticsPartScope(_In_ const std::string & sPart)
+		: m_pStatistics(CStatistics::getActive())
+	{
+		if (m_pStatistics != nullptr) {
+			m_sPreviousPart = m_pStatistics->getPart();
+			m_pStatistics->setPart(sPart);
+		}
+	}
+
+	CStatisticsPartScope::~CStatisticsPartScope()
+	{
+		if (m_pStatistics != nullptr)
+			m_pStatistics->setPart(m_sPreviousPart);
+	}
+
+	CStatisticsTimer::CStatisticsTimer(_In_ eStatisticsCounter eCounter, _In_ nfBool bSampled)
+		: m_pStatistics(CStatistics::getActive()), m_eCounter(eCounter), m_nFactor(1)
+	{
+		if (m_pStatistics == nullptr)
+			return;
+
+		if (bSampled) {
+			static thread_local nfUint32 s_nSampleCounters[escCount] = {};
+			if (((++s_nSampleCounters[eCounter]) & (NMR_STATISTICS_SAMPLEINTERVAL - 1)) != 0) {
+				m_pStatistics = nullptr;
+				return;
+			}
+			m_nFactor = NMR_STATISTICS_SAMPLEINTERVAL;
+		}
+
+		m_StartTime = std::chrono::steady_clock::now();
+	}
+
+	CStatisticsTimer::~CStatisticsTimer()
+	{
+		if (m_pStatistics != nullptr)
+			m_pStatistics->add(m_eCounter, fnStatisticsElapsed(m_StartTime, std::chrono::steady_clock::now()) * m_nFactor);
+	}
+
+}
@@ -33,6 +33,7 @@ correctly and Exception-safe
 
 #include "Common/NMR_StringUtils.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_Statistics.h"
 #include <climits>
 #include <sstream>
 #include <cmath>
@@ -100,6 +101,7 @@ namespace NMR {
 
 	nfInt32 fnStringToInt32(_In_z_ const nfChar * pszValue)
 	{
+		NMR_STATISTICS_SAMPLEDTIMER(escNumberParsingTime);
 		__NMRASSERT(pszValue);
 		nfInt64 nResult = 0;
 
@@ -123,6 +125,7 @@ namespace NMR {
 
 	nfUint32 fnStringToUint32(_In_z_ const nfChar * pszValue)
 	{
+		NMR_STATISTICS_SAMPLEDTIMER(escNumberParsingTime);
 		__NMRASSERT(pszValue);
 		nfUint64 nResult = 0;
 
@@ -151,6 +154,7 @@ namespace NMR {
 
 	nfDouble fnStringToDouble(_In_z_ const nfChar * pszValue)
 	{
+		NMR_STATISTICS_SAMPLEDTIMER(escNumberParsingTime);
 		__NMRASSERT(pwszValue);
 		nfDouble dResult = 0.0;
 
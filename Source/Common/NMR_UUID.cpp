@@ -52,14 +52,69 @@ NMR_UUID.cpp implements a datatype and functions to handle UUIDs
 
 #ifdef GUID_CUSTOM
 #include <ctime>
+#include <random>
+#include <thread>
 #endif
 
 namespace NMR
 {
 
 #ifdef GUID_CUSTOM
-	std::mutex CUUID::S_uuid_gen_mutex;
-	std::unique_ptr<std::mt19937> CUUID::S_mtwister;
+	// Every thread owns its generator, so UUID creation never synchronizes between threads
+	class CUUIDRandomGenerator {
+	private:
+		std::mt19937_64 m_Twister;
+	public:
+		CUUIDRandomGenerator()
+		{
+			std::random_device rand_dev;
+			// Prepare seed data. The thread ID keeps generators apart if random_device is deterministic.
+			uint32_t l_seed_data[std::mt19937_64::state_size * 2];
+			uint32_t l_cur_time = static_cast<uint32_t>(time(nullptr));
+			uint32_t l_thread_id = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+			for (size_t i = 0; i < std::mt19937_64::state_size * 2; ++i)
+			{
+				l_seed_data[i] = rand_dev() ^ l_cur_time ^ l_thread_id;
+			}
+
+			std::seed_seq l_seed_seq(std::begin(l_seed_data), std::end(l_seed_data));
+			m_Twister.seed(l_seed_seq);
+		}
+
+		nfUint64 next()
+		{
+			return m_Twister();
+		}
+	};
+
+	static CUUIDRandomGenerator & fnGetUUIDRandomGenerator()
+	{
+		static thread_local CUUIDRandomGenerator Generator;
+		return Generator;
+	}
+
+	void CUUID::setRandom(_In_ nfUint64 nHigh, _In_ nfUint64 nLow)
+	{
+		// generation of a v4 UUID according to https://tools.ietf.org/html/rfc4122#section-4.4
+		nHigh = (nHigh & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL; // set version 4
+		nLow = (nLow & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL; // set variant 10xx
+
+		const nfChar* hexaDec = "0123456789abcdef";
+		nfChar string[37];
+		nfUint32 nPosition = 0;
+		for (int i = 60; i >= 0; i -= 4) {
+			if ((nPosition == 8) || (nPosition == 13))
+				string[nPosition++] = '-';
+			string[nPosition++] = hexaDec[(nHigh >> i) & 0xF];
+		}
+		string[nPosition++] = '-';
+		for (int i = 60; i >= 0; i -= 4) {
+			if (nPosition == 23)
+				string[nPosition++] = '-';
+			string[nPosition++] = hexaDec[(nLow >> i) & 0xF];
+		}
+		m_sUUID.assign(string, 36);
+	}
 #endif
 
 	CUUID::CUUID()
@@ -99,36 +154,9 @@ namespace NMR
 #endif
 
 #ifdef GUID_CUSTOM
-		std::lock_guard<std::mutex> l_lock(S_uuid_gen_mutex);
-		if (!S_mtwister)
-		{
-			S_mtwister.reset(new std::mt19937);
-			std::random_device rand_dev;
-			// Prepare seed data
-			uint32_t l_seed_data[std::mt19937::state_size];
-			uint32_t l_cur_time = static_cast<uint32_t>(time(nullptr));
-			for (size_t i = 0; i < std::mt19937::state_size; ++i)
-			{
-				l_seed_data[i] = rand_dev() ^ l_cur_time;
-			}
-
-			// Init Mersenne Twister pseudo-random generator
-			std::seed_seq l_seed_seq(std::begin(l_seed_data), std::end(l_seed_data));
-			S_mtwister->seed(l_seed_seq);
-		}
-
-		// generation of a v4 UUID according to https://tools.ietf.org/html/rfc4122#section-4.4
-		std::uniform_int_distribution<std::mt19937::result_type> distHexaDec(0, 15);
-		std::uniform_int_distribution<std::mt19937::result_type> dist4(0, 4);
-		const nfChar* hexaDec = "0123456789abcdef";
-		nfChar string[33];
-		for (int i = 0; i < 32; i++)
-			string[i] = hexaDec[distHexaDec(*S_mtwister)];
-		string[12] = hexaDec[4]; // set version 4
-		string[16] = hexaDec[8 + dist4(*S_mtwister)];
-		string[32] = 0;
-
-		set(string);
+		CUUIDRandomGenerator & Generator = fnGetUUIDRandomGenerator();
+		nfUint64 nHigh = Generator.next();
+		setRandom(nHigh, Generator.next());
 #endif
 	}
 
@@ -183,4 +211,22 @@ namespace NMR
 		return m_sUUID == uuid.m_sUUID;
 	}
 
+	void CUUID::generate(_In_ nfUint32 nCount, _Out_ std::vector<CUUID> & UUIDs)
+	{
+		UUIDs.clear();
+		UUIDs.reserve(nCount);
+#ifdef GUID_CUSTOM
+		CUUIDRandomGenerator & Generator = fnGetUUIDRandomGenerator();
+		CUUID uuid("00000000-0000-0000-0000-000000000000");
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			nfUint64 nHigh = Generator.next();
+			uuid.setRandom(nHigh, Generator.next());
+			UUIDs.push_back(uuid);
+		}
+#else
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++)
+			UUIDs.push_back(CUUID());
+#endif
+	}
+
 }
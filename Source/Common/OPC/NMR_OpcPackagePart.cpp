@@ -37,6 +37,14 @@ NMR_OpcPackagePart.cpp implements an OPC Package Part in a portable way.
 
 namespace NMR {
 
+	COpcPackagePart::COpcPackagePart(_In_ std::string sURI)
+	{
+		if (sURI.length() == 0)
+			throw CNMRException(NMR_ERROR_INVALIDOPCPARTURI);
+
+		m_sURI = sURI;
+	}
+
 	COpcPackagePart::COpcPackagePart(_In_ std::string sURI, _In_ PExportStream pExportStream)
 	{
 		if (pExportStream.get() == nullptr)
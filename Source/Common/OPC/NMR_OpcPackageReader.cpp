@@ -112,6 +112,7 @@ namespace NMR {
 		if (!pProgressMonitor)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
+		m_pImportStream = pImportStream;
 		m_ZIPError.str = nullptr;
 		m_ZIPError.sys_err = 0;
 		m_ZIPError.zip_err = 0;
@@ -317,6 +318,52 @@ namespace NMR {
 		return Stat.size;
 	}
 
+	nfBool COpcPackageReader::getRawPartInfo(_In_ std::string sPath, _Out_ ZIPRAWENTRYINFO & RawEntryInfo)
+	{
+		std::string sRealPath = fnRemoveLeadingPathDelimiter(sPath);
+		auto iIterator = m_ZIPEntries.find(sRealPath);
+		if (iIterator == m_ZIPEntries.end())
+			return false;
+
+		zip_stat_t Stat;
+		nfInt32 nResult = zip_stat_index(m_ZIParchive, iIterator->second, ZIP_FL_UNCHANGED, &Stat);
+		if (nResult != 0)
+			throw CNMRException(NMR_ERROR_COULDNOTSTATZIPENTRY);
+
+		zip_uint64_t nRequiredFields = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_CRC | ZIP_STAT_COMP_METHOD | ZIP_STAT_ENCRYPTION_METHOD;
+		if ((Stat.valid & nRequiredFields) != nRequiredFields)
+			return false;
+		if (Stat.encryption_method != ZIP_EM_NONE)
+			return false;
+		if ((Stat.comp_method != ZIP_CM_STORE) && (Stat.comp_method != ZIP_CM_DEFLATE))
+			return false;
+
+		RawEntryInfo.m_nCompressionMethod = (nfUint16)Stat.comp_method;
+		RawEntryInfo.m_nCRC32 = Stat.crc;
+		RawEntryInfo.m_nCompressedSize = Stat.comp_size;
+		RawEntryInfo.m_nUncompressedSize = Stat.size;
+		return true;
+	}
+
+	PImportStream COpcPackageReader::openRawPart(_In_ std::string sPath)
+	{
+		std::string sRealPath = fnRemoveLeadingPathDelimiter(sPath);
+		auto iIterator = m_ZIPEntries.find(sRealPath);
+		if (iIterator == m_ZIPEntries.end())
+			throw CNMRException(NMR_ERROR_COULDNOTOPENZIPENTRY);
+
+		zip_stat_t Stat;
+		nfInt32 nResult = zip_stat_index(m_ZIParchive, iIterator->second, ZIP_FL_UNCHANGED, &Stat);
+		if (nResult != 0)
+			throw CNMRException(NMR_ERROR_COULDNOTSTATZIPENTRY);
+
+		zip_file_t * pFile = zip_fopen_index(m_ZIParchive, iIterator->second, ZIP_FL_UNCHANGED | ZIP_FL_COMPRESSED);
+		if (pFile == nullptr)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENZIPENTRY);
+
+		return std::make_shared<CImportStream_ZIP>(pFile, Stat.comp_size);
+	}
+
 	POpcPackagePart COpcPackageReader::createPart(_In_ std::string sPath)
 	{
 		std::string sRealPath = fnRemoveLeadingPathDelimiter (sPath);
@@ -70,6 +70,17 @@ namespace NMR {
 		return pPart;
 	}
 
+	POpcPackagePart COpcPackageWriter::addRawPart(_In_ std::string sPath, _In_ const ZIPRAWENTRYINFO & RawEntryInfo, _In_ CImportStream * pCompressedStream)
+	{
+		sPath = fnRemoveLeadingPathDelimiter(sPath);
+
+		m_pZIPWriter->writeRawEntry(sPath, fnGetUnixTime(), RawEntryInfo, pCompressedStream);
+		POpcPackagePart pPart = std::make_shared<COpcPackagePart>(sPath);
+		m_Parts.push_back(pPart);
+
+		return pPart;
+	}
+
 	void COpcPackageWriter::addContentType(_In_ std::string sExtension, _In_ std::string sContentType)
 	{
 		m_DefaultContentTypes.insert(std::make_pair(sExtension, sContentType));
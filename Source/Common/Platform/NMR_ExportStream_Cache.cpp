@@ -0,0 +1,249 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ExportStream_Cache.cpp implements an export stream that keeps the written data in memory
+and moves it to a temporary file once it exceeds a size threshold.
+
+--*/
+
+#include "Common/Platform/NMR_ExportStream_Cache.h"
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/Platform/NMR_ExportStream_Dummy.h"
+#include "Common/Platform/NMR_Platform.h"
+#include "Common/NMR_Exception.h"
+
+#include <vector>
+#include <limits>
+
+namespace NMR {
+
+	CExportStreamCache::CExportStreamCache(_In_ nfUint64 nSpillThreshold)
+	{
+		m_pMemoryStream = std::make_shared<CExportStreamMemory>();
+		m_nSpillThreshold = nSpillThreshold;
+		m_nSpillFileSize = 0;
+		m_bDiscarded = false;
+	}
+
+	CExportStreamCache::CExportStreamCache(_In_ PExportStreamMemory pMemoryStream)
+	{
+		if (pMemoryStream == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		m_pMemoryStream = pMemoryStream;
+		m_nSpillThreshold = std::numeric_limits<nfUint64>::max();
+		m_nSpillFileSize = 0;
+		m_bDiscarded = false;
+	}
+
+	CExportStreamCache::~CExportStreamCache()
+	{
+		if (!m_sSpillFileName.empty()) {
+			m_pSpillStream = nullptr;
+			fnDeleteFile(m_sSpillFileName.c_str());
+		}
+	}
+
+	void CExportStreamCache::spillToFile()
+	{
+		__NMRASSERT(m_sSpillFileName.empty());
+
+		nfUint64 nPosition = m_pMemoryStream->getPosition();
+		m_nSpillFileSize = m_pMemoryStream->getDataSize();
+		try {
+			m_sSpillFileName = fnCreateUniqueFile(fnGetTempDirectory() + "lib3mf_", true);
+			m_pSpillStream = fnCreateExportStreamInstance(m_sSpillFileName.c_str());
+
+			nfUint32 nChunkCount = m_pMemoryStream->getChunkCount();
+			for (nfUint32 nIndex = 0; nIndex < nChunkCount; nIndex++) {
+				nfUint64 cbChunkSize;
+				const nfByte * pChunk = m_pMemoryStream->getChunk(nIndex, cbChunkSize);
+				m_pSpillStream->writeBuffer(pChunk, cbChunkSize);
+			}
+			m_pSpillStream->seekPosition(nPosition, true);
+		}
+		catch (...) {
+			discardData(nPosition);
+		}
+		m_pMemoryStream = nullptr;
+	}
+
+	void CExportStreamCache::discardData(_In_ nfUint64 nPosition)
+	{
+		m_pSpillStream = nullptr;
+		if (!m_sSpillFileName.empty()) {
+			fnDeleteFile(m_sSpillFileName.c_str());
+			m_sSpillFileName.clear();
+		}
+
+		// The dummy stream only counts the bytes, it does not read them
+		nfByte nDummyByte = 0;
+		m_pSpillStream = std::make_shared<CExportStreamDummy>();
+		m_pSpillStream->writeBuffer(&nDummyByte, m_nSpillFileSize);
+		if (nPosition < m_nSpillFileSize)
+			m_pSpillStream->seekPosition(nPosition, true);
+		m_bDiscarded = true;
+	}
+
+	CExportStream * CExportStreamCache::spillStream()
+	{
+		// The spill file has been closed for replaying
+		if (!m_pSpillStream)
+			throw CNMRException(NMR_ERROR_COULDNOTWRITESTREAM);
+		return m_pSpillStream.get();
+	}
+
+	PImportStream CExportStreamCache::openSpillFile()
+	{
+		// Closing the export stream flushes all data to the file
+		m_pSpillStream = nullptr;
+		return fnCreateImportStreamInstance(m_sSpillFileName.c_str());
+	}
+
+	nfBool CExportStreamCache::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed)
+	{
+		if (m_pMemoryStream)
+			return m_pMemoryStream->seekPosition(position, bHasToSucceed);
+		return spillStream()->seekPosition(position, bHasToSucceed);
+	}
+
+	nfBool CExportStreamCache::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (m_pMemoryStream)
+			return m_pMemoryStream->seekForward(bytes, bHasToSucceed);
+		return spillStream()->seekForward(bytes, bHasToSucceed);
+	}
+
+	nfBool CExportStreamCache::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (m_pMemoryStream)
+			return m_pMemoryStream->seekFromEnd(bytes, bHasToSucceed);
+		if (m_bDiscarded)
+			return spillStream()->seekFromEnd(bytes, bHasToSucceed);
+		if (bytes > m_nSpillFileSize) {
+			if (bHasToSucceed)
+				throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+			return false;
+		}
+		return spillStream()->seekPosition(m_nSpillFileSize - bytes, bHasToSucceed);
+	}
+
+	nfUint64 CExportStreamCache::getPosition()
+	{
+		if (m_pMemoryStream)
+			return m_pMemoryStream->getPosition();
+		return spillStream()->getPosition();
+	}
+
+	nfUint64 CExportStreamCache::writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite)
+	{
+		if (pBuffer == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (m_pMemoryStream) {
+			if (m_pMemoryStream->getPosition() + cbTotalBytesToWrite <= m_nSpillThreshold)
+				return m_pMemoryStream->writeBuffer(pBuffer, cbTotalBytesToWrite);
+			spillToFile();
+		}
+
+		CExportStream * pSpillStream = spillStream();
+		nfUint64 nPosition = pSpillStream->getPosition();
+		nfUint64 nEndPosition = nPosition + cbTotalBytesToWrite;
+		try {
+			pSpillStream->writeBuffer(pBuffer, cbTotalBytesToWrite);
+		}
+		catch (...) {
+			// The temporary directory ran out of space; keep counting instead of failing the export
+			if (m_bDiscarded)
+				throw;
+			discardData(nPosition);
+			spillStream()->writeBuffer(pBuffer, cbTotalBytesToWrite);
+		}
+		if (nEndPosition > m_nSpillFileSize)
+			m_nSpillFileSize = nEndPosition;
+
+		return cbTotalBytesToWrite;
+	}
+
+	nfUint64 CExportStreamCache::getDataSize()
+	{
+		if (m_pMemoryStream)
+			return m_pMemoryStream->getDataSize();
+		return m_nSpillFileSize;
+	}
+
+	nfBool CExportStreamCache::isSpilled()
+	{
+		return !m_sSpillFileName.empty();
+	}
+
+	nfBool CExportStreamCache::isReplayable()
+	{
+		return !m_bDiscarded;
+	}
+
+	void CExportStreamCache::copyToBuffer(_Out_ nfByte * pBuffer, _In_ nfUint64 cbBufferSize)
+	{
+		if (pBuffer == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (m_pMemoryStream) {
+			m_pMemoryStream->copyToBuffer(pBuffer, cbBufferSize);
+			return;
+		}
+		if (m_bDiscarded)
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+
+		nfUint64 cbBytesToRead = (cbBufferSize < m_nSpillFileSize) ? cbBufferSize : m_nSpillFileSize;
+		PImportStream pReadStream = openSpillFile();
+		pReadStream->readIntoBuffer(pBuffer, cbBytesToRead, true);
+	}
+
+	void CExportStreamCache::copyToStream(_In_ CExportStream * pStream)
+	{
+		if (pStream == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (m_pMemoryStream) {
+			m_pMemoryStream->copyToStream(pStream);
+			return;
+		}
+		if (m_bDiscarded)
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+
+		std::vector<nfByte> Buffer(NMR_EXPORTSTREAMCACHE_COPYBUFFERSIZE);
+		PImportStream pReadStream = openSpillFile();
+		nfUint64 cbBytesLeft = m_nSpillFileSize;
+		while (cbBytesLeft > 0) {
+			nfUint64 cbBytesToRead = (cbBytesLeft < Buffer.size()) ? cbBytesLeft : Buffer.size();
+			pReadStream->readIntoBuffer(Buffer.data(), cbBytesToRead, true);
+			pStream->writeBuffer(Buffer.data(), cbBytesToRead);
+			cbBytesLeft -= cbBytesToRead;
+		}
+	}
+
+}
@@ -37,15 +37,27 @@ namespace NMR {
 
 	nfUint64 CExportStream_Encrypted::writeBuffer(const void * pBuffer, nfUint64 cbTotalBytesToWrite)
 	{
+		// The plain text belongs to the caller, so it is encrypted chunk-wise into a buffer
+		// that lives as long as the stream
+		const nfByte * pPlain = (const nfByte *)pBuffer;
 		nfUint64 encryptedBytes = 0;
-		if (cbTotalBytesToWrite > 0) {
-			std::vector<nfByte> encryptBuffer((size_t) cbTotalBytesToWrite, 0);
-			encryptedBytes = m_pDecryptContext.m_fnCrypt(cbTotalBytesToWrite, (const nfByte *)pBuffer, encryptBuffer.data(), m_pDecryptContext.m_sDekDecryptData);
-			if (encryptedBytes > 0) {
-				auto writtenBytes = m_pEncryptedStream->writeBuffer(encryptBuffer.data(), encryptedBytes);
-				if (encryptedBytes != writtenBytes)
+		while (encryptedBytes < cbTotalBytesToWrite) {
+			nfUint64 chunkSize = cbTotalBytesToWrite - encryptedBytes;
+			if (chunkSize > KEYSTORE_TYPES_CRYPTBUFFERSIZE)
+				chunkSize = KEYSTORE_TYPES_CRYPTBUFFERSIZE;
+			if (m_Buffer.size() < chunkSize)
+				m_Buffer.resize((size_t)chunkSize);
+
+			nfUint64 chunkEncrypted = m_pDecryptContext.m_fnCrypt(chunkSize, pPlain + encryptedBytes, m_Buffer.data(), m_pDecryptContext.m_sDekDecryptData);
+			if (chunkEncrypted > 0) {
+				auto writtenBytes = m_pEncryptedStream->writeBuffer(m_Buffer.data(), chunkEncrypted);
+				if (chunkEncrypted != writtenBytes)
 					throw CNMRException(NMR_ERROR_CALCULATIONTERMINATED);
 			}
+			encryptedBytes += chunkEncrypted;
+
+			if (chunkEncrypted < chunkSize)
+				break;
 		}
 		return encryptedBytes;
 	}
@@ -32,15 +32,67 @@ NMR_ExportStream_Memory.cpp implements the ExportStream to Memory Class.
 
 #include "Common/Platform/NMR_ExportStream_Memory.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_Statistics.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace NMR {
 
 	CExportStreamMemory::CExportStreamMemory() {
+		m_nCapacity = 0;
+		m_nDataSize = 0;
 		m_Position = 0;
+		m_nCurrentChunk = 0;
+	}
+
+	void CExportStreamMemory::appendChunk(_In_ nfUint64 cbMinimumSize) {
+		nfUint64 cbChunkSize = NMR_EXPORTSTREAMMEMORY_INITIALCHUNKSIZE;
+		if (!m_Chunks.empty())
+			cbChunkSize = std::min<nfUint64>(m_Chunks.back().size() * 2, NMR_EXPORTSTREAMMEMORY_MAXCHUNKSIZE);
+		cbChunkSize = std::max(cbChunkSize, cbMinimumSize);
+
+		try {
+			m_Chunks.push_back(std::vector<nfByte>(static_cast<size_t>(cbChunkSize)));
+		}
+		catch (std::bad_alloc&) {
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+		}
+		m_ChunkOffsets.push_back(m_nCapacity);
+		m_nCapacity += cbChunkSize;
+
+		NMR_STATISTICS_ADD(escAllocations, 1);
+	}
+
+	nfUint32 CExportStreamMemory::findChunk(_In_ nfUint64 nPosition) {
+		__NMRASSERT(nPosition < m_nCapacity);
+
+		if (m_nCurrentChunk < m_Chunks.size()) {
+			nfUint64 nOffset = m_ChunkOffsets[m_nCurrentChunk];
+			if ((nPosition >= nOffset) && (nPosition < nOffset + m_Chunks[m_nCurrentChunk].size()))
+				return m_nCurrentChunk;
+		}
+
+		auto iOffset = std::upper_bound(m_ChunkOffsets.begin(), m_ChunkOffsets.end(), nPosition);
+		return (nfUint32)(iOffset - m_ChunkOffsets.begin()) - 1;
+	}
+
+	void CExportStreamMemory::flatten() {
+		if (m_Chunks.size() <= 1)
+			return;
+
+		std::vector<nfByte> Buffer(static_cast<size_t>(m_nCapacity));
+		copyToBuffer(Buffer.data(), m_nCapacity);
+
+		m_Chunks.clear();
+		m_Chunks.push_back(std::move(Buffer));
+		m_ChunkOffsets.clear();
+		m_ChunkOffsets.push_back(0);
+		m_nCurrentChunk = 0;
 	}
 
 	nfBool CExportStreamMemory::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed) {
-		if (position >= m_Buffer.size() && bHasToSucceed) {
+		if (position >= m_nDataSize && bHasToSucceed) {
 			throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
 		}
 		m_Position = position;
@@ -48,7 +100,7 @@ namespace NMR {
 	}
 
 	nfBool CExportStreamMemory::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed) {
-		if (bytes + m_Position >= m_Buffer.size() && bHasToSucceed) {
+		if (bytes + m_Position >= m_nDataSize && bHasToSucceed) {
 			throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
 		}
 		m_Position = bytes + m_Position;
@@ -56,10 +108,10 @@ namespace NMR {
 	}
 
 	nfBool CExportStreamMemory::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed) {
-		if (bytes >= m_Buffer.size() && bHasToSucceed) {
+		if (bytes >= m_nDataSize && bHasToSucceed) {
 			throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
 		}
-		m_Position = m_Buffer.size() - bytes;
+		m_Position = m_nDataSize - bytes;
 		return true;
 	}
 
@@ -68,23 +120,94 @@ namespace NMR {
 	}
 
 	nfUint64 CExportStreamMemory::writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite) {
-		nfByte *pByteBuffer = (nfByte *)pBuffer;
-		if ((m_Position + cbTotalBytesToWrite) > m_Buffer.size()) {
-			m_Buffer.resize(static_cast<size_t>(m_Position + cbTotalBytesToWrite));
+		const nfByte *pByteBuffer = (const nfByte *)pBuffer;
+		nfUint64 nEndPosition = m_Position + cbTotalBytesToWrite;
+		if (nEndPosition > m_nCapacity)
+			appendChunk(nEndPosition - m_nCapacity);
+
+		nfUint64 cbBytesLeft = cbTotalBytesToWrite;
+		while (cbBytesLeft > 0) {
+			m_nCurrentChunk = findChunk(m_Position);
+			std::vector<nfByte> & Chunk = m_Chunks[m_nCurrentChunk];
+			nfUint64 nChunkPosition = m_Position - m_ChunkOffsets[m_nCurrentChunk];
+			nfUint64 cbBytesToCopy = std::min<nfUint64>(cbBytesLeft, Chunk.size() - nChunkPosition);
+
+			memcpy(&Chunk[static_cast<size_t>(nChunkPosition)], pByteBuffer, static_cast<size_t>(cbBytesToCopy));
+			pByteBuffer += cbBytesToCopy;
+			cbBytesLeft -= cbBytesToCopy;
+			m_Position += cbBytesToCopy;
 		}
-		for (nfUint64 i = 0; i < cbTotalBytesToWrite; i++) {
-			m_Buffer[static_cast<size_t>(m_Position + i)] = pByteBuffer[i];
-		}
-		m_Position += cbTotalBytesToWrite;
+
+		if (m_Position > m_nDataSize)
+			m_nDataSize = m_Position;
 		return cbTotalBytesToWrite;
 	}
 
 	nfUint64 CExportStreamMemory::getDataSize() {
-		return m_Buffer.size();
+		return m_nDataSize;
 	}
 
 	const nfByte *CExportStreamMemory::getData() {
-		return m_Buffer.data();
+		flatten();
+		if (m_Chunks.empty())
+			return nullptr;
+		return m_Chunks[0].data();
+	}
+
+	nfUint32 CExportStreamMemory::getChunkCount() {
+		nfUint32 nCount = 0;
+		while ((nCount < m_Chunks.size()) && (m_ChunkOffsets[nCount] < m_nDataSize))
+			nCount++;
+		return nCount;
+	}
+
+	const nfByte * CExportStreamMemory::getChunk(_In_ nfUint32 nIndex, _Out_ nfUint64 & cbChunkSize) {
+		if (nIndex >= getChunkCount())
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+		cbChunkSize = std::min<nfUint64>(m_Chunks[nIndex].size(), m_nDataSize - m_ChunkOffsets[nIndex]);
+		return m_Chunks[nIndex].data();
+	}
+
+	void CExportStreamMemory::copyToBuffer(_Out_ nfByte * pBuffer, _In_ nfUint64 cbBufferSize) {
+		if (pBuffer == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint64 cbCopied = 0;
+		for (size_t nIndex = 0; (nIndex < m_Chunks.size()) && (cbCopied < cbBufferSize); nIndex++) {
+			nfUint64 cbBytesToCopy = std::min<nfUint64>(m_Chunks[nIndex].size(), cbBufferSize - cbCopied);
+			memcpy(pBuffer + cbCopied, m_Chunks[nIndex].data(), static_cast<size_t>(cbBytesToCopy));
+			cbCopied += cbBytesToCopy;
+		}
+	}
+
+	void CExportStreamMemory::copyToStream(_In_ CExportStream * pStream) {
+		if (pStream == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint32 nChunkCount = getChunkCount();
+		for (nfUint32 nIndex = 0; nIndex < nChunkCount; nIndex++) {
+			nfUint64 cbChunkSize;
+			const nfByte * pChunk = getChunk(nIndex, cbChunkSize);
+			pStream->writeBuffer(pChunk, cbChunkSize);
+		}
+	}
+
+	std::vector<nfByte> CExportStreamMemory::releaseData() {
+		flatten();
+
+		std::vector<nfByte> Buffer;
+		if (!m_Chunks.empty())
+			Buffer = std::move(m_Chunks[0]);
+		Buffer.resize(static_cast<size_t>(m_nDataSize));
+
+		m_Chunks.clear();
+		m_ChunkOffsets.clear();
+		m_nCapacity = 0;
+		m_nDataSize = 0;
+		m_Position = 0;
+		m_nCurrentChunk = 0;
+		return Buffer;
 	}
 
-}
\ No newline at end of file
+}
@@ -32,6 +32,7 @@ NMR_PortableZIPWriter.cpp implements a portable stream to write into ZIP files
 
 #include "Common/Platform/NMR_ExportStream_ZIP.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_Statistics.h"
  
 namespace NMR {
 
@@ -111,6 +112,9 @@ namespace NMR {
 		if (!m_bIsInitialized)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
 
+		NMR_STATISTICS_TIMER(escZIPTime);
+		NMR_STATISTICS_ADD(escBytesOut, cbTotalBytesToWrite);
+
 		nfUint64 cbCount = cbTotalBytesToWrite;
 		const nfByte * pByte = (const nfByte *)pBuffer;
 
@@ -163,6 +167,8 @@ namespace NMR {
 		if (!m_bIsInitialized)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
 
+		NMR_STATISTICS_TIMER(escZIPTime);
+
 		m_pStream.next_in = nullptr;
 		m_pStream.avail_in = 0;
 
@@ -37,11 +37,14 @@ This is a stream class for importing from a compressed object.
 
 namespace NMR {
 
-	CImportStream_Compressed::CImportStream_Compressed(PImportStream pCompressedStream)
+	CImportStream_Compressed::CImportStream_Compressed(PImportStream pCompressedStream, nfUint32 nChunkSize)
 	{
 		if (nullptr == pCompressedStream)
 			throw CNMRException(NMR_ERROR_INVALIDPOINTER);
+		if (nChunkSize == 0)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		m_pCompressedStream = pCompressedStream;
+		m_compressedBuffer.resize(nChunkSize);
 
 		// Source: http://zlib.net/zpipe.c
 		m_strm.zalloc = Z_NULL;
@@ -81,35 +84,38 @@ namespace NMR {
 
 	nfUint64 CImportStream_Compressed::readIntoBuffer(nfByte * pBuffer, nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll)
 	{
-		nfBool firstRead = m_strm.next_in == Z_NULL;
-		nfBool hasDecompressLeftovers = m_strm.avail_out == 0;
-		if (firstRead || !hasDecompressLeftovers) {
-			m_strm.avail_in = (nfUint32) m_pCompressedStream->readIntoBuffer(in, IMPORTSTREAM_COMPRESSED_CHUNKSIZE, bNeedsToReadAll);
-			if (m_strm.avail_in == 0)
-				return 0;
-			m_strm.next_in = in;
-		}
+		nfUint64 bytesDecompressed = 0;
+		while (true) {
+			nfBool firstRead = m_strm.next_in == Z_NULL;
+			nfBool hasDecompressLeftovers = m_strm.avail_out == 0;
+			if (firstRead || !hasDecompressLeftovers) {
+				m_strm.avail_in = (nfUint32) m_pCompressedStream->readIntoBuffer(m_compressedBuffer.data(), m_compressedBuffer.size(), bNeedsToReadAll);
+				if (m_strm.avail_in == 0)
+					return bytesDecompressed;
+				m_strm.next_in = m_compressedBuffer.data();
+			}
 
-		m_strm.avail_out = (nfUint32) cbTotalBytesToRead;
-		m_strm.next_out = pBuffer;
-		nfInt32 ret = inflate(&m_strm, Z_NO_FLUSH);
-		switch (ret) {
-		case Z_NEED_DICT:
-		case Z_DATA_ERROR:
-		case Z_MEM_ERROR:
-			(void)inflateEnd(&m_strm);
-			throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
-		}
-		if (m_strm.avail_out == 0) {
-			nfBool reachedEndOfBuffer = m_strm.avail_in == 0;
-			if (reachedEndOfBuffer && ret != Z_STREAM_END) {
+			nfUint64 bytesRequested = cbTotalBytesToRead - bytesDecompressed;
+			m_strm.avail_out = (nfUint32) bytesRequested;
+			m_strm.next_out = pBuffer + bytesDecompressed;
+			nfInt32 ret = inflate(&m_strm, Z_NO_FLUSH);
+			switch (ret) {
+			case Z_NEED_DICT:
+			case Z_DATA_ERROR:
+			case Z_MEM_ERROR:
+				(void)inflateEnd(&m_strm);
 				throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
 			}
-			return cbTotalBytesToRead;
-		}
+			if (m_strm.avail_out == 0) {
+				nfBool reachedEndOfBuffer = m_strm.avail_in == 0;
+				if (reachedEndOfBuffer && ret != Z_STREAM_END) {
+					throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+				}
+				return cbTotalBytesToRead;
+			}
 
-		nfUint64 bytesDecompressed = cbTotalBytesToRead - m_strm.avail_out;
-		return readIntoBuffer(pBuffer + bytesDecompressed, m_strm.avail_out, bNeedsToReadAll) + bytesDecompressed;
+			bytesDecompressed += bytesRequested - m_strm.avail_out;
+		}
 	}
 	
 	nfUint64 CImportStream_Compressed::retrieveSize()
@@ -60,14 +60,37 @@ namespace NMR {
 	}
 
 	nfUint64 CImportStream_Encrypted::readIntoBuffer(nfByte * pBuffer, nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll) {
-		std::vector<nfByte> decBuffer((size_t)cbTotalBytesToRead, 0);
-		nfUint64 bytesRead = m_pEncryptedStream->readIntoBuffer(decBuffer.data(), cbTotalBytesToRead, bNeedsToReadAll);
-		if (bytesRead > 0) {
-			nfUint64 decryted = m_pDecryptContext.m_fnCrypt(bytesRead, decBuffer.data(), pBuffer, m_pDecryptContext.m_sDekDecryptData);
-			if (decryted != bytesRead)
-				throw CNMRException(NMR_ERROR_CALCULATIONTERMINATED);
+		if (m_pDecryptContext.m_bInPlace) {
+			nfUint64 bytesRead = m_pEncryptedStream->readIntoBuffer(pBuffer, cbTotalBytesToRead, bNeedsToReadAll);
+			if (bytesRead > 0) {
+				nfUint64 decrypted = m_pDecryptContext.m_fnCrypt(bytesRead, pBuffer, pBuffer, m_pDecryptContext.m_sDekDecryptData);
+				if (decrypted != bytesRead)
+					throw CNMRException(NMR_ERROR_CALCULATIONTERMINATED);
+			}
+			return bytesRead;
 		}
-		return bytesRead;
+
+		// The cipher text is read in chunks into a buffer that lives as long as the stream
+		nfUint64 totalBytesRead = 0;
+		while (totalBytesRead < cbTotalBytesToRead) {
+			nfUint64 chunkSize = cbTotalBytesToRead - totalBytesRead;
+			if (chunkSize > KEYSTORE_TYPES_CRYPTBUFFERSIZE)
+				chunkSize = KEYSTORE_TYPES_CRYPTBUFFERSIZE;
+			if (m_Buffer.size() < chunkSize)
+				m_Buffer.resize((size_t)chunkSize);
+
+			nfUint64 bytesRead = m_pEncryptedStream->readIntoBuffer(m_Buffer.data(), chunkSize, bNeedsToReadAll);
+			if (bytesRead > 0) {
+				nfUint64 decrypted = m_pDecryptContext.m_fnCrypt(bytesRead, m_Buffer.data(), pBuffer + totalBytesRead, m_pDecryptContext.m_sDekDecryptData);
+				if (decrypted != bytesRead)
+					throw CNMRException(NMR_ERROR_CALCULATIONTERMINATED);
+			}
+			totalBytesRead += bytesRead;
+
+			if (bytesRead < chunkSize)
+				break;
+		}
+		return totalBytesRead;
 	}
 
 	nfUint64 CImportStream_Encrypted::retrieveSize() {
@@ -118,6 +118,16 @@ namespace NMR {
 		}
 	}	
 
+	CImportStream_Unique_Memory::CImportStream_Unique_Memory(_In_ std::vector<nfByte> && Buffer)
+	{
+		if (Buffer.size() > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		m_Buffer = std::move(Buffer);
+		m_cbSize = m_Buffer.size();
+		m_nPosition = 0;
+	}
+
 	PImportStream CImportStream_Unique_Memory::copyToMemory()
 	{
 		__NMRASSERT(m_nPosition <= m_cbSize);
@@ -35,6 +35,7 @@ This is a stream class for importing from a libZIP object.
 #include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
+#include "Common/NMR_Statistics.h"
 #include <cmath>
 #include <vector>
 
@@ -78,6 +79,8 @@ namespace NMR {
 
 	nfUint64 CImportStream_ZIP::readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll)
 	{
+		NMR_STATISTICS_TIMER(escZIPTime);
+
 		nfUint64 cbBytesLeft = cbTotalBytesToRead;
 		nfUint64 cbBytesRead = 0;
 
@@ -109,6 +112,8 @@ namespace NMR {
 				throw CNMRException(NMR_ERROR_COULDNOTREADFULLDATA);
 		}
 
+		NMR_STATISTICS_ADD(escBytesIn, cbBytesRead);
+
 		return (nfUint64)cbBytesRead;
 	}
 
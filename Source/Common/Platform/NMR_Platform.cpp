@@ -36,11 +36,24 @@ specific classes.
 
 
 #define NMR_PLATFORM_XMLREADER_BUFFERSIZE 65536
+#define NMR_PLATFORM_UNIQUEFILEATTEMPTS 16
 
 #include "Common/Platform/NMR_ImportStream_Native.h"
 #include "Common/Platform/NMR_ExportStream_Native.h"
 #include "Common/Platform/NMR_XmlReader_Native.h"
 #include "Common/NMR_StringUtils.h"
+#include "Common/NMR_UUID.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 
 namespace NMR {
@@ -62,4 +75,76 @@ namespace NMR {
 		return std::make_shared<CXmlReader_Native> (pImportStream, NMR_PLATFORM_XMLREADER_BUFFERSIZE, pProgressMonitor);
 	}
 
+	void fnReplaceFile(_In_ const nfChar * pszSourceFileName, _In_ const nfChar * pszTargetFileName)
+	{
+		if ((pszSourceFileName == nullptr) || (pszTargetFileName == nullptr))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+		std::wstring sSourceFileName = fnUTF8toUTF16(pszSourceFileName);
+		std::wstring sTargetFileName = fnUTF8toUTF16(pszTargetFileName);
+		if (!MoveFileExW(sSourceFileName.c_str(), sTargetFileName.c_str(), MOVEFILE_REPLACE_EXISTING))
+			throw CNMRException(NMR_ERROR_COULDNOTCREATEFILE);
+#else
+		if (std::rename(pszSourceFileName, pszTargetFileName) != 0)
+			throw CNMRException(NMR_ERROR_COULDNOTCREATEFILE);
+#endif
+	}
+
+	nfBool fnDeleteFile(_In_ const nfChar * pszFileName)
+	{
+		if (pszFileName == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+		std::wstring sFileName = fnUTF8toUTF16(pszFileName);
+		return (_wremove(sFileName.c_str()) == 0);
+#else
+		return (std::remove(pszFileName) == 0);
+#endif
+	}
+
+	std::string fnGetTempDirectory()
+	{
+#if defined(_WIN32) && !defined(__MINGW32__)
+		wchar_t pBuffer[MAX_PATH + 1];
+		DWORD nLength = GetTempPathW(MAX_PATH + 1, pBuffer);
+		if ((nLength == 0) || (nLength > MAX_PATH))
+			throw CNMRException(NMR_ERROR_COULDNOTCREATEFILE);
+		return fnUTF16toUTF8(std::wstring(pBuffer, nLength));
+#else
+		const char * pszDirectory = getenv("TMPDIR");
+		std::string sDirectory = ((pszDirectory != nullptr) && (*pszDirectory != 0)) ? pszDirectory : "/tmp";
+		if (sDirectory.back() != '/')
+			sDirectory += "/";
+		return sDirectory;
+#endif
+	}
+
+	std::string fnCreateUniqueFile(_In_ const std::string & sPrefix, _In_ nfBool bPrivate)
+	{
+		for (nfUint32 nAttempt = 0; nAttempt < NMR_PLATFORM_UNIQUEFILEATTEMPTS; nAttempt++) {
+			std::string sFileName = sPrefix + CUUID().toString() + ".tmp";
+#if defined(_WIN32) && !defined(__MINGW32__)
+			std::wstring sWideFileName = fnUTF8toUTF16(sFileName.c_str());
+			HANDLE hFile = CreateFileW(sWideFileName.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (hFile != INVALID_HANDLE_VALUE) {
+				CloseHandle(hFile);
+				return sFileName;
+			}
+			if (GetLastError() != ERROR_FILE_EXISTS)
+				break;
+#else
+			int nFile = open(sFileName.c_str(), O_WRONLY | O_CREAT | O_EXCL, bPrivate ? 0600 : 0666);
+			if (nFile >= 0) {
+				close(nFile);
+				return sFileName;
+			}
+			if (errno != EEXIST)
+				break;
+#endif
+		}
+		throw CNMRException(NMR_ERROR_COULDNOTCREATEFILE);
+	}
+
 }
@@ -35,6 +35,8 @@ NMR_PortableZIPWriter.cpp implements a portable and fast writer of ZIP files
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_StringUtils.h"
 
+#include <vector>
+
 namespace NMR {
 
 	CPortableZIPWriter::CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64)
@@ -69,13 +71,8 @@ namespace NMR {
 			writeDirectory();
 	}
 
-	PExportStream CPortableZIPWriter::createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp)
+	PPortableZIPWriterEntry CPortableZIPWriter::writeLocalFileHeader(_In_ const std::string sName, _In_opt_ const ZIPRAWENTRYINFO * pRawEntryInfo)
 	{
-		if (m_bIsFinished)
-			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
-		// Finish old entry state
-		closeEntry();
-
 		// Initialize new entry state
 		m_nCurrentEntryKey = m_nNextEntryKey;
 		m_nNextEntryKey++;
@@ -118,6 +115,25 @@ namespace NMR {
 		zip64ExtraInformation.m_nCompressedSize = 0;
 		zip64ExtraInformation.m_nUncompressedSize = 0;
 
+		// Raw entries know their final sizes upfront
+		if (pRawEntryInfo != nullptr) {
+			LocalHeader.m_nCompressionMethod = pRawEntryInfo->m_nCompressionMethod;
+			LocalHeader.m_nCRC32 = pRawEntryInfo->m_nCRC32;
+			if (m_bWriteZIP64) {
+				LocalHeader.m_nCompressedSize = 0xFFFFFFFF;
+				LocalHeader.m_nUnCompressedSize = 0xFFFFFFFF;
+				zip64ExtraInformation.m_nCompressedSize = pRawEntryInfo->m_nCompressedSize;
+				zip64ExtraInformation.m_nUncompressedSize = pRawEntryInfo->m_nUncompressedSize;
+			}
+			else {
+				if ((pRawEntryInfo->m_nCompressedSize > ZIPFILEMAXIMUMSIZENON64) ||
+					(pRawEntryInfo->m_nUncompressedSize > ZIPFILEMAXIMUMSIZENON64))
+					throw CNMRException(NMR_ERROR_ZIPENTRYNON64_TOOLARGE);
+				LocalHeader.m_nCompressedSize = (nfUint32)pRawEntryInfo->m_nCompressedSize;
+				LocalHeader.m_nUnCompressedSize = (nfUint32)pRawEntryInfo->m_nUncompressedSize;
+			}
+		}
+
 		// Write data to ZIP stream
 		nfUint64 nFilePosition = m_pExportStream->getPosition();
 		
@@ -139,14 +155,57 @@ namespace NMR {
 		nfUint64 nDataPosition = m_pExportStream->getPosition();
 
 		// create list entry
-		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition);
-		m_Entries.push_back(m_pCurrentEntry);
+		PPortableZIPWriterEntry pEntry;
+		if (pRawEntryInfo != nullptr)
+			pEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition, *pRawEntryInfo);
+		else
+			pEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition);
+		m_Entries.push_back(pEntry);
+
+		return pEntry;
+	}
+
+	PExportStream CPortableZIPWriter::createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp)
+	{
+		if (m_bIsFinished)
+			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+		// Finish old entry state
+		closeEntry();
+
+		m_pCurrentEntry = writeLocalFileHeader(sName, nullptr);
 
 		// Return new ZIP Entry stream
 		m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey);
 		return m_pCurrentStream;
 	}
 
+	void CPortableZIPWriter::writeRawEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ const ZIPRAWENTRYINFO & RawEntryInfo, _In_ CImportStream * pCompressedStream)
+	{
+		if (m_bIsFinished)
+			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+		if (pCompressedStream == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if ((RawEntryInfo.m_nCompressionMethod != ZIPFILECOMPRESSION_UNCOMPRESSED) && (RawEntryInfo.m_nCompressionMethod != ZIPFILECOMPRESSION_DEFLATED))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		// Finish old entry state
+		closeEntry();
+
+		writeLocalFileHeader(sName, &RawEntryInfo);
+		m_nCurrentEntryKey = 0;
+
+		// Copy the compressed data verbatim
+		std::vector<nfByte> Buffer;
+		Buffer.resize(ZIPRAWENTRY_BUFFERSIZE);
+
+		nfUint64 cbBytesLeft = RawEntryInfo.m_nCompressedSize;
+		while (cbBytesLeft > 0) {
+			nfUint32 cbBytesToCopy = (cbBytesLeft > ZIPRAWENTRY_BUFFERSIZE) ? ZIPRAWENTRY_BUFFERSIZE : (nfUint32)cbBytesLeft;
+			pCompressedStream->readIntoBuffer(Buffer.data(), cbBytesToCopy, true);
+			m_pExportStream->writeBuffer(Buffer.data(), cbBytesToCopy);
+			cbBytesLeft -= cbBytesToCopy;
+		}
+	}
+
 	void CPortableZIPWriter::closeEntry()
 	{
 		if (m_bIsFinished)
@@ -271,7 +330,7 @@ namespace NMR {
 			DirectoryHeader.m_nVersionMade = m_nVersionMade;
 			DirectoryHeader.m_nVersionNeeded = m_nVersionNeeded;
 			DirectoryHeader.m_nGeneralPurposeFlags = 0;
-			DirectoryHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+			DirectoryHeader.m_nCompressionMethod = pEntry->getCompressionMethod();
 			DirectoryHeader.m_nLastModTime = pEntry->getLastModTime();
 			DirectoryHeader.m_nLastModDate = pEntry->getLastModDate();
 			DirectoryHeader.m_nCRC32 = pEntry->getCRC32();
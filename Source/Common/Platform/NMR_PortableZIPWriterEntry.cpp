@@ -41,6 +41,7 @@ namespace NMR {
 	CPortableZIPWriterEntry::CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition)
 	{
 		m_sUTF8Name = sUTF8Name;
+		m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
 		m_nCRC32 = 0;
 		m_nCompressedSize = 0;
 		m_nUncompressedSize = 0;
@@ -51,11 +52,30 @@ namespace NMR {
 		m_nDataPosition = nDataPosition;
 	}
 
+	CPortableZIPWriterEntry::CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition, _In_ const ZIPRAWENTRYINFO & RawEntryInfo)
+	{
+		m_sUTF8Name = sUTF8Name;
+		m_nCompressionMethod = RawEntryInfo.m_nCompressionMethod;
+		m_nCRC32 = RawEntryInfo.m_nCRC32;
+		m_nCompressedSize = RawEntryInfo.m_nCompressedSize;
+		m_nUncompressedSize = RawEntryInfo.m_nUncompressedSize;
+		m_nLastModTime = nLastModTime;
+		m_nLastModDate = nLastModDate;
+		m_nFilePosition = nFilePosition;
+		m_nExtInfoPosition = nExtInfoPosition;
+		m_nDataPosition = nDataPosition;
+	}
+
 	std::string CPortableZIPWriterEntry::getUTF8Name()
 	{
 		return m_sUTF8Name;
 	}
 
+	nfUint16 CPortableZIPWriterEntry::getCompressionMethod()
+	{
+		return m_nCompressionMethod;
+	}
+
 	nfUint32 CPortableZIPWriterEntry::getCRC32()
 	{
 		return m_nCRC32;
@@ -35,6 +35,7 @@ NMR_XMLReader_Native.cpp implements a XML reader class with a native XML parsing
 #include "Common/NMR_StringUtils.h" 
 
 #include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_Statistics.h"
 
 #include <algorithm>
 
@@ -273,6 +274,7 @@ namespace NMR {
 			m_bNameSpaceIsAttribute = false;
 			break;
 		case NMR_NATIVEXMLTYPE_ELEMENT:
+			NMR_STATISTICS_ADD(escElements, 1);
 			NodeType = XMLREADERNODETYPE_STARTELEMENT;
 			m_pCurrentValue = &m_cNullString;
 			m_pCurrentPrefix = m_CurrentEntityPrefixes[m_nCurrentEntityIndex];
@@ -452,7 +454,10 @@ namespace NMR {
 
 		// parse Content
 		m_pCurrentEntityPointer = nullptr;
-		parseUnknown(&(*m_pCurrentBuffer)[0], &(*m_pCurrentBuffer)[m_nCurrentBufferSize]);
+		{
+			NMR_STATISTICS_TIMER(escXMLTime);
+			parseUnknown(&(*m_pCurrentBuffer)[0], &(*m_pCurrentBuffer)[m_nCurrentBufferSize]);
+		}
 
 		if (m_pCurrentEntityPointer != nullptr) {
 
@@ -40,9 +40,15 @@ NMR_XmlWriter_Native.cpp implements an XML Writer Class without dependencies.
 
 namespace NMR {
 
-	CXmlWriter_Native::CXmlWriter_Native(_In_ PExportStream pExportStream)
+	CXmlWriter_Native::CXmlWriter_Native(_In_ PExportStream pExportStream, _In_ nfUint32 cbWriteBufferSize)
 		: CXmlWriter(pExportStream)
 	{
+		if ((cbWriteBufferSize < NATIVEXMLMINWRITEBUFFERSIZE) || (cbWriteBufferSize > NATIVEXMLMAXWRITEBUFFERSIZE))
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		m_WriteBuffer.resize(cbWriteBufferSize);
+		m_nWriteBufferPosition = 0;
+
 		m_bIsFreshLine = true;
 
 #ifndef __GNUC__
@@ -64,85 +70,70 @@ namespace NMR {
 
 	void CXmlWriter_Native::WriteStartDocument()
 	{
-		writeUTF8(NATIVEXMLENCODING, true);
+		writeLiteral(NATIVEXMLENCODING);
+		writeLineEnding();
 	}
 
 	void CXmlWriter_Native::WriteEndDocument()
 	{
+		flushWriteBuffer();
 	}
 
 	void CXmlWriter_Native::Flush()
 	{
+		flushWriteBuffer();
 	}
 
 	void CXmlWriter_Native::WriteAttributeString(_In_opt_ LPCSTR pszPrefix, _In_opt_ LPCSTR pszLocalName, _In_opt_ LPCSTR pszNamespaceUri, _In_opt_ LPCSTR pszValue)
 	{
 		if (m_bElementIsOpen) {
-			writeUTF8(" ", false);
+			writeLiteral(" ");
 
 			if (pszPrefix != nullptr) {
 				if (*pszPrefix != 0) {
 					writeUTF8(pszPrefix, false);
-					writeUTF8(":", false);
+					writeLiteral(":");
 				}
 			}
 
 			writeUTF8(pszLocalName, false);
-			writeUTF8("=\"", false);
-
-			size_t nLength = strlen(pszValue);
-			if (nLength < NATIVEXMLFIXEDENCODINGLENGTH) {
-				// for small attribute lengths, use fixed size buffer
-				nfChar * pszAttribBuffer = &m_FixedEncodingBuffer[0];
-				escapeXMLString(pszValue, pszAttribBuffer);
-				writeUTF8(pszAttribBuffer, false);
-			}
-			else {
-				if (nLength > NATIVEXMLMAXSTRINGLENGTH)
-					throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
-
-				// for large attribute lengths, use dynamic buffer
-				std::vector<nfChar> Buffer;
-				Buffer.resize((nLength + 1) * 6);
-				nfChar * pszAttribBuffer = &Buffer[0];
-				escapeXMLString(pszValue, pszAttribBuffer);
-				writeUTF8(pszAttribBuffer, false);
-			}
-
-			writeUTF8("\"", false);
+			writeLiteral("=\"");
+			writeEscapedString(pszValue);
+			writeLiteral("\"");
 		}
 	}
 
 	void CXmlWriter_Native::WriteStartElement(_In_opt_  LPCSTR pszPrefix, _In_  LPCSTR pszLocalName, _In_opt_  LPCSTR pszNamespaceUri)
 	{
+		if (pszLocalName == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
 		closeCurrentElement(true);
 
 		writeSpaces(m_nLayer * m_nSpacesPerLayer);
-		writeUTF8("<", false);
+		writeLiteral("<");
 
 		m_bElementIsOpen = true;
 
-		std::string sNodePrefix;
+		// The qualified name is written from the node name stack, where it is kept for the closing tag
+		nfUint32 nNameOffset = (nfUint32)m_NodeNames.size();
 		if (pszPrefix != nullptr) {
 			if (*pszPrefix != 0) {
-				sNodePrefix = pszPrefix;
-				sNodePrefix += ":";
-
-				writeUTF8(sNodePrefix.c_str(), false);
+				m_NodeNames.insert(m_NodeNames.end(), pszPrefix, pszPrefix + strlen(pszPrefix));
+				m_NodeNames.push_back(':');
 			}
 		}
-
-		writeUTF8(pszLocalName, false);
-
-		std::string sNodeName(pszLocalName);
-		m_NodeStack.push_back(sNodePrefix + sNodeName);
+		m_NodeNames.insert(m_NodeNames.end(), pszLocalName, pszLocalName + strlen(pszLocalName));
+		m_NodeNameOffsets.push_back(nNameOffset);
 		m_nLayer++;
 
+		writeUTF8(&m_NodeNames[nNameOffset], (nfUint32)m_NodeNames.size() - nNameOffset, false);
+
 		if (pszNamespaceUri != nullptr) {
 			if (*pszNamespaceUri != 0) {
-				writeUTF8(" xmlns=\"", false);
+				writeLiteral(" xmlns=\"");
 				writeUTF8(pszNamespaceUri, false);
-				writeUTF8("\"", false);
+				writeLiteral("\"");
 			}
 		}
 	}
@@ -150,12 +141,14 @@ namespace NMR {
 	void CXmlWriter_Native::WriteEndElement()
 	{
 		if (m_bElementIsOpen) {
-			writeUTF8("/>", true);
+			writeLiteral("/>");
+			writeLineEnding();
 			m_bElementIsOpen = false;
 
-			if ((m_NodeStack.size() == 0) || (m_nLayer == 0))
+			if ((m_NodeNameOffsets.size() == 0) || (m_nLayer == 0))
 				throw CNMRException(NMR_ERROR_XMLWRITER_CLOSENODEERROR);
-			m_NodeStack.pop_back();
+			m_NodeNames.resize(m_NodeNameOffsets.back());
+			m_NodeNameOffsets.pop_back();
 			m_nLayer--;
 		}
 		else
@@ -165,19 +158,22 @@ namespace NMR {
 	void CXmlWriter_Native::WriteFullEndElement()
 	{
 		closeCurrentElement(false);
-		if ((m_NodeStack.size() == 0) || (m_nLayer == 0))
+		if ((m_NodeNameOffsets.size() == 0) || (m_nLayer == 0))
 			throw CNMRException(NMR_ERROR_XMLWRITER_CLOSENODEERROR);
 
-		std::string sNodeName = m_NodeStack.back();
-		m_NodeStack.pop_back();
+		nfUint32 nNameOffset = m_NodeNameOffsets.back();
+		m_NodeNameOffsets.pop_back();
 		m_nLayer--;
 
 		if (m_bIsFreshLine)
 			writeSpaces(m_nLayer * m_nSpacesPerLayer);
 
-		writeUTF8("</", false);
-		writeUTF8(sNodeName.c_str(), false);
-		writeUTF8(">", true);
+		writeLiteral("</");
+		writeUTF8(&m_NodeNames[nNameOffset], (nfUint32)m_NodeNames.size() - nNameOffset, false);
+		writeLiteral(">");
+		writeLineEnding();
+
+		m_NodeNames.resize(nNameOffset);
 	}
 
 	void CXmlWriter_Native::WriteText(_In_ const nfChar * pszContent, _In_ const nfUint32 cbLength)
@@ -186,23 +182,14 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		closeCurrentElement(false);
 
-		size_t nLength = strlen(pszContent);
-		if (nLength < NATIVEXMLFIXEDENCODINGLENGTH) {
-			// for small attribute lengths, use fixed size buffer
-			nfChar * pszAttribBuffer = &m_FixedEncodingBuffer[0];
-			escapeXMLString(pszContent, pszAttribBuffer);
-			writeUTF8(pszAttribBuffer, false);
-		}
-		else {
-			if (nLength > NATIVEXMLMAXSTRINGLENGTH)
-				throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
-
-			// for large attribute lengths, use dynamic buffer
-			std::vector<nfChar> Buffer;
-			Buffer.resize((nLength + 1) * 6);
-			nfChar * pszAttribBuffer = &Buffer[0];
-			escapeXMLString(pszContent, pszAttribBuffer);
-			writeUTF8(pszAttribBuffer, false);
+		writeEscapedString(pszContent);
+	}
+
+	void CXmlWriter_Native::flushWriteBuffer()
+	{
+		if (m_nWriteBufferPosition > 0) {
+			m_pExportStream->writeBuffer(m_WriteBuffer.data(), m_nWriteBufferPosition);
+			m_nWriteBufferPosition = 0;
 		}
 	}
 
@@ -210,7 +197,19 @@ namespace NMR {
 	{
 		if (pData == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
-		m_pExportStream->writeBuffer(pData, cbLength);
+
+		if (cbLength > m_WriteBuffer.size() - m_nWriteBufferPosition) {
+			flushWriteBuffer();
+
+			// Data that would not fit into an empty buffer bypasses it
+			if (cbLength >= m_WriteBuffer.size()) {
+				m_pExportStream->writeBuffer(pData, cbLength);
+				return;
+			}
+		}
+
+		memcpy(&m_WriteBuffer[m_nWriteBufferPosition], pData, cbLength);
+		m_nWriteBufferPosition += cbLength;
 	}
 
 	void CXmlWriter_Native::writeUTF8(_In_ const nfChar * pszString, _In_ nfBool bNewLine)
@@ -221,20 +220,29 @@ namespace NMR {
 #ifdef __GNUC__
 		size_t cbSize = strlen(pszString);
 #else
-		size_t cbSize = strnlen_s(pszString, NATIVEXMLMAXSTRINGLENGTH);
+		size_t cbSize = strnlen_s(pszString, NATIVEXMLMAXSTRINGLENGTH + 1);
 #endif // __GNUC__
 		if (cbSize > NATIVEXMLMAXSTRINGLENGTH)
 			throw CNMRException(NMR_ERROR_INSUFFICIENTBUFFERSIZE);
 
-		if (cbSize > 0) {
-			writeData((nfByte *)pszString, (nfUint32)cbSize);
+		writeUTF8(pszString, (nfUint32)cbSize, bNewLine);
+	}
+
+	void CXmlWriter_Native::writeUTF8(_In_ const nfChar * pszString, _In_ nfUint32 cbLength, _In_ nfBool bNewLine)
+	{
+		if (cbLength > 0) {
+			writeData(pszString, cbLength);
 			m_bIsFreshLine = false;
 		}
 
-		if (bNewLine) {
-			writeData(m_nLineEndingBuffer, m_nLineEndingCharCount);
-			m_bIsFreshLine = true;
-		}
+		if (bNewLine)
+			writeLineEnding();
+	}
+
+	void CXmlWriter_Native::writeLineEnding()
+	{
+		writeData(m_nLineEndingBuffer, m_nLineEndingCharCount);
+		m_bIsFreshLine = true;
 	}
 
 	void CXmlWriter_Native::writeSpaces(_In_ nfUint32 cbCount)
@@ -256,13 +264,15 @@ namespace NMR {
 		std::wstring sString(pszString);
 		std::string sUTF8String = fnUTF16toUTF8(sString);
 
-		writeUTF8(sUTF8String.c_str(), bNewLine);
+		writeUTF8(sUTF8String.c_str(), (nfUint32)sUTF8String.length(), bNewLine);
 	}
 
 	void CXmlWriter_Native::closeCurrentElement(_In_ nfBool bNewLine)
 	{
 		if (m_bElementIsOpen) {
-			writeUTF8(">", bNewLine);
+			writeLiteral(">");
+			if (bNewLine)
+				writeLineEnding();
 			m_bElementIsOpen = false;
 		}
 	}
@@ -278,14 +288,20 @@ namespace NMR {
 		writeData(m_nLineEndingBuffer, m_nLineEndingCharCount);
 	}
 
-	void CXmlWriter_Native::escapeXMLString(_In_z_ const nfChar * pszString, _Out_ nfChar * pszBuffer)
+	void CXmlWriter_Native::writeEscapedString(_In_z_ const nfChar * pszString)
 	{
-		__NMRASSERT(pszString);
-		__NMRASSERT(pszBuffer);
+		if (pszString == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		size_t nLength = strlen(pszString);
+		if (nLength > NATIVEXMLMAXSTRINGLENGTH)
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
 
+		// Runs of characters without entities are copied in one piece
+		const nfChar * pRunStart = pszString;
 		const nfChar * pSrcChar = pszString;
-		nfChar * pDstChar = pszBuffer;
-		while (*pSrcChar) {
+		const nfChar * pEnd = pszString + nLength;
+		while (pSrcChar < pEnd) {
 			nfUint32 nReplaceLength = 0;
 			const nfChar * pszReplacement = nullptr;
 
@@ -313,23 +329,19 @@ namespace NMR {
 			}
 
 			if (nReplaceLength > 0) {
-				nfUint32 j;
-				for (j = 0; j < nReplaceLength; j++) {
-					*pDstChar = *pszReplacement;
-					pDstChar++;
-					pszReplacement++;
-				}
-			}
-			else {
-				*pDstChar = *pSrcChar;
-				pDstChar++;
+				if (pSrcChar > pRunStart)
+					writeData(pRunStart, (nfUint32)(pSrcChar - pRunStart));
+				writeData(pszReplacement, nReplaceLength);
+				pRunStart = pSrcChar + 1;
 			}
 
 			pSrcChar++;
-
 		}
 
-		*pDstChar = 0;
+		if (pEnd > pRunStart)
+			writeData(pRunStart, (nfUint32)(pEnd - pRunStart));
+		if (nLength > 0)
+			m_bIsFreshLine = false;
 	}
 
 	bool CXmlWriter_Native::GetNamespacePrefix(const std::string &sNameSpaceURI, std::string &sNameSpacePrefix)
@@ -39,6 +39,7 @@ A model is an in memory representation of the 3MF file.
 #include "Model/Classes/NMR_ModelAttachment.h"
 #include "Model/Classes/NMR_ModelTextureAttachment.h"
 #include "Model/Classes/NMR_ModelBuildItem.h"
+#include "Model/Classes/NMR_ModelInstanceCache.h"
 #include "Model/Classes/NMR_ModelBaseMaterials.h"
 #include "Model/Classes/NMR_ModelColorGroup.h"
 #include "Model/Classes/NMR_ModelTexture2DGroup.h"
@@ -62,6 +63,7 @@ A model is an in memory representation of the 3MF file.
 #include <random>
 #include <mutex>
 #include <array>
+#include <unordered_set>
 
 #include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_SliceRefModel.h"
 #include "Common/Platform/NMR_XmlReader.h"
@@ -79,6 +81,8 @@ namespace NMR {
 		m_Unit = MODELUNIT_MILLIMETER;
 		m_sLanguage = XML_3MF_LANG_US;
 		m_nHandleCounter = 1;
+		m_nRevision = 0;
+		m_nResourceRevision = 0;
 		m_pPath = m_resourceHandler.makePackageModelPath(PACKAGE_3D_MODEL_URI);
 		m_pCurPath = m_pPath;
 		m_pKeyStore = CKeyStoreFactory::makeKeyStore();
@@ -86,6 +90,7 @@ namespace NMR {
 		setBuildUUID(std::make_shared<CUUID>());
 
 		m_MetaDataGroup = std::make_shared<CModelMetaDataGroup>();
+		m_pInstanceCache = std::make_shared<CModelInstanceCache>(this);
 	}
 
 	CModel::~CModel()
@@ -144,14 +149,48 @@ namespace NMR {
 	// Merge all build items into one mesh
 	void CModel::mergeToMesh(_In_ CMesh * pMesh)
 	{
-		for (auto iIterator = m_BuildItems.begin(); iIterator != m_BuildItems.end(); iIterator++) {
-			(*iIterator)->mergeToMesh(pMesh);
+		for (auto & Instance : m_pInstanceCache->getInstances()) {
+			Instance.m_pObject->mergeToMesh(pMesh, Instance.m_mTransform);
 		}
 	}
 
+	void CModel::extendOutbox(_Out_ NOUTBOX3& vOutBox)
+	{
+		for (auto & Instance : m_pInstanceCache->getInstances()) {
+			Instance.m_pObject->extendOutbox(vOutBox, Instance.m_mTransform);
+		}
+	}
+
+	CModelInstanceCache * CModel::getInstanceCache()
+	{
+		return m_pInstanceCache.get();
+	}
+
 	// Units setter/getter
+	nfUint64 CModel::getRevision()
+	{
+		return m_nRevision;
+	}
+
+	void CModel::increaseRevision()
+	{
+		m_nRevision++;
+		m_nResourceRevision++;
+	}
+
+	nfUint64 CModel::getResourceRevision()
+	{
+		return m_nResourceRevision;
+	}
+
+	void CModel::increaseBuildRevision()
+	{
+		m_nRevision++;
+	}
+
 	void CModel::setUnit(_In_ eModelUnit Unit)
 	{
+		increaseRevision();
 		m_Unit = Unit;
 	}
 
@@ -203,6 +242,7 @@ namespace NMR {
 	// Language setter/getter
 	void CModel::setLanguage(_In_ std::string sLanguage)
 	{
+		increaseRevision();
 		m_sLanguage = sLanguage;
 	}
 
@@ -265,6 +305,7 @@ namespace NMR {
 
 	void CModel::addResource(_In_ PModelResource pResource)
 	{
+		increaseRevision();
 		if (!pResource.get())
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -294,6 +335,7 @@ namespace NMR {
 	// Metadata setter/getter
 	PModelMetaData CModel::addMetaData(_In_ std::string sNameSpace, _In_ std::string sName, _In_ std::string sValue, _In_ std::string sType, _In_ nfBool bPreserve)
 	{
+		m_nRevision++;
 		return m_MetaDataGroup->addMetaData(sNameSpace, sName, sValue, sType, bPreserve);
 	}
 
@@ -309,6 +351,7 @@ namespace NMR {
 
 	void  CModel::removeMetaData(_In_ nfUint32 nIndex)
 	{
+		m_nRevision++;
 		m_MetaDataGroup->removeMetaData(nIndex);
 	}
 
@@ -322,6 +365,7 @@ namespace NMR {
 		if (!pSourceModel)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		m_MetaDataGroup->mergeMetaData(pSourceModel->m_MetaDataGroup.get());
+		m_nRevision++;
 	}
 
 	PModelMetaDataGroup CModel::getMetaDataGroup()
@@ -332,6 +376,7 @@ namespace NMR {
 	// Build Handling
 	void CModel::addBuildItem(_In_ PModelBuildItem pBuildItem)
 	{
+		m_nRevision++;
 		if (!pBuildItem.get())
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		if (m_BuildItems.size() >= XML_3MF_MAXBUILDITEMCOUNT)
@@ -353,6 +398,7 @@ namespace NMR {
 
 	void CModel::removeBuildItem(_In_ nfUint32 nHandle, _In_ nfBool bThrowExceptionIfNotFound)
 	{
+		m_nRevision++;
 		auto iIterator = m_BuildItems.begin();
 		while (iIterator != m_BuildItems.end()) {
 			if ((*iIterator)->getHandle() == nHandle) {
@@ -373,6 +419,7 @@ namespace NMR {
 
 	void CModel::setBuildUUID(PUUID pUUID)
 	{
+		m_nRevision++;
 		registerUUID(pUUID);
 		unRegisterUUID(m_buildUUID);
 		m_buildUUID = pUUID;
@@ -442,6 +489,7 @@ namespace NMR {
 			}
 			m_ResourceMap.insert(std::make_pair<>(nNewID, iIterator->second));
 			m_ResourceMap.erase(m_ResourceMap.find(nOldID));
+			increaseRevision();
 		}
 	}
 
@@ -580,6 +628,7 @@ namespace NMR {
 	// Clear all build items and Resources
 	void CModel::clearAll()
 	{
+		increaseRevision();
 		m_pPackageThumbnailAttachment = nullptr;
 
 		m_MetaDataGroup->clear();
@@ -1197,6 +1246,7 @@ namespace NMR {
 	
 	PModelAttachment CModel::addPackageThumbnail(_In_ std::string sPath, _In_ PImportStream pStream)
 	{
+		m_nRevision++;
 		if (m_pPackageThumbnailAttachment.get() == nullptr)
 		{
 			m_pPackageThumbnailAttachment = std::make_shared<CModelAttachment>(this,
@@ -1208,11 +1258,13 @@ namespace NMR {
 
 	PModelAttachment CModel::addPackageThumbnail()
 	{
+		m_nRevision++;
 		return addPackageThumbnail(PACKAGE_THUMBNAIL_URI_BASE + std::string("/") + "thumbnail.png", std::make_shared<CImportStream_Unique_Memory>());
 	}
 
 	void CModel::removePackageThumbnail()
 	{
+		m_nRevision++;
 		m_pPackageThumbnailAttachment.reset();
 	}
 
@@ -1223,6 +1275,7 @@ namespace NMR {
 
 	PModelAttachment CModel::addAttachment(_In_ const std::string sPath, _In_ const std::string sRelationShipType, PImportStream pCopiedStream)
 	{
+		m_nRevision++;
 		if (pCopiedStream.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -1277,6 +1330,7 @@ namespace NMR {
 
 	void CModel::removeAttachment(_In_ const std::string sPath)
 	{
+		m_nRevision++;
 		auto iIterator = m_AttachmentURIMap.find(sPath);
 		if (iIterator != m_AttachmentURIMap.end()) {
 			auto iVectorIterator = m_Attachments.begin();
@@ -1328,6 +1382,7 @@ namespace NMR {
 
 	PModelAttachment CModel::addProductionAttachment(_In_ const std::string sPath, _In_ const std::string sRelationShipType, PImportStream pCopiedStream, nfBool bForceUnique)
 	{
+		m_nRevision++;
 		if (pCopiedStream.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -1393,6 +1448,7 @@ namespace NMR {
 
 	void CModel::removeProductionAttachment(_In_ const std::string sPath)
 	{
+		m_nRevision++;
 		auto iIterator = m_ProductionAttachmentURIMap.find(sPath);
 		if (iIterator != m_ProductionAttachmentURIMap.end()) {
 			auto iVectorIterator = m_ProductionAttachments.begin();
@@ -1416,11 +1472,13 @@ namespace NMR {
 
 	void CModel::addCustomContentType(_In_ const std::string sExtension, _In_ const std::string sContentType)
 	{
+		m_nRevision++;
 		m_CustomContentTypes.insert(std::make_pair(sExtension, sContentType));
 	}
 
 	void CModel::removeCustomContentType(_In_ const std::string sExtension)
 	{
+		m_nRevision++;
 		m_CustomContentTypes.erase(sExtension);
 	}
 
@@ -1531,35 +1589,9 @@ namespace NMR {
 		return m_SliceStackLookup[nIndex];
 	}
 
-	std::list<CModelObject *> CModel::getSortedObjectList()
+	std::vector<CModelObject *> CModel::getSortedObjectList()
 	{
-		std::list<CModelObject *> resultList;
-
-		for (size_t i = 0; i < m_ObjectLookup.size(); i++) {
-			CModelObject* pObject = dynamic_cast<CModelObject*>(m_ObjectLookup[i].get());
-			if (pObject != nullptr) {
-				pObject->clearComponentDepthLevel();
-				resultList.push_back(pObject);
-			}
-		}
-
-		for (auto iIterator = resultList.begin(); iIterator != resultList.end(); iIterator++) {
-			(*iIterator)->calculateComponentDepthLevel(1);
-		}
-
-		// sort by (level descending, ResourceID ascending)
-		resultList.sort( [](CModelObject * pObject1, CModelObject * pObject2)
-		{
-			nfUint32 nLevel1 = pObject1->getComponentDepthLevel();
-			nfUint32 nLevel2 = pObject2->getComponentDepthLevel();
-			
-			if (nLevel1 == nLevel2)
-				return (pObject1->getPackageResourceID()->getUniqueID()) < (pObject2->getPackageResourceID()->getUniqueID());
-
-			return nLevel1 > nLevel2;
-		});
-
-		return resultList;
+		return m_pInstanceCache->getSortedObjects();
 	}
 
 	PKeyStore CModel::getKeyStore() {
@@ -1567,6 +1599,7 @@ namespace NMR {
 	}
 
 	void CModel::setKeyStore(PKeyStore keyStore) {
+		increaseRevision();
 		m_pKeyStore = keyStore;
 	}
 
@@ -1705,6 +1738,7 @@ namespace NMR {
 
 	void CModel::removeResource(PModelResource pResource)
 	{
+		increaseRevision();
 		if (pResource.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -45,6 +45,7 @@ namespace NMR {
 		m_sPathURI = sPathURI;
 		m_pStream = pStream;
 		m_sRelationShipType = sRelationShipType;
+		m_SourceEntryInfo = {};
 	}
 
 	CModelAttachment::~CModelAttachment()
@@ -75,6 +76,8 @@ namespace NMR {
 	void CModelAttachment::setStream(_In_ PImportStream pStream)
 	{
 		m_pStream = pStream;
+		m_pSourcePackage = nullptr;
+		m_pCompressedStream = nullptr;
 	}
 
 	void CModelAttachment::setRelationShipType(_In_ const std::string sRelationShipType)
@@ -82,6 +85,47 @@ namespace NMR {
 		m_sRelationShipType = sRelationShipType;
 	}
 
+	void CModelAttachment::setSourceEntry(_In_ PModelSourcePackage pSourcePackage, _In_ const std::string & sSourcePath, _In_ const ZIPRAWENTRYINFO & SourceEntryInfo)
+	{
+		if (pSourcePackage.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_pSourcePackage = pSourcePackage;
+		m_sSourcePath = sSourcePath;
+		m_SourceEntryInfo = SourceEntryInfo;
+	}
+
+	PModelSourcePackage CModelAttachment::getSourcePackage()
+	{
+		return m_pSourcePackage;
+	}
+
+	std::string CModelAttachment::getSourcePath()
+	{
+		return m_sSourcePath;
+	}
+
+	ZIPRAWENTRYINFO CModelAttachment::getSourceEntryInfo()
+	{
+		return m_SourceEntryInfo;
+	}
+
+	void CModelAttachment::setCompressedStream(_In_ PImportStream pCompressedStream, _In_ const ZIPRAWENTRYINFO & SourceEntryInfo)
+	{
+		if (pCompressedStream.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (pCompressedStream->retrieveSize() != SourceEntryInfo.m_nCompressedSize)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_pCompressedStream = pCompressedStream;
+		m_SourceEntryInfo = SourceEntryInfo;
+	}
+
+	PImportStream CModelAttachment::getCompressedStream()
+	{
+		return m_pCompressedStream;
+	}
+
 	PModelAttachment CModelAttachment::cloneIntoNewModel(_In_ CModel * pModel, _In_ nfBool bCloneMemory)
 	{
 		PImportStream pNewStream;
@@ -41,21 +41,16 @@ namespace NMR {
 	CModelBaseMaterialResource::CModelBaseMaterialResource(_In_ const ModelResourceID sID, _In_ CModel * pModel)
 		: CModelResource(sID, pModel)
 	{
-		m_nNextPropertyID = 1;
 	}
 
 	nfUint32 CModelBaseMaterialResource::addBaseMaterial(_In_ const std::string sName, _In_ nfColor cDisplayColor)
 	{
-		nfUint32 nID = m_nNextPropertyID;
 		if (getCount() >= XML_3MF_MAXRESOURCEINDEX) {
 			throw CNMRException(NMR_ERROR_TOOMANYMATERIALS);
 		}
 
-		m_pMaterials.insert(
-			std::make_pair(nID, std::make_shared<CModelBaseMaterial>(sName, cDisplayColor, nID))
-		);
-
-		m_nNextPropertyID++;
+		nfUint32 nID = m_Materials.getNextPropertyID();
+		m_Materials.add(std::make_shared<CModelBaseMaterial>(sName, cDisplayColor, nID));
 
 		clearResourceIndexMap();
 
@@ -64,23 +59,21 @@ namespace NMR {
 
 	nfUint32 CModelBaseMaterialResource::getCount()
 	{
-		return (nfUint32)m_pMaterials.size();
+		return m_Materials.getCount();
 	}
 
 	PModelBaseMaterial CModelBaseMaterialResource::getBaseMaterial(_In_ nfUint32 nPropertyID)
 	{
-		auto iIterator = m_pMaterials.find(nPropertyID);
-		if (iIterator != m_pMaterials.end()) {
-			return iIterator->second;
-		}
-		else {
+		PModelBaseMaterial * ppMaterial = m_Materials.find(nPropertyID);
+		if (ppMaterial == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
-		}
+
+		return *ppMaterial;
 	}
 
 	void CModelBaseMaterialResource::removeMaterial(_In_ nfUint32 nPropertyID)
 	{
-		m_pMaterials.erase(nPropertyID);
+		m_Materials.remove(nPropertyID);
 		clearResourceIndexMap();
 	}
 
@@ -89,29 +82,16 @@ namespace NMR {
 		if (pSourceMaterial == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		
-		nfUint32 nCount = pSourceMaterial->getCount();
-
-		pSourceMaterial->buildResourceIndexMap();
-		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
-			ModelPropertyID nPropertyID;
-			pSourceMaterial->mapResourceIndexToPropertyID(nIndex, nPropertyID);
-			PModelBaseMaterial pMaterial = pSourceMaterial->getBaseMaterial(nPropertyID);
+		m_Materials.reserve(getCount() + pSourceMaterial->getCount());
+		pSourceMaterial->m_Materials.forEach([this](ModelPropertyID, PModelBaseMaterial & pMaterial) {
 			addBaseMaterial(pMaterial->getName(), pMaterial->getDisplayColor());
-		}
+		});
 		clearResourceIndexMap();
 	}
 
 	void CModelBaseMaterialResource::buildResourceIndexMap()
 	{
-		m_ResourceIndexMap.clear();
-		m_ResourceIndexMap.reserve(m_pMaterials.size());
-
-		auto iIterator = m_pMaterials.begin();
-		while (iIterator != m_pMaterials.end()) {
-			m_ResourceIndexMap.push_back(iIterator->first);
-			iIterator++;
-		}
-
+		m_Materials.getPropertyIDs(m_ResourceIndexMap);
 		m_bHasResourceIndexMap = true;
 	}
 
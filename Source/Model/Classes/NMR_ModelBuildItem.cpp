@@ -80,6 +80,7 @@ namespace NMR {
 	void CModelBuildItem::setTransform(_In_ const NMATRIX3 mTransform)
 	{
 		m_mTransform = mTransform;
+		getModel()->increaseBuildRevision();
 	}
 
 	nfBool CModelBuildItem::hasTransform()
@@ -41,19 +41,15 @@ namespace NMR {
 	CModelColorGroupResource::CModelColorGroupResource(_In_ const ModelResourceID sID, _In_ CModel * pModel)
 		: CModelResource(sID, pModel)
 	{
-		m_nNextPropertyID = 1;
 	}
 
 	nfUint32 CModelColorGroupResource::addColor( _In_ nfColor cColor)
 	{
-		nfUint32 nID = m_nNextPropertyID;
 		if (getCount() >= XML_3MF_MAXRESOURCEINDEX) {
 			throw CNMRException(NMR_ERROR_TOOMANYCOLORS);
 		}
 
-		m_pColors.insert(std::make_pair(nID, cColor));
-
-		m_nNextPropertyID++;
+		nfUint32 nID = m_Colors.add(cColor);
 
 		clearResourceIndexMap();
 
@@ -62,34 +58,40 @@ namespace NMR {
 
 	nfUint32 CModelColorGroupResource::getCount()
 	{
-		return (nfUint32)m_pColors.size();
+		return m_Colors.getCount();
 	}
 
 	nfColor CModelColorGroupResource::getColor(_In_ ModelPropertyID nPropertyID)
 	{
-		auto iIterator = m_pColors.find(nPropertyID);
-		if (iIterator != m_pColors.end()) {
-			return iIterator->second;
-		}
-		else {
+		nfColor * pColor = m_Colors.find(nPropertyID);
+		if (pColor == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
-		}
+
+		return *pColor;
 	}
 
 	void CModelColorGroupResource::setColor(_In_ ModelPropertyID nPropertyID, _In_ nfColor cColor)
 	{
-		auto iIterator = m_pColors.find(nPropertyID);
-		if (iIterator != m_pColors.end()) {
-			iIterator->second = cColor;
-		}
-		else {
+		nfColor * pColor = m_Colors.find(nPropertyID);
+		if (pColor == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
-		}
+
+		*pColor = cColor;
+	}
+
+	void CModelColorGroupResource::getAllColors(_Out_ nfColor * pColors)
+	{
+		m_Colors.getAll(pColors);
+	}
+
+	void CModelColorGroupResource::setAllColors(_In_ const nfColor * pColors, _In_ nfUint32 nCount)
+	{
+		m_Colors.setAll(pColors, nCount);
 	}
 
 	void CModelColorGroupResource::removeColor(_In_ ModelPropertyID nPropertyID)
 	{
-		m_pColors.erase(nPropertyID);
+		m_Colors.remove(nPropertyID);
 		clearResourceIndexMap();
 	}
 
@@ -99,12 +101,11 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		
 		nfUint32 nCount = pSourceColorGroup->getCount();
+		std::vector<nfColor> Colors(nCount);
+		pSourceColorGroup->getAllColors(Colors.data());
 
-		pSourceColorGroup->buildResourceIndexMap();
-		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
-			ModelPropertyID nPropertyID;
-			pSourceColorGroup->mapResourceIndexToPropertyID(nIndex, nPropertyID);
-			nfColor color = pSourceColorGroup->getColor(nPropertyID);
+		m_Colors.reserve(getCount() + nCount);
+		for (nfColor color : Colors) {
 			addColor(color);
 		}
 		clearResourceIndexMap();
@@ -112,17 +113,8 @@ namespace NMR {
 
 	void CModelColorGroupResource::buildResourceIndexMap()
 	{
-		m_ResourceIndexMap.clear();
-		m_ResourceIndexMap.reserve(m_pColors.size());
-
-		auto iIterator = m_pColors.begin();
-		while (iIterator != m_pColors.end()) {
-			m_ResourceIndexMap.push_back(iIterator->first);
-			iIterator++;
-		}
-
+		m_Colors.getPropertyIDs(m_ResourceIndexMap);
 		m_bHasResourceIndexMap = true;
 	}
 
 }
-
@@ -79,6 +79,7 @@ namespace NMR {
 	void CModelComponent::setTransform(_In_ const NMATRIX3 mTransform)
 	{
 		m_mTransform = mTransform;
+		getModel()->increaseRevision();
 	}
 
 	nfBool CModelComponent::hasTransform()
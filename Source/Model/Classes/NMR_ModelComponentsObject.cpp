@@ -63,6 +63,7 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_MODELMISMATCH);
 
 		m_Components.push_back(pComponent);
+		pModel->increaseRevision();
 	}
 
 	nfUint32 CModelComponentsObject::getComponentCount()
@@ -138,15 +139,6 @@ namespace NMR {
 		return true;
 	}
 
-	void CModelComponentsObject::calculateComponentDepthLevel(nfUint32 nLevel)
-	{
-		CModelObject::calculateComponentDepthLevel(nLevel);
-		for (auto iIterator = m_Components.begin(); iIterator != m_Components.end(); iIterator++) {
-			CModelObject * pObject = (*iIterator)->getObject();
-			pObject->calculateComponentDepthLevel(nLevel + 1);
-		}
-	}
-
 	void CModelComponentsObject::extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix)
 	{
 		for(auto & component : m_Components)
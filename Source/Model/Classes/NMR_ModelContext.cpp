@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/NMR_SecureContext.h"
 #include "Common/3MF_ProgressMonitor.h"
 #include "Common/NMR_ModelWarnings.h"
+#include "Common/NMR_Statistics.h"
 
 namespace NMR {
 
@@ -52,6 +53,8 @@ namespace NMR {
 		m_pSecureContext = std::make_shared<CSecureContext>();
 
 		m_pWarnings = std::make_shared<CModelWarnings>();
+
+		m_pStatistics = std::make_shared<CStatistics>();
 	}
 
 	nfBool CModelContext::isComplete() const {
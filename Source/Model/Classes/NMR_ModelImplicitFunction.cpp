@@ -35,7 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Model/Classes/NMR_ModelImplicitFunction.h"
 #include "Model/Classes/NMR_ModelImplicitPort.h"
 #include "Common/Graph/GraphAlgorithms.h"
-#include "Common/Graph/DirectedGraph.h"
+#include "Common/Graph/SparseDirectedGraph.h"
 
 #include <algorithm>
 #include <queue>
@@ -47,14 +47,84 @@ namespace NMR
     CModelImplicitNode *
     CModelImplicitFunction::findNode(const ImplicitIdentifier & sIdentifier) const
     {
-        for (auto & node : *m_nodes)
+        auto iIterator = m_nodeIndex.find(sIdentifier);
+        if (iIterator == m_nodeIndex.end())
+        {
+            return nullptr;
+        }
+        return iIterator->second.pNode.get();
+    }
+
+    void CModelImplicitFunction::indexNode(PModelImplicitNode const & pNode)
+    {
+        if (!pNode || pNode->getIdentifier().empty())
+        {
+            return;
+        }
+
+        auto iIterator = m_nodeIndex.find(pNode->getIdentifier());
+        if (iIterator == m_nodeIndex.end())
+        {
+            m_nodeIndex.emplace(pNode->getIdentifier(), sNodeIndexEntry{pNode, 1});
+            return;
+        }
+
+        // Duplicate identifier, the index has to keep pointing to the first node in m_nodes
+        iIterator->second.nCount++;
+        for (auto const & node : *m_nodes)
         {
-            if (node->getIdentifier() == sIdentifier)
+            if (node->getIdentifier() == pNode->getIdentifier())
             {
-                return node.get();
+                iIterator->second.pNode = node;
+                break;
             }
         }
-        return nullptr;
+    }
+
+    void CModelImplicitFunction::unindexNode(CModelImplicitNode const & node)
+    {
+        auto iIterator = m_nodeIndex.find(node.getIdentifier());
+        if (iIterator == m_nodeIndex.end())
+        {
+            return;
+        }
+
+        if (iIterator->second.nCount <= 1)
+        {
+            if (iIterator->second.pNode.get() == &node)
+            {
+                m_nodeIndex.erase(iIterator);
+            }
+            return;
+        }
+
+        iIterator->second.nCount--;
+        if (iIterator->second.pNode.get() == &node)
+        {
+            for (auto const & otherNode : *m_nodes)
+            {
+                if ((otherNode.get() != &node) && (otherNode->getIdentifier() == node.getIdentifier()))
+                {
+                    iIterator->second.pNode = otherNode;
+                    break;
+                }
+            }
+        }
+    }
+
+    void CModelImplicitFunction::rebuildNodeIndex()
+    {
+        m_nodeIndex.clear();
+        m_nodeIndex.reserve(m_nodes->size());
+        for (auto const & node : *m_nodes)
+        {
+            if (node->getIdentifier().empty())
+            {
+                continue;
+            }
+            auto iInsert = m_nodeIndex.emplace(node->getIdentifier(), sNodeIndexEntry{node, 0});
+            iInsert.first->second.nCount++;
+        }
     }
 
     CModelImplicitFunction::CModelImplicitFunction(const ModelResourceID sID,
@@ -84,6 +154,7 @@ namespace NMR
 
         m_nodeTypes.addExpectedPortsToNode(*node, eConfiguration);
         m_nodes->push_back(node);
+        indexNode(node);
         return node;
     }
 
@@ -97,17 +168,15 @@ namespace NMR
         return m_nodes;
     }
 
-    void NMR::CModelImplicitFunction::addLink(
-        const ImplicitIdentifier& sSourceNodeIdentifier,
-        const ImplicitIdentifier& sTargetNodeIdentifier)
-
+    PModelImplicitPort CModelImplicitFunction::findLinkSource(
+        const ImplicitIdentifier& sSourceIdentifier) const
     {
-        auto const sourceNodeName = extractNodeName(sSourceNodeIdentifier);
+        auto const sourceNodeName = extractNodeName(sSourceIdentifier);
+        auto const sourcePortName = extractPortName(sSourceIdentifier);
 
         PModelImplicitPort sourcePort;
         if(sourceNodeName == "inputs")
         {
-            auto const sourcePortName = extractPortName(sSourceNodeIdentifier);
             sourcePort = findInput(sourcePortName);
         }
         else
@@ -119,7 +188,6 @@ namespace NMR
                     LIB3MF_ERROR_INVALIDPARAM,
                     "Source node " + sourceNodeName + " does not exist.");
             }
-            auto const sourcePortName = extractPortName(sSourceNodeIdentifier);
             if(sourcePortName.empty())
             {
                 throw ELib3MFInterfaceException(
@@ -134,9 +202,14 @@ namespace NMR
             throw CNMRException(
                 NMR_ERROR_IMPLICIT_FUNCTION_INVALID_SOURCE_PORT);
         }
+        return sourcePort;
+    }
 
-        auto const targetNodeName = extractNodeName(sTargetNodeIdentifier);
-        auto const targetPortName = extractPortName(sTargetNodeIdentifier);
+    PModelImplicitPort CModelImplicitFunction::findLinkTarget(
+        const ImplicitIdentifier& sTargetIdentifier) const
+    {
+        auto const targetNodeName = extractNodeName(sTargetIdentifier);
+        auto const targetPortName = extractPortName(sTargetIdentifier);
         NMR::PModelImplicitPort targetPort;
         if(targetNodeName == "outputs")
         {
@@ -170,34 +243,48 @@ namespace NMR
                 "Target port " + targetPortName + " of node " +
                     targetNodeName + " does not exist.");
         }
+        return targetPort;
+    }
 
-        if(sourcePort->getType() != targetPort->getType())
+    void CModelImplicitFunction::checkLinkPortTypes(CModelImplicitPort const& sourcePort,
+                                                    CModelImplicitPort const& targetPort)
+    {
+        if(sourcePort.getType() != targetPort.getType())
         {
             std::string sourceNodeIdentifier = "function inputs";
             std::string targetNodeIdentifier = "function outputs";
 
-            if(sourcePort->getParent())
+            if(sourcePort.getParent())
             {
-                sourceNodeIdentifier = sourcePort->getParent()->getIdentifier();
+                sourceNodeIdentifier = sourcePort.getParent()->getIdentifier();
             }
 
-            if(targetPort->getParent())
+            if(targetPort.getParent())
             {
-                targetNodeIdentifier = targetPort->getParent()->getIdentifier();
+                targetNodeIdentifier = targetPort.getParent()->getIdentifier();
             }
 
             throw ELib3MFInterfaceException(
                 LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
-                "Output " + sourcePort->getIdentifier() + " of node " +
+                "Output " + sourcePort.getIdentifier() + " of node " +
                     sourceNodeIdentifier + " has type " +
-                    std::to_string(static_cast<int>(sourcePort->getType())) +
-                    " while target input " + targetPort->getIdentifier() +
+                    std::to_string(static_cast<int>(sourcePort.getType())) +
+                    " while target input " + targetPort.getIdentifier() +
                     " of node " + targetNodeIdentifier + " has type " +
-                    std::to_string(static_cast<int>(targetPort->getType())) +
+                    std::to_string(static_cast<int>(targetPort.getType())) +
                     ".");
-            
         }
-        
+    }
+
+    void NMR::CModelImplicitFunction::addLink(
+        const ImplicitIdentifier& sSourceNodeIdentifier,
+        const ImplicitIdentifier& sTargetNodeIdentifier)
+
+    {
+        auto const sourcePort = findLinkSource(sSourceNodeIdentifier);
+        auto const targetPort = findLinkTarget(sTargetNodeIdentifier);
+        checkLinkPortTypes(*sourcePort, *targetPort);
+
         targetPort->setReferencedPort(sourcePort);
     }
 
@@ -215,37 +302,13 @@ namespace NMR
             throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
                                             "Target port is nullptr.");
         }
-        
-        if(pSourcePort->getType() != pTargetPort->getType())
-        {
-            std::string sourceNodeIdentifier = "function inputs";
-            std::string targetNodeIdentifier = "function outputs";
 
-            if(pSourcePort->getParent())
-            {
-                sourceNodeIdentifier = pSourcePort->getParent()->getIdentifier();
-            }
+        checkLinkPortTypes(*pSourcePort, *pTargetPort);
 
-            if(pTargetPort->getParent())
-            {
-                targetNodeIdentifier = pTargetPort->getParent()->getIdentifier();
-            }
-
-            throw ELib3MFInterfaceException(
-                LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
-                "Output " + pSourcePort->getIdentifier() + " of node " +
-                    sourceNodeIdentifier + " has type " +
-                    std::to_string(static_cast<int>(pSourcePort->getType())) +
-                    " while target input " + pTargetPort->getIdentifier() +
-                    " of node " + targetNodeIdentifier + " has type " +
-                    std::to_string(static_cast<int>(pTargetPort->getType())) +
-                    ".");
-        }
-        
         pTargetPort->setReferencedPort(pSourcePort);
     }
 
-    implicit::NodeTypes const& CModelImplicitFunction::getNodeTypes() const
+    implicit::NodeTypes const& CModelImplicitFunction::getNodeTypes()
     {
         return m_nodeTypes;
     }
@@ -258,6 +321,9 @@ namespace NMR
         {
             throw CNMRException(NMR_ERROR_INVALIDPOINTER);
         }
+        unindexNode(*node);
+        // Renaming the removed node must not touch the index anymore
+        node->setParent(nullptr);
         m_nodes->erase(std::remove_if(m_nodes->begin(), m_nodes->end(),
                                       [node](PModelImplicitNode const& n)
                                       { return n.get() == node; }),
@@ -267,7 +333,12 @@ namespace NMR
     void CModelImplicitFunction::clear() 
     {
         CModelFunction::clear();
+        for (auto & node : *m_nodes)
+        {
+            node->setParent(nullptr);
+        }
         m_nodes->clear();
+        m_nodeIndex.clear();
     }
 
     void CModelImplicitFunction::replaceResourceID(const ModelResourceID sOldID,
@@ -313,7 +384,7 @@ namespace NMR
         return sNodeIdentifier + "." + sPortIdentifier;
     }
 
-    NMR::common::graph::DirectedGraph directedGraphFromNodes(const PImplicitNodes & nodes)
+    NMR::common::graph::SparseDirectedGraph directedGraphFromNodes(const PImplicitNodes & nodes)
     {
         if (!nodes)
         {
@@ -322,9 +393,10 @@ namespace NMR
         }
 
         using namespace NMR::common;
-        graph::DirectedGraph graph(nodes->size()+1);
+        graph::SparseDirectedGraph graph(nodes->size()+1);
 
-        std::unordered_map<ImplicitIdentifier, graph::Identifier> identifierToIndex;
+        std::unordered_map<CModelImplicitNode const*, graph::Identifier> nodeToIndex;
+        nodeToIndex.reserve(nodes->size());
         graph::Identifier InputsIndex = 0;
 
         graph::Identifier index = 1;
@@ -336,13 +408,16 @@ namespace NMR
                                                 "Node must not be nullptr.");
             }
 
-            auto const& identifier = node->getIdentifier();
-            identifierToIndex[identifier] = index;
+            nodeToIndex[node.get()] = index;
             ++index;
         }
 
+        index = 1;
         for (auto const& node : *nodes)
         {
+            graph::Identifier const targetIndex = index;
+            ++index;
+
             auto const& inputs = node->getInputs();
 
             if (!inputs)
@@ -359,26 +434,17 @@ namespace NMR
                     auto const& sourceNode = sourcePort->getParent();
                     if (sourceNode)
                     {
-                        auto const& sourceNodeIdentifier = sourceNode->getIdentifier();
-                        auto const& sourcePortIdentifier = sourcePort->getIdentifier();
-                        graph::Identifier const sourceIndex = identifierToIndex[sourceNodeIdentifier];
-                        graph::Identifier const targetIndex = identifierToIndex[node->getIdentifier()];
-                        if (sourceIndex >= graph.getSize())
+                        auto const iSource = nodeToIndex.find(sourceNode);
+                        if (iSource == nodeToIndex.end())
                         {
                             throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
-                                                            "Source index " + std::to_string(sourceIndex) + " is out of range.");
+                                                            "Source node " + sourceNode->getIdentifier() + " is not part of the function.");
                         }
-
-                        if (targetIndex >= graph.getSize())
-                        {
-                            throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
-                                                            "Target index " + std::to_string(targetIndex) + " is out of range.");
-                        }
-                        graph.addDependency(sourceIndex, targetIndex);
+                        graph.addDependency(targetIndex, iSource->second);
                     }
                     else
                     {
-                        graph.addDependency(InputsIndex, identifierToIndex[node->getIdentifier()]);
+                        graph.addDependency(targetIndex, InputsIndex);
                     }
                 }
 
@@ -418,6 +484,9 @@ namespace NMR
             sortedNodes->push_back(m_nodes->at(nodeIndex));
         }
         std::swap(m_nodes, sortedNodes);
+
+        // Only the order of nodes with duplicate identifiers affects the index
+        rebuildNodeIndex();
     }
 
     PModelImplicitPort
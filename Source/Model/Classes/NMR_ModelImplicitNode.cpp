@@ -74,7 +74,15 @@ namespace NMR
 
     void CModelImplicitNode::setIdentifier(ImplicitIdentifier const & identifier)
     {
+        if (m_parent == nullptr)
+        {
+            m_identifier = identifier;
+            return;
+        }
+
+        m_parent->unindexNode(*this);
         m_identifier = identifier;
+        m_parent->indexNode(shared_from_this());
     }
 
     void CModelImplicitNode::setDisplayName(std::string const & displayname)
@@ -234,7 +242,7 @@ namespace NMR
 
     bool CModelImplicitNode::arePortsValid() const
     {
-        return m_parent->getNodeTypes().arePortsValidForNode(*this);
+        return CModelImplicitFunction::getNodeTypes().arePortsValidForNode(*this);
     }
 
     void CModelImplicitNode::setGraphID(GraphID id)
@@ -0,0 +1,206 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelInstanceCache.cpp implements the flattened instance cache of a model.
+
+--*/
+
+#include "Model/Classes/NMR_ModelInstanceCache.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelBuildItem.h"
+#include "Model/Classes/NMR_ModelComponentsObject.h"
+#include "Common/NMR_Exception.h"
+#include <algorithm>
+
+namespace NMR {
+
+	CModelInstanceCache::CModelInstanceCache(_In_ CModel * pModel)
+		: m_pModel(pModel), m_nRevision(0), m_bIsValid(false)
+	{
+		if (pModel == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	void CModelInstanceCache::invalidate()
+	{
+		m_bIsValid = false;
+		m_Instances.clear();
+		m_BuildItemOffsets.clear();
+		m_BuildItemIndices.clear();
+		m_SortedObjects.clear();
+	}
+
+	void CModelInstanceCache::update()
+	{
+		nfUint64 nRevision = m_pModel->getRevision();
+		if (m_bIsValid && (m_nRevision == nRevision))
+			return;
+
+		invalidate();
+
+		// Sorting first rejects cyclic component references, which would never terminate the flattening
+		sortObjects();
+
+		nfUint32 nBuildItemCount = m_pModel->getBuildItemCount();
+		m_BuildItemOffsets.reserve(nBuildItemCount + 1);
+		for (nfUint32 nIndex = 0; nIndex < nBuildItemCount; nIndex++) {
+			PModelBuildItem pBuildItem = m_pModel->getBuildItem(nIndex);
+			m_BuildItemOffsets.push_back((nfUint32)m_Instances.size());
+			m_BuildItemIndices.insert(std::make_pair(pBuildItem.get(), nIndex));
+			flattenObject(pBuildItem->getObject(), pBuildItem->getTransform(), nIndex);
+		}
+		m_BuildItemOffsets.push_back((nfUint32)m_Instances.size());
+
+		m_nRevision = nRevision;
+		m_bIsValid = true;
+	}
+
+	void CModelInstanceCache::flattenObject(_In_ CModelObject * pObject, _In_ const NMATRIX3 & mMatrix, _In_ nfUint32 nBuildItemIndex)
+	{
+		__NMRASSERT(pObject);
+
+		CModelComponentsObject * pComponentsObject = dynamic_cast<CModelComponentsObject *> (pObject);
+		if (pComponentsObject == nullptr) {
+			MODELINSTANCE Instance;
+			Instance.m_pObject = pObject;
+			Instance.m_mTransform = mMatrix;
+			Instance.m_nBuildItemIndex = nBuildItemIndex;
+			m_Instances.push_back(Instance);
+			return;
+		}
+
+		nfUint32 nComponentCount = pComponentsObject->getComponentCount();
+		for (nfUint32 nIndex = 0; nIndex < nComponentCount; nIndex++) {
+			PModelComponent pComponent = pComponentsObject->getComponent(nIndex);
+			flattenObject(pComponent->getObject(), fnMATRIX3_multiply(mMatrix, pComponent->getTransform()), nBuildItemIndex);
+		}
+	}
+
+	void CModelInstanceCache::sortObjects()
+	{
+		nfUint32 nObjectCount = m_pModel->getObjectCount();
+		std::vector<CModelObject *> Objects;
+		std::unordered_map<CModelObject *, nfUint32> ObjectIndices;
+		Objects.reserve(nObjectCount);
+		for (nfUint32 nIndex = 0; nIndex < nObjectCount; nIndex++) {
+			CModelObject * pObject = dynamic_cast<CModelObject *> (m_pModel->getObjectResource(nIndex).get());
+			if (pObject != nullptr) {
+				ObjectIndices.insert(std::make_pair(pObject, (nfUint32)Objects.size()));
+				Objects.push_back(pObject);
+			}
+		}
+		nObjectCount = (nfUint32)Objects.size();
+
+		// The depth level of an object is the length of the longest component chain that leads to it.
+		// It is computed in topological order, so shared sub assemblies are visited once per reference.
+		std::vector<nfUint32> InDegrees(nObjectCount, 0);
+		std::vector<nfUint32> Levels(nObjectCount, 1);
+		for (CModelObject * pObject : Objects) {
+			CModelComponentsObject * pComponentsObject = dynamic_cast<CModelComponentsObject *> (pObject);
+			if (pComponentsObject == nullptr)
+				continue;
+			nfUint32 nComponentCount = pComponentsObject->getComponentCount();
+			for (nfUint32 nIndex = 0; nIndex < nComponentCount; nIndex++) {
+				auto iIterator = ObjectIndices.find(pComponentsObject->getComponent(nIndex)->getObject());
+				if (iIterator != ObjectIndices.end())
+					InDegrees[iIterator->second]++;
+			}
+		}
+
+		std::vector<nfUint32> Queue;
+		Queue.reserve(nObjectCount);
+		for (nfUint32 nIndex = 0; nIndex < nObjectCount; nIndex++) {
+			if (InDegrees[nIndex] == 0)
+				Queue.push_back(nIndex);
+		}
+
+		for (size_t nQueueIndex = 0; nQueueIndex < Queue.size(); nQueueIndex++) {
+			nfUint32 nParentIndex = Queue[nQueueIndex];
+			CModelComponentsObject * pComponentsObject = dynamic_cast<CModelComponentsObject *> (Objects[nParentIndex]);
+			if (pComponentsObject == nullptr)
+				continue;
+			nfUint32 nComponentCount = pComponentsObject->getComponentCount();
+			for (nfUint32 nIndex = 0; nIndex < nComponentCount; nIndex++) {
+				auto iIterator = ObjectIndices.find(pComponentsObject->getComponent(nIndex)->getObject());
+				if (iIterator == ObjectIndices.end())
+					continue;
+				nfUint32 nChildIndex = iIterator->second;
+				Levels[nChildIndex] = std::max(Levels[nChildIndex], Levels[nParentIndex] + 1);
+				if (--InDegrees[nChildIndex] == 0)
+					Queue.push_back(nChildIndex);
+			}
+		}
+
+		if (Queue.size() != nObjectCount)
+			throw CNMRException(NMR_ERROR_CYCLICCOMPONENTREFERENCE);
+
+		std::vector<std::pair<nfUint32, nfUint32>> SortKeys;
+		SortKeys.reserve(nObjectCount);
+		for (nfUint32 nIndex = 0; nIndex < nObjectCount; nIndex++)
+			SortKeys.push_back(std::make_pair(Levels[nIndex], nIndex));
+
+		// sort by (level descending, UniqueResourceID ascending)
+		std::sort(SortKeys.begin(), SortKeys.end(), [&Objects](const std::pair<nfUint32, nfUint32> & Key1, const std::pair<nfUint32, nfUint32> & Key2)
+		{
+			if (Key1.first == Key2.first)
+				return (Objects[Key1.second]->getPackageResourceID()->getUniqueID()) < (Objects[Key2.second]->getPackageResourceID()->getUniqueID());
+
+			return Key1.first > Key2.first;
+		});
+
+		m_SortedObjects.reserve(nObjectCount);
+		for (auto & Key : SortKeys)
+			m_SortedObjects.push_back(Objects[Key.second]);
+	}
+
+	const std::vector<MODELINSTANCE> & CModelInstanceCache::getInstances()
+	{
+		update();
+		return m_Instances;
+	}
+
+	void CModelInstanceCache::getBuildItemInstances(_In_ CModelBuildItem * pBuildItem, _Out_ nfUint32 & nFirst, _Out_ nfUint32 & nCount)
+	{
+		update();
+
+		auto iIterator = m_BuildItemIndices.find(pBuildItem);
+		if (iIterator == m_BuildItemIndices.end())
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint32 nBuildItemIndex = iIterator->second;
+		nFirst = m_BuildItemOffsets[nBuildItemIndex];
+		nCount = m_BuildItemOffsets[nBuildItemIndex + 1] - nFirst;
+	}
+
+	const std::vector<CModelObject *> & CModelInstanceCache::getSortedObjects()
+	{
+		update();
+		return m_SortedObjects;
+	}
+
+}
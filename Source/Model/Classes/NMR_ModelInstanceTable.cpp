@@ -0,0 +1,149 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelInstanceTable.cpp implements the instanced view of the build of a model.
+
+--*/
+
+#include "Model/Classes/NMR_ModelInstanceTable.h"
+#include "Model/Classes/NMR_ModelInstanceCache.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Common/NMR_Parallel.h"
+#include "Common/NMR_Exception.h"
+#include <unordered_map>
+
+namespace NMR {
+
+	CModelInstanceTable::CModelInstanceTable(_In_ CModel * pModel, _In_ nfUint32 nThreadCount)
+	{
+		if (pModel == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		const std::vector<MODELINSTANCE> & Instances = pModel->getInstanceCache()->getInstances();
+
+		// Assign mesh indices in order of first appearance and lay out the packed buffers.
+		// Instances of objects that are not meshes (e.g. level sets) have no entry.
+		std::unordered_map<CModelMeshObject *, nfUint32> MeshIndices;
+		std::vector<nfUint32> InstanceMeshIndices;
+		std::vector<const MODELINSTANCE *> MeshInstances;
+		InstanceMeshIndices.reserve(Instances.size());
+		MeshInstances.reserve(Instances.size());
+		nfUint64 nVertexCount = 0;
+		nfUint64 nTriangleCount = 0;
+		for (auto & Instance : Instances) {
+			CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *> (Instance.m_pObject);
+			if (pMeshObject == nullptr)
+				continue;
+
+			auto iIterator = MeshIndices.find(pMeshObject);
+			if (iIterator == MeshIndices.end()) {
+				CMesh * pMesh = pMeshObject->getMesh();
+				MODELINSTANCETABLEMESH Mesh;
+				// Hold a reference, so that the mesh object outlives the table if it is removed from the model
+				Mesh.m_pMeshObject = std::dynamic_pointer_cast<CModelMeshObject> (pModel->findResource(pMeshObject->getPackageResourceID()));
+				if (Mesh.m_pMeshObject.get() != pMeshObject)
+					throw CNMRException(NMR_ERROR_RESOURCENOTFOUND);
+				Mesh.m_nVertexOffset = (nfUint32)nVertexCount;
+				Mesh.m_nVertexCount = pMesh->getNodeCount();
+				Mesh.m_nTriangleOffset = (nfUint32)nTriangleCount;
+				Mesh.m_nTriangleCount = pMesh->getFaceCount();
+				nVertexCount += Mesh.m_nVertexCount;
+				nTriangleCount += Mesh.m_nTriangleCount;
+				if (nVertexCount > NMR_MESH_MAXNODECOUNT)
+					throw CNMRException(NMR_ERROR_TOOMANYNODES);
+				if (nTriangleCount > NMR_MESH_MAXFACECOUNT)
+					throw CNMRException(NMR_ERROR_TOOMANYFACES);
+
+				iIterator = MeshIndices.insert(std::make_pair(pMeshObject, (nfUint32)m_Meshes.size())).first;
+				m_Meshes.push_back(Mesh);
+			}
+			InstanceMeshIndices.push_back(iIterator->second);
+			MeshInstances.push_back(&Instance);
+		}
+
+		m_Vertices.resize((size_t)nVertexCount);
+		m_Indices.resize((size_t)nTriangleCount * 3);
+		fnParallelFor((nfUint32)m_Meshes.size(), nThreadCount, NMR_MODELINSTANCETABLE_MINMESHESPERTHREAD, [this](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nMeshIndex = nBegin; nMeshIndex < nEnd; nMeshIndex++) {
+				const MODELINSTANCETABLEMESH & Mesh = m_Meshes[nMeshIndex];
+				CMesh * pMesh = Mesh.m_pMeshObject->getMesh();
+
+				NVEC3 * pVertex = &m_Vertices[Mesh.m_nVertexOffset];
+				for (nfUint32 nIndex = 0; nIndex < Mesh.m_nVertexCount; nIndex++)
+					pVertex[nIndex] = pMesh->getNode(nIndex)->m_position;
+
+				nfUint32 * pIndex = &m_Indices[(size_t)Mesh.m_nTriangleOffset * 3];
+				for (nfUint32 nIndex = 0; nIndex < Mesh.m_nTriangleCount; nIndex++) {
+					MESHFACE * pFace = pMesh->getFace(nIndex);
+					pIndex[nIndex * 3] = pFace->m_nodeindices[0];
+					pIndex[nIndex * 3 + 1] = pFace->m_nodeindices[1];
+					pIndex[nIndex * 3 + 2] = pFace->m_nodeindices[2];
+				}
+			}
+		});
+
+		m_Entries.resize(MeshInstances.size());
+		fnParallelFor((nfUint32)m_Entries.size(), nThreadCount, NMR_MODELINSTANCETABLE_MININSTANCESPERTHREAD, [&](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nIndex = nBegin; nIndex < nEnd; nIndex++) {
+				MODELINSTANCETABLEENTRY & Entry = m_Entries[nIndex];
+				Entry.m_nMeshIndex = InstanceMeshIndices[nIndex];
+				Entry.m_nBuildItemIndex = MeshInstances[nIndex]->m_nBuildItemIndex;
+				Entry.m_mTransform = MeshInstances[nIndex]->m_mTransform;
+			}
+		});
+	}
+
+	nfUint32 CModelInstanceTable::getMeshCount() const
+	{
+		return (nfUint32)m_Meshes.size();
+	}
+
+	const MODELINSTANCETABLEMESH & CModelInstanceTable::getMesh(_In_ nfUint32 nMeshIndex) const
+	{
+		if (nMeshIndex >= m_Meshes.size())
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+		return m_Meshes[nMeshIndex];
+	}
+
+	const std::vector<NVEC3> & CModelInstanceTable::getVertices() const
+	{
+		return m_Vertices;
+	}
+
+	const std::vector<nfUint32> & CModelInstanceTable::getIndices() const
+	{
+		return m_Indices;
+	}
+
+	const std::vector<MODELINSTANCETABLEENTRY> & CModelInstanceTable::getEntries() const
+	{
+		return m_Entries;
+	}
+
+}
@@ -41,19 +41,71 @@ A color group is an in memory representation of the 3MF color groups node.
 #include "Model/Classes/NMR_ModelConstants.h"
 #include "Common/NMR_Exception.h"
 #include <sstream>
+#include <algorithm>
 
 namespace NMR {
 
 	;
 	CModelMultiPropertyGroupResource::CModelMultiPropertyGroupResource(_In_ const ModelResourceID sID, _In_ CModel * pModel)
-		: CModelResource(sID, pModel)
+		: CModelResource(sID, pModel), m_nUnusedPoolEntries(0)
 	{
-		m_nNextPropertyID = 1;
+	}
+
+	MODELMULTIPROPERTYENTRY CModelMultiPropertyGroupResource::appendToPool(_In_ const ModelPropertyID * pPropertyIDs, _In_ nfUint32 nCount)
+	{
+		if ((pPropertyIDs == nullptr) && (nCount > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		MODELMULTIPROPERTYENTRY Entry;
+		Entry.m_nOffset = (nfUint32)m_PropertyIDPool.size();
+		Entry.m_nCount = nCount;
+
+		// The source may point into the pool itself, which might be reallocated by the insertion
+		const ModelPropertyID * pPoolBegin = m_PropertyIDPool.data();
+		if ((nCount > 0) && (pPropertyIDs >= pPoolBegin) && (pPropertyIDs < pPoolBegin + m_PropertyIDPool.size())) {
+			std::vector<ModelPropertyID> PropertyIDs(pPropertyIDs, pPropertyIDs + nCount);
+			m_PropertyIDPool.insert(m_PropertyIDPool.end(), PropertyIDs.begin(), PropertyIDs.end());
+		}
+		else {
+			m_PropertyIDPool.insert(m_PropertyIDPool.end(), pPropertyIDs, pPropertyIDs + nCount);
+		}
+
+		return Entry;
+	}
+
+	void CModelMultiPropertyGroupResource::releaseFromPool(_In_ const MODELMULTIPROPERTYENTRY & Entry)
+	{
+		m_nUnusedPoolEntries += Entry.m_nCount;
+
+		if ((m_nUnusedPoolEntries >= NMR_MODELMULTIPROPERTYGROUP_MINCOMPACTSIZE) && (m_nUnusedPoolEntries > m_PropertyIDPool.size() / 2))
+			compactPool();
+	}
+
+	void CModelMultiPropertyGroupResource::compactPool()
+	{
+		std::vector<ModelPropertyID> NewPool;
+		NewPool.reserve(m_PropertyIDPool.size() - m_nUnusedPoolEntries);
+
+		m_MultiProperties.forEach([this, &NewPool](ModelPropertyID, MODELMULTIPROPERTYENTRY & Entry) {
+			nfUint32 nNewOffset = (nfUint32)NewPool.size();
+			NewPool.insert(NewPool.end(), m_PropertyIDPool.begin() + Entry.m_nOffset, m_PropertyIDPool.begin() + Entry.m_nOffset + Entry.m_nCount);
+			Entry.m_nOffset = nNewOffset;
+		});
+
+		m_PropertyIDPool.swap(NewPool);
+		m_nUnusedPoolEntries = 0;
 	}
 
 	nfUint32 CModelMultiPropertyGroupResource::addMultiProperty(_In_ PModelMultiProperty pMultiProperty)
 	{
-		nfUint32 nID = m_nNextPropertyID;
+		if (pMultiProperty.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		return addMultiProperty(pMultiProperty->data(), (nfUint32)pMultiProperty->size());
+	}
+
+	nfUint32 CModelMultiPropertyGroupResource::addMultiProperty(_In_ const ModelPropertyID * pPropertyIDs, _In_ nfUint32 nCount)
+	{
 		if (getCount() >= XML_3MF_MAXRESOURCEINDEX) {
 			throw CNMRException(NMR_ERROR_TOOMANYCOMPOSITES);
 		}
@@ -63,9 +115,7 @@ namespace NMR {
 		//	
 		//}
 
-		m_vctMultiProperties.insert(std::make_pair(nID, pMultiProperty));
-
-		m_nNextPropertyID++;
+		nfUint32 nID = m_MultiProperties.add(appendToPool(pPropertyIDs, nCount));
 
 		clearResourceIndexMap();
 
@@ -74,36 +124,62 @@ namespace NMR {
 
 	nfUint32 CModelMultiPropertyGroupResource::getCount()
 	{
-		return (nfUint32)m_vctMultiProperties.size();
+		return m_MultiProperties.getCount();
 	}
 
 	PModelMultiProperty CModelMultiPropertyGroupResource::getMultiProperty(_In_ ModelPropertyID nPropertyID)
 	{
-		auto iIterator = m_vctMultiProperties.find(nPropertyID);
-		if (iIterator != m_vctMultiProperties.end()) {
-			return iIterator->second;
-		}
-		else {
+		nfUint32 nCount;
+		const ModelPropertyID * pPropertyIDs = getMultiPropertyIDs(nPropertyID, nCount);
+
+		return std::make_shared<CModelMultiProperty>(pPropertyIDs, pPropertyIDs + nCount);
+	}
+
+	const ModelPropertyID * CModelMultiPropertyGroupResource::getMultiPropertyIDs(_In_ ModelPropertyID nPropertyID, _Out_ nfUint32 & nCount)
+	{
+		MODELMULTIPROPERTYENTRY * pEntry = m_MultiProperties.find(nPropertyID);
+		if (pEntry == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
-		}
+
+		nCount = pEntry->m_nCount;
+		return m_PropertyIDPool.data() + pEntry->m_nOffset;
 	}
 
 	void CModelMultiPropertyGroupResource::setMultiProperty(_In_ ModelPropertyID nPropertyID, _In_ PModelMultiProperty pMultiProperty)
 	{
-		auto iIterator = m_vctMultiProperties.find(nPropertyID);
-		if (iIterator != m_vctMultiProperties.end()) {
-			// TODO: check whether the respective resource contains the PropertyID
-			// throw CNMRException(NMR_ERROR_PROPERTYIDNOTFOUND);
-			iIterator->second = pMultiProperty;
+		if (pMultiProperty.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		setMultiProperty(nPropertyID, pMultiProperty->data(), (nfUint32)pMultiProperty->size());
+	}
+
+	void CModelMultiPropertyGroupResource::setMultiProperty(_In_ ModelPropertyID nPropertyID, _In_ const ModelPropertyID * pPropertyIDs, _In_ nfUint32 nCount)
+	{
+		MODELMULTIPROPERTYENTRY * pEntry = m_MultiProperties.find(nPropertyID);
+		if (pEntry == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+		// TODO: check whether the respective resource contains the PropertyID
+		// throw CNMRException(NMR_ERROR_PROPERTYIDNOTFOUND);
+		if (pEntry->m_nCount == nCount) {
+			if (nCount > 0)
+				std::copy(pPropertyIDs, pPropertyIDs + nCount, m_PropertyIDPool.begin() + pEntry->m_nOffset);
 		}
 		else {
-			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+			MODELMULTIPROPERTYENTRY OldEntry = *pEntry;
+			*pEntry = appendToPool(pPropertyIDs, nCount);
+			releaseFromPool(OldEntry);
 		}
 	}
 
 	void CModelMultiPropertyGroupResource::removeMultiProperty(_In_ ModelPropertyID nPropertyID)
 	{
-		m_vctMultiProperties.erase(nPropertyID);
+		MODELMULTIPROPERTYENTRY * pEntry = m_MultiProperties.find(nPropertyID);
+		if (pEntry != nullptr) {
+			MODELMULTIPROPERTYENTRY OldEntry = *pEntry;
+			m_MultiProperties.remove(nPropertyID);
+			releaseFromPool(OldEntry);
+		}
 		clearResourceIndexMap();
 	}
 
@@ -184,14 +260,10 @@ namespace NMR {
 		if (pSourceMultiMaterialGroup == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		
-		nfUint32 nCount = pSourceMultiMaterialGroup->getCount();
-		pSourceMultiMaterialGroup->buildResourceIndexMap();
-		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
-			ModelPropertyID nPropertyID;
-			pSourceMultiMaterialGroup->mapResourceIndexToPropertyID(nIndex, nPropertyID);
-			PModelMultiProperty pCmposite = pSourceMultiMaterialGroup->getMultiProperty(nPropertyID);
-			addMultiProperty(pCmposite);
-		}
+		m_MultiProperties.reserve(getCount() + pSourceMultiMaterialGroup->getCount());
+		pSourceMultiMaterialGroup->m_MultiProperties.forEach([this, pSourceMultiMaterialGroup](ModelPropertyID, MODELMULTIPROPERTYENTRY & Entry) {
+			addMultiProperty(pSourceMultiMaterialGroup->m_PropertyIDPool.data() + Entry.m_nOffset, Entry.m_nCount);
+		});
 
 		nfUint32 nLayers = pSourceMultiMaterialGroup->getLayerCount();
 		for (nfUint32 nIndex = 0; nIndex < nLayers; nIndex++) {
@@ -204,15 +276,7 @@ namespace NMR {
 
 	void CModelMultiPropertyGroupResource::buildResourceIndexMap()
 	{
-		m_ResourceIndexMap.clear();
-		m_ResourceIndexMap.reserve(m_vctMultiProperties.size());
-
-		auto iIterator = m_vctMultiProperties.begin();
-		while (iIterator != m_vctMultiProperties.end()) {
-			m_ResourceIndexMap.push_back(iIterator->first);
-			iIterator++;
-		}
-
+		m_MultiProperties.getPropertyIDs(m_ResourceIndexMap);
 		m_bHasResourceIndexMap = true;
 	}
 
@@ -0,0 +1,319 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelPropertyDeduplicator.cpp implements the optimization pass that merges
+equal entries of color and texture coordinate groups.
+
+--*/
+
+#include "Model/Classes/NMR_ModelPropertyDeduplicator.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelColorGroup.h"
+#include "Model/Classes/NMR_ModelTexture2DGroup.h"
+#include "Model/Classes/NMR_ModelMultiPropertyGroup.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
+#include "Common/NMR_IndexHashTable.h"
+#include "Common/NMR_Parallel.h"
+#include "Common/NMR_Exception.h"
+#include <cstring>
+
+namespace NMR {
+
+	// Maps every PropertyID of a group to the smallest PropertyID with an equal value
+	template <typename T, typename H, typename E>
+	static void fnFindCanonicalIDs(_In_ CModelResource * pResource, _In_ const std::vector<T> & Values, _In_ H fnHash, _In_ E fnIsEqual, _Out_ std::vector<ModelPropertyID> & CanonicalIDs)
+	{
+		nfUint32 nCount = (nfUint32)Values.size();
+		pResource->buildResourceIndexMap();
+
+		std::vector<ModelPropertyID> PropertyIDs(nCount);
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			if (!pResource->mapResourceIndexToPropertyID(nIndex, PropertyIDs[nIndex]))
+				throw CNMRException(NMR_ERROR_INVALIDPROPERTYRESOURCEID);
+		}
+
+		CanonicalIDs.clear();
+		if (nCount == 0)
+			return;
+		CanonicalIDs.resize((size_t)PropertyIDs[nCount - 1] + 1, 0);
+
+		CIndexHashTable HashTable;
+		HashTable.reserve(nCount);
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			const T & Value = Values[nIndex];
+			nfUint32 nHash = fnHash(Value);
+
+			nfUint32 nFirstIndex;
+			if (HashTable.find(nHash, [&Values, &Value, &fnIsEqual](nfUint32 nOtherIndex) { return fnIsEqual(Values[nOtherIndex], Value); }, nFirstIndex)) {
+				CanonicalIDs[PropertyIDs[nIndex]] = PropertyIDs[nFirstIndex];
+			}
+			else {
+				HashTable.insert(nHash, nIndex);
+				CanonicalIDs[PropertyIDs[nIndex]] = PropertyIDs[nIndex];
+			}
+		}
+	}
+
+	static nfUint64 fnDoubleToBits(_In_ nfDouble dValue)
+	{
+		// -0.0 and 0.0 compare equal and need to hash equally
+		if (dValue == 0.0)
+			dValue = 0.0;
+		nfUint64 nBits;
+		memcpy(&nBits, &dValue, sizeof(nBits));
+		return nBits;
+	}
+
+	CModelPropertyDeduplicator::CModelPropertyDeduplicator(_In_ CModel * pModel, _In_ nfUint32 nThreadCount)
+		: m_pModel(pModel), m_nThreadCount(nThreadCount)
+	{
+		if (pModel == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	void CModelPropertyDeduplicator::collectGroups()
+	{
+		m_Groups.clear();
+		m_GroupIndices.clear();
+
+		std::vector<CModelResource *> Resources;
+		nfUint32 nColorGroupCount = m_pModel->getColorGroupCount();
+		for (nfUint32 nIndex = 0; nIndex < nColorGroupCount; nIndex++)
+			Resources.push_back(m_pModel->getColorGroup(nIndex));
+		nfUint32 nTexture2DGroupCount = m_pModel->getTexture2DGroupCount();
+		for (nfUint32 nIndex = 0; nIndex < nTexture2DGroupCount; nIndex++)
+			Resources.push_back(m_pModel->getTexture2DGroup(nIndex));
+
+		m_Groups.resize(Resources.size());
+		for (size_t nIndex = 0; nIndex < Resources.size(); nIndex++) {
+			m_Groups[nIndex].m_pResource = Resources[nIndex];
+			m_GroupIndices.insert(std::make_pair(Resources[nIndex]->getPackageResourceID()->getUniqueID(), (nfUint32)nIndex));
+		}
+	}
+
+	void CModelPropertyDeduplicator::findDuplicates(_In_ MODELPROPERTYDEDUPLICATORGROUP & Group)
+	{
+		CModelColorGroupResource * pColorGroup = dynamic_cast<CModelColorGroupResource *>(Group.m_pResource);
+		CModelTexture2DGroupResource * pTexture2DGroup = dynamic_cast<CModelTexture2DGroupResource *>(Group.m_pResource);
+
+		if (pColorGroup != nullptr) {
+			std::vector<nfColor> Colors(pColorGroup->getCount());
+			pColorGroup->getAllColors(Colors.data());
+			fnFindCanonicalIDs(pColorGroup, Colors,
+				[](const nfColor & cColor) { return fnHashUint64(cColor); },
+				[](const nfColor & cColor1, const nfColor & cColor2) { return cColor1 == cColor2; },
+				Group.m_CanonicalIDs);
+		}
+		else if (pTexture2DGroup != nullptr) {
+			std::vector<MODELTEXTURE2DCOORDINATE> UVCoordinates(pTexture2DGroup->getCount());
+			pTexture2DGroup->getAllUVCoordinates(UVCoordinates.data());
+			fnFindCanonicalIDs(pTexture2DGroup, UVCoordinates,
+				[](const MODELTEXTURE2DCOORDINATE & UV) { return fnHashUint64(fnDoubleToBits(UV.m_dU) ^ (fnDoubleToBits(UV.m_dV) * 0x9e3779b97f4a7c15ULL)); },
+				[](const MODELTEXTURE2DCOORDINATE & UV1, const MODELTEXTURE2DCOORDINATE & UV2) { return (UV1.m_dU == UV2.m_dU) && (UV1.m_dV == UV2.m_dV); },
+				Group.m_CanonicalIDs);
+		}
+		else
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		Group.m_Referenced = std::vector<std::atomic<nfBool>>(Group.m_CanonicalIDs.size());
+	}
+
+	CModelPropertyDeduplicator::MODELPROPERTYDEDUPLICATORGROUP * CModelPropertyDeduplicator::findGroup(_In_ UniqueResourceID nUniqueResourceID)
+	{
+		auto iIterator = m_GroupIndices.find(nUniqueResourceID);
+		if (iIterator == m_GroupIndices.end())
+			return nullptr;
+		return &m_Groups[iIterator->second];
+	}
+
+	void CModelPropertyDeduplicator::remapMesh(_In_ CMesh * pMesh)
+	{
+		CMeshInformationHandler * pMeshInformationHandler = pMesh->getMeshInformationHandler();
+		if (pMeshInformationHandler == nullptr)
+			return;
+		CMeshInformation_Properties * pProperties = dynamic_cast<CMeshInformation_Properties *>(pMeshInformationHandler->getInformationByType(0, emiProperties));
+		if (pProperties == nullptr)
+			return;
+
+		// Consecutive faces mostly share their resource, so the last group lookup is cached
+		auto fnRemap = [this](MESHINFORMATION_PROPERTIES * pData, UniqueResourceID & nCachedResourceID, MODELPROPERTYDEDUPLICATORGROUP *& pCachedGroup) {
+			if ((pData == nullptr) || (pData->m_nUniqueResourceID == 0))
+				return;
+			if (pData->m_nUniqueResourceID != nCachedResourceID) {
+				nCachedResourceID = pData->m_nUniqueResourceID;
+				pCachedGroup = findGroup(nCachedResourceID);
+			}
+			if (pCachedGroup == nullptr)
+				return;
+
+			for (nfUint32 j = 0; j < 3; j++) {
+				ModelPropertyID nPropertyID = pData->m_nPropertyIDs[j];
+				if (nPropertyID < pCachedGroup->m_CanonicalIDs.size()) {
+					ModelPropertyID nCanonicalID = pCachedGroup->m_CanonicalIDs[nPropertyID];
+					if (nCanonicalID != 0) {
+						pData->m_nPropertyIDs[j] = nCanonicalID;
+						pCachedGroup->m_Referenced[nCanonicalID].store(true, std::memory_order_relaxed);
+					}
+				}
+			}
+		};
+
+		UniqueResourceID nCachedResourceID = 0;
+		MODELPROPERTYDEDUPLICATORGROUP * pCachedGroup = nullptr;
+		fnRemap((MESHINFORMATION_PROPERTIES*)pProperties->getDefaultData(), nCachedResourceID, pCachedGroup);
+
+		fnParallelFor(pMesh->getFaceCount(), m_nThreadCount, NMR_MODELPROPERTYDEDUPLICATOR_MINFACESPERTHREAD, [pProperties, &fnRemap](nfUint32 nBegin, nfUint32 nEnd) {
+			UniqueResourceID nRangeResourceID = 0;
+			MODELPROPERTYDEDUPLICATORGROUP * pRangeGroup = nullptr;
+			for (nfUint32 nFaceIndex = nBegin; nFaceIndex < nEnd; nFaceIndex++)
+				fnRemap((MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(nFaceIndex), nRangeResourceID, pRangeGroup);
+		});
+	}
+
+	void CModelPropertyDeduplicator::remapMultiProperties()
+	{
+		nfUint32 nGroupCount = m_pModel->getMultiPropertyGroupCount();
+		for (nfUint32 nGroupIndex = 0; nGroupIndex < nGroupCount; nGroupIndex++) {
+			CModelMultiPropertyGroupResource * pMultiPropertyGroup = m_pModel->getMultiPropertyGroup(nGroupIndex);
+
+			nfUint32 nLayerCount = pMultiPropertyGroup->getLayerCount();
+			std::vector<MODELPROPERTYDEDUPLICATORGROUP *> LayerGroups(nLayerCount);
+			for (nfUint32 nLayer = 0; nLayer < nLayerCount; nLayer++)
+				LayerGroups[nLayer] = findGroup(pMultiPropertyGroup->getLayer(nLayer).m_nUniqueResourceID);
+
+			pMultiPropertyGroup->buildResourceIndexMap();
+			nfUint32 nCount = pMultiPropertyGroup->getCount();
+			std::vector<ModelPropertyID> PropertyIDs;
+			for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+				ModelPropertyID nMultiPropertyID;
+				if (!pMultiPropertyGroup->mapResourceIndexToPropertyID(nIndex, nMultiPropertyID))
+					throw CNMRException(NMR_ERROR_INVALIDPROPERTYRESOURCEID);
+
+				nfUint32 nPropertyIDCount;
+				const ModelPropertyID * pPropertyIDs = pMultiPropertyGroup->getMultiPropertyIDs(nMultiPropertyID, nPropertyIDCount);
+				PropertyIDs.assign(pPropertyIDs, pPropertyIDs + nPropertyIDCount);
+
+				nfBool bChanged = false;
+				for (nfUint32 nLayer = 0; (nLayer < nLayerCount) && (nLayer < nPropertyIDCount); nLayer++) {
+					MODELPROPERTYDEDUPLICATORGROUP * pGroup = LayerGroups[nLayer];
+					if ((pGroup == nullptr) || (PropertyIDs[nLayer] >= pGroup->m_CanonicalIDs.size()))
+						continue;
+					ModelPropertyID nCanonicalID = pGroup->m_CanonicalIDs[PropertyIDs[nLayer]];
+					if (nCanonicalID == 0)
+						continue;
+					pGroup->m_Referenced[nCanonicalID].store(true, std::memory_order_relaxed);
+					if (nCanonicalID != PropertyIDs[nLayer]) {
+						PropertyIDs[nLayer] = nCanonicalID;
+						bChanged = true;
+					}
+				}
+
+				if (bChanged)
+					pMultiPropertyGroup->setMultiProperty(nMultiPropertyID, PropertyIDs.data(), nPropertyIDCount);
+			}
+		}
+	}
+
+	nfUint32 CModelPropertyDeduplicator::removeEntries(_In_ MODELPROPERTYDEDUPLICATORGROUP & Group, _In_ nfBool bRemoveUnreferenced)
+	{
+		CModelColorGroupResource * pColorGroup = dynamic_cast<CModelColorGroupResource *>(Group.m_pResource);
+		CModelTexture2DGroupResource * pTexture2DGroup = dynamic_cast<CModelTexture2DGroupResource *>(Group.m_pResource);
+
+		nfBool bIsReferenced = false;
+		for (auto & bReferenced : Group.m_Referenced) {
+			if (bReferenced.load(std::memory_order_relaxed)) {
+				bIsReferenced = true;
+				break;
+			}
+		}
+
+		nfUint32 nRemovedCount = 0;
+		nfUint32 nSize = (nfUint32)Group.m_CanonicalIDs.size();
+		for (ModelPropertyID nPropertyID = 1; nPropertyID < nSize; nPropertyID++) {
+			ModelPropertyID nCanonicalID = Group.m_CanonicalIDs[nPropertyID];
+			if (nCanonicalID == 0)
+				continue;
+
+			nfBool bRemove = (nCanonicalID != nPropertyID);
+			if (!bRemove && bRemoveUnreferenced && bIsReferenced)
+				bRemove = !Group.m_Referenced[nPropertyID].load(std::memory_order_relaxed);
+
+			if (bRemove) {
+				if (pColorGroup != nullptr)
+					pColorGroup->removeColor(nPropertyID);
+				else if (pTexture2DGroup != nullptr)
+					pTexture2DGroup->removePropertyID(nPropertyID);
+				nRemovedCount++;
+			}
+		}
+
+		return nRemovedCount;
+	}
+
+	nfUint32 CModelPropertyDeduplicator::deduplicate(_In_ nfBool bRemoveUnreferenced)
+	{
+		collectGroups();
+		nfUint32 nGroupCount = (nfUint32)m_Groups.size();
+		if (nGroupCount == 0)
+			return 0;
+
+		fnParallelFor(nGroupCount, m_nThreadCount, 1, [this](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nIndex = nBegin; nIndex < nEnd; nIndex++)
+				findDuplicates(m_Groups[nIndex]);
+		});
+
+		nfUint32 nObjectCount = m_pModel->getObjectCount();
+		for (nfUint32 nIndex = 0; nIndex < nObjectCount; nIndex++) {
+			CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *>(m_pModel->getObject(nIndex));
+			if (pMeshObject != nullptr)
+				remapMesh(pMeshObject->getMesh());
+		}
+
+		remapMultiProperties();
+
+		std::vector<nfUint32> RemovedCounts(nGroupCount, 0);
+		fnParallelFor(nGroupCount, m_nThreadCount, 1, [this, &RemovedCounts, bRemoveUnreferenced](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nIndex = nBegin; nIndex < nEnd; nIndex++)
+				RemovedCounts[nIndex] = removeEntries(m_Groups[nIndex], bRemoveUnreferenced);
+		});
+
+		nfUint32 nRemovedCount = 0;
+		for (nfUint32 nCount : RemovedCounts)
+			nRemovedCount += nCount;
+
+		if (nRemovedCount > 0)
+			m_pModel->increaseRevision();
+
+		m_Groups.clear();
+		m_GroupIndices.clear();
+
+		return nRemovedCount;
+	}
+
+}
@@ -63,6 +63,12 @@ namespace NMR {
 		m_Vertices.clear();
 	}
 
+	void CSlice::reserve(nfUint32 nVertexCount, nfUint32 nPolygonCount)
+	{
+		m_Vertices.reserve(nVertexCount);
+		m_Polygons.reserve(nPolygonCount);
+	}
+
 	nfUint32 CSlice::addVertex(nfFloat x, nfFloat y)
 	{
 		SLICENODE cNode;
@@ -135,7 +141,7 @@ namespace NMR {
 
 	bool CSlice::allPolygonsAreClosed()
 	{
-		for (auto polygon : m_Polygons) {
+		for (auto & polygon : m_Polygons) {
 			if (polygon.size() > 1) {
 				if (*polygon.begin() != *polygon.rbegin()) {
 					return false;
@@ -175,5 +181,13 @@ namespace NMR {
 
 		return (nfUint32)m_Polygons[nPolygonIndex].size();
 	}
+
+	const std::vector<nfUint32> & CSlice::getPolygon(nfUint32 nPolygonIndex)
+	{
+		if (nPolygonIndex >= m_Polygons.size())
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+		return m_Polygons[nPolygonIndex];
+	}
 }
 
@@ -32,9 +32,11 @@ NMR_ModelSliceStackResource.h: implements the resource object for a slice stack
 
 #include "Model/Classes/NMR_ModelSliceStack.h"
 #include "Model/Classes/NMR_ModelResource.h"
+#include "Model/Classes/NMR_ModelSliceValidator.h"
 #include "Common/NMR_Exception.h"
 
 #include <cmath>
+#include <algorithm>
 
 namespace NMR {
 
@@ -69,6 +71,21 @@ namespace NMR {
 		return pSlice;
 	}
 
+	void CModelSliceStack::AddSlice(PSlice pSlice)
+	{
+		if (!pSlice)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (!AllowsGeometry()) {
+			throw CNMRException(NMR_ERROR_SLICES_MIXING_SLICES_WITH_SLICEREFS);
+		}
+
+		nfDouble dLowerZ = (m_pSlices.size() > 0) ? m_pSlices.back()->getTopZ() : m_dZBottom;
+		if (dLowerZ >= pSlice->getTopZ())
+			throw CNMRException(NMR_ERROR_SLICES_Z_NOTINCREASING);
+
+		m_pSlices.push_back(pSlice);
+	}
+
 	void CModelSliceStack::AddSliceRef(PModelSliceStack pOtherStack, bool bPedantic)
 	{
 		if (!AllowsReferences()) {
@@ -190,18 +207,109 @@ namespace NMR {
 		return dHighestZ;
 	}
 
-	bool CModelSliceStack::areAllPolygonsClosed()
+	// Returns the number of own slices with an upper Z-coordinate below dZ
+	nfUint32 CModelSliceStack::countSlicesBelow(nfDouble dZ) const
 	{
-		for (auto pSlice : m_pSlices) {
-			if (!pSlice->allPolygonsAreClosed())
-				return false;
+		auto iSlice = std::lower_bound(m_pSlices.begin(), m_pSlices.end(), dZ,
+			[](const PSlice & pSlice, nfDouble dValue) { return pSlice->getTopZ() < dValue; });
+		return nfUint32(iSlice - m_pSlices.begin());
+	}
+
+	// Returns the number of slices in the slice view with an upper Z-coordinate below dZ
+	nfUint64 CModelSliceStack::countTotalSlicesBelow(nfDouble dZ) const
+	{
+		if (m_pSliceRefs.empty())
+			return countSlicesBelow(dZ);
+
+		nfUint64 nCount = 0;
+		for (auto pSliceRef : m_pSliceRefs) {
+			if (pSliceRef->getHighestZ() >= dZ)
+				return nCount + pSliceRef->countSlicesBelow(dZ);
+			nCount += pSliceRef->m_pSlices.size();
 		}
+		return nCount;
+	}
+
+	// Returns the lower Z-coordinate of a slice in the slice view, i.e. the upper Z-coordinate of its predecessor or the bottom of its stack
+	nfDouble CModelSliceStack::getTotalSliceLowerZ(nfUint64 nIndex) const
+	{
+		if (m_pSliceRefs.empty())
+			return (nIndex > 0) ? m_pSlices[(size_t)nIndex - 1]->getTopZ() : m_dZBottom;
 
 		for (auto pSliceRef : m_pSliceRefs) {
-			if (!pSliceRef->areAllPolygonsClosed())
-				return false;
+			nfUint64 nSliceCount = pSliceRef->m_pSlices.size();
+			if (nIndex < nSliceCount)
+				return pSliceRef->getTotalSliceLowerZ(nIndex);
+			nIndex -= nSliceCount;
 		}
+		throw CNMRException(NMR_ERROR_INVALIDINDEX);
+	}
 
+	nfUint64 CModelSliceStack::getTotalSliceCount() const
+	{
+		if (m_pSliceRefs.empty())
+			return m_pSlices.size();
+
+		nfUint64 nCount = 0;
+		for (auto pSliceRef : m_pSliceRefs)
+			nCount += pSliceRef->m_pSlices.size();
+		return nCount;
+	}
+
+	PSlice CModelSliceStack::getTotalSlice(nfUint64 nIndex) const
+	{
+		if (m_pSliceRefs.empty()) {
+			if (nIndex >= m_pSlices.size())
+				throw CNMRException(NMR_ERROR_INVALIDINDEX);
+			return m_pSlices[(size_t)nIndex];
+		}
+
+		for (auto pSliceRef : m_pSliceRefs) {
+			nfUint64 nSliceCount = pSliceRef->m_pSlices.size();
+			if (nIndex < nSliceCount)
+				return pSliceRef->m_pSlices[(size_t)nIndex];
+			nIndex -= nSliceCount;
+		}
+		throw CNMRException(NMR_ERROR_INVALIDINDEX);
+	}
+
+	nfBool CModelSliceStack::findTotalSliceAtZ(nfDouble dZ, nfUint64 & nIndex) const
+	{
+		nfUint64 nCandidate = countTotalSlicesBelow(dZ);
+		if (nCandidate >= getTotalSliceCount())
+			return false;
+		if (getTotalSliceLowerZ(nCandidate) >= dZ)
+			return false;
+
+		nIndex = nCandidate;
+		return true;
+	}
+
+	void CModelSliceStack::getTotalSliceRange(nfDouble dZMin, nfDouble dZMax, nfUint64 & nFirstIndex, nfUint64 & nCount) const
+	{
+		if (dZMin > dZMax)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint64 nTotalCount = getTotalSliceCount();
+		nfUint64 nFirst = countTotalSlicesBelow(dZMin);
+		nfUint64 nEnd = countTotalSlicesBelow(dZMax);
+		if ((nEnd < nTotalCount) && (getTotalSliceLowerZ(nEnd) < dZMax))
+			nEnd++;
+
+		nFirstIndex = nFirst;
+		nCount = (nEnd > nFirst) ? (nEnd - nFirst) : 0;
+	}
+
+	bool CModelSliceStack::areAllPolygonsClosed()
+	{
+		CModelSliceValidator Validator(NMR_MODELSLICEVALIDATOR_CHECKCLOSURE);
+		std::vector<MODELSLICELAYERREPORT> Reports;
+		Validator.validateStack(this, Reports);
+
+		for (auto & Report : Reports) {
+			if (Report.m_nOpenPolygons > 0)
+				return false;
+		}
 		return true;
 	}
 
@@ -0,0 +1,315 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelSliceValidator.cpp implements the validation pass for the polygons of a
+slice stack.
+
+--*/
+
+#include "Model/Classes/NMR_ModelSliceValidator.h"
+#include "Model/Classes/NMR_ModelSliceStack.h"
+#include "Common/NMR_Parallel.h"
+#include "Common/NMR_Exception.h"
+#include <algorithm>
+#include <cmath>
+
+namespace NMR {
+
+	static nfDouble fnOrientation(_In_ const NVEC2 & vA, _In_ const NVEC2 & vB, _In_ const NVEC2 & vC)
+	{
+		return ((nfDouble)vB.m_values.x - vA.m_values.x) * ((nfDouble)vC.m_values.y - vA.m_values.y) -
+			((nfDouble)vB.m_values.y - vA.m_values.y) * ((nfDouble)vC.m_values.x - vA.m_values.x);
+	}
+
+	// Returns true, if vP lies within the bounding box of the segment vA-vB. Only meaningful for collinear points.
+	static nfBool fnIsWithinSegment(_In_ const NVEC2 & vA, _In_ const NVEC2 & vB, _In_ const NVEC2 & vP)
+	{
+		return (vP.m_values.x >= std::min(vA.m_values.x, vB.m_values.x)) && (vP.m_values.x <= std::max(vA.m_values.x, vB.m_values.x)) &&
+			(vP.m_values.y >= std::min(vA.m_values.y, vB.m_values.y)) && (vP.m_values.y <= std::max(vA.m_values.y, vB.m_values.y));
+	}
+
+	// Segments that touch count as intersecting
+	static nfBool fnSegmentsIntersect(_In_ const NVEC2 & vA1, _In_ const NVEC2 & vA2, _In_ const NVEC2 & vB1, _In_ const NVEC2 & vB2)
+	{
+		nfDouble d1 = fnOrientation(vB1, vB2, vA1);
+		nfDouble d2 = fnOrientation(vB1, vB2, vA2);
+		nfDouble d3 = fnOrientation(vA1, vA2, vB1);
+		nfDouble d4 = fnOrientation(vA1, vA2, vB2);
+
+		if ((((d1 > 0) && (d2 < 0)) || ((d1 < 0) && (d2 > 0))) && (((d3 > 0) && (d4 < 0)) || ((d3 < 0) && (d4 > 0))))
+			return true;
+
+		return ((d1 == 0) && fnIsWithinSegment(vB1, vB2, vA1)) || ((d2 == 0) && fnIsWithinSegment(vB1, vB2, vA2)) ||
+			((d3 == 0) && fnIsWithinSegment(vA1, vA2, vB1)) || ((d4 == 0) && fnIsWithinSegment(vA1, vA2, vB2));
+	}
+
+	// Two consecutive segments vA-vB and vB-vC only intersect, if vC folds back onto vA-vB
+	static nfBool fnSegmentsFoldBack(_In_ const NVEC2 & vA, _In_ const NVEC2 & vB, _In_ const NVEC2 & vC)
+	{
+		if (fnOrientation(vA, vB, vC) != 0)
+			return false;
+		return ((nfDouble)vA.m_values.x - vB.m_values.x) * ((nfDouble)vC.m_values.x - vB.m_values.x) +
+			((nfDouble)vA.m_values.y - vB.m_values.y) * ((nfDouble)vC.m_values.y - vB.m_values.y) > 0;
+	}
+
+	// Crossing number test of a point against a closed polygon
+	static nfBool fnIsPointInPolygon(_In_ CSlice * pSlice, _In_ const std::vector<nfUint32> & Polygon, _In_ const NVEC2 & vPoint)
+	{
+		nfBool bInside = false;
+		size_t nSegmentCount = Polygon.size() - 1;
+		for (size_t nIndex = 0; nIndex < nSegmentCount; nIndex++) {
+			const NVEC2 & vA = pSlice->getNode(Polygon[nIndex])->m_position;
+			const NVEC2 & vB = pSlice->getNode(Polygon[nIndex + 1])->m_position;
+			if ((vA.m_values.y > vPoint.m_values.y) != (vB.m_values.y > vPoint.m_values.y)) {
+				nfDouble dX = vA.m_values.x + ((nfDouble)vPoint.m_values.y - vA.m_values.y) * ((nfDouble)vB.m_values.x - vA.m_values.x) / ((nfDouble)vB.m_values.y - vA.m_values.y);
+				if (vPoint.m_values.x < dX)
+					bInside = !bInside;
+			}
+		}
+		return bInside;
+	}
+
+	CModelSliceValidator::CModelSliceValidator(_In_ nfUint32 nChecks, _In_ nfUint32 nThreadCount)
+		: m_nChecks(nChecks), m_nThreadCount(nThreadCount)
+	{
+	}
+
+	nfUint32 CModelSliceValidator::countIntersections(_In_ CSlice * pSlice, _In_ const std::vector<SLICECONTOUR> & Contours)
+	{
+		size_t nSegmentTotal = 0;
+		for (auto & Contour : Contours)
+			nSegmentTotal += pSlice->getPolygon(Contour.m_nPolygon).size() - 1;
+
+		std::vector<SLICESEGMENT> Segments;
+		Segments.reserve(nSegmentTotal);
+		for (auto & Contour : Contours) {
+			const std::vector<nfUint32> & Polygon = pSlice->getPolygon(Contour.m_nPolygon);
+			nfUint32 nSegmentCount = (nfUint32)Polygon.size() - 1;
+			for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++) {
+				const NVEC2 & vA = pSlice->getNode(Polygon[nSegment])->m_position;
+				const NVEC2 & vB = pSlice->getNode(Polygon[nSegment + 1])->m_position;
+
+				SLICESEGMENT Segment;
+				Segment.m_nPolygon = Contour.m_nPolygon;
+				Segment.m_nSegment = nSegment;
+				Segment.m_nSegmentCount = nSegmentCount;
+				Segment.m_vStart = vA;
+				Segment.m_vEnd = vB;
+				Segment.m_fMaxX = std::max(vA.m_values.x, vB.m_values.x);
+				Segment.m_fMinY = std::min(vA.m_values.y, vB.m_values.y);
+				Segment.m_fMaxY = std::max(vA.m_values.y, vB.m_values.y);
+				Segments.push_back(Segment);
+			}
+		}
+
+		// Sweep in X: every segment is tested against the segments whose X-range is still open
+		std::vector<std::pair<nfFloat, nfUint32>> SweepOrder(Segments.size());
+		for (size_t nIndex = 0; nIndex < Segments.size(); nIndex++)
+			SweepOrder[nIndex] = std::make_pair(std::min(Segments[nIndex].m_vStart.m_values.x, Segments[nIndex].m_vEnd.m_values.x), (nfUint32)nIndex);
+		std::sort(SweepOrder.begin(), SweepOrder.end());
+
+		nfUint32 nIntersections = 0;
+		std::vector<const SLICESEGMENT *> ActiveSegments;
+		for (auto & SweepEntry : SweepOrder) {
+			const SLICESEGMENT & Segment = Segments[SweepEntry.second];
+			size_t nActiveIndex = 0;
+			while (nActiveIndex < ActiveSegments.size()) {
+				if (ActiveSegments[nActiveIndex]->m_fMaxX < SweepEntry.first) {
+					ActiveSegments[nActiveIndex] = ActiveSegments.back();
+					ActiveSegments.pop_back();
+				}
+				else
+					nActiveIndex++;
+			}
+
+			const NVEC2 & vB1 = Segment.m_vStart;
+			const NVEC2 & vB2 = Segment.m_vEnd;
+			for (auto pOther : ActiveSegments) {
+				if ((pOther->m_fMaxY < Segment.m_fMinY) || (pOther->m_fMinY > Segment.m_fMaxY))
+					continue;
+
+				const NVEC2 & vA1 = pOther->m_vStart;
+				const NVEC2 & vA2 = pOther->m_vEnd;
+
+				nfBool bIntersects;
+				nfUint32 nDistance = (Segment.m_nSegment + Segment.m_nSegmentCount - pOther->m_nSegment) % Segment.m_nSegmentCount;
+				if ((pOther->m_nPolygon == Segment.m_nPolygon) && (nDistance == 1))
+					bIntersects = fnSegmentsFoldBack(vA1, vA2, vB2);
+				else if ((pOther->m_nPolygon == Segment.m_nPolygon) && (nDistance == Segment.m_nSegmentCount - 1))
+					bIntersects = fnSegmentsFoldBack(vB1, vB2, vA2);
+				else
+					bIntersects = fnSegmentsIntersect(vA1, vA2, vB1, vB2);
+
+				if (bIntersects)
+					nIntersections++;
+			}
+
+			ActiveSegments.push_back(&Segment);
+		}
+
+		return nIntersections;
+	}
+
+	void CModelSliceValidator::checkNesting(_In_ CSlice * pSlice, _In_ const std::vector<SLICECONTOUR> & Contours, _Out_ MODELSLICELAYERREPORT & Report)
+	{
+		size_t nContourCount = Contours.size();
+		std::vector<nfUint32> Depths(nContourCount, 0);
+		std::vector<size_t> Parents(nContourCount, nContourCount);
+
+		for (size_t nContour = 0; nContour < nContourCount; nContour++) {
+			const SLICECONTOUR & Contour = Contours[nContour];
+			const NVEC2 & vPoint = pSlice->getNode(pSlice->getPolygon(Contour.m_nPolygon)[0])->m_position;
+
+			for (size_t nOther = 0; nOther < nContourCount; nOther++) {
+				const SLICECONTOUR & Other = Contours[nOther];
+				if ((nOther == nContour) || (vPoint.m_values.x < Other.m_fMinX) || (vPoint.m_values.x > Other.m_fMaxX) ||
+					(vPoint.m_values.y < Other.m_fMinY) || (vPoint.m_values.y > Other.m_fMaxY))
+					continue;
+
+				if (fnIsPointInPolygon(pSlice, pSlice->getPolygon(Other.m_nPolygon), vPoint)) {
+					Depths[nContour]++;
+					// The innermost enclosing contour has the smallest area
+					if ((Parents[nContour] == nContourCount) || (std::fabs(Other.m_dArea) < std::fabs(Contours[Parents[nContour]].m_dArea)))
+						Parents[nContour] = nOther;
+				}
+			}
+
+			Report.m_nMaxNestingDepth = std::max(Report.m_nMaxNestingDepth, Depths[nContour]);
+		}
+
+		// Outer contours share the orientation of the first outer contour, nested contours alternate
+		size_t nReference = nContourCount;
+		for (size_t nContour = 0; nContour < nContourCount; nContour++) {
+			const SLICECONTOUR & Contour = Contours[nContour];
+			if (Parents[nContour] == nContourCount) {
+				if (nReference == nContourCount)
+					nReference = nContour;
+				else if ((Contour.m_dArea > 0) != (Contours[nReference].m_dArea > 0))
+					Report.m_nOrientationErrors++;
+			}
+			else if ((Contour.m_dArea > 0) == (Contours[Parents[nContour]].m_dArea > 0))
+				Report.m_nOrientationErrors++;
+		}
+	}
+
+	nfBool CModelSliceValidator::validateSlice(_In_ CSlice * pSlice, _Out_ MODELSLICELAYERREPORT & Report)
+	{
+		if (pSlice == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		Report = MODELSLICELAYERREPORT();
+		nfBool bNeedsContours = (m_nChecks & (NMR_MODELSLICEVALIDATOR_CHECKINTERSECTIONS | NMR_MODELSLICEVALIDATOR_CHECKORIENTATION)) != 0;
+
+		std::vector<SLICECONTOUR> Contours;
+		nfUint32 nPolygonCount = pSlice->getPolygonCount();
+		for (nfUint32 nPolygon = 0; nPolygon < nPolygonCount; nPolygon++) {
+			const std::vector<nfUint32> & Polygon = pSlice->getPolygon(nPolygon);
+			if (Polygon.size() <= 1) {
+				Report.m_nDegeneratePolygons++;
+				continue;
+			}
+			if (Polygon.front() != Polygon.back()) {
+				Report.m_nOpenPolygons++;
+				continue;
+			}
+			if (Polygon.size() < 4) {
+				Report.m_nDegeneratePolygons++;
+				continue;
+			}
+			if (!bNeedsContours)
+				continue;
+
+			SLICECONTOUR Contour;
+			const NVEC2 & vOrigin = pSlice->getNode(Polygon[0])->m_position;
+			Contour.m_nPolygon = nPolygon;
+			Contour.m_dArea = 0.0;
+			Contour.m_fMinX = Contour.m_fMaxX = vOrigin.m_values.x;
+			Contour.m_fMinY = Contour.m_fMaxY = vOrigin.m_values.y;
+			for (size_t nIndex = 1; nIndex + 1 < Polygon.size(); nIndex++) {
+				const NVEC2 & vA = pSlice->getNode(Polygon[nIndex])->m_position;
+				const NVEC2 & vB = pSlice->getNode(Polygon[nIndex + 1])->m_position;
+				Contour.m_dArea += fnOrientation(vOrigin, vA, vB) * 0.5;
+				Contour.m_fMinX = std::min(Contour.m_fMinX, vA.m_values.x);
+				Contour.m_fMaxX = std::max(Contour.m_fMaxX, vA.m_values.x);
+				Contour.m_fMinY = std::min(Contour.m_fMinY, vA.m_values.y);
+				Contour.m_fMaxY = std::max(Contour.m_fMaxY, vA.m_values.y);
+			}
+
+			if (Contour.m_dArea == 0.0)
+				Report.m_nDegeneratePolygons++;
+			else
+				Contours.push_back(Contour);
+		}
+
+		if ((m_nChecks & NMR_MODELSLICEVALIDATOR_CHECKCLOSURE) == 0) {
+			Report.m_nOpenPolygons = 0;
+			Report.m_nDegeneratePolygons = 0;
+		}
+		if (m_nChecks & NMR_MODELSLICEVALIDATOR_CHECKINTERSECTIONS)
+			Report.m_nSelfIntersections = countIntersections(pSlice, Contours);
+		if (m_nChecks & NMR_MODELSLICEVALIDATOR_CHECKORIENTATION)
+			checkNesting(pSlice, Contours, Report);
+
+		return (Report.m_nOpenPolygons == 0) && (Report.m_nDegeneratePolygons == 0) &&
+			(Report.m_nSelfIntersections == 0) && (Report.m_nOrientationErrors == 0);
+	}
+
+	nfBool CModelSliceValidator::validateStack(_In_ CModelSliceStack * pSliceStack, _Out_ std::vector<MODELSLICELAYERREPORT> & Reports)
+	{
+		if (pSliceStack == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint64 nTotalSliceCount = pSliceStack->getTotalSliceCount();
+		if (nTotalSliceCount > LIB3MF_MAXSLICEREFERENCES)
+			throw CNMRException(NMR_ERROR_TOOMANYSLICES);
+		nfUint32 nLayerCount = (nfUint32)nTotalSliceCount;
+
+		std::vector<PSlice> Slices;
+		Slices.reserve(nLayerCount);
+		for (nfUint32 nLayer = 0; nLayer < nLayerCount; nLayer++)
+			Slices.push_back(pSliceStack->getTotalSlice(nLayer));
+
+		std::vector<MODELSLICELAYERREPORT> LayerReports(nLayerCount);
+		std::vector<nfByte> LayerIsValid(nLayerCount, 1);
+		fnParallelFor(nLayerCount, m_nThreadCount, NMR_MODELSLICEVALIDATOR_MINLAYERSPERTHREAD, [&](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nLayer = nBegin; nLayer < nEnd; nLayer++) {
+				LayerIsValid[nLayer] = validateSlice(Slices[nLayer].get(), LayerReports[nLayer]);
+				LayerReports[nLayer].m_nLayerIndex = nLayer;
+			}
+		});
+
+		Reports.clear();
+		for (nfUint32 nLayer = 0; nLayer < nLayerCount; nLayer++) {
+			if (!LayerIsValid[nLayer])
+				Reports.push_back(LayerReports[nLayer]);
+		}
+
+		return Reports.empty();
+	}
+
+}
@@ -26,36 +26,35 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 Abstract:
 
+NMR_ModelSourcePackage.cpp implements the reference to the package file a model was read from.
+
 --*/
 
-#include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_Segment.h"
-#include "Common/NMR_StringUtils.h"
-#include "Model/Classes/NMR_ModelConstants.h"
+#include "Model/Classes/NMR_ModelSourcePackage.h"
+#include "Common/NMR_Exception.h"
 
 namespace NMR {
-	void CModelReaderNode_Slices1507_Segment::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue) {
-		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_SLICESEGMENT_V2) == 0) {
-			m_pSlice->addPolygonIndex(m_PolygonIndex, fnStringToInt32(pAttributeValue));
-		}
-	}
-
-	void CModelReaderNode_Slices1507_Segment::OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader) {
 
+	CModelSourcePackage::CModelSourcePackage(_In_ const std::string & sFileName)
+		: m_sFileName(sFileName), m_nResourceRevision(0)
+	{
+		if (sFileName.empty())
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 	}
 
-	CModelReaderNode_Slices1507_Segment::CModelReaderNode_Slices1507_Segment(_In_ CSlice *pSlice, nfUint32 nPolygonIndex, _In_ PModelWarnings pWarnings) : CModelReaderNode(pWarnings) {
-		m_pSlice = pSlice;
-		m_PolygonIndex = nPolygonIndex;
+	std::string CModelSourcePackage::getFileName()
+	{
+		return m_sFileName;
 	}
 
-	void CModelReaderNode_Slices1507_Segment::parseXML(_In_ CXmlReader * pXMLReader) {
-		// Parse name
-		parseName(pXMLReader);
-
-		// Parse attribute
-		parseAttributes(pXMLReader);
+	nfUint64 CModelSourcePackage::getResourceRevision()
+	{
+		return m_nResourceRevision;
+	}
 
-		// Parse Content
-		parseContent(pXMLReader);
+	void CModelSourcePackage::setResourceRevision(_In_ nfUint64 nResourceRevision)
+	{
+		m_nResourceRevision = nResourceRevision;
 	}
+
 }
@@ -42,7 +42,6 @@ namespace NMR {
 		_In_ CModel * pModel, _In_ PModelTexture2DResource pTexture2D)
 		: CModelResource(sID, pModel)
 	{
-		m_nNextPropertyID = 1;
 		if (!pTexture2D.get())
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		m_pTexture2D = pTexture2D;
@@ -50,14 +49,11 @@ namespace NMR {
 
 	nfUint32 CModelTexture2DGroupResource::addUVCoordinate(_In_ MODELTEXTURE2DCOORDINATE UV)
 	{
-		nfUint32 nID = m_nNextPropertyID;
 		if (getCount() >= XML_3MF_MAXRESOURCEINDEX) {
 			throw CNMRException(NMR_ERROR_TOOMANYCOLORS);
 		}
 
-		m_pUVCoordinates.insert(std::make_pair(nID, UV));
-
-		m_nNextPropertyID++;
+		nfUint32 nID = m_UVCoordinates.add(UV);
 
 		clearResourceIndexMap();
 
@@ -66,35 +62,41 @@ namespace NMR {
 
 	nfUint32 CModelTexture2DGroupResource::getCount()
 	{
-		return (nfUint32)m_pUVCoordinates.size();
+		return m_UVCoordinates.getCount();
 	}
 
 	void CModelTexture2DGroupResource::setUVCoordinate(_In_ ModelPropertyID nPropertyID, _In_ MODELTEXTURE2DCOORDINATE sCoordinate)
 	{
-		auto iIterator = m_pUVCoordinates.find(nPropertyID);
-		if (iIterator != m_pUVCoordinates.end()) {
-			iIterator->second = sCoordinate;
-		}
-		else {
+		MODELTEXTURE2DCOORDINATE * pCoordinate = m_UVCoordinates.find(nPropertyID);
+		if (pCoordinate == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
-		}
+
+		*pCoordinate = sCoordinate;
 	}
 
 	void CModelTexture2DGroupResource::removePropertyID(_In_ ModelPropertyID nPropertyID)
 	{
-		m_pUVCoordinates.erase(nPropertyID);
+		m_UVCoordinates.remove(nPropertyID);
 		clearResourceIndexMap();
 	}
 
 	MODELTEXTURE2DCOORDINATE CModelTexture2DGroupResource::getUVCoordinate(_In_ ModelPropertyID nPropertyID)
 	{
-		auto iIterator = m_pUVCoordinates.find(nPropertyID);
-		if (iIterator != m_pUVCoordinates.end()) {
-			return iIterator->second;
-		}
-		else {
+		MODELTEXTURE2DCOORDINATE * pCoordinate = m_UVCoordinates.find(nPropertyID);
+		if (pCoordinate == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
-		}
+
+		return *pCoordinate;
+	}
+
+	void CModelTexture2DGroupResource::getAllUVCoordinates(_Out_ MODELTEXTURE2DCOORDINATE * pCoordinates)
+	{
+		m_UVCoordinates.getAll(pCoordinates);
+	}
+
+	void CModelTexture2DGroupResource::setAllUVCoordinates(_In_ const MODELTEXTURE2DCOORDINATE * pCoordinates, _In_ nfUint32 nCount)
+	{
+		m_UVCoordinates.setAll(pCoordinates, nCount);
 	}
 
 	void CModelTexture2DGroupResource::mergeFrom(_In_ CModelTexture2DGroupResource * pSourceTexture2DGroup)
@@ -103,12 +105,11 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 		
 		nfUint32 nCount = pSourceTexture2DGroup->getCount();
-		pSourceTexture2DGroup->buildResourceIndexMap();
+		std::vector<MODELTEXTURE2DCOORDINATE> UVCoordinates(nCount);
+		pSourceTexture2DGroup->getAllUVCoordinates(UVCoordinates.data());
 
-		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
-			ModelPropertyID nPropertyID;
-			pSourceTexture2DGroup->mapResourceIndexToPropertyID(nIndex, nPropertyID);
-			MODELTEXTURE2DCOORDINATE UVCoordinate = pSourceTexture2DGroup->getUVCoordinate(nPropertyID);
+		m_UVCoordinates.reserve(getCount() + nCount);
+		for (const MODELTEXTURE2DCOORDINATE & UVCoordinate : UVCoordinates) {
 			addUVCoordinate(UVCoordinate);
 		}
 		clearResourceIndexMap();
@@ -116,15 +117,7 @@ namespace NMR {
 
 	void CModelTexture2DGroupResource::buildResourceIndexMap()
 	{
-		m_ResourceIndexMap.clear();
-		m_ResourceIndexMap.reserve(m_pUVCoordinates.size());
-
-		auto iIterator = m_pUVCoordinates.begin();
-		while (iIterator != m_pUVCoordinates.end()) {
-			m_ResourceIndexMap.push_back(iIterator->first);
-			iIterator++;
-		}
-
+		m_UVCoordinates.getPropertyIDs(m_ResourceIndexMap);
 		m_bHasResourceIndexMap = true;
 	}
 
@@ -97,8 +97,7 @@ namespace NMR {
 				}
 
 				// Create ball
-				MESHNODE * pNode = m_pMesh->getNode(nIndex);
-				m_pMesh->addBall(pNode, dRadius);
+				m_pMesh->addBall(nIndex, dRadius);
 			}
 			else {
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
@@ -53,19 +53,69 @@ namespace NMR {
 		return eModelBeamLatticeCapMode::MODELBEAMLATTICECAPMODE_SPHERE;
 	}
 
-	CModelReaderNode_BeamLattice1702_Beam::CModelReaderNode_BeamLattice1702_Beam(_In_ CModel * pModel, _In_ PModelWarnings pWarnings)
-		: CModelReaderNode(pWarnings)
+	void resetBeamAttributes(_Out_ BEAMLATTICE1702_BEAMATTRIBUTES & attributes)
 	{
-		m_nIndex1 = -1;
-		m_nIndex2 = -1;
+		attributes.m_nIndex1 = -1;
+		attributes.m_nIndex2 = -1;
+
+		attributes.m_bHasRadius1 = false;
+		attributes.m_bHasRadius2 = false;
+		attributes.m_dRadius1 = 0;
+		attributes.m_dRadius2 = 0;
+
+		attributes.m_bHasCap1 = false;
+		attributes.m_bHasCap2 = false;
+		attributes.m_eCapMode1 = eModelBeamLatticeCapMode::MODELBEAMLATTICECAPMODE_SPHERE;
+		attributes.m_eCapMode2 = eModelBeamLatticeCapMode::MODELBEAMLATTICECAPMODE_SPHERE;
+	}
 
-		m_bHasRadius1 = false;
-		m_bHasRadius2 = false;
-		m_dRadius1 = 0;
-		m_dRadius2 = 0;
+	nfBool parseBeamAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _Inout_ BEAMLATTICE1702_BEAMATTRIBUTES & attributes)
+	{
+		__NMRASSERT(pAttributeName);
+		__NMRASSERT(pAttributeValue);
 
-		m_bHasCap1 = false;
-		m_bHasCap2 = false;
+		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_V1) == 0) {
+			nfInt32 nValue = fnStringToInt32(pAttributeValue);
+			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
+				attributes.m_nIndex1 = nValue;
+		}
+		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_V2) == 0) {
+			nfInt32 nValue = fnStringToInt32(pAttributeValue);
+			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
+				attributes.m_nIndex2 = nValue;
+		}
+		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_R1) == 0) {
+			nfFloat fValue = fnStringToFloat(pAttributeValue);
+			if ((fValue >= 0) && (fValue < XML_3MF_MAXIMUMBEAMRADIUSVALUE)) {
+				attributes.m_dRadius1 = fValue;
+				attributes.m_bHasRadius1 = true;
+			}
+		}
+		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_R2) == 0) {
+			nfFloat fValue = fnStringToFloat(pAttributeValue);
+			if ((fValue >= 0) && (fValue < XML_3MF_MAXIMUMBEAMRADIUSVALUE)) {
+				attributes.m_dRadius2 = fValue;
+				attributes.m_bHasRadius2 = true;
+			}
+		}
+		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_CAP1) == 0) {
+			attributes.m_bHasCap1 = true;
+			attributes.m_eCapMode1 = stringToCapMode(pAttributeValue);
+		}
+		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_CAP2) == 0) {
+			attributes.m_bHasCap2 = true;
+			attributes.m_eCapMode2 = stringToCapMode(pAttributeValue);
+		}
+		else
+			return false;
+
+		return true;
+	}
+
+	CModelReaderNode_BeamLattice1702_Beam::CModelReaderNode_BeamLattice1702_Beam(_In_ CModel * pModel, _In_ PModelWarnings pWarnings)
+		: CModelReaderNode(pWarnings)
+	{
+		resetBeamAttributes(m_Attributes);
 
 		m_bHasTag = false;
 		m_nTag = -1;
@@ -86,36 +136,41 @@ namespace NMR {
 
 	void CModelReaderNode_BeamLattice1702_Beam::retrieveIndices(_Out_ nfInt32 & nIndex1, _Out_ nfInt32 & nIndex2, nfInt32 nNodeCount)
 	{
-		if ((m_nIndex1 < 0) || (m_nIndex2 < 0))
+		if ((m_Attributes.m_nIndex1 < 0) || (m_Attributes.m_nIndex2 < 0))
 			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
 
-		if ((m_nIndex1 >= nNodeCount) || (m_nIndex2 >= nNodeCount))
+		if ((m_Attributes.m_nIndex1 >= nNodeCount) || (m_Attributes.m_nIndex2 >= nNodeCount))
 			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
 
-		if ( m_nIndex1 == m_nIndex2 )
+		if (m_Attributes.m_nIndex1 == m_Attributes.m_nIndex2)
 			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
 		
-		nIndex1 = m_nIndex1;
-		nIndex2 = m_nIndex2;
+		nIndex1 = m_Attributes.m_nIndex1;
+		nIndex2 = m_Attributes.m_nIndex2;
+	}
+
+	const BEAMLATTICE1702_BEAMATTRIBUTES & CModelReaderNode_BeamLattice1702_Beam::getAttributes() const
+	{
+		return m_Attributes;
 	}
 
 	void CModelReaderNode_BeamLattice1702_Beam::retrieveRadii(_Out_ nfBool & bHasRadius1, _Out_ nfDouble & dRadius1, _Out_ nfBool & bHasRadius2, _Out_ nfDouble & dRadius2) {
-		bHasRadius1 = m_bHasRadius1;
+		bHasRadius1 = m_Attributes.m_bHasRadius1;
 		if (bHasRadius1)
-			dRadius1 = m_dRadius1;
-		bHasRadius2 = m_bHasRadius2;
+			dRadius1 = m_Attributes.m_dRadius1;
+		bHasRadius2 = m_Attributes.m_bHasRadius2;
 		if (bHasRadius2)
-			dRadius2 = m_dRadius2;
+			dRadius2 = m_Attributes.m_dRadius2;
 	}
 
 	void CModelReaderNode_BeamLattice1702_Beam::retrieveCapModes(_Out_ nfBool & bHasCapMode1, _Out_ eModelBeamLatticeCapMode & eCapMode1, _Out_ nfBool & bHasCapMode2, _Out_ eModelBeamLatticeCapMode & eCapMode2)
 	{
-		bHasCapMode1 = m_bHasCap1;
+		bHasCapMode1 = m_Attributes.m_bHasCap1;
 		if (bHasCapMode1)
-			eCapMode1 = m_eCapMode1;
-		bHasCapMode2 = m_bHasCap2;
+			eCapMode1 = m_Attributes.m_eCapMode1;
+		bHasCapMode2 = m_Attributes.m_bHasCap2;
 		if (bHasCapMode2)
-			eCapMode2 = m_eCapMode2;
+			eCapMode2 = m_Attributes.m_eCapMode2;
 	}
 
 	
@@ -130,39 +185,7 @@ namespace NMR {
 		__NMRASSERT(pAttributeName);
 		__NMRASSERT(pAttributeValue);
 
-		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_V1) == 0) {
-			nfInt32 nValue = fnStringToInt32(pAttributeValue);
-			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
-				m_nIndex1 = nValue;
-		}
-		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_V2) == 0) {
-			nfInt32 nValue = fnStringToInt32(pAttributeValue);
-			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
-				m_nIndex2 = nValue;
-		}
-		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_R1) == 0) {
-			nfFloat fValue = fnStringToFloat(pAttributeValue);
-			if ((fValue >= 0) && (fValue < XML_3MF_MAXIMUMBEAMRADIUSVALUE)) {
-				m_dRadius1 = fValue;
-				m_bHasRadius1 = true;
-			}
-		}
-		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_R2) == 0) {
-			nfFloat fValue = fnStringToFloat(pAttributeValue);
-			if ((fValue >= 0) && (fValue < XML_3MF_MAXIMUMBEAMRADIUSVALUE)) {
-				m_dRadius2 = fValue;
-				m_bHasRadius2 = true;
-			}
-		}
-		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_CAP1) == 0) {
-			m_bHasCap1 = true;
-			m_eCapMode1 = stringToCapMode(pAttributeValue);
-		}
-		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_BEAMLATTICE_CAP2) == 0) {
-			m_bHasCap2 = true;
-			m_eCapMode2 = stringToCapMode(pAttributeValue);
-		}
-		else
+		if (!parseBeamAttribute(pAttributeName, pAttributeValue, m_Attributes))
 			m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICEINVALIDATTRIBUTE), mrwInvalidOptionalValue);
 	}
 
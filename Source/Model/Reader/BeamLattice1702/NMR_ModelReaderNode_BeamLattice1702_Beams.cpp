@@ -53,10 +53,13 @@ namespace NMR {
 		m_pMesh = pMesh;
 		m_dDefaultRadius = defaultRadius;
 		m_eDefaultCapMode = defaultCapMode;
+		m_nFirstBeam = 0;
 	}
 
 	void CModelReaderNode_BeamLattice1702_Beams::parseXML(_In_ CXmlReader * pXMLReader)
 	{
+		m_nFirstBeam = m_pMesh->getBeamCount();
+
 		// Parse Name
 		parseName(pXMLReader);
 
@@ -65,6 +68,14 @@ namespace NMR {
 
 		// Parse Content
 		parseContent(pXMLReader);
+
+		// Check beam lengths in one pass over all beams read by this node
+		nfUint32 nTooShort = m_pMesh->countBeamsBelowMinLength(m_nFirstBeam);
+		for (nfUint32 nIndex = 0; nIndex < nTooShort; nIndex++) {
+			m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICENODESTOOCLOSE), mrwInvalidMandatoryValue);
+			if (m_pWarnings->getWarningCount() >= NMR_MAXWARNINGCOUNT)
+				break;
+		}
 	}
 
 	void CModelReaderNode_BeamLattice1702_Beams::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
@@ -73,6 +84,70 @@ namespace NMR {
 		__NMRASSERT(pAttributeValue);
 	}
 
+	void CModelReaderNode_BeamLattice1702_Beams::readBeam(_In_ CXmlReader * pXMLReader)
+	{
+		__NMRASSERT(pXMLReader);
+
+		BEAMLATTICE1702_BEAMATTRIBUTES attributes;
+		resetBeamAttributes(attributes);
+
+		if (pXMLReader->MoveToFirstAttribute()) {
+			nfBool bContinue = true;
+			while (bContinue) {
+				if (!pXMLReader->IsDefault()) {
+					LPCSTR pszLocalName = nullptr;
+					LPCSTR pszNameSpaceURI = nullptr;
+					LPCSTR pszValue = nullptr;
+					UINT nNameCount = 0;
+					UINT nValueCount = 0;
+					UINT nNameSpaceCount = 0;
+
+					pXMLReader->GetNamespaceURI(&pszNameSpaceURI, &nNameSpaceCount);
+					if (!pszNameSpaceURI)
+						throw CNMRException(NMR_ERROR_COULDNOTGETNAMESPACE);
+
+					pXMLReader->GetLocalName(&pszLocalName, &nNameCount);
+					if (!pszLocalName)
+						throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+					pXMLReader->GetValue(&pszValue, &nValueCount);
+					if (!pszValue)
+						throw CNMRException(NMR_ERROR_COULDNOTGETXMLVALUE);
+
+					// Namespaced attributes are ignored, as in CModelReaderNode_BeamLattice1702_Beam
+					if ((nNameCount > 0) && (nNameSpaceCount == 0)) {
+						if (!parseBeamAttribute(pszLocalName, pszValue, attributes))
+							m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICEINVALIDATTRIBUTE), mrwInvalidOptionalValue);
+					}
+				}
+
+				bContinue = pXMLReader->MoveToNextAttribute();
+			}
+		}
+
+		pXMLReader->CloseElement();
+
+		addBeam(attributes);
+	}
+
+	void CModelReaderNode_BeamLattice1702_Beams::addBeam(_In_ const BEAMLATTICE1702_BEAMATTRIBUTES & attributes)
+	{
+		nfInt32 nNodeCount = m_pMesh->getNodeCount();
+		if ((attributes.m_nIndex1 < 0) || (attributes.m_nIndex2 < 0))
+			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
+		if ((attributes.m_nIndex1 >= nNodeCount) || (attributes.m_nIndex2 >= nNodeCount))
+			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
+		if (attributes.m_nIndex1 == attributes.m_nIndex2)
+			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
+
+		nfDouble dRadius1 = attributes.m_bHasRadius1 ? attributes.m_dRadius1 : m_dDefaultRadius;
+		nfDouble dRadius2 = attributes.m_bHasRadius2 ? attributes.m_dRadius2 : dRadius1;
+		nfInt32 nCap1 = attributes.m_bHasCap1 ? attributes.m_eCapMode1 : m_eDefaultCapMode;
+		nfInt32 nCap2 = attributes.m_bHasCap2 ? attributes.m_eCapMode2 : m_eDefaultCapMode;
+
+		m_pMesh->addBeam(attributes.m_nIndex1, attributes.m_nIndex2, dRadius1, dRadius2, nCap1, nCap2);
+	}
+
 	void CModelReaderNode_BeamLattice1702_Beams::OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader)
 	{
 		__NMRASSERT(pChildName);
@@ -81,49 +156,14 @@ namespace NMR {
 
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_BEAMLATTICESPEC) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_BEAM) == 0) {
-				// Parse XML
-				PModelReaderNode_BeamLattice1702_Beam pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_Beam>(m_pModel, m_pWarnings);
-				pXMLNode->parseXML(pXMLReader);
-
-				// Retrieve node indices
-				nfInt32 nIndex1, nIndex2;
-				pXMLNode->retrieveIndices(nIndex1, nIndex2, m_pMesh->getNodeCount());
-
-				MESHNODE* pNode1 = m_pMesh->getNode(nIndex1);
-				MESHNODE* pNode2 = m_pMesh->getNode(nIndex2);
-				
-				if (fnVEC3_length(fnVEC3_sub(pNode1->m_position, pNode2->m_position)) < m_pMesh->getBeamLatticeMinLength())
-					m_pWarnings->addException(CNMRException(NMR_ERROR_BEAMLATTICENODESTOOCLOSE), mrwInvalidMandatoryValue);
-
-				nfInt32 nTag;
-				nfBool bHasTag, bHasRadius1, bHasRadius2;
-				nfDouble dRadius1, dRadius2;
-				pXMLNode->retrieveTag(bHasTag, nTag);
-				pXMLNode->retrieveRadii(bHasRadius1, dRadius1, bHasRadius2, dRadius2);
-				nfDouble dDefaultValueForR2 = m_dDefaultRadius;
-				if (bHasRadius1) {
-					dDefaultValueForR2 = dRadius1;
+				if (pXMLReader->IsEmptyElement()) {
+					readBeam(pXMLReader);
 				}
 				else {
-					dRadius1 = m_dDefaultRadius;
-				}
-
-				if (!bHasRadius2) {
-					dRadius2 = dDefaultValueForR2;
-				}
-
-				nfBool bHasCapMode1, bHasCapMode2;
-				eModelBeamLatticeCapMode eCap1, eCap2;
-				nfInt32 nCap1, nCap2;
-				pXMLNode->retrieveCapModes(bHasCapMode1, eCap1, bHasCapMode2, eCap2);
-				nCap1 = bHasCapMode1 ? eCap1 : m_eDefaultCapMode;
-				nCap2 = bHasCapMode2 ? eCap2 : m_eDefaultCapMode;
-
-				// Create beam if valid
-				if (nIndex1 != nIndex2) {
-					MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
-					MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
-					m_pMesh->addBeam(pNode1, pNode2, dRadius1, dRadius2, nCap1, nCap2);
+					// Elements with content need the generic node to skip their children
+					PModelReaderNode_BeamLattice1702_Beam pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_Beam>(m_pModel, m_pWarnings);
+					pXMLNode->parseXML(pXMLReader);
+					addBeam(pXMLNode->getAttributes());
 				}
 			}
 			else
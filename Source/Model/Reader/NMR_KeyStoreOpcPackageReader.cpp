@@ -36,10 +36,12 @@ NMR_KeyStoreOpcPackageReader.cpp defines an OPC Package reader in a portable way
 #include "Common/NMR_Local.h"
 #include "Common/NMR_SecureContentTypes.h"
 #include "Common/NMR_SecureContext.h"
+#include "Common/NMR_Parallel.h"
 #include "Common/Platform/NMR_Platform.h"
 #include "Common/Platform/NMR_ImportStream.h"
 #include "Common/Platform/NMR_ImportStream_Compressed.h"
 #include "Common/Platform/NMR_ImportStream_Encrypted.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
 #include "Common/OPC/NMR_OpcPackageReader.h"
 #include "Common/OPC/NMR_OpcPackagePart.h"
 #include "Model/Classes/NMR_ModelContext.h"
@@ -51,6 +53,7 @@ NMR_KeyStoreOpcPackageReader.cpp defines an OPC Package reader in a portable way
 #include "Model/Reader/NMR_ModelReader_InstructionElement.h"
 #include "Model/Reader/SecureContent101/NMR_ModelReaderNode_KeyStore.h"
 #include <cstring>
+#include <atomic>
 
 namespace NMR {
 	CKeyStoreOpcPackageReader::CKeyStoreOpcPackageReader(PImportStream pImportStream, CModelContext const & context)
@@ -66,6 +69,7 @@ namespace NMR {
 
 			if (!context.keyStore()->empty()) {
 				openAllResourceDataGroups();
+				decryptAllResourceData();
 			}
 		}
 	}
@@ -85,6 +89,10 @@ namespace NMR {
 				if (pIt != m_encryptedParts.end()) {
 					return pIt->second;
 				}
+				auto pFailedIt = m_failedParts.find(pPart->getURI());
+				if (pFailedIt != m_failedParts.end()) {
+					std::rethrow_exception(pFailedIt->second);
+				}
 				NMR::PKeyStoreResourceData rd = keyStore->findResourceData(sPath);
 				PKeyStoreContentEncryptionParams params = CKeyStoreFactory::makeContentEncryptionParams(rd, rdg);
 
@@ -112,6 +120,19 @@ namespace NMR {
 		return m_pPackageReader->getPartSize(sPath);
 	}
 
+	nfBool CKeyStoreOpcPackageReader::getRawPartInfo(std::string sPath, ZIPRAWENTRYINFO & RawEntryInfo) {
+		// The compressed data of encrypted parts is tied to the key store of this package
+		if (nullptr != m_pContext.keyStore()->findResourceData(sPath))
+			return false;
+		return m_pPackageReader->getRawPartInfo(sPath, RawEntryInfo);
+	}
+
+	PImportStream CKeyStoreOpcPackageReader::openRawPart(std::string sPath) {
+		if (nullptr != m_pContext.keyStore()->findResourceData(sPath))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		return m_pPackageReader->openRawPart(sPath);
+	}
+
 	void CKeyStoreOpcPackageReader::close() {
 		checkAuthenticatedTags();
 	}
@@ -186,6 +207,122 @@ namespace NMR {
 			}
 		}
 	}
+	void CKeyStoreOpcPackageReader::decryptAllResourceData() {
+		auto keyStore = m_pContext.keyStore();
+		auto secureContext = m_pContext.secureContext();
+		if (!secureContext->hasDekCtx())
+			return;
+
+		// The content encryption callback is user code, so all parts are decrypted on the calling
+		// thread. Only inflating the decrypted data, which does not call back, runs on workers.
+		ContentEncryptionDescriptor descriptor = secureContext->getDekCtx();
+		PProgressMonitor pProgressMonitor = m_pContext.monitor();
+
+		std::vector<POpcPackagePart> parts;
+		std::vector<PImportStream> deflatedStreams;
+		nfUint64 nPrefetchedBytes = 0;
+		for (nfUint64 i = 0; i < keyStore->getResourceDataCount(); ++i) {
+			NMR::PKeyStoreResourceData rd = keyStore->getResourceData(i);
+			NMR::PKeyStoreResourceDataGroup rdg = keyStore->findResourceDataGroupByResourceDataPath(rd->packagePath());
+			if ((nullptr == rdg) || !rdg->isOpen())
+				continue;
+
+			// Uncompressed parts gain nothing from workers and are decrypted while they are parsed
+			PKeyStoreContentEncryptionParams params = CKeyStoreFactory::makeContentEncryptionParams(rd, rdg);
+			if (!params->isCompressed())
+				continue;
+
+			// Parts that cannot be opened are left to createPart, which reports the error on access
+			std::string sPath = rd->packagePath()->getPath();
+			POpcPackagePart pPart;
+			try {
+				pPart = m_pPackageReader->createPart(sPath);
+			}
+			catch (CNMRException &) {
+				continue;
+			}
+			if ((m_encryptedParts.find(pPart->getURI()) != m_encryptedParts.end()) || (m_failedParts.find(pPart->getURI()) != m_failedParts.end()))
+				continue;
+
+			// Parts beyond the prefetch limit are decrypted and inflated while they are parsed. The
+			// decrypted data is held in compressed form until it is inflated, which is bounded below.
+			nfUint64 nPartSize = m_pPackageReader->getPartSize(sPath);
+			if (nPrefetchedBytes + nPartSize > KEYSTOREOPCPACKAGEREADER_PREFETCHLIMIT)
+				continue;
+
+			pProgressMonitor->QueryCancelled(true);
+
+			ContentEncryptionDescriptor partDescriptor = descriptor;
+			partDescriptor.m_sDekDecryptData.m_sParams = params;
+			try {
+				PImportStream decryptStream = std::make_shared<CImportStream_Encrypted>(pPart->getImportStream(), partDescriptor);
+				deflatedStreams.push_back(decryptStream->copyToMemory());
+			}
+			catch (...) {
+				// The callback has already seen a part of the cipher text, so decrypting the part again
+				// would continue from an inconsistent state. The error is reported when the part is accessed.
+				m_failedParts[pPart->getURI()] = std::current_exception();
+				continue;
+			}
+			parts.push_back(pPart);
+			nPrefetchedBytes += nPartSize;
+		}
+
+		// Inflate the decrypted parts concurrently. Deflated XML easily expands by a factor of 10 to 50,
+		// so the inflated data is charged against the prefetch limit as well. A part that does not fit
+		// anymore is kept decrypted and inflated while it is parsed.
+		nfUint32 nPartCount = (nfUint32)parts.size();
+		std::vector<PImportStream> plainStreams(nPartCount);
+		std::vector<std::exception_ptr> exceptions(nPartCount);
+		std::atomic<nfUint64> nInflatedBytes(0);
+		fnParallelFor(nPartCount, 0, 1, [&](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nIndex = nBegin; nIndex < nEnd; nIndex++) {
+				try {
+					CImportStream_Compressed decompressStream(deflatedStreams[nIndex], KEYSTOREOPCPACKAGEREADER_INFLATECHUNKSIZE);
+					std::vector<nfByte> buffer;
+					nfUint64 nBufferSize = 0;
+					nfBool bFits = true;
+					while (true) {
+						buffer.resize((size_t)(nBufferSize + KEYSTOREOPCPACKAGEREADER_INFLATECHUNKSIZE));
+						nfUint64 nBytesRead = decompressStream.readIntoBuffer(buffer.data() + nBufferSize, KEYSTOREOPCPACKAGEREADER_INFLATECHUNKSIZE, false);
+						nBufferSize += nBytesRead;
+						if (nInflatedBytes.fetch_add(nBytesRead) + nBytesRead > KEYSTOREOPCPACKAGEREADER_PREFETCHLIMIT) {
+							bFits = false;
+							break;
+						}
+						if (nBytesRead < KEYSTOREOPCPACKAGEREADER_INFLATECHUNKSIZE)
+							break;
+					}
+
+					if (bFits) {
+						buffer.resize((size_t)nBufferSize);
+						plainStreams[nIndex] = std::make_shared<CImportStream_Unique_Memory>(std::move(buffer));
+					}
+					else {
+						// Give back the budget of this part, so that smaller parts can still use it
+						nInflatedBytes.fetch_sub(nBufferSize);
+						buffer.clear();
+						buffer.shrink_to_fit();
+						deflatedStreams[nIndex]->seekPosition(0, true);
+						plainStreams[nIndex] = std::make_shared<CImportStream_Compressed>(deflatedStreams[nIndex], KEYSTOREOPCPACKAGEREADER_INFLATECHUNKSIZE);
+					}
+				}
+				catch (...) {
+					exceptions[nIndex] = std::current_exception();
+				}
+				deflatedStreams[nIndex] = nullptr;
+			}
+		});
+
+		for (nfUint32 nIndex = 0; nIndex < nPartCount; nIndex++) {
+			if (exceptions[nIndex]) {
+				m_failedParts[parts[nIndex]->getURI()] = exceptions[nIndex];
+				continue;
+			}
+			m_encryptedParts[parts[nIndex]->getURI()] = std::make_shared<COpcPackagePart>(*parts[nIndex], plainStreams[nIndex]);
+		}
+	}
+
 	void CKeyStoreOpcPackageReader::checkAuthenticatedTags() {
 		auto secureContext = m_pContext.secureContext();
 		auto keyStore = m_pContext.keyStore();
@@ -82,4 +82,9 @@ namespace NMR {
 		m_RelationsToRead.erase(sRelationShipType);
 	}
 
+	void CModelReader::setSourceFileName(_In_ const std::string & sFileName)
+	{
+		m_sSourceFileName = sFileName;
+	}
+
 }
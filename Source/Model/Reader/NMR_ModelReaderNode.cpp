@@ -213,6 +213,34 @@ namespace NMR {
 		}
 	}
 
+	void CModelReaderNode::skipLeafContent(_In_ CXmlReader * pXMLReader, _In_ const std::string & sName, _In_ nfBool bIsEmptyElement)
+	{
+		__NMRASSERT(pXMLReader);
+
+		if (bIsEmptyElement) {
+			pXMLReader->CloseElement();
+			return;
+		}
+
+		// Same traversal as parseContent, with all child elements and texts being ignored
+		while (!pXMLReader->IsEOF()) {
+			eXmlReaderNodeType NodeType;
+			pXMLReader->Read(NodeType);
+
+			if (NodeType == XMLREADERNODETYPE_ENDELEMENT) {
+				LPCSTR pszLocalName = nullptr;
+				pXMLReader->GetLocalName(&pszLocalName, nullptr);
+				if (!pszLocalName)
+					throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+				if (strcmp(pszLocalName, sName.c_str()) == 0) {
+					pXMLReader->CloseElement();
+					return;
+				}
+			}
+		}
+	}
+
 	void CModelReaderNode::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
 	{
 		// empty on purpose, to be implemented by child classes
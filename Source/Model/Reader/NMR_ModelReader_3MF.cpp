@@ -43,11 +43,18 @@ NMR_ModelReader_3MF.cpp implements the Model Reader Class for
 #include "Common/MeshImport/NMR_MeshImporter_STL.h"
 #include "Common/Platform/NMR_Platform.h"
 #include "Model/Classes/NMR_ModelAttachment.h" 
+#include "Model/Classes/NMR_ModelSliceStack.h"
+#include "Model/Classes/NMR_ModelConstants_Slices.h"
 
 #include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_SliceRefModel.h"
 #include "Model/Reader/NMR_ModelReader_InstructionElement.h"
 
 #include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_Statistics.h"
+#include "Common/NMR_Parallel.h"
+
+#include <map>
+#include <exception>
 
 namespace NMR {
 
@@ -57,8 +64,211 @@ namespace NMR {
 		// empty on purpose
 	}
 
+	// A non-root model part that holds nothing but slice stacks, read into a scratch model
+	typedef struct {
+		PModel m_pScratchModel;
+		PModelReader_Slice1507_SliceRefModel m_pModelNode;
+		PModelWarnings m_pWarnings;
+		// Error of reading the part, it is raised when the part is reached in the sequential pass
+		std::exception_ptr m_pException;
+	} SLICEMODELPART;
+
+	// Returns true if the first resource of a model part is a slice stack. Only the beginning of the part is read.
+	static nfBool fnStartsWithSliceStack(_In_ PImportStream pStream)
+	{
+		PXmlReader pXMLReader = fnCreateXMLReaderInstance(pStream, std::make_shared<CProgressMonitor>());
+		eXmlReaderNodeType NodeType;
+		while (!pXMLReader->IsEOF()) {
+			if (!pXMLReader->Read(NodeType))
+				break;
+			if (NodeType != eXmlReaderNodeType::XMLREADERNODETYPE_STARTELEMENT)
+				continue;
+
+			LPCSTR pszLocalName = nullptr;
+			LPCSTR pszNameSpaceURI = nullptr;
+			pXMLReader->GetLocalName(&pszLocalName, nullptr);
+			pXMLReader->GetNamespaceURI(&pszNameSpaceURI, nullptr);
+			if (!pszLocalName || !pszNameSpaceURI)
+				return false;
+
+			// The XML declaration is reported as an element
+			if (strcmp(pszLocalName, XML_3MF_ATTRIBUTE_PREFIX_XML) == 0)
+				continue;
+			if (strcmp(pszNameSpaceURI, XML_3MF_NAMESPACE_SLICESPEC) == 0)
+				return (strcmp(pszLocalName, XML_3MF_ELEMENT_SLICESTACKRESOURCE) == 0);
+			if ((strcmp(pszLocalName, XML_3MF_ELEMENT_MODEL) != 0) && (strcmp(pszLocalName, XML_3MF_ELEMENT_METADATA) != 0) &&
+				(strcmp(pszLocalName, XML_3MF_ELEMENT_RESOURCES) != 0))
+				return false;
+
+			// Namespace declarations are registered while the attributes are read
+			if (pXMLReader->MoveToFirstAttribute()) {
+				while (pXMLReader->MoveToNextAttribute())
+					;
+			}
+		}
+		return false;
+	}
+
+	// Reads a slice stack part into a scratch model. Returns false if the part holds other content as well.
+	static nfBool fnReadSliceModelPart(_In_ PImportStream pStream, _In_ const std::string & sPath, _In_ PProgressMonitor pProgressMonitor, _In_ SLICEMODELPART & Part)
+	{
+		PModel pScratchModel = std::make_shared<CModel>();
+		pScratchModel->setCurrentPath(sPath);
+		PModelReader_Slice1507_SliceRefModel pModelNode;
+
+		try {
+			PXmlReader pXMLReader = fnCreateXMLReaderInstance(pStream, pProgressMonitor);
+			eXmlReaderNodeType NodeType;
+			while (!pXMLReader->IsEOF()) {
+				if (!pXMLReader->Read(NodeType))
+					break;
+
+				LPCSTR pszLocalName = nullptr;
+				pXMLReader->GetLocalName(&pszLocalName, nullptr);
+				if (!pszLocalName)
+					throw CNMRException(NMR_ERROR_COULDNOTGETLOCALXMLNAME);
+
+				if (strcmp(pszLocalName, XML_3MF_ATTRIBUTE_PREFIX_XML) == 0) {
+					PModelReader_InstructionElement pXMLNode = std::make_shared<CModelReader_InstructionElement>(Part.m_pWarnings);
+					pXMLNode->parseXML(pXMLReader.get());
+				}
+
+				if (strcmp(pszLocalName, XML_3MF_ELEMENT_MODEL) == 0) {
+					if (pModelNode)
+						throw CNMRException(NMR_ERROR_DUPLICATEMODELNODE);
+					pModelNode = std::make_shared<CModelReader_Slice1507_SliceRefModel>(pScratchModel.get(), Part.m_pWarnings, sPath);
+					pModelNode->parseXML(pXMLReader.get());
+
+					if (!pModelNode->getHasResources())
+						throw CNMRException(NMR_ERROR_NORESOURCES);
+					if (!pModelNode->getHasBuild())
+						throw CNMRException(NMR_ERROR_BUILDITEMNOTFOUND);
+				}
+			}
+		}
+		catch (CNMRException & Exception) {
+			// Content other than slice stacks is left to the regular reader
+			if (Exception.getErrorCode() == NMR_ERROR_NAMESPACE_INVALID_ELEMENT)
+				return false;
+			throw;
+		}
+
+		if (pModelNode) {
+			Part.m_pScratchModel = pScratchModel;
+			Part.m_pModelNode = pModelNode;
+		}
+		return true;
+	}
+
+	// Slice stack parts do not reference other parts, so they are parsed concurrently before the sequential pass.
+	// Parts are classified by their first resource on the calling thread, the workers only read slice stack parts.
+	static void readSliceModelParts(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _Out_ std::vector<SLICEMODELPART> & Parts)
+	{
+		nfUint32 nPartCount = pModel->getProductionAttachmentCount();
+		Parts.clear();
+		Parts.resize(nPartCount);
+
+		std::map<std::string, nfUint32> PathCounts;
+		for (nfUint32 nIndex = 0; nIndex < nPartCount; nIndex++)
+			PathCounts[pModel->getProductionModelAttachment(nIndex)->getPathURI()]++;
+
+		std::vector<nfUint32> SlicePartIndices;
+		for (nfUint32 nIndex = 0; nIndex < nPartCount; nIndex++) {
+			PModelAttachment pAttachment = pModel->getProductionModelAttachment(nIndex);
+			if (PathCounts.at(pAttachment->getPathURI()) != 1)
+				continue;
+
+			PImportStream pStream = pAttachment->getStream();
+			nfBool bIsSlicePart = fnStartsWithSliceStack(pStream);
+			pStream->seekPosition(0, true);
+			if (bIsSlicePart)
+				SlicePartIndices.push_back(nIndex);
+		}
+
+		fnParallelFor((nfUint32)SlicePartIndices.size(), 0, 1, [&](nfUint32 nBegin, nfUint32 nEnd) {
+			for (nfUint32 nSlicePart = nBegin; nSlicePart < nEnd; nSlicePart++) {
+				nfUint32 nIndex = SlicePartIndices[nSlicePart];
+				PModelAttachment pAttachment = pModel->getProductionModelAttachment(nIndex);
+				NMR_STATISTICS_PART(pAttachment->getPathURI());
+
+				// Workers do not query the callback, they only observe a cancellation
+				if (pProgressMonitor && pProgressMonitor->IsCancelled())
+					throw CNMRException(NMR_USERABORTED);
+
+				SLICEMODELPART & Part = Parts[nIndex];
+				Part.m_pWarnings = std::make_shared<CModelWarnings>();
+				Part.m_pWarnings->setCriticalWarningLevel(pWarnings->getCriticalWarningLevel());
+
+				PImportStream pStream = pAttachment->getStream();
+				try {
+					if (!fnReadSliceModelPart(pStream, pAttachment->getPathURI(), pProgressMonitor, Part))
+						Part.m_pWarnings = nullptr;
+				}
+				catch (CNMRException & Exception) {
+					if (Exception.getErrorCode() == NMR_USERABORTED)
+						throw;
+					Part.m_pException = std::current_exception();
+				}
+				catch (...) {
+					Part.m_pException = std::current_exception();
+				}
+
+				pStream->seekPosition(0, true);
+			}
+		});
+	}
+
+	// Returns true if a part has been handled by readSliceModelParts
+	static nfBool fnIsSliceModelPartRead(_In_ SLICEMODELPART & Part)
+	{
+		return (Part.m_pModelNode || Part.m_pException);
+	}
+
+	// Moves the slice stacks of a part that has been read by readSliceModelParts into the model
+	static void addSliceModelPart(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ const std::string & sPath, _In_ SLICEMODELPART & Part)
+	{
+		nfUint32 nWarningCount = Part.m_pWarnings->getWarningCount();
+		for (nfUint32 nWarningIndex = 0; nWarningIndex < nWarningCount; nWarningIndex++)
+			pWarnings->addWarning(Part.m_pWarnings->getWarning(nWarningIndex));
+		if (Part.m_pException)
+			std::rethrow_exception(Part.m_pException);
+
+		CModel * pScratchModel = Part.m_pScratchModel.get();
+
+		pModel->setCurrentPath(sPath);
+		pModel->setLanguage(pScratchModel->getLanguage());
+		if (Part.m_pModelNode->getHasUnit())
+			pModel->setUnitString(Part.m_pModelNode->getUnit());
+
+		nfUint32 nResourceCount = pScratchModel->getResourceCount();
+		for (nfUint32 nResourceIndex = 0; nResourceIndex < nResourceCount; nResourceIndex++) {
+			PModelSliceStack pScratchSliceStack = std::dynamic_pointer_cast<CModelSliceStack>(pScratchModel->getResource(nResourceIndex));
+			if (!pScratchSliceStack)
+				throw CNMRException(NMR_ERROR_INVALIDMODELRESOURCE);
+
+			PModelSliceStack pSliceStack = std::make_shared<CModelSliceStack>(pScratchSliceStack->getPackageResourceID()->getModelResourceID(),
+				pModel.get(), pScratchSliceStack->getZBottom());
+			nfUint32 nSliceCount = pScratchSliceStack->getSliceCount();
+			for (nfUint32 nSliceIndex = 0; nSliceIndex < nSliceCount; nSliceIndex++)
+				pSliceStack->AddSlice(pScratchSliceStack->getSlice(nSliceIndex));
+			pSliceStack->SetOwnPath(sPath);
+
+			pModel->addResource(pSliceStack);
+		}
+
+		Part.m_pModelNode = nullptr;
+		Part.m_pScratchModel = nullptr;
+		Part.m_pWarnings = nullptr;
+	}
+
 	void readProductionAttachmentModels(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor)
 	{
+		if (pProgressMonitor)
+			pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READNONROOTMODELS);
+
+		std::vector<SLICEMODELPART> SliceModelParts;
+		readSliceModelParts(pModel, pWarnings, pProgressMonitor, SliceModelParts);
+
 		nfUint32 prodAttCount = pModel->getProductionAttachmentCount();
 		for (nfInt32 i = prodAttCount-1; i >=0; i--)
 		{
@@ -69,6 +279,12 @@ namespace NMR {
 
 			PModelAttachment pProdAttachment = pModel->getProductionModelAttachment(i);
 			std::string sPath = pProdAttachment->getPathURI();
+			NMR_STATISTICS_PART(sPath);
+
+			if (fnIsSliceModelPartRead(SliceModelParts[i])) {
+				addSliceModelPart(pModel, pWarnings, sPath, SliceModelParts[i]);
+				continue;
+			}
 			PImportStream pSubModelStream = pProdAttachment->getStream();
 
 			// Create XML Reader
@@ -122,9 +338,18 @@ namespace NMR {
 
 		nfBool bHasModel = false;
 
+		NMR_STATISTICS_ACTIVATE(statistics().get());
+
+		monitor()->ResetCancelled();
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READSTREAM);
 
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_EXTRACTOPCPACKAGE);
+
+		// The source file name only applies to this stream
+		m_pSourcePackage = nullptr;
+		if (!m_sSourceFileName.empty())
+			m_pSourcePackage = std::make_shared<CModelSourcePackage>(m_sSourceFileName);
+		m_sSourceFileName = "";
 		
 		// Extract Stream from Package
 		PImportStream pModelStream = extract3MFOPCPackage(pStream);
@@ -135,6 +360,8 @@ namespace NMR {
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READROOTMODEL);
 		monitor()->ReportProgressAndQueryCancelled(true);
 
+		NMR_STATISTICS_PART(model()->rootPath());
+
 		// Create XML Reader
 		PXmlReader pXMLReader = fnCreateXMLReaderInstance(pModelStream, monitor());
 
@@ -182,6 +409,11 @@ namespace NMR {
 		if (!bHasModel)
 			throw CNMRException(NMR_ERROR_NOMODELNODE);
 
+		if (m_pSourcePackage.get() != nullptr) {
+			m_pSourcePackage->setResourceRevision(model()->getResourceRevision());
+			m_pSourcePackage = nullptr;
+		}
+
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_DONE);
 		monitor()->ReportProgressAndQueryCancelled(false);
 	}
@@ -41,6 +41,7 @@ It uses libzip and irrxml to parse the OPC package.
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/NMR_StringUtils.h"
+#include "Common/NMR_Statistics.h"
 #include "Common/Platform/NMR_Platform.h"
 #include "Model/Reader/NMR_ModelReader_InstructionElement.h"
 
@@ -89,11 +90,14 @@ namespace NMR {
 		COpcPackageRelationship * pThumbnailRelation = m_pPackageReader->findRootRelation(PACKAGE_THUMBNAIL_RELATIONSHIP_TYPE, true);
 		if (pThumbnailRelation != nullptr) {
 			std::string sTargetPartURI = pThumbnailRelation->getTargetPartURI();
+			NMR_STATISTICS_PART(sTargetPartURI);
 			POpcPackagePart pThumbnailPart = m_pPackageReader->createPart(sTargetPartURI);
 			if (pThumbnailPart == nullptr)
 				throw CNMRException(NMR_ERROR_OPCCOULDNOTGETTHUMBNAILSTREAM);
 			PImportStream pThumbnailStream = pThumbnailPart->getImportStream()->copyToMemory();
-			model()->addPackageThumbnail()->setStream(pThumbnailStream);
+			PModelAttachment pThumbnailAttachment = model()->addPackageThumbnail();
+			pThumbnailAttachment->setStream(pThumbnailStream);
+			setAttachmentSource(pThumbnailAttachment, sTargetPartURI, true);
 			monitor()->IncrementProgress((double)pThumbnailStream->retrieveSize());
 			monitor()->ReportProgressAndQueryCancelled(true);
 		}
@@ -134,6 +138,7 @@ namespace NMR {
 
 				PModelAttachment pModelAttachment = model()->findModelAttachment(sURI);
 				if (!pModelAttachment) {
+					NMR_STATISTICS_PART(sURI);
 					POpcPackagePart pTexturePart = m_pPackageReader->createPart(sURI);
 					PImportStream pTextureAttachmentStream = pTexturePart->getImportStream();
 					PImportStream pMemoryStream = pTextureAttachmentStream->copyToMemory();
@@ -143,6 +148,7 @@ namespace NMR {
 
 					// Add Texture Attachment to Model
 					addTextureAttachment(sURI, pMemoryStream);
+					setAttachmentSource(model()->findModelAttachment(sURI), sURI, true);
 
 					monitor()->IncrementProgress((double)pMemoryStream->retrieveSize());
 					monitor()->ReportProgressAndQueryCancelled(true);
@@ -172,6 +178,7 @@ namespace NMR {
 
 			auto iRelationIterator = m_RelationsToRead.find(sRelationShipType);
 			if (iRelationIterator != m_RelationsToRead.end()) {
+				NMR_STATISTICS_PART(sURI);
 				POpcPackagePart pPart = m_pPackageReader->createPart(sURI);
 				PImportStream pAttachmentStream = pPart->getImportStream();
 				try {
@@ -181,7 +188,7 @@ namespace NMR {
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
 
 					// Add Attachment Stream to Model
-					model()->addAttachment(sURI, sRelationShipType, pMemoryStream);
+					setAttachmentSource(model()->addAttachment(sURI, sRelationShipType, pMemoryStream), sURI, true);
 
 					monitor()->IncrementProgress((double)pMemoryStream->retrieveSize());
 					monitor()->ReportProgressAndQueryCancelled(true);
@@ -232,17 +239,41 @@ namespace NMR {
 				}
 				else {
 					// this is the first time this attachment is read
+					NMR_STATISTICS_PART(sURI);
 					PImportStream pAttachmentStream = pPart->getImportStream();
 					PImportStream pMemoryStream = pAttachmentStream->copyToMemory();
 					if (pMemoryStream->retrieveSize() == 0)
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
-					model()->addProductionAttachment(sURI, sRelationShipType, pMemoryStream, true);
+					setAttachmentSource(model()->addProductionAttachment(sURI, sRelationShipType, pMemoryStream, true), sURI, false);
 				}
 			}
 		}
 	}
 	
 
+	void CModelReader_3MF_Native::setAttachmentSource(_In_ PModelAttachment pAttachment, _In_ const std::string & sURI, _In_ nfBool bKeepCompressedData)
+	{
+		if (pAttachment.get() == nullptr)
+			return;
+
+		ZIPRAWENTRYINFO RawEntryInfo;
+		if (!m_pPackageReader->getRawPartInfo(sURI, RawEntryInfo))
+			return;
+
+		if (m_pSourcePackage.get() != nullptr)
+			pAttachment->setSourceEntry(m_pSourcePackage, sURI, RawEntryInfo);
+
+		if (bKeepCompressedData) {
+			// Stored entries are their own compressed data
+			PImportStream pCompressedStream;
+			if (RawEntryInfo.m_nCompressionMethod == ZIPFILECOMPRESSION_UNCOMPRESSED)
+				pCompressedStream = pAttachment->getStream();
+			else
+				pCompressedStream = m_pPackageReader->openRawPart(sURI)->copyToMemory();
+			pAttachment->setCompressedStream(pCompressedStream, RawEntryInfo);
+		}
+	}
+
 	void CModelReader_3MF_Native::checkContentTypes()
 	{
 		//throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);	
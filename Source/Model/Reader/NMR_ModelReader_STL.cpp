@@ -36,6 +36,7 @@ representation of it.
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/MeshImport/NMR_MeshImporter_STL.h"
+#include "Common/3MF_ProgressMonitor.h"
 
 namespace NMR {
 
@@ -50,6 +51,10 @@ namespace NMR {
 		if (pStream.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
+		monitor()->ResetCancelled();
+		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READMESH);
+		monitor()->ReportProgressAndQueryCancelled(true);
+
 		// Create STL Importer
 		PMeshImporter pImporter = std::make_shared<CMeshImporter_STL>(pStream);
 
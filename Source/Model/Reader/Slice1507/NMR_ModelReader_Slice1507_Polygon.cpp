@@ -29,7 +29,6 @@ Abstract:
 --*/
 
 #include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_Polygon.h"
-#include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_Segment.h"
 
 #include "Model/Classes/NMR_ModelAttachment.h"
 
@@ -49,8 +48,13 @@ namespace NMR {
 	void CModelReaderNode_Slices1507_Polygon::OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader) {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_SLICESPEC) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_SLICESEGMENT) == 0) {
-				PModelReaderNode_Slices1507_Segment pXMLNode = std::make_shared<CModelReaderNode_Slices1507_Segment>(m_pSlice, m_PolygonIndex, m_pWarnings);
-				pXMLNode->parseXML(pXMLReader);
+				// Segments are streamed into the polygon directly, without a reader node per segment
+				CSlice * pSlice = m_pSlice;
+				nfUint32 nPolygonIndex = m_PolygonIndex;
+				parseLeafElement(pXMLReader, [pSlice, nPolygonIndex](const nfChar * pAttributeName, const nfChar * pAttributeValue) {
+					if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_SLICESEGMENT_V2) == 0)
+						pSlice->addPolygonIndex(nPolygonIndex, fnStringToInt32(pAttributeValue));
+				});
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
@@ -74,6 +74,13 @@ namespace NMR {
 
 		m_Slice = m_pSliceStack->AddSlice(m_TopZ);
 
+		// Neighbouring layers have similar contours, so the previous slice sizes the buffers of this one
+		nfUint32 nSliceCount = m_pSliceStack->getSliceCount();
+		if (nSliceCount >= 2) {
+			PSlice pPreviousSlice = m_pSliceStack->getSlice(nSliceCount - 2);
+			m_Slice->reserve(pPreviousSlice->getVertexCount(), pPreviousSlice->getPolygonCount());
+		}
+
 		// Parse Content
 		parseContent(pXMLReader);
 		if (!m_bHasZTop)
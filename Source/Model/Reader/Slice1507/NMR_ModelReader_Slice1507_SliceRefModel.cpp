@@ -37,6 +37,9 @@ namespace NMR {
 	void CModelReader_Slice1507_SliceRefModel::OnNSChildElement(
 		_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader)
 	{
+		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_CORESPEC100) != 0)
+			throw CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT);
+
 		if (strcmp(pChildName, XML_3MF_ELEMENT_BUILD) == 0) {
 			if (m_bHasBuild)
 				throw CNMRException(NMR_ERROR_DUPLICATEBUILDSECTION);
@@ -54,11 +57,22 @@ namespace NMR {
 		}
 	}
 
+	void CModelReader_Slice1507_SliceRefModel::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
+	{
+		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_MODEL_UNIT) == 0) {
+			m_sUnit = pAttributeValue;
+			m_bHasUnit = true;
+		}
+
+		CModelReaderNode_ModelBase::OnAttribute(pAttributeName, pAttributeValue);
+	}
+
 	CModelReader_Slice1507_SliceRefModel::CModelReader_Slice1507_SliceRefModel(
 			_In_ CModel *pModel, _In_ PModelWarnings pWarnings, _In_z_ std::string sSliceRefPath)
 			: CModelReaderNode_ModelBase(pModel, pWarnings, sSliceRefPath.c_str(), nullptr)
 	{
 		m_sSliceRefPath = sSliceRefPath;
+		m_bHasUnit = false;
 	}
 
 	void CModelReader_Slice1507_SliceRefModel::parseXML(_In_ CXmlReader * pXMLReader) {
@@ -68,7 +82,20 @@ namespace NMR {
 		// Parse attribute
 		parseAttributes(pXMLReader);
 
+		// Check required extensions
+		CheckRequiredExtensions();
+
 		// Parse Content
 		parseContent(pXMLReader);
 	}
+
+	nfBool CModelReader_Slice1507_SliceRefModel::getHasUnit()
+	{
+		return m_bHasUnit;
+	}
+
+	std::string CModelReader_Slice1507_SliceRefModel::getUnit()
+	{
+		return m_sUnit;
+	}
 }
@@ -45,8 +45,10 @@ namespace NMR {
 				pXmlNode->parseXML(pXMLReader);
 			}
 			else
-				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
+				throw CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT);
 		}
+		else
+			throw CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT);
 	}
 
 	CModelReader_Slice1507_SliceRefResources::CModelReader_Slice1507_SliceRefResources(
@@ -29,7 +29,6 @@ Abstract:
 --*/
 
 #include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_Vertices.h"
-#include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_Vertex.h"
 #include "Common/NMR_StringUtils.h"
 #include "Model/Classes/NMR_ModelConstants.h"
 
@@ -41,8 +40,18 @@ namespace NMR {
 
 	void CModelReaderNode_Slices1507_Vertices::OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader) {
 		if (strcmp(pChildName, XML_3MF_ELEMENT_SLICEVERTEX) == 0) {
-			PModelReaderNode_Slices1507_Vertex pXMLNode = std::make_shared<CModelReaderNode_Slices1507_Vertex>(m_pSlice, m_pWarnings);
-			pXMLNode->parseXML(pXMLReader);
+			// Vertices are streamed into the slice directly, as a reader node per vertex dominates the parsing time
+			nfFloat fX = 0.0f;
+			nfFloat fY = 0.0f;
+			parseLeafElement(pXMLReader, [&fX, &fY](const nfChar * pAttributeName, const nfChar * pAttributeValue) {
+				if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_SLICEVERTEX_X) == 0)
+					fX = fnStringToFloat(pAttributeValue);
+				else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_SLICEVERTEX_Y) == 0)
+					fY = fnStringToFloat(pAttributeValue);
+				else
+					throw CNMRException(NMR_ERROR_SLICE_INVALIDATTRIBUTE);
+			});
+			m_pSlice->addVertex(fX, fY);
 		}
 		else
 			m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
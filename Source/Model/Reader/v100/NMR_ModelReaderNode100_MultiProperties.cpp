@@ -169,7 +169,7 @@ namespace NMR {
 				while (vctPIndices.size() < nLayers) {
 					vctPIndices.push_back(0);
 				}
-				PModelMultiProperty pMultiProperty = std::make_shared<CModelMultiProperty>(nLayers);
+				m_MultiPropertyIDs.resize(nLayers);
 
 				for (nfUint32 iLayer=0; iLayer < nLayers; iLayer++) {
 					PModelResource pResource = m_pModel->findResource(m_pMultiPropertyGroup->getLayer(iLayer).m_nUniqueResourceID);
@@ -180,10 +180,10 @@ namespace NMR {
 					if (!pResource->mapResourceIndexToPropertyID(vctPIndices[iLayer], nPropertyID)) {
 						throw CNMRException(NMR_ERROR_INVALID_RESOURCE_INDEX);
 					}
-					(*pMultiProperty)[iLayer] = nPropertyID;
+					m_MultiPropertyIDs[iLayer] = nPropertyID;
 				}
 
-				m_pMultiPropertyGroup->addMultiProperty(pMultiProperty);
+				m_pMultiPropertyGroup->addMultiProperty(m_MultiPropertyIDs.data(), nLayers);
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
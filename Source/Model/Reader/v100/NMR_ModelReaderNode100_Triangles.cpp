@@ -117,10 +117,7 @@ namespace NMR {
 
 				// Create face if valid
 				if ((nIndex1 != nIndex2) && (nIndex1 != nIndex3) && (nIndex2 != nIndex3)) {
-					MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
-					MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
-					MESHNODE * pNode3 = m_pMesh->getNode(nIndex3);
-					MESHFACE * pFace = m_pMesh->addFace(pNode1, pNode2, pNode3);
+					nfUint32 nFaceIndex = m_pMesh->addFace(nIndex1, nIndex2, nIndex3);
 
 					ModelResourceID nModelResourceID = 0;
 					if (m_pObjectLevelPropertyID)
@@ -149,7 +146,7 @@ namespace NMR {
 									&& pResource->mapResourceIndexToPropertyID(nResourceIndex3, pPropertyID3)) {
 
 									CMeshInformation_Properties * pProperties = createPropertiesInformation();
-									MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(pFace->m_index);
+									MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(nFaceIndex);
 									if (pFaceData) {
 										pFaceData->m_nUniqueResourceID = pID->getUniqueID();
 										pFaceData->m_nPropertyIDs[0] = pPropertyID1;
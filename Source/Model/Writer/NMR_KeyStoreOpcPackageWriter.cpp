@@ -166,6 +166,15 @@ namespace NMR {
 		return pPart;
 	}
 
+	POpcPackagePart CKeyStoreOpcPackageWriter::addRawPart(_In_ std::string sPath, _In_ const ZIPRAWENTRYINFO & RawEntryInfo, _In_ CImportStream * pCompressedStream)
+	{
+		// Encrypted parts need to be written through their encryption context
+		if (nullptr != m_pContext.keyStore()->findResourceData(sPath))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		return m_pPackageWriter->addRawPart(sPath, RawEntryInfo, pCompressedStream);
+	}
+
 	void CKeyStoreOpcPackageWriter::close() {
 		PSecureContext const & secureContext = m_pContext.secureContext();
 		PKeyStore const & keyStore = m_pContext.keyStore();
@@ -49,7 +49,7 @@ namespace NMR {
 
 	CModelWriter::CModelWriter(_In_ PModel pModel):
 		CModelContext(pModel),
-		m_nDecimalPrecision(6)
+		m_nDecimalPrecision(6), m_bIncrementalModeActive(false)
 	{
 	}
 
@@ -65,4 +65,14 @@ namespace NMR {
 		return m_nDecimalPrecision;
 	}
 
+	void CModelWriter::SetIncrementalModeActive(nfBool bIncrementalModeActive)
+	{
+		m_bIncrementalModeActive = bIncrementalModeActive;
+	}
+
+	nfBool CModelWriter::GetIncrementalModeActive()
+	{
+		return m_bIncrementalModeActive;
+	}
+
 }
@@ -42,6 +42,7 @@ A model writer exports the in memory represenation into a 3MF file.
 #include "Common/Platform/NMR_XmlWriter.h"
 #include "Common/Platform/NMR_Platform.h"
 #include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_Statistics.h"
 
 namespace NMR {
 
@@ -55,6 +56,9 @@ namespace NMR {
 		if (pStream == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
+		NMR_STATISTICS_ACTIVATE(statistics().get());
+
+		monitor()->ResetCancelled();
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_CREATEOPCPACKAGE);
 		monitor()->ReportProgressAndQueryCancelled(true);
 
@@ -65,7 +69,18 @@ namespace NMR {
 		monitor()->ReportProgressAndQueryCancelled(true);
 
 		// Write Package to Stream
-		writePackageToStream(pStream);
+		try {
+			writePackageToStream(pStream);
+		}
+		catch (...) {
+			// Do not keep the target stream and the source packages open
+			try {
+				releasePackage();
+			}
+			catch (...) {
+			}
+			throw;
+		}
 
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_CLEANUP);
 		monitor()->ReportProgressAndQueryCancelled(true);
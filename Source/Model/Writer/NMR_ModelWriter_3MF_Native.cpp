@@ -44,9 +44,11 @@ using LibZ and a native XML writer implementation.
 #include "Common/Platform/NMR_XmlWriter_Native.h" 
 #include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
 #include "Common/Platform/NMR_ExportStream_Memory.h"
+#include "Common/Platform/NMR_Platform.h"
 #include "Common/NMR_StringUtils.h" 
 #include "Common/3MF_ProgressMonitor.h"
 #include "Common/NMR_ModelWarnings.h"
+#include "Common/NMR_Statistics.h"
 #include <functional>
 #include <sstream>
 
@@ -66,8 +68,10 @@ namespace NMR {
 
 	void CModelWriter_3MF_Native::releasePackage()
 	{
-		m_pPackageWriter->close();
+		if (m_pPackageWriter.get() != nullptr)
+			m_pPackageWriter->close();
 		m_pPackageWriter = nullptr;
+		m_SourcePackageReaders.clear();
 		m_pOtherModel = nullptr;
 	}
 
@@ -89,7 +93,10 @@ namespace NMR {
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITEROOTMODEL);
 		monitor()->ReportProgressAndQueryCancelled(true);
 
-		writeModelStream(pXMLWriter.get(), m_pOtherModel);
+		{
+			NMR_STATISTICS_PART(m_pOtherModel->rootPath());
+			writeModelStream(pXMLWriter.get(), m_pOtherModel);
+		}
 
 		// add Root relationships
 		m_pPackageWriter->addRootRelationship(PACKAGE_START_PART_RELATIONSHIP_TYPE, pModelPart.get());
@@ -97,13 +104,18 @@ namespace NMR {
 		PModelAttachment pPackageThumbnail = m_pOtherModel->getPackageThumbnail();
 		if (pPackageThumbnail.get() != nullptr)
 		{
+			NMR_STATISTICS_PART(pPackageThumbnail->getPathURI());
+
 			// create Package Thumbnail Part
-			POpcPackagePart pThumbnailPart = m_pPackageWriter->addPart(pPackageThumbnail->getPathURI());
-			PExportStream pExportStream = pThumbnailPart->getExportStream();
-			// Copy data
-			PImportStream pPackageThumbnailStream = pPackageThumbnail->getStream();
-			pPackageThumbnailStream->seekPosition(0, true);
-			pExportStream->copyFrom(pPackageThumbnailStream.get(), pPackageThumbnailStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+			POpcPackagePart pThumbnailPart = addSourcePart(pPackageThumbnail.get(), pPackageThumbnail->getPathURI());
+			if (pThumbnailPart.get() == nullptr) {
+				pThumbnailPart = m_pPackageWriter->addPart(pPackageThumbnail->getPathURI());
+				PExportStream pExportStream = pThumbnailPart->getExportStream();
+				// Copy data
+				PImportStream pPackageThumbnailStream = pPackageThumbnail->getStream();
+				pPackageThumbnailStream->seekPosition(0, true);
+				pExportStream->copyFrom(pPackageThumbnailStream.get(), pPackageThumbnailStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+			}
 			// add root relationship
 			m_pPackageWriter->addRootRelationship(pPackageThumbnail->getRelationShipType(), pThumbnailPart.get());
 		}
@@ -154,14 +166,28 @@ namespace NMR {
 			if (sNonRootModelPath == m_pOtherModel->rootPath())
 				continue;
 
-			m_pOtherModel->setCurrentPath(sNonRootModelPath);
+			NMR_STATISTICS_PART(sNonRootModelPath);
+
+			// In incremental mode, a non-root model is kept as it was read, if no resource has been modified since
+			PModelAttachment pProductionAttachment = m_pOtherModel->findProductionModelAttachment(sNonRootModelPath);
+			PModelSourcePackage pSourcePackage;
+			if (GetIncrementalModeActive() && (pProductionAttachment.get() != nullptr)) {
+				pSourcePackage = pProductionAttachment->getSourcePackage();
+				if ((pSourcePackage.get() != nullptr) && (pSourcePackage->getResourceRevision() != m_pOtherModel->getResourceRevision()))
+					pSourcePackage = nullptr;
+			}
+
 			PImportStream pStream;
-			{
+			if (pSourcePackage.get() != nullptr) {
+				pStream = pProductionAttachment->getStream();
+			}
+			else {
+				m_pOtherModel->setCurrentPath(sNonRootModelPath);
 				PExportStreamMemory pExportStream = std::make_shared<CExportStreamMemory>();
 				PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pExportStream);
 				writeNonRootModelStream(pXMLWriter.get());
 
-				pStream = std::make_shared<CImportStream_Unique_Memory>(pExportStream->getData(), pExportStream->getDataSize());
+				pStream = std::make_shared<CImportStream_Unique_Memory>(pExportStream->releaseData());
 			}
 			
 			// check, whether this non-root model is already in here
@@ -173,7 +199,64 @@ namespace NMR {
 			}
 			else
 				pNonRootModelAttachment = m_pOtherModel->addAttachment(sNonRootModelPath, PACKAGE_START_PART_RELATIONSHIP_TYPE, pStream);
+
+			if (pSourcePackage.get() != nullptr)
+				pNonRootModelAttachment->setSourceEntry(pSourcePackage, pProductionAttachment->getSourcePath(), pProductionAttachment->getSourceEntryInfo());
+		}
+	}
+
+	POpcPackageReader CModelWriter_3MF_Native::openSourcePackage(_In_ PModelSourcePackage pSourcePackage)
+	{
+		auto iIterator = m_SourcePackageReaders.find(pSourcePackage);
+		if (iIterator != m_SourcePackageReaders.end())
+			return iIterator->second;
+
+		POpcPackageReader pSourceReader;
+		try {
+			PImportStream pSourceStream = fnCreateImportStreamInstance(pSourcePackage->getFileName().c_str());
+			pSourceReader = std::make_shared<COpcPackageReader>(pSourceStream, std::make_shared<CModelWarnings>(), std::make_shared<CProgressMonitor>());
 		}
+		catch (CNMRException &) {
+			// The file cannot be read anymore, so its parts are written from the attachment streams
+			pSourceReader = nullptr;
+		}
+
+		m_SourcePackageReaders.insert(std::make_pair(pSourcePackage, pSourceReader));
+		return pSourceReader;
+	}
+
+	POpcPackagePart CModelWriter_3MF_Native::addSourcePart(_In_ CModelAttachment * pAttachment, _In_ const std::string & sPath)
+	{
+		__NMRASSERT(pAttachment != nullptr);
+
+		// Encrypted parts are written through their encryption context
+		if (keyStore()->findResourceData(fnIncludeLeadingPathDelimiter(sPath)) != nullptr)
+			return nullptr;
+
+		PImportStream pCompressedStream = pAttachment->getCompressedStream();
+		if (pCompressedStream.get() != nullptr) {
+			pCompressedStream->seekPosition(0, true);
+			return m_pPackageWriter->addRawPart(sPath, pAttachment->getSourceEntryInfo(), pCompressedStream.get());
+		}
+
+		PModelSourcePackage pSourcePackage = pAttachment->getSourcePackage();
+		if (!GetIncrementalModeActive() || (pSourcePackage.get() == nullptr))
+			return nullptr;
+
+		POpcPackageReader pSourceReader = openSourcePackage(pSourcePackage);
+		if (pSourceReader.get() == nullptr)
+			return nullptr;
+
+		// The file might have been modified since it was read
+		std::string sSourcePath = pAttachment->getSourcePath();
+		ZIPRAWENTRYINFO RawEntryInfo;
+		if (!pSourceReader->getRawPartInfo(sSourcePath, RawEntryInfo))
+			return nullptr;
+		if (!fnZIPRawEntryInfoIsEqual(RawEntryInfo, pAttachment->getSourceEntryInfo()))
+			return nullptr;
+
+		pCompressedStream = pSourceReader->openRawPart(sSourcePath);
+		return m_pPackageWriter->addRawPart(sPath, RawEntryInfo, pCompressedStream.get());
 	}
 
 	void CModelWriter_3MF_Native::addAttachments(_In_ CModel * pModel, _In_ POpcPackagePart pModelPart)
@@ -196,17 +279,21 @@ namespace NMR {
 				
 				std::string sPath = fnIncludeLeadingPathDelimiter(pAttachment->getPathURI());
 				std::string sRelationShipType = pAttachment->getRelationShipType();
+				NMR_STATISTICS_PART(sPath);
 
 				if (pStream.get() == nullptr)
 					throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 				// create Attachment Part
-				POpcPackagePart pAttachmentPart = m_pPackageWriter->addPart(sPath);
-				PExportStream pExportStream = pAttachmentPart->getExportStream();
-
-				// Copy data
-				pStream->seekPosition(0, true);
-				pExportStream->copyFrom(pStream.get(), pStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+				POpcPackagePart pAttachmentPart = addSourcePart(pAttachment.get(), sPath);
+				if (pAttachmentPart.get() == nullptr) {
+					pAttachmentPart = m_pPackageWriter->addPart(sPath);
+					PExportStream pExportStream = pAttachmentPart->getExportStream();
+
+					// Copy data
+					pStream->seekPosition(0, true);
+					pExportStream->copyFrom(pStream.get(), pStream->retrieveSize(), MODELWRITER_NATIVE_BUFFERSIZE);
+				}
 
 				// add relationships
 				m_pPackageWriter->addPartRelationship(pModelPart, sRelationShipType.c_str(), pAttachmentPart.get());
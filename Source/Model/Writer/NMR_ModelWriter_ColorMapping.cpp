@@ -45,9 +45,9 @@ namespace NMR {
 
 	void CModelWriter_ColorMapping::registerColor(_In_ nfColor cColor)
 	{
-		auto iIterator = m_IndexMap.find(cColor);
-		if (iIterator == m_IndexMap.end()) {
-			m_IndexMap.insert(std::make_pair(cColor, m_nCurrentIndex));
+		ModelResourceIndex nResourceIndex;
+		if (!findColor(cColor, nResourceIndex)) {
+			m_IndexMap.insert(fnHashUint64(cColor), m_nCurrentIndex);
 			m_nCurrentIndex++;
 			m_ColorVector.push_back(cColor);
 		}
@@ -56,15 +56,12 @@ namespace NMR {
 
 	nfBool CModelWriter_ColorMapping::findColor(_In_ nfColor cColor, _Out_ ModelResourceIndex & nResourceIndex)
 	{
-		auto iIterator = m_IndexMap.find(cColor);
-		if (iIterator != m_IndexMap.end()) {
-			nResourceIndex = iIterator->second;
+		auto fnIsEqual = [this, cColor](nfUint32 nIndex) { return m_ColorVector[nIndex] == cColor; };
+		if (m_IndexMap.find(fnHashUint64(cColor), fnIsEqual, nResourceIndex))
 			return true;
-		}
-		else {
-			nResourceIndex = 0;
-			return false;
-		}
+
+		nResourceIndex = 0;
+		return false;
 
 	}
 
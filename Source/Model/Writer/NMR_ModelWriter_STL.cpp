@@ -36,6 +36,11 @@ A model writer exports the in memory representation into a binary STL file.
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/MeshExport/NMR_MeshExporter_STL.h"
+#include "Common/Mesh/NMR_BeamLatticeTessellator.h"
+#include "Common/3MF_ProgressMonitor.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Model/Classes/NMR_ModelBuildItem.h"
+#include "Model/Classes/NMR_ModelInstanceCache.h"
 #include <sstream>
 
 namespace NMR {
@@ -50,13 +55,46 @@ namespace NMR {
 		if (!pStream.get())
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
-		// Create Merged Mesh
+		monitor()->ResetCancelled();
+		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITEOBJECTS);
+
+		// Create Merged Mesh, STL has no beams, so beam lattices are tessellated
 		PMesh pMesh = std::make_shared<CMesh>();
-		model()->mergeToMesh(pMesh.get());
+		auto & Instances = model()->getInstanceCache()->getInstances();
+		monitor()->SetMaxProgress((double)Instances.size() + 1);
+		for (auto & Instance : Instances) {
+			monitor()->ReportProgressAndQueryCancelled(true);
+			mergeObject(pMesh.get(), Instance.m_pObject, Instance.m_mTransform);
+			monitor()->IncrementProgress(1);
+		}
+		m_TessellatedLattices.clear();
 
 		// Export Merged Mesh to STL
 		PMeshExporter pExporter = std::make_shared<CMeshExporter_STL>(pStream);
 		pExporter->exportMesh(pMesh.get(), nullptr);
 	}
 
+	void CModelWriter_STL::mergeObject(_In_ CMesh * pMesh, _In_ CModelObject * pObject, _In_ const NMATRIX3 mMatrix)
+	{
+		__NMRASSERT(pMesh);
+		__NMRASSERT(pObject);
+
+		pObject->mergeToMesh(pMesh, mMatrix);
+
+		CModelMeshObject * pMeshObject = dynamic_cast<CModelMeshObject *> (pObject);
+		if (pMeshObject) {
+			CMesh * pObjectMesh = pMeshObject->getMesh();
+			if (pObjectMesh->getBeamCount() > 0) {
+				auto iIterator = m_TessellatedLattices.find(pObjectMesh);
+				if (iIterator == m_TessellatedLattices.end()) {
+					PMesh pLatticeMesh = std::make_shared<CMesh>();
+					CBeamLatticeTessellator tessellator(pObjectMesh);
+					tessellator.tessellate(pLatticeMesh.get());
+					iIterator = m_TessellatedLattices.insert(std::make_pair(pObjectMesh, pLatticeMesh)).first;
+				}
+				pMesh->mergeMesh(iIterator->second.get(), mMatrix);
+			}
+		}
+	}
+
 }
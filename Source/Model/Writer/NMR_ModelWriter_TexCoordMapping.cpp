@@ -35,8 +35,19 @@ NMR_ModelWriter_ColorMapping.cpp implements the Model Writer Color Mapping Class
 #include "Common/NMR_Exception_Windows.h" 
 #include "Common/NMR_Types.h" 
 
+#include <cstring>
+
 namespace NMR {
 
+	// Hashes the bit patterns of the coordinates, with negative zero folded onto zero
+	static nfUint32 fnHashTexCoords(_In_ nfFloat fU, _In_ nfFloat fV)
+	{
+		nfFloat fCoords[2] = { fU + 0.0f, fV + 0.0f };
+		nfUint64 nBits;
+		memcpy(&nBits, fCoords, sizeof(nBits));
+		return fnHashUint64(nBits);
+	}
+
 	bool operator< (_In_ const WRITERTEXCOORDMAPPINGTREEENTRY & entry1, _In_ const WRITERTEXCOORDMAPPINGTREEENTRY & entry2)
 	{
 		if (entry1.m_fU < entry2.m_fU)
@@ -57,13 +68,13 @@ namespace NMR {
 
 	void CModelWriter_TexCoordMapping::registerTexCoords(_In_ nfFloat fU, _In_ nfFloat fV)
 	{
-		WRITERTEXCOORDMAPPINGTREEENTRY Entry;
-		Entry.m_fU = fU;
-		Entry.m_fV = fV;
+		ModelResourceIndex nResourceIndex;
+		if (!findTexCoords(fU, fV, nResourceIndex)) {
+			WRITERTEXCOORDMAPPINGTREEENTRY Entry;
+			Entry.m_fU = fU;
+			Entry.m_fV = fV;
 
-		auto iIterator = m_IndexMap.find(Entry);
-		if (iIterator == m_IndexMap.end()) {
-			m_IndexMap.insert(std::make_pair(Entry, m_nCurrentIndex));
+			m_IndexMap.insert(fnHashTexCoords(fU, fV), m_nCurrentIndex);
 			m_TexCoordVector.push_back(Entry);
 			m_nCurrentIndex++;
 		}
@@ -72,19 +83,15 @@ namespace NMR {
 
 	nfBool CModelWriter_TexCoordMapping::findTexCoords(_In_ nfFloat fU, _In_ nfFloat fV, _Out_ ModelResourceIndex & nResourceIndex)
 	{
-		WRITERTEXCOORDMAPPINGTREEENTRY Entry;
-		Entry.m_fU = fU;
-		Entry.m_fV = fV;
-
-		auto iIterator = m_IndexMap.find(Entry);
-		if (iIterator != m_IndexMap.end()) {
-			nResourceIndex = iIterator->second;
+		auto fnIsEqual = [this, fU, fV](nfUint32 nIndex) {
+			const WRITERTEXCOORDMAPPINGTREEENTRY & Entry = m_TexCoordVector[nIndex];
+			return (Entry.m_fU == fU) && (Entry.m_fV == fV);
+		};
+		if (m_IndexMap.find(fnHashTexCoords(fU, fV), fnIsEqual, nResourceIndex))
 			return true;
-		}
-		else {
-			nResourceIndex = 0;
-			return false;
-		}
+
+		nResourceIndex = 0;
+		return false;
 
 	}
 
@@ -46,8 +46,6 @@ This is the class for exporting the 3mf mesh node.
 #include <stdio.h>
 #endif // __GNUC__
 
-#define MAX(a,b) (((a)>(b))?(a):(b))
-
 namespace NMR {
 
 	CModelWriterNode100_Mesh::CModelWriterNode100_Mesh(_In_ CModelMeshObject * pModelMeshObject, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor,
@@ -129,6 +127,7 @@ namespace NMR {
 		const nfUint32 nBeamCount = pMesh->getBeamCount();
 		const nfUint32 nBallCount = pMesh->getBallCount();
 		nfUint32 nNodeIndex, nFaceIndex, nBeamIndex, nBallIndex;
+		nfUint32 nBlockIndex, nBlockEntryCount, nBlockEntry;
 
 		// Write Mesh Element
 		writeStartElement(XML_3MF_ELEMENT_MESH);
@@ -149,22 +148,28 @@ namespace NMR {
 
 		// Write Vertices
 		writeStartElement(XML_3MF_ELEMENT_VERTICES);
-		for (nNodeIndex = 0; nNodeIndex < nNodeCount; nNodeIndex++) {
-			// Get Mesh Node
-			MESHNODE * pMeshNode = pMesh->getNode(nNodeIndex);
-			writeVertexData(pMeshNode);
-
-			/* The following works, but would be a major output speed bottleneck!
-
-			// Write Vertex
-			writeStartElement(XML_3MF_ELEMENT_VERTEX);
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_X, pMeshNode->m_position.m_values.x);
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Y, pMeshNode->m_position.m_values.y);
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Z, pMeshNode->m_position.m_values.z);
-			writeEndElement(); */
-
-			if (nNodeIndex % PROGRESS_NODEUPDATE == PROGRESS_NODEUPDATE-1) {
-				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+		MESHNODES & meshNodes = pMesh->getNodes();
+		nNodeIndex = 0;
+		for (nBlockIndex = 0; nNodeIndex < nNodeCount; nBlockIndex++) {
+			// Walk the node storage block by block, instead of looking up every index
+			MESHNODE * pNodeBlock = meshNodes.getBlock(nBlockIndex, nBlockEntryCount);
+			for (nBlockEntry = 0; nBlockEntry < nBlockEntryCount; nBlockEntry++, nNodeIndex++) {
+				// Get Mesh Node
+				MESHNODE * pMeshNode = &pNodeBlock[nBlockEntry];
+				writeVertexData(pMeshNode);
+
+				/* The following works, but would be a major output speed bottleneck!
+
+				// Write Vertex
+				writeStartElement(XML_3MF_ELEMENT_VERTEX);
+				writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_X, pMeshNode->m_position.m_values.x);
+				writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Y, pMeshNode->m_position.m_values.y);
+				writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Z, pMeshNode->m_position.m_values.z);
+				writeEndElement(); */
+
+				if (nNodeIndex % PROGRESS_NODEUPDATE == PROGRESS_NODEUPDATE-1) {
+					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+				}
 			}
 		}
 		writeFullEndElement();
@@ -192,16 +197,31 @@ namespace NMR {
 		
 		bool bMeshHasAProperty = false;
 
+		// Package resource lookups are cached, as faces usually share few property resources
+		UniqueResourceID nLastPropertyID = 0;
+		ModelResourceID nLastPropertyModelResourceID = 0;
+
 		m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITETRIANGLES);
 		// Write Triangles
 		writeStartElement(XML_3MF_ELEMENT_TRIANGLES);
+		MESHFACES & meshFaces = pMesh->getFaces();
+		MESHFACE * pFaceBlock = nullptr;
+		nBlockIndex = 0;
+		nBlockEntry = 0;
+		nBlockEntryCount = 0;
 		for (nFaceIndex = 0; nFaceIndex < nFaceCount; nFaceIndex++) {
 			if (nFaceIndex % PROGRESS_TRIANGLEUPDATE == PROGRESS_TRIANGLEUPDATE - 1) {
 				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 			}
 
-			// Get Mesh Face
-			MESHFACE * pMeshFace = pMesh->getFace(nFaceIndex);
+			// Get Mesh Face, walking the face storage block by block
+			if (nBlockEntry == nBlockEntryCount) {
+				pFaceBlock = meshFaces.getBlock(nBlockIndex, nBlockEntryCount);
+				nBlockIndex++;
+				nBlockEntry = 0;
+			}
+			MESHFACE * pMeshFace = &pFaceBlock[nBlockEntry];
+			nBlockEntry++;
 
 			UniqueResourceID nPropertyID = 0;
 			ModelResourceIndex nPropertyIndex1 = 0;
@@ -225,8 +245,11 @@ namespace NMR {
 
 			if (nPropertyID != 0) {
 				bMeshHasAProperty = true;
-				// TODO: this is slow
-				ModelResourceID nPropertyModelResourceID = m_pModel->findPackageResourceID(nPropertyID)->getModelResourceID();
+				if (nPropertyID != nLastPropertyID) {
+					nLastPropertyModelResourceID = m_pModel->findPackageResourceID(nPropertyID)->getModelResourceID();
+					nLastPropertyID = nPropertyID;
+				}
+				ModelResourceID nPropertyModelResourceID = nLastPropertyModelResourceID;
 				if ((nPropertyIndex1 != nPropertyIndex2) || (nPropertyIndex1 != nPropertyIndex3)) {
 					writeFaceData_ThreeProperties(pMeshFace, nPropertyModelResourceID, nPropertyIndex1, nPropertyIndex2, nPropertyIndex3, pAdditionalString);
 				}
@@ -356,10 +379,14 @@ namespace NMR {
 				{
 					// write beamlattice: beams
 					writeStartElementWithPrefix(XML_3MF_ELEMENT_BEAMS, XML_3MF_NAMESPACEPREFIX_BEAMLATTICE);
-					for (nBeamIndex = 0; nBeamIndex < nBeamCount; nBeamIndex++) {
-						// write beamlattice: beam
-						MESHBEAM * pMeshBeam = pMesh->getBeam(nBeamIndex);
-						writeBeamData(pMeshBeam, dDefaultRadius, eDefaultCapMode);
+					MESHBEAMS & meshBeams = pMesh->getBeams();
+					nBeamIndex = 0;
+					for (nBlockIndex = 0; nBeamIndex < nBeamCount; nBlockIndex++) {
+						MESHBEAM * pBeamBlock = meshBeams.getBlock(nBlockIndex, nBlockEntryCount);
+						for (nBlockEntry = 0; nBlockEntry < nBlockEntryCount; nBlockEntry++, nBeamIndex++) {
+							// write beamlattice: beam
+							writeBeamData(&pBeamBlock[nBlockEntry], dDefaultRadius, eDefaultCapMode);
+						}
 					}
 					writeFullEndElement();
 
@@ -428,89 +455,11 @@ namespace NMR {
 	}
 
 	void CModelWriterNode100_Mesh::putFloat(_In_ const nfFloat fValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos) {
-		// Format float with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
-		nfInt64 nAbsValue = (nfInt64)(fValue * m_nPutDoubleFactor);
-		nAbsValue = MAX(nAbsValue, -nAbsValue);
-		nfBool bIsNegative = fValue < 0;
-
-		int nStart = nBufferPos;
-		int nCount = 0;
-
-		if (!nAbsValue) {
-			line[nBufferPos++] = '0';
-		}
-		else {
-			// Write the string in reverse order
-			while (nAbsValue || nCount < m_nPosAfterDecPoint) {
-				line[nBufferPos++] = '0' + (nAbsValue % 10);
-				nAbsValue /= 10;
-				nCount++;
-				if (nCount == m_nPosAfterDecPoint) {
-					line[nBufferPos++] = '.';
-					if (!nAbsValue) {
-						line[nBufferPos++] = '0';
-					}
-					nCount++;
-				}
-			}
-			if (bIsNegative) {
-				line[nBufferPos++] = '-';
-				nCount++;
-			}
-		}
-
-		// Reverse the float string
-		int nEnd = nBufferPos - 1;
-		while (nStart < nEnd) {
-			char temp = line[nStart];
-			line[nStart] = line[nEnd];
-			line[nEnd] = temp;
-			nStart++;
-			nEnd--;
-		}
+		nBufferPos += fnPutFixedPoint(fValue, m_nPutDoubleFactor, m_nPosAfterDecPoint, &line[nBufferPos]);
 	}
 
 	void CModelWriterNode100_Mesh::putDouble(_In_ const nfDouble dValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos) {
-		// Format float with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
-		nfInt64 nAbsValue = (nfInt64)(dValue * m_nPutDoubleFactor);
-		nAbsValue = MAX(nAbsValue, -nAbsValue);
-		nfBool bIsNegative = dValue < 0;
-
-		int nStart = nBufferPos;
-		int nCount = 0;
-
-		if (!nAbsValue) {
-			line[nBufferPos++] = '0';
-		}
-		else {
-			// Write the string in reverse order
-			while (nAbsValue || nCount < m_nPosAfterDecPoint) {
-				line[nBufferPos++] = '0' + (nAbsValue % 10);
-				nAbsValue /= 10;
-				nCount++;
-				if (nCount == m_nPosAfterDecPoint) {
-					line[nBufferPos++] = '.';
-					if (!nAbsValue) {
-						line[nBufferPos++] = '0';
-					}
-					nCount++;
-				}
-			}
-			if (bIsNegative) {
-				line[nBufferPos++] = '-';
-				nCount++;
-			}
-		}
-
-		// Reverse the float string
-		int nEnd = nBufferPos - 1;
-		while (nStart < nEnd) {
-			char temp = line[nStart];
-			line[nStart] = line[nEnd];
-			line[nEnd] = temp;
-			nStart++;
-			nEnd--;
-		}
+		nBufferPos += fnPutFixedPoint(dValue, m_nPutDoubleFactor, m_nPosAfterDecPoint, &line[nBufferPos]);
 	}
 
 	void CModelWriterNode100_Mesh::putVertexFloat(_In_ const nfFloat fValue)
@@ -797,14 +746,14 @@ namespace NMR {
 			putBeamDouble(pBeam->m_radius[1]);
 		}
 
-		if ( eDefaultCapMode != pBeam->m_capMode[0] ) {
+		if ( eDefaultCapMode != pBeam->getCapMode(0) ) {
 			const std::string sCap1 = "\" " + std::string(XML_3MF_ATTRIBUTE_BEAMLATTICE_CAP1) + "=\""
-				                                           + capModeToString(eModelBeamLatticeCapMode(pBeam->m_capMode[0]));
+				                                           + capModeToString(eModelBeamLatticeCapMode(pBeam->getCapMode(0)));
 			putBeamString(sCap1.c_str());
 		}
-		if (eDefaultCapMode != pBeam->m_capMode[1]) {
+		if (eDefaultCapMode != pBeam->getCapMode(1)) {
 			const std::string sCap2 = "\" " + std::string(XML_3MF_ATTRIBUTE_BEAMLATTICE_CAP2) + "=\""
-				+ capModeToString(eModelBeamLatticeCapMode(pBeam->m_capMode[1]));
+				+ capModeToString(eModelBeamLatticeCapMode(pBeam->getCapMode(1)));
 			putBeamString(sCap2.c_str());
 		}
 
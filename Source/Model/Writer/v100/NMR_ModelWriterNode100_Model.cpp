@@ -33,6 +33,7 @@ This is the class for exporting the 3mf model stream root node.
 
 #include "Model/Writer/v100/NMR_ModelWriterNode100_Mesh.h"
 #include "Model/Writer/v100/NMR_ModelWriterNode100_Model.h"
+#include "Model/Writer/v100/NMR_ModelWriterNode100_SliceStack.h"
 #include "Model/Writer/v100/NMR_ResourceDependencySorter.h"
 
 #include "Model/Classes/NMR_ModelAttachment.h"
@@ -368,88 +369,16 @@ namespace NMR {
 	void CModelWriterNode100_Model::writeSliceStack(_In_ CModelSliceStack *pSliceStackResource) {
 		__NMRASSERT(pSliceStackResource);
 
-		std::string sNameSpacePrefix = XML_3MF_NAMESPACEPREFIX_SLICE;
-
 		if (pSliceStackResource->OwnPath() == m_pModel->currentPath())
 		{
-			writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICESTACKRESOURCE, XML_3MF_NAMESPACEPREFIX_SLICE);
-
-			assertResourceIsInCurrentPath(pSliceStackResource->getPackageResourceID());
-			writeIntAttribute(XML_3MF_ATTRIBUTE_SLICESTACKID, pSliceStackResource->getPackageResourceID()->getModelResourceID());
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_SLICESTACKZBOTTOM, (float)pSliceStackResource->getZBottom());
-
-
-			if (pSliceStackResource->getSliceRefCount() > 0) {
-				for (nfUint32 sliceRefIndex = 0; sliceRefIndex < pSliceStackResource->getSliceRefCount(); sliceRefIndex++) {
-					auto sliceRef = pSliceStackResource->getSliceRef(sliceRefIndex);
-
-					writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEREFRESOURCE, XML_3MF_NAMESPACEPREFIX_SLICE);
-					writeIntAttribute(XML_3MF_ATTRIBUTE_SLICEREF_ID, sliceRef->getPackageResourceID()->getModelResourceID());
-					if (sliceRef->OwnPath() != m_pModel->currentPath()) {
-						writeStringAttribute(XML_3MF_ATTRIBUTE_SLICEREF_PATH, sliceRef->OwnPath());
-					}
-					writeEndElement();
-				}
-			}
-
-			if (pSliceStackResource->getSliceCount() > 0) {
-				for (nfUint32 nSliceIndex = 0; nSliceIndex < pSliceStackResource->getSliceCount(); nSliceIndex++) {
-					if (nSliceIndex % PROGRESS_SLICEUPDATE == PROGRESS_SLICEUPDATE - 1) {
-
-						m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITESLICES);
-						m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
-					}
-					PSlice pSlice = pSliceStackResource->getSlice(nSliceIndex);
-					writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICE, XML_3MF_NAMESPACEPREFIX_SLICE);
-
-					writeFloatAttribute(XML_3MF_ATTRIBUTE_SLICEZTOP, nfFloat(pSlice->getTopZ()));
-					if (pSlice->getVertexCount() >= 2) {
-						writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEVERTICES, XML_3MF_NAMESPACEPREFIX_SLICE);
-
-						for (nfUint32 nVertexIndex = 0; nVertexIndex < pSlice->getVertexCount(); nVertexIndex++) {
-							writeStartElementWithPrefix(XML_3MF_ELEMENT_VERTEX, XML_3MF_NAMESPACEPREFIX_SLICE);
-							nfFloat x, y;
-							pSlice->getVertex(nVertexIndex, &x, &y);
-							writeFloatAttribute(XML_3MF_ATTRIBUTE_SLICEVERTEX_X, x);
-							writeFloatAttribute(XML_3MF_ATTRIBUTE_SLICEVERTEX_Y, y);
-							writeEndElement();
-						}
-						writeFullEndElement();
-					}
-					else {
-						if (pSlice->getVertexCount() == 1)
-							throw CNMRException(NMR_ERROR_SLICE_ONEVERTEX);
-					}
-
-					for (nfUint32 nPolygonIndex = 0; nPolygonIndex < pSlice->getPolygonCount(); nPolygonIndex++) {
-						if (pSlice->getPolygonIndexCount(nPolygonIndex) >= 2) {
-							writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEPOLYGON, XML_3MF_NAMESPACEPREFIX_SLICE);
-							writeIntAttribute(XML_3MF_ATTRIBUTE_SLICEPOLYGON_STARTV, pSlice->getPolygonIndex(nPolygonIndex, 0));
-
-							for (nfUint32 nIndexIndex = 1; nIndexIndex < pSlice->getPolygonIndexCount(nPolygonIndex); nIndexIndex++) {
-								writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICESEGMENT, XML_3MF_NAMESPACEPREFIX_SLICE);
-								writeIntAttribute(XML_3MF_ATTRIBUTE_SLICESEGMENT_V2, pSlice->getPolygonIndex(nPolygonIndex, nIndexIndex));
-								writeEndElement();
-							}
-
-							writeFullEndElement();
-						}
-						else {
-							if (pSlice->getPolygonIndexCount(nPolygonIndex) == 1)
-								throw CNMRException(NMR_ERROR_SLICE_ONEPOINT);
-						}
-					}
-
-					writeFullEndElement();
-				}
-			}
-			writeFullEndElement();
+			CModelWriterNode100_SliceStack ModelWriter_SliceStack(pSliceStackResource, m_pXMLWriter, m_pProgressMonitor, m_nDecimalPrecision);
+			ModelWriter_SliceStack.writeToXML();
 		}
 	}
 
 	void CModelWriterNode100_Model::writeObjects()
 	{
-		std::list <CModelObject *> objectList = m_pModel->getSortedObjectList();
+		std::vector <CModelObject *> objectList = m_pModel->getSortedObjectList();
 
 		for(auto iIterator = objectList.begin();
 			iIterator != objectList.end(); iIterator++)
@@ -709,6 +638,8 @@ namespace NMR {
 		writeIntAttribute(XML_3MF_ATTRIBUTE_COLORS_ID, nResourceID);
 
 		nfUint32 nElementCount = pColorGroup->getCount();
+		std::vector<nfColor> Colors(nElementCount);
+		pColorGroup->getAllColors(Colors.data());
 
 		UniqueResourceID nUniqueResourceID = pColorGroup->getPackageResourceID()->getUniqueID();
 		for (nfUint32 j = 0; j < nElementCount; j++) {
@@ -716,7 +647,7 @@ namespace NMR {
 			if (!pColorGroup->mapResourceIndexToPropertyID(j, nPropertyID)) {
 				throw CNMRException(NMR_ERROR_INVALIDPROPERTYRESOURCEID);
 			}
-			nfColor pElement = pColorGroup->getColor(nPropertyID);
+			nfColor pElement = Colors[j];
 
 			m_pPropertyIndexMapping->registerPropertyID(nUniqueResourceID, nPropertyID, j);
 
@@ -750,13 +681,16 @@ namespace NMR {
 			writeIntAttribute(XML_3MF_ATTRIBUTE_TEX2DGROUP_TEXTUREID, pTexture2DGroup->getTexture2D()->getPackageResourceID()->getModelResourceID());
 
 			nfUint32 nElementCount = pTexture2DGroup->getCount();
+			std::vector<MODELTEXTURE2DCOORDINATE> UVCoordinates(nElementCount);
+			pTexture2DGroup->getAllUVCoordinates(UVCoordinates.data());
+
 			UniqueResourceID nUniqueResourceID = pTexture2DGroup->getPackageResourceID()->getUniqueID();
 			for (nfUint32 j = 0; j < nElementCount; j++) {
 				ModelPropertyID nPropertyID;
 				if (!pTexture2DGroup->mapResourceIndexToPropertyID(j, nPropertyID)) {
 					throw CNMRException(NMR_ERROR_INVALIDPROPERTYRESOURCEID);
 				}
-				MODELTEXTURE2DCOORDINATE uvCoordinate = pTexture2DGroup->getUVCoordinate(nPropertyID);
+				const MODELTEXTURE2DCOORDINATE & uvCoordinate = UVCoordinates[j];
 
 				m_pPropertyIndexMapping->registerPropertyID(nUniqueResourceID, nPropertyID, j);
 
@@ -872,12 +806,13 @@ namespace NMR {
 			}
 			m_pPropertyIndexMapping->registerPropertyID(nUniqueResourceID, nPropertyID, iMulti);
 
-			PModelMultiProperty pMultiProperty = pMultiPropertyGroup->getMultiProperty(nPropertyID);
+			nfUint32 nPropertyIDCount;
+			const ModelPropertyID * pPropertyIDs = pMultiPropertyGroup->getMultiPropertyIDs(nPropertyID, nPropertyIDCount);
 			std::vector<nfUint32> vctPIndices;
 			for (nfUint32 iLayer = 0; iLayer < nLayerCount; iLayer++) {
 				MODELMULTIPROPERTYLAYER layer = pMultiPropertyGroup->getLayer(iLayer);
-				if (iLayer < pMultiProperty->size()) {
-					nfUint32 pIndex = m_pPropertyIndexMapping->mapPropertyIDToIndex(layer.m_nUniqueResourceID, (*pMultiProperty)[iLayer]);
+				if (iLayer < nPropertyIDCount) {
+					nfUint32 pIndex = m_pPropertyIndexMapping->mapPropertyIDToIndex(layer.m_nUniqueResourceID, pPropertyIDs[iLayer]);
 					vctPIndices.push_back(pIndex);
 				} else {
 					throw CNMRException(NMR_ERROR_MULTIPROPERTIES_NOT_ENOUGH_PROPERTYIDS_SPECIFIED);
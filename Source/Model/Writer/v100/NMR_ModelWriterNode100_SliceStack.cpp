@@ -0,0 +1,242 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelWriterNode100_SliceStack.cpp implements the Model Writer Slice Stack Node Class.
+This is the class for exporting the 3mf slice stack node.
+
+--*/
+
+#include "Model/Writer/v100/NMR_ModelWriterNode100_SliceStack.h"
+#include "Model/Classes/NMR_ModelConstants.h"
+#include "Model/Classes/NMR_ModelConstants_Slices.h"
+#include "Model/Classes/NMR_Model.h"
+
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_Exception_Windows.h"
+#include "Common/NMR_Parallel.h"
+#include "Common/NMR_StringUtils.h"
+
+#include "Common/3MF_ProgressMonitor.h"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace NMR {
+
+	CModelWriterNode100_SliceStack::CModelWriterNode100_SliceStack(_In_ CModelSliceStack * pSliceStack, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ int nPosAfterDecPoint)
+		:CModelWriterNode_ModelBase(pSliceStack->getModel(), pXMLWriter, pProgressMonitor), m_nPosAfterDecPoint(nPosAfterDecPoint), m_nPutDoubleFactor((nfInt64)(pow(10, nPosAfterDecPoint)))
+	{
+		__NMRASSERT(pSliceStack != nullptr);
+		m_pSliceStack = pSliceStack;
+	}
+
+	void CModelWriterNode100_SliceStack::writeToXML()
+	{
+		writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICESTACKRESOURCE, XML_3MF_NAMESPACEPREFIX_SLICE);
+
+		assertResourceIsInCurrentPath(m_pSliceStack->getPackageResourceID());
+		writeIntAttribute(XML_3MF_ATTRIBUTE_SLICESTACKID, m_pSliceStack->getPackageResourceID()->getModelResourceID());
+		writeFloatAttribute(XML_3MF_ATTRIBUTE_SLICESTACKZBOTTOM, (float)m_pSliceStack->getZBottom());
+
+		writeSliceRefs();
+		writeSlices();
+
+		writeFullEndElement();
+	}
+
+	void CModelWriterNode100_SliceStack::writeSliceRefs()
+	{
+		nfUint32 nSliceRefCount = m_pSliceStack->getSliceRefCount();
+		for (nfUint32 nSliceRefIndex = 0; nSliceRefIndex < nSliceRefCount; nSliceRefIndex++) {
+			auto sliceRef = m_pSliceStack->getSliceRef(nSliceRefIndex);
+
+			writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEREFRESOURCE, XML_3MF_NAMESPACEPREFIX_SLICE);
+			writeIntAttribute(XML_3MF_ATTRIBUTE_SLICEREF_ID, sliceRef->getPackageResourceID()->getModelResourceID());
+			if (sliceRef->OwnPath() != m_pModel->currentPath()) {
+				writeStringAttribute(XML_3MF_ATTRIBUTE_SLICEREF_PATH, sliceRef->OwnPath());
+			}
+			writeEndElement();
+		}
+	}
+
+	void CModelWriterNode100_SliceStack::writeSlices()
+	{
+		nfUint32 nSliceCount = m_pSliceStack->getSliceCount();
+
+		std::vector<CSlice *> slices;
+		slices.reserve(nSliceCount);
+		for (nfUint32 nSliceIndex = 0; nSliceIndex < nSliceCount; nSliceIndex++)
+			slices.push_back(m_pSliceStack->getSlice(nSliceIndex).get());
+
+		std::vector<SLICELINEBUFFER> buffers;
+
+		nfUint32 nBatchBegin = 0;
+		while (nBatchBegin < nSliceCount) {
+			// Collect slices until the batch holds enough lines to keep all threads busy
+			nfUint32 nBatchEnd = nBatchBegin;
+			nfUint64 nBatchLines = 0;
+			while ((nBatchEnd < nSliceCount) && (nBatchLines < MODELWRITERSLICESTACK100_MAXBATCHLINES)) {
+				CSlice * pSlice = slices[nBatchEnd];
+				nBatchLines += pSlice->getVertexCount();
+				nfUint32 nPolygonCount = pSlice->getPolygonCount();
+				for (nfUint32 nPolygonIndex = 0; nPolygonIndex < nPolygonCount; nPolygonIndex++)
+					nBatchLines += pSlice->getPolygonIndexCount(nPolygonIndex);
+				nBatchEnd++;
+			}
+
+			nfUint32 nBatchCount = nBatchEnd - nBatchBegin;
+			if (buffers.size() < nBatchCount)
+				buffers.resize(nBatchCount);
+
+			nfUint32 nThreadCount = (nBatchLines >= MODELWRITERSLICESTACK100_MINPARALLELLINES) ? 0 : 1;
+			fnParallelFor(nBatchCount, nThreadCount, MODELWRITERSLICESTACK100_MINSLICESPERTHREAD, [&](nfUint32 nBegin, nfUint32 nEnd) {
+				for (nfUint32 nIndex = nBegin; nIndex < nEnd; nIndex++)
+					renderSlice(slices[nBatchBegin + nIndex], buffers[nIndex]);
+			});
+
+			for (nfUint32 nSliceIndex = nBatchBegin; nSliceIndex < nBatchEnd; nSliceIndex++) {
+				if (nSliceIndex % PROGRESS_SLICEUPDATE == PROGRESS_SLICEUPDATE - 1) {
+					m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITESLICES);
+					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+				}
+				writeSlice(slices[nSliceIndex], buffers[nSliceIndex - nBatchBegin]);
+			}
+
+			nBatchBegin = nBatchEnd;
+		}
+	}
+
+	void CModelWriterNode100_SliceStack::renderSlice(_In_ CSlice * pSlice, _Out_ SLICELINEBUFFER & buffer)
+	{
+		__NMRASSERT(pSlice);
+		buffer.m_Data.clear();
+		buffer.m_LineEnds.clear();
+
+		std::array<nfChar, MODELWRITERSLICESTACK100_LINEBUFFERSIZE> line;
+
+		nfUint32 nVertexCount = pSlice->getVertexCount();
+		if (nVertexCount == 1)
+			throw CNMRException(NMR_ERROR_SLICE_ONEVERTEX);
+
+		if (nVertexCount >= 2) {
+			memcpy(&line[0], MODELWRITERSLICESTACK100_VERTEXLINESTART, MODELWRITERSLICESTACK100_VERTEXLINESTARTLENGTH);
+			for (nfUint32 nVertexIndex = 0; nVertexIndex < nVertexCount; nVertexIndex++) {
+				SLICENODE * pNode = pSlice->getNode(nVertexIndex);
+
+				nfUint32 nPos = MODELWRITERSLICESTACK100_VERTEXLINESTARTLENGTH;
+				nPos += fnPutFixedPoint(pNode->m_position.m_values.x, m_nPutDoubleFactor, m_nPosAfterDecPoint, &line[nPos]);
+				memcpy(&line[nPos], "\" y=\"", 5);
+				nPos += 5;
+				nPos += fnPutFixedPoint(pNode->m_position.m_values.y, m_nPutDoubleFactor, m_nPosAfterDecPoint, &line[nPos]);
+				memcpy(&line[nPos], "\"/>", 3);
+				nPos += 3;
+
+				putLine(&line[0], nPos, buffer);
+			}
+		}
+
+		memcpy(&line[0], MODELWRITERSLICESTACK100_SEGMENTLINESTART, MODELWRITERSLICESTACK100_SEGMENTLINESTARTLENGTH);
+		nfUint32 nPolygonCount = pSlice->getPolygonCount();
+		for (nfUint32 nPolygonIndex = 0; nPolygonIndex < nPolygonCount; nPolygonIndex++) {
+			nfUint32 nIndexCount = pSlice->getPolygonIndexCount(nPolygonIndex);
+			if (nIndexCount == 1)
+				throw CNMRException(NMR_ERROR_SLICE_ONEPOINT);
+
+			for (nfUint32 nIndexIndex = 1; nIndexIndex < nIndexCount; nIndexIndex++) {
+				nfUint32 nPos = MODELWRITERSLICESTACK100_SEGMENTLINESTARTLENGTH;
+				nPos += putUInt32(pSlice->getPolygonIndex(nPolygonIndex, nIndexIndex), &line[nPos]);
+				memcpy(&line[nPos], "\"/>", 3);
+				nPos += 3;
+
+				putLine(&line[0], nPos, buffer);
+			}
+		}
+	}
+
+	void CModelWriterNode100_SliceStack::writeSlice(_In_ CSlice * pSlice, _In_ const SLICELINEBUFFER & buffer)
+	{
+		__NMRASSERT(pSlice);
+		const nfChar * pData = buffer.m_Data.data();
+		nfUint32 nLineIndex = 0;
+		nfUint32 nLineStart = 0;
+
+		auto fnWriteLines = [&](nfUint32 nCount) {
+			for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+				nfUint32 nLineEnd = buffer.m_LineEnds[nLineIndex++];
+				m_pXMLWriter->WriteRawLine(pData + nLineStart, nLineEnd - nLineStart);
+				nLineStart = nLineEnd;
+			}
+		};
+
+		writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICE, XML_3MF_NAMESPACEPREFIX_SLICE);
+		writeFloatAttribute(XML_3MF_ATTRIBUTE_SLICEZTOP, nfFloat(pSlice->getTopZ()));
+
+		nfUint32 nVertexCount = pSlice->getVertexCount();
+		if (nVertexCount >= 2) {
+			writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEVERTICES, XML_3MF_NAMESPACEPREFIX_SLICE);
+			fnWriteLines(nVertexCount);
+			writeFullEndElement();
+		}
+
+		nfUint32 nPolygonCount = pSlice->getPolygonCount();
+		for (nfUint32 nPolygonIndex = 0; nPolygonIndex < nPolygonCount; nPolygonIndex++) {
+			nfUint32 nIndexCount = pSlice->getPolygonIndexCount(nPolygonIndex);
+			if (nIndexCount >= 2) {
+				writeStartElementWithPrefix(XML_3MF_ELEMENT_SLICEPOLYGON, XML_3MF_NAMESPACEPREFIX_SLICE);
+				writeIntAttribute(XML_3MF_ATTRIBUTE_SLICEPOLYGON_STARTV, pSlice->getPolygonIndex(nPolygonIndex, 0));
+				fnWriteLines(nIndexCount - 1);
+				writeFullEndElement();
+			}
+		}
+
+		writeFullEndElement();
+	}
+
+	void CModelWriterNode100_SliceStack::putLine(_In_ const nfChar * pLine, _In_ nfUint32 nLength, _Inout_ SLICELINEBUFFER & buffer)
+	{
+		buffer.m_Data.insert(buffer.m_Data.end(), pLine, pLine + nLength);
+		buffer.m_LineEnds.push_back((nfUint32)buffer.m_Data.size());
+	}
+
+	nfUint32 CModelWriterNode100_SliceStack::putUInt32(_In_ const nfUint32 nValue, _Out_ nfChar * pTarget)
+	{
+		nfChar digits[10];
+		nfUint32 nDigitCount = 0;
+		nfUint32 nRemainder = nValue;
+		do {
+			digits[nDigitCount++] = '0' + (nRemainder % 10);
+			nRemainder /= 10;
+		} while (nRemainder);
+
+		for (nfUint32 nIndex = 0; nIndex < nDigitCount; nIndex++)
+			pTarget[nIndex] = digits[nDigitCount - 1 - nIndex];
+		return nDigitCount;
+	}
+
+}
@@ -32,7 +32,7 @@ sorting them topologically.
 
 #include "Model/Writer/v100/NMR_ResourceDependencySorter.h"
 
-#include "Common/Graph/DirectedGraph.h"
+#include "Common/Graph/SparseDirectedGraph.h"
 #include "Common/Graph/GraphAlgorithms.h"
 #include "Model/Classes/NMR_Model.h"
 #include "Model/Classes/NMR_ModelResource.h"
@@ -48,42 +48,26 @@ namespace NMR
 
     TopologicalSortResult CResourceDependencySorter::sort()
     {
-        // gather list of resources that are standalone
-        TopologicalSortResult sortedResources;
-
-        for(nfUint32 i = 0; i < m_pModel->getResourceCount(); i++)
-        {
-            auto pResource = m_pModel->getResource(i);
-            if(pResource->getDependencies().empty())
-            {
-                sortedResources.push_back(
-                    pResource->getPackageResourceID());
-            }
-        }
-
-        auto graph = buildGraph();
-        if (common::graph::isCyclic(graph))
+        // Resources without dependencies come first in their model order,
+        // followed by the others as soon as all their dependencies are written
+        auto sortedIndices = common::graph::topologicalSort(buildGraph());
+        if (sortedIndices.size() != m_indexToResourceID.size())
         {
             throw CNMRException(NMR_ERROR_INVALIDPARAM, "Cyclic dependency between resources detected");
         }
-        auto sortedIndices = common::graph::topologicalSort(
-            buildGraph());  // only contains resources that have or are a
-                            // dependency
 
+        TopologicalSortResult sortedResources;
+        sortedResources.reserve(sortedIndices.size());
         for (auto index : sortedIndices)
         {
-            
-            auto modelResourceID = indexToModelResourceID(index);
-            if (std::find(sortedResources.begin(), sortedResources.end(), modelResourceID) == sortedResources.end()) {
-                sortedResources.push_back(modelResourceID);
-            }
+            sortedResources.push_back(indexToModelResourceID(index));
         }
         return sortedResources;
     }
 
-    common::graph::DirectedGraph CResourceDependencySorter::buildGraph()
+    common::graph::SparseDirectedGraph CResourceDependencySorter::buildGraph()
     {
-        common::graph::DirectedGraph graph(m_pModel->getResourceCount());
+        common::graph::SparseDirectedGraph graph(m_pModel->getResourceCount());
 
         for(nfUint32 i = 0; i < m_pModel->getResourceCount(); i++)
         {
@@ -101,11 +85,14 @@ namespace NMR
 
     void CResourceDependencySorter::buildIndexMaps()
     {
-        for(nfUint32 i = 0; i < m_pModel->getResourceCount(); i++)
+        nfUint32 nResourceCount = m_pModel->getResourceCount();
+        m_indexToResourceID.reserve(nResourceCount);
+        m_resourceIDToIndex.reserve(nResourceCount);
+        for(nfUint32 i = 0; i < nResourceCount; i++)
         {
             auto pResource = m_pModel->getResource(i);
-            m_indexToResourceID[i] =
-                pResource->getPackageResourceID();
+            m_indexToResourceID.push_back(
+                pResource->getPackageResourceID());
             m_resourceIDToIndex[pResource->getPackageResourceID()] = i;
         }
     }
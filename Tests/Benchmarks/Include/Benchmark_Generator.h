@@ -0,0 +1,116 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Generator.h: Deterministic generator for large synthetic 3MF models.
+The same seed and scale always produce the same models and, as the package
+writer uses fixed ZIP timestamps, byte identical packages. The only exception
+is the key UUID of the encrypted corpus, which the API does not allow to set.
+
+--*/
+
+#ifndef __NMR_BENCHMARK_GENERATOR
+#define __NMR_BENCHMARK_GENERATOR
+
+#include "lib3mf_implicit.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Lib3MFBenchmark {
+
+	// SplitMix64, so that the generated corpus does not depend on the standard library implementation
+	class CBenchmarkRandom {
+	private:
+		uint64_t m_nState;
+	public:
+		CBenchmarkRandom(uint64_t nSeed);
+		uint64_t next();
+		// Uniformly distributed in [dMin, dMax)
+		double nextDouble(double dMin, double dMax);
+		uint32_t nextIndex(uint32_t nCount);
+	};
+
+	enum eBenchmarkCorpus {
+		bcMesh = 0,
+		bcBeamLattice,
+		bcSliceStack,
+		bcMultiProperty,
+		bcProduction,
+		bcEncrypted,
+		bcVolumetric,
+		bcCount
+	};
+
+	typedef struct sBenchmarkModel {
+		Lib3MF::PModel m_pModel;
+		// Number of the dominant entities (triangles, beams, slice vertices, ...) of the model
+		uint64_t m_nItemCount;
+	} BENCHMARKMODEL;
+
+	class CBenchmarkGenerator {
+	private:
+		Lib3MF::PWrapper m_pWrapper;
+		double m_dScale;
+		uint64_t m_nSeed;
+
+		uint32_t scaled(uint32_t nBaseCount) const;
+		Lib3MF::PModel createModel(CBenchmarkRandom & Random);
+		std::string createUUID(CBenchmarkRandom & Random);
+		// Closed torus with nRings * nSegments * 2 triangles and randomly displaced vertices
+		Lib3MF::PMeshObject addTorus(Lib3MF::PModel pModel, CBenchmarkRandom & Random, uint32_t nRings, uint32_t nSegments, double dRadius);
+
+		BENCHMARKMODEL createMeshModel(CBenchmarkRandom & Random);
+		BENCHMARKMODEL createBeamLatticeModel(CBenchmarkRandom & Random);
+		BENCHMARKMODEL createSliceStackModel(CBenchmarkRandom & Random);
+		BENCHMARKMODEL createMultiPropertyModel(CBenchmarkRandom & Random);
+		BENCHMARKMODEL createProductionModel(CBenchmarkRandom & Random);
+		BENCHMARKMODEL createEncryptedModel(CBenchmarkRandom & Random);
+		BENCHMARKMODEL createVolumetricModel(CBenchmarkRandom & Random);
+
+	public:
+		CBenchmarkGenerator(Lib3MF::PWrapper pWrapper, double dScale, uint64_t nSeed);
+
+		BENCHMARKMODEL create(eBenchmarkCorpus eCorpus);
+
+		static std::string getCorpusName(eBenchmarkCorpus eCorpus);
+
+		// Registers the (pass-through) encryption callbacks that the encrypted corpus needs
+		static void registerEncryption(Lib3MF::PWriter pWriter);
+		static void registerEncryption(Lib3MF::PReader pReader);
+
+		static void writeToBuffer(Lib3MF::PModel pModel, std::vector<Lib3MF_uint8> & Buffer);
+		static Lib3MF::PModel readFromBuffer(Lib3MF::PWrapper pWrapper, const std::vector<Lib3MF_uint8> & Buffer);
+
+		// Writes all corpora into sDirectory as <name>.3mf
+		void writeCorpus(const std::string & sDirectory);
+	};
+
+}
+
+#endif // __NMR_BENCHMARK_GENERATOR
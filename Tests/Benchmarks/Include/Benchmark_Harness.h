@@ -0,0 +1,115 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Harness.h: A small harness that times benchmark functions over a
+number of repetitions and reports the results as JSON document, so that runs
+of different releases can be compared.
+
+--*/
+
+#ifndef __NMR_BENCHMARK_HARNESS
+#define __NMR_BENCHMARK_HARNESS
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Lib3MFBenchmark {
+
+	// Is handed to a benchmark function once per repetition. Everything outside of measure is not timed.
+	class CBenchmarkRun {
+	private:
+		double m_dSeconds;
+		uint64_t m_nBytes;
+		uint64_t m_nItems;
+		bool m_bMeasured;
+
+	public:
+		CBenchmarkRun();
+
+		template <typename F>
+		void measure(F fnBody)
+		{
+			auto StartTime = std::chrono::steady_clock::now();
+			fnBody();
+			m_dSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+			m_bMeasured = true;
+		}
+
+		// Bytes and items processed by one repetition, used for the throughput columns
+		void setBytesProcessed(uint64_t nBytes);
+		void setItemsProcessed(uint64_t nItems);
+
+		double getSeconds() const;
+		uint64_t getBytesProcessed() const;
+		uint64_t getItemsProcessed() const;
+		bool wasMeasured() const;
+	};
+
+	typedef std::function<void(CBenchmarkRun & Run)> BenchmarkFunction;
+
+	typedef struct sBenchmarkResult {
+		std::string m_sName;
+		uint32_t m_nRepetitions;
+		double m_dMinSeconds;
+		double m_dMedianSeconds;
+		double m_dMeanSeconds;
+		uint64_t m_nBytes;
+		uint64_t m_nItems;
+	} BENCHMARKRESULT;
+
+	class CBenchmarkHarness {
+	private:
+		std::vector<std::pair<std::string, BenchmarkFunction>> m_Benchmarks;
+		std::vector<BENCHMARKRESULT> m_Results;
+		std::map<std::string, std::string> m_Context;
+
+	public:
+		void registerBenchmark(const std::string & sName, BenchmarkFunction fnBenchmark);
+
+		// Context entries (library version, scale, ...) are written into the JSON header
+		void setContext(const std::string & sKey, const std::string & sValue);
+
+		// Runs all benchmarks whose name contains sFilter. Progress is printed to stdout.
+		void run(const std::string & sFilter, uint32_t nRepetitions);
+
+		const std::vector<BENCHMARKRESULT> & getResults() const;
+
+		std::string toJSON() const;
+
+		// Compares the median times against a JSON document of an earlier run. Prints a table and
+		// returns the number of benchmarks that got slower by more than dThresholdPercent.
+		uint32_t compareTo(const std::string & sBaselineJSON, double dThresholdPercent) const;
+	};
+
+}
+
+#endif // __NMR_BENCHMARK_HARNESS
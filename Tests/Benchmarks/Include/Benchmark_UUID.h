@@ -26,42 +26,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 Abstract:
 
---*/
-
-#include "Model/Reader/Slice1507/NMR_ModelReader_Slice1507_Vertex.h"
-#include "Common/NMR_StringUtils.h"
-#include "Model/Classes/NMR_ModelConstants.h"
-
-namespace NMR {
-	void CModelReaderNode_Slices1507_Vertex::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue) {
-		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_SLICEVERTEX_X) == 0) {
-			m_x = fnStringToFloat(pAttributeValue);
-		}
-		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_SLICEVERTEX_Y) == 0) {
-			m_y = fnStringToFloat(pAttributeValue);
-		}
-		else
-			throw CNMRException(NMR_ERROR_SLICE_INVALIDATTRIBUTE);
-	}
+Benchmark_UUID.h: Benchmarks of the internal UUID generator, which is compiled
+directly into the benchmark executable as it is not part of the public API.
 
-	void CModelReaderNode_Slices1507_Vertex::OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader) {
-
-	}
+--*/
 
-	CModelReaderNode_Slices1507_Vertex::CModelReaderNode_Slices1507_Vertex(_In_ CSlice *pSlice, _In_ PModelWarnings pWarnings) : CModelReaderNode(pWarnings) {
-		m_pSlice = pSlice;
-	}
+#ifndef __NMR_BENCHMARK_UUID
+#define __NMR_BENCHMARK_UUID
 
-	void CModelReaderNode_Slices1507_Vertex::parseXML(_In_ CXmlReader * pXMLReader) {
-		// Parse name
-		parseName(pXMLReader);
+#include "Benchmark_Harness.h"
 
-		// Parse attribute
-		parseAttributes(pXMLReader);
+namespace Lib3MFBenchmark {
 
-		// Parse Content
-		parseContent(pXMLReader);
+	void registerUUIDBenchmarks(CBenchmarkHarness & Harness, double dScale);
 
-		m_pSlice->addVertex(m_x, m_y);
-	}
 }
+
+#endif // __NMR_BENCHMARK_UUID
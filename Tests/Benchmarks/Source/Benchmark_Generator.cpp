@@ -0,0 +1,554 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Generator.cpp: Implements the deterministic generator of the
+benchmark corpus
+
+--*/
+
+#include "Benchmark_Generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+#define BENCHMARK_CONSUMERID "LIB3MF#BENCHMARK"
+#define BENCHMARK_TEXTURE_RELATIONSHIP "http://schemas.microsoft.com/3dmanufacturing/2013/01/3dtexture"
+
+using namespace Lib3MF;
+
+namespace Lib3MFBenchmark {
+
+	static const double s_dPi = 3.14159265358979323846;
+
+	// The encrypted corpus measures the package overhead of the secure content extension,
+	// so content and keys are passed through unchanged instead of running a real cipher.
+	static void fnPassThroughContentCallback(Lib3MF_ContentEncryptionParams pParams, Lib3MF_uint64 nInputSize, const Lib3MF_uint8 * pInputBuffer,
+		const Lib3MF_uint64 nOutputSize, Lib3MF_uint64 * pOutputNeeded, Lib3MF_uint8 * pOutputBuffer, Lib3MF_pvoid pUserData, Lib3MF_uint64 * pStatus)
+	{
+		if ((nInputSize == 0) || (pInputBuffer == nullptr)) {
+			// Finalization, the authentication tag is always accepted
+			*pStatus = 1;
+		}
+		else if ((nOutputSize == 0) || (pOutputBuffer == nullptr)) {
+			*pOutputNeeded = nInputSize;
+			*pStatus = nInputSize;
+		}
+		else {
+			std::copy(pInputBuffer, pInputBuffer + nOutputSize, pOutputBuffer);
+			*pStatus = nOutputSize;
+		}
+	}
+
+	static void fnPassThroughKeyCallback(Lib3MF_AccessRight pAccessRight, Lib3MF_uint64 nInputSize, const Lib3MF_uint8 * pInputBuffer,
+		const Lib3MF_uint64 nOutputSize, Lib3MF_uint64 * pOutputNeeded, Lib3MF_uint8 * pOutputBuffer, Lib3MF_pvoid pUserData, Lib3MF_uint64 * pStatus)
+	{
+		if ((nOutputSize == 0) || (pOutputBuffer == nullptr)) {
+			*pOutputNeeded = nInputSize;
+			*pStatus = nInputSize;
+		}
+		else {
+			std::copy(pInputBuffer, pInputBuffer + nOutputSize, pOutputBuffer);
+			*pStatus = nOutputSize;
+		}
+	}
+
+	static void fnDeterministicRandomCallback(Lib3MF_uint64 nByteData, Lib3MF_uint64 nNumBytes, Lib3MF_pvoid pUserData, Lib3MF_uint64 * pBytesWritten)
+	{
+		CBenchmarkRandom * pRandom = (CBenchmarkRandom *)pUserData;
+		Lib3MF_uint8 * pBuffer = (Lib3MF_uint8 *)nByteData;
+		for (Lib3MF_uint64 nIndex = 0; nIndex < nNumBytes; nIndex++)
+			pBuffer[nIndex] = (Lib3MF_uint8)(pRandom->next() & 0xFF);
+		*pBytesWritten = nNumBytes;
+	}
+
+	CBenchmarkRandom::CBenchmarkRandom(uint64_t nSeed)
+		: m_nState(nSeed)
+	{
+	}
+
+	uint64_t CBenchmarkRandom::next()
+	{
+		uint64_t nValue = (m_nState += 0x9E3779B97F4A7C15ULL);
+		nValue = (nValue ^ (nValue >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		nValue = (nValue ^ (nValue >> 27)) * 0x94D049BB133111EBULL;
+		return nValue ^ (nValue >> 31);
+	}
+
+	double CBenchmarkRandom::nextDouble(double dMin, double dMax)
+	{
+		return dMin + (dMax - dMin) * ((next() >> 11) * (1.0 / 9007199254740992.0));
+	}
+
+	uint32_t CBenchmarkRandom::nextIndex(uint32_t nCount)
+	{
+		return (uint32_t)(next() % nCount);
+	}
+
+	CBenchmarkGenerator::CBenchmarkGenerator(PWrapper pWrapper, double dScale, uint64_t nSeed)
+		: m_pWrapper(pWrapper), m_dScale(dScale), m_nSeed(nSeed)
+	{
+		if (!m_pWrapper)
+			throw std::runtime_error("invalid wrapper");
+		if (m_dScale <= 0.0)
+			throw std::runtime_error("invalid scale");
+	}
+
+	uint32_t CBenchmarkGenerator::scaled(uint32_t nBaseCount) const
+	{
+		return std::max<uint32_t>(1, (uint32_t)std::lround(nBaseCount * m_dScale));
+	}
+
+	PModel CBenchmarkGenerator::createModel(CBenchmarkRandom & Random)
+	{
+		PModel pModel = m_pWrapper->CreateModel();
+		pModel->SetBuildUUID(createUUID(Random));
+		return pModel;
+	}
+
+	std::string CBenchmarkGenerator::createUUID(CBenchmarkRandom & Random)
+	{
+		uint64_t nHigh = (Random.next() & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
+		uint64_t nLow = (Random.next() & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
+
+		char szUUID[40];
+		snprintf(szUUID, sizeof(szUUID), "%08x-%04x-%04x-%04x-%012llx",
+			(uint32_t)(nHigh >> 32), (uint32_t)((nHigh >> 16) & 0xFFFF), (uint32_t)(nHigh & 0xFFFF),
+			(uint32_t)(nLow >> 48), (unsigned long long)(nLow & 0xFFFFFFFFFFFFULL));
+		return szUUID;
+	}
+
+	PMeshObject CBenchmarkGenerator::addTorus(PModel pModel, CBenchmarkRandom & Random, uint32_t nRings, uint32_t nSegments, double dRadius)
+	{
+		nRings = std::max<uint32_t>(nRings, 3);
+		nSegments = std::max<uint32_t>(nSegments, 3);
+		double dTubeRadius = dRadius * 0.35;
+
+		std::vector<sPosition> Vertices;
+		Vertices.reserve((size_t)nRings * nSegments);
+		for (uint32_t nRing = 0; nRing < nRings; nRing++) {
+			double dU = 2.0 * s_dPi * nRing / nRings;
+			for (uint32_t nSegment = 0; nSegment < nSegments; nSegment++) {
+				double dV = 2.0 * s_dPi * nSegment / nSegments;
+				double dTube = dTubeRadius * (1.0 + Random.nextDouble(-0.02, 0.02));
+				sPosition Position;
+				Position.m_Coordinates[0] = (Lib3MF_single)(dRadius + dTubeRadius + (dRadius + dTube * cos(dV)) * cos(dU));
+				Position.m_Coordinates[1] = (Lib3MF_single)(dRadius + dTubeRadius + (dRadius + dTube * cos(dV)) * sin(dU));
+				Position.m_Coordinates[2] = (Lib3MF_single)(dTubeRadius + dTube * sin(dV));
+				Vertices.push_back(Position);
+			}
+		}
+
+		std::vector<sTriangle> Triangles;
+		Triangles.reserve((size_t)nRings * nSegments * 2);
+		for (uint32_t nRing = 0; nRing < nRings; nRing++) {
+			uint32_t nNextRing = (nRing + 1) % nRings;
+			for (uint32_t nSegment = 0; nSegment < nSegments; nSegment++) {
+				uint32_t nNextSegment = (nSegment + 1) % nSegments;
+				uint32_t nA = nRing * nSegments + nSegment;
+				uint32_t nB = nNextRing * nSegments + nSegment;
+				uint32_t nC = nNextRing * nSegments + nNextSegment;
+				uint32_t nD = nRing * nSegments + nNextSegment;
+				Triangles.push_back({ { nA, nB, nC } });
+				Triangles.push_back({ { nA, nC, nD } });
+			}
+		}
+
+		PMeshObject pMeshObject = pModel->AddMeshObject();
+		pMeshObject->SetGeometry(Vertices, Triangles);
+		pMeshObject->SetUUID(createUUID(Random));
+		return pMeshObject;
+	}
+
+	static sTransform fnTranslation(double dX, double dY, double dZ)
+	{
+		sTransform Transform;
+		for (int nRow = 0; nRow < 4; nRow++)
+			for (int nColumn = 0; nColumn < 3; nColumn++)
+				Transform.m_Fields[nRow][nColumn] = (nRow == nColumn) ? 1.0f : 0.0f;
+		Transform.m_Fields[3][0] = (Lib3MF_single)dX;
+		Transform.m_Fields[3][1] = (Lib3MF_single)dY;
+		Transform.m_Fields[3][2] = (Lib3MF_single)dZ;
+		return Transform;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createMeshModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nSide = std::max<uint32_t>(3, (uint32_t)std::lround(512 * sqrt(m_dScale)));
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		PMeshObject pMeshObject = addTorus(Result.m_pModel, Random, nSide, nSide, 100.0);
+		Result.m_pModel->AddBuildItem(pMeshObject.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		Result.m_nItemCount = pMeshObject->GetTriangleCount();
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createBeamLatticeModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nSide = std::max<uint32_t>(2, (uint32_t)std::lround(40 * cbrt(m_dScale)));
+		double dSpacing = 2.0;
+
+		// A cubic grid of nodes, connected along the three axes
+		std::vector<sPosition> Vertices;
+		for (uint32_t nZ = 0; nZ < nSide; nZ++)
+			for (uint32_t nY = 0; nY < nSide; nY++)
+				for (uint32_t nX = 0; nX < nSide; nX++) {
+					sPosition Position;
+					Position.m_Coordinates[0] = (Lib3MF_single)(nX * dSpacing + Random.nextDouble(-0.2, 0.2));
+					Position.m_Coordinates[1] = (Lib3MF_single)(nY * dSpacing + Random.nextDouble(-0.2, 0.2));
+					Position.m_Coordinates[2] = (Lib3MF_single)(nZ * dSpacing + Random.nextDouble(-0.2, 0.2));
+					Vertices.push_back(Position);
+				}
+
+		std::vector<sBeam> Beams;
+		auto fnIndex = [nSide](uint32_t nX, uint32_t nY, uint32_t nZ) { return (nZ * nSide + nY) * nSide + nX; };
+		auto fnAddBeam = [&Beams, &Random](uint32_t nIndex1, uint32_t nIndex2) {
+			sBeam Beam;
+			Beam.m_Indices[0] = nIndex1;
+			Beam.m_Indices[1] = nIndex2;
+			Beam.m_Radii[0] = Random.nextDouble(0.2, 0.5);
+			Beam.m_Radii[1] = Random.nextDouble(0.2, 0.5);
+			Beam.m_CapModes[0] = eBeamLatticeCapMode::Sphere;
+			Beam.m_CapModes[1] = eBeamLatticeCapMode::Sphere;
+			Beams.push_back(Beam);
+		};
+		for (uint32_t nZ = 0; nZ < nSide; nZ++)
+			for (uint32_t nY = 0; nY < nSide; nY++)
+				for (uint32_t nX = 0; nX < nSide; nX++) {
+					if (nX + 1 < nSide)
+						fnAddBeam(fnIndex(nX, nY, nZ), fnIndex(nX + 1, nY, nZ));
+					if (nY + 1 < nSide)
+						fnAddBeam(fnIndex(nX, nY, nZ), fnIndex(nX, nY + 1, nZ));
+					if (nZ + 1 < nSide)
+						fnAddBeam(fnIndex(nX, nY, nZ), fnIndex(nX, nY, nZ + 1));
+				}
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		PMeshObject pMeshObject = Result.m_pModel->AddMeshObject();
+		pMeshObject->SetGeometry(Vertices, std::vector<sTriangle>());
+		pMeshObject->SetUUID(createUUID(Random));
+
+		PBeamLattice pBeamLattice = pMeshObject->BeamLattice();
+		pBeamLattice->SetMinLength(0.0001);
+		pBeamLattice->SetBeams(Beams);
+
+		Result.m_pModel->AddBuildItem(pMeshObject.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		Result.m_nItemCount = Beams.size();
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createSliceStackModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nSliceCount = scaled(1000);
+		uint32_t nPolygonVertexCount = 400;
+		double dLayerHeight = 0.05;
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		Result.m_nItemCount = 0;
+
+		PSliceStack pSliceStack = Result.m_pModel->AddSliceStack(0.0);
+		std::vector<sPosition2D> Vertices(nPolygonVertexCount);
+		std::vector<Lib3MF_uint32> Indices(nPolygonVertexCount + 1);
+		for (uint32_t nSlice = 0; nSlice < nSliceCount; nSlice++) {
+			// A closed, wobbly outline whose shape changes from layer to layer
+			double dPhase = Random.nextDouble(0.0, 2.0 * s_dPi);
+			for (uint32_t nVertex = 0; nVertex < nPolygonVertexCount; nVertex++) {
+				double dAngle = 2.0 * s_dPi * nVertex / nPolygonVertexCount;
+				double dRadius = 40.0 + 5.0 * sin(7.0 * dAngle + dPhase) + Random.nextDouble(-0.1, 0.1);
+				Vertices[nVertex].m_Coordinates[0] = (Lib3MF_single)(50.0 + dRadius * cos(dAngle));
+				Vertices[nVertex].m_Coordinates[1] = (Lib3MF_single)(50.0 + dRadius * sin(dAngle));
+				Indices[nVertex] = nVertex;
+			}
+			Indices[nPolygonVertexCount] = 0;
+
+			PSlice pSlice = pSliceStack->AddSlice((nSlice + 1) * dLayerHeight);
+			pSlice->SetVertices(Vertices);
+			pSlice->AddPolygon(Indices);
+			Result.m_nItemCount += nPolygonVertexCount;
+		}
+
+		PMeshObject pMeshObject = addTorus(Result.m_pModel, Random, 16, 16, 40.0);
+		pMeshObject->AssignSliceStack(pSliceStack.get());
+		pMeshObject->SetSlicesMeshResolution(eSlicesMeshResolution::Lowres);
+		Result.m_pModel->AddBuildItem(pMeshObject.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createMultiPropertyModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nSide = std::max<uint32_t>(3, (uint32_t)std::lround(256 * sqrt(m_dScale)));
+		uint32_t nColorCount = 4096;
+		uint32_t nTex2CoordCount = 4096;
+		uint32_t nMultiPropertyCount = 4096;
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		PModel pModel = Result.m_pModel;
+
+		PColorGroup pColorGroup = pModel->AddColorGroup();
+		std::vector<Lib3MF_uint32> ColorIDs;
+		for (uint32_t nIndex = 0; nIndex < nColorCount; nIndex++) {
+			sColor Color;
+			Color.m_Red = (Lib3MF_uint8)Random.nextIndex(256);
+			Color.m_Green = (Lib3MF_uint8)Random.nextIndex(256);
+			Color.m_Blue = (Lib3MF_uint8)Random.nextIndex(256);
+			Color.m_Alpha = 255;
+			ColorIDs.push_back(pColorGroup->AddColor(Color));
+		}
+
+		// The texture payload is opaque to the library, so random bytes behind a PNG signature suffice
+		std::vector<Lib3MF_uint8> TextureData(256 * 1024);
+		for (auto & nByte : TextureData)
+			nByte = (Lib3MF_uint8)(Random.next() & 0xFF);
+		const Lib3MF_uint8 PNGSignature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+		std::copy(PNGSignature, PNGSignature + 8, TextureData.begin());
+
+		PAttachment pTextureAttachment = pModel->AddAttachment("/3D/Textures/benchmark.png", BENCHMARK_TEXTURE_RELATIONSHIP);
+		pTextureAttachment->ReadFromBuffer(TextureData);
+		PTexture2D pTexture = pModel->AddTexture2DFromAttachment(pTextureAttachment.get());
+		pTexture->SetContentType(eTextureType::PNG);
+
+		PTexture2DGroup pTexture2DGroup = pModel->AddTexture2DGroup(pTexture.get());
+		std::vector<Lib3MF_uint32> Tex2CoordIDs;
+		for (uint32_t nIndex = 0; nIndex < nTex2CoordCount; nIndex++) {
+			sTex2Coord Coordinate;
+			Coordinate.m_U = Random.nextDouble(0.0, 1.0);
+			Coordinate.m_V = Random.nextDouble(0.0, 1.0);
+			Tex2CoordIDs.push_back(pTexture2DGroup->AddTex2Coord(Coordinate));
+		}
+
+		PMultiPropertyGroup pMultiPropertyGroup = pModel->AddMultiPropertyGroup();
+		pMultiPropertyGroup->AddLayer({ pTexture2DGroup->GetUniqueResourceID(), eBlendMethod::Mix });
+		pMultiPropertyGroup->AddLayer({ pColorGroup->GetUniqueResourceID(), eBlendMethod::Multiply });
+		std::vector<Lib3MF_uint32> MultiPropertyIDs;
+		for (uint32_t nIndex = 0; nIndex < nMultiPropertyCount; nIndex++) {
+			std::vector<Lib3MF_uint32> PropertyIDs = { Tex2CoordIDs[Random.nextIndex(nTex2CoordCount)], ColorIDs[Random.nextIndex(nColorCount)] };
+			MultiPropertyIDs.push_back(pMultiPropertyGroup->AddMultiProperty(PropertyIDs));
+		}
+
+		PMeshObject pMeshObject = addTorus(pModel, Random, nSide, nSide, 100.0);
+		std::vector<sTriangleProperties> Properties(pMeshObject->GetTriangleCount());
+		for (auto & Property : Properties) {
+			Property.m_ResourceID = pMultiPropertyGroup->GetUniqueResourceID();
+			for (int nCorner = 0; nCorner < 3; nCorner++)
+				Property.m_PropertyIDs[nCorner] = MultiPropertyIDs[Random.nextIndex(nMultiPropertyCount)];
+		}
+		pMeshObject->SetAllTriangleProperties(Properties);
+		pMeshObject->SetObjectLevelProperty(pMultiPropertyGroup->GetUniqueResourceID(), MultiPropertyIDs[0]);
+
+		pModel->AddBuildItem(pMeshObject.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		Result.m_nItemCount = pMeshObject->GetTriangleCount();
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createProductionModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nPartCount = scaled(64);
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		Result.m_nItemCount = 0;
+		PModel pModel = Result.m_pModel;
+
+		// Every part holds one mesh, the root model assembles them in a components object
+		PComponentsObject pAssembly = pModel->AddComponentsObject();
+		pAssembly->SetUUID(createUUID(Random));
+		for (uint32_t nPart = 0; nPart < nPartCount; nPart++) {
+			char szPath[64];
+			snprintf(szPath, sizeof(szPath), "/3D/part_%04u.model", nPart);
+
+			PMeshObject pMeshObject = addTorus(pModel, Random, 64, 160, 10.0);
+			pMeshObject->SetPackagePart(pModel->FindOrCreatePackagePart(szPath).get());
+			Result.m_nItemCount += pMeshObject->GetTriangleCount();
+
+			PComponent pComponent = pAssembly->AddComponent(pMeshObject.get(), fnTranslation(30.0 * (nPart % 8), 30.0 * ((nPart / 8) % 8), 10.0 * (nPart / 64)));
+			pComponent->SetUUID(createUUID(Random));
+		}
+
+		pModel->AddBuildItem(pAssembly.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createEncryptedModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nPartCount = scaled(16);
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		Result.m_nItemCount = 0;
+		PModel pModel = Result.m_pModel;
+
+		// Keys and IVs are drawn from this callback, so its state has to outlive the model
+		static CBenchmarkRandom s_KeyRandom(0);
+		s_KeyRandom = CBenchmarkRandom(m_nSeed ^ 0x5EC0E7ULL);
+		pModel->SetRandomNumberCallback(fnDeterministicRandomCallback, &s_KeyRandom);
+
+		PKeyStore pKeyStore = pModel->GetKeyStore();
+		pKeyStore->SetUUID(createUUID(Random));
+		PConsumer pConsumer = pKeyStore->AddConsumer(BENCHMARK_CONSUMERID, "benchmarkKey", "");
+		PResourceDataGroup pDataGroup = pKeyStore->AddResourceDataGroup();
+		pDataGroup->AddAccessRight(pConsumer.get(), eWrappingAlgorithm::RSA_OAEP, eMgfAlgorithm::MGF1_SHA1, eDigestMethod::SHA1);
+
+		PComponentsObject pAssembly = pModel->AddComponentsObject();
+		pAssembly->SetUUID(createUUID(Random));
+		std::vector<Lib3MF_uint8> AdditionalData = { 'l', 'i', 'b', '3', 'm', 'f' };
+		for (uint32_t nPart = 0; nPart < nPartCount; nPart++) {
+			char szPath[64];
+			snprintf(szPath, sizeof(szPath), "/3D/secure_%04u.model", nPart);
+
+			PPackagePart pPart = pModel->FindOrCreatePackagePart(szPath);
+			PMeshObject pMeshObject = addTorus(pModel, Random, 64, 160, 10.0);
+			pMeshObject->SetPackagePart(pPart.get());
+			pKeyStore->AddResourceData(pDataGroup.get(), pPart.get(), eEncryptionAlgorithm::AES256_GCM, eCompression::Deflate, AdditionalData);
+			Result.m_nItemCount += pMeshObject->GetTriangleCount();
+
+			PComponent pComponent = pAssembly->AddComponent(pMeshObject.get(), fnTranslation(30.0 * (nPart % 8), 30.0 * (nPart / 8), 0.0));
+			pComponent->SetUUID(createUUID(Random));
+		}
+
+		pModel->AddBuildItem(pAssembly.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::createVolumetricModel(CBenchmarkRandom & Random)
+	{
+		uint32_t nSheetCount = scaled(64);
+		uint32_t nColumnCount = 256;
+		uint32_t nRowCount = 256;
+
+		BENCHMARKMODEL Result;
+		Result.m_pModel = createModel(Random);
+		PModel pModel = Result.m_pModel;
+
+		PImageStack pImageStack = pModel->AddImageStack(nColumnCount, nRowCount, nSheetCount);
+		std::vector<Lib3MF_uint8> SheetData(nColumnCount * nRowCount);
+		const Lib3MF_uint8 PNGSignature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+		for (uint32_t nSheet = 0; nSheet < nSheetCount; nSheet++) {
+			for (auto & nByte : SheetData)
+				nByte = (Lib3MF_uint8)(Random.next() & 0xFF);
+			std::copy(PNGSignature, PNGSignature + 8, SheetData.begin());
+
+			char szPath[64];
+			snprintf(szPath, sizeof(szPath), "/volume/sheet_%04u.png", nSheet);
+			pImageStack->CreateSheetFromBuffer(nSheet, szPath, SheetData);
+		}
+
+		PFunctionFromImage3D pFunction = pModel->AddFunctionFromImage3D(pImageStack.get());
+		pFunction->SetTileStyles(eTextureTileStyle::Clamp, eTextureTileStyle::Clamp, eTextureTileStyle::Clamp);
+
+		PMeshObject pMeshObject = addTorus(pModel, Random, 64, 64, 50.0);
+		PVolumeData pVolumeData = pModel->AddVolumeData();
+		pMeshObject->SetVolumeData(pVolumeData);
+		PVolumeDataProperty pProperty = pVolumeData->AddPropertyFromFunction("density", pFunction.get());
+		pProperty->SetChannelName("R");
+
+		pModel->AddBuildItem(pMeshObject.get(), fnTranslation(0.0, 0.0, 0.0))->SetUUID(createUUID(Random));
+		Result.m_nItemCount = (uint64_t)nSheetCount * nColumnCount * nRowCount;
+		return Result;
+	}
+
+	BENCHMARKMODEL CBenchmarkGenerator::create(eBenchmarkCorpus eCorpus)
+	{
+		// Every corpus has its own random stream, so it does not depend on what was generated before
+		CBenchmarkRandom Random(m_nSeed * 0x100000001B3ULL + (uint64_t)eCorpus);
+
+		switch (eCorpus) {
+			case bcMesh: return createMeshModel(Random);
+			case bcBeamLattice: return createBeamLatticeModel(Random);
+			case bcSliceStack: return createSliceStackModel(Random);
+			case bcMultiProperty: return createMultiPropertyModel(Random);
+			case bcProduction: return createProductionModel(Random);
+			case bcEncrypted: return createEncryptedModel(Random);
+			case bcVolumetric: return createVolumetricModel(Random);
+			default:
+				throw std::runtime_error("invalid corpus");
+		}
+	}
+
+	std::string CBenchmarkGenerator::getCorpusName(eBenchmarkCorpus eCorpus)
+	{
+		switch (eCorpus) {
+			case bcMesh: return "mesh";
+			case bcBeamLattice: return "beamlattice";
+			case bcSliceStack: return "slicestack";
+			case bcMultiProperty: return "multiproperty";
+			case bcProduction: return "production";
+			case bcEncrypted: return "encrypted";
+			case bcVolumetric: return "volumetric";
+			default:
+				throw std::runtime_error("invalid corpus");
+		}
+	}
+
+	void CBenchmarkGenerator::registerEncryption(PWriter pWriter)
+	{
+		pWriter->SetContentEncryptionCallback(fnPassThroughContentCallback, nullptr);
+		pWriter->AddKeyWrappingCallback(BENCHMARK_CONSUMERID, fnPassThroughKeyCallback, nullptr);
+	}
+
+	void CBenchmarkGenerator::registerEncryption(PReader pReader)
+	{
+		pReader->SetContentEncryptionCallback(fnPassThroughContentCallback, nullptr);
+		pReader->AddKeyWrappingCallback(BENCHMARK_CONSUMERID, fnPassThroughKeyCallback, nullptr);
+	}
+
+	void CBenchmarkGenerator::writeToBuffer(PModel pModel, std::vector<Lib3MF_uint8> & Buffer)
+	{
+		PWriter pWriter = pModel->QueryWriter("3mf");
+		registerEncryption(pWriter);
+		pWriter->WriteToBuffer(Buffer);
+	}
+
+	PModel CBenchmarkGenerator::readFromBuffer(PWrapper pWrapper, const std::vector<Lib3MF_uint8> & Buffer)
+	{
+		PModel pModel = pWrapper->CreateModel();
+		PReader pReader = pModel->QueryReader("3mf");
+		registerEncryption(pReader);
+		pReader->ReadFromBuffer(Buffer);
+		return pModel;
+	}
+
+	void CBenchmarkGenerator::writeCorpus(const std::string & sDirectory)
+	{
+		for (int nCorpus = 0; nCorpus < bcCount; nCorpus++) {
+			eBenchmarkCorpus eCorpus = (eBenchmarkCorpus)nCorpus;
+			std::string sFileName = sDirectory + "/" + getCorpusName(eCorpus) + ".3mf";
+
+			BENCHMARKMODEL Model = create(eCorpus);
+			PWriter pWriter = Model.m_pModel->QueryWriter("3mf");
+			registerEncryption(pWriter);
+			pWriter->WriteToFile(sFileName);
+			printf("%s\n", sFileName.c_str());
+		}
+	}
+
+}
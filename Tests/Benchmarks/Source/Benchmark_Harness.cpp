@@ -0,0 +1,231 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmark_Harness.cpp: Implements the benchmark harness
+
+--*/
+
+#include "Benchmark_Harness.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+namespace Lib3MFBenchmark {
+
+	static void fnWriteJSONString(std::ostringstream & Stream, const std::string & sValue)
+	{
+		Stream << '"';
+		for (char cChar : sValue) {
+			if ((cChar == '"') || (cChar == '\\'))
+				Stream << '\\' << cChar;
+			else if ((unsigned char)cChar < 0x20)
+				Stream << ' ';
+			else
+				Stream << cChar;
+		}
+		Stream << '"';
+	}
+
+	CBenchmarkRun::CBenchmarkRun()
+		: m_dSeconds(0.0), m_nBytes(0), m_nItems(0), m_bMeasured(false)
+	{
+	}
+
+	void CBenchmarkRun::setBytesProcessed(uint64_t nBytes)
+	{
+		m_nBytes = nBytes;
+	}
+
+	void CBenchmarkRun::setItemsProcessed(uint64_t nItems)
+	{
+		m_nItems = nItems;
+	}
+
+	double CBenchmarkRun::getSeconds() const
+	{
+		return m_dSeconds;
+	}
+
+	uint64_t CBenchmarkRun::getBytesProcessed() const
+	{
+		return m_nBytes;
+	}
+
+	uint64_t CBenchmarkRun::getItemsProcessed() const
+	{
+		return m_nItems;
+	}
+
+	bool CBenchmarkRun::wasMeasured() const
+	{
+		return m_bMeasured;
+	}
+
+	void CBenchmarkHarness::registerBenchmark(const std::string & sName, BenchmarkFunction fnBenchmark)
+	{
+		m_Benchmarks.push_back(std::make_pair(sName, fnBenchmark));
+	}
+
+	void CBenchmarkHarness::setContext(const std::string & sKey, const std::string & sValue)
+	{
+		m_Context[sKey] = sValue;
+	}
+
+	void CBenchmarkHarness::run(const std::string & sFilter, uint32_t nRepetitions)
+	{
+		if (nRepetitions == 0)
+			nRepetitions = 1;
+
+		for (auto & Benchmark : m_Benchmarks) {
+			if (Benchmark.first.find(sFilter) == std::string::npos)
+				continue;
+
+			std::vector<double> Seconds;
+			BENCHMARKRESULT Result;
+			Result.m_sName = Benchmark.first;
+			Result.m_nBytes = 0;
+			Result.m_nItems = 0;
+
+			for (uint32_t nRepetition = 0; nRepetition < nRepetitions; nRepetition++) {
+				CBenchmarkRun Run;
+				Benchmark.second(Run);
+				if (!Run.wasMeasured())
+					break;
+
+				Seconds.push_back(Run.getSeconds());
+				Result.m_nBytes = Run.getBytesProcessed();
+				Result.m_nItems = Run.getItemsProcessed();
+			}
+
+			if (Seconds.empty())
+				continue;
+
+			std::sort(Seconds.begin(), Seconds.end());
+			double dSum = 0.0;
+			for (double dSeconds : Seconds)
+				dSum += dSeconds;
+
+			Result.m_nRepetitions = (uint32_t)Seconds.size();
+			Result.m_dMinSeconds = Seconds.front();
+			Result.m_dMedianSeconds = Seconds[Seconds.size() / 2];
+			Result.m_dMeanSeconds = dSum / Seconds.size();
+			m_Results.push_back(Result);
+
+			printf("%-40s %10.4f s", Result.m_sName.c_str(), Result.m_dMedianSeconds);
+			if ((Result.m_nBytes > 0) && (Result.m_dMedianSeconds > 0.0))
+				printf(" %10.2f MB/s", Result.m_nBytes / Result.m_dMedianSeconds / (1024.0 * 1024.0));
+			if ((Result.m_nItems > 0) && (Result.m_dMedianSeconds > 0.0))
+				printf(" %14.0f items/s", Result.m_nItems / Result.m_dMedianSeconds);
+			printf("\n");
+			fflush(stdout);
+		}
+	}
+
+	const std::vector<BENCHMARKRESULT> & CBenchmarkHarness::getResults() const
+	{
+		return m_Results;
+	}
+
+	std::string CBenchmarkHarness::toJSON() const
+	{
+		std::ostringstream Stream;
+		Stream.precision(9);
+
+		Stream << "{\n  \"context\": {";
+		bool bFirst = true;
+		for (auto & Entry : m_Context) {
+			Stream << (bFirst ? "\n    " : ",\n    ");
+			fnWriteJSONString(Stream, Entry.first);
+			Stream << ": ";
+			fnWriteJSONString(Stream, Entry.second);
+			bFirst = false;
+		}
+		Stream << "\n  },\n  \"benchmarks\": [";
+
+		bFirst = true;
+		for (auto & Result : m_Results) {
+			Stream << (bFirst ? "\n    {" : ",\n    {");
+			Stream << "\"name\": ";
+			fnWriteJSONString(Stream, Result.m_sName);
+			Stream << ", \"repetitions\": " << Result.m_nRepetitions;
+			Stream << ", \"min_s\": " << Result.m_dMinSeconds;
+			Stream << ", \"median_s\": " << Result.m_dMedianSeconds;
+			Stream << ", \"mean_s\": " << Result.m_dMeanSeconds;
+			Stream << ", \"bytes\": " << Result.m_nBytes;
+			Stream << ", \"items\": " << Result.m_nItems;
+			Stream << ", \"bytes_per_second\": " << ((Result.m_dMedianSeconds > 0.0) ? Result.m_nBytes / Result.m_dMedianSeconds : 0.0);
+			Stream << ", \"items_per_second\": " << ((Result.m_dMedianSeconds > 0.0) ? Result.m_nItems / Result.m_dMedianSeconds : 0.0);
+			Stream << "}";
+			bFirst = false;
+		}
+		Stream << "\n  ]\n}\n";
+
+		return Stream.str();
+	}
+
+	uint32_t CBenchmarkHarness::compareTo(const std::string & sBaselineJSON, double dThresholdPercent) const
+	{
+		// The baseline is a document written by toJSON, so a scan for name / median pairs suffices
+		std::map<std::string, double> Baseline;
+		const std::string sNameKey = "\"name\": \"";
+		const std::string sMedianKey = "\"median_s\": ";
+		size_t nPosition = sBaselineJSON.find(sNameKey);
+		while (nPosition != std::string::npos) {
+			size_t nNameStart = nPosition + sNameKey.length();
+			size_t nNameEnd = sBaselineJSON.find('"', nNameStart);
+			size_t nMedian = sBaselineJSON.find(sMedianKey, nNameStart);
+			if ((nNameEnd == std::string::npos) || (nMedian == std::string::npos))
+				break;
+
+			Baseline[sBaselineJSON.substr(nNameStart, nNameEnd - nNameStart)] = atof(sBaselineJSON.c_str() + nMedian + sMedianKey.length());
+			nPosition = sBaselineJSON.find(sNameKey, nMedian);
+		}
+
+		uint32_t nRegressions = 0;
+		printf("\n%-40s %12s %12s %9s\n", "benchmark", "baseline", "current", "change");
+		for (auto & Result : m_Results) {
+			auto iBaseline = Baseline.find(Result.m_sName);
+			if ((iBaseline == Baseline.end()) || (iBaseline->second <= 0.0)) {
+				printf("%-40s %12s %10.4f s %9s\n", Result.m_sName.c_str(), "-", Result.m_dMedianSeconds, "new");
+				continue;
+			}
+
+			double dChange = (Result.m_dMedianSeconds / iBaseline->second - 1.0) * 100.0;
+			bool bRegression = (dChange > dThresholdPercent);
+			if (bRegression)
+				nRegressions++;
+			printf("%-40s %10.4f s %10.4f s %+8.1f%%%s\n", Result.m_sName.c_str(), iBaseline->second, Result.m_dMedianSeconds, dChange, bRegression ? "  REGRESSION" : "");
+		}
+
+		return nRegressions;
+	}
+
+}
@@ -26,38 +26,41 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 Abstract:
 
-NMR_ModelReaderNode_slice1507_Segment.h covers the segments of the private 3MF slice extension.
+Benchmark_UUID.cpp: Implements the benchmarks of the internal UUID generator
 
 --*/
 
-#ifndef __NMR_MODELREADERNODE_SLICE1507_SEGMENT
-#define __NMR_MODELREADERNODE_SLICE1507_SEGMENT
+#include "Benchmark_UUID.h"
+#include "Common/NMR_UUID.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Lib3MFBenchmark {
+
+	void registerUUIDBenchmarks(CBenchmarkHarness & Harness, double dScale)
+	{
+		uint32_t nCount = std::max<uint32_t>(1, (uint32_t)std::lround(10000000 * dScale));
+
+		Harness.registerBenchmark("uuid/single", [nCount](CBenchmarkRun & Run) {
+			std::string sLast;
+			Run.measure([&]() {
+				for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+					NMR::CUUID UUID;
+					if (nIndex + 1 == nCount)
+						sLast = UUID.toString();
+				}
+			});
+			Run.setItemsProcessed(nCount);
+		});
+
+		Harness.registerBenchmark("uuid/bulk", [nCount](CBenchmarkRun & Run) {
+			std::vector<NMR::CUUID> UUIDs;
+			Run.measure([&]() {
+				NMR::CUUID::generate(nCount, UUIDs);
+			});
+			Run.setItemsProcessed(UUIDs.size());
+		});
+	}
 
-#include "Model/Reader/NMR_ModelReaderNode.h"
-#include "Model/Classes/NMR_ModelComponent.h"
-#include "Model/Classes/NMR_ModelComponentsObject.h"
-#include "Model/Classes/NMR_ModelObject.h"
-#include "Model/Classes/NMR_ModelConstants_Slices.h"
-
-namespace NMR {
-
-	class CModelReaderNode_Slices1507_Segment : public CModelReaderNode {
-	private:
-		CSlice *m_pSlice;
-		nfUint32 m_PolygonIndex;
-
-	protected:
-		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
-		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
-
-	public:
-		CModelReaderNode_Slices1507_Segment() = delete;
-		CModelReaderNode_Slices1507_Segment(_In_ CSlice *pSlice, nfUint32 nPolygonIndex, _In_ PModelWarnings pWarnings);
-
-		virtual void parseXML(_In_ CXmlReader * pXMLReader);
-	};
-
-	typedef std::shared_ptr<CModelReaderNode_Slices1507_Segment> PModelReaderNode_Slices1507_Segment;
 }
-
-#endif
\ No newline at end of file
@@ -0,0 +1,245 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+Benchmarks.cpp: Entry point of the lib3mf benchmark suite. Measures read,
+write, merge, flatten and validation throughput on the generated corpus.
+
+Usage: lib3mf_benchmarks [--quick] [--scale <factor>] [--seed <seed>]
+	[--repetitions <count>] [--filter <substring>] [--out <file.json>]
+	[--compare <baseline.json>] [--threshold <percent>]
+	[--write-corpus <directory>]
+
+--*/
+
+#include "Benchmark_Generator.h"
+#include "Benchmark_Harness.h"
+#include "Benchmark_UUID.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+using namespace Lib3MF;
+using namespace Lib3MFBenchmark;
+
+typedef struct sBenchmarkCorpusEntry {
+	BENCHMARKMODEL m_Model;
+	std::vector<Lib3MF_uint8> m_Buffer;
+} BENCHMARKCORPUSENTRY;
+
+static void fnPrintUsage()
+{
+	std::cout << "Usage: lib3mf_benchmarks [--quick] [--scale <factor>] [--seed <seed>] [--repetitions <count>]" << std::endl;
+	std::cout << "                         [--filter <substring>] [--out <file.json>] [--compare <baseline.json>]" << std::endl;
+	std::cout << "                         [--threshold <percent>] [--write-corpus <directory>]" << std::endl;
+}
+
+static std::string fnReadTextFile(const std::string & sFileName)
+{
+	std::ifstream Stream(sFileName, std::ios::binary);
+	if (!Stream)
+		throw std::runtime_error("could not open " + sFileName);
+	std::ostringstream Content;
+	Content << Stream.rdbuf();
+	return Content.str();
+}
+
+static uint64_t fnValidateMeshes(PModel pModel)
+{
+	uint64_t nTriangleCount = 0;
+	PMeshObjectIterator pIterator = pModel->GetMeshObjects();
+	while (pIterator->MoveNext()) {
+		PMeshObject pMeshObject = pIterator->GetCurrentMeshObject();
+		if (!pMeshObject->IsValid() || !pMeshObject->IsManifoldAndOriented())
+			throw std::runtime_error("generated mesh is not valid");
+		nTriangleCount += pMeshObject->GetTriangleCount();
+	}
+	return nTriangleCount;
+}
+
+int main(int argc, char ** argv)
+{
+	double dScale = 1.0;
+	uint64_t nSeed = 3;
+	uint32_t nRepetitions = 5;
+	double dThresholdPercent = 10.0;
+	std::string sFilter;
+	std::string sOutputFile;
+	std::string sBaselineFile;
+	std::string sCorpusDirectory;
+
+	for (int nIndex = 1; nIndex < argc; nIndex++) {
+		std::string sArgument = argv[nIndex];
+		bool bHasValue = (nIndex + 1 < argc);
+		if (sArgument == "--quick") {
+			dScale = 0.01;
+			nRepetitions = 1;
+		}
+		else if ((sArgument == "--scale") && bHasValue)
+			dScale = atof(argv[++nIndex]);
+		else if ((sArgument == "--seed") && bHasValue)
+			nSeed = strtoull(argv[++nIndex], nullptr, 10);
+		else if ((sArgument == "--repetitions") && bHasValue)
+			nRepetitions = (uint32_t)atoi(argv[++nIndex]);
+		else if ((sArgument == "--filter") && bHasValue)
+			sFilter = argv[++nIndex];
+		else if ((sArgument == "--out") && bHasValue)
+			sOutputFile = argv[++nIndex];
+		else if ((sArgument == "--compare") && bHasValue)
+			sBaselineFile = argv[++nIndex];
+		else if ((sArgument == "--threshold") && bHasValue)
+			dThresholdPercent = atof(argv[++nIndex]);
+		else if ((sArgument == "--write-corpus") && bHasValue)
+			sCorpusDirectory = argv[++nIndex];
+		else {
+			fnPrintUsage();
+			return (sArgument == "--help") ? 0 : 2;
+		}
+	}
+
+	try {
+		PWrapper pWrapper = CWrapper::loadLibrary();
+		CBenchmarkGenerator Generator(pWrapper, dScale, nSeed);
+
+		if (!sCorpusDirectory.empty()) {
+			Generator.writeCorpus(sCorpusDirectory);
+			return 0;
+		}
+
+		Lib3MF_uint32 nMajor, nMinor, nMicro;
+		pWrapper->GetLibraryVersion(nMajor, nMinor, nMicro);
+		CBenchmarkHarness Harness;
+		Harness.setContext("library_version", std::to_string(nMajor) + "." + std::to_string(nMinor) + "." + std::to_string(nMicro));
+		Harness.setContext("scale", std::to_string(dScale));
+		Harness.setContext("seed", std::to_string(nSeed));
+		Harness.setContext("repetitions", std::to_string(nRepetitions));
+
+		// The corpus is generated and serialized once, on first use
+		std::vector<std::unique_ptr<BENCHMARKCORPUSENTRY>> Corpus(bcCount);
+		auto fnGetCorpus = [&](eBenchmarkCorpus eCorpus) -> BENCHMARKCORPUSENTRY & {
+			if (!Corpus[eCorpus]) {
+				std::unique_ptr<BENCHMARKCORPUSENTRY> pEntry(new BENCHMARKCORPUSENTRY());
+				pEntry->m_Model = Generator.create(eCorpus);
+				CBenchmarkGenerator::writeToBuffer(pEntry->m_Model.m_pModel, pEntry->m_Buffer);
+				Corpus[eCorpus] = std::move(pEntry);
+			}
+			return *Corpus[eCorpus];
+		};
+
+		for (int nCorpus = 0; nCorpus < bcCount; nCorpus++) {
+			eBenchmarkCorpus eCorpus = (eBenchmarkCorpus)nCorpus;
+			std::string sName = CBenchmarkGenerator::getCorpusName(eCorpus);
+
+			Harness.registerBenchmark("write/" + sName, [&fnGetCorpus, eCorpus](CBenchmarkRun & Run) {
+				BENCHMARKCORPUSENTRY & Entry = fnGetCorpus(eCorpus);
+				std::vector<Lib3MF_uint8> Buffer;
+				Run.measure([&]() {
+					CBenchmarkGenerator::writeToBuffer(Entry.m_Model.m_pModel, Buffer);
+				});
+				Run.setBytesProcessed(Buffer.size());
+				Run.setItemsProcessed(Entry.m_Model.m_nItemCount);
+			});
+
+			Harness.registerBenchmark("read/" + sName, [&fnGetCorpus, &pWrapper, eCorpus](CBenchmarkRun & Run) {
+				BENCHMARKCORPUSENTRY & Entry = fnGetCorpus(eCorpus);
+				PModel pModel;
+				Run.measure([&]() {
+					pModel = CBenchmarkGenerator::readFromBuffer(pWrapper, Entry.m_Buffer);
+				});
+				Run.setBytesProcessed(Entry.m_Buffer.size());
+				Run.setItemsProcessed(Entry.m_Model.m_nItemCount);
+			});
+		}
+
+		Harness.registerBenchmark("merge/production", [&fnGetCorpus, &pWrapper](CBenchmarkRun & Run) {
+			BENCHMARKCORPUSENTRY & Entry = fnGetCorpus(bcProduction);
+			PModel pTarget;
+			Run.measure([&]() {
+				// Every repetition merges into an empty model
+				pTarget = pWrapper->CreateModel();
+				pTarget->MergeFromModel(Entry.m_Model.m_pModel.get());
+			});
+			Run.setItemsProcessed(Entry.m_Model.m_nItemCount);
+		});
+
+		for (eBenchmarkCorpus eCorpus : { bcMesh, bcProduction }) {
+			std::string sName = CBenchmarkGenerator::getCorpusName(eCorpus);
+
+			Harness.registerBenchmark("flatten/" + sName, [&fnGetCorpus, eCorpus](CBenchmarkRun & Run) {
+				BENCHMARKCORPUSENTRY & Entry = fnGetCorpus(eCorpus);
+				PModel pFlattened;
+				Run.measure([&]() {
+					pFlattened = Entry.m_Model.m_pModel->MergeToModel();
+				});
+				Run.setItemsProcessed(Entry.m_Model.m_nItemCount);
+			});
+
+			Harness.registerBenchmark("validate/" + sName, [&fnGetCorpus, eCorpus](CBenchmarkRun & Run) {
+				BENCHMARKCORPUSENTRY & Entry = fnGetCorpus(eCorpus);
+				uint64_t nTriangleCount = 0;
+				Run.measure([&]() {
+					nTriangleCount = fnValidateMeshes(Entry.m_Model.m_pModel);
+				});
+				Run.setItemsProcessed(nTriangleCount);
+			});
+		}
+
+		registerUUIDBenchmarks(Harness, dScale);
+
+		Harness.run(sFilter, nRepetitions);
+
+		if (!sOutputFile.empty()) {
+			std::ofstream Stream(sOutputFile, std::ios::binary);
+			if (!Stream)
+				throw std::runtime_error("could not create " + sOutputFile);
+			Stream << Harness.toJSON();
+		}
+
+		if (!sBaselineFile.empty()) {
+			uint32_t nRegressions = Harness.compareTo(fnReadTextFile(sBaselineFile), dThresholdPercent);
+			if (nRegressions > 0) {
+				std::cout << nRegressions << " benchmark(s) regressed by more than " << dThresholdPercent << "%" << std::endl;
+				return 1;
+			}
+		}
+	}
+	catch (ELib3MFException & Exception) {
+		std::cout << "lib3mf error: " << Exception.what() << std::endl;
+		return 1;
+	}
+	catch (std::exception & Exception) {
+		std::cout << "error: " << Exception.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
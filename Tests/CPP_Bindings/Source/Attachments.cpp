@@ -267,6 +267,74 @@ namespace Lib3MF
 		ASSERT_TRUE(bAreEqual);
 	}
 
+	// Returns the first bytes of the compressed data of the package thumbnail, located behind its local file header
+	std::vector<Lib3MF_uint8> GetCompressedThumbnailData(const std::vector<Lib3MF_uint8> & vctPackageBuffer)
+	{
+		const std::string sEntryName("Metadata/thumbnail.png");
+		auto iName = std::search(vctPackageBuffer.begin(), vctPackageBuffer.end(), sEntryName.begin(), sEntryName.end());
+		if (iName == vctPackageBuffer.end())
+			return std::vector<Lib3MF_uint8>();
+		size_t nExtraLength = *(iName - 2) | (*(iName - 1) << 8);
+		if ((size_t)(vctPackageBuffer.end() - iName) <= sEntryName.size() + nExtraLength)
+			return std::vector<Lib3MF_uint8>();
+		auto iData = iName + sEntryName.size() + nExtraLength;
+		auto iDataEnd = iData + std::min<size_t>(4096, vctPackageBuffer.end() - iData);
+		return std::vector<Lib3MF_uint8>(iData, iDataEnd);
+	}
+
+	TEST_F(AttachmentsT, RewritePackageThumbnailKeepsCompressedData)
+	{
+		auto vctSourceBuffer = ReadFileIntoBuffer(std::string(TESTFILESPATH) + "/Attachments/withPackageThumbnail.3mf");
+		model->QueryReader("3mf")->ReadFromBuffer(vctSourceBuffer);
+		std::vector<Lib3MF_uint8> vctCompressedData = GetCompressedThumbnailData(vctSourceBuffer);
+		ASSERT_FALSE(vctCompressedData.empty());
+
+		auto writer = model->QueryWriter("3mf");
+		std::vector<Lib3MF_uint8> vctFileBuffer;
+		writer->WriteToBuffer(vctFileBuffer);
+		ASSERT_TRUE(std::search(vctFileBuffer.begin(), vctFileBuffer.end(), vctCompressedData.begin(), vctCompressedData.end()) != vctFileBuffer.end());
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(vctFileBuffer);
+		CheckPackageThumbnailAreEqual(model, readModel);
+
+		// A replaced stream is compressed anew
+		model->GetPackageThumbnailAttachment()->ReadFromBuffer(CInputVector<Lib3MF_uint8>((Lib3MF_uint8*)m_sAttachmetPayload.data(), m_sAttachmetPayload.size()));
+		writer->WriteToBuffer(vctFileBuffer);
+		auto changedModel = wrapper->CreateModel();
+		changedModel->QueryReader("3mf")->ReadFromBuffer(vctFileBuffer);
+		CheckPackageThumbnailAreEqual(model, changedModel);
+	}
+
+	TEST_F(AttachmentsT, RewriteSourceFileKeepsCompressedData)
+	{
+		auto vctSourceBuffer = ReadFileIntoBuffer(std::string(TESTFILESPATH) + "/Attachments/withPackageThumbnail.3mf");
+		std::vector<Lib3MF_uint8> vctCompressedData = GetCompressedThumbnailData(vctSourceBuffer);
+		ASSERT_FALSE(vctCompressedData.empty());
+		ASSERT_TRUE(CreateDir(m_sFolderName.c_str())) << L"Could not create folder.";
+		const std::string sFileName(m_sFolderName + "/rewrite_source_attachment.3mf");
+		WriteBufferToFile(vctSourceBuffer, sFileName);
+
+		// The thumbnail is written back to the file it was read from
+		model->QueryReader("3mf")->ReadFromFile(sFileName);
+		auto writer = model->QueryWriter("3mf");
+		writer->WriteToFile(sFileName);
+		auto vctFileBuffer = ReadFileIntoBuffer(sFileName);
+		ASSERT_TRUE(std::search(vctFileBuffer.begin(), vctFileBuffer.end(), vctCompressedData.begin(), vctCompressedData.end()) != vctFileBuffer.end());
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromFile(sFileName);
+		CheckPackageThumbnailAreEqual(model, readModel);
+
+		// The compressed data is kept in memory, so it does not depend on the replaced file
+		writer->WriteToFile(sFileName);
+		vctFileBuffer = ReadFileIntoBuffer(sFileName);
+		ASSERT_TRUE(std::search(vctFileBuffer.begin(), vctFileBuffer.end(), vctCompressedData.begin(), vctCompressedData.end()) != vctFileBuffer.end());
+		auto rewrittenModel = wrapper->CreateModel();
+		rewrittenModel->QueryReader("3mf")->ReadFromFile(sFileName);
+		CheckPackageThumbnailAreEqual(model, rewrittenModel);
+	}
+
 }
 
 
@@ -258,6 +258,98 @@ namespace Lib3MF
 		ASSERT_DOUBLE_EQ(ballMap[2], 1.2);
 	}
 
+	TEST_F(BeamLattice, WriteSTL)
+	{
+		beamLattice->SetBallOptions(eBeamLatticeBallMode::Mixed, 1.2);
+
+		sBeam beam;
+		beam.m_Radii[0] = 0.5;
+		beam.m_Radii[1] = 0.5;
+		beam.m_Indices[0] = 0;
+		beam.m_Indices[1] = 1;
+		beam.m_CapModes[0] = eBeamLatticeCapMode::Butt;
+		beam.m_CapModes[1] = eBeamLatticeCapMode::Butt;
+		beamLattice->AddBeam(beam);
+		beam.m_Indices[0] = 1;
+		beam.m_Indices[1] = 2;
+		beam.m_CapModes[0] = eBeamLatticeCapMode::HemiSphere;
+		beam.m_CapModes[1] = eBeamLatticeCapMode::HemiSphere;
+		beamLattice->AddBeam(beam);
+
+		sBall ball;
+		ball.m_Index = 0;
+		ball.m_Radius = 0.6;
+		beamLattice->AddBall(ball);
+
+		model->AddBuildItem(mesh.get(), getIdentityTransform());
+
+		auto writer = model->QueryWriter("stl");
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+
+		// Without accuracy, circles have 16 segments: a beam with butt caps has 2 rings, a beam
+		// with hemispheres 2 + 2 * 3 rings, and a ball 7 rings, each ring yielding 32 triangles.
+		Lib3MF_uint32 nTriangleCount = 2 * 16 * (2 + 8 + 7);
+		ASSERT_EQ(buffer.size(), 84 + 50 * nTriangleCount);
+	}
+
+	TEST_F(BeamLattice, WriteSTLMatchesSerialTessellation)
+	{
+		// Lattices with many beams are tessellated in parallel, lattices with few beams on the calling thread
+		const Lib3MF_uint32 nNodeCount = 64;
+		const Lib3MF_uint32 nBeamCount = 4096;
+		const Lib3MF_uint32 nSerialMeshCount = 8;
+
+		std::vector<sPosition> vctVertices(nNodeCount);
+		for (Lib3MF_uint32 nIndex = 0; nIndex < nNodeCount; nIndex++) {
+			vctVertices[nIndex].m_Coordinates[0] = (Lib3MF_single)(nIndex % 8);
+			vctVertices[nIndex].m_Coordinates[1] = (Lib3MF_single)(nIndex / 8);
+			vctVertices[nIndex].m_Coordinates[2] = (Lib3MF_single)(nIndex % 3);
+		}
+		std::vector<sBeam> vctBeams(nBeamCount);
+		for (Lib3MF_uint32 nIndex = 0; nIndex < nBeamCount; nIndex++) {
+			vctBeams[nIndex].m_Indices[0] = nIndex % nNodeCount;
+			vctBeams[nIndex].m_Indices[1] = (nIndex * 7 + 1) % nNodeCount;
+			if (vctBeams[nIndex].m_Indices[0] == vctBeams[nIndex].m_Indices[1])
+				vctBeams[nIndex].m_Indices[1] = (vctBeams[nIndex].m_Indices[1] + 1) % nNodeCount;
+			vctBeams[nIndex].m_Radii[0] = 0.1 + 0.01 * (nIndex % 5);
+			vctBeams[nIndex].m_Radii[1] = 0.1 + 0.01 * (nIndex % 3);
+			vctBeams[nIndex].m_CapModes[0] = eBeamLatticeCapMode(nIndex % 3);
+			vctBeams[nIndex].m_CapModes[1] = eBeamLatticeCapMode((nIndex / 3) % 3);
+		}
+		std::vector<sTriangle> vctTriangles;
+
+		auto parallelModel = wrapper->CreateModel();
+		auto parallelMesh = parallelModel->AddMeshObject();
+		parallelMesh->SetGeometry(vctVertices, vctTriangles);
+		parallelMesh->BeamLattice()->SetBeams(vctBeams);
+		parallelModel->AddBuildItem(parallelMesh.get(), getIdentityTransform());
+
+		auto serialModel = wrapper->CreateModel();
+		Lib3MF_uint32 nBeamsPerMesh = nBeamCount / nSerialMeshCount;
+		for (Lib3MF_uint32 nMesh = 0; nMesh < nSerialMeshCount; nMesh++) {
+			auto serialMesh = serialModel->AddMeshObject();
+			serialMesh->SetGeometry(vctVertices, vctTriangles);
+			std::vector<sBeam> vctMeshBeams(vctBeams.begin() + nMesh * nBeamsPerMesh, vctBeams.begin() + (nMesh + 1) * nBeamsPerMesh);
+			serialMesh->BeamLattice()->SetBeams(vctMeshBeams);
+			serialModel->AddBuildItem(serialMesh.get(), getIdentityTransform());
+		}
+
+		std::vector<Lib3MF_uint8> parallelBuffer;
+		parallelModel->QueryWriter("stl")->WriteToBuffer(parallelBuffer);
+		std::vector<Lib3MF_uint8> serialBuffer;
+		serialModel->QueryWriter("stl")->WriteToBuffer(serialBuffer);
+
+		ASSERT_GE(parallelBuffer.size(), (size_t)84);
+		Lib3MF_uint32 nTriangleCount = parallelBuffer[80] | (parallelBuffer[81] << 8) | (parallelBuffer[82] << 16) | (parallelBuffer[83] << 24);
+		ASSERT_GT(nTriangleCount, nBeamCount);
+		ASSERT_EQ(parallelBuffer.size(), 84 + 50 * (size_t)nTriangleCount);
+		ASSERT_EQ(serialBuffer.size(), parallelBuffer.size());
+
+		// Both lattices emit the beams in the same order, so every triangle has to match
+		ASSERT_TRUE(std::equal(parallelBuffer.begin() + 80, parallelBuffer.end(), serialBuffer.begin() + 80));
+	}
+
 	TEST_F(BeamLattice, GeometryShouldFail)
 	{
 		sBeam beam;
@@ -157,4 +157,140 @@ namespace Lib3MF
 		ASSERT_FALSE(buildItems->MoveNext());
 	}
 
+	typedef struct {
+		Lib3MF_uint32 m_nMeshResourceID;
+		Lib3MF_uint32 m_nBuildItemIndex;
+		sTransform m_Transform;
+	} sExpectedInstance;
+
+	// Applies transform A first, then B
+	static sTransform ComposeTransforms(const sTransform & A, const sTransform & B)
+	{
+		sTransform Result;
+		for (int i = 0; i < 4; i++) {
+			for (int j = 0; j < 3; j++) {
+				Lib3MF_single fValue = (i == 3) ? B.m_Fields[3][j] : 0.0f;
+				for (int k = 0; k < 3; k++)
+					fValue += A.m_Fields[i][k] * B.m_Fields[k][j];
+				Result.m_Fields[i][j] = fValue;
+			}
+		}
+		return Result;
+	}
+
+	static void CollectExpectedInstances(PModel model, PObject object, const sTransform & transform, Lib3MF_uint32 nBuildItemIndex, std::vector<sExpectedInstance> & vctInstances)
+	{
+		if (object->IsMeshObject()) {
+			vctInstances.push_back({ object->GetUniqueResourceID(), nBuildItemIndex, transform });
+			return;
+		}
+		ASSERT_TRUE(object->IsComponentsObject());
+		auto componentsObject = model->GetComponentsObjectByID(object->GetUniqueResourceID());
+		for (Lib3MF_uint32 nIndex = 0; nIndex < componentsObject->GetComponentCount(); nIndex++) {
+			auto component = componentsObject->GetComponent(nIndex);
+			CollectExpectedInstances(model, component->GetObjectResource(), ComposeTransforms(component->GetTransform(), transform), nBuildItemIndex, vctInstances);
+		}
+	}
+
+	TEST_F(BuildItems, InstanceTable)
+	{
+		auto instanceTable = model->GetInstanceTable();
+		Lib3MF_uint32 nMeshCount = instanceTable->GetMeshCount();
+		ASSERT_GT(nMeshCount, 0u);
+		ASSERT_GT(instanceTable->GetInstanceCount(), nMeshCount);
+
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		instanceTable->GetVertices(vctVertices);
+		instanceTable->GetTriangles(vctTriangles);
+
+		std::vector<Lib3MF_uint32> vctMeshTriangleCounts;
+		for (Lib3MF_uint32 nMeshIndex = 0; nMeshIndex < nMeshCount; nMeshIndex++) {
+			Lib3MF_uint32 nVertexOffset, nVertexCount, nTriangleOffset, nTriangleCount;
+			instanceTable->GetMeshRange(nMeshIndex, nVertexOffset, nVertexCount, nTriangleOffset, nTriangleCount);
+			vctMeshTriangleCounts.push_back(nTriangleCount);
+
+			auto meshObject = instanceTable->GetMeshObject(nMeshIndex);
+			std::vector<sPosition> vctMeshVertices;
+			std::vector<sTriangle> vctMeshTriangles;
+			meshObject->GetVertices(vctMeshVertices);
+			meshObject->GetTriangleIndices(vctMeshTriangles);
+			ASSERT_EQ(vctMeshVertices.size(), nVertexCount);
+			ASSERT_EQ(vctMeshTriangles.size(), nTriangleCount);
+			for (Lib3MF_uint32 nIndex = 0; nIndex < nVertexCount; nIndex++)
+				ASSERT_EQ(vctMeshVertices[nIndex].m_Coordinates[2], vctVertices[nVertexOffset + nIndex].m_Coordinates[2]);
+			for (Lib3MF_uint32 nIndex = 0; nIndex < nTriangleCount; nIndex++)
+				ASSERT_EQ(vctMeshTriangles[nIndex].m_Indices[1], vctTriangles[nTriangleOffset + nIndex].m_Indices[1]);
+		}
+
+		// Placing all vertices of all instances reproduces the merged model
+		std::vector<sMeshInstance> vctInstances;
+		instanceTable->GetInstances(vctInstances);
+		Lib3MF_uint32 nTotalTriangleCount = 0;
+		sBox instancesBox = { { 1e30f, 1e30f, 1e30f }, { -1e30f, -1e30f, -1e30f } };
+		for (auto & instance : vctInstances) {
+			ASSERT_LT(instance.m_MeshIndex, nMeshCount);
+			ASSERT_LT(instance.m_BuildItemIndex, 2u);
+			nTotalTriangleCount += vctMeshTriangleCounts[instance.m_MeshIndex];
+
+			Lib3MF_uint32 nVertexOffset, nVertexCount, nTriangleOffset, nTriangleCount;
+			instanceTable->GetMeshRange(instance.m_MeshIndex, nVertexOffset, nVertexCount, nTriangleOffset, nTriangleCount);
+			for (Lib3MF_uint32 nIndex = nVertexOffset; nIndex < nVertexOffset + nVertexCount; nIndex++) {
+				for (int j = 0; j < 3; j++) {
+					float fValue = instance.m_Transform[3][j];
+					for (int i = 0; i < 3; i++)
+						fValue += vctVertices[nIndex].m_Coordinates[i] * instance.m_Transform[i][j];
+					instancesBox.m_MinCoordinate[j] = std::min(instancesBox.m_MinCoordinate[j], fValue);
+					instancesBox.m_MaxCoordinate[j] = std::max(instancesBox.m_MaxCoordinate[j], fValue);
+				}
+			}
+		}
+
+		auto mergedModel = model->MergeToModel();
+		auto mergedMeshes = mergedModel->GetMeshObjects();
+		ASSERT_TRUE(mergedMeshes->MoveNext());
+		ASSERT_EQ(mergedMeshes->GetCurrentMeshObject()->GetTriangleCount(), nTotalTriangleCount);
+
+		sBox modelBox = model->GetOutbox();
+		for (int j = 0; j < 3; j++) {
+			EXPECT_NEAR(instancesBox.m_MinCoordinate[j], modelBox.m_MinCoordinate[j], 1e-3);
+			EXPECT_NEAR(instancesBox.m_MaxCoordinate[j], modelBox.m_MaxCoordinate[j], 1e-3);
+		}
+	}
+
+	TEST_F(BuildItems, InstanceTableTransformsAndMeshes)
+	{
+		std::vector<sExpectedInstance> vctExpected;
+		auto buildItems = model->GetBuildItems();
+		Lib3MF_uint32 nBuildItemIndex = 0;
+		while (buildItems->MoveNext()) {
+			auto buildItem = buildItems->GetCurrent();
+			CollectExpectedInstances(model, buildItem->GetObjectResource(), buildItem->GetObjectTransform(), nBuildItemIndex, vctExpected);
+			nBuildItemIndex++;
+		}
+
+		auto instanceTable = model->GetInstanceTable();
+		std::vector<sMeshInstance> vctInstances;
+		instanceTable->GetInstances(vctInstances);
+		ASSERT_EQ(vctInstances.size(), vctExpected.size());
+
+		// Each mesh object is listed once
+		std::vector<Lib3MF_uint32> vctMeshResourceIDs;
+		for (Lib3MF_uint32 nMeshIndex = 0; nMeshIndex < instanceTable->GetMeshCount(); nMeshIndex++) {
+			Lib3MF_uint32 nResourceID = instanceTable->GetMeshObject(nMeshIndex)->GetUniqueResourceID();
+			ASSERT_EQ(std::find(vctMeshResourceIDs.begin(), vctMeshResourceIDs.end(), nResourceID), vctMeshResourceIDs.end());
+			vctMeshResourceIDs.push_back(nResourceID);
+		}
+
+		for (size_t nIndex = 0; nIndex < vctInstances.size(); nIndex++) {
+			auto & instance = vctInstances[nIndex];
+			auto & expected = vctExpected[nIndex];
+			ASSERT_EQ(instance.m_BuildItemIndex, expected.m_nBuildItemIndex);
+			ASSERT_LT(instance.m_MeshIndex, vctMeshResourceIDs.size());
+			ASSERT_EQ(vctMeshResourceIDs[instance.m_MeshIndex], expected.m_nMeshResourceID);
+			for (int i = 0; i < 4; i++)
+				for (int j = 0; j < 3; j++)
+					EXPECT_NEAR(instance.m_Transform[i][j], expected.m_Transform.m_Fields[i][j], 1e-4);
+		}
+	}
 }
@@ -96,4 +96,136 @@ namespace Lib3MF
 		ASSERT_EQ(wrapper->RGBAToColor(5, 15, 25, 35).m_Red, colorGroup->GetColor(propertyIDs[1]).m_Red);
 	}
 
+	TEST_F(ColorGroup, GetSetAllColors)
+	{
+		colorGroup->AddColor(wrapper->RGBAToColor(0, 10, 20, 30));
+		colorGroup->AddColor(wrapper->RGBAToColor(5, 15, 25, 35));
+		colorGroup->AddColor(wrapper->RGBAToColor(40, 50, 60, 70));
+
+		std::vector<Lib3MF_uint32> propertyIDs;
+		colorGroup->GetAllPropertyIDs(propertyIDs);
+		colorGroup->RemoveColor(propertyIDs[1]);
+
+		std::vector<sColor> colors;
+		colorGroup->GetAllColors(colors);
+		ASSERT_EQ(colors.size(), 2);
+		ASSERT_EQ(colors[0].m_Green, 10);
+		ASSERT_EQ(colors[1].m_Green, 50);
+
+		colors[0] = wrapper->RGBAToColor(1, 2, 3, 4);
+		colors[1] = wrapper->RGBAToColor(5, 6, 7, 8);
+		colorGroup->SetAllColors(colors);
+		ASSERT_EQ(colorGroup->GetColor(propertyIDs[0]).m_Blue, 3);
+		ASSERT_EQ(colorGroup->GetColor(propertyIDs[2]).m_Alpha, 8);
+
+		colors.pop_back();
+		ASSERT_SPECIFIC_THROW(colorGroup->SetAllColors(colors), ELib3MFException);
+	}
+
+	TEST_F(ColorGroup, DeduplicateProperties)
+	{
+		Lib3MF_uint32 nRed1 = colorGroup->AddColor(wrapper->RGBAToColor(255, 0, 0, 255));
+		Lib3MF_uint32 nGreen = colorGroup->AddColor(wrapper->RGBAToColor(0, 255, 0, 255));
+		Lib3MF_uint32 nRed2 = colorGroup->AddColor(wrapper->RGBAToColor(255, 0, 0, 255));
+		colorGroup->AddColor(wrapper->RGBAToColor(0, 0, 255, 255));
+
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(vctVertices, vctTriangles);
+
+		sTriangleProperties sProperties;
+		sProperties.m_ResourceID = colorGroup->GetResourceID();
+		sProperties.m_PropertyIDs[0] = nRed2;
+		sProperties.m_PropertyIDs[1] = nGreen;
+		sProperties.m_PropertyIDs[2] = nRed1;
+		for (Lib3MF_uint32 nIndex = 0; nIndex < mesh->GetTriangleCount(); nIndex++)
+			mesh->SetTriangleProperties(nIndex, sProperties);
+
+		ASSERT_EQ(model->DeduplicateProperties(false), 1);
+		ASSERT_EQ(colorGroup->GetCount(), 3);
+
+		mesh->GetTriangleProperties(5, sProperties);
+		ASSERT_EQ(sProperties.m_PropertyIDs[0], nRed1);
+		ASSERT_EQ(sProperties.m_PropertyIDs[1], nGreen);
+		ASSERT_EQ(sProperties.m_PropertyIDs[2], nRed1);
+
+		// The blue entry is not referenced by any triangle
+		ASSERT_EQ(model->DeduplicateProperties(true), 1);
+		ASSERT_EQ(colorGroup->GetCount(), 2);
+		ASSERT_EQ(model->DeduplicateProperties(true), 0);
+	}
+
+	TEST_F(ColorGroup, WriteDenseAndSparsePropertyIDs)
+	{
+		// Property IDs below a gap of 1024 are mapped through flat tables,
+		// the IDs behind the gap through the sparse fallback of the writer
+		for (Lib3MF_uint32 nIndex = 0; nIndex < 3000; nIndex++)
+			colorGroup->AddColor(wrapper->RGBAToColor(Lib3MF_uint8(nIndex % 256), Lib3MF_uint8(nIndex / 256), 0, 255));
+		for (Lib3MF_uint32 nPropertyID = 3; nPropertyID <= 2500; nPropertyID++)
+			colorGroup->RemoveColor(nPropertyID);
+		auto secondGroup = model->AddColorGroup();
+		Lib3MF_uint32 nSecondID = secondGroup->AddColor(wrapper->RGBAToColor(1, 2, 3, 4));
+
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		mesh->SetObjectLevelProperty(colorGroup->GetResourceID(), 2999);
+		model->AddBuildItem(mesh.get(), getIdentityTransform());
+
+		std::vector<std::vector<sColor>> vctExpected(mesh->GetTriangleCount());
+		for (Lib3MF_uint32 nIndex = 0; nIndex < mesh->GetTriangleCount(); nIndex++) {
+			sTriangleProperties sProperties;
+			if (nIndex == 0) {
+				sProperties.m_ResourceID = secondGroup->GetResourceID();
+				sProperties.m_PropertyIDs[0] = nSecondID;
+				sProperties.m_PropertyIDs[1] = nSecondID;
+				sProperties.m_PropertyIDs[2] = nSecondID;
+			}
+			else {
+				sProperties.m_ResourceID = colorGroup->GetResourceID();
+				sProperties.m_PropertyIDs[0] = (nIndex % 2) + 1;
+				sProperties.m_PropertyIDs[1] = 2501 + nIndex;
+				sProperties.m_PropertyIDs[2] = 3000 - nIndex;
+			}
+			mesh->SetTriangleProperties(nIndex, sProperties);
+
+			auto group = (nIndex == 0) ? secondGroup : colorGroup;
+			for (int j = 0; j < 3; j++)
+				vctExpected[nIndex].push_back(group->GetColor(sProperties.m_PropertyIDs[j]));
+		}
+
+		std::vector<Lib3MF_uint8> buffer;
+		model->QueryWriter("3mf")->WriteToBuffer(buffer);
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+
+		auto meshObjects = readModel->GetMeshObjects();
+		ASSERT_TRUE(meshObjects->MoveNext());
+		auto readMesh = meshObjects->GetCurrentMeshObject();
+		ASSERT_EQ(readMesh->GetTriangleCount(), vctExpected.size());
+		for (Lib3MF_uint32 nIndex = 0; nIndex < readMesh->GetTriangleCount(); nIndex++) {
+			sTriangleProperties sProperties;
+			readMesh->GetTriangleProperties(nIndex, sProperties);
+			auto readGroup = readModel->GetColorGroupByID(sProperties.m_ResourceID);
+			for (int j = 0; j < 3; j++) {
+				sColor cColor = readGroup->GetColor(sProperties.m_PropertyIDs[j]);
+				ASSERT_EQ(cColor.m_Red, vctExpected[nIndex][j].m_Red);
+				ASSERT_EQ(cColor.m_Green, vctExpected[nIndex][j].m_Green);
+				ASSERT_EQ(cColor.m_Blue, vctExpected[nIndex][j].m_Blue);
+				ASSERT_EQ(cColor.m_Alpha, vctExpected[nIndex][j].m_Alpha);
+			}
+		}
+
+		Lib3MF_uint32 nResourceID, nPropertyID;
+		ASSERT_TRUE(readMesh->GetObjectLevelProperty(nResourceID, nPropertyID));
+		sColor cObjectColor = readModel->GetColorGroupByID(nResourceID)->GetColor(nPropertyID);
+		sColor cExpectedColor = colorGroup->GetColor(2999);
+		ASSERT_EQ(cObjectColor.m_Red, cExpectedColor.m_Red);
+		ASSERT_EQ(cObjectColor.m_Green, cExpectedColor.m_Green);
+	}
+
 }
@@ -146,6 +146,37 @@ namespace Lib3MF
 
 		CompareBoxes(sOutbox, sExpectedOutbox);
 	}
-}
 
+	TEST_F(Outbox, FollowsTransformChanges)
+	{
+		auto buildItems = model->GetBuildItems();
+		buildItems->MoveNext();
+		buildItems->MoveNext();
+		auto buildItem = buildItems->GetCurrent();
+		Lib3MF::sBox sOutbox = buildItem->GetOutbox();
 
+		sTransform transform = buildItem->GetObjectTransform();
+		transform.m_Fields[3][0] += 1000.0f;
+		buildItem->SetObjectTransform(transform);
+
+		Lib3MF::sBox sMovedOutbox = buildItem->GetOutbox();
+		for (int i = 0; i < 3; i++) {
+			EXPECT_NEAR(sMovedOutbox.m_MinCoordinate[i], sOutbox.m_MinCoordinate[i] + (i == 0 ? 1000.0f : 0.0f), 1e-3);
+			EXPECT_NEAR(sMovedOutbox.m_MaxCoordinate[i], sOutbox.m_MaxCoordinate[i] + (i == 0 ? 1000.0f : 0.0f), 1e-3);
+		}
+		EXPECT_FLOAT_EQ(model->GetOutbox().m_MaxCoordinate[0], sMovedOutbox.m_MaxCoordinate[0]);
+
+		auto components = model->GetComponentsObjects();
+		components->MoveNext();
+		auto componentsObject = components->GetCurrentComponentsObject();
+		for (Lib3MF_uint32 nIndex = 0; nIndex < componentsObject->GetComponentCount(); nIndex++) {
+			auto component = componentsObject->GetComponent(nIndex);
+			sTransform componentTransform = component->GetTransform();
+			componentTransform.m_Fields[3][2] += 500.0f;
+			component->SetTransform(componentTransform);
+		}
+
+		auto identityItem = model->AddBuildItem(componentsObject.get(), getIdentityTransform());
+		CompareBoxes(identityItem->GetOutbox(), componentsObject->GetOutbox());
+	}
+}
@@ -34,6 +34,9 @@ classes
 #include "UnitTest_Utilities.h"
 #include "lib3mf_implicit.hpp"
 
+#include <set>
+#include <thread>
+
 namespace Lib3MF
 {
 	class ProductionExtension : public Lib3MFTest {
@@ -164,6 +167,40 @@ namespace Lib3MF
 		ASSERT_SPECIFIC_THROW(writer->WriteToFile("SetupWriteRead5.3mf"), ELib3MFException);
 	}
 
+	TEST_F(ProductionExtension, GeneratedUUIDsAreUnique)
+	{
+		const Lib3MF_uint32 nThreadCount = 4;
+		const Lib3MF_uint32 nItemsPerThread = 500;
+
+		// Every thread works on its own model, UUIDs are generated concurrently
+		std::vector<std::vector<std::string>> vctThreadUUIDs(nThreadCount);
+		std::vector<std::thread> vctThreads;
+		for (Lib3MF_uint32 iThread = 0; iThread < nThreadCount; iThread++) {
+			vctThreads.push_back(std::thread([&vctThreadUUIDs, iThread, nItemsPerThread]() {
+				auto threadModel = wrapper->CreateModel();
+				auto meshObject = threadModel->AddMeshObject();
+				for (Lib3MF_uint32 iItem = 0; iItem < nItemsPerThread; iItem++) {
+					bool bHasUUID = false;
+					vctThreadUUIDs[iThread].push_back(threadModel->AddBuildItem(meshObject.get(), wrapper->GetIdentityTransform())->GetUUID(bHasUUID));
+				}
+			}));
+		}
+		for (auto & thread : vctThreads)
+			thread.join();
+
+		std::set<std::string> setUUIDs;
+		for (auto & vctUUIDs : vctThreadUUIDs) {
+			ASSERT_EQ(vctUUIDs.size(), nItemsPerThread);
+			for (auto & sUUID : vctUUIDs) {
+				ASSERT_EQ(sUUID.length(), 36);
+				ASSERT_EQ(sUUID[14], '4');
+				ASSERT_TRUE((sUUID[19] == '8') || (sUUID[19] == '9') || (sUUID[19] == 'a') || (sUUID[19] == 'b'));
+				setUUIDs.insert(sUUID);
+			}
+		}
+		ASSERT_EQ(setUUIDs.size(), nThreadCount * nItemsPerThread);
+	}
+
 	//TEST_F(ProductionExtension, SetupWriteReadInspect)
 	//{
 
@@ -33,6 +33,11 @@ UnitTest_Writer.cpp: Defines Unittests for the Writer classes
 #include "UnitTest_Utilities.h"
 #include "lib3mf_implicit.hpp"
 
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
 namespace Lib3MF
 {
 	class ProgressCallbackTest : public Lib3MFTest {
@@ -109,5 +114,132 @@ namespace Lib3MF
 		}
 	}
 
+	static bool s_bAbortWrite = true;
+
+	void Callback_Toggle(bool* pAbort, Lib3MF_double dProgress, eProgressIdentifier identifier, Lib3MF_pvoid pUserData)
+	{
+		Callback_Positive(pAbort, dProgress, identifier, pUserData);
+		*pAbort = s_bAbortWrite;
+	}
+
+	TEST_F(ProgressCallbackTest, WriteAfterAbort)
+	{
+		ProgressCallbackTest::writer3MF->SetProgressCallback(Callback_Toggle, ProgressCallbackTest::m_spUserData);
+		s_bAbortWrite = true;
+		ASSERT_SPECIFIC_THROW(ProgressCallbackTest::writer3MF->WriteToFile(ProgressCallbackTest::OutFolder + "Pyramid.3mf"), ELib3MFException);
+
+		// A cancellation only applies to the write that was running
+		s_bAbortWrite = false;
+		ProgressCallbackTest::writer3MF->WriteToFile(ProgressCallbackTest::OutFolder + "Pyramid.3mf");
+	}
+
+
+	typedef struct {
+		std::mutex m_Mutex;
+		std::vector<std::thread::id> m_Threads;
+		std::vector<std::pair<eProgressIdentifier, std::chrono::steady_clock::time_point>> m_Calls;
+	} sCallbackRecord;
+
+	void Callback_Record(bool* pAbort, Lib3MF_double dProgress, eProgressIdentifier identifier, Lib3MF_pvoid pUserData)
+	{
+		sCallbackRecord * pRecord = reinterpret_cast<sCallbackRecord *>(pUserData);
+		std::lock_guard<std::mutex> lock(pRecord->m_Mutex);
+		pRecord->m_Threads.push_back(std::this_thread::get_id());
+		pRecord->m_Calls.push_back(std::make_pair(identifier, std::chrono::steady_clock::now()));
+		*pAbort = false;
+	}
+
+	TEST_F(ProgressCallbackTest, ReportsAreThrottled)
+	{
+		auto localModel = wrapper->CreateModel();
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		for (int i = 0; i < 2000; i++) {
+			auto mesh = localModel->AddMeshObject();
+			mesh->SetGeometry(vctVertices, vctTriangles);
+			localModel->AddBuildItem(mesh.get(), getIdentityTransform());
+		}
+		// Meshes large enough to report their nodes and triangles
+		std::vector<sPosition> vctLargeVertices(100000);
+		std::vector<sTriangle> vctLargeTriangles(100000);
+		for (Lib3MF_uint32 i = 0; i < 100000; i++) {
+			vctLargeVertices[i] = fnCreateVertex(i * 0.5f, (i % 7) * 1.0f, (i % 3) * 1.0f);
+			vctLargeTriangles[i] = fnCreateTriangle(i, (i + 1) % 100000, (i + 2) % 100000);
+		}
+		for (int i = 0; i < 4; i++) {
+			auto mesh = localModel->AddMeshObject();
+			mesh->SetGeometry(vctLargeVertices, vctLargeTriangles);
+			localModel->AddBuildItem(mesh.get(), getIdentityTransform());
+		}
+
+		sCallbackRecord record;
+		auto writer = localModel->QueryWriter("3mf");
+		writer->SetProgressCallback(Callback_Record, &record);
+		auto start = std::chrono::steady_clock::now();
+		writer->WriteToFile(ProgressCallbackTest::OutFolder + "Throttled.3mf");
+		auto nDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+		// The writer alternates between the object, node and triangle phases for every object.
+		// Apart from the first report of a phase, reports are at least the callback interval apart.
+		ASSERT_FALSE(record.m_Calls.empty());
+		std::set<eProgressIdentifier> reportedPhases;
+		reportedPhases.insert(record.m_Calls[0].first);
+		size_t nNewPhaseCount = 1;
+		for (size_t i = 1; i < record.m_Calls.size(); i++) {
+			eProgressIdentifier identifier = record.m_Calls[i].first;
+			if ((identifier != eProgressIdentifier::QUERYCANCELED) && reportedPhases.insert(identifier).second) {
+				nNewPhaseCount++;
+				continue;
+			}
+			auto nGap = std::chrono::duration_cast<std::chrono::milliseconds>(record.m_Calls[i].second - record.m_Calls[i - 1].second).count();
+			ASSERT_GE(nGap, 45);
+		}
+		ASSERT_LE(record.m_Calls.size(), nNewPhaseCount + (size_t)(nDuration / 45) + 1);
+	}
+
+	TEST_F(ProgressCallbackTest, CallbackRunsOnCallingThread)
+	{
+		// Slice stacks in their own parts are parsed by worker threads
+		auto localModel = wrapper->CreateModel();
+		for (int i = 0; i < 16; i++) {
+			auto sliceStack = localModel->AddSliceStack(0.0);
+			for (int j = 0; j < 32; j++) {
+				auto slice = sliceStack->AddSlice(1.0 + j);
+				std::vector<sPosition2D> vctVertices(3);
+				vctVertices[1].m_Coordinates[0] = 1.0f;
+				vctVertices[2].m_Coordinates[1] = 1.0f;
+				slice->SetVertices(vctVertices);
+				slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 2, 0 }));
+			}
+			sliceStack->SetOwnPath("/3D/slices" + std::to_string(i) + ".model");
+		}
+		std::vector<Lib3MF_uint8> buffer;
+		localModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		sCallbackRecord record;
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->SetProgressCallback(Callback_Record, &record);
+		reader->ReadFromBuffer(buffer);
+
+		ASSERT_EQ(readModel->GetSliceStacks()->Count(), 16);
+		ASSERT_FALSE(record.m_Threads.empty());
+		for (auto & threadId : record.m_Threads)
+			ASSERT_EQ(threadId, std::this_thread::get_id());
+	}
+
+	TEST_F(ProgressCallbackTest, STLWriteAfterAbort)
+	{
+		auto writerSTL = model->QueryWriter("stl");
+		writerSTL->SetProgressCallback(Callback_Toggle, ProgressCallbackTest::m_spUserData);
+		std::vector<Lib3MF_uint8> buffer;
+		s_bAbortWrite = true;
+		ASSERT_SPECIFIC_THROW(writerSTL->WriteToBuffer(buffer), ELib3MFException);
+
+		s_bAbortWrite = false;
+		writerSTL->WriteToBuffer(buffer);
+		ASSERT_GT(buffer.size(), 84);
+	}
 
 }
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <thread>
 
 namespace Lib3MF {
 
@@ -97,6 +98,16 @@ namespace Lib3MF {
 
 		struct DEKCallbackData {
 			std::map<Lib3MF_uint64, Lib3MF_uint64> context;
+			Lib3MF_uint64 maxChunkSize = 0;
+			Lib3MF_uint64 totalSize = 0;
+			std::vector<std::thread::id> threads;
+			// Fails the decryption of the n-th chunk, if set
+			Lib3MF_uint64 failAtChunk = 0;
+			Lib3MF_uint64 chunkCount = 0;
+			Lib3MF_uint64 failedDescriptor = 0;
+			Lib3MF_uint64 chunksAfterFailure = 0;
+			// Chunks whose cipher and plain text share the same buffer
+			Lib3MF_uint64 inPlaceChunkCount = 0;
 		};
 
 		static void testKEKCallback(
@@ -151,6 +162,7 @@ namespace Lib3MF {
 			ASSERT_NE(userData, nullptr);
 
 			DEKCallbackData * cb = (DEKCallbackData *)userData;
+			cb->threads.push_back(std::this_thread::get_id());
 			auto localDescriptor = cb->context.find(cd.GetDescriptor());
 			if (localDescriptor != cb->context.end())
 				localDescriptor->second++;
@@ -165,9 +177,23 @@ namespace Lib3MF {
 				*outNeededSize = inSize;
 				*status = inSize;
 			} else {
+				cb->chunkCount++;
+				if ((cb->failedDescriptor != 0) && (cb->failedDescriptor == cd.GetDescriptor()))
+					cb->chunksAfterFailure++;
+				if (cb->chunkCount == cb->failAtChunk) {
+					cb->failedDescriptor = cd.GetDescriptor();
+					*status = 0;
+					return;
+				}
+
 				//perform encryption/decription process
-				std::copy(inBuffer, inBuffer + outSize, outBuffer);
+				if (inBuffer == outBuffer)
+					cb->inPlaceChunkCount++;
+				else
+					std::copy(inBuffer, inBuffer + outSize, outBuffer);
 				*status = outSize;
+				cb->maxChunkSize = std::max(cb->maxChunkSize, inSize);
+				cb->totalSize += inSize;
 			}
 		}
 
@@ -238,6 +264,47 @@ namespace Lib3MF {
 				ASSERT_EQ(objCount->Count(), 28);
 			}
 		}
+
+		// Writes a model whose meshes are stored in separate, compressed and encrypted parts
+		std::vector<Lib3MF_uint8> writeEncryptedParts(Lib3MF_uint32 nPartCount) {
+			PModel partsModel = wrapper->CreateModel();
+			partsModel->SetRandomNumberCallback(notRandomBytesAtAll, nullptr);
+			auto keyStore = partsModel->GetKeyStore();
+			auto consumer = keyStore->AddConsumer("LIB3MF#TEST", "contentKey", publicKey);
+			auto rdGroup = keyStore->AddResourceDataGroup();
+			rdGroup->AddAccessRight(consumer.get(), eWrappingAlgorithm::RSA_OAEP, eMgfAlgorithm::MGF1_SHA1, eDigestMethod::SHA1);
+			std::vector<Lib3MF_uint8> aad = { 'p', 'a', 'r', 't', 's' };
+			for (Lib3MF_uint32 nPart = 0; nPart < nPartCount; nPart++) {
+				auto meshObject = partsModel->AddMeshObject();
+				meshObject->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+				partsModel->AddBuildItem(meshObject.get(), getIdentityTransform());
+				auto part = partsModel->FindOrCreatePackagePart("/3D/part" + std::to_string(nPart) + ".model");
+				meshObject->SetPackagePart(part.get());
+				keyStore->AddResourceData(rdGroup.get(), part.get(), eEncryptionAlgorithm::AES256_GCM, eCompression::Deflate, aad);
+			}
+
+			PWriter writer = partsModel->QueryWriter("3mf");
+			DEKCallbackData contentData;
+			writer->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&contentData);
+			KEKCallbackData wrappingData;
+			wrappingData.value = 1;
+			wrappingData.consumerId = "LIB3MF#TEST";
+			wrappingData.keyId = "contentKey";
+			writer->AddKeyWrappingCallback(wrappingData.consumerId, testKEKCallback, (Lib3MF_pvoid)&wrappingData);
+			std::vector<Lib3MF_uint8> buffer;
+			writer->WriteToBuffer(buffer);
+			return buffer;
+		}
+
+		PReader readerForEncryptedParts(PModel readModel, DEKCallbackData & dekData, KEKCallbackData & kekData) {
+			PReader reader = readModel->QueryReader("3mf");
+			reader->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&dekData);
+			kekData.value = 1;
+			kekData.consumerId = "LIB3MF#TEST";
+			kekData.keyId = "contentKey";
+			reader->AddKeyWrappingCallback(kekData.consumerId, testKEKCallback, (Lib3MF_pvoid)&kekData);
+			return reader;
+		}
 	};
 	
 
@@ -646,4 +713,147 @@ namespace Lib3MF {
 		generateTestFiles(false, "keystore.3mf");
 		generateTestFiles(true, "keystore_compressed.3mf");
 	}
+
+	TEST_F(SecureContentT, LargePartIsCryptedInChunks) {
+		// Enough vertices for the part to exceed the 1 MB crypt buffer of the encrypted streams
+		const Lib3MF_uint32 nVertexCount = 60000;
+		std::vector<sPosition> vertices(nVertexCount);
+		std::vector<sTriangle> triangles(nVertexCount - 2);
+		for (Lib3MF_uint32 nIndex = 0; nIndex < nVertexCount; nIndex++)
+			vertices[nIndex] = fnCreateVertex(nIndex * 0.5f, (nIndex % 7) * 1.25f, (nIndex % 13) * 2.75f);
+		for (Lib3MF_uint32 nIndex = 0; nIndex + 2 < nVertexCount; nIndex++)
+			triangles[nIndex] = fnCreateTriangle(nIndex, nIndex + 1, nIndex + 2);
+
+		auto meshObject = model->AddMeshObject();
+		meshObject->SetGeometry(vertices, triangles);
+		model->AddBuildItem(meshObject.get(), getIdentityTransform());
+		auto part = model->FindOrCreatePackagePart("/3D/largemesh.model");
+		meshObject->SetPackagePart(part.get());
+
+		auto keyStore = model->GetKeyStore();
+		auto consumer = keyStore->AddConsumer("LIB3MF#TEST", "contentKey", publicKey);
+		auto rdGroup = keyStore->AddResourceDataGroup();
+		rdGroup->AddAccessRight(consumer.get(), eWrappingAlgorithm::RSA_OAEP, eMgfAlgorithm::MGF1_SHA1, eDigestMethod::SHA1);
+		std::vector<Lib3MF_uint8> aad = { 'l', 'a', 'r', 'g', 'e' };
+		keyStore->AddResourceData(rdGroup.get(), part.get(), eEncryptionAlgorithm::AES256_GCM, eCompression::NoCompression, aad);
+
+		PWriter writer = model->QueryWriter("3mf");
+		DEKCallbackData writeData;
+		writer->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&writeData);
+		KEKCallbackData wrappingData;
+		wrappingData.value = 1;
+		wrappingData.consumerId = "LIB3MF#TEST";
+		wrappingData.keyId = "contentKey";
+		writer->AddKeyWrappingCallback(wrappingData.consumerId, testKEKCallback, (Lib3MF_pvoid)&wrappingData);
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+
+		ASSERT_GT(writeData.totalSize, 1048576u);
+		ASSERT_LE(writeData.maxChunkSize, 1048576u);
+
+		PModel readModel = wrapper->CreateModel();
+		PReader reader = readModel->QueryReader("3mf");
+		DEKCallbackData readData;
+		reader->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&readData);
+		KEKCallbackData kekData;
+		kekData.value = 1;
+		kekData.consumerId = "LIB3MF#TEST";
+		kekData.keyId = "contentKey";
+		reader->AddKeyWrappingCallback(kekData.consumerId, testKEKCallback, (Lib3MF_pvoid)&kekData);
+		reader->ReadFromBuffer(buffer);
+
+		ASSERT_EQ(readData.totalSize, writeData.totalSize);
+		ASSERT_LE(readData.maxChunkSize, 1048576u);
+
+		auto meshObjects = readModel->GetMeshObjects();
+		ASSERT_TRUE(meshObjects->MoveNext());
+		auto readMesh = meshObjects->GetCurrentMeshObject();
+		ASSERT_EQ(readMesh->GetVertexCount(), nVertexCount);
+		ASSERT_EQ(readMesh->GetTriangleCount(), nVertexCount - 2);
+		sPosition lastVertex = readMesh->GetVertex(nVertexCount - 1);
+		ASSERT_EQ(lastVertex.m_Coordinates[0], vertices[nVertexCount - 1].m_Coordinates[0]);
+		ASSERT_EQ(lastVertex.m_Coordinates[2], vertices[nVertexCount - 1].m_Coordinates[2]);
+	}
+
+	TEST_F(SecureContentT, DecryptCompressedPartsOnCallingThread) {
+		std::vector<Lib3MF_uint8> buffer = writeEncryptedParts(8);
+
+		PModel readModel = wrapper->CreateModel();
+		DEKCallbackData dekData;
+		KEKCallbackData kekData;
+		PReader reader = readerForEncryptedParts(readModel, dekData, kekData);
+		reader->ReadFromBuffer(buffer);
+
+		ASSERT_EQ(readModel->GetMeshObjects()->Count(), 8);
+		ASSERT_EQ(dekData.context.size(), 8);
+		ASSERT_FALSE(dekData.threads.empty());
+		for (auto threadId : dekData.threads)
+			ASSERT_EQ(threadId, std::this_thread::get_id());
+	}
+
+	TEST_F(SecureContentT, FailedDecryptionIsNotRetried) {
+		std::vector<Lib3MF_uint8> buffer = writeEncryptedParts(4);
+
+		PModel readModel = wrapper->CreateModel();
+		DEKCallbackData dekData;
+		dekData.failAtChunk = 1;
+		KEKCallbackData kekData;
+		PReader reader = readerForEncryptedParts(readModel, dekData, kekData);
+		try {
+			reader->ReadFromBuffer(buffer);
+			ASSERT_FALSE(true);
+		}
+		catch (ELib3MFException const & e) {
+			// The error of the callback is reported, not an error of a second decryption attempt
+			ASSERT_EQ(e.getErrorCode(), LIB3MF_ERROR_CALCULATIONABORTED);
+		}
+
+		// The part whose decryption failed must not be decrypted again from the start
+		ASSERT_NE(dekData.failedDescriptor, 0u);
+		ASSERT_EQ(dekData.chunksAfterFailure, 0u);
+	}
+
+	TEST_F(SecureContentT, InPlaceDecryptionIsOptIn) {
+		std::vector<Lib3MF_uint8> buffer = writeEncryptedParts(4);
+
+		// By default, the callback decrypts from a separate buffer into the reader's buffer
+		PModel copyModel = wrapper->CreateModel();
+		DEKCallbackData copyData;
+		KEKCallbackData copyKekData;
+		PReader copyReader = readerForEncryptedParts(copyModel, copyData, copyKekData);
+		ASSERT_FALSE(copyReader->GetInPlaceDecryptionActive());
+		copyReader->ReadFromBuffer(buffer);
+		ASSERT_EQ(copyModel->GetMeshObjects()->Count(), 4);
+		ASSERT_GT(copyData.chunkCount, 0u);
+		ASSERT_EQ(copyData.inPlaceChunkCount, 0u);
+
+		// In-place decryption hands the same buffer as cipher and plain text to the callback
+		PModel inPlaceModel = wrapper->CreateModel();
+		DEKCallbackData inPlaceData;
+		KEKCallbackData inPlaceKekData;
+		PReader inPlaceReader = readerForEncryptedParts(inPlaceModel, inPlaceData, inPlaceKekData);
+		inPlaceReader->SetInPlaceDecryptionActive(true);
+		ASSERT_TRUE(inPlaceReader->GetInPlaceDecryptionActive());
+		inPlaceReader->ReadFromBuffer(buffer);
+		ASSERT_EQ(inPlaceModel->GetMeshObjects()->Count(), 4);
+		ASSERT_GT(inPlaceData.chunkCount, 0u);
+		ASSERT_EQ(inPlaceData.inPlaceChunkCount, inPlaceData.chunkCount);
+		ASSERT_EQ(inPlaceData.totalSize, copyData.totalSize);
+
+		// The setting survives registering the callback after it
+		PModel laterModel = wrapper->CreateModel();
+		PReader laterReader = laterModel->QueryReader("3mf");
+		laterReader->SetInPlaceDecryptionActive(true);
+		DEKCallbackData laterData;
+		laterReader->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&laterData);
+		KEKCallbackData laterKekData;
+		laterKekData.value = 1;
+		laterKekData.consumerId = "LIB3MF#TEST";
+		laterKekData.keyId = "contentKey";
+		laterReader->AddKeyWrappingCallback(laterKekData.consumerId, testKEKCallback, (Lib3MF_pvoid)&laterKekData);
+		ASSERT_TRUE(laterReader->GetInPlaceDecryptionActive());
+		laterReader->ReadFromBuffer(buffer);
+		ASSERT_EQ(laterModel->GetMeshObjects()->Count(), 4);
+		ASSERT_EQ(laterData.inPlaceChunkCount, laterData.chunkCount);
+	}
 }
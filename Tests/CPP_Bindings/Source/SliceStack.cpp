@@ -118,6 +118,116 @@ namespace Lib3MF
 		auto sliceAB1 = stack->GetSlice(0);
 	}
 
+	TEST_F(SliceStack, ValidatePolygons)
+	{
+		std::vector<sPosition2D> vertices = {
+			{ { 0.f, 0.f } }, { { 10.f, 0.f } }, { { 10.f, 10.f } }, { { 0.f, 10.f } },
+			{ { 2.f, 2.f } }, { { 8.f, 2.f } }, { { 8.f, 8.f } }, { { 2.f, 8.f } },
+			{ { 5.f, 5.f } }, { { 15.f, 5.f } }, { { 15.f, 15.f } }, { { 5.f, 15.f } }
+		};
+		std::vector<Lib3MF_uint32> outer = { 0, 1, 2, 3, 0 };
+
+		// Counterclockwise outer contour with a clockwise hole
+		auto slice = sliceStack->AddSlice(1.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(outer);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 4, 7, 6, 5, 4 }));
+
+		// Open polygon
+		slice = sliceStack->AddSlice(2.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 2, 3 }));
+
+		// Bow tie
+		slice = sliceStack->AddSlice(3.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 3, 6, 0 }));
+
+		// Hole with the orientation of its outer contour
+		slice = sliceStack->AddSlice(4.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(outer);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 4, 5, 6, 7, 4 }));
+
+		// Overlapping contours
+		slice = sliceStack->AddSlice(5.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(outer);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 8, 9, 10, 11, 8 }));
+
+		std::vector<sSliceLayerReport> reports;
+		sliceStack->ValidatePolygons(reports);
+		ASSERT_EQ(reports.size(), 4);
+
+		ASSERT_EQ(reports[0].m_LayerIndex, 1);
+		ASSERT_EQ(reports[0].m_OpenPolygons, 1);
+		ASSERT_EQ(reports[1].m_LayerIndex, 2);
+		ASSERT_EQ(reports[1].m_SelfIntersections, 1);
+		ASSERT_EQ(reports[2].m_LayerIndex, 3);
+		ASSERT_EQ(reports[2].m_SelfIntersections, 0);
+		ASSERT_EQ(reports[2].m_OrientationErrors, 1);
+		ASSERT_EQ(reports[2].m_MaxNestingDepth, 1);
+		ASSERT_EQ(reports[3].m_LayerIndex, 4);
+		ASSERT_EQ(reports[3].m_SelfIntersections, 2);
+
+		auto stackRef = model->AddSliceStack(0.0);
+		stackRef->AddSliceStackReference(sliceStack.get());
+		stackRef->ValidatePolygons(reports);
+		ASSERT_EQ(reports.size(), 4);
+	}
+
+
+	TEST_F(SliceStack, ValidatePolygonsManyLayers)
+	{
+		// Enough layers to validate them on several threads
+		std::vector<sPosition2D> vertices = {
+			{ { 0.f, 0.f } }, { { 10.f, 0.f } }, { { 10.f, 10.f } }, { { 0.f, 10.f } }
+		};
+		const Lib3MF_uint32 nLayerCount = 64;
+		for (Lib3MF_uint32 nLayer = 0; nLayer < nLayerCount; nLayer++) {
+			auto slice = sliceStack->AddSlice(1.0 + nLayer);
+			slice->SetVertices(vertices);
+			if (nLayer % 5 == 3)
+				slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 2, 3 }));
+			else
+				slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 2, 3, 0 }));
+		}
+
+		std::vector<sSliceLayerReport> reports;
+		sliceStack->ValidatePolygons(reports);
+		ASSERT_EQ(reports.size(), 13);
+		for (size_t nIndex = 0; nIndex < reports.size(); nIndex++) {
+			ASSERT_EQ(reports[nIndex].m_LayerIndex, 5 * nIndex + 3);
+			ASSERT_EQ(reports[nIndex].m_OpenPolygons, 1);
+		}
+	}
+
+	TEST_F(SliceStack, ValidatePolygonsAfterModification)
+	{
+		std::vector<sPosition2D> vertices = {
+			{ { 0.f, 0.f } }, { { 10.f, 0.f } }, { { 10.f, 10.f } }, { { 0.f, 10.f } }
+		};
+		auto slice = sliceStack->AddSlice(1.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 2, 3, 0 }));
+
+		// The count query keeps its reports for the call that fills the buffer
+		Lib3MF_uint64 nNeededCount = 0;
+		ASSERT_EQ(lib3mf_slicestack_validatepolygons(sliceStack->handle(), 0, &nNeededCount, nullptr), LIB3MF_SUCCESS);
+		ASSERT_EQ(nNeededCount, 0);
+
+		// A modification in between must not return the kept reports
+		slice = sliceStack->AddSlice(2.0);
+		slice->SetVertices(vertices);
+		slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 2, 3 }));
+
+		sSliceLayerReport report;
+		ASSERT_EQ(lib3mf_slicestack_validatepolygons(sliceStack->handle(), 1, &nNeededCount, &report), LIB3MF_SUCCESS);
+		ASSERT_EQ(nNeededCount, 1);
+		ASSERT_EQ(report.m_LayerIndex, 1);
+		ASSERT_EQ(report.m_OpenPolygons, 1);
+	}
+
 
 	class SliceStackArrangement : public Lib3MFTest {
 	protected:
@@ -230,6 +340,48 @@ namespace Lib3MF
 		ASSERT_EQ(stackA->GetSliceCount(), 2);
 	}
 
+	TEST_F(SliceStackArrangement, FindSlicesAcrossReferences)
+	{
+		stackB->AddSlice(8.0);
+		stackC->AddSlice(20.0);
+		stackA->AddSliceStackReference(stackB.get());
+		stackA->AddSliceStackReference(stackC.get());
+
+		ASSERT_EQ(stackA->GetSliceCount(), 0);
+		ASSERT_EQ(stackA->GetTotalSliceCount(), 4);
+		ASSERT_EQ(stackA->GetTotalSlice(2)->GetZTop(), 15.0);
+		ASSERT_SPECIFIC_THROW(stackA->GetTotalSlice(4), ELib3MFException);
+
+		Lib3MF_uint64 nIndex = 0;
+		ASSERT_TRUE(stackA->FindSliceAtZ(5.0, nIndex));
+		ASSERT_EQ(nIndex, 0);
+		ASSERT_TRUE(stackA->FindSliceAtZ(6.0, nIndex));
+		ASSERT_EQ(nIndex, 1);
+		ASSERT_TRUE(stackA->FindSliceAtZ(12.0, nIndex));
+		ASSERT_EQ(nIndex, 2);
+		ASSERT_TRUE(stackA->FindSliceAtZ(20.0, nIndex));
+		ASSERT_EQ(nIndex, 3);
+		ASSERT_FALSE(stackA->FindSliceAtZ(0.0, nIndex));
+		ASSERT_FALSE(stackA->FindSliceAtZ(9.0, nIndex));
+		ASSERT_FALSE(stackA->FindSliceAtZ(21.0, nIndex));
+
+		Lib3MF_uint64 nFirst = 0;
+		Lib3MF_uint64 nCount = 0;
+		stackA->GetSliceRange(4.0, 12.0, nFirst, nCount);
+		ASSERT_EQ(nFirst, 0);
+		ASSERT_EQ(nCount, 3);
+		stackA->GetSliceRange(15.0, 15.0, nFirst, nCount);
+		ASSERT_EQ(nFirst, 2);
+		ASSERT_EQ(nCount, 1);
+		stackA->GetSliceRange(8.5, 9.5, nFirst, nCount);
+		ASSERT_EQ(nCount, 0);
+		ASSERT_SPECIFIC_THROW(stackA->GetSliceRange(2.0, 1.0, nFirst, nCount), ELib3MFException);
+
+		ASSERT_TRUE(stackB->FindSliceAtZ(8.0, nIndex));
+		ASSERT_EQ(nIndex, 1);
+		ASSERT_EQ(stackB->GetTotalSliceCount(), stackB->GetSliceCount());
+	}
+
 	TEST_F(SliceStackArrangement, GetSliceStacks)
 	{
 		auto stacks = model->GetSliceStacks();
@@ -388,7 +540,173 @@ namespace Lib3MF
 		checkSliceModels(readModel, readModelAgain);
 	}
 
+	TEST_F(SliceStackWriting, WriteSlicesOutOfPlace_ReadsGeometry)
+	{
+		auto stackRoot = model->AddSliceStack(0);
+		std::vector<PSliceStack> parts;
+		for (int nPart = 0; nPart < 4; nPart++) {
+			auto stack = model->AddSliceStack(2.0 + nPart * 10.0);
+			for (int nSlice = 0; nSlice < 5; nSlice++) {
+				auto slice = stack->AddSlice(3.0 + nPart * 10.0 + nSlice);
+				std::vector<sPosition2D> vVertices;
+				std::vector<Lib3MF_uint32> vPolygon;
+				for (int nVertex = 0; nVertex < 10 + nSlice; nVertex++) {
+					sPosition2D pos;
+					pos.m_Coordinates[0] = (float)(nVertex * 0.5);
+					pos.m_Coordinates[1] = (float)(nPart - nVertex * 0.25);
+					vVertices.push_back(pos);
+					vPolygon.push_back(nVertex);
+				}
+				vPolygon.push_back(0);
+				slice->SetVertices(vVertices);
+				slice->AddPolygon(vPolygon);
+			}
+			stack->SetOwnPath("/2D/part" + std::to_string(nPart) + ".model");
+			stackRoot->AddSliceStackReference(stack.get());
+			parts.push_back(stack);
+		}
 
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromBuffer(buffer);
+		ASSERT_EQ(reader->GetWarningCount(), 0);
+
+		PSliceStack readStackRoot;
+		auto readStacks = readModel->GetSliceStacks();
+		while (readStacks->MoveNext()) {
+			auto readStack = readStacks->GetCurrentSliceStack();
+			if (readStack->GetSliceRefCount() > 0)
+				readStackRoot = readStack;
+		}
+		ASSERT_TRUE(readStackRoot != nullptr);
+		ASSERT_EQ(readStackRoot->GetSliceRefCount(), parts.size());
+		for (Lib3MF_uint64 nPart = 0; nPart < parts.size(); nPart++) {
+			auto stack = parts[nPart];
+			auto readStack = readStackRoot->GetSliceStackReference(nPart);
+			CompareSliceStacks(stack, readStack);
+
+			for (Lib3MF_uint64 nSlice = 0; nSlice < stack->GetSliceCount(); nSlice++) {
+				std::vector<sPosition2D> vVertices, vReadVertices;
+				stack->GetSlice(nSlice)->GetVertices(vVertices);
+				readStack->GetSlice(nSlice)->GetVertices(vReadVertices);
+				ASSERT_EQ(vVertices.size(), vReadVertices.size());
+				for (size_t nVertex = 0; nVertex < vVertices.size(); nVertex++) {
+					ASSERT_FLOAT_EQ(vVertices[nVertex].m_Coordinates[0], vReadVertices[nVertex].m_Coordinates[0]);
+					ASSERT_FLOAT_EQ(vVertices[nVertex].m_Coordinates[1], vReadVertices[nVertex].m_Coordinates[1]);
+				}
+
+				std::vector<Lib3MF_uint32> vPolygon, vReadPolygon;
+				stack->GetSlice(nSlice)->GetPolygonIndices(0, vPolygon);
+				readStack->GetSlice(nSlice)->GetPolygonIndices(0, vReadPolygon);
+				ASSERT_EQ(vPolygon, vReadPolygon);
+			}
+		}
+	}
+
+
+
+	TEST_F(SliceStackWriting, WriteManySlices_ReadsGeometry)
+	{
+		// Enough vertex and segment lines to format the slices in parallel
+		const Lib3MF_uint32 nSliceCount = 96;
+		const Lib3MF_uint32 nVertexCount = 800;
+		auto stack = model->AddSliceStack(0.0);
+		for (Lib3MF_uint32 nSlice = 0; nSlice < nSliceCount; nSlice++) {
+			auto slice = stack->AddSlice(1.0 + nSlice * 0.5);
+			std::vector<sPosition2D> vVertices;
+			std::vector<Lib3MF_uint32> vFirstPolygon, vSecondPolygon;
+			for (Lib3MF_uint32 nVertex = 0; nVertex < nVertexCount; nVertex++) {
+				sPosition2D pos;
+				pos.m_Coordinates[0] = (float)(nVertex * 0.125);
+				pos.m_Coordinates[1] = (float)(nSlice * 0.25) - (float)(nVertex % 17);
+				vVertices.push_back(pos);
+				if (nVertex < nVertexCount / 2)
+					vFirstPolygon.push_back(nVertex);
+				else
+					vSecondPolygon.push_back(nVertex);
+			}
+			vFirstPolygon.push_back(vFirstPolygon[0]);
+			slice->SetVertices(vVertices);
+			slice->AddPolygon(vFirstPolygon);
+			slice->AddPolygon(vSecondPolygon);
+		}
+
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromBuffer(buffer);
+		ASSERT_EQ(reader->GetWarningCount(), 0);
+
+		auto readStack = readModel->GetSliceStackByID(stack->GetResourceID());
+		CompareSliceStacks(stack, readStack);
+		for (Lib3MF_uint64 nSlice = 0; nSlice < nSliceCount; nSlice++) {
+			auto slice = stack->GetSlice(nSlice);
+			auto readSlice = readStack->GetSlice(nSlice);
+			ASSERT_DOUBLE_EQ(slice->GetZTop(), readSlice->GetZTop());
+
+			std::vector<sPosition2D> vVertices, vReadVertices;
+			slice->GetVertices(vVertices);
+			readSlice->GetVertices(vReadVertices);
+			ASSERT_EQ(vVertices.size(), vReadVertices.size());
+			for (size_t nVertex = 0; nVertex < vVertices.size(); nVertex++) {
+				ASSERT_FLOAT_EQ(vVertices[nVertex].m_Coordinates[0], vReadVertices[nVertex].m_Coordinates[0]);
+				ASSERT_FLOAT_EQ(vVertices[nVertex].m_Coordinates[1], vReadVertices[nVertex].m_Coordinates[1]);
+			}
+
+			for (Lib3MF_uint64 nPolygon = 0; nPolygon < slice->GetPolygonCount(); nPolygon++) {
+				std::vector<Lib3MF_uint32> vPolygon, vReadPolygon;
+				slice->GetPolygonIndices(nPolygon, vPolygon);
+				readSlice->GetPolygonIndices(nPolygon, vReadPolygon);
+				ASSERT_EQ(vPolygon, vReadPolygon);
+			}
+		}
+	}
+
+	TEST_F(SliceStackWriting, WriteSlicesWithDecimalPrecision)
+	{
+		// Slice vertices are written with the decimal precision of the writer; further digits are cut off
+		std::vector<sPosition2D> vVertices(4);
+		vVertices[0].m_Coordinates[0] = 1.23456f;
+		vVertices[0].m_Coordinates[1] = -0.98765f;
+		vVertices[1].m_Coordinates[0] = 0.004f;
+		vVertices[1].m_Coordinates[1] = -0.004f;
+		vVertices[2].m_Coordinates[0] = 12345.678f;
+		vVertices[2].m_Coordinates[1] = 0.0f;
+		vVertices[3].m_Coordinates[0] = -3.5f;
+		vVertices[3].m_Coordinates[1] = 7.25f;
+		stackWithSlices->GetSlice(0)->SetVertices(vVertices);
+
+		std::vector<sPosition2D> vExpected(4);
+		vExpected[0].m_Coordinates[0] = 1.23f;
+		vExpected[0].m_Coordinates[1] = -0.98f;
+		vExpected[1].m_Coordinates[0] = 0.0f;
+		vExpected[1].m_Coordinates[1] = 0.0f;
+		vExpected[2].m_Coordinates[0] = 12345.67f;
+		vExpected[2].m_Coordinates[1] = 0.0f;
+		vExpected[3].m_Coordinates[0] = -3.5f;
+		vExpected[3].m_Coordinates[1] = 7.25f;
+
+		writer->SetDecimalPrecision(2);
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromBuffer(buffer);
+
+		std::vector<sPosition2D> vReadVertices;
+		readModel->GetSliceStackByID(stackWithSlices->GetResourceID())->GetSlice(0)->GetVertices(vReadVertices);
+		ASSERT_EQ(vReadVertices.size(), vExpected.size());
+		for (size_t nVertex = 0; nVertex < vExpected.size(); nVertex++) {
+			EXPECT_FLOAT_EQ(vExpected[nVertex].m_Coordinates[0], vReadVertices[nVertex].m_Coordinates[0]);
+			EXPECT_FLOAT_EQ(vExpected[nVertex].m_Coordinates[1], vReadVertices[nVertex].m_Coordinates[1]);
+		}
+	}
 
 	class SliceStackReading : public Lib3MFTest {
 	protected:
@@ -434,6 +752,26 @@ namespace Lib3MF
 		ASSERT_TRUE(sr1->GetOwnPath() == "/2D/A2dmodel.model");
 	}
 
+	TEST_F(SliceStackReading, ReadPartWithSlicesAndObjects)
+	{
+		// The slice part starts with a slice stack, but holds a mesh object as well
+		reader->ReadFromFile(sTestFilesPath + "/Slice/UniSliceStack_MixedPart.3mf");
+		ASSERT_EQ(reader->GetWarningCount(), 0u);
+		ASSERT_EQ(model->GetSliceStacks()->Count(), 3);
+
+		auto meshObjects = model->GetMeshObjects();
+		ASSERT_EQ(meshObjects->Count(), 2);
+		bool bFoundPartObject = false;
+		while (meshObjects->MoveNext()) {
+			auto meshObject = meshObjects->GetCurrentMeshObject();
+			if (meshObject->GetName() == "Part object") {
+				ASSERT_EQ(meshObject->GetTriangleCount(), 4u);
+				bFoundPartObject = true;
+			}
+		}
+		ASSERT_TRUE(bFoundPartObject);
+	}
+
 	class SliceStackReadingMultiple : public testing::TestWithParam<const char*>
 	{
 	public:
@@ -107,6 +107,17 @@ namespace Lib3MF
 
 		std::vector<Lib3MF_uint32> properties2D;
 		texture2DGroup->GetAllPropertyIDs(properties2D);
+
+		std::vector<sTex2Coord> allCoords;
+		texture2DGroup->GetAllTex2Coords(allCoords);
+		ASSERT_EQ(allCoords.size(), coords.size());
+		for (size_t i = 0; i < coords.size(); i++) {
+			EXPECT_DOUBLE_EQ(allCoords[i].m_U, coords[i].m_U);
+			EXPECT_DOUBLE_EQ(allCoords[i].m_V, coords[i].m_V);
+			allCoords[i].m_U = 1.0 - allCoords[i].m_U;
+		}
+		texture2DGroup->SetAllTex2Coords(allCoords);
+		EXPECT_DOUBLE_EQ(texture2DGroup->GetTex2Coord(properties2D[0]).m_U, 1.0 - coords[0].m_U);
 	}
 
 	TEST_F(TextureProperty, WriteRead)
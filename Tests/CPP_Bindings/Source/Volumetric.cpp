@@ -1230,6 +1230,83 @@ namespace Lib3MF
         EXPECT_TRUE(helper::isTopologiallySorted(function));
     }
 
+    TEST_F(Volumetric,
+           Volumetric_AddLinkByNames_LargeGraph_FindsRenamedAndRemovedNodes)
+    {
+        auto const function = model->AddImplicitFunction();
+        function->AddInput("pos", "position",
+                           Lib3MF::eImplicitPortType::Vector);
+        function->AddOutput("shape", "shape", Lib3MF::eImplicitPortType::Vector);
+
+        // A long chain of nodes, linked by their identifiers
+        Lib3MF_uint32 const nodeCount = 20000;
+        PSinNode lastNode;
+        for (Lib3MF_uint32 i = 0; i < nodeCount; ++i)
+        {
+            lastNode = function->AddSinNode(
+                "sin_" + std::to_string(i),
+                Lib3MF::eImplicitNodeConfiguration::VectorToVector, "", "");
+        }
+        function->AddLinkByNames("inputs.pos", "sin_0.A");
+        for (Lib3MF_uint32 i = 1; i < nodeCount; ++i)
+        {
+            function->AddLinkByNames("sin_" + std::to_string(i - 1) + ".result",
+                                     "sin_" + std::to_string(i) + ".A");
+        }
+        function->AddLinkByNames("sin_" + std::to_string(nodeCount - 1) + ".result",
+                                 "outputs.shape");
+        EXPECT_EQ(function->GetNodes()->Count(), nodeCount);
+
+        // Renamed nodes are only found by their new identifier
+        lastNode->SetIdentifier("last");
+        EXPECT_NO_THROW(function->AddLinkByNames("last.result", "outputs.shape"));
+        EXPECT_THROW(function->AddLinkByNames("sin_" + std::to_string(nodeCount - 1) + ".result",
+                                              "outputs.shape"),
+                     ELib3MFException);
+
+        // Removed nodes are not found anymore, even if they are renamed afterwards
+        function->RemoveNode(lastNode.get());
+        EXPECT_THROW(function->AddLinkByNames("last.result", "outputs.shape"),
+                     ELib3MFException);
+        lastNode->SetIdentifier("removed");
+        EXPECT_THROW(function->AddLinkByNames("removed.result", "outputs.shape"),
+                     ELib3MFException);
+        EXPECT_EQ(function->GetNodes()->Count(), nodeCount - 1);
+    }
+
+    TEST_F(Volumetric,
+           Volumetric_SortNodesTopologically_ReversedNodes_ProducersComeFirst)
+    {
+        auto const function = model->AddImplicitFunction();
+        function->AddInput("pos", "position",
+                           Lib3MF::eImplicitPortType::Vector);
+
+        // Consumers are added before the nodes that they depend on
+        auto const dot = function->AddDotNode("dot", "dot product", "group_a");
+        auto const sin = function->AddSinNode(
+            "sin", Lib3MF::eImplicitNodeConfiguration::VectorToVector, "sinus",
+            "group_a");
+        auto const cos = function->AddCosNode(
+            "cos", Lib3MF::eImplicitNodeConfiguration::VectorToVector,
+            "cosinus", "group_a");
+
+        function->AddLink(function->FindInput("pos"), sin->GetInputA());
+        function->AddLink(sin->GetOutputResult(), cos->GetInputA());
+        function->AddLink(sin->GetOutputResult(), dot->GetInputA());
+        function->AddLink(cos->GetOutputResult(), dot->GetInputB());
+
+        function->SortNodesTopologically();
+
+        std::vector<std::string> nodeNames;
+        auto const nodes = function->GetNodes();
+        while (nodes->MoveNext())
+        {
+            nodeNames.push_back(nodes->GetCurrent()->GetIdentifier());
+        }
+        std::vector<std::string> const expectedNames = {"sin", "cos", "dot"};
+        EXPECT_EQ(nodeNames, expectedNames);
+    }
+
 
 
     TEST_F(Volumetric,
@@ -116,6 +116,108 @@ namespace Lib3MF
 		Writer::writerSTL->WriteToBuffer(buffer);
 	}
 
+	TEST_F(Writer, 3MFStreamSizeMatchesBuffer)
+	{
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_EQ(buffer.size(), nStreamSize);
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+		ASSERT_EQ(readModel->GetMeshObjects()->Count(), model->GetMeshObjects()->Count());
+	}
+
+	TEST_F(Writer, 3MFStreamSizeAfterModification)
+	{
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+		model->AddBuildItem(mesh.get(), getIdentityTransform());
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_GT(buffer.size(), nStreamSize);
+		ASSERT_EQ(Writer::writer3MF->GetStreamSize(), buffer.size());
+	}
+
+	TEST_F(Writer, 3MFStreamSizeAfterMetaDataChange)
+	{
+		auto metaData = model->GetMetaDataGroup()->AddMetaData("", "Title", "A", "string", false);
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+
+		metaData->SetValue("A much longer title that does not compress away");
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_NE(buffer.size(), nStreamSize);
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+		ASSERT_EQ(readModel->GetMetaDataGroup()->GetMetaDataByKey("", "Title")->GetValue(), "A much longer title that does not compress away");
+	}
+
+	TEST_F(Writer, 3MFStreamSizeAfterSliceChange)
+	{
+		auto slice = model->AddSliceStack(0.0)->AddSlice(1.0);
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+
+		std::vector<sPosition2D> vVertices(64);
+		for (size_t i = 0; i < vVertices.size(); i++) {
+			vVertices[i].m_Coordinates[0] = float(i * 7 % 13);
+			vVertices[i].m_Coordinates[1] = float(i * 11 % 17);
+		}
+		slice->SetVertices(vVertices);
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_GT(buffer.size(), nStreamSize);
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+		auto sliceStacks = readModel->GetSliceStacks();
+		ASSERT_TRUE(sliceStacks->MoveNext());
+		ASSERT_EQ(sliceStacks->GetCurrentSliceStack()->GetSlice(0)->GetVertexCount(), vVertices.size());
+	}
+
+	TEST_F(Writer, 3MFStreamSizeAfterTriangleSetChange)
+	{
+		auto meshObjects = model->GetMeshObjects();
+		ASSERT_TRUE(meshObjects->MoveNext());
+		auto triangleSet = meshObjects->GetCurrentMeshObject()->AddTriangleSet("Set", "Set");
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+
+		triangleSet->AddTriangle(0);
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_NE(buffer.size(), nStreamSize);
+		ASSERT_EQ(Writer::writer3MF->GetStreamSize(), buffer.size());
+	}
+
+	static void Callback_CountWriterProgress(bool* pAbort, Lib3MF_double, eProgressIdentifier, Lib3MF_pvoid pUserData)
+	{
+		(*reinterpret_cast<Lib3MF_uint32*>(pUserData))++;
+		*pAbort = false;
+	}
+
+	TEST_F(Writer, 3MFStreamSizeWithProgressCallback)
+	{
+		Lib3MF_uint32 nCallbackCount = 0;
+		Writer::writer3MF->SetProgressCallback(Callback_CountWriterProgress, &nCallbackCount);
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+		ASSERT_GT(nCallbackCount, 0u);
+
+		// A write with a registered progress callback must report progress
+		// again instead of replaying the package of GetStreamSize.
+		nCallbackCount = 0;
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		ASSERT_GT(nCallbackCount, 0u);
+		ASSERT_EQ(buffer.size(), nStreamSize);
+	}
+
 	TEST_F(Writer, 3MFCompare)
 	{
 		// This test is atleast functional
@@ -172,6 +274,284 @@ namespace Lib3MF
 		ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), callbackBuffer.vec.begin()));
 	}
 
+	TEST_F(Writer, 3MFStatistics)
+	{
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromFile(Writer::InFolder + "Pyramid.3mf");
+		std::string sReadStatistics = reader->GetStatistics();
+
+		std::vector<Lib3MF_uint8> buffer;
+		Writer::writer3MF->WriteToBuffer(buffer);
+		std::string sWriteStatistics = Writer::writer3MF->GetStatistics();
+
+		ASSERT_NE(sReadStatistics.find("\"entries\":["), std::string::npos);
+		ASSERT_NE(sWriteStatistics.find("\"entries\":["), std::string::npos);
+		if (sReadStatistics.find("\"enabled\":true") != std::string::npos) {
+			ASSERT_NE(sReadStatistics.find("\"part\":\"/3D/3dmodel.model\",\"phase\":\"READROOTMODEL\""), std::string::npos);
+			ASSERT_NE(sWriteStatistics.find("\"part\":\"/3D/3dmodel.model\",\"phase\":\"WRITEROOTMODEL\""), std::string::npos);
+		}
+	}
+
+	// Returns a counter of the first statistics entry that starts with sEntry, or -1 if there is none
+	static Lib3MF_int64 fnGetStatisticsValue(const std::string & sStatistics, const std::string & sEntry, const std::string & sCounter)
+	{
+		size_t nEntryPos = sStatistics.find("{" + sEntry);
+		if (nEntryPos == std::string::npos)
+			return -1;
+		size_t nEntryEnd = sStatistics.find('}', nEntryPos);
+		size_t nCounterPos = sStatistics.find("\"" + sCounter + "\":", nEntryPos);
+		if ((nCounterPos == std::string::npos) || (nCounterPos > nEntryEnd))
+			return -1;
+		return std::stoll(sStatistics.substr(nCounterPos + sCounter.length() + 3));
+	}
+
+	TEST_F(Writer, 3MFStatisticsOfParallelSliceParts)
+	{
+		const int nPartCount = 8;
+		auto sliceModel = wrapper->CreateModel();
+		for (int nPart = 0; nPart < nPartCount; nPart++) {
+			auto sliceStack = sliceModel->AddSliceStack(0.0);
+			for (int nSlice = 0; nSlice < 10; nSlice++) {
+				std::vector<sPosition2D> vVertices(4);
+				for (int nVertex = 0; nVertex < 4; nVertex++) {
+					vVertices[nVertex].m_Coordinates[0] = (float)((nVertex & 1) * 10 + nPart);
+					vVertices[nVertex].m_Coordinates[1] = (float)((nVertex >> 1) * 10);
+				}
+				auto slice = sliceStack->AddSlice(1.0 + nSlice);
+				slice->SetVertices(vVertices);
+				slice->AddPolygon(std::vector<Lib3MF_uint32>({ 0, 1, 3, 2, 0 }));
+			}
+			sliceStack->SetOwnPath("/2D/part" + std::to_string(nPart) + ".model");
+		}
+		std::vector<Lib3MF_uint8> buffer;
+		sliceModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromBuffer(buffer);
+		std::string sStatistics = reader->GetStatistics();
+		if (sStatistics.find("\"enabled\":true") == std::string::npos)
+			return;
+
+		// The slice parts are read by worker threads, which collect into the statistics of the reader
+		for (int nPart = 0; nPart < nPartCount; nPart++) {
+			std::string sEntry = "\"part\":\"/2D/part" + std::to_string(nPart) + ".model\",\"phase\":\"READNONROOTMODELS\"";
+			ASSERT_GT(fnGetStatisticsValue(sStatistics, sEntry, "elements"), 0) << sEntry;
+			ASSERT_GT(fnGetStatisticsValue(sStatistics, sEntry, "xmltime_ns"), 0) << sEntry;
+		}
+	}
+
+	TEST_F(Writer, 3MFStatisticsOfCachedExport)
+	{
+		const std::string sCopyEntry("\"part\":\"\",\"phase\":\"WRITEMODELSTOSTREAM\"");
+		Lib3MF_uint64 nStreamSize = Writer::writer3MF->GetStreamSize();
+		std::string sExportStatistics = Writer::writer3MF->GetStatistics();
+
+		PositionedVector<Lib3MF_uint8> callbackBuffer;
+		Writer::writer3MF->WriteToCallback(PositionedVector<Lib3MF_uint8>::writeCallback,
+			PositionedVector<Lib3MF_uint8>::seekCallback, reinterpret_cast<Lib3MF_pvoid>(&callbackBuffer));
+		ASSERT_EQ(callbackBuffer.vec.size(), nStreamSize);
+
+		std::string sStatistics = Writer::writer3MF->GetStatistics();
+		if (sStatistics.find("\"enabled\":true") == std::string::npos)
+			return;
+
+		// The copy of the cached package is added to the statistics of the export that created it
+		ASSERT_NE(sStatistics.find("\"part\":\"/3D/3dmodel.model\",\"phase\":\"WRITEROOTMODEL\""), std::string::npos);
+		ASSERT_EQ(fnGetStatisticsValue(sStatistics, sCopyEntry, "bytesout"), fnGetStatisticsValue(sExportStatistics, sCopyEntry, "bytesout") + (Lib3MF_int64)nStreamSize);
+		ASSERT_GT(fnGetStatisticsValue(sStatistics, "\"enabled\":true", "walltime_ns"), fnGetStatisticsValue(sExportStatistics, "\"enabled\":true", "walltime_ns"));
+	}
+
+	TEST_F(Writer, 3MFIncrementalWriteToSameFile)
+	{
+		const std::string sAttachmentType("http://schemas.autodesk.com/dmg/testattachment/2017/08");
+		std::string sPayload;
+		for (int nIndex = 0; nIndex < 10000; nIndex++)
+			sPayload += "PAYLOAD" + std::to_string(nIndex);
+		auto attachment = model->AddAttachment("/Attachments/payload.txt", sAttachmentType);
+		attachment->ReadFromBuffer(CInputVector<Lib3MF_uint8>((Lib3MF_uint8*)sPayload.data(), sPayload.size()));
+		Writer::writer3MF->WriteToFile(Writer::OutFolder + "Incremental.3mf");
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->AddRelationToRead(sAttachmentType);
+		reader->ReadFromFile(Writer::OutFolder + "Incremental.3mf");
+		Lib3MF_uint64 nBuildItemCount = readModel->GetBuildItems()->Count();
+		auto buildItems = readModel->GetBuildItems();
+		ASSERT_TRUE(buildItems->MoveNext());
+		auto object = buildItems->GetCurrent()->GetObjectResource();
+
+		auto writer = readModel->QueryWriter("3mf");
+		ASSERT_FALSE(writer->GetIncrementalModeActive());
+		writer->SetIncrementalModeActive(true);
+		ASSERT_TRUE(writer->GetIncrementalModeActive());
+
+		sTransform transform = getIdentityTransform();
+		transform.m_Fields[3][0] = 100.0f;
+		readModel->AddBuildItem(object.get(), transform);
+		writer->WriteToFile(Writer::OutFolder + "Incremental.3mf");
+
+		auto checkModel = wrapper->CreateModel();
+		auto checkReader = checkModel->QueryReader("3mf");
+		checkReader->AddRelationToRead(sAttachmentType);
+		checkReader->ReadFromFile(Writer::OutFolder + "Incremental.3mf");
+		ASSERT_EQ(checkModel->GetBuildItems()->Count(), nBuildItemCount + 1);
+		ASSERT_EQ(checkModel->GetMeshObjects()->Count(), readModel->GetMeshObjects()->Count());
+
+		std::vector<Lib3MF_uint8> buffer;
+		checkModel->FindAttachment("/Attachments/payload.txt")->WriteToBuffer(buffer);
+		ASSERT_EQ(std::string(buffer.begin(), buffer.end()), sPayload);
+	}
+
+	TEST_F(Writer, 3MFIncrementalWriteNonRootModels)
+	{
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + "/Production/2ProductionBoxes.3mf");
+		auto buildItems = readModel->GetBuildItems();
+		Lib3MF_uint64 nBuildItemCount = buildItems->Count();
+		ASSERT_TRUE(buildItems->MoveNext());
+		auto object = buildItems->GetCurrent()->GetObjectResource();
+
+		auto writer = readModel->QueryWriter("3mf");
+		writer->SetIncrementalModeActive(true);
+		readModel->AddBuildItem(object.get(), getIdentityTransform());
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+
+		auto checkModel = wrapper->CreateModel();
+		checkModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+		ASSERT_EQ(checkModel->GetBuildItems()->Count(), nBuildItemCount + 1);
+		ASSERT_EQ(checkModel->GetMeshObjects()->Count(), readModel->GetMeshObjects()->Count());
+		ASSERT_EQ(checkModel->GetComponentsObjects()->Count(), readModel->GetComponentsObjects()->Count());
+	}
+
+	// Defined in SliceStack.cpp
+	void CompareSliceStacks(PSliceStack A, PSliceStack B);
+
+	// The parts of this file are stored uncompressed, so parts that are copied as they were read show up verbatim in the package
+	static const std::string sStoredSliceFile("/Slice/UniSliceStack_TwoFiles_Stored.3mf");
+	static const std::string sStoredSliceVertex("<s:vertex x=\"1.01\" y=\"1.02\" />");
+
+	static bool fnBufferContains(const std::vector<Lib3MF_uint8> & buffer, const std::string & sText)
+	{
+		return std::search(buffer.begin(), buffer.end(), sText.begin(), sText.end()) != buffer.end();
+	}
+
+	static PSliceStack fnFindSliceStackByPath(PModel model, const std::string & sPath)
+	{
+		auto sliceStacks = model->GetSliceStacks();
+		while (sliceStacks->MoveNext()) {
+			auto sliceStack = sliceStacks->GetCurrentSliceStack();
+			if ((sliceStack->GetOwnPath() == sPath) && (sliceStack->GetSliceCount() > 0))
+				return sliceStack;
+		}
+		return nullptr;
+	}
+
+	TEST_F(Writer, 3MFIncrementalWriteCopiesRawEntries)
+	{
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + sStoredSliceFile);
+		auto buildItems = readModel->GetBuildItems();
+		Lib3MF_uint64 nBuildItemCount = buildItems->Count();
+		ASSERT_TRUE(buildItems->MoveNext());
+		readModel->AddBuildItem(buildItems->GetCurrent()->GetObjectResource().get(), getIdentityTransform());
+
+		std::vector<Lib3MF_uint8> regularBuffer;
+		readModel->QueryWriter("3mf")->WriteToBuffer(regularBuffer);
+		ASSERT_FALSE(fnBufferContains(regularBuffer, sStoredSliceVertex));
+
+		auto writer = readModel->QueryWriter("3mf");
+		writer->SetIncrementalModeActive(true);
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+		ASSERT_TRUE(fnBufferContains(buffer, sStoredSliceVertex));
+
+		auto checkModel = wrapper->CreateModel();
+		auto checkReader = checkModel->QueryReader("3mf");
+		checkReader->ReadFromBuffer(buffer);
+		ASSERT_EQ(checkReader->GetWarningCount(), 0);
+		ASSERT_EQ(checkModel->GetBuildItems()->Count(), nBuildItemCount + 1);
+		auto sliceStack = fnFindSliceStackByPath(readModel, "/2D/2Dmodel_1.model");
+		auto checkSliceStack = fnFindSliceStackByPath(checkModel, "/2D/2Dmodel_1.model");
+		ASSERT_TRUE(checkSliceStack != nullptr);
+		CompareSliceStacks(sliceStack, checkSliceStack);
+	}
+
+	TEST_F(Writer, 3MFIncrementalWriteAfterSourceFileChange)
+	{
+		const std::string sSourceFile = Writer::OutFolder + "IncrementalSource.3mf";
+		{
+			std::ifstream sourceFile(sTestFilesPath + sStoredSliceFile, std::ios::binary);
+			std::ofstream copyFile(sSourceFile, std::ios::binary);
+			copyFile << sourceFile.rdbuf();
+		}
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromFile(sSourceFile);
+		auto writer = readModel->QueryWriter("3mf");
+		writer->SetIncrementalModeActive(true);
+
+		// Another model overwrites the source file, which compresses all of its parts anew
+		auto otherModel = wrapper->CreateModel();
+		otherModel->QueryReader("3mf")->ReadFromFile(sSourceFile);
+		otherModel->QueryWriter("3mf")->WriteToFile(sSourceFile);
+
+		// The entries of the source file do not match anymore, so the parts are written from the model
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+		ASSERT_FALSE(fnBufferContains(buffer, sStoredSliceVertex));
+
+		auto checkModel = wrapper->CreateModel();
+		auto checkReader = checkModel->QueryReader("3mf");
+		checkReader->ReadFromBuffer(buffer);
+		ASSERT_EQ(checkReader->GetWarningCount(), 0);
+		auto checkSliceStack = fnFindSliceStackByPath(checkModel, "/2D/2Dmodel_1.model");
+		ASSERT_TRUE(checkSliceStack != nullptr);
+		CompareSliceStacks(fnFindSliceStackByPath(readModel, "/2D/2Dmodel_1.model"), checkSliceStack);
+	}
+
+	TEST_F(Writer, 3MFIncrementalWriteAfterSliceChange)
+	{
+		const std::string sFileName = Writer::OutFolder + "IncrementalSlices.3mf";
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromFile(sTestFilesPath + sStoredSliceFile);
+		auto writer = readModel->QueryWriter("3mf");
+		writer->SetIncrementalModeActive(true);
+
+		auto sliceStack = fnFindSliceStackByPath(readModel, "/2D/2Dmodel_1.model");
+		ASSERT_TRUE(sliceStack != nullptr);
+		std::vector<sPosition2D> vVertices;
+		sliceStack->GetSlice(0)->GetVertices(vVertices);
+		for (auto & vertex : vVertices) {
+			vertex.m_Coordinates[0] += 0.5f;
+			vertex.m_Coordinates[1] -= 0.25f;
+		}
+		sliceStack->GetSlice(0)->SetVertices(vVertices);
+		writer->WriteToFile(sFileName);
+
+		// The modified slice stack is written from the model, not copied from the source file
+		std::ifstream file(sFileName, std::ios::binary);
+		std::vector<Lib3MF_uint8> fileBuffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		ASSERT_FALSE(fnBufferContains(fileBuffer, sStoredSliceVertex));
+
+		auto checkModel = wrapper->CreateModel();
+		auto checkReader = checkModel->QueryReader("3mf");
+		checkReader->ReadFromFile(sFileName);
+		ASSERT_EQ(checkReader->GetWarningCount(), 0);
+		auto checkSliceStack = fnFindSliceStackByPath(checkModel, "/2D/2Dmodel_1.model");
+		ASSERT_TRUE(checkSliceStack != nullptr);
+		CompareSliceStacks(sliceStack, checkSliceStack);
+
+		std::vector<sPosition2D> vReadVertices;
+		checkSliceStack->GetSlice(0)->GetVertices(vReadVertices);
+		ASSERT_EQ(vReadVertices.size(), vVertices.size());
+		for (size_t nIndex = 0; nIndex < vVertices.size(); nIndex++) {
+			EXPECT_NEAR(vReadVertices[nIndex].m_Coordinates[0], vVertices[nIndex].m_Coordinates[0], 1e-5);
+			EXPECT_NEAR(vReadVertices[nIndex].m_Coordinates[1], vVertices[nIndex].m_Coordinates[1], 1e-5);
+		}
+	}
+
 	TEST_F(Writer, STLWriteToCallback)
 	{
 		PositionedVector<Lib3MF_uint8> callbackBuffer;